@@ -4,14 +4,23 @@
 #include "src/config.h"
 #include "src/components/logging/logging.h"
 #include "src/components/display/display.h"
+#include "src/components/display/tft_backend.h"
 #include "src/components/ui/ui.h"
+#include "src/components/wifi/wifi.h"
+#include "src/components/weather/weather.h"
+#include "src/components/weather/weather_task.h"
+#include "src/components/weather/http_timing.h"
 
 #include <lvgl.h>
 #include <WiFi.h>
 
 // Global component instances
-Display display;
+TftBackend tftBackend;
+Display display(tftBackend);
 UI ui;
+WiFiComponent wifi;
+Weather weather;
+WeatherTask weatherTask(weather);
 
 // Global variables (required by config.h extern declarations)
 Language current_language = LANG_EN;
@@ -21,6 +30,44 @@ char latitude[16] = LATITUDE_DEFAULT;
 char longitude[16] = LONGITUDE_DEFAULT;
 String location = LOCATION_DEFAULT;
 
+// Serial commands, one per line: "http_timing" lists recent requests with
+// their phase timings per host, "display_stats" the flush, DMA wait and
+// background cache counters; anything else goes to the logging commands
+char serialCommand[64];
+size_t serialCommandLength = 0;
+
+void handleSerialCommand(const char* command) {
+    if (strcmp(command, "http_timing") == 0) {
+        HttpTimingRing::shared().log(true);
+        return;
+    }
+    if (strcmp(command, "display_stats") == 0) {
+        display.getBackend().logStats();
+        ui.logStats();
+        return;
+    }
+    if (strcmp(command, "help") == 0) {
+        LOG_MAIN_I("http_timing                 - Show recent HTTP request phase timings");
+        LOG_MAIN_I("display_stats               - Show display flush, DMA wait and image cache counters");
+    }
+    logging_handle_serial_command(command);
+}
+
+void pollSerialCommands() {
+    while (Serial.available() > 0) {
+        char c = Serial.read();
+        if (c == '\r' || c == '\n') {
+            if (serialCommandLength > 0) {
+                serialCommand[serialCommandLength] = '\0';
+                handleSerialCommand(serialCommand);
+                serialCommandLength = 0;
+            }
+        } else if (serialCommandLength < sizeof(serialCommand) - 1) {
+            serialCommand[serialCommandLength++] = c;
+        }
+    }
+}
+
 void setup() {
     Serial.begin(115200);
     delay(3000); // Longer delay for serial stability
@@ -79,12 +126,36 @@ void setup() {
     
     LOG_MEMORY_INFO(TAG_MAIN);
     
-    Serial.println("DEBUG: Step 5 - Starting heartbeat test (TOUCH THE SCREEN!)");
+    // Show the last good forecast before WiFi, which can take seconds
+    if (weatherTask.restoreSnapshot()) {
+        const WeatherData* cached = weatherTask.takeUpdate();
+        if (cached) {
+            ui.updateWeatherData(*cached);
+            lv_timer_handler();
+        }
+        LOG_MAIN_I("DEBUG: Cached forecast shown %lu ms after boot", millis());
+    }
+    
+    Serial.println("DEBUG: Step 5 - Connecting WiFi and starting weather task...");
+    Serial.flush();
+    
+    // Test 5: Fetching happens on its own task; loop() only picks up results
+    if (!wifi.init() || !wifi.connect()) {
+        LOG_MAIN_W("DEBUG: WiFi not connected, weather task will keep retrying");
+    }
+    if (!weather.init() || !weatherTask.start()) {
+        LOG_MAIN_E("DEBUG: Weather initialization failed!");
+    }
+    
+    LOG_MEMORY_INFO(TAG_MAIN);
+    
+    Serial.println("DEBUG: Step 6 - Starting heartbeat test (TOUCH THE SCREEN!)");
     Serial.flush();
 }
 
 unsigned long lastHeartbeat = 0;
 unsigned long lastLVGLTick = 0;
+unsigned long lastClockTick = 0;
 int heartbeatCount = 0;
 
 void loop() {
@@ -96,6 +167,19 @@ void loop() {
         lastLVGLTick = now;
     }
     lv_timer_handler();
+    pollSerialCommands();
+    
+    // Never blocks: a new snapshot is only there once the weather task published it
+    const WeatherData* update = weatherTask.takeUpdate();
+    if (update) {
+        ui.updateWeatherData(*update);
+    }
+    
+    // Clock tick; also moves the hourly forecast on without a fetch
+    if (now - lastClockTick >= 1000) {
+        ui.updateClock();
+        lastClockTick = now;
+    }
     
     // Simple heartbeat every 3 seconds (longer to make touch testing easier)
     if (now - lastHeartbeat > 3000) {
@@ -113,6 +197,13 @@ void loop() {
             Serial.println("DEBUG: === TOUCH THE SCREEN TO TEST EVENT HANDLERS ===");
             Serial.flush();
         }
+        
+        // Per-host request timing and display flush summaries once a minute
+        if (heartbeatCount % 20 == 0) {
+            HttpTimingRing::shared().log(false);
+            display.getBackend().logStats();
+            ui.logStats();
+        }
     }
     
     delay(5); // Very small delay for responsive touch
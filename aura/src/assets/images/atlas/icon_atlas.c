@@ -0,0 +1,828 @@
+// Generated by tools/pack_icons.py from aura/src/assets/images/icons: each
+// icon as a 4-bit indexed (LV_COLOR_FORMAT_I4) slice of one array, a
+// 16-colour ARGB8888 palette followed by the pixels. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_ICON_ATLAS
+  #define LV_ATTRIBUTE_ICON_ATLAS
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_ATLAS uint8_t
+    icon_atlas_map[] = {
+
+        0xe7, 0xe3, 0xe7, 0xc7, 0x00, 0x00, 0x00, 0x00, 0xce, 0xcb, 0xce, 0x2a, 0xde, 0xdb, 0xde,
+        0x5c, 0xe7, 0xe3, 0xe7, 0xfc, 0xe7, 0xe3, 0xe7, 0xee, 0xc6, 0xc7, 0xc6, 0x81, 0xde, 0xdb,
+        0xde, 0x48, 0xce, 0xcf, 0xce, 0x93, 0xce, 0xcf, 0xce, 0x19, 0xde, 0xdf, 0xde, 0x9f, 0xde,
+        0xdb, 0xde, 0x69, 0xde, 0xdb, 0xde, 0x0b, 0xd6, 0xd7, 0xd6, 0xdd, 0xc6, 0xc7, 0xc6, 0xcc,
+        0xce, 0xcf, 0xce, 0x38, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xba, 0x71, 0x11, 0x77, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0xa5, 0x57, 0x9b, 0x66, 0xb2, 0x11, 0x11, 0x11, 0x11, 0x11, 0xc7, 0x5a,
+        0xc6, 0xdd, 0x6c, 0x11, 0x1c, 0x73, 0x33, 0x33, 0x38, 0x48, 0x98, 0xee, 0x89, 0x11, 0x19,
+        0xd4, 0x44, 0x44, 0x44, 0x02, 0xc2, 0xbb, 0x29, 0x11, 0x1c, 0x3b, 0xbb, 0xbb, 0xb3, 0x2c,
+        0xcc, 0xf2, 0x11, 0x11, 0x1c, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x11, 0x1c,
+        0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x48, 0x11, 0x1c, 0x3b, 0xbb, 0xfc, 0xcc, 0x9f,
+        0xcc, 0xc9, 0x0d, 0xc1, 0x19, 0xd4, 0x44, 0xd7, 0x1f, 0x78, 0x22, 0xf8, 0x5e, 0xc1, 0x1c,
+        0x73, 0x3b, 0x50, 0x96, 0xee, 0xaf, 0xb4, 0x0f, 0x11, 0x11, 0x11, 0xc2, 0xd0, 0x93, 0xed,
+        0x89, 0x9f, 0x91, 0x11, 0x11, 0x11, 0xb5, 0x46, 0xc3, 0xb8, 0x3f, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x7a, 0x3c, 0x11, 0x23, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe3,
+        0xe7, 0xff, 0xbd, 0xbe, 0xbd, 0xe0, 0xd6, 0xd7, 0xd6, 0x57, 0xce, 0xcf, 0xce, 0x3b, 0xc6,
+        0xc3, 0xc6, 0x1c, 0xe7, 0xe7, 0xe7, 0x92, 0xe7, 0xe3, 0xe7, 0xf5, 0xce, 0xcf, 0xce, 0x7e,
+        0xe7, 0xe3, 0xe7, 0xca, 0xde, 0xdf, 0xde, 0x0e, 0xe7, 0xe7, 0xe7, 0x47, 0xde, 0xdf, 0xde,
+        0x2a, 0xe7, 0xe3, 0xe7, 0xed, 0xd6, 0xd3, 0xd6, 0x6e, 0xce, 0xcb, 0xce, 0x8e, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xc0, 0x00,
+        0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x9c, 0x54, 0xee, 0x45, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xc8, 0x76, 0x5f, 0x22, 0xf5, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xc3, 0x76, 0xa8,
+        0x22, 0x8a, 0x00, 0x0a, 0x97, 0xdd, 0xdd, 0xd7, 0xd4, 0x53, 0x88, 0x35, 0x00, 0x0a, 0x86,
+        0x66, 0x66, 0x6f, 0x40, 0x00, 0x44, 0x00, 0x00, 0x0a, 0x86, 0x66, 0x66, 0x66, 0x66, 0x66,
+        0x66, 0x3a, 0x00, 0x0a, 0x97, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xd7, 0x7e, 0x00, 0x00, 0xcc,
+        0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc4, 0x99, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x53, 0xd9, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xd3, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xff, 0xdf, 0xce, 0x4b, 0xff, 0xdb, 0xc6, 0xff, 0x00, 0x00, 0x00, 0x00,
+        0xff, 0xdf, 0xce, 0x86, 0xff, 0xdb, 0xc6, 0xd3, 0xff, 0xdb, 0xc6, 0x15, 0xff, 0xdf, 0xce,
+        0x24, 0xff, 0xdb, 0xce, 0xf2, 0xff, 0xdf, 0xce, 0xba, 0xff, 0xdf, 0xce, 0xe7, 0xff, 0xdb,
+        0xce, 0x3a, 0xff, 0xdb, 0xce, 0x51, 0xff, 0xdf, 0xce, 0xd5, 0xff, 0xdf, 0xce, 0xff, 0xff,
+        0xdf, 0xce, 0x9d, 0xff, 0xdf, 0xce, 0x63, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+        0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0xa6, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x26,
+        0x3c, 0x90, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x0c, 0xdd, 0x85, 0x22, 0x22, 0x22,
+        0x22, 0x22, 0x22, 0x20, 0x9d, 0xdd, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x6c, 0xdd,
+        0xdd, 0xf2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x3d, 0xdd, 0xdd, 0xf2, 0x22, 0x22, 0x22,
+        0x22, 0x22, 0x25, 0xcd, 0xdd, 0xdd, 0xf2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2a, 0x7d, 0xdd,
+        0xdd, 0xe2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2b, 0xdd, 0xdd, 0xdd, 0xc6, 0x22, 0x22, 0x22,
+        0x22, 0x22, 0x2b, 0xdd, 0xdd, 0xdd, 0xd3, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2a, 0x7d, 0xdd,
+        0xdd, 0xd9, 0x02, 0x22, 0x22, 0x22, 0x22, 0x25, 0xcd, 0xdd, 0xdd, 0xdd, 0x9b, 0x22, 0x22,
+        0x22, 0x22, 0x22, 0x3d, 0xdd, 0xdd, 0xdd, 0xd7, 0x36, 0x22, 0x22, 0x22, 0x22, 0x64, 0xdd,
+        0xdd, 0xdd, 0xd1, 0x19, 0x83, 0xb2, 0x22, 0x22, 0x20, 0x9d, 0xdd, 0xd1, 0x11, 0x11, 0x19,
+        0xb2, 0x22, 0x22, 0x22, 0x04, 0x11, 0x11, 0x11, 0x11, 0x40, 0x22, 0x22, 0x22, 0x22, 0x26,
+        0x34, 0x71, 0x17, 0x43, 0x62, 0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0xab, 0xba, 0x52, 0x22,
+        0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xef, 0xeb, 0xef,
+        0x96, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe7, 0xe7, 0xfe, 0xef, 0xeb, 0xef, 0xff, 0xef, 0xeb,
+        0xef, 0xb3, 0xef, 0xeb, 0xef, 0x5e, 0xef, 0xe7, 0xef, 0x2c, 0xf7, 0xf3, 0xf7, 0x0a, 0xef,
+        0xeb, 0xef, 0x42, 0xe7, 0xe7, 0xe7, 0xa5, 0xef, 0xeb, 0xef, 0xc2, 0xef, 0xe7, 0xef, 0x1e,
+        0xe7, 0xe7, 0xe7, 0x81, 0xef, 0xeb, 0xef, 0x71, 0xef, 0xeb, 0xef, 0xe8, 0xef, 0xef, 0xef,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x80, 0xaa,
+        0x95, 0xf1, 0x11, 0x11, 0x11, 0x11, 0x11, 0xb9, 0x23, 0x33, 0x33, 0x46, 0x11, 0x11, 0x11,
+        0x11, 0x1f, 0x43, 0x33, 0x33, 0x33, 0x3a, 0xb1, 0x11, 0x11, 0x11, 0x1d, 0x33, 0x33, 0x33,
+        0x33, 0x33, 0x01, 0x11, 0x11, 0x11, 0xfa, 0x33, 0x33, 0x33, 0x33, 0x33, 0xe9, 0x90, 0x5f,
+        0x11, 0x6e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x23, 0x34, 0xb1, 0x8e, 0x33, 0x33, 0x33,
+        0x33, 0x33, 0x32, 0x23, 0x33, 0x01, 0x6e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x23,
+        0xe6, 0x7a, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x22, 0x22, 0xe8, 0x15, 0x23, 0x33, 0x33,
+        0x33, 0x33, 0x23, 0x32, 0x23, 0xe6, 0x17, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+        0x01, 0x11, 0xfc, 0xe3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x34, 0xb1, 0x11, 0x11, 0x6d, 0x09,
+        0x99, 0x99, 0x99, 0x90, 0x5f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0xef, 0xeb, 0xef, 0xff, 0xef,
+        0xeb, 0xef, 0x69, 0xef, 0xeb, 0xef, 0xb4, 0xff, 0xe7, 0x00, 0x6d, 0xef, 0xeb, 0xef, 0x46,
+        0xff, 0xe7, 0x00, 0xd1, 0xe7, 0xe7, 0xe7, 0x0f, 0xe7, 0xe7, 0xe7, 0xa1, 0xff, 0xe7, 0x00,
+        0x2a, 0xef, 0xeb, 0xef, 0xc7, 0xff, 0xe7, 0x00, 0xef, 0xef, 0xeb, 0xef, 0xec, 0xef, 0xeb,
+        0xef, 0xd8, 0xef, 0xeb, 0xef, 0x29, 0xe7, 0xe7, 0xe7, 0x89, 0x00, 0x00, 0x07, 0xe5, 0xe7,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xcc, 0xc3, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x02, 0xc1, 0x11, 0x11, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x11, 0x11, 0x11,
+        0x1c, 0x57, 0x70, 0x00, 0x00, 0x00, 0x81, 0x11, 0x11, 0x11, 0x11, 0xda, 0xaf, 0xe0, 0x00,
+        0x07, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xae, 0x00, 0x07, 0xd1, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x18, 0x00, 0x00, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x70,
+        0x00, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x70, 0x00, 0x73, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x1f, 0x00, 0x00, 0x0e, 0x31, 0x11, 0x11, 0x11, 0x11, 0x11, 0x37, 0x00,
+        0x00, 0x00, 0x75, 0xf8, 0x88, 0x88, 0x88, 0x82, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x9b, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96,
+        0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x90, 0x00, 0x00, 0x00, 0x00,
+        0xef, 0xeb, 0xef, 0xff, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xbe, 0xbd, 0x84, 0xef, 0xeb, 0xef,
+        0xcb, 0xce, 0xcf, 0xce, 0x58, 0xde, 0xdf, 0xde, 0x2d, 0xe7, 0xe7, 0xe7, 0xa2, 0xce, 0xcb,
+        0xce, 0x43, 0xd6, 0xd3, 0xd6, 0x70, 0xbd, 0xbe, 0xbd, 0xd0, 0xef, 0xeb, 0xef, 0xe6, 0xef,
+        0xeb, 0xef, 0xb9, 0xbd, 0xbe, 0xbd, 0xeb, 0xd6, 0xd7, 0xd6, 0x91, 0xde, 0xdf, 0xde, 0x10,
+        0xe7, 0xe7, 0xe7, 0xfc, 0x11, 0x11, 0x1e, 0x57, 0x5e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x4b, 0xaf, 0xab, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0xf0, 0x00, 0x00, 0xf8,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x7a, 0x00, 0x00, 0x00, 0x0a, 0x7e, 0xe1, 0x11, 0x11, 0x11,
+        0x60, 0x00, 0x00, 0x00, 0x00, 0xab, 0xbd, 0x51, 0x11, 0x1e, 0x30, 0x00, 0x00, 0x00, 0x00,
+        0xff, 0x00, 0x35, 0x11, 0x1e, 0x30, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x06, 0x11, 0x11,
+        0xb0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xe1, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0xff, 0xff, 0xf3, 0xe1, 0x11, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x11, 0x11,
+        0x15, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x11, 0x11, 0x11, 0xe4, 0xd6, 0x66, 0x66,
+        0x66, 0x68, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1e, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x14, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x14, 0x82, 0x28,
+        0x41, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x2c, 0xc2, 0xe1, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x15, 0xd9, 0x9d, 0x51, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x78, 0x87,
+        0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc3,
+        0xc6, 0xd8, 0xc6, 0xc3, 0xc6, 0x9c, 0xbd, 0xbe, 0xbd, 0xb2, 0xc6, 0xc3, 0xc6, 0xef, 0xbd,
+        0xbe, 0xbd, 0x63, 0xc6, 0xc3, 0xc6, 0x49, 0xc6, 0xc3, 0xc6, 0xc8, 0xbd, 0xbe, 0xbd, 0x26,
+        0xbd, 0xbe, 0xbd, 0x93, 0xc6, 0xc3, 0xc6, 0x72, 0xbd, 0xc3, 0xbd, 0x83, 0xbd, 0xc3, 0xbd,
+        0x3b, 0xbd, 0xbe, 0xbd, 0x0a, 0xc6, 0xc7, 0xc6, 0x16, 0xbd, 0xbe, 0xbd, 0xea, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xec, 0x68, 0x00, 0x00, 0x86, 0xce, 0x00, 0x00, 0x00, 0x8a, 0x74, 0x4f, 0x26, 0x62, 0xf4,
+        0x47, 0xa8, 0x00, 0x00, 0xa4, 0x35, 0x6b, 0x14, 0x41, 0xb6, 0x53, 0xfa, 0x00, 0x00, 0x88,
+        0xdd, 0xd0, 0xec, 0xce, 0x0d, 0xdd, 0x88, 0x00, 0x00, 0xd8, 0xb7, 0x13, 0x6e, 0xe6, 0x31,
+        0x7b, 0x8d, 0x00, 0x00, 0x54, 0xf3, 0x97, 0x41, 0x14, 0x79, 0x2f, 0xf5, 0x00, 0x00, 0x6a,
+        0x80, 0x0d, 0x6b, 0xb6, 0xd0, 0x08, 0xa6, 0x00, 0x00, 0x00, 0xcb, 0x95, 0xe0, 0x0e, 0x59,
+        0xbc, 0x00, 0x00, 0x00, 0x63, 0x4f, 0x14, 0x12, 0x21, 0xf7, 0x1f, 0x36, 0x00, 0x00, 0x57,
+        0x5e, 0xdc, 0x97, 0x79, 0xcd, 0xe5, 0x35, 0x00, 0x00, 0xd0, 0xdc, 0x68, 0x0d, 0xd0, 0x86,
+        0xcd, 0x0d, 0x00, 0x00, 0x8a, 0x74, 0x4f, 0x26, 0x62, 0xf4, 0xf7, 0xa8, 0x00, 0x00, 0xa4,
+        0x35, 0x6b, 0x1f, 0xf1, 0xb6, 0x53, 0xfa, 0x00, 0x00, 0x88, 0xd0, 0x00, 0xec, 0xce, 0x00,
+        0x0d, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xe7, 0xe7, 0xef, 0x9c, 0xef, 0xeb, 0xef, 0xff, 0x00, 0x00, 0x00, 0x00,
+        0xff, 0xe7, 0x00, 0x6b, 0xff, 0xe7, 0x00, 0xf1, 0xef, 0xeb, 0xef, 0xb8, 0xef, 0xe7, 0xef,
+        0x27, 0xff, 0xe7, 0x00, 0xc1, 0xef, 0xeb, 0xef, 0xec, 0xff, 0xe7, 0x08, 0x4d, 0xff, 0xe7,
+        0x00, 0x2a, 0xe7, 0xe7, 0xe7, 0xff, 0xf7, 0xeb, 0x63, 0x0f, 0xef, 0xeb, 0xef, 0xce, 0xef,
+        0xeb, 0xef, 0x6e, 0xef, 0xeb, 0xef, 0x46, 0x22, 0x22, 0x2c, 0x6f, 0x6c, 0x22, 0x22, 0x22,
+        0x22, 0x22, 0x22, 0x22, 0xf5, 0x88, 0x85, 0xf2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2e, 0x81,
+        0x11, 0x11, 0x8e, 0x22, 0x22, 0x22, 0x22, 0x22, 0xf8, 0x11, 0x11, 0x11, 0x18, 0xfc, 0xc2,
+        0x22, 0x22, 0x22, 0x01, 0x11, 0x11, 0x11, 0x11, 0xd5, 0x50, 0x62, 0x22, 0x2c, 0xd1, 0x11,
+        0x11, 0x11, 0x11, 0xbb, 0x11, 0xd6, 0x22, 0x2c, 0xd1, 0x11, 0x11, 0x11, 0x11, 0xbb, 0xb1,
+        0x10, 0x22, 0x22, 0x51, 0x11, 0x11, 0x11, 0x11, 0xbb, 0xbb, 0x1d, 0xc2, 0x22, 0xe1, 0x11,
+        0x11, 0x11, 0x11, 0xbb, 0xbb, 0xbd, 0xc2, 0x22, 0xc5, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x1e, 0x22, 0x22, 0x26, 0x5b, 0x11, 0x11, 0x11, 0x11, 0x11, 0x5c, 0x22, 0x22, 0x22, 0xcf,
+        0x00, 0x00, 0x00, 0x00, 0x0e, 0xc2, 0x22, 0x22, 0x22, 0x2a, 0x92, 0x29, 0x92, 0x29, 0xa2,
+        0x22, 0x22, 0x22, 0x22, 0xc7, 0x49, 0xa4, 0x4a, 0x94, 0x7c, 0x22, 0x22, 0x22, 0x22, 0xc7,
+        0x43, 0xa4, 0x4a, 0x34, 0x7c, 0x22, 0x22, 0x22, 0x22, 0x2a, 0x9c, 0x29, 0x92, 0xc9, 0xa2,
+        0x22, 0x22, 0x22, 0x22, 0x29, 0x3c, 0x23, 0x32, 0xc3, 0x92, 0x22, 0x22, 0x22, 0x22, 0xc7,
+        0x43, 0xa4, 0x4a, 0x34, 0x7c, 0x22, 0x22, 0x22, 0x22, 0xc7, 0x49, 0xa7, 0x7a, 0x94, 0x7c,
+        0x22, 0x22, 0x22, 0x22, 0x2c, 0xa2, 0x2a, 0xa2, 0x2a, 0xc2, 0x22, 0x22, 0x00, 0x00, 0x00,
+        0x00, 0xef, 0xeb, 0xef, 0xec, 0xef, 0xeb, 0xef, 0xff, 0xbd, 0xbe, 0xbd, 0xa5, 0xce, 0xcb,
+        0xce, 0x4d, 0xe7, 0xe7, 0xe7, 0xa3, 0xc6, 0xcb, 0xc6, 0x18, 0xce, 0xcb, 0xce, 0x32, 0xce,
+        0xcb, 0xce, 0x0b, 0xe7, 0xe3, 0xe7, 0xd4, 0xbd, 0xbe, 0xbd, 0xbb, 0xef, 0xeb, 0xef, 0x8b,
+        0xc6, 0xc7, 0xc6, 0x26, 0xc6, 0xc7, 0xc6, 0x7f, 0xc6, 0xc3, 0xc6, 0x6a, 0xde, 0xdf, 0xde,
+        0xc1, 0x00, 0x00, 0x08, 0x74, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x11,
+        0x1f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x12, 0x22, 0x22, 0x1d, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x41, 0x22, 0x22, 0x22, 0x21, 0x48, 0x80, 0x00, 0x00, 0x00, 0x52, 0x22, 0x22,
+        0x22, 0x22, 0x9f, 0xfb, 0xc0, 0x00, 0x08, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x97,
+        0x00, 0x06, 0x92, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2b, 0x00, 0x08, 0xf2, 0x22, 0x22,
+        0x22, 0x22, 0x22, 0x22, 0x29, 0x80, 0x00, 0xd2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x29,
+        0x80, 0x00, 0x6f, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x2b, 0x00, 0x00, 0x0c, 0x52, 0x22,
+        0x22, 0x22, 0x22, 0x22, 0xf6, 0x00, 0x00, 0x00, 0x84, 0xb5, 0x55, 0x55, 0x55, 0x5e, 0x60,
+        0x00, 0x00, 0x00, 0x08, 0x60, 0x00, 0x08, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x07, 0xd0,
+        0x80, 0x6d, 0xe8, 0x4d, 0x60, 0x00, 0x00, 0x07, 0xde, 0x3e, 0xd0, 0x63, 0xd8, 0xe3, 0xc0,
+        0x00, 0x00, 0x08, 0x4f, 0x93, 0xc0, 0x0c, 0x60, 0x6c, 0x00, 0x00, 0x00, 0x06, 0xda, 0xf3,
+        0x40, 0x84, 0x78, 0x74, 0x80, 0x00, 0x00, 0x0c, 0x44, 0x37, 0x40, 0x6a, 0xd8, 0xda, 0xc0,
+        0x00, 0x00, 0x00, 0x0c, 0xe0, 0x00, 0x84, 0x78, 0x74, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xcf, 0xef, 0xfb, 0xef,
+        0xeb, 0xef, 0x5a, 0xde, 0xe3, 0xe7, 0x9d, 0xef, 0xeb, 0xef, 0xfe, 0xff, 0xe7, 0x00, 0xde,
+        0x42, 0xc7, 0xff, 0xcd, 0x39, 0xdb, 0xff, 0xfc, 0xff, 0xe7, 0x00, 0x5f, 0x9c, 0xd7, 0xd6,
+        0x13, 0x42, 0xbe, 0xff, 0x79, 0xe7, 0xeb, 0xef, 0xcb, 0x4a, 0xae, 0xff, 0xfc, 0x8c, 0xcb,
+        0xf7, 0x34, 0x5a, 0xd7, 0xff, 0xfe, 0xff, 0xe7, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x09, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x22, 0xd9, 0xa6, 0x76, 0xa0, 0x00, 0x00,
+        0x00, 0x09, 0x34, 0x44, 0x4b, 0xe7, 0x77, 0x7a, 0x00, 0x00, 0x00, 0x93, 0x44, 0x44, 0x44,
+        0x4e, 0x77, 0x76, 0x00, 0x00, 0x00, 0x24, 0x44, 0x44, 0x44, 0x41, 0xee, 0xe6, 0x00, 0x00,
+        0x00, 0xb4, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4b, 0x20, 0x00, 0x09, 0xb4, 0x44, 0x41, 0x44,
+        0x44, 0x44, 0x44, 0x42, 0x00, 0x09, 0xb4, 0x44, 0x11, 0x44, 0x44, 0x44, 0x44, 0x4b, 0x90,
+        0x00, 0x34, 0x44, 0xc1, 0x44, 0x44, 0x44, 0x44, 0x4b, 0x90, 0x00, 0xdb, 0x4e, 0xc1, 0x44,
+        0x44, 0x44, 0x44, 0x43, 0x00, 0x00, 0x0d, 0x1c, 0xcc, 0xc1, 0x44, 0x44, 0x44, 0xbd, 0x00,
+        0x00, 0x0d, 0x6c, 0xcc, 0xc3, 0x33, 0x33, 0x33, 0xd0, 0x00, 0x00, 0x0d, 0xaa, 0xcc, 0xa0,
+        0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xc6, 0x90, 0x00, 0x85, 0x50, 0x00, 0x00,
+        0x00, 0x00, 0x0d, 0x6d, 0x00, 0x00, 0x85, 0x59, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xa0, 0x00,
+        0x00, 0x98, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x09, 0x90, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xf5, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5,
+        0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+        0xff, 0xe7, 0x10, 0x2a, 0xff, 0xdb, 0xce, 0xfb, 0x94, 0xcb, 0xf7, 0xfb, 0x42, 0xae, 0xff,
+        0x82, 0x00, 0x00, 0x00, 0x00, 0xce, 0xd7, 0xbd, 0x11, 0xef, 0xeb, 0xef, 0xe0, 0xe7, 0xe3,
+        0xe7, 0x9c, 0x42, 0xae, 0xff, 0xba, 0xef, 0xeb, 0xef, 0xff, 0x4a, 0xae, 0xff, 0xf8, 0xff,
+        0xe7, 0x00, 0x5f, 0xff, 0xe7, 0x00, 0xde, 0xf7, 0xe7, 0xe7, 0xc6, 0xef, 0xe7, 0xe7, 0x59,
+        0x9c, 0xcb, 0xf7, 0x34, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0xe5, 0x44, 0x44, 0x44, 0x44,
+        0x44, 0x4f, 0xee, 0xf4, 0x5d, 0xd5, 0x44, 0x44, 0x44, 0x44, 0x45, 0x76, 0x99, 0x67, 0x71,
+        0x1e, 0x44, 0x44, 0x44, 0x44, 0x57, 0x99, 0x99, 0x99, 0x91, 0x1d, 0xf5, 0x44, 0x44, 0x44,
+        0xe9, 0x99, 0x99, 0x99, 0x99, 0x11, 0x17, 0x54, 0x44, 0x44, 0xd9, 0x99, 0x99, 0x99, 0x99,
+        0x99, 0x96, 0xe4, 0x44, 0x45, 0xd9, 0x99, 0x92, 0x99, 0x99, 0x99, 0x99, 0x9e, 0x44, 0x45,
+        0xd9, 0x99, 0x22, 0x99, 0x99, 0x99, 0x99, 0x9d, 0x54, 0x44, 0x79, 0x99, 0xa2, 0x99, 0x99,
+        0x99, 0x99, 0x9d, 0x54, 0x44, 0xf6, 0x92, 0xa2, 0x99, 0x99, 0x99, 0x99, 0x97, 0x44, 0x44,
+        0x4f, 0x2a, 0xaa, 0xa2, 0x99, 0x99, 0x99, 0xdf, 0x44, 0x44, 0x4f, 0xaa, 0xaa, 0xa7, 0x77,
+        0x77, 0x77, 0xf4, 0x44, 0x44, 0x4f, 0x33, 0xaa, 0x34, 0x44, 0x4b, 0x04, 0x44, 0x44, 0x44,
+        0x44, 0x4f, 0xa8, 0x54, 0x44, 0xbc, 0xc5, 0x44, 0x44, 0x44, 0x44, 0x4f, 0xaf, 0x44, 0x44,
+        0xbc, 0xc5, 0x44, 0x44, 0x44, 0x44, 0x4f, 0x34, 0x44, 0x44, 0x5b, 0x04, 0x44, 0x44, 0x44,
+        0x44, 0x45, 0x54, 0x4b, 0xb4, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0c, 0xc0,
+        0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0c, 0xc0, 0x44, 0x44, 0x44, 0x44, 0x44,
+        0x44, 0x44, 0x44, 0x40, 0x04, 0x44, 0x44, 0x44, 0x44, 0xff, 0xdf, 0xce, 0xff, 0x00, 0x00,
+        0x00, 0x00, 0xf7, 0xe7, 0xe7, 0xab, 0xff, 0xdb, 0xc6, 0xef, 0xf7, 0xe7, 0xe7, 0xfa, 0xff,
+        0xdf, 0xce, 0x3a, 0xff, 0xdb, 0xce, 0x86, 0xff, 0xdb, 0xc6, 0x25, 0xf7, 0xe7, 0xe7, 0x9a,
+        0xff, 0xdb, 0xce, 0x4f, 0xff, 0xdf, 0xce, 0x14, 0xff, 0xdb, 0xce, 0xd4, 0xff, 0xdb, 0xc6,
+        0xff, 0xef, 0xef, 0xef, 0xff, 0xef, 0xe3, 0xde, 0xd7, 0xff, 0xe3, 0xd6, 0x60, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x57, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x6b, 0x39, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x9b, 0x00, 0xba, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x30, 0x00, 0x61, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x7b, 0x00, 0x00, 0xf1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x60,
+        0x00, 0x00, 0xf1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0xb0, 0x00, 0x00, 0xf1, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x15, 0x30, 0x00, 0x00, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x00,
+        0x00, 0x00, 0xb7, 0x11, 0x11, 0x11, 0x11, 0x11, 0x19, 0x00, 0x00, 0x00, 0x06, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x15, 0x30, 0x00, 0x00, 0x03, 0x91, 0x11, 0x11, 0x11, 0x11, 0x15, 0x4d,
+        0xd4, 0xc0, 0x00, 0xb9, 0x11, 0x11, 0x11, 0x11, 0x18, 0xdd, 0xdd, 0x40, 0xc0, 0x03, 0x67,
+        0x11, 0x11, 0x11, 0x12, 0xdd, 0xdd, 0xdd, 0x0c, 0x0c, 0xc3, 0x26, 0x91, 0x11, 0x1f, 0x4d,
+        0xdd, 0xdd, 0xcc, 0xcc, 0xcc, 0xc3, 0x91, 0x11, 0x11, 0x98, 0x2e, 0x40, 0x3c, 0xcc, 0xcc,
+        0xb9, 0x11, 0x11, 0x11, 0x11, 0x17, 0x6b, 0x3c, 0xc3, 0xb6, 0x71, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x1a, 0x59, 0x95, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x63, 0x79, 0x84, 0x01, 0xef, 0xeb, 0xef, 0xff, 0x42, 0xdb, 0xff, 0xff,
+        0xe7, 0xeb, 0xef, 0x95, 0xef, 0xeb, 0xef, 0xe7, 0x39, 0xdb, 0xff, 0xb4, 0xad, 0xe3, 0xf7,
+        0xff, 0x4a, 0xdb, 0xff, 0xe2, 0xe7, 0xe7, 0xe7, 0x58, 0xe7, 0xe7, 0xe7, 0x77, 0xef, 0xeb,
+        0xef, 0xbe, 0x94, 0xdf, 0xef, 0x1b, 0x42, 0xdb, 0xff, 0x45, 0xe7, 0xe7, 0xef, 0x31, 0xc6,
+        0xe7, 0xef, 0xff, 0xe7, 0xe7, 0xe7, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x77, 0x5c,
+        0x00, 0x00, 0x00, 0x00, 0x83, 0xaa, 0xf3, 0x72, 0x22, 0x27, 0xc0, 0x00, 0x00, 0xbf, 0x11,
+        0x11, 0x11, 0xe2, 0x22, 0x22, 0x50, 0x00, 0x0b, 0xf1, 0x11, 0x11, 0x11, 0x1e, 0x22, 0x22,
+        0x7b, 0x00, 0x09, 0x11, 0x11, 0x11, 0x11, 0x11, 0x62, 0x22, 0x7b, 0x00, 0xba, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x16, 0x66, 0x7b, 0x00, 0xd4, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x1a, 0xb0, 0xd4, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0xd4, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x4d, 0x0a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x4d, 0x08, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x4d, 0x00, 0x31, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x30, 0x00, 0xb9, 0x41, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x1f, 0xb0, 0x00, 0x00, 0xd9, 0x3f, 0xff, 0xff, 0xff, 0xf3, 0x8b, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdb, 0xce,
+        0xff, 0x00, 0x00, 0x00, 0x00, 0xef, 0xeb, 0xe7, 0xa7, 0xf7, 0xe3, 0xd6, 0x4f, 0xf7, 0xe7,
+        0xde, 0xe6, 0xef, 0xef, 0xef, 0xff, 0xf7, 0xe7, 0xe7, 0x72, 0xf7, 0xe7, 0xde, 0x62, 0xf7,
+        0xe3, 0xd6, 0x81, 0xef, 0xe7, 0xef, 0x30, 0xef, 0xe7, 0xe7, 0xfd, 0xf7, 0xeb, 0xe7, 0xc4,
+        0xef, 0xeb, 0xe7, 0x21, 0xef, 0xe7, 0xe7, 0x3e, 0xf7, 0xeb, 0xe7, 0x0e, 0xef, 0xe7, 0xe7,
+        0x99, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x1e, 0x73, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xe2, 0x07, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0xee, 0x11, 0x80, 0x07, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x3f, 0xbb,
+        0x27, 0xb0, 0x0f, 0x11, 0x11, 0x11, 0x11, 0xc2, 0xa5, 0x55, 0x55, 0xa0, 0x04, 0x31, 0x11,
+        0x11, 0x1e, 0x25, 0x55, 0x55, 0x55, 0x5a, 0x00, 0x46, 0xce, 0x11, 0x16, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0xa0, 0x00, 0x48, 0x11, 0xeb, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0xaa, 0x4d,
+        0x11, 0x94, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0xa5, 0xa2, 0xc1, 0xda, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x5a, 0xa5, 0x55, 0xf1, 0x94, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0xaa, 0xa5,
+        0x4c, 0xeb, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0xaa, 0xaa, 0xad, 0x17, 0xa5, 0x55, 0x55,
+        0x55, 0x55, 0x5a, 0x5a, 0xaa, 0x4c, 0x1e, 0xf5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0xf1, 0x11, 0xe8, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x52, 0xc1, 0x11, 0x11, 0x96, 0xf2,
+        0x22, 0x22, 0x22, 0x2f, 0x7e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x39, 0xd7, 0xf7, 0x17, 0x39, 0xdb, 0xff, 0xff, 0x39,
+        0xd7, 0xff, 0x86, 0x39, 0xdb, 0xff, 0x50, 0xef, 0xef, 0xef, 0xfe, 0x00, 0x00, 0x00, 0x00,
+        0x39, 0xdb, 0xff, 0xd4, 0x84, 0xdf, 0xf7, 0xff, 0xef, 0xef, 0xef, 0xa0, 0x6b, 0xd7, 0xf7,
+        0xff, 0xc6, 0xe3, 0xef, 0xd8, 0x39, 0xdb, 0xff, 0xf1, 0x39, 0xd7, 0xf7, 0x24, 0xef, 0xeb,
+        0xef, 0x54, 0x4a, 0xdb, 0xff, 0x3a, 0xbd, 0xe7, 0xf7, 0xfa, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0xe3, 0x3e, 0x05, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x5c, 0x26, 0xb1, 0x1b, 0x62, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x36, 0x11, 0x11,
+        0x11, 0x11, 0x63, 0x55, 0x55, 0x55, 0x53, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x1b, 0x35, 0x55,
+        0x55, 0xc6, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x6c, 0x55, 0x55, 0x21, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x12, 0x55, 0x50, 0x61, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x16, 0x05,
+        0x5e, 0xb1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0xe5, 0x53, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x35, 0x53, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x35,
+        0x5e, 0xb7, 0x91, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1b, 0xe5, 0x5e, 0xf4, 0x47, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x16, 0x05, 0x58, 0x44, 0x44, 0xf7, 0x11, 0x11, 0x11, 0x11, 0x12, 0x55,
+        0x58, 0x44, 0x44, 0x44, 0x91, 0x11, 0x11, 0x11, 0x6c, 0x55, 0x5d, 0x44, 0x44, 0x44, 0x91,
+        0x11, 0x11, 0x1b, 0x35, 0x55, 0x55, 0xd8, 0x8a, 0xf7, 0xb1, 0x11, 0x11, 0x63, 0x55, 0x55,
+        0x55, 0x55, 0x5c, 0x26, 0xb1, 0x1b, 0x62, 0xc5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0xe3,
+        0x3e, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x39, 0xd7, 0xff, 0x1f, 0xef, 0xef, 0xef, 0xff, 0x39, 0xd7, 0xff, 0x53, 0x39, 0xdb, 0xff,
+        0xfe, 0x39, 0xd7, 0xff, 0x8a, 0xa5, 0xdf, 0xef, 0xff, 0x00, 0x00, 0x00, 0x00, 0xde, 0xeb,
+        0xef, 0x43, 0x39, 0xd7, 0xff, 0xda, 0xef, 0xeb, 0xef, 0x6e, 0xe7, 0xeb, 0xef, 0xe2, 0x7b,
+        0xdf, 0xf7, 0xff, 0xef, 0xef, 0xef, 0xa8, 0x39, 0xd7, 0xff, 0x3d, 0xef, 0xeb, 0xef, 0x29,
+        0xce, 0xeb, 0xf7, 0xfe, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+        0x66, 0x66, 0x60, 0xd2, 0x2d, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x60, 0x48, 0x33, 0x33,
+        0x84, 0x06, 0x66, 0x66, 0x66, 0x66, 0x28, 0x33, 0x33, 0x33, 0x33, 0x82, 0x66, 0x66, 0x66,
+        0x62, 0x33, 0x33, 0x33, 0x33, 0x33, 0x38, 0x26, 0x66, 0x66, 0x08, 0x33, 0x33, 0x33, 0x33,
+        0x33, 0x33, 0x80, 0x66, 0x66, 0x43, 0xbb, 0xb3, 0x33, 0x33, 0x33, 0x33, 0x34, 0x66, 0x60,
+        0x8f, 0x11, 0x1f, 0x53, 0x33, 0x33, 0x33, 0x38, 0x06, 0x67, 0xf1, 0x11, 0x11, 0x15, 0x33,
+        0x33, 0x33, 0x33, 0xd6, 0x6c, 0x11, 0x11, 0x11, 0x11, 0xb3, 0x33, 0x33, 0x33, 0x26, 0xea,
+        0x11, 0x11, 0x11, 0x11, 0x1f, 0xfb, 0x33, 0x33, 0x26, 0x7a, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0xb3, 0x33, 0xd6, 0xea, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xf3, 0x38, 0x06, 0x6c,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xf3, 0x34, 0x66, 0x67, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0xf3, 0x80, 0x66, 0x66, 0x9a, 0x11, 0x11, 0x11, 0x11, 0x1f, 0xb8, 0x26, 0x66, 0x66,
+        0x6e, 0x9a, 0x55, 0x55, 0x55, 0x53, 0x82, 0x66, 0x66, 0x66, 0x66, 0x60, 0x48, 0x33, 0x33,
+        0x84, 0x06, 0x66, 0x66, 0x66, 0x66, 0x66, 0x60, 0xd2, 0x2d, 0x06, 0x66, 0x66, 0x66, 0x66,
+        0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0xff, 0xdb,
+        0xce, 0xd0, 0xef, 0xef, 0xef, 0xff, 0xef, 0xc7, 0xb5, 0xeb, 0xef, 0xeb, 0xe7, 0x66, 0xf7,
+        0xe3, 0xd6, 0x3a, 0xef, 0xef, 0xef, 0x9d, 0xf7, 0xd3, 0xc6, 0xf5, 0xf7, 0xe3, 0xd6, 0xff,
+        0xff, 0xe7, 0xde, 0x16, 0xef, 0xeb, 0xe7, 0xc8, 0xf7, 0xd7, 0xc6, 0x4e, 0xf7, 0xd7, 0xc6,
+        0x84, 0xf7, 0xe3, 0xd6, 0x25, 0xef, 0xeb, 0xe7, 0x0d, 0xef, 0xef, 0xef, 0xe6, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x5d, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xc1, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xb1, 0x88, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x78, 0x88, 0xc0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xd1, 0x88, 0x88, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8,
+        0x88, 0x88, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x12, 0x22, 0x22, 0x6e, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x05, 0x22, 0x22, 0x22, 0x26, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x22,
+        0x22, 0x22, 0x22, 0x49, 0xe0, 0x00, 0x00, 0x00, 0xdf, 0x22, 0x22, 0x22, 0x22, 0xff, 0xa4,
+        0xe0, 0x00, 0x00, 0x5f, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x40, 0x00, 0x00, 0xdf, 0x22,
+        0x22, 0x22, 0x22, 0x22, 0x22, 0xae, 0x00, 0x00, 0xea, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+        0xf9, 0x00, 0x00, 0x0b, 0xf2, 0x22, 0x22, 0x22, 0x22, 0x22, 0xfc, 0xb0, 0x00, 0x00, 0x4f,
+        0x22, 0x22, 0x22, 0x22, 0x22, 0x73, 0xb0, 0x00, 0x00, 0x0d, 0xca, 0x88, 0x88, 0x88, 0x87,
+        0x1b, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xc1, 0x77, 0x77, 0x1c, 0xd0, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x09, 0x5b, 0xb5, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xeb, 0xef, 0xff, 0x42, 0xdb, 0xff, 0xfd,
+        0xe7, 0xe7, 0xef, 0xaa, 0xff, 0xe7, 0x00, 0x5c, 0xff, 0xe7, 0x00, 0xc5, 0xff, 0xe3, 0x00,
+        0x2c, 0xe7, 0xeb, 0xef, 0x50, 0xde, 0xeb, 0xef, 0xda, 0x39, 0xdb, 0xff, 0x6c, 0xef, 0xeb,
+        0xef, 0x91, 0x42, 0xdb, 0xff, 0xc8, 0xff, 0xe7, 0x00, 0xf7, 0xb5, 0xe3, 0xef, 0x2a, 0xe7,
+        0xeb, 0xef, 0x6c, 0xef, 0xe7, 0x8c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xdd, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0d, 0x77, 0xdf, 0x9b, 0x2b, 0x90, 0x00, 0x00, 0x00, 0x0f, 0xa8,
+        0x11, 0x13, 0x22, 0x22, 0x29, 0x00, 0x00, 0x00, 0xf3, 0x11, 0x11, 0x11, 0x12, 0x22, 0x2b,
+        0x00, 0x00, 0x00, 0xe1, 0x11, 0x11, 0x11, 0x18, 0x22, 0x2b, 0x00, 0x00, 0x0f, 0x31, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x18, 0xe0, 0x00, 0x0f, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x17, 0x00, 0x0f, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0xf0, 0x00, 0xa1, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0xf0, 0x00, 0xd8, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x13, 0x00, 0x00, 0x07, 0x81, 0x11, 0x11, 0x11, 0x11, 0x11, 0x8d, 0x00, 0x00, 0x00, 0xde,
+        0xa3, 0x33, 0x33, 0x33, 0x3e, 0xd0, 0x00, 0x00, 0x00, 0x06, 0x40, 0x00, 0x00, 0x04, 0x60,
+        0x00, 0x00, 0x00, 0x00, 0xf5, 0xc4, 0x00, 0x00, 0x4c, 0x5f, 0x00, 0x00, 0x00, 0x00, 0xf5,
+        0xc4, 0x00, 0x00, 0x4c, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4f, 0x00, 0x00, 0xf4, 0x60,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x56, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0xef, 0xeb, 0xef,
+        0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe7, 0x00, 0x5c, 0xe7, 0xe7, 0xe7, 0xa4, 0xff, 0xe7,
+        0x00, 0xce, 0xff, 0xe7, 0x00, 0xf7, 0xef, 0xeb, 0xef, 0xe8, 0xef, 0xe7, 0xe7, 0x5f, 0xff,
+        0xe7, 0xad, 0x13, 0xef, 0xe7, 0xe7, 0x8d, 0xef, 0xe3, 0xde, 0x35, 0xf7, 0xe7, 0xe7, 0xb7,
+        0xff, 0xe7, 0x00, 0xb4, 0xef, 0xe7, 0xe7, 0xd0, 0xff, 0xe3, 0x00, 0x2c, 0xff, 0xdb, 0xce,
+        0xfb, 0x11, 0x11, 0x11, 0x11, 0x11, 0x18, 0x78, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x77,
+        0xa1, 0x8b, 0xd8, 0x11, 0x11, 0x11, 0x11, 0x18, 0x96, 0x00, 0x63, 0x9f, 0xfa, 0x11, 0x11,
+        0x11, 0x11, 0x8b, 0x00, 0x00, 0x00, 0x0f, 0xfd, 0xa8, 0x11, 0x11, 0x11, 0x70, 0x00, 0x00,
+        0x00, 0x00, 0xff, 0xf3, 0x81, 0x11, 0x11, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x71,
+        0x11, 0x18, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11, 0x18, 0xd0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0b, 0x11, 0x11, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
+        0x81, 0x11, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x11, 0x11, 0x1a, 0xd0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0xda, 0x11, 0x11, 0x11, 0x87, 0x93, 0x33, 0x33, 0x33, 0x39, 0xa1,
+        0x11, 0x11, 0x11, 0x1e, 0x21, 0x11, 0x11, 0x12, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x8c, 0x52,
+        0x11, 0x11, 0x25, 0xc8, 0x11, 0x11, 0x11, 0x11, 0x84, 0x52, 0x11, 0x11, 0x25, 0x48, 0x11,
+        0x11, 0x11, 0x11, 0x1e, 0x28, 0x11, 0x11, 0x82, 0xe1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x12, 0x21, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xe5, 0x5e, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0xe4, 0x4e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x1e, 0xe1, 0x11, 0x11, 0x11, 0x11, 0xef, 0xeb, 0xef, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
+        0xe7, 0x00, 0xce, 0xef, 0xeb, 0xef, 0x69, 0xe7, 0xe7, 0xe7, 0xa5, 0xff, 0xe7, 0x00, 0xf7,
+        0xef, 0xeb, 0xef, 0xce, 0xff, 0xe7, 0x00, 0x54, 0xef, 0xeb, 0xef, 0x8f, 0xef, 0xeb, 0xef,
+        0x46, 0xf7, 0xe7, 0x4a, 0x2b, 0xe7, 0xe7, 0xe7, 0xf9, 0xff, 0xe7, 0x00, 0x68, 0xef, 0xe3,
+        0x9c, 0x0f, 0xff, 0xe7, 0x00, 0xb4, 0xef, 0xeb, 0xef, 0xb9, 0x11, 0x11, 0x1d, 0xa9, 0xad,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x9f, 0xbb, 0xbf, 0x91, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x13, 0xb0, 0x00, 0x00, 0xb3, 0x11, 0x11, 0x11, 0x11, 0x11, 0x9b, 0x00, 0x00, 0x00,
+        0x0b, 0x9d, 0xd1, 0x11, 0x11, 0x11, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xf8, 0xa1, 0x11,
+        0x1d, 0x60, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x6a, 0x11, 0x1d, 0x60, 0x00, 0x00, 0x00,
+        0x00, 0xbb, 0xb0, 0x08, 0x11, 0x1d, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0x06, 0xd1,
+        0x11, 0x30, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbb, 0xb6, 0xd1, 0x11, 0xdf, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x08, 0x11, 0x11, 0x1a, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x11,
+        0x11, 0x11, 0xd9, 0x84, 0x44, 0x44, 0x44, 0x83, 0xd1, 0x11, 0x11, 0x11, 0x1a, 0x71, 0x11,
+        0x11, 0x17, 0xa1, 0x11, 0x11, 0x11, 0x11, 0xde, 0x57, 0x11, 0x11, 0x75, 0xed, 0x11, 0x11,
+        0x11, 0x11, 0xd2, 0x5c, 0x11, 0x11, 0xc5, 0x2d, 0x11, 0x11, 0x11, 0x11, 0x1a, 0x7d, 0x11,
+        0x11, 0xd7, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1c, 0xc1, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x11, 0x11, 0xa5, 0x5a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xa2,
+        0x2a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1a, 0xa1, 0x11, 0x11, 0x11, 0x11,
+        0x00, 0x00, 0x00, 0x00, 0xe7, 0xe3, 0xe7, 0xcc, 0xef, 0xeb, 0xef, 0xff, 0xe7, 0xe3, 0xe7,
+        0x69, 0xde, 0xdf, 0xde, 0x97, 0xd6, 0xd7, 0xd6, 0x34, 0xe7, 0xe7, 0xe7, 0xa4, 0xe7, 0xe7,
+        0xe7, 0xfc, 0xde, 0xdf, 0xde, 0x19, 0xef, 0xeb, 0xef, 0xb4, 0xe7, 0xe3, 0xe7, 0x0a, 0xef,
+        0xeb, 0xef, 0x4c, 0xe7, 0xe3, 0xe7, 0x26, 0xef, 0xeb, 0xef, 0x3f, 0xd6, 0xd7, 0xd6, 0x82,
+        0xef, 0xeb, 0xef, 0xe7, 0x00, 0x00, 0x0a, 0x5d, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xb9, 0xf7, 0xf9, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x72, 0x22, 0x22, 0x73,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x22, 0x22, 0x22, 0x2f, 0xda, 0xa0, 0x00, 0x00, 0x00,
+        0x42, 0x22, 0x22, 0x22, 0x22, 0xf1, 0x14, 0xc0, 0x00, 0x0a, 0x12, 0x22, 0x22, 0x22, 0x22,
+        0x77, 0x22, 0x1c, 0x00, 0x08, 0x12, 0x22, 0x22, 0x22, 0x22, 0x77, 0x72, 0x24, 0x00, 0x0a,
+        0x92, 0x22, 0x22, 0x22, 0x22, 0x77, 0x77, 0x21, 0xa0, 0x00, 0x32, 0x22, 0x22, 0x22, 0x22,
+        0x77, 0x77, 0x71, 0xa0, 0x00, 0x89, 0x22, 0x22, 0x22, 0x22, 0x72, 0x22, 0x2e, 0x00, 0x00,
+        0x0c, 0x97, 0x22, 0x22, 0x22, 0x22, 0x22, 0x98, 0x00, 0x00, 0x00, 0xab, 0x46, 0x66, 0x66,
+        0x66, 0x43, 0x80, 0x00, 0x00, 0x00, 0x0c, 0xa0, 0x0a, 0xda, 0x08, 0x50, 0x00, 0x00, 0x00,
+        0x00, 0x51, 0x30, 0x0e, 0x4a, 0x86, 0x30, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x50, 0xe6, 0x88,
+        0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x68, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0xa3, 0x8a, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x4a,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xeb,
+        0xef, 0xff, 0xce, 0xcf, 0xce, 0x90, 0xef, 0xeb, 0xef, 0xb9, 0xce, 0xcf, 0xce, 0x54, 0xe7,
+        0xe7, 0xe7, 0xa1, 0xce, 0xcf, 0xce, 0x72, 0xbd, 0xbe, 0xbd, 0xc8, 0xce, 0xcf, 0xce, 0x2f,
+        0xde, 0xdb, 0xde, 0x14, 0xd6, 0xd3, 0xd6, 0x0b, 0xce, 0xcb, 0xce, 0x44, 0xe7, 0xe7, 0xe7,
+        0xff, 0xef, 0xeb, 0xef, 0xce, 0xbd, 0xbe, 0xbd, 0xea, 0xef, 0xeb, 0xef, 0xec, 0x00, 0x00,
+        0x0a, 0x8b, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xff, 0xf3, 0x40, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x06, 0xf1, 0x11, 0x11, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf,
+        0x11, 0x11, 0x11, 0x1f, 0xba, 0xa0, 0x00, 0x00, 0x00, 0x51, 0x11, 0x11, 0x11, 0x11, 0xd3,
+        0x32, 0x80, 0x00, 0x0a, 0xd1, 0x11, 0x11, 0x11, 0x11, 0xcc, 0x11, 0xd8, 0x00, 0x09, 0xd1,
+        0x11, 0x11, 0x11, 0x11, 0xcc, 0xc1, 0x15, 0x00, 0x0a, 0x31, 0x11, 0x11, 0x11, 0x11, 0xcc,
+        0xcc, 0x1d, 0x90, 0x00, 0x61, 0x11, 0x11, 0x11, 0x11, 0xcc, 0xcc, 0xcd, 0xa0, 0x00, 0x93,
+        0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x00, 0x00, 0x08, 0x5c, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x39, 0x00, 0x00, 0x00, 0xa4, 0x25, 0x55, 0x55, 0x55, 0x56, 0x90, 0x00, 0x00, 0x00,
+        0x00, 0x09, 0x90, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x06, 0x40, 0xa0, 0x82,
+        0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x62, 0x66, 0x40, 0xb7, 0xb0, 0x00, 0x00, 0x00, 0x00,
+        0x09, 0x2e, 0xe6, 0xa0, 0xa8, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x27, 0x72, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x86, 0x4b, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x04, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xe3, 0xef, 0xf2, 0xef, 0xeb, 0xef, 0x87,
+        0xff, 0xe7, 0x00, 0x82, 0x4a, 0xae, 0xff, 0xf8, 0xff, 0xe7, 0x00, 0xf0, 0x42, 0xae, 0xff,
+        0x8d, 0xe7, 0xe7, 0xef, 0xc0, 0xff, 0xe7, 0x00, 0xb5, 0xad, 0xd3, 0xf7, 0x37, 0xde, 0xe3,
+        0xef, 0x9e, 0xef, 0xeb, 0xef, 0xff, 0xef, 0xeb, 0xef, 0x67, 0xe7, 0xdf, 0x63, 0x16, 0xff,
+        0xe7, 0x00, 0x48, 0x8c, 0xc7, 0xf7, 0xff, 0x00, 0x00, 0x0d, 0x99, 0x9d, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x97, 0x11, 0x17, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1b,
+        0xbb, 0xbb, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xbb, 0xbb, 0xbb, 0xb1, 0x90, 0x00,
+        0x00, 0x00, 0x00, 0xab, 0xbb, 0xbb, 0xbb, 0xbb, 0x17, 0x72, 0x90, 0x00, 0x0d, 0x7b, 0xbb,
+        0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0x79, 0x00, 0x0d, 0x7b, 0xbb, 0x11, 0xbb, 0xbb, 0xbb, 0xbb,
+        0xba, 0x00, 0x00, 0x7b, 0xbb, 0xff, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xd0, 0x00, 0xcb, 0xb1,
+        0x4f, 0xbb, 0xbb, 0xbb, 0xbb, 0xb7, 0xd0, 0x00, 0xd7, 0xbf, 0x4f, 0x11, 0xbb, 0xbb, 0xbb,
+        0xb2, 0x00, 0x00, 0x0d, 0x74, 0x44, 0x4f, 0x1b, 0xbb, 0xbb, 0x7d, 0x00, 0x00, 0x09, 0x44,
+        0x44, 0x4a, 0xaa, 0xaa, 0xac, 0xd0, 0x00, 0x00, 0x09, 0x66, 0x44, 0x6d, 0xed, 0x0e, 0xe0,
+        0x00, 0x00, 0x00, 0x00, 0x09, 0x46, 0xd3, 0x53, 0xd8, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x09,
+        0x49, 0x08, 0x53, 0xd5, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x09, 0x60, 0x0d, 0xed, 0x0e, 0xe0,
+        0x00, 0x00, 0x00, 0x00, 0x0d, 0xd0, 0x0e, 0x3d, 0x0e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x08, 0x53, 0xd5, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x53, 0xd8, 0x5e,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xe0, 0x0d, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x42, 0xdb, 0xff, 0xf3, 0x39, 0xdb, 0xff, 0x55, 0x39, 0xdb, 0xff, 0x3d, 0x39, 0xdb,
+        0xff, 0x8a, 0x31, 0xd7, 0xff, 0xd7, 0x31, 0xdb, 0xff, 0xff, 0x39, 0xdb, 0xff, 0x26, 0x39,
+        0xdb, 0xff, 0x19, 0x39, 0xdb, 0xff, 0xff, 0x42, 0xdb, 0xff, 0xff, 0x39, 0xdb, 0xff, 0xd7,
+        0x31, 0xdb, 0xff, 0xef, 0x42, 0xdb, 0xff, 0x8a, 0x4a, 0xdf, 0xff, 0xd8, 0x39, 0xdb, 0xff,
+        0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+        0x32, 0x23, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xdb, 0x1a, 0xa1, 0xbd, 0x70, 0x00,
+        0x00, 0x00, 0x00, 0xfe, 0xaa, 0xaa, 0xaa, 0x99, 0xbf, 0x00, 0x00, 0x00, 0x0f, 0x1a, 0xaa,
+        0xaa, 0xaa, 0x99, 0x9c, 0xf0, 0x00, 0x00, 0x7e, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0xb7,
+        0x00, 0x00, 0xda, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x94, 0x00, 0x08, 0xba, 0xaa, 0xaa,
+        0xaa, 0xa9, 0x99, 0x99, 0x9b, 0x80, 0x03, 0x1a, 0xaa, 0xaa, 0xaa, 0xa9, 0x99, 0x99, 0x91,
+        0x30, 0x02, 0xaa, 0xaa, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x99, 0x20, 0x02, 0xaa, 0xaa, 0xaa,
+        0xa9, 0x99, 0x99, 0x99, 0x96, 0x20, 0x03, 0x1a, 0xaa, 0xa9, 0x99, 0x99, 0x99, 0x99, 0x9c,
+        0x30, 0x08, 0xb9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x65, 0x80, 0x00, 0x49, 0x99, 0x99,
+        0x99, 0x99, 0x99, 0x96, 0x64, 0x00, 0x00, 0x7b, 0x99, 0x99, 0x99, 0x99, 0x99, 0x66, 0x57,
+        0x00, 0x00, 0x0f, 0xc9, 0x99, 0x99, 0x99, 0x96, 0x6c, 0xf0, 0x00, 0x00, 0x00, 0xfb, 0x99,
+        0x99, 0x99, 0x66, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4b, 0x19, 0x6c, 0x54, 0x70, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x08, 0x32, 0x23, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc3, 0xc6, 0xf7, 0xbd,
+        0xbe, 0xbd, 0xc9, 0xbd, 0xbe, 0xbd, 0x37, 0xc6, 0xc3, 0xc6, 0x7f, 0xbd, 0xbe, 0xbd, 0x58,
+        0xc6, 0xc3, 0xc6, 0xb7, 0xbd, 0xbe, 0xbd, 0xfa, 0xc6, 0xc7, 0xc6, 0x13, 0xbd, 0xbe, 0xbd,
+        0xe7, 0xc6, 0xc7, 0xc6, 0x6b, 0xc6, 0xc3, 0xc6, 0x08, 0xbd, 0xbe, 0xbd, 0xaa, 0xc6, 0xc3,
+        0xc6, 0x1e, 0xc6, 0xc3, 0xc6, 0x2e, 0xbd, 0xbe, 0xbd, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0b, 0xa4, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4d, 0x00, 0x08, 0x21, 0x11, 0x11, 0x11,
+        0xff, 0xff, 0xff, 0x4b, 0x00, 0x0b, 0xe3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3e, 0xb0, 0x00,
+        0x00, 0xb3, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3e, 0x00, 0x00, 0x00, 0x86, 0x11, 0x11, 0x11,
+        0x11, 0xff, 0xf9, 0x30, 0x00, 0x00, 0x03, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x30, 0x00,
+        0x00, 0x00, 0x0b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xb0, 0x00, 0x00, 0x00, 0x0e, 0x62, 0x22,
+        0x22, 0x22, 0x22, 0x50, 0x00, 0x00, 0x00, 0x00, 0x52, 0x22, 0x22, 0x22, 0x26, 0xe0, 0x00,
+        0x00, 0x00, 0x00, 0x0b, 0xbb, 0xbb, 0xbb, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xa4,
+        0x44, 0x44, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x9f, 0xff, 0xf2, 0xe0, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0b, 0xe3, 0x33, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x33,
+        0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x7f, 0x50, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x0e, 0x44, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xce, 0xcf, 0xce, 0x4d, 0xef, 0xeb, 0xef, 0xff, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe7, 0xe7,
+        0xa0, 0xbd, 0xbe, 0xbd, 0xd8, 0xce, 0xcb, 0xce, 0x74, 0xff, 0xe7, 0x00, 0xfb, 0xef, 0xeb,
+        0xef, 0xc8, 0xd6, 0xd3, 0xb5, 0x30, 0xe7, 0xdf, 0xc6, 0x10, 0xef, 0xeb, 0xef, 0xb4, 0xce,
+        0xcb, 0xce, 0xed, 0xff, 0xe7, 0x00, 0x57, 0xef, 0xeb, 0xef, 0xec, 0xce, 0xcb, 0xce, 0x97,
+        0xff, 0xe7, 0x00, 0xbf, 0x22, 0x22, 0x29, 0x80, 0x89, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+        0x22, 0x0a, 0xdd, 0xda, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x25, 0xd1, 0x11, 0x11, 0xd5,
+        0x22, 0x22, 0x22, 0x22, 0x22, 0x0d, 0x11, 0x11, 0x11, 0x1d, 0x09, 0x92, 0x22, 0x22, 0x22,
+        0x31, 0x11, 0x11, 0x11, 0x11, 0xb7, 0x7e, 0x82, 0x22, 0x29, 0x71, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x78, 0x22, 0x29, 0x71, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x22, 0x22,
+        0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x17, 0x92, 0x22, 0x51, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x17, 0x92, 0x22, 0x9a, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1e, 0x22, 0x22,
+        0x28, 0xa1, 0x11, 0x11, 0x11, 0x11, 0x11, 0xa9, 0x22, 0x22, 0x22, 0x90, 0xe3, 0x33, 0x33,
+        0x33, 0x35, 0x92, 0x22, 0x22, 0x22, 0x22, 0x29, 0x92, 0x22, 0x2c, 0x82, 0x22, 0x22, 0x22,
+        0x22, 0x22, 0x25, 0x02, 0x22, 0xc6, 0xf9, 0x22, 0x22, 0x22, 0x22, 0x25, 0x5e, 0x55, 0x02,
+        0xc6, 0xf9, 0x22, 0x22, 0x22, 0x22, 0x29, 0x5b, 0x45, 0x92, 0x9c, 0x82, 0x22, 0x22, 0x22,
+        0x22, 0x20, 0xe4, 0x4e, 0x82, 0x90, 0x82, 0x22, 0x22, 0x22, 0x22, 0x20, 0x85, 0x00, 0x82,
+        0x0b, 0xe2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x02, 0x22, 0x9e, 0x02, 0x22, 0x22, 0x22,
+        0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+
+};
+
+const lv_image_dsc_t icon_blizzard_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 0,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_blowing_snow_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 264,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_clear_night_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 528,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_cloudy_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 792,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_drizzle_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 1056,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_flurries_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 1320,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_haze_fog_dust_smoke_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 1584,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_heavy_rain_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 1848,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_heavy_snow_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 2112,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_isolated_scattered_tstorms_day_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 2376,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_isolated_scattered_tstorms_night_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 2640,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_mostly_clear_night_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 2904,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_mostly_cloudy_day_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 3168,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_mostly_cloudy_night_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 3432,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_mostly_sunny_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 3696,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_partly_cloudy_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 3960,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_partly_cloudy_night_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 4224,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_scattered_showers_day_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 4488,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_scattered_showers_night_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 4752,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_showers_rain_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 5016,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_sleet_hail_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 5280,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_snow_showers_snow_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 5544,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_strong_tstorms_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 5808,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_sunny_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 6072,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_tornado_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 6336,
+    .reserved = NULL,
+};
+
+const lv_image_dsc_t icon_wintry_mix_rain_snow_atlas = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = 20,
+    .header.h = 20,
+    .header.stride = 10,
+    .header.reserved_2 = 0,
+    .data_size = 264,
+    .data = icon_atlas_map + 6600,
+    .reserved = NULL,
+};
@@ -25,2013 +25,231 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_CLEAR_NIGHT uint8_t
     image_clear_night_map[] = {
 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xc6, 0xff, 0xc6, 0xbf, 0xc6, 0xff,
-        0xce, 0x1f, 0xd7, 0x1f, 0xd7, 0x1f, 0xd7, 0xff, 0xce, 0x9f, 0xbe, 0xdf, 0xef, 0xff, 0xf7,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xef, 0xbf, 0xc6, 0xff, 0xce, 0x1f, 0xcf, 0x1f, 0xd7,
-        0xff, 0xce, 0x7e, 0xc6, 0xff, 0xce, 0x1f, 0xd7, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xce, 0xdf, 0xce, 0xff, 0xce, 0x1f, 0xcf, 0xdf,
-        0xde, 0x1f, 0xd7, 0x1f, 0xcf, 0x1f, 0xcf, 0x1f, 0xcf, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xdf, 0xc6, 0xbe, 0xc6, 0xbf, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xef, 0x5f, 0xdf, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xff,
-        0xff, 0xce, 0x1f, 0xcf, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xc6, 0x9e, 0xbe, 0x9e, 0xbe, 0x7d, 0xbe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0x3f, 0xdf, 0xff, 0xd6, 0x1f, 0xcf, 0xbe,
-        0xc6, 0xff, 0xce, 0x1f, 0xcf, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xbf, 0xc6, 0x3d,
-        0xb6, 0xbe, 0xc6, 0xbe, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xd6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xdf, 0xce, 0x9e, 0xc6, 0x9e, 0xbe, 0xf6, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0xff, 0xd6, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0xff, 0xce, 0xdf, 0xc6, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0x1f, 0xd7,
-        0x1f, 0xd7, 0x1f, 0xd7, 0xff, 0xce, 0x1f, 0xcf, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xbf,
-        0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
-        0xd7, 0x1f, 0xcf, 0xff, 0xce, 0x1f, 0xd7, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xc6,
-        0x7e, 0xbe, 0x9e, 0xbe, 0xdf, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xbf, 0xc6, 0x7e, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xdf, 0xce, 0x1f, 0xd7, 0x9e, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xce, 0xdf, 0xce, 0x3f, 0xd7, 0x1f, 0xd7, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xcf, 0xff, 0xce, 0x7e, 0xbe, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xc6, 0xdf, 0xce, 0x3f, 0xd7, 0x1f,
-        0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0xff, 0xce,
-        0xbf, 0xe7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xdf, 0xce, 0xff, 0xce, 0xdf, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf,
-        0xce, 0xff, 0xce, 0x1b, 0xb6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xbf, 0xc6, 0xdf, 0xce, 0x3f, 0xd7, 0x1f, 0xcf, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd7, 0xde, 0xce, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xbf, 0xbe, 0xfe, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0x1f, 0xd7, 0xff, 0xce, 0x1f,
-        0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd7,
-        0x1f, 0xd7, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xdf, 0xce, 0xff, 0xd6, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xdf, 0xce, 0xbf, 0xc6, 0x3f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd7, 0x1f, 0xcf, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xe7, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xff, 0xff, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0x3d, 0xd6, 0xdf, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xef, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xbf, 0xbe, 0x7f, 0xef, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xdf, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0x7f, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0xdf, 0xce, 0xbe, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xbf, 0xbe, 0x9f, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x9d, 0x01, 0x3f, 0xdf, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0xff, 0xd6, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xef, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xde, 0xc6, 0xdf, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0xde, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xcf, 0x1f, 0xcf,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xc6, 0xbe, 0xc6,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x37, 0x6d, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xbe, 0xce, 0x9e, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xc6, 0xbe, 0xc6, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xdf, 0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xbf, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xc6, 0x1f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf,
-        0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xbf, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0x1f, 0xd7, 0x7f, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf,
-        0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xde, 0x95, 0x1f, 0xd7,
-        0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0x1f, 0xcf, 0x5f, 0xdf, 0x7f, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0x1f, 0xd7, 0xff, 0xce, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xbf, 0xff, 0x1f, 0xd7, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xdf, 0x7f, 0xef, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e,
-        0xbe, 0x7e, 0xbe, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0xff,
-        0xce, 0xbf, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xdf, 0xce, 0xbf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf7, 0xdf, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0x1f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-        0xce, 0xff, 0xce, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xbf, 0xc6, 0x7f, 0xef, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xc6, 0xbf, 0xc6, 0xdf, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0xff, 0xce, 0x1f,
-        0xdf, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xc6, 0x1d, 0xb6,
-        0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0x1f, 0xcf, 0xff, 0xce, 0xff, 0xce, 0x7f, 0xef, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x3e, 0xae, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0x5c, 0xff, 0xff, 0xce,
-        0x1f, 0xd7, 0xdf, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xef, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xcf, 0xff, 0xce, 0xff, 0xce, 0x7f, 0xef, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xce,
-        0x7f, 0xbf, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xc6, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xdf, 0xce, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0x1f, 0xd7, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xbe, 0x3d, 0xb6, 0xdf,
-        0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7,
-        0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0xdd, 0x9d, 0xdf, 0xc6, 0xff, 0xce, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xcf, 0x1f, 0xd7, 0xbf, 0xc6,
-        0xdf, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xef, 0x7e, 0xbe, 0x5e, 0xb6, 0xbf, 0xc6, 0xdf, 0xc6,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0x1f, 0xd7, 0xdf, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0xdf, 0xce, 0xbf, 0xc6, 0x7f, 0xef,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e,
-        0xbe, 0x9e, 0xbe, 0xdf, 0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0xff,
-        0xd6, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0x0c, 0x00, 0x7f, 0xef,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x5f, 0xdf, 0x9e, 0xc6, 0xfc, 0xad, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xcf, 0xff, 0xce, 0xdf,
-        0x03, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0xff, 0xce,
-        0x9e, 0xc6, 0xdf, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe,
-        0xbf, 0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f,
-        0xcf, 0x1f, 0xd7, 0xff, 0xce, 0x9e, 0xc6, 0xdf, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf,
-        0xc6, 0x9e, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce,
-        0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xbf, 0xc6, 0x3e, 0xae, 0xdf, 0xce, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xc6, 0xbe, 0xc6, 0x9e, 0xc6, 0x9e, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0x5e, 0xb6,
-        0x7e, 0xbe, 0xdf, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xc6,
-        0x9e, 0xc6, 0x9e, 0xc6, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf,
-        0xc6, 0x7e, 0xbe, 0x7e, 0xbe, 0x5e, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xbf, 0xc6, 0x7e, 0xbe, 0x7e, 0xbe, 0x9e, 0xbe, 0xbf, 0xc6, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xbf, 0xc6, 0x9e, 0xbe, 0x9e, 0xbe, 0x7e, 0xb6, 0xdf, 0xc6, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xce, 0x7e, 0x8d, 0xbf,
-        0xc6, 0x9e, 0xbe, 0xbf, 0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0x9f, 0xbe, 0xde, 0xce, 0x7e, 0xbe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x7f, 0xe7, 0xbe, 0xc6, 0x9e, 0xbe, 0x9e, 0xbe, 0xdf, 0xc6, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0x1e, 0xa6, 0xbf,
-        0xc6, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0xbf, 0xc6, 0x3e, 0xae,
-        0xbe, 0xc6, 0xbf, 0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0x9e, 0xc6,
-        0xfc, 0xad, 0x9e, 0xc6, 0xdf, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xdf, 0xc6, 0xbf, 0xc6, 0x7f, 0xb6, 0x9e, 0xbe, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf,
-        0xc6, 0xbe, 0xc6, 0x1d, 0xb6, 0x9e, 0xbe, 0x9e, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xc6, 0xbf, 0xc6, 0x7e, 0xbe, 0x9e,
-        0xbe, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xbf, 0xc6, 0x9e, 0xbe, 0x3e, 0xae, 0x9e, 0xbe, 0x9e, 0xbe, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0xff, 0xce, 0xbe, 0xc6, 0x9f, 0xbe, 0x9e, 0xbe, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0x9e, 0xbe, 0x9e, 0xbe, 0xbe, 0xc6, 0xdf, 0xc6,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xe7, 0x1d, 0x85, 0x7e, 0xbe, 0x9e, 0xbe,
-        0x9e, 0xbe, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0x9e, 0xc6, 0x7e, 0xbe, 0x9e, 0xbe, 0x5d,
-        0xc6, 0xbf, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf,
-        0xce, 0x7e, 0xbe, 0x9e, 0xc6, 0x9e, 0xc6, 0x9e, 0xc6, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0x9e, 0xc6, 0x5e, 0xbe,
-        0x7e, 0xbe, 0x5e, 0xb6, 0x7e, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0x7e,
-        0xbe, 0x9e, 0xbe, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0x9e, 0xbe, 0x7e,
-        0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x7e, 0xbe, 0xdf, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x9e, 0xc6, 0x9f, 0xc6, 0x7e, 0xbe, 0x1c, 0xb6, 0x9e, 0xbe, 0x9e, 0xc6, 0xbf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0x9e, 0xbe,
-        0x9e, 0xbe, 0x5e, 0xbe, 0x7e, 0xbe, 0xdf, 0xce, 0x9e, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xc6, 0x7e, 0xbe, 0x9e, 0xbe, 0x7e, 0xbe,
-        0x7e, 0xbe, 0x9e, 0xc6, 0xbe, 0xc6, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0x9e,
-        0xbe, 0x7e, 0xbe, 0x5e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x1d, 0xae, 0xdf, 0xce, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x5f, 0xdf, 0x00, 0x00, 0x9e, 0xbe, 0x9e, 0xbe, 0x7e, 0xbe, 0x9e, 0xbe, 0x9e, 0xc6,
-        0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6,
-        0x9e, 0xbe, 0x9e, 0xc6, 0x5e, 0xbe, 0x9e, 0xbe, 0x7e, 0xbe, 0x9e, 0xc6, 0xbe, 0xc6, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xb6, 0x9e,
-        0xbe, 0x9e, 0xbe, 0xf9, 0x1a, 0x9e, 0xbe, 0x9e, 0xbe, 0xbe, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0x9e,
-        0xbe, 0x9e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x9e, 0xc6, 0x7e, 0xbe, 0xdf, 0xd6, 0xbf, 0xc6,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xce, 0xff, 0xce, 0x9e, 0xbe, 0x9e, 0xbe, 0x7e,
-        0xc6, 0x7e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6,
-        0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0x9e, 0xc6, 0x9e, 0xbe,
-        0x9e, 0xbe, 0x7e, 0xbe, 0x9e, 0xc6, 0x9e, 0xbe, 0x7e, 0xbe, 0x9e, 0xc6, 0x7e, 0xbe, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0xef, 0x3e, 0xae, 0xbe, 0xc6, 0x7e, 0xbe, 0x7e, 0xbe, 0xbf, 0xc6, 0xde, 0xce, 0x7e,
-        0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x9e, 0xc6, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe,
-        0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xc6, 0x9e, 0xbe, 0x7e, 0xbe, 0x7e,
-        0xbe, 0xbe, 0xc6, 0xdf, 0xc6, 0x9e, 0xbe, 0x7e, 0xbe, 0xbe, 0xc6, 0x5c, 0xa6, 0xbf, 0xc6,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xce,
-        0xdf, 0xf7, 0xdf, 0xce, 0x9e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x9e, 0xbe, 0xdf, 0xc6, 0x1f,
-        0xcf, 0x1f, 0xcf, 0x3f, 0xd7, 0x5f, 0xd7, 0x1f, 0xcf, 0x1f, 0xcf, 0xdf, 0xc6, 0x9e, 0xbe,
-        0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0xde, 0xc6, 0x37, 0x6d, 0xff, 0xce, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x15, 0x2e, 0x41, 0x55, 0x70, 0x7b, 0x1f, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1a, 0x3f,
-        0x7d, 0xa5, 0xc4, 0xea, 0xf7, 0xf9, 0xff, 0xa7, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x58, 0x98, 0xce, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xe5, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x34, 0x83,
-        0xd0, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x03, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3f, 0xa5, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3a,
-        0x9f, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0x91, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x86, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x3c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x05, 0x4d, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xb3, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x88, 0xef, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5d,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x2c, 0xad, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xd1, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xa1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x59, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x53, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xe6, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xba, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x3f, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xd1, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xf7, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x05, 0x85, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x27, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xef, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x23, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xb6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8b,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x03, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x0b, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xf1, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x3f, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x91, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x03, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x58, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xd4, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xa0, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x37, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-        0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xfd, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xfe, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x01, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x04, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xc6,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xf0, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x69, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x3d, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xf9,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xe7, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x78,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x14, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xf8, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xbd, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x55, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xfb, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x6f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x2e, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xf9,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xf7, 0x6b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x2b, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4,
-        0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xc2,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0x24, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x76, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xa6, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d,
-        0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x9a, 0x12,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xd2, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xa2, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x02, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x51, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xc9, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xce, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x6d, 0x0d,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xa4, 0x2a, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x3a, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x6d, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x9d, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xfb, 0xbd, 0x4d, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xae,
-        0x52, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x08, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xc0, 0x66, 0x22, 0x02,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xe3,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xd8, 0xa1, 0x53, 0x1f, 0x03, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xd4, 0xa8, 0x77, 0x3e, 0x21, 0x0b, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1b, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xfe, 0xf4, 0xd9, 0xb1, 0x9f, 0x86, 0x5b, 0x3f, 0x32, 0x2b, 0x2a, 0x19,
-        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x4c, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xf8, 0xf3, 0xf0, 0xf0, 0xe6, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x81, 0xfd, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x9a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x1f, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x2a, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xda,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xe4, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xe3, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x57, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xe9, 0x5e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x48, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x57, 0x01,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xd0, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xab, 0xfd, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xbb, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x11, 0x81, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x8f, 0x19, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0x4c, 0xc8, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xd3, 0x58, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x7f, 0xe3,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x91, 0x26, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x37, 0xa5, 0xed, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xf3, 0xb0, 0x45, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x3e, 0x9d, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xb0, 0x4f, 0x0c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x06, 0x39, 0x88, 0xce, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xfa, 0xdc, 0x96, 0x3f, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x19, 0x50, 0x9a, 0xd2, 0xf2, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xda, 0xa3, 0x61, 0x21,
-        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x3b,
-        0x73, 0xa5, 0xc3, 0xe8, 0xf6, 0xf8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf9,
-        0xf6, 0xee, 0xcd, 0xa8, 0x84, 0x47, 0x21, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x14, 0x2b, 0x39,
-        0x4f, 0x6c, 0x88, 0x99, 0x9e, 0x9e, 0x93, 0x85, 0x6c, 0x51, 0x3e, 0x30, 0x1a, 0x04, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0x00, 0x00, 0x00, 0xb1, 0x0c, 0x00, 0x00, 0x30, 0x75, 0x00, 0x00, 0x7f, 0x00, 0x00,
+        0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x68, 0x00, 0x00,
+        0x84, 0xbf, 0xc6, 0xff, 0xc6, 0xbf, 0xc6, 0xff, 0xce, 0x03, 0x1f, 0xd7, 0x84, 0xff, 0xce,
+        0x9f, 0xbe, 0xdf, 0xef, 0xff, 0xf7, 0x55, 0x00, 0x00, 0x88, 0x7f, 0xef, 0xbf, 0xc6, 0xff,
+        0xce, 0x1f, 0xcf, 0x1f, 0xd7, 0xff, 0xce, 0x7e, 0xc6, 0xff, 0xce, 0x02, 0x1f, 0xd7, 0x05,
+        0xff, 0xce, 0x53, 0x00, 0x00, 0x02, 0xdf, 0xce, 0x84, 0xff, 0xce, 0x1f, 0xcf, 0xdf, 0xde,
+        0x1f, 0xd7, 0x03, 0x1f, 0xcf, 0x05, 0xff, 0xce, 0x83, 0xdf, 0xc6, 0xbe, 0xc6, 0xbf, 0xc6,
+        0x50, 0x00, 0x00, 0x88, 0x7f, 0xef, 0x5f, 0xdf, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xff, 0xff,
+        0xce, 0x1f, 0xcf, 0x1f, 0xd7, 0x08, 0xff, 0xce, 0x81, 0xdf, 0xc6, 0x02, 0x9e, 0xbe, 0x81,
+        0x7d, 0xbe, 0x4e, 0x00, 0x00, 0x87, 0xff, 0xce, 0x3f, 0xdf, 0xff, 0xd6, 0x1f, 0xcf, 0xbe,
+        0xc6, 0xff, 0xce, 0x1f, 0xcf, 0x0b, 0xff, 0xce, 0x82, 0xbf, 0xc6, 0x3d, 0xb6, 0x02, 0xbe,
+        0xc6, 0x4c, 0x00, 0x00, 0x82, 0xff, 0xce, 0x1f, 0xd7, 0x02, 0xff, 0xce, 0x81, 0xff, 0xd6,
+        0x0e, 0xff, 0xce, 0x84, 0xdf, 0xce, 0x9e, 0xc6, 0x9e, 0xbe, 0xf6, 0x11, 0x4c, 0x00, 0x00,
+        0x82, 0xff, 0xce, 0xff, 0xd6, 0x13, 0xff, 0xce, 0x83, 0x1f, 0xd7, 0xff, 0xce, 0xdf, 0xc6,
+        0x4a, 0x00, 0x00, 0x81, 0xff, 0xce, 0x03, 0x1f, 0xd7, 0x82, 0xff, 0xce, 0x1f, 0xcf, 0x10,
+        0xff, 0xce, 0x02, 0xdf, 0xce, 0x81, 0xbf, 0xbe, 0x4a, 0x00, 0x00, 0x83, 0x1f, 0xd7, 0x1f,
+        0xcf, 0xff, 0xce, 0x02, 0x1f, 0xd7, 0x11, 0xff, 0xce, 0x84, 0xdf, 0xc6, 0x7e, 0xbe, 0x9e,
+        0xbe, 0xdf, 0xce, 0x49, 0x00, 0x00, 0x82, 0xbf, 0xc6, 0x7e, 0xc6, 0x15, 0xff, 0xce, 0x83,
+        0xdf, 0xce, 0x1f, 0xd7, 0x9e, 0xbe, 0x49, 0x00, 0x00, 0x02, 0xdf, 0xce, 0x82, 0x3f, 0xd7,
+        0x1f, 0xd7, 0x14, 0xff, 0xce, 0x83, 0x1f, 0xcf, 0xff, 0xce, 0x7e, 0xbe, 0x48, 0x00, 0x00,
+        0x84, 0xdf, 0xc6, 0xdf, 0xce, 0x3f, 0xd7, 0x1f, 0xd7, 0x15, 0xff, 0xce, 0x02, 0xdf, 0xce,
+        0x48, 0x00, 0x00, 0x02, 0xff, 0xce, 0x81, 0xbf, 0xe7, 0x16, 0xff, 0xce, 0x83, 0xdf, 0xce,
+        0xff, 0xce, 0xdf, 0xce, 0x47, 0x00, 0x00, 0x83, 0xdf, 0xce, 0xff, 0xce, 0x1b, 0xb6, 0x19,
+        0xff, 0xce, 0x47, 0x00, 0x00, 0x84, 0xbf, 0xc6, 0xdf, 0xce, 0x3f, 0xd7, 0x1f, 0xcf, 0x19,
+        0xff, 0xce, 0x46, 0x00, 0x00, 0x83, 0x1f, 0xd7, 0xde, 0xce, 0x1f, 0xd7, 0x19, 0xff, 0xce,
+        0x82, 0xbf, 0xbe, 0xfe, 0xce, 0x45, 0x00, 0x00, 0x84, 0xff, 0xce, 0x1f, 0xd7, 0xff, 0xce,
+        0x1f, 0xd7, 0x1b, 0xff, 0xce, 0x45, 0x00, 0x00, 0x03, 0x1f, 0xd7, 0x1b, 0xff, 0xce, 0x45,
+        0x00, 0x00, 0x83, 0xdf, 0xce, 0xff, 0xd6, 0x1f, 0xd7, 0x1c, 0xff, 0xce, 0x44, 0x00, 0x00,
+        0x83, 0xdf, 0xce, 0xbf, 0xc6, 0x3f, 0xd7, 0x1d, 0xff, 0xce, 0x44, 0x00, 0x00, 0x82, 0x5f,
+        0xd7, 0x1f, 0xcf, 0x1c, 0xff, 0xce, 0x02, 0xdf, 0xce, 0x43, 0x00, 0x00, 0x81, 0x5f, 0xe7,
+        0x1e, 0xff, 0xce, 0x02, 0xdf, 0xce, 0x43, 0x00, 0x00, 0x81, 0xff, 0xff, 0x1e, 0xff, 0xce,
+        0x82, 0x3d, 0xd6, 0xdf, 0xce, 0x42, 0x00, 0x00, 0x81, 0x7f, 0xef, 0x1f, 0xff, 0xce, 0x82,
+        0xbf, 0xbe, 0x7f, 0xef, 0x42, 0x00, 0x00, 0x81, 0x5f, 0xdf, 0x20, 0xff, 0xce, 0x81, 0x7f,
+        0xef, 0x42, 0x00, 0x00, 0x82, 0xdf, 0xce, 0xbe, 0xc6, 0x1e, 0xff, 0xce, 0x82, 0xbf, 0xbe,
+        0x9f, 0xef, 0x41, 0x00, 0x00, 0x81, 0x1f, 0xd7, 0x20, 0xff, 0xce, 0x82, 0x9d, 0x01, 0x3f,
+        0xdf, 0x41, 0x00, 0x00, 0x82, 0xff, 0xce, 0xff, 0xd6, 0x21, 0xff, 0xce, 0x40, 0x00, 0x00,
+        0x81, 0x7f, 0xef, 0x21, 0xff, 0xce, 0x82, 0xde, 0xc6, 0xdf, 0xc6, 0x40, 0x00, 0x00, 0x81,
+        0xdf, 0xc6, 0x23, 0xff, 0xce, 0x40, 0x00, 0x00, 0x82, 0xff, 0xce, 0xde, 0xce, 0x22, 0xff,
+        0xce, 0x40, 0x00, 0x00, 0x02, 0x1f, 0xcf, 0x22, 0xff, 0xce, 0x3f, 0x00, 0x00, 0x24, 0xff,
+        0xce, 0x82, 0xdf, 0xc6, 0xbe, 0xc6, 0x3e, 0x00, 0x00, 0x81, 0x37, 0x6d, 0x23, 0xff, 0xce,
+        0x82, 0xbe, 0xce, 0x9e, 0xc6, 0x3e, 0x00, 0x00, 0x82, 0xdf, 0xc6, 0xbe, 0xc6, 0x24, 0xff,
+        0xce, 0x3e, 0x00, 0x00, 0x26, 0xff, 0xce, 0x3e, 0x00, 0x00, 0x25, 0xff, 0xce, 0x82, 0xdf,
+        0xce, 0xff, 0xce, 0x3d, 0x00, 0x00, 0x28, 0xff, 0xce, 0x3c, 0x00, 0x00, 0x27, 0xff, 0xce,
+        0x81, 0xbf, 0xce, 0x3c, 0x00, 0x00, 0x81, 0xdf, 0xc6, 0x25, 0xff, 0xce, 0x82, 0xff, 0xc6,
+        0x1f, 0xd7, 0x3c, 0x00, 0x00, 0x81, 0xdf, 0xc6, 0x28, 0xff, 0xce, 0x3b, 0x00, 0x00, 0x81,
+        0xdf, 0xc6, 0x27, 0xff, 0xce, 0x81, 0xbf, 0xce, 0x3b, 0x00, 0x00, 0x81, 0xdf, 0xce, 0x29,
+        0xff, 0xce, 0x3a, 0x00, 0x00, 0x81, 0xdf, 0xce, 0x28, 0xff, 0xce, 0x82, 0x1f, 0xd7, 0x7f,
+        0xef, 0x39, 0x00, 0x00, 0x81, 0xdf, 0xc6, 0x2a, 0xff, 0xce, 0x39, 0x00, 0x00, 0x81, 0xdf,
+        0xc6, 0x28, 0xff, 0xce, 0x83, 0xde, 0x95, 0x1f, 0xd7, 0xff, 0xce, 0x38, 0x00, 0x00, 0x81,
+        0xdf, 0xc6, 0x29, 0xff, 0xce, 0x83, 0x1f, 0xcf, 0x5f, 0xdf, 0x7f, 0xef, 0x37, 0x00, 0x00,
+        0x2a, 0xff, 0xce, 0x02, 0x1f, 0xd7, 0x81, 0xff, 0xce, 0x37, 0x00, 0x00, 0x82, 0xff, 0xce,
+        0xdf, 0xce, 0x29, 0xff, 0xce, 0x83, 0xbf, 0xff, 0x1f, 0xd7, 0xff, 0xce, 0x36, 0x00, 0x00,
+        0x03, 0xdf, 0xce, 0x2a, 0xff, 0xce, 0x82, 0x1f, 0xdf, 0x7f, 0xef, 0x35, 0x00, 0x00, 0x83,
+        0x9e, 0xbe, 0x7e, 0xbe, 0xdf, 0xc6, 0x29, 0xff, 0xce, 0x83, 0x1f, 0xd7, 0xff, 0xce, 0xbf,
+        0xbe, 0x35, 0x00, 0x00, 0x82, 0xdf, 0xce, 0xbf, 0xce, 0x2b, 0xff, 0xce, 0x81, 0x1f, 0xd7,
+        0x02, 0xff, 0xce, 0x34, 0x00, 0x00, 0x82, 0xdf, 0xf7, 0xdf, 0xce, 0x2e, 0xff, 0xce, 0x81,
+        0x1f, 0xd7, 0x33, 0x00, 0x00, 0x02, 0xff, 0xce, 0x81, 0xdf, 0xce, 0x28, 0xff, 0xce, 0x03,
+        0xdf, 0xce, 0x03, 0xff, 0xce, 0x82, 0xbf, 0xc6, 0x7f, 0xef, 0x32, 0x00, 0x00, 0x83, 0xdf,
+        0xc6, 0xbf, 0xc6, 0xdf, 0xce, 0x26, 0xff, 0xce, 0x04, 0xdf, 0xce, 0x02, 0xff, 0xce, 0x84,
+        0x1f, 0xd7, 0xff, 0xce, 0x1f, 0xdf, 0xff, 0xce, 0x31, 0x00, 0x00, 0x83, 0x9e, 0xc6, 0x1d,
+        0xb6, 0xdf, 0xc6, 0x24, 0xff, 0xce, 0x08, 0xdf, 0xce, 0x02, 0xff, 0xce, 0x81, 0x1f, 0xcf,
+        0x02, 0xff, 0xce, 0x81, 0x7f, 0xef, 0x2f, 0x00, 0x00, 0x82, 0x3e, 0xae, 0xdf, 0xce, 0x24,
+        0xff, 0xce, 0x0a, 0xdf, 0xce, 0x02, 0xff, 0xce, 0x84, 0x5c, 0xff, 0xff, 0xce, 0x1f, 0xd7,
+        0xdf, 0xce, 0x2e, 0x00, 0x00, 0x81, 0x7f, 0xef, 0x23, 0xff, 0xce, 0x0d, 0xdf, 0xce, 0x03,
+        0xff, 0xce, 0x81, 0x1f, 0xcf, 0x02, 0xff, 0xce, 0x81, 0x7f, 0xef, 0x2d, 0x00, 0x00, 0x82,
+        0xdf, 0xce, 0x7f, 0xbf, 0x1f, 0xff, 0xce, 0x10, 0xdf, 0xce, 0x03, 0xff, 0xce, 0x81, 0xdf,
+        0xc6, 0x03, 0xff, 0xce, 0x2c, 0x00, 0x00, 0x81, 0xdf, 0xce, 0x03, 0xdf, 0xc6, 0x1b, 0xff,
+        0xce, 0x14, 0xdf, 0xce, 0x05, 0xff, 0xce, 0x02, 0x1f, 0xd7, 0x2b, 0x00, 0x00, 0x83, 0x9e,
+        0xbe, 0x3d, 0xb6, 0xdf, 0xc6, 0x18, 0xff, 0xce, 0x18, 0xdf, 0xce, 0x03, 0xff, 0xce, 0x81,
+        0x1f, 0xd7, 0x02, 0xff, 0xce, 0x81, 0x1f, 0xd7, 0x2a, 0x00, 0x00, 0x84, 0xdd, 0x9d, 0xdf,
+        0xc6, 0xff, 0xce, 0xdf, 0xc6, 0x14, 0xff, 0xce, 0x1b, 0xdf, 0xce, 0x02, 0xdf, 0xc6, 0x04,
+        0xff, 0xce, 0x84, 0x1f, 0xcf, 0x1f, 0xd7, 0xbf, 0xc6, 0xdf, 0xc6, 0x27, 0x00, 0x00, 0x85,
+        0x7f, 0xef, 0x7e, 0xbe, 0x5e, 0xb6, 0xbf, 0xc6, 0xdf, 0xc6, 0x0e, 0xff, 0xce, 0x1e, 0xdf,
+        0xce, 0x06, 0xdf, 0xc6, 0x03, 0xff, 0xce, 0x87, 0x1f, 0xd7, 0xdf, 0xce, 0xff, 0xce, 0x1f,
+        0xd7, 0xdf, 0xce, 0xbf, 0xc6, 0x7f, 0xef, 0x25, 0x00, 0x00, 0x02, 0x9e, 0xbe, 0x81, 0xdf,
+        0xc6, 0x2b, 0xdf, 0xce, 0x09, 0xdf, 0xc6, 0x04, 0xff, 0xce, 0x83, 0x1f, 0xd7, 0xff, 0xd6,
+        0xdf, 0xce, 0x03, 0xff, 0xce, 0x83, 0xdf, 0xce, 0x0c, 0x00, 0x7f, 0xef, 0x1f, 0x00, 0x00,
+        0x85, 0x5f, 0xdf, 0x9e, 0xc6, 0xfc, 0xad, 0xbf, 0xc6, 0xdf, 0xc6, 0x29, 0xdf, 0xce, 0x0c,
+        0xdf, 0xc6, 0x81, 0xdf, 0xce, 0x05, 0xff, 0xce, 0x84, 0x1f, 0xcf, 0xff, 0xce, 0xdf, 0x03,
+        0xdf, 0xc6, 0x04, 0xff, 0xce, 0x84, 0x1f, 0xd7, 0xff, 0xce, 0x9e, 0xc6, 0xdf, 0xce, 0x19,
+        0x00, 0x00, 0x81, 0x7e, 0xbe, 0x02, 0x9e, 0xbe, 0x81, 0xbf, 0xc6, 0x28, 0xdf, 0xce, 0x11,
+        0xdf, 0xc6, 0x81, 0xdf, 0xce, 0x08, 0xff, 0xce, 0x85, 0x1f, 0xcf, 0x1f, 0xd7, 0xff, 0xce,
+        0x9e, 0xc6, 0xdf, 0xce, 0x19, 0x00, 0x00, 0x85, 0xbf, 0xc6, 0x9e, 0xc6, 0xdf, 0xc6, 0xbf,
+        0xc6, 0xdf, 0xc6, 0x25, 0xdf, 0xce, 0x19, 0xdf, 0xc6, 0x02, 0xdf, 0xce, 0x02, 0xff, 0xce,
+        0x84, 0xdf, 0xce, 0xbf, 0xc6, 0x3e, 0xae, 0xdf, 0xce, 0x1a, 0x00, 0x00, 0x82, 0x9e, 0xc6,
+        0xbe, 0xc6, 0x02, 0x9e, 0xc6, 0x81, 0xdf, 0xc6, 0x22, 0xdf, 0xce, 0x1f, 0xdf, 0xc6, 0x84,
+        0xbf, 0xc6, 0x5e, 0xb6, 0x7e, 0xbe, 0xdf, 0xce, 0x1b, 0x00, 0x00, 0x81, 0xbf, 0xc6, 0x02,
+        0x9e, 0xc6, 0x82, 0xbf, 0xc6, 0xdf, 0xc6, 0x20, 0xdf, 0xce, 0x1f, 0xdf, 0xc6, 0x81, 0xbf,
+        0xc6, 0x02, 0x7e, 0xbe, 0x81, 0x5e, 0xb6, 0x1c, 0x00, 0x00, 0x81, 0xbf, 0xc6, 0x02, 0x7e,
+        0xbe, 0x82, 0x9e, 0xbe, 0xbf, 0xc6, 0x1e, 0xdf, 0xce, 0x20, 0xdf, 0xc6, 0x81, 0xbf, 0xc6,
+        0x02, 0x9e, 0xbe, 0x82, 0x7e, 0xb6, 0xdf, 0xc6, 0x1d, 0x00, 0x00, 0x85, 0xdf, 0xce, 0x7e,
+        0x8d, 0xbf, 0xc6, 0x9e, 0xbe, 0xbf, 0xc6, 0x1b, 0xdf, 0xce, 0x22, 0xdf, 0xc6, 0x84, 0xbf,
+        0xc6, 0x9f, 0xbe, 0xde, 0xce, 0x7e, 0xbe, 0x1f, 0x00, 0x00, 0x82, 0x7f, 0xe7, 0xbe, 0xc6,
+        0x02, 0x9e, 0xbe, 0x81, 0xdf, 0xc6, 0x17, 0xdf, 0xce, 0x23, 0xdf, 0xc6, 0x02, 0xbf, 0xc6,
+        0x83, 0x1e, 0xa6, 0xbf, 0xc6, 0xff, 0xce, 0x21, 0x00, 0x00, 0x85, 0xff, 0xce, 0xbf, 0xc6,
+        0x3e, 0xae, 0xbe, 0xc6, 0xbf, 0xc6, 0x14, 0xdf, 0xce, 0x24, 0xdf, 0xc6, 0x85, 0xbf, 0xc6,
+        0x9e, 0xc6, 0xfc, 0xad, 0x9e, 0xc6, 0xdf, 0xc6, 0x23, 0x00, 0x00, 0x86, 0xdf, 0xc6, 0xbf,
+        0xc6, 0x7f, 0xb6, 0x9e, 0xbe, 0xbf, 0xc6, 0xdf, 0xc6, 0x0e, 0xdf, 0xce, 0x27, 0xdf, 0xc6,
+        0x83, 0xbf, 0xc6, 0xbe, 0xc6, 0x1d, 0xb6, 0x02, 0x9e, 0xbe, 0x25, 0x00, 0x00, 0x86, 0xdf,
+        0xc6, 0xbf, 0xc6, 0x7e, 0xbe, 0x9e, 0xbe, 0xbf, 0xc6, 0xdf, 0xc6, 0x0a, 0xdf, 0xce, 0x29,
+        0xdf, 0xc6, 0x83, 0xbf, 0xc6, 0x9e, 0xbe, 0x3e, 0xae, 0x02, 0x9e, 0xbe, 0x27, 0x00, 0x00,
+        0x86, 0xff, 0xce, 0xbe, 0xc6, 0x9f, 0xbe, 0x9e, 0xbe, 0xbf, 0xc6, 0xdf, 0xc6, 0x03, 0xdf,
+        0xce, 0x2e, 0xdf, 0xc6, 0x81, 0xbf, 0xc6, 0x02, 0x9e, 0xbe, 0x82, 0xbe, 0xc6, 0xdf, 0xc6,
+        0x29, 0x00, 0x00, 0x83, 0x7f, 0xe7, 0x1d, 0x85, 0x7e, 0xbe, 0x02, 0x9e, 0xbe, 0x81, 0xbf,
+        0xc6, 0x2f, 0xdf, 0xc6, 0x85, 0x9e, 0xc6, 0x7e, 0xbe, 0x9e, 0xbe, 0x5d, 0xc6, 0xbf, 0xc6,
+        0x2b, 0x00, 0x00, 0x82, 0xdf, 0xce, 0x7e, 0xbe, 0x03, 0x9e, 0xc6, 0x81, 0xbf, 0xc6, 0x2c,
+        0xdf, 0xc6, 0x86, 0xbf, 0xc6, 0x9e, 0xc6, 0x5e, 0xbe, 0x7e, 0xbe, 0x5e, 0xb6, 0x7e, 0xbe,
+        0x2d, 0x00, 0x00, 0x81, 0xbf, 0xc6, 0x03, 0xbe, 0xc6, 0x83, 0x7e, 0xbe, 0x9e, 0xbe, 0xbf,
+        0xc6, 0x28, 0xdf, 0xc6, 0x83, 0xbf, 0xc6, 0x9e, 0xbe, 0x7e, 0xbe, 0x02, 0x9e, 0xbe, 0x82,
+        0x7e, 0xbe, 0xdf, 0xce, 0x30, 0x00, 0x00, 0x87, 0x9e, 0xc6, 0x9f, 0xc6, 0x7e, 0xbe, 0x1c,
+        0xb6, 0x9e, 0xbe, 0x9e, 0xc6, 0xbf, 0xc6, 0x24, 0xdf, 0xc6, 0x81, 0xbf, 0xc6, 0x02, 0x9e,
+        0xbe, 0x84, 0x5e, 0xbe, 0x7e, 0xbe, 0xdf, 0xce, 0x9e, 0xc6, 0x33, 0x00, 0x00, 0x83, 0xbf,
+        0xc6, 0x7e, 0xbe, 0x9e, 0xbe, 0x02, 0x7e, 0xbe, 0x83, 0x9e, 0xc6, 0xbe, 0xc6, 0xbf, 0xc6,
+        0x20, 0xdf, 0xc6, 0x84, 0xbf, 0xc6, 0x9e, 0xbe, 0x7e, 0xbe, 0x5e, 0xbe, 0x02, 0x9e, 0xbe,
+        0x82, 0x1d, 0xae, 0xdf, 0xce, 0x36, 0x00, 0x00, 0x82, 0x5f, 0xdf, 0x00, 0x00, 0x02, 0x9e,
+        0xbe, 0x84, 0x7e, 0xbe, 0x9e, 0xbe, 0x9e, 0xc6, 0xbf, 0xc6, 0x1b, 0xdf, 0xc6, 0x02, 0xbf,
+        0xc6, 0x87, 0x9e, 0xbe, 0x9e, 0xc6, 0x5e, 0xbe, 0x9e, 0xbe, 0x7e, 0xbe, 0x9e, 0xc6, 0xbe,
+        0xc6, 0x3b, 0x00, 0x00, 0x81, 0x5e, 0xb6, 0x02, 0x9e, 0xbe, 0x81, 0xf9, 0x1a, 0x02, 0x9e,
+        0xbe, 0x81, 0xbe, 0xc6, 0x02, 0xbf, 0xc6, 0x14, 0xdf, 0xc6, 0x02, 0xbf, 0xc6, 0x02, 0x9e,
+        0xbe, 0x02, 0x7e, 0xbe, 0x84, 0x9e, 0xc6, 0x7e, 0xbe, 0xdf, 0xd6, 0xbf, 0xc6, 0x3f, 0x00,
+        0x00, 0x82, 0xdf, 0xce, 0xff, 0xce, 0x02, 0x9e, 0xbe, 0x82, 0x7e, 0xc6, 0x7e, 0xbe, 0x02,
+        0x9e, 0xbe, 0x81, 0x9e, 0xc6, 0x04, 0xbf, 0xc6, 0x08, 0xdf, 0xc6, 0x04, 0xbf, 0xc6, 0x81,
+        0x9e, 0xc6, 0x02, 0x9e, 0xbe, 0x86, 0x7e, 0xbe, 0x9e, 0xc6, 0x9e, 0xbe, 0x7e, 0xbe, 0x9e,
+        0xc6, 0x7e, 0xbe, 0x44, 0x00, 0x00, 0x83, 0x7f, 0xef, 0x3e, 0xae, 0xbe, 0xc6, 0x02, 0x7e,
+        0xbe, 0x82, 0xbf, 0xc6, 0xde, 0xce, 0x03, 0x7e, 0xbe, 0x81, 0x9e, 0xc6, 0x08, 0x9e, 0xbe,
+        0x82, 0x9e, 0xc6, 0x9e, 0xbe, 0x02, 0x7e, 0xbe, 0x87, 0xbe, 0xc6, 0xdf, 0xc6, 0x9e, 0xbe,
+        0x7e, 0xbe, 0xbe, 0xc6, 0x5c, 0xa6, 0xbf, 0xc6, 0x4a, 0x00, 0x00, 0x84, 0xff, 0xce, 0xdf,
+        0xf7, 0xdf, 0xce, 0x9e, 0xbe, 0x02, 0x7e, 0xbe, 0x82, 0x9e, 0xbe, 0xdf, 0xc6, 0x02, 0x1f,
+        0xcf, 0x82, 0x3f, 0xd7, 0x5f, 0xd7, 0x02, 0x1f, 0xcf, 0x82, 0xdf, 0xc6, 0x9e, 0xbe, 0x03,
+        0x7e, 0xbe, 0x83, 0xde, 0xc6, 0x37, 0x6d, 0xff, 0xce, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+        0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+        0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x85, 0x00, 0x02, 0x15, 0x2e, 0x41,
+        0x55, 0x70, 0x7b, 0x1f, 0x00, 0x2b, 0x00, 0x00, 0x87, 0x00, 0x01, 0x1a, 0x3f, 0x7d, 0xa5,
+        0xc4, 0xea, 0xf7, 0xf9, 0xff, 0xa7, 0x0b, 0x00, 0x2a, 0x00, 0x00, 0x83, 0x00, 0x1b, 0x58,
+        0x98, 0xce, 0xf3, 0x03, 0xff, 0xff, 0x81, 0xe5, 0x38, 0x2a, 0x00, 0x00, 0x83, 0x08, 0x34,
+        0x83, 0xd0, 0xf8, 0xff, 0x04, 0xff, 0xff, 0x81, 0x90, 0x03, 0x29, 0x00, 0x00, 0x82, 0x07,
+        0x3f, 0xa5, 0xea, 0x05, 0xff, 0xff, 0x82, 0xff, 0xe3, 0x32, 0x00, 0x28, 0x00, 0x00, 0x82,
+        0x03, 0x3a, 0x9f, 0xed, 0x06, 0xff, 0xff, 0x82, 0xff, 0x91, 0x03, 0x00, 0x27, 0x00, 0x00,
+        0x82, 0x00, 0x1b, 0x86, 0xe7, 0x07, 0xff, 0xff, 0x81, 0xec, 0x3c, 0x27, 0x00, 0x00, 0x82,
+        0x00, 0x05, 0x4d, 0xc3, 0x08, 0xff, 0xff, 0x81, 0xb3, 0x09, 0x27, 0x00, 0x00, 0x82, 0x11,
+        0x88, 0xef, 0xff, 0x07, 0xff, 0xff, 0x82, 0xff, 0xfc, 0x5d, 0x00, 0x26, 0x00, 0x00, 0x82,
+        0x00, 0x2c, 0xad, 0xfd, 0x08, 0xff, 0xff, 0x82, 0xff, 0xd9, 0x23, 0x00, 0x26, 0x00, 0x00,
+        0x81, 0x40, 0xd1, 0x09, 0xff, 0xff, 0x82, 0xff, 0xa1, 0x03, 0x00, 0x25, 0x00, 0x00, 0x82,
+        0x00, 0x4c, 0xdf, 0xff, 0x09, 0xff, 0xff, 0x81, 0xfd, 0x59, 0x26, 0x00, 0x00, 0x81, 0x53,
+        0xe4, 0x0a, 0xff, 0xff, 0x81, 0xe4, 0x2e, 0x25, 0x00, 0x00, 0x82, 0x00, 0x4e, 0xe6, 0xff,
+        0x0a, 0xff, 0xff, 0x81, 0xba, 0x0a, 0x25, 0x00, 0x00, 0x81, 0x3f, 0xdd, 0x0b, 0xff, 0xff,
+        0x81, 0x90, 0x00, 0x24, 0x00, 0x00, 0x82, 0x00, 0x30, 0xd1, 0xff, 0x0a, 0xff, 0xff, 0x82,
+        0xff, 0xfc, 0x5d, 0x00, 0x24, 0x00, 0x00, 0x81, 0x16, 0xb8, 0x0b, 0xff, 0xff, 0x82, 0xff,
+        0xf7, 0x3e, 0x00, 0x23, 0x00, 0x00, 0x82, 0x00, 0x05, 0x85, 0xfe, 0x0b, 0xff, 0xff, 0x82,
+        0xff, 0xde, 0x27, 0x00, 0x23, 0x00, 0x00, 0x82, 0x00, 0x54, 0xef, 0xff, 0x0b, 0xff, 0xff,
+        0x82, 0xff, 0xc5, 0x15, 0x00, 0x23, 0x00, 0x00, 0x81, 0x23, 0xcf, 0x0c, 0xff, 0xff, 0x82,
+        0xff, 0xb6, 0x0a, 0x00, 0x22, 0x00, 0x00, 0x82, 0x00, 0x03, 0x8b, 0xff, 0x0c, 0xff, 0xff,
+        0x82, 0xff, 0xad, 0x03, 0x00, 0x22, 0x00, 0x00, 0x82, 0x00, 0x3c, 0xe8, 0xff, 0x0c, 0xff,
+        0xff, 0x81, 0xff, 0xa9, 0x23, 0x00, 0x00, 0x81, 0x0b, 0xac, 0x0d, 0xff, 0xff, 0x81, 0xff,
+        0xa7, 0x23, 0x00, 0x00, 0x81, 0x47, 0xf1, 0x0d, 0xff, 0xff, 0x81, 0xff, 0xa7, 0x22, 0x00,
+        0x00, 0x82, 0x00, 0x08, 0xa5, 0xff, 0x0d, 0xff, 0xff, 0x81, 0xff, 0xa7, 0x22, 0x00, 0x00,
+        0x82, 0x00, 0x3f, 0xed, 0xff, 0x0d, 0xff, 0xff, 0x81, 0xff, 0xa9, 0x22, 0x00, 0x00, 0x81,
+        0x02, 0x91, 0x0e, 0xff, 0xff, 0x82, 0xff, 0xad, 0x03, 0x00, 0x21, 0x00, 0x00, 0x81, 0x1d,
+        0xd5, 0x0e, 0xff, 0xff, 0x82, 0xff, 0xb9, 0x0c, 0x00, 0x21, 0x00, 0x00, 0x81, 0x58, 0xf8,
+        0x0e, 0xff, 0xff, 0x82, 0xff, 0xd4, 0x20, 0x00, 0x20, 0x00, 0x00, 0x82, 0x00, 0x04, 0xa0,
+        0xff, 0x0e, 0xff, 0xff, 0x82, 0xff, 0xf2, 0x37, 0x00, 0x20, 0x00, 0x00, 0x82, 0x00, 0x1f,
+        0xd9, 0xff, 0x0e, 0xff, 0xff, 0x82, 0xff, 0xfa, 0x47, 0x00, 0x20, 0x00, 0x00, 0x82, 0x00,
+        0x40, 0xf4, 0xff, 0x0e, 0xff, 0xff, 0x82, 0xff, 0xfd, 0x66, 0x00, 0x20, 0x00, 0x00, 0x82,
+        0x00, 0x7c, 0xfe, 0xff, 0x0f, 0xff, 0xff, 0x81, 0xa1, 0x01, 0x20, 0x00, 0x00, 0x81, 0x04,
+        0xa8, 0x10, 0xff, 0xff, 0x81, 0xc9, 0x15, 0x20, 0x00, 0x00, 0x81, 0x16, 0xc6, 0x10, 0xff,
+        0xff, 0x81, 0xf0, 0x3b, 0x20, 0x00, 0x00, 0x81, 0x2b, 0xe8, 0x10, 0xff, 0xff, 0x81, 0xfe,
+        0x69, 0x20, 0x00, 0x00, 0x81, 0x3d, 0xf6, 0x10, 0xff, 0xff, 0x82, 0xff, 0xb2, 0x08, 0x00,
+        0x1f, 0x00, 0x00, 0x81, 0x56, 0xf9, 0x10, 0xff, 0xff, 0x82, 0xff, 0xe7, 0x33, 0x00, 0x1f,
+        0x00, 0x00, 0x81, 0x70, 0xfd, 0x11, 0xff, 0xff, 0x81, 0x78, 0x00, 0x1f, 0x00, 0x00, 0x81,
+        0x88, 0xff, 0x11, 0xff, 0xff, 0x81, 0xc8, 0x14, 0x1f, 0x00, 0x00, 0x81, 0x99, 0xff, 0x11,
+        0xff, 0xff, 0x81, 0xf8, 0x5b, 0x1f, 0x00, 0x00, 0x81, 0xa3, 0xff, 0x11, 0xff, 0xff, 0x82,
+        0xff, 0xbd, 0x10, 0x00, 0x1e, 0x00, 0x00, 0x81, 0xa3, 0xff, 0x11, 0xff, 0xff, 0x82, 0xff,
+        0xf5, 0x55, 0x00, 0x1e, 0x00, 0x00, 0x81, 0x99, 0xff, 0x12, 0xff, 0xff, 0x81, 0xb9, 0x12,
+        0x1e, 0x00, 0x00, 0x81, 0x88, 0xff, 0x12, 0xff, 0xff, 0x81, 0xfb, 0x6f, 0x1e, 0x00, 0x00,
+        0x81, 0x6f, 0xfd, 0x12, 0xff, 0xff, 0x82, 0xff, 0xdc, 0x2e, 0x00, 0x1d, 0x00, 0x00, 0x81,
+        0x52, 0xf9, 0x13, 0xff, 0xff, 0x81, 0xa0, 0x0a, 0x1d, 0x00, 0x00, 0x81, 0x39, 0xf6, 0x13,
+        0xff, 0xff, 0x82, 0xf7, 0x6b, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x81, 0x2b, 0xe8, 0x13, 0xff,
+        0xff, 0x82, 0xff, 0xe4, 0x43, 0x00, 0x1c, 0x00, 0x00, 0x81, 0x14, 0xc2, 0x14, 0xff, 0xff,
+        0x81, 0xcb, 0x24, 0x1c, 0x00, 0x00, 0x81, 0x03, 0xa6, 0x14, 0xff, 0xff, 0x82, 0xff, 0xb2,
+        0x1d, 0x00, 0x1b, 0x00, 0x00, 0x82, 0x00, 0x76, 0xfd, 0xff, 0x14, 0xff, 0xff, 0x81, 0xa6,
+        0x16, 0x1b, 0x00, 0x00, 0x82, 0x00, 0x3d, 0xf3, 0xff, 0x14, 0xff, 0xff, 0x82, 0xfd, 0x9a,
+        0x12, 0x00, 0x1a, 0x00, 0x00, 0x82, 0x00, 0x1c, 0xd2, 0xff, 0x14, 0xff, 0xff, 0x82, 0xff,
+        0xfc, 0xa2, 0x1c, 0x1a, 0x00, 0x00, 0x82, 0x00, 0x02, 0x9c, 0xff, 0x15, 0xff, 0xff, 0x82,
+        0xff, 0xb5, 0x28, 0x00, 0x1a, 0x00, 0x00, 0x81, 0x51, 0xf6, 0x16, 0xff, 0xff, 0x81, 0xc9,
+        0x3d, 0x1a, 0x00, 0x00, 0x81, 0x19, 0xce, 0x16, 0xff, 0xff, 0x82, 0xff, 0xe1, 0x6d, 0x0d,
+        0x19, 0x00, 0x00, 0x81, 0x00, 0x88, 0x17, 0xff, 0xff, 0x82, 0xf9, 0xa4, 0x2a, 0x00, 0x18,
+        0x00, 0x00, 0x82, 0x00, 0x3a, 0xea, 0xff, 0x17, 0xff, 0xff, 0x82, 0xd8, 0x6d, 0x13, 0x00,
+        0x17, 0x00, 0x00, 0x82, 0x00, 0x06, 0x9d, 0xff, 0x17, 0xff, 0xff, 0x83, 0xff, 0xfb, 0xbd,
+        0x4d, 0x08, 0x00, 0x17, 0x00, 0x00, 0x81, 0x3e, 0xed, 0x18, 0xff, 0xff, 0x83, 0xff, 0xf0,
+        0xae, 0x52, 0x11, 0x00, 0x16, 0x00, 0x00, 0x81, 0x08, 0xa5, 0x19, 0xff, 0xff, 0x83, 0xff,
+        0xf6, 0xc0, 0x66, 0x22, 0x02, 0x15, 0x00, 0x00, 0x82, 0x00, 0x37, 0xe3, 0xff, 0x19, 0xff,
+        0xff, 0x84, 0xff, 0xfd, 0xd8, 0xa1, 0x53, 0x1f, 0x03, 0x00, 0x13, 0x00, 0x00, 0x82, 0x00,
+        0x01, 0x7f, 0xfe, 0x1b, 0xff, 0xff, 0x84, 0xf9, 0xd4, 0xa8, 0x77, 0x3e, 0x21, 0x0b, 0x00,
+        0x12, 0x00, 0x00, 0x81, 0x1b, 0xc9, 0x1c, 0xff, 0xff, 0x87, 0xff, 0xfe, 0xf4, 0xd9, 0xb1,
+        0x9f, 0x86, 0x5b, 0x3f, 0x32, 0x2b, 0x2a, 0x19, 0x01, 0x0e, 0x00, 0x00, 0x82, 0x00, 0x4c,
+        0xec, 0xff, 0x1e, 0xff, 0xff, 0x84, 0xff, 0xf8, 0xf3, 0xf0, 0xf0, 0xe6, 0x5a, 0x00, 0x0e,
+        0x00, 0x00, 0x82, 0x00, 0x03, 0x81, 0xfd, 0x20, 0xff, 0xff, 0x82, 0xff, 0x9a, 0x0a, 0x00,
+        0x0f, 0x00, 0x00, 0x81, 0x11, 0xab, 0x20, 0xff, 0xff, 0x81, 0xbe, 0x1f, 0x10, 0x00, 0x00,
+        0x82, 0x00, 0x2a, 0xd0, 0xff, 0x1e, 0xff, 0xff, 0x82, 0xff, 0xda, 0x35, 0x00, 0x11, 0x00,
+        0x00, 0x81, 0x3a, 0xda, 0x1e, 0xff, 0xff, 0x81, 0xe4, 0x48, 0x12, 0x00, 0x00, 0x82, 0x00,
+        0x48, 0xe3, 0xff, 0x1c, 0xff, 0xff, 0x82, 0xff, 0xe9, 0x57, 0x00, 0x13, 0x00, 0x00, 0x81,
+        0x51, 0xe3, 0x1c, 0xff, 0xff, 0x82, 0xe9, 0x5e, 0x01, 0x00, 0x13, 0x00, 0x00, 0x82, 0x00,
+        0x48, 0xda, 0xff, 0x1a, 0xff, 0xff, 0x82, 0xff, 0xe4, 0x57, 0x01, 0x15, 0x00, 0x00, 0x81,
+        0x3a, 0xd0, 0x1a, 0xff, 0xff, 0x81, 0xd9, 0x48, 0x16, 0x00, 0x00, 0x82, 0x00, 0x2a, 0xab,
+        0xfd, 0x18, 0xff, 0xff, 0x82, 0xff, 0xbb, 0x34, 0x00, 0x17, 0x00, 0x00, 0x82, 0x11, 0x81,
+        0xec, 0xff, 0x16, 0xff, 0xff, 0x82, 0xff, 0xf3, 0x8f, 0x19, 0x18, 0x00, 0x00, 0x83, 0x00,
+        0x03, 0x4c, 0xc8, 0xfe, 0xff, 0x15, 0xff, 0xff, 0x82, 0xd3, 0x58, 0x07, 0x00, 0x19, 0x00,
+        0x00, 0x82, 0x00, 0x1b, 0x7f, 0xe3, 0x14, 0xff, 0xff, 0x82, 0xed, 0x91, 0x26, 0x00, 0x1b,
+        0x00, 0x00, 0x82, 0x01, 0x37, 0xa5, 0xed, 0x12, 0xff, 0xff, 0x82, 0xf3, 0xb0, 0x45, 0x05,
+        0x1d, 0x00, 0x00, 0x82, 0x08, 0x3e, 0x9d, 0xe9, 0x10, 0xff, 0xff, 0x82, 0xee, 0xb0, 0x4f,
+        0x0c, 0x1f, 0x00, 0x00, 0x83, 0x06, 0x39, 0x88, 0xce, 0xf5, 0xff, 0x0c, 0xff, 0xff, 0x83,
+        0xff, 0xfa, 0xdc, 0x96, 0x3f, 0x0b, 0x21, 0x00, 0x00, 0x84, 0x00, 0x19, 0x50, 0x9a, 0xd2,
+        0xf2, 0xfd, 0xff, 0x09, 0xff, 0xff, 0x83, 0xf5, 0xda, 0xa3, 0x61, 0x21, 0x03, 0x23, 0x00,
+        0x00, 0x86, 0x00, 0x02, 0x1c, 0x3b, 0x73, 0xa5, 0xc3, 0xe8, 0xf6, 0xf8, 0xfc, 0xff, 0x02,
+        0xff, 0xff, 0x86, 0xff, 0xfc, 0xf9, 0xf6, 0xee, 0xcd, 0xa8, 0x84, 0x47, 0x21, 0x05, 0x00,
+        0x26, 0x00, 0x00, 0x8a, 0x00, 0x03, 0x14, 0x2b, 0x39, 0x4f, 0x6c, 0x88, 0x99, 0x9e, 0x9e,
+        0x93, 0x85, 0x6c, 0x51, 0x3e, 0x30, 0x1a, 0x04, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+        0x7f, 0x00, 0x00, 0x27, 0x00, 0x00,
 
 };
 
 const lv_image_dsc_t image_clear_night = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.cf = LV_COLOR_FORMAT_RGB565A8,
-    .header.flags = 0,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
     .header.w = 100,
     .header.h = 100,
     .header.stride = 200,
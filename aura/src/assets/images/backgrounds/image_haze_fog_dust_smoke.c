@@ -25,2013 +25,459 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_HAZE_FOG_DUST_SMOKE
     uint8_t image_haze_fog_dust_smoke_map[] = {
 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x38, 0xc6, 0x18, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79,
-        0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59,
-        0xce, 0x38, 0xc6, 0x38, 0xc6, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce,
-        0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x18, 0xc6, 0x38, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79,
-        0xce, 0x59, 0xce, 0x79, 0xce, 0x59, 0xce, 0xdf, 0xff, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce,
-        0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0xb6, 0xb5, 0x59,
-        0xce, 0x79, 0xce, 0xf7, 0xbd, 0x38, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6,
-        0x14, 0xa5, 0x59, 0xce, 0x59, 0xce, 0xb6, 0xb5, 0x9a, 0xd6, 0x79, 0xce, 0x79, 0xce, 0x79,
-        0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0xff, 0xff, 0x38, 0xc6,
-        0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce,
-        0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59,
-        0xce, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6,
-        0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0xf7, 0xbd, 0x59, 0xce, 0x79, 0xce, 0x79,
-        0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79,
-        0xce, 0x79, 0xce, 0x79, 0xce, 0x18, 0xc6, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6,
-        0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38,
-        0xc6, 0x38, 0xc6, 0x59, 0xce, 0x59, 0xce, 0x9a, 0xd6, 0x38, 0xc6, 0x79, 0xce, 0x79, 0xce,
-        0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59,
-        0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6,
-        0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce,
-        0x59, 0xce, 0x3c, 0xe7, 0x59, 0xce, 0x79, 0xce, 0x79, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0xff, 0xff, 0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x59,
-        0xce, 0x79, 0xce, 0x38, 0xc6, 0x79, 0xce, 0xaa, 0x52, 0x79, 0xce, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce,
-        0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x38,
-        0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x59, 0xce, 0xfb, 0xde, 0x59, 0xce,
-        0x59, 0xce, 0xd7, 0xbd, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
-        0xc6, 0xff, 0xff, 0x59, 0xce, 0x59, 0xce, 0x3c, 0xe7, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x38, 0xc6, 0x59,
-        0xce, 0x38, 0xc6, 0x18, 0xc6, 0x79, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xce, 0x79,
-        0xce, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0xba, 0xd6, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce,
-        0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38,
-        0xc6, 0x59, 0xce, 0x79, 0xce, 0x79, 0xce, 0x38, 0xc6, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce,
-        0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x38,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6,
-        0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x8a, 0x52, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x59,
-        0xce, 0x59, 0xce, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x38,
-        0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x59,
-        0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6,
-        0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce,
-        0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6,
-        0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x9e, 0xf7,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0x38,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7,
-        0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0x96, 0xb5,
-        0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd,
-        0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7,
-        0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6,
-        0xb5, 0x96, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5,
-        0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x9e, 0xf7,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0x38,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0x59,
-        0xce, 0x38, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x96, 0xb5,
-        0xd7, 0xbd, 0xb6, 0xb5, 0x18, 0xc6, 0x96, 0xb5, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd,
-        0x96, 0xb5, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0x9a,
-        0xd6, 0xb6, 0xb5, 0xb6, 0xb5, 0x75, 0xad, 0xb6, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x18, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0x75, 0xad, 0xd7, 0xbd, 0xb6, 0xb5,
-        0x55, 0xad, 0x79, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xf7, 0xbd,
-        0xb6, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x96, 0xb5, 0xf7, 0xbd, 0xb6, 0xb5, 0xd7,
-        0xbd, 0xd7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x96, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0x96,
-        0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0x51, 0x8c, 0xb6, 0xb5, 0xb6,
-        0xb5, 0x96, 0xb5, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xd7, 0xbd, 0x79, 0xce, 0xb6, 0xb5, 0xd7, 0xbd, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd,
-        0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0x96, 0xb5,
-        0xd7, 0xbd, 0xb6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x59, 0xce, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0x18, 0xc6, 0x96, 0xb5, 0xb6, 0xb5, 0xb6,
-        0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x9e, 0xf7,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb5, 0xb6,
-        0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0x7d, 0xef, 0xd7, 0xbd, 0xb6, 0xb5,
-        0x18, 0xc6, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x55, 0xad, 0xb6,
-        0xb5, 0x96, 0xb5, 0x18, 0xc6, 0x55, 0xad, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5,
-        0x96, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0x55, 0xad, 0xf7, 0xbd, 0xb6, 0xb5, 0xd7,
-        0xbd, 0x55, 0xad, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x59, 0xce,
-        0x96, 0xb5, 0xb6, 0xb5, 0x9a, 0xd6, 0xb6, 0xb5, 0xb6, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0x96,
-        0xb5, 0x96, 0xb5, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xb6, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xf7, 0xbd, 0xb2,
-        0x94, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x38, 0xc6, 0xd7, 0xbd, 0xb6,
-        0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0x38, 0xc6,
-        0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xf7, 0xf3, 0x9c, 0xf7, 0xbd, 0xb6, 0xb5,
-        0x96, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0x18, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x59,
-        0xce, 0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6,
-        0x59, 0xce, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0x59, 0xce,
-        0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59,
-        0xce, 0x59, 0xce, 0x59, 0xce, 0x18, 0xc6, 0x38, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce,
-        0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59,
-        0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0xd7, 0xbd, 0x59, 0xce, 0x79, 0xce,
-        0x79, 0xce, 0x79, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0xb6, 0xb5, 0x59, 0xce, 0x59, 0xce, 0xd7,
-        0xbd, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce,
-        0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0x9a, 0xd6, 0x38, 0xc6, 0x59, 0xce, 0x79,
-        0xce, 0x79, 0xce, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0xba,
-        0xd6, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59,
-        0xce, 0x59, 0xce, 0x79, 0xce, 0x18, 0xc6, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x9a, 0xd6,
-        0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6,
-        0x59, 0xce, 0x59, 0xce, 0xdb, 0xde, 0x59, 0xce, 0x79, 0xce, 0x38, 0xc6, 0x79, 0xce, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0x59, 0xce,
-        0x9a, 0xd6, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0xf7,
-        0xbd, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x18,
-        0xc6, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x9a, 0xd6,
-        0x59, 0xce, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xba, 0xd6, 0x1c, 0xe7, 0x59, 0xce, 0x38, 0xc6, 0x79, 0xce, 0x59, 0xce, 0x59,
-        0xce, 0x9a, 0xd6, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0xf7, 0xbd, 0x59, 0xce, 0x79, 0xce, 0x59,
-        0xce, 0x38, 0xc6, 0x9a, 0xd6, 0x9a, 0xd6, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x59, 0xce,
-        0x18, 0xc6, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18,
-        0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0xba, 0xd6, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce,
-        0x38, 0xc6, 0x59, 0xce, 0xba, 0xd6, 0x79, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0x9a, 0xd6,
-        0xba, 0xd6, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x59, 0xce,
-        0x59, 0xce, 0x9a, 0xd6, 0x7d, 0xef, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0xbe,
-        0xf7, 0x9a, 0xd6, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x59,
-        0xce, 0x59, 0xce, 0xba, 0xd6, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x9e, 0xf7,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xce, 0x79,
-        0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce,
-        0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x59,
-        0xce, 0x38, 0xc6, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7,
-        0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x9e, 0xf7,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6,
-        0xb5, 0xb6, 0xb5, 0xf7, 0xbd, 0x75, 0xad, 0x71, 0x8c, 0xd7, 0xbd, 0xd7, 0xbd, 0x96, 0xb5,
-        0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd,
-        0x96, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0x00, 0x00, 0xf3, 0x9c, 0xf7, 0xbd, 0xb6, 0xb5, 0xb6,
-        0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd,
-        0xb6, 0xb5, 0x38, 0xc6, 0xb6, 0xb5, 0xb6, 0xb5, 0x38, 0xc6, 0x79, 0xce, 0xfb, 0xde, 0x59,
-        0xce, 0xf7, 0xbd, 0x96, 0xb5, 0xb6, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xf7, 0xbd,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6,
-        0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0x96, 0xb5, 0xf7, 0xbd, 0x59, 0xce, 0xdb, 0xde, 0x59, 0xce,
-        0x38, 0xc6, 0xb6, 0xb5, 0x96, 0xb5, 0xf7, 0xbd, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7,
-        0xbd, 0xb6, 0xb5, 0xf7, 0xbd, 0xb6, 0xb5, 0x51, 0x8c, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0xf7, 0xbd, 0xb6,
-        0xb5, 0x34, 0xa5, 0xb6, 0xb5, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd,
-        0xb6, 0xb5, 0x75, 0xad, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xce, 0x34, 0xa5, 0xb6, 0xb5,
-        0xd7, 0xbd, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x9e, 0xf7,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd,
-        0xd7, 0xbd, 0xb6, 0xb5, 0xf7, 0xbd, 0xb6, 0xb5, 0x55, 0xad, 0x18, 0xc6, 0x79, 0xce, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0x75, 0xad, 0xb6, 0xb5, 0xd7,
-        0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7,
-        0xbd, 0xb6, 0xb5, 0x55, 0xad, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x59, 0xce, 0xd7, 0xbd, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5,
-        0xb6, 0xb5, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6,
-        0xb5, 0xd7, 0xbd, 0x75, 0xad, 0xb6, 0xb5, 0xd7, 0xbd, 0x75, 0xad, 0xb6, 0xb5, 0x59, 0xce,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x96, 0xb5,
-        0x18, 0xc6, 0xb6, 0xb5, 0xd7, 0xbd, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xd7,
-        0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5,
-        0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0x59, 0xce, 0xb6, 0xb5, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0xb6, 0xb5, 0x55,
-        0xad, 0xf7, 0xbd, 0x96, 0xb5, 0x75, 0xad, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd,
-        0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xad, 0x75, 0xad, 0x96, 0xb5, 0x75, 0xad,
-        0x55, 0xad, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x18, 0xc6, 0x18, 0xc6, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x55, 0xad, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5,
-        0xb6, 0xb5, 0x96, 0xb5, 0x75, 0xad, 0x75, 0xad, 0x75, 0xad, 0x75, 0xad, 0x75, 0xad, 0x75,
-        0xad, 0xb6, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x55, 0xad, 0x18, 0xc6,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x59, 0xce, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6,
-        0xb5, 0x75, 0xad, 0x75, 0xad, 0x75, 0xad, 0x75, 0xad, 0x96, 0xb5, 0x75, 0xad, 0x9e, 0xf7,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb5, 0x96,
-        0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xf3, 0x9c, 0x59, 0xce, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x18, 0xc6, 0x38, 0xc6, 0xd7, 0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0x96, 0xb5,
-        0x96, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0x38, 0xc6, 0x18, 0xc6, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x9e, 0xf7, 0xf3, 0x9c, 0xf7, 0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0x96,
-        0xb5, 0x96, 0xb5, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x38, 0xc6, 0x18, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79,
-        0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59,
-        0xce, 0x38, 0xc6, 0x38, 0xc6, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce,
-        0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x18, 0xc6, 0x38, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79,
-        0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0xd7, 0xbd, 0xba, 0xd6, 0x9a, 0xd6,
-        0x79, 0xce, 0x79, 0xce, 0x9a, 0xd6, 0x9a, 0xd6, 0xdb, 0xde, 0x59, 0xce, 0x59, 0xce, 0x59,
-        0xce, 0x79, 0xce, 0x51, 0x8c, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6,
-        0xb2, 0x94, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0xfb, 0xde, 0x9a, 0xd6, 0x9a,
-        0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0xba, 0xd6, 0xb6, 0xb5, 0x59, 0xce, 0x59, 0xce,
-        0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce,
-        0x79, 0xce, 0x79, 0xce, 0x38, 0xc6, 0x79, 0xce, 0x9a, 0xd6, 0x59, 0xce, 0x59, 0xce, 0x59,
-        0xce, 0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce,
-        0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0x5d, 0xef, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79,
-        0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79,
-        0xce, 0xcf, 0x7b, 0xf7, 0xbd, 0x59, 0xce, 0x5d, 0xef, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce,
-        0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38,
-        0xc6, 0x59, 0xce, 0x59, 0xce, 0x9a, 0xd6, 0x59, 0xce, 0x79, 0xce, 0x59, 0xce, 0x79, 0xce,
-        0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59,
-        0xce, 0x59, 0xce, 0x79, 0xce, 0x79, 0xce, 0xb6, 0xb5, 0x38, 0xc6, 0x59, 0xce, 0x59, 0xce,
-        0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x59, 0xce,
-        0x79, 0xce, 0x59, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x59, 0xce, 0x38, 0xc6, 0x38,
-        0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x79,
-        0xce, 0x34, 0xa5, 0x79, 0xce, 0xff, 0xff, 0x79, 0xce, 0x79, 0xce, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0xd7, 0xbd, 0x79, 0xce, 0x59, 0xce, 0x38,
-        0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x9a, 0xd6, 0x59, 0xce, 0x79, 0xce,
-        0x79, 0xce, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x59, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x9a, 0xd6, 0x59, 0xce, 0x38, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x79, 0xce, 0xd3, 0x9c, 0x79, 0xce, 0x59,
-        0xce, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xd6, 0x1c,
-        0xe7, 0x59, 0xce, 0x38, 0xc6, 0x79, 0xce, 0x79, 0xce, 0x7d, 0xef, 0x79, 0xce, 0x59, 0xce,
-        0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38,
-        0xc6, 0x59, 0xce, 0x79, 0xce, 0x38, 0xc6, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x9a, 0xd6,
-        0x79, 0xce, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x38, 0xc6, 0x79, 0xce, 0x59, 0xce, 0x38,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6,
-        0x38, 0xc6, 0x79, 0xce, 0x9e, 0xf7, 0x59, 0xce, 0x79, 0xce, 0x38, 0xc6, 0x59, 0xce, 0xba,
-        0xd6, 0x79, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xde, 0x59, 0xce, 0x79, 0xce, 0x59, 0xce, 0x59,
-        0xce, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x59,
-        0xce, 0x79, 0xce, 0xff, 0xff, 0xff, 0xff, 0x79, 0xce, 0x59, 0xce, 0x79, 0xce, 0x59, 0xce,
-        0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce,
-        0x59, 0xce, 0xdb, 0xde, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6,
-        0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x38,
-        0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x9e, 0xf7,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7,
-        0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5,
-        0xb6, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0x55, 0xad, 0x75, 0xad,
-        0x96, 0xb5, 0xb6, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0x55, 0xad, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7,
-        0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0x55, 0xad, 0x55, 0xad, 0x75,
-        0xad, 0xb6, 0xb5, 0x96, 0xb5, 0x75, 0xad, 0x55, 0xad, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5,
-        0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x9e, 0xf7,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0x34, 0xa5, 0xb6, 0xb5, 0xd7,
-        0xbd, 0xb6, 0xb5, 0x38, 0xc6, 0x79, 0xce, 0xba, 0xd6, 0x59, 0xce, 0xf7, 0xbd, 0x96, 0xb5,
-        0xd7, 0xbd, 0x96, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd,
-        0x96, 0xb5, 0xf7, 0xbd, 0x59, 0xce, 0x9a, 0xd6, 0x79, 0xce, 0x38, 0xc6, 0xb6, 0xb5, 0xb6,
-        0xb5, 0xb6, 0xb5, 0xf3, 0x9c, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xd3, 0x9c, 0xb6, 0xb5,
-        0xb6, 0xb5, 0x71, 0x8c, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0xf7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0x96, 0xb5,
-        0xb6, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xb6,
-        0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x79, 0xce, 0x55, 0xad, 0xb6, 0xb5, 0xb6, 0xb5, 0x0c, 0x63, 0xb6,
-        0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0x38, 0xc6, 0xb6,
-        0xb5, 0xb6, 0xb5, 0x75, 0xad, 0x79, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6,
-        0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd,
-        0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0x96, 0xb5, 0xb6, 0xb5,
-        0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce,
-        0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0x14, 0xa5, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7,
-        0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0x9e, 0xf7,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb5, 0xb6,
-        0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0xf7, 0xbd, 0xd7, 0xbd,
-        0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0xff, 0xff, 0xb6, 0xb5, 0xb6,
-        0xb5, 0xb6, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5,
-        0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0x96, 0xb5, 0xd7,
-        0xbd, 0xb6, 0xb5, 0xba, 0xd6, 0xf7, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xf7, 0xf7, 0xbd, 0x18, 0xc6, 0xb6, 0xb5,
-        0xb6, 0xb5, 0xf7, 0xbd, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6,
-        0xb5, 0xb6, 0xb5, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6,
-        0xb5, 0xf7, 0xbd, 0x24, 0x21, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x59, 0xce, 0x18, 0xc6, 0x38, 0xc6, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xd7,
-        0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5,
-        0xb6, 0xb5, 0x59, 0xce, 0x38, 0xc6, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x9e, 0xf7, 0x10, 0x84, 0xd7, 0xbd, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd,
-        0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0xb6, 0xb5, 0x59,
-        0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce,
-        0x59, 0xce, 0x38, 0xc6, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xf7, 0xf7, 0xbd, 0x38, 0xc6,
-        0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59,
-        0xce, 0x59, 0xce, 0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce,
-        0x38, 0xc6, 0xff, 0xff, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x79,
-        0xce, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0xb6, 0xb5, 0x59, 0xce, 0x59, 0xce, 0xf3, 0x9c,
-        0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x14, 0xa5, 0x59, 0xce, 0x59,
-        0xce, 0xb6, 0xb5, 0x9a, 0xd6, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x79, 0xce,
-        0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0xff, 0xff, 0x18, 0xc6, 0x59, 0xce, 0x59, 0xce, 0x79,
-        0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59,
-        0xce, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x59,
-        0xce, 0x79, 0xce, 0xf7, 0xbd, 0x59, 0xce, 0x79, 0xce, 0x79, 0xce, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce,
-        0x18, 0xc6, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6,
-        0x59, 0xce, 0x9a, 0xd6, 0x38, 0xc6, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce,
-        0x38, 0xc6, 0x79, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x59, 0xce, 0x7d, 0xef, 0x59,
-        0xce, 0x79, 0xce, 0x79, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xce, 0x79, 0xce, 0x59,
-        0xce, 0xff, 0xff, 0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x38, 0xc6,
-        0x79, 0xce, 0x8e, 0x73, 0x79, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x79,
-        0xce, 0x38, 0xc6, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x1c, 0xe7, 0x59, 0xce, 0x59, 0xce, 0xf7, 0xbd, 0x59,
-        0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0xff, 0xff, 0x59, 0xce,
-        0x59, 0xce, 0x7d, 0xef, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18,
-        0xc6, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x18, 0xc6, 0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6,
-        0x59, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xce, 0x79, 0xce, 0x79, 0xce, 0x59, 0xce,
-        0x38, 0xc6, 0x18, 0xc6, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce,
-        0x79, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0x59, 0xce, 0x38,
-        0xc6, 0x38, 0xc6, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x59,
-        0xce, 0x14, 0xa5, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x9e, 0xf7,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xce, 0x79,
-        0xce, 0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce,
-        0x79, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x38, 0xc6, 0x59, 0xce, 0x59,
-        0xce, 0x59, 0xce, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd,
-        0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7,
-        0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0x9e, 0xf7,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6,
-        0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0x96, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5,
-        0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd,
-        0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6,
-        0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xd7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd,
-        0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0xb6,
-        0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6,
-        0xb5, 0xb6, 0xb5, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0x96, 0xb5, 0x96, 0xb5,
-        0xb6, 0xb5, 0xd7, 0xbd, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6,
-        0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7,
-        0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0x9a, 0xd6, 0x38, 0xc6, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x96, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0xf7,
-        0xbd, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd,
-        0xb6, 0xb5, 0x96, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0x96, 0xb5, 0x59, 0xce, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc6, 0x9a, 0xd6, 0xb6, 0xb5, 0xb6, 0xb5,
-        0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0x9e, 0xf7,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc6, 0x18,
-        0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd,
-        0xd7, 0xbd, 0xb6, 0xb5, 0x75, 0xad, 0xb6, 0xb5, 0xb6, 0xb5, 0x55, 0xad, 0x79, 0xce, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0xd7,
-        0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd,
-        0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7,
-        0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0xf7, 0xbd, 0xb6, 0xb5, 0xf7, 0xbd, 0xd7, 0xbd, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x59, 0xce, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5,
-        0xd7, 0xbd, 0xd7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7,
-        0xbd, 0xf7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xf7, 0xbd, 0xd7, 0xbd, 0xd7,
-        0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0x34, 0xa5, 0xb6, 0xb5, 0xb6, 0xb5, 0x96, 0xb5, 0x59, 0xce,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xbd, 0x79, 0xce,
-        0xb6, 0xb5, 0xd7, 0xbd, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7,
-        0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5,
-        0xd7, 0xbd, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0x96, 0xb5, 0xf7, 0xbd, 0xb6, 0xb5, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xf7, 0xb6, 0xb5, 0xd7,
-        0xbd, 0xb6, 0xb5, 0x18, 0xc6, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd,
-        0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0xd7, 0xbd, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0xb6, 0xb5,
-        0xb6, 0xb5, 0xb6, 0xb5, 0x1c, 0xe7, 0xb6, 0xb5, 0xb6, 0xb5, 0x18, 0xc6, 0x18, 0xc6, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x55, 0xad, 0xb6, 0xb5, 0x96, 0xb5, 0xd7, 0xbd,
-        0x75, 0xad, 0xb6, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0xb6,
-        0xb5, 0xb6, 0xb5, 0x55, 0xad, 0xd7, 0xbd, 0x96, 0xb5, 0xd7, 0xbd, 0x55, 0xad, 0x18, 0xc6,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xce, 0x59, 0xce, 0x96, 0xb5, 0x96, 0xb5, 0x38,
-        0xc6, 0xd7, 0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0x9e, 0xf7,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xb5, 0x96,
-        0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xb6, 0xb5, 0xf7, 0xbd, 0xf3, 0x9c, 0x59, 0xce, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x18, 0xc6, 0x59, 0xce, 0xd7, 0xbd, 0x96, 0xb5, 0x96, 0xb5, 0x96, 0xb5,
-        0x96, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0x59, 0xce, 0x18, 0xc6, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x9e, 0xf7, 0xf3, 0x9c, 0xf7, 0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0x96, 0xb5, 0x96,
-        0xb5, 0x96, 0xb5, 0x9e, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x0f, 0x26, 0x39, 0x44, 0x46, 0x40, 0x30, 0x1a, 0x06, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x19, 0x30, 0x3f, 0x46, 0x44,
-        0x39, 0x26, 0x0f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x2d, 0x5d, 0x9c, 0xc3, 0xdb, 0xee,
-        0xfa, 0xfc, 0xf6, 0xe5, 0xce, 0xb5, 0x80, 0x46, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x16, 0x45, 0x7c, 0xb3, 0xce, 0xe6, 0xf5, 0xfc, 0xfa, 0xee, 0xdb, 0xc3, 0x9e, 0x5e,
-        0x2e, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x10, 0x52, 0xa5, 0xe4, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xf7, 0xc8, 0x7e, 0x2c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x7c, 0xc7, 0xf6, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe4, 0xa5, 0x52, 0x10, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x59, 0xbc, 0xf6, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xe1, 0x8e, 0x31, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x2e, 0x8a, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xbc, 0x5a, 0x12, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1c, 0x5d, 0xbe, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x92, 0x38,
-        0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x35, 0x8d, 0xe1, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xf8, 0xbf, 0x5e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x26, 0x30, 0x5b, 0x93, 0xd1, 0xf9, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xb1, 0x79, 0x40, 0x29, 0x23,
-        0x23, 0x29, 0x40, 0x76, 0xad, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xf9, 0xd1, 0x94, 0x5b, 0x30, 0x26, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x6e, 0xec, 0xed, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xeb, 0xe9, 0xe9, 0xeb, 0xf1, 0xfe, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-        0xed, 0xee, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xec,
-        0xea, 0xe9, 0xea, 0xed, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xee, 0xea, 0xe9, 0xe9, 0xeb, 0xf3, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xc0, 0x86, 0x4d, 0x2c, 0x24, 0x23, 0x27, 0x34, 0x67,
-        0x9e, 0xdd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xdf, 0x9e,
-        0x69, 0x37, 0x27, 0x22, 0x23, 0x2b, 0x48, 0x84, 0xbc, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xaa,
-        0x4b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x26, 0x74, 0xd0, 0xfd,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xd1, 0x76, 0x27, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x10, 0x46, 0xa3, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xa5, 0x43, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x6f, 0xcb, 0xfb, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xce,
-        0x72, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x07, 0x3f, 0xa0, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd6,
-        0x91, 0x3d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x60, 0xb2, 0xed, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xb6, 0x66, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x37, 0x8c,
-        0xd3, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x77, 0xfa, 0xe9, 0xd4, 0xbd, 0x8d, 0x51, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x09, 0x37, 0x67, 0xa6, 0xc7, 0xdf, 0xf2, 0xfb, 0xfb, 0xf1, 0xdf, 0xc7, 0xaa,
-        0x6c, 0x39, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x4d, 0x87, 0xb9, 0xd1,
-        0xe8, 0xfc, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x43, 0x34,
-        0x20, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x02, 0x12, 0x2a, 0x3c, 0x45, 0x45, 0x3c, 0x2a, 0x12, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1d, 0x32, 0x42, 0x23, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x1d, 0x3a, 0x5f, 0x7e, 0x90, 0x93, 0x88, 0x70, 0x4d,
-        0x2b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x29,
-        0x4c, 0x70, 0x88, 0x93, 0x8f, 0x7e, 0x5f, 0x3a, 0x1e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x25, 0x6b,
-        0xa4, 0xd7, 0xf1, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf5, 0xea, 0xc0, 0x8d, 0x46, 0x11,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x44, 0x8c, 0xbd, 0xe9, 0xf5, 0xfc, 0xff, 0xff, 0xff,
-        0xff, 0xf9, 0xf1, 0xd9, 0xa4, 0x6c, 0x25, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x3a, 0x95, 0xdd, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xbe, 0x68, 0x19, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x64,
-        0xbd, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xfc, 0xdd, 0x95, 0x3a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x3a,
-        0x9b, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xcb, 0x6d, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x69, 0xc8, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x9c,
-        0x3d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x16, 0x50, 0xa0, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xfc, 0xcf, 0x79, 0x2e, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x2b,
-        0x75, 0xcb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xa1, 0x50, 0x16, 0x05,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x67, 0x71,
-        0x9e, 0xd3, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xe5, 0xbd, 0x82, 0x6a, 0x63, 0x63, 0x6a, 0x81, 0xba, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xd4, 0x9e, 0x71, 0x68, 0x31, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xf4, 0xce, 0xb7, 0xb2, 0xb0, 0xb4, 0xbc, 0xe0, 0xfc, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe1, 0xbf, 0xb3, 0xb0, 0xb1,
-        0xb6, 0xcb, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xcd, 0x7f, 0x3f, 0x1a, 0x06,
-        0x02, 0x01, 0x04, 0x0b, 0x2a, 0x55, 0xa5, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xe8, 0xa8, 0x56, 0x2b, 0x0d, 0x03, 0x00, 0x01, 0x06, 0x17, 0x3d, 0x7a, 0xc8,
-        0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xfa, 0xc5, 0x66, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x05, 0x34, 0x93, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x95, 0x37, 0x05, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x5e, 0xc1, 0xf9, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xc0, 0x60, 0x14, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x31,
-        0x8b, 0xdc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xdf, 0x90, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x5b, 0xba, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xff, 0xff,
-        0xff, 0xff, 0xf2, 0xd7, 0x9a, 0x4b, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x26, 0x6b, 0xbe, 0xe2,
-        0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xe4, 0xc0, 0x70, 0x2a, 0x02,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x0e, 0x47, 0x96, 0xd5, 0xef, 0xff, 0xff, 0xff, 0xff, 0x81, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xd1, 0xb9, 0x98, 0x73, 0x48, 0x1b, 0x04,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2b, 0x5d, 0x83, 0xa9, 0xc5, 0xd4,
-        0xd4, 0xc5, 0xa9, 0x83, 0x60, 0x2f, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0x18, 0x44, 0x70, 0x94, 0xb6, 0xd2, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x08, 0x10, 0x0b, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0d, 0x10, 0x10, 0x0d, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-        0x0b, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x07, 0x0d, 0x10, 0x11, 0x0f, 0x0a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0a, 0x0f, 0x11, 0x10,
-        0x0d, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x24, 0x54, 0x7c, 0xa2, 0xc1,
-        0xd3, 0xd6, 0xcb, 0xb3, 0x8f, 0x6b, 0x3e, 0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x13, 0x3b, 0x69, 0x8e, 0xb3, 0xcb, 0xd6, 0xd3, 0xc1, 0xa2, 0x7d, 0x56, 0x24,
-        0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1c, 0x5e, 0xaf, 0xde, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xec, 0xcf, 0x86, 0x3c, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x3b, 0x86, 0xcd, 0xeb, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xde, 0xb0, 0x5e, 0x1d, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x75, 0xd0, 0xfb, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec,
-        0xac, 0x4a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x09, 0x46, 0xa7, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xd2, 0x79, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x01, 0x24, 0x7a, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xb0, 0x4d, 0x0e,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x49, 0xad, 0xf1, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xd7, 0x7d, 0x25, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x09, 0x23, 0x4a, 0x92, 0xda, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xbd, 0x6c, 0x36, 0x13, 0x05, 0x01,
-        0x01, 0x05, 0x12, 0x34, 0x67, 0xba, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xdb, 0x94, 0x4a, 0x23, 0x09, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x53, 0xb4, 0xba, 0xd8, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xc5, 0xb5, 0xb1, 0xb1, 0xb5, 0xc5, 0xeb, 0xfe,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xd8,
-        0xba, 0xb6, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xc9, 0x8f, 0x6c, 0x64, 0x62, 0x68, 0x74, 0xaa,
-        0xda, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xdb,
-        0xac, 0x76, 0x67, 0x62, 0x63, 0x6a, 0x8a, 0xc7, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd,
-        0x8b, 0x3d, 0x0e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1e, 0x5f, 0xb4, 0xf3, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xb7, 0x62, 0x1e, 0x07, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x02, 0x0e, 0x3a, 0x87, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x84, 0x2a, 0x01, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x4e, 0xb1, 0xf2, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-        0xb3, 0x52, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0x26, 0x7f, 0xd7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-        0xce, 0x7d, 0x26, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x0c, 0x4a, 0xa4, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xa9, 0x4e, 0x0d, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x77, 0xca,
-        0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x7a, 0xff, 0xfe, 0xf6, 0xee, 0xcb, 0x99, 0x57, 0x19, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x07, 0x2e, 0x7a, 0xac, 0xdf, 0xf2, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xf2, 0xe2,
-        0xb0, 0x7c, 0x32, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x53, 0x95, 0xc6, 0xec, 0xf6,
-        0xfd, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x8d, 0x76,
-        0x54, 0x30, 0x17, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-        0x21, 0x40, 0x65, 0x81, 0x91, 0x91, 0x82, 0x66, 0x40, 0x23, 0x0b, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 0x2f, 0x51, 0x73, 0x8d, 0x4a, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x26, 0x39, 0x44, 0x46, 0x3f, 0x30, 0x1a,
-        0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-        0x1a, 0x30, 0x40, 0x46, 0x44, 0x39, 0x26, 0x0e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x2d,
-        0x5e, 0x9c, 0xc1, 0xdb, 0xee, 0xfa, 0xfc, 0xf5, 0xe6, 0xce, 0xb5, 0x7d, 0x45, 0x16, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x45, 0x7c, 0xb3, 0xce, 0xe6, 0xf5, 0xfc, 0xfa,
-        0xee, 0xdb, 0xc3, 0x9d, 0x5e, 0x2d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x50, 0xa5, 0xe4, 0xfd, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xc7, 0x7d, 0x2c, 0x01, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
-        0x7c, 0xc7, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-        0xe4, 0xa5, 0x52, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-        0x58, 0xb8, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x8c, 0x2f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2d, 0x8a, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xbc, 0x59,
-        0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x5d, 0xbc, 0xf7, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xe3, 0x90, 0x36, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-        0x35, 0x8d, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xbf, 0x5e, 0x1c, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x26, 0x30,
-        0x59, 0x90, 0xce, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb,
-        0xb0, 0x79, 0x40, 0x29, 0x23, 0x23, 0x29, 0x40, 0x76, 0xad, 0xea, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xd1, 0x93, 0x5b, 0x30, 0x26, 0x11, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xec, 0xed, 0xf7, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xeb, 0xe9,
-        0xe9, 0xeb, 0xf1, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xf7, 0xed, 0xee, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xf4, 0xec, 0xe9, 0xe9, 0xea, 0xed, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xed, 0xea, 0xe9, 0xe9,
-        0xeb, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xbf, 0x84, 0x4c, 0x2c,
-        0x23, 0x22, 0x27, 0x34, 0x67, 0x9e, 0xdd, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xfd, 0xdf, 0x9f, 0x67, 0x32, 0x26, 0x22, 0x23, 0x28, 0x48, 0x84, 0xbc, 0xf2,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xef, 0xa6, 0x49, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0x26, 0x72, 0xce, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xd0, 0x76, 0x27, 0x03,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x44, 0xa3, 0xed, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xa3, 0x42, 0x08,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x6f,
-        0xcb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xfc, 0xce, 0x6f, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3f, 0x9e, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xfb, 0xd5, 0x91, 0x3c, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x60, 0xb2, 0xed, 0xfe,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xb6, 0x66, 0x1c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x05, 0x37, 0x8c, 0xd3, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xf9, 0xe9, 0xd3, 0xbb, 0x8d, 0x51, 0x20,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x36, 0x67, 0xa6, 0xc6, 0xdd, 0xf0, 0xfb,
-        0xfb, 0xf1, 0xdf, 0xc7, 0xa9, 0x6a, 0x38, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1e, 0x4d, 0x87, 0xb9, 0xd1, 0xe8, 0xfc, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x20, 0x42, 0x34, 0x1e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x28, 0x3b, 0x45, 0x45, 0x3c, 0x2a, 0x12, 0x02,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1d,
-        0x32, 0x42, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0x00, 0x00, 0x00, 0x11, 0x1a, 0x00, 0x00, 0x30, 0x75, 0x00, 0x00, 0x7f, 0x00, 0x00,
+        0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+        0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+        0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x83, 0x38, 0xc6, 0x18, 0xc6, 0x59,
+        0xce, 0x07, 0x79, 0xce, 0x83, 0x59, 0xce, 0x38, 0xc6, 0x59, 0xce, 0x18, 0x00, 0x00, 0x81,
+        0x59, 0xce, 0x02, 0x38, 0xc6, 0x07, 0x79, 0xce, 0x83, 0x59, 0xce, 0x18, 0xc6, 0x38, 0xc6,
+        0x2f, 0x00, 0x00, 0x85, 0x79, 0xce, 0x59, 0xce, 0x79, 0xce, 0x59, 0xce, 0xdf, 0xff, 0x09,
+        0x79, 0xce, 0x85, 0xb6, 0xb5, 0x59, 0xce, 0x79, 0xce, 0xf7, 0xbd, 0x38, 0xc6, 0x12, 0x00,
+        0x00, 0x82, 0x18, 0xc6, 0x14, 0xa5, 0x02, 0x59, 0xce, 0x82, 0xb6, 0xb5, 0x9a, 0xd6, 0x08,
+        0x79, 0xce, 0x82, 0xff, 0xff, 0x38, 0xc6, 0x02, 0x59, 0xce, 0x81, 0x79, 0xce, 0x29, 0x00,
+        0x00, 0x81, 0x59, 0xce, 0x02, 0x79, 0xce, 0x81, 0x59, 0xce, 0x02, 0x79, 0xce, 0x03, 0x59,
+        0xce, 0x07, 0x38, 0xc6, 0x03, 0x59, 0xce, 0x83, 0x79, 0xce, 0xf7, 0xbd, 0x59, 0xce, 0x02,
+        0x79, 0xce, 0x0e, 0x00, 0x00, 0x03, 0x79, 0xce, 0x82, 0x18, 0xc6, 0x79, 0xce, 0x02, 0x59,
+        0xce, 0x04, 0x38, 0xc6, 0x02, 0x18, 0xc6, 0x04, 0x38, 0xc6, 0x02, 0x59, 0xce, 0x82, 0x9a,
+        0xd6, 0x38, 0xc6, 0x02, 0x79, 0xce, 0x81, 0x59, 0xce, 0x24, 0x00, 0x00, 0x81, 0x59, 0xce,
+        0x02, 0x79, 0xce, 0x82, 0x59, 0xce, 0x79, 0xce, 0x02, 0x59, 0xce, 0x03, 0x38, 0xc6, 0x0a,
+        0x18, 0xc6, 0x02, 0x38, 0xc6, 0x02, 0x59, 0xce, 0x82, 0x3c, 0xe7, 0x59, 0xce, 0x02, 0x79,
+        0xce, 0x0a, 0x00, 0x00, 0x02, 0x79, 0xce, 0x83, 0x59, 0xce, 0xff, 0xff, 0x59, 0xce, 0x02,
+        0x38, 0xc6, 0x0e, 0x18, 0xc6, 0x87, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x38, 0xc6, 0x79,
+        0xce, 0xaa, 0x52, 0x79, 0xce, 0x1f, 0x00, 0x00, 0x81, 0x59, 0xce, 0x02, 0x38, 0xc6, 0x02,
+        0x59, 0xce, 0x81, 0x79, 0xce, 0x02, 0x59, 0xce, 0x02, 0x38, 0xc6, 0x10, 0x18, 0xc6, 0x81,
+        0x38, 0xc6, 0x02, 0x59, 0xce, 0x81, 0xfb, 0xde, 0x02, 0x59, 0xce, 0x82, 0xd7, 0xbd, 0x59,
+        0xce, 0x04, 0x00, 0x00, 0x82, 0x38, 0xc6, 0xff, 0xff, 0x02, 0x59, 0xce, 0x81, 0x3c, 0xe7,
+        0x02, 0x59, 0xce, 0x81, 0x38, 0xc6, 0x0c, 0x18, 0xc6, 0x04, 0xf7, 0xbd, 0x02, 0x18, 0xc6,
+        0x88, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x38, 0xc6, 0x59, 0xce, 0x38, 0xc6, 0x18, 0xc6,
+        0x79, 0xce, 0x19, 0x00, 0x00, 0x03, 0x79, 0xce, 0x02, 0x59, 0xce, 0x82, 0xba, 0xd6, 0x79,
+        0xce, 0x02, 0x59, 0xce, 0x81, 0x38, 0xc6, 0x15, 0x18, 0xc6, 0x82, 0x38, 0xc6, 0x59, 0xce,
+        0x02, 0x79, 0xce, 0x81, 0x38, 0xc6, 0x02, 0x59, 0xce, 0x02, 0x79, 0xce, 0x03, 0x59, 0xce,
+        0x02, 0x79, 0xce, 0x82, 0x59, 0xce, 0x38, 0xc6, 0x0e, 0x18, 0xc6, 0x06, 0xf7, 0xbd, 0x02,
+        0x18, 0xc6, 0x84, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x8a, 0x52, 0x02, 0x38, 0xc6, 0x03,
+        0x59, 0xce, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x03, 0x79, 0xce, 0x03, 0x59, 0xce, 0x02,
+        0x38, 0xc6, 0x19, 0x18, 0xc6, 0x02, 0x38, 0xc6, 0x02, 0x59, 0xce, 0x03, 0x79, 0xce, 0x03,
+        0x59, 0xce, 0x02, 0x38, 0xc6, 0x10, 0x18, 0xc6, 0x09, 0xf7, 0xbd, 0x81, 0x18, 0xc6, 0x02,
+        0x38, 0xc6, 0x05, 0x59, 0xce, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x02, 0x59, 0xce, 0x04,
+        0x38, 0xc6, 0x1e, 0x18, 0xc6, 0x06, 0x38, 0xc6, 0x13, 0x18, 0xc6, 0x0b, 0xf7, 0xbd, 0x06,
+        0x18, 0xc6, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x02, 0x38, 0xc6, 0x10, 0x18, 0xc6, 0x05,
+        0xf7, 0xbd, 0x1e, 0x18, 0xc6, 0x03, 0xf7, 0xbd, 0x04, 0xd7, 0xbd, 0x12, 0xf7, 0xbd, 0x81,
+        0x9e, 0xf7, 0x15, 0x00, 0x00, 0x02, 0x38, 0xc6, 0x0d, 0x18, 0xc6, 0x81, 0xf7, 0xbd, 0x03,
+        0xd7, 0xbd, 0x02, 0xb6, 0xb5, 0x02, 0xd7, 0xbd, 0x83, 0xb6, 0xb5, 0xd7, 0xbd, 0xf7, 0xbd,
+        0x19, 0x18, 0xc6, 0x02, 0xf7, 0xbd, 0x84, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5,
+        0x02, 0x96, 0xb5, 0x81, 0xd7, 0xbd, 0x02, 0xb6, 0xb5, 0x02, 0xd7, 0xbd, 0x0e, 0xf7, 0xbd,
+        0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x02, 0x38, 0xc6, 0x0a, 0x18, 0xc6, 0x81, 0xf7, 0xbd,
+        0x02, 0xd7, 0xbd, 0x81, 0xb6, 0xb5, 0x03, 0xd7, 0xbd, 0x03, 0xb6, 0xb5, 0x02, 0xd7, 0xbd,
+        0x02, 0xb6, 0xb5, 0x82, 0xd7, 0xbd, 0xf7, 0xbd, 0x15, 0x18, 0xc6, 0x81, 0xf7, 0xbd, 0x02,
+        0xd7, 0xbd, 0x81, 0xb6, 0xb5, 0x02, 0xd7, 0xbd, 0x02, 0xb6, 0xb5, 0x02, 0x96, 0xb5, 0x83,
+        0xb6, 0xb5, 0xd7, 0xbd, 0x96, 0xb5, 0x02, 0xb6, 0xb5, 0x02, 0xd7, 0xbd, 0x0c, 0xf7, 0xbd,
+        0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x02, 0x38, 0xc6, 0x08, 0x18, 0xc6, 0x84, 0xf7, 0xbd,
+        0xd7, 0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0x02, 0xd7, 0xbd, 0x82, 0x59, 0xce, 0x38, 0xc6, 0x04,
+        0x00, 0x00, 0x87, 0x59, 0xce, 0x96, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x18, 0xc6, 0x96, 0xb5,
+        0xd7, 0xbd, 0x02, 0xf7, 0xbd, 0x10, 0x18, 0xc6, 0x82, 0xf7, 0xbd, 0xd7, 0xbd, 0x02, 0xb6,
+        0xb5, 0x85, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0x96, 0xb5, 0x59, 0xce, 0x04, 0x00, 0x00,
+        0x82, 0x38, 0xc6, 0x9a, 0xd6, 0x02, 0xb6, 0xb5, 0x82, 0x75, 0xad, 0xb6, 0xb5, 0x02, 0xd7,
+        0xbd, 0x0a, 0xf7, 0xbd, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x82, 0x18, 0xc6, 0x38, 0xc6,
+        0x06, 0x18, 0xc6, 0x88, 0xf7, 0xbd, 0xd7, 0xbd, 0xb6, 0xb5, 0x75, 0xad, 0xd7, 0xbd, 0xb6,
+        0xb5, 0x55, 0xad, 0x79, 0xce, 0x09, 0x00, 0x00, 0x03, 0xb6, 0xb5, 0x82, 0xf7, 0xbd, 0xb6,
+        0xb5, 0x02, 0xd7, 0xbd, 0x02, 0xf7, 0xbd, 0x0a, 0x18, 0xc6, 0x02, 0xf7, 0xbd, 0x02, 0xd7,
+        0xbd, 0x83, 0x96, 0xb5, 0xf7, 0xbd, 0xb6, 0xb5, 0x02, 0xd7, 0xbd, 0x09, 0x00, 0x00, 0x81,
+        0x59, 0xce, 0x02, 0x96, 0xb5, 0x82, 0xb6, 0xb5, 0x96, 0xb5, 0x02, 0xb6, 0xb5, 0x81, 0xd7,
+        0xbd, 0x08, 0xf7, 0xbd, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x06, 0xf7, 0xbd, 0x02, 0xd7,
+        0xbd, 0x82, 0xb6, 0xb5, 0x51, 0x8c, 0x02, 0xb6, 0xb5, 0x82, 0x96, 0xb5, 0x59, 0xce, 0x0d,
+        0x00, 0x00, 0x86, 0xd7, 0xbd, 0x79, 0xce, 0xb6, 0xb5, 0xd7, 0xbd, 0x96, 0xb5, 0xb6, 0xb5,
+        0x03, 0xd7, 0xbd, 0x06, 0xf7, 0xbd, 0x03, 0xd7, 0xbd, 0x02, 0xb6, 0xb5, 0x84, 0xd7, 0xbd,
+        0x96, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x0d, 0x00, 0x00, 0x81, 0x59, 0xce, 0x03, 0xb6, 0xb5,
+        0x82, 0x18, 0xc6, 0x96, 0xb5, 0x02, 0xb6, 0xb5, 0x06, 0xd7, 0xbd, 0x81, 0x9e, 0xf7, 0x15,
+        0x00, 0x00, 0x05, 0xb6, 0xb5, 0x84, 0xd7, 0xbd, 0x7d, 0xef, 0xd7, 0xbd, 0xb6, 0xb5, 0x02,
+        0x18, 0xc6, 0x12, 0x00, 0x00, 0x86, 0x59, 0xce, 0x55, 0xad, 0xb6, 0xb5, 0x96, 0xb5, 0x18,
+        0xc6, 0x55, 0xad, 0x04, 0xb6, 0xb5, 0x02, 0x96, 0xb5, 0x02, 0xb6, 0xb5, 0x86, 0x55, 0xad,
+        0xf7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0x55, 0xad, 0x18, 0xc6, 0x12, 0x00, 0x00, 0x02, 0x59,
+        0xce, 0x83, 0x96, 0xb5, 0xb6, 0xb5, 0x9a, 0xd6, 0x02, 0xb6, 0xb5, 0x04, 0x96, 0xb5, 0x81,
+        0x9e, 0xf7, 0x15, 0x00, 0x00, 0x82, 0xb6, 0xb5, 0x96, 0xb5, 0x03, 0xb6, 0xb5, 0x83, 0xf7,
+        0xbd, 0xb2, 0x94, 0x59, 0xce, 0x19, 0x00, 0x00, 0x83, 0x18, 0xc6, 0x38, 0xc6, 0xd7, 0xbd,
+        0x03, 0xb6, 0xb5, 0x02, 0x96, 0xb5, 0x84, 0xb6, 0xb5, 0xd7, 0xbd, 0x38, 0xc6, 0x18, 0xc6,
+        0x19, 0x00, 0x00, 0x84, 0x9e, 0xf7, 0xf3, 0x9c, 0xf7, 0xbd, 0xb6, 0xb5, 0x04, 0x96, 0xb5,
+        0x81, 0x9e, 0xf7, 0x7f, 0x00, 0x00, 0x06, 0x00, 0x00, 0x84, 0x38, 0xc6, 0x18, 0xc6, 0x59,
+        0xce, 0x79, 0xce, 0x02, 0x59, 0xce, 0x06, 0x38, 0xc6, 0x82, 0x59, 0xce, 0x79, 0xce, 0x03,
+        0x59, 0xce, 0x14, 0x00, 0x00, 0x03, 0x59, 0xce, 0x82, 0x79, 0xce, 0x59, 0xce, 0x07, 0x38,
+        0xc6, 0x03, 0x59, 0xce, 0x82, 0x18, 0xc6, 0x38, 0xc6, 0x2b, 0x00, 0x00, 0x81, 0x59, 0xce,
+        0x02, 0x79, 0xce, 0x02, 0x59, 0xce, 0x03, 0x79, 0xce, 0x08, 0x59, 0xce, 0x83, 0x79, 0xce,
+        0xd7, 0xbd, 0x59, 0xce, 0x03, 0x79, 0xce, 0x10, 0x00, 0x00, 0x82, 0xd7, 0xbd, 0xb6, 0xb5,
+        0x02, 0x59, 0xce, 0x81, 0xd7, 0xbd, 0x02, 0x79, 0xce, 0x08, 0x59, 0xce, 0x84, 0x79, 0xce,
+        0x9a, 0xd6, 0x38, 0xc6, 0x59, 0xce, 0x02, 0x79, 0xce, 0x81, 0x59, 0xce, 0x26, 0x00, 0x00,
+        0x81, 0x59, 0xce, 0x02, 0x79, 0xce, 0x83, 0x59, 0xce, 0xba, 0xd6, 0x79, 0xce, 0x02, 0x59,
+        0xce, 0x03, 0x38, 0xc6, 0x04, 0x18, 0xc6, 0x04, 0x38, 0xc6, 0x02, 0x59, 0xce, 0x82, 0x79,
+        0xce, 0x18, 0xc6, 0x03, 0x79, 0xce, 0x0c, 0x00, 0x00, 0x02, 0x79, 0xce, 0x82, 0x59, 0xce,
+        0x9a, 0xd6, 0x03, 0x59, 0xce, 0x02, 0x38, 0xc6, 0x08, 0x18, 0xc6, 0x02, 0x38, 0xc6, 0x02,
+        0x59, 0xce, 0x85, 0xdb, 0xde, 0x59, 0xce, 0x79, 0xce, 0x38, 0xc6, 0x79, 0xce, 0x22, 0x00,
+        0x00, 0x02, 0x59, 0xce, 0x85, 0x79, 0xce, 0x59, 0xce, 0x9a, 0xd6, 0x79, 0xce, 0x59, 0xce,
+        0x02, 0x38, 0xc6, 0x0d, 0x18, 0xc6, 0x02, 0x38, 0xc6, 0x83, 0x59, 0xce, 0x79, 0xce, 0xf7,
+        0xbd, 0x03, 0x79, 0xce, 0x81, 0x59, 0xce, 0x06, 0x00, 0x00, 0x81, 0x59, 0xce, 0x02, 0x79,
+        0xce, 0x84, 0x59, 0xce, 0x18, 0xc6, 0x79, 0xce, 0x59, 0xce, 0x02, 0x38, 0xc6, 0x09, 0x18,
+        0xc6, 0x03, 0xf7, 0xbd, 0x02, 0x18, 0xc6, 0x02, 0x38, 0xc6, 0x84, 0x59, 0xce, 0x9a, 0xd6,
+        0x59, 0xce, 0x79, 0xce, 0x02, 0x59, 0xce, 0x1b, 0x00, 0x00, 0x85, 0xba, 0xd6, 0x1c, 0xe7,
+        0x59, 0xce, 0x38, 0xc6, 0x79, 0xce, 0x02, 0x59, 0xce, 0x84, 0x9a, 0xd6, 0x79, 0xce, 0x59,
+        0xce, 0x38, 0xc6, 0x13, 0x18, 0xc6, 0x88, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0xf7, 0xbd,
+        0x59, 0xce, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x02, 0x9a, 0xd6, 0x88, 0x38, 0xc6, 0x59,
+        0xce, 0x79, 0xce, 0x59, 0xce, 0x18, 0xc6, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x0c, 0x18,
+        0xc6, 0x06, 0xf7, 0xbd, 0x02, 0x18, 0xc6, 0x83, 0x38, 0xc6, 0x59, 0xce, 0xba, 0xd6, 0x02,
+        0x59, 0xce, 0x85, 0x79, 0xce, 0x38, 0xc6, 0x59, 0xce, 0xba, 0xd6, 0x79, 0xce, 0x16, 0x00,
+        0x00, 0x02, 0x59, 0xce, 0x83, 0x79, 0xce, 0x9a, 0xd6, 0xba, 0xd6, 0x03, 0x59, 0xce, 0x81,
+        0x38, 0xc6, 0x17, 0x18, 0xc6, 0x81, 0x38, 0xc6, 0x02, 0x59, 0xce, 0x82, 0x9a, 0xd6, 0x7d,
+        0xef, 0x03, 0x59, 0xce, 0x83, 0x79, 0xce, 0xbe, 0xf7, 0x9a, 0xd6, 0x02, 0x59, 0xce, 0x81,
+        0x38, 0xc6, 0x0d, 0x18, 0xc6, 0x09, 0xf7, 0xbd, 0x02, 0x18, 0xc6, 0x81, 0x38, 0xc6, 0x02,
+        0x59, 0xce, 0x81, 0xba, 0xd6, 0x03, 0x59, 0xce, 0x82, 0x38, 0xc6, 0x9e, 0xf7, 0x15, 0x00,
+        0x00, 0x02, 0x79, 0xce, 0x03, 0x59, 0xce, 0x02, 0x38, 0xc6, 0x1b, 0x18, 0xc6, 0x02, 0x38,
+        0xc6, 0x06, 0x59, 0xce, 0x02, 0x38, 0xc6, 0x0f, 0x18, 0xc6, 0x0b, 0xf7, 0xbd, 0x02, 0x18,
+        0xc6, 0x03, 0x38, 0xc6, 0x02, 0x59, 0xce, 0x82, 0x38, 0xc6, 0x9e, 0xf7, 0x15, 0x00, 0x00,
+        0x04, 0x38, 0xc6, 0x34, 0x18, 0xc6, 0x12, 0xf7, 0xbd, 0x03, 0x18, 0xc6, 0x82, 0xf7, 0xbd,
+        0x9e, 0xf7, 0x15, 0x00, 0x00, 0x10, 0x18, 0xc6, 0x03, 0xf7, 0xbd, 0x03, 0xd7, 0xbd, 0x03,
+        0xf7, 0xbd, 0x1b, 0x18, 0xc6, 0x02, 0xf7, 0xbd, 0x03, 0xd7, 0xbd, 0x02, 0xb6, 0xb5, 0x03,
+        0xd7, 0xbd, 0x10, 0xf7, 0xbd, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x0e, 0x18, 0xc6, 0x82,
+        0xf7, 0xbd, 0xd7, 0xbd, 0x02, 0xb6, 0xb5, 0x83, 0xf7, 0xbd, 0x75, 0xad, 0x71, 0x8c, 0x02,
+        0xd7, 0xbd, 0x81, 0x96, 0xb5, 0x02, 0xd7, 0xbd, 0x81, 0xf7, 0xbd, 0x17, 0x18, 0xc6, 0x02,
+        0xf7, 0xbd, 0x02, 0xd7, 0xbd, 0x81, 0x96, 0xb5, 0x02, 0xd7, 0xbd, 0x83, 0x00, 0x00, 0xf3,
+        0x9c, 0xf7, 0xbd, 0x02, 0xb6, 0xb5, 0x02, 0xd7, 0xbd, 0x0e, 0xf7, 0xbd, 0x81, 0x9e, 0xf7,
+        0x15, 0x00, 0x00, 0x0b, 0x18, 0xc6, 0x02, 0xf7, 0xbd, 0x83, 0xd7, 0xbd, 0xb6, 0xb5, 0x38,
+        0xc6, 0x02, 0xb6, 0xb5, 0x8b, 0x38, 0xc6, 0x79, 0xce, 0xfb, 0xde, 0x59, 0xce, 0xf7, 0xbd,
+        0x96, 0xb5, 0xb6, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xf7, 0xbd, 0x13, 0x18, 0xc6,
+        0x02, 0xf7, 0xbd, 0x90, 0xd7, 0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0x96, 0xb5, 0xf7,
+        0xbd, 0x59, 0xce, 0xdb, 0xde, 0x59, 0xce, 0x38, 0xc6, 0xb6, 0xb5, 0x96, 0xb5, 0xf7, 0xbd,
+        0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0x0c, 0xf7, 0xbd, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00,
+        0x09, 0x18, 0xc6, 0x81, 0xf7, 0xbd, 0x02, 0xd7, 0xbd, 0x85, 0xb6, 0xb5, 0xf7, 0xbd, 0xb6,
+        0xb5, 0x51, 0x8c, 0x59, 0xce, 0x07, 0x00, 0x00, 0x86, 0xd7, 0xbd, 0xf7, 0xbd, 0xb6, 0xb5,
+        0x34, 0xa5, 0xb6, 0xb5, 0xd7, 0xbd, 0x02, 0xf7, 0xbd, 0x0e, 0x18, 0xc6, 0x02, 0xf7, 0xbd,
+        0x86, 0xd7, 0xbd, 0xb6, 0xb5, 0x75, 0xad, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x07, 0x00,
+        0x00, 0x86, 0x79, 0xce, 0x34, 0xa5, 0xb6, 0xb5, 0xd7, 0xbd, 0x96, 0xb5, 0xb6, 0xb5, 0x02,
+        0xd7, 0xbd, 0x09, 0xf7, 0xbd, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x06, 0x18, 0xc6, 0x02,
+        0xf7, 0xbd, 0x02, 0xd7, 0xbd, 0x86, 0xb6, 0xb5, 0xf7, 0xbd, 0xb6, 0xb5, 0x55, 0xad, 0x18,
+        0xc6, 0x79, 0xce, 0x09, 0x00, 0x00, 0x04, 0xb6, 0xb5, 0x82, 0x75, 0xad, 0xb6, 0xb5, 0x02,
+        0xd7, 0xbd, 0x03, 0xf7, 0xbd, 0x06, 0x18, 0xc6, 0x03, 0xf7, 0xbd, 0x02, 0xd7, 0xbd, 0x86,
+        0xb6, 0xb5, 0x55, 0xad, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0x09, 0x00, 0x00,
+        0x83, 0x59, 0xce, 0xd7, 0xbd, 0x96, 0xb5, 0x02, 0xb6, 0xb5, 0x81, 0xd7, 0xbd, 0x02, 0xb6,
+        0xb5, 0x81, 0xd7, 0xbd, 0x07, 0xf7, 0xbd, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x06, 0xd7,
+        0xbd, 0x88, 0xb6, 0xb5, 0xd7, 0xbd, 0x75, 0xad, 0xb6, 0xb5, 0xd7, 0xbd, 0x75, 0xad, 0xb6,
+        0xb5, 0x59, 0xce, 0x0d, 0x00, 0x00, 0x86, 0xd7, 0xbd, 0x96, 0xb5, 0x18, 0xc6, 0xb6, 0xb5,
+        0xd7, 0xbd, 0x96, 0xb5, 0x02, 0xb6, 0xb5, 0x08, 0xd7, 0xbd, 0x03, 0xb6, 0xb5, 0x85, 0xd7,
+        0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0x59, 0xce, 0xb6, 0xb5, 0x0d, 0x00, 0x00, 0x86, 0x59, 0xce,
+        0xb6, 0xb5, 0x55, 0xad, 0xf7, 0xbd, 0x96, 0xb5, 0x75, 0xad, 0x03, 0xb6, 0xb5, 0x04, 0xd7,
+        0xbd, 0x82, 0xb6, 0xb5, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x02, 0x75, 0xad, 0x87, 0x96, 0xb5,
+        0x75, 0xad, 0x55, 0xad, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x02, 0x18, 0xc6,
+        0x12, 0x00, 0x00, 0x84, 0x59, 0xce, 0x55, 0xad, 0xb6, 0xb5, 0xd7, 0xbd, 0x02, 0xb6, 0xb5,
+        0x81, 0x96, 0xb5, 0x06, 0x75, 0xad, 0x87, 0xb6, 0xb5, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd,
+        0xb6, 0xb5, 0x55, 0xad, 0x18, 0xc6, 0x12, 0x00, 0x00, 0x02, 0x59, 0xce, 0x03, 0xb6, 0xb5,
+        0x04, 0x75, 0xad, 0x83, 0x96, 0xb5, 0x75, 0xad, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x82, 0xb6,
+        0xb5, 0x96, 0xb5, 0x03, 0xb6, 0xb5, 0x83, 0xd7, 0xbd, 0xf3, 0x9c, 0x59, 0xce, 0x19, 0x00,
+        0x00, 0x84, 0x18, 0xc6, 0x38, 0xc6, 0xd7, 0xbd, 0xb6, 0xb5, 0x04, 0x96, 0xb5, 0x84, 0xb6,
+        0xb5, 0xd7, 0xbd, 0x38, 0xc6, 0x18, 0xc6, 0x19, 0x00, 0x00, 0x84, 0x9e, 0xf7, 0xf3, 0x9c,
+        0xf7, 0xbd, 0xb6, 0xb5, 0x04, 0x96, 0xb5, 0x81, 0x9e, 0xf7, 0x23, 0x00, 0x00, 0x83, 0x38,
+        0xc6, 0x18, 0xc6, 0x59, 0xce, 0x07, 0x79, 0xce, 0x83, 0x59, 0xce, 0x38, 0xc6, 0x59, 0xce,
+        0x18, 0x00, 0x00, 0x81, 0x59, 0xce, 0x02, 0x38, 0xc6, 0x07, 0x79, 0xce, 0x83, 0x59, 0xce,
+        0x18, 0xc6, 0x38, 0xc6, 0x2f, 0x00, 0x00, 0x81, 0x79, 0xce, 0x03, 0x59, 0xce, 0x84, 0x79,
+        0xce, 0xd7, 0xbd, 0xba, 0xd6, 0x9a, 0xd6, 0x02, 0x79, 0xce, 0x02, 0x9a, 0xd6, 0x81, 0xdb,
+        0xde, 0x03, 0x59, 0xce, 0x83, 0x79, 0xce, 0x51, 0x8c, 0x18, 0xc6, 0x12, 0x00, 0x00, 0x83,
+        0x18, 0xc6, 0xb2, 0x94, 0x79, 0xce, 0x02, 0x59, 0xce, 0x82, 0x79, 0xce, 0xfb, 0xde, 0x05,
+        0x9a, 0xd6, 0x82, 0xba, 0xd6, 0xb6, 0xb5, 0x04, 0x59, 0xce, 0x81, 0x79, 0xce, 0x29, 0x00,
+        0x00, 0x81, 0x59, 0xce, 0x02, 0x79, 0xce, 0x83, 0x38, 0xc6, 0x79, 0xce, 0x9a, 0xd6, 0x04,
+        0x59, 0xce, 0x05, 0x38, 0xc6, 0x03, 0x59, 0xce, 0x82, 0x79, 0xce, 0x5d, 0xef, 0x04, 0x79,
+        0xce, 0x0e, 0x00, 0x00, 0x86, 0x79, 0xce, 0xcf, 0x7b, 0xf7, 0xbd, 0x59, 0xce, 0x5d, 0xef,
+        0x79, 0xce, 0x02, 0x59, 0xce, 0x08, 0x38, 0xc6, 0x02, 0x59, 0xce, 0x86, 0x9a, 0xd6, 0x59,
+        0xce, 0x79, 0xce, 0x59, 0xce, 0x79, 0xce, 0x59, 0xce, 0x24, 0x00, 0x00, 0x02, 0x59, 0xce,
+        0x02, 0x79, 0xce, 0x82, 0xb6, 0xb5, 0x38, 0xc6, 0x02, 0x59, 0xce, 0x02, 0x38, 0xc6, 0x09,
+        0x18, 0xc6, 0x02, 0x38, 0xc6, 0x02, 0x59, 0xce, 0x82, 0x79, 0xce, 0x59, 0xce, 0x03, 0x79,
+        0xce, 0x0a, 0x00, 0x00, 0x03, 0x79, 0xce, 0x83, 0x59, 0xce, 0x38, 0xc6, 0x59, 0xce, 0x03,
+        0x38, 0xc6, 0x03, 0x18, 0xc6, 0x04, 0xf7, 0xbd, 0x04, 0x18, 0xc6, 0x86, 0x38, 0xc6, 0x59,
+        0xce, 0x79, 0xce, 0x34, 0xa5, 0x79, 0xce, 0xff, 0xff, 0x02, 0x79, 0xce, 0x21, 0x00, 0x00,
+        0x02, 0x59, 0xce, 0x84, 0x79, 0xce, 0xd7, 0xbd, 0x79, 0xce, 0x59, 0xce, 0x02, 0x38, 0xc6,
+        0x0f, 0x18, 0xc6, 0x02, 0x38, 0xc6, 0x83, 0x59, 0xce, 0x9a, 0xd6, 0x59, 0xce, 0x02, 0x79,
+        0xce, 0x81, 0x59, 0xce, 0x06, 0x00, 0x00, 0x81, 0x59, 0xce, 0x02, 0x79, 0xce, 0x84, 0x59,
+        0xce, 0x9a, 0xd6, 0x59, 0xce, 0x38, 0xc6, 0x04, 0x18, 0xc6, 0x0b, 0xf7, 0xbd, 0x02, 0x18,
+        0xc6, 0x02, 0x38, 0xc6, 0x83, 0x79, 0xce, 0xd3, 0x9c, 0x79, 0xce, 0x02, 0x59, 0xce, 0x1b,
+        0x00, 0x00, 0x84, 0xba, 0xd6, 0x1c, 0xe7, 0x59, 0xce, 0x38, 0xc6, 0x02, 0x79, 0xce, 0x84,
+        0x7d, 0xef, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x14, 0x18, 0xc6, 0x02, 0x38, 0xc6, 0x8f,
+        0x59, 0xce, 0x79, 0xce, 0x38, 0xc6, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x9a, 0xd6, 0x79,
+        0xce, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x38, 0xc6, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6,
+        0x05, 0x18, 0xc6, 0x0f, 0xf7, 0xbd, 0x02, 0x18, 0xc6, 0x89, 0x38, 0xc6, 0x79, 0xce, 0x9e,
+        0xf7, 0x59, 0xce, 0x79, 0xce, 0x38, 0xc6, 0x59, 0xce, 0xba, 0xd6, 0x79, 0xce, 0x16, 0x00,
+        0x00, 0x02, 0xff, 0xff, 0x83, 0xdb, 0xde, 0x59, 0xce, 0x79, 0xce, 0x02, 0x59, 0xce, 0x81,
+        0x38, 0xc6, 0x18, 0x18, 0xc6, 0x02, 0x38, 0xc6, 0x84, 0x59, 0xce, 0x79, 0xce, 0x59, 0xce,
+        0x79, 0xce, 0x02, 0xff, 0xff, 0x85, 0x79, 0xce, 0x59, 0xce, 0x79, 0xce, 0x59, 0xce, 0x38,
+        0xc6, 0x07, 0x18, 0xc6, 0x11, 0xf7, 0xbd, 0x02, 0x18, 0xc6, 0x85, 0x38, 0xc6, 0x59, 0xce,
+        0x79, 0xce, 0x59, 0xce, 0xdb, 0xde, 0x02, 0xff, 0xff, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00,
+        0x03, 0x59, 0xce, 0x03, 0x38, 0xc6, 0x1d, 0x18, 0xc6, 0x03, 0x38, 0xc6, 0x02, 0x59, 0xce,
+        0x03, 0x38, 0xc6, 0x08, 0x18, 0xc6, 0x15, 0xf7, 0xbd, 0x02, 0x18, 0xc6, 0x04, 0x38, 0xc6,
+        0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x12, 0x18, 0xc6, 0x05, 0xf7, 0xbd, 0x1b, 0x18, 0xc6,
+        0x1c, 0xf7, 0xbd, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x0f, 0x18, 0xc6, 0x81, 0xf7, 0xbd,
+        0x03, 0xd7, 0xbd, 0x02, 0xb6, 0xb5, 0x03, 0xd7, 0xbd, 0x02, 0xf7, 0xbd, 0x18, 0x18, 0xc6,
+        0x03, 0xf7, 0xbd, 0x03, 0xd7, 0xbd, 0x04, 0xb6, 0xb5, 0x03, 0xd7, 0xbd, 0x0f, 0xf7, 0xbd,
+        0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x0c, 0x18, 0xc6, 0x02, 0xf7, 0xbd, 0x02, 0xd7, 0xbd,
+        0x85, 0xb6, 0xb5, 0x55, 0xad, 0x75, 0xad, 0x96, 0xb5, 0xb6, 0xb5, 0x02, 0x96, 0xb5, 0x81,
+        0x55, 0xad, 0x02, 0xb6, 0xb5, 0x82, 0xd7, 0xbd, 0xf7, 0xbd, 0x15, 0x18, 0xc6, 0x02, 0xf7,
+        0xbd, 0x83, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd, 0x02, 0x55, 0xad, 0x86, 0x75, 0xad, 0xb6,
+        0xb5, 0x96, 0xb5, 0x75, 0xad, 0x55, 0xad, 0x96, 0xb5, 0x02, 0xb6, 0xb5, 0x81, 0xd7, 0xbd,
+        0x0d, 0xf7, 0xbd, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x0a, 0x18, 0xc6, 0x81, 0xf7, 0xbd,
+        0x02, 0xd7, 0xbd, 0x8c, 0xb6, 0xb5, 0x34, 0xa5, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x38,
+        0xc6, 0x79, 0xce, 0xba, 0xd6, 0x59, 0xce, 0xf7, 0xbd, 0x96, 0xb5, 0xd7, 0xbd, 0x02, 0x96,
+        0xb5, 0x82, 0xb6, 0xb5, 0xd7, 0xbd, 0x02, 0xf7, 0xbd, 0x10, 0x18, 0xc6, 0x02, 0xf7, 0xbd,
+        0x81, 0xd7, 0xbd, 0x03, 0xb6, 0xb5, 0x87, 0xd7, 0xbd, 0x96, 0xb5, 0xf7, 0xbd, 0x59, 0xce,
+        0x9a, 0xd6, 0x79, 0xce, 0x38, 0xc6, 0x03, 0xb6, 0xb5, 0x81, 0xf3, 0x9c, 0x02, 0xb6, 0xb5,
+        0x81, 0xd7, 0xbd, 0x0b, 0xf7, 0xbd, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x08, 0x18, 0xc6,
+        0x81, 0xf7, 0xbd, 0x02, 0xd7, 0xbd, 0x82, 0xb6, 0xb5, 0xd3, 0x9c, 0x02, 0xb6, 0xb5, 0x82,
+        0x71, 0x8c, 0x59, 0xce, 0x07, 0x00, 0x00, 0x82, 0xd7, 0xbd, 0xf7, 0xbd, 0x02, 0xb6, 0xb5,
+        0x82, 0x96, 0xb5, 0xb6, 0xb5, 0x02, 0xd7, 0xbd, 0x02, 0xf7, 0xbd, 0x0a, 0x18, 0xc6, 0x03,
+        0xf7, 0xbd, 0x83, 0xd7, 0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0x02, 0xb6, 0xb5, 0x82, 0xd7, 0xbd,
+        0xb6, 0xb5, 0x07, 0x00, 0x00, 0x82, 0x79, 0xce, 0x55, 0xad, 0x02, 0xb6, 0xb5, 0x81, 0x0c,
+        0x63, 0x02, 0xb6, 0xb5, 0x02, 0xd7, 0xbd, 0x08, 0xf7, 0xbd, 0x81, 0x9e, 0xf7, 0x15, 0x00,
+        0x00, 0x03, 0x18, 0xc6, 0x03, 0xf7, 0xbd, 0x02, 0xd7, 0xbd, 0x02, 0xb6, 0xb5, 0x81, 0x38,
+        0xc6, 0x02, 0xb6, 0xb5, 0x82, 0x75, 0xad, 0x79, 0xce, 0x0b, 0x00, 0x00, 0x82, 0xb6, 0xb5,
+        0xd7, 0xbd, 0x05, 0xb6, 0xb5, 0x02, 0xd7, 0xbd, 0x08, 0xf7, 0xbd, 0x02, 0xd7, 0xbd, 0x02,
+        0xb6, 0xb5, 0x81, 0x96, 0xb5, 0x02, 0xb6, 0xb5, 0x82, 0xd7, 0xbd, 0xb6, 0xb5, 0x0b, 0x00,
+        0x00, 0x82, 0x59, 0xce, 0x96, 0xb5, 0x02, 0xb6, 0xb5, 0x82, 0x14, 0xa5, 0x96, 0xb5, 0x02,
+        0xb6, 0xb5, 0x03, 0xd7, 0xbd, 0x03, 0xf7, 0xbd, 0x82, 0xd7, 0xbd, 0x9e, 0xf7, 0x15, 0x00,
+        0x00, 0x04, 0xb6, 0xb5, 0x89, 0xd7, 0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0xf7, 0xbd, 0xd7, 0xbd,
+        0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x59, 0xce, 0x0f, 0x00, 0x00, 0x82, 0x38, 0xc6, 0xff,
+        0xff, 0x03, 0xb6, 0xb5, 0x83, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0x06, 0xb6, 0xb5, 0x81,
+        0xd7, 0xbd, 0x02, 0xb6, 0xb5, 0x85, 0x96, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0xba, 0xd6, 0xf7,
+        0xbd, 0x0f, 0x00, 0x00, 0x83, 0x9e, 0xf7, 0xf7, 0xbd, 0x18, 0xc6, 0x02, 0xb6, 0xb5, 0x82,
+        0xf7, 0xbd, 0x96, 0xb5, 0x06, 0xb6, 0xb5, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x04, 0xf7,
+        0xbd, 0x81, 0xd7, 0xbd, 0x02, 0xb6, 0xb5, 0x83, 0xf7, 0xbd, 0x24, 0x21, 0x59, 0xce, 0x14,
+        0x00, 0x00, 0x83, 0x59, 0xce, 0x18, 0xc6, 0x38, 0xc6, 0x02, 0xb6, 0xb5, 0x03, 0xd7, 0xbd,
+        0x02, 0xf7, 0xbd, 0x03, 0xd7, 0xbd, 0x02, 0xb6, 0xb5, 0x83, 0x59, 0xce, 0x38, 0xc6, 0x59,
+        0xce, 0x14, 0x00, 0x00, 0x85, 0x9e, 0xf7, 0x10, 0x84, 0xd7, 0xbd, 0x96, 0xb5, 0xb6, 0xb5,
+        0x05, 0xd7, 0xbd, 0x81, 0x9e, 0xf7, 0x7f, 0x00, 0x00, 0x08, 0x00, 0x00, 0x83, 0x38, 0xc6,
+        0xb6, 0xb5, 0x59, 0xce, 0x07, 0x79, 0xce, 0x83, 0x59, 0xce, 0x38, 0xc6, 0x59, 0xce, 0x18,
+        0x00, 0x00, 0x83, 0x9e, 0xf7, 0xf7, 0xbd, 0x38, 0xc6, 0x07, 0x79, 0xce, 0x03, 0x59, 0xce,
+        0x2f, 0x00, 0x00, 0x81, 0x79, 0xce, 0x02, 0x59, 0xce, 0x82, 0x38, 0xc6, 0xff, 0xff, 0x09,
+        0x79, 0xce, 0x81, 0xb6, 0xb5, 0x02, 0x59, 0xce, 0x82, 0xf3, 0x9c, 0x18, 0xc6, 0x12, 0x00,
+        0x00, 0x82, 0x18, 0xc6, 0x14, 0xa5, 0x02, 0x59, 0xce, 0x82, 0xb6, 0xb5, 0x9a, 0xd6, 0x03,
+        0x79, 0xce, 0x81, 0x59, 0xce, 0x04, 0x79, 0xce, 0x82, 0xff, 0xff, 0x18, 0xc6, 0x02, 0x59,
+        0xce, 0x81, 0x79, 0xce, 0x29, 0x00, 0x00, 0x81, 0x59, 0xce, 0x02, 0x79, 0xce, 0x82, 0x59,
+        0xce, 0x79, 0xce, 0x03, 0x59, 0xce, 0x03, 0x38, 0xc6, 0x02, 0x18, 0xc6, 0x04, 0x38, 0xc6,
+        0x02, 0x59, 0xce, 0x83, 0x79, 0xce, 0xf7, 0xbd, 0x59, 0xce, 0x02, 0x79, 0xce, 0x0e, 0x00,
+        0x00, 0x03, 0x79, 0xce, 0x82, 0x18, 0xc6, 0x79, 0xce, 0x02, 0x59, 0xce, 0x02, 0x38, 0xc6,
+        0x07, 0x18, 0xc6, 0x02, 0x38, 0xc6, 0x83, 0x59, 0xce, 0x9a, 0xd6, 0x38, 0xc6, 0x02, 0x79,
+        0xce, 0x81, 0x59, 0xce, 0x24, 0x00, 0x00, 0x02, 0x59, 0xce, 0x83, 0x79, 0xce, 0x38, 0xc6,
+        0x79, 0xce, 0x03, 0x38, 0xc6, 0x0d, 0x18, 0xc6, 0x81, 0x38, 0xc6, 0x02, 0x59, 0xce, 0x82,
+        0x7d, 0xef, 0x59, 0xce, 0x02, 0x79, 0xce, 0x0a, 0x00, 0x00, 0x02, 0x79, 0xce, 0x83, 0x59,
+        0xce, 0xff, 0xff, 0x59, 0xce, 0x02, 0x38, 0xc6, 0x03, 0x18, 0xc6, 0x09, 0xf7, 0xbd, 0x02,
+        0x18, 0xc6, 0x87, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x38, 0xc6, 0x79, 0xce, 0x8e, 0x73,
+        0x79, 0xce, 0x1f, 0x00, 0x00, 0x81, 0x59, 0xce, 0x02, 0x38, 0xc6, 0x85, 0x79, 0xce, 0x38,
+        0xc6, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x12, 0x18, 0xc6, 0x02, 0x38, 0xc6, 0x82, 0x59,
+        0xce, 0x1c, 0xe7, 0x02, 0x59, 0xce, 0x82, 0xf7, 0xbd, 0x59, 0xce, 0x04, 0x00, 0x00, 0x82,
+        0x38, 0xc6, 0xff, 0xff, 0x02, 0x59, 0xce, 0x85, 0x7d, 0xef, 0x79, 0xce, 0x59, 0xce, 0x38,
+        0xc6, 0x18, 0xc6, 0x10, 0xf7, 0xbd, 0x86, 0x18, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce,
+        0x18, 0xc6, 0x59, 0xce, 0x02, 0x38, 0xc6, 0x81, 0x59, 0xce, 0x19, 0x00, 0x00, 0x03, 0x79,
+        0xce, 0x86, 0x59, 0xce, 0x38, 0xc6, 0x18, 0xc6, 0x79, 0xce, 0x59, 0xce, 0x38, 0xc6, 0x16,
+        0x18, 0xc6, 0x02, 0x38, 0xc6, 0x82, 0x59, 0xce, 0x79, 0xce, 0x02, 0x38, 0xc6, 0x02, 0x59,
+        0xce, 0x82, 0x79, 0xce, 0x59, 0xce, 0x02, 0x38, 0xc6, 0x82, 0x79, 0xce, 0x59, 0xce, 0x02,
+        0x38, 0xc6, 0x81, 0x18, 0xc6, 0x14, 0xf7, 0xbd, 0x82, 0x18, 0xc6, 0x38, 0xc6, 0x02, 0x59,
+        0xce, 0x81, 0x14, 0xa5, 0x02, 0x38, 0xc6, 0x03, 0x59, 0xce, 0x81, 0x9e, 0xf7, 0x15, 0x00,
+        0x00, 0x03, 0x79, 0xce, 0x03, 0x59, 0xce, 0x81, 0x38, 0xc6, 0x1b, 0x18, 0xc6, 0x81, 0x38,
+        0xc6, 0x03, 0x59, 0xce, 0x02, 0x79, 0xce, 0x03, 0x59, 0xce, 0x81, 0x38, 0xc6, 0x02, 0x18,
+        0xc6, 0x18, 0xf7, 0xbd, 0x02, 0x18, 0xc6, 0x83, 0x38, 0xc6, 0x59, 0xce, 0x38, 0xc6, 0x03,
+        0x59, 0xce, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x04, 0x38, 0xc6, 0x1d, 0x18, 0xc6, 0x81,
+        0xf7, 0xbd, 0x04, 0x18, 0xc6, 0x02, 0x38, 0xc6, 0x04, 0x18, 0xc6, 0x1d, 0xf7, 0xbd, 0x05,
+        0x18, 0xc6, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x10, 0x18, 0xc6, 0x02, 0xf7, 0xbd, 0x04,
+        0xd7, 0xbd, 0x03, 0xf7, 0xbd, 0x07, 0x18, 0xc6, 0x17, 0xf7, 0xbd, 0x06, 0xd7, 0xbd, 0x10,
+        0xf7, 0xbd, 0x82, 0xd7, 0xbd, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x0d, 0x18, 0xc6, 0x02, 0xf7,
+        0xbd, 0x81, 0xd7, 0xbd, 0x02, 0xb6, 0xb5, 0x81, 0xd7, 0xbd, 0x02, 0x96, 0xb5, 0x83, 0xb6,
+        0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x02, 0xd7, 0xbd, 0x81, 0xf7, 0xbd, 0x03, 0x18, 0xc6, 0x16,
+        0xf7, 0xbd, 0x02, 0xd7, 0xbd, 0x83, 0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x02, 0x96, 0xb5,
+        0x03, 0xb6, 0xb5, 0x02, 0xd7, 0xbd, 0x0d, 0xf7, 0xbd, 0x82, 0xd7, 0xbd, 0x9e, 0xf7, 0x15,
+        0x00, 0x00, 0x0b, 0x18, 0xc6, 0x02, 0xf7, 0xbd, 0x81, 0xd7, 0xbd, 0x03, 0xb6, 0xb5, 0x82,
+        0xd7, 0xbd, 0xb6, 0xb5, 0x02, 0x96, 0xb5, 0x02, 0xb6, 0xb5, 0x02, 0xd7, 0xbd, 0x02, 0xb6,
+        0xb5, 0x81, 0xd7, 0xbd, 0x16, 0xf7, 0xbd, 0x81, 0xd7, 0xbd, 0x02, 0xb6, 0xb5, 0x82, 0xf7,
+        0xbd, 0xd7, 0xbd, 0x02, 0xb6, 0xb5, 0x02, 0x96, 0xb5, 0x83, 0xb6, 0xb5, 0xd7, 0xbd, 0x96,
+        0xb5, 0x03, 0xb6, 0xb5, 0x81, 0xd7, 0xbd, 0x0b, 0xf7, 0xbd, 0x82, 0xd7, 0xbd, 0x9e, 0xf7,
+        0x15, 0x00, 0x00, 0x09, 0x18, 0xc6, 0x02, 0xf7, 0xbd, 0x83, 0xd7, 0xbd, 0xb6, 0xb5, 0x96,
+        0xb5, 0x02, 0xb6, 0xb5, 0x82, 0x9a, 0xd6, 0x38, 0xc6, 0x04, 0x00, 0x00, 0x88, 0x59, 0xce,
+        0x96, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0xf7, 0xbd, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0x12,
+        0xf7, 0xbd, 0x88, 0xd7, 0xbd, 0xb6, 0xb5, 0x96, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0xd7, 0xbd,
+        0x96, 0xb5, 0x59, 0xce, 0x04, 0x00, 0x00, 0x82, 0x38, 0xc6, 0x9a, 0xd6, 0x02, 0xb6, 0xb5,
+        0x81, 0x96, 0xb5, 0x02, 0xb6, 0xb5, 0x81, 0xd7, 0xbd, 0x09, 0xf7, 0xbd, 0x82, 0xd7, 0xbd,
+        0x9e, 0xf7, 0x15, 0x00, 0x00, 0x06, 0x18, 0xc6, 0x02, 0xf7, 0xbd, 0x02, 0xd7, 0xbd, 0x82,
+        0xb6, 0xb5, 0x75, 0xad, 0x02, 0xb6, 0xb5, 0x82, 0x55, 0xad, 0x79, 0xce, 0x09, 0x00, 0x00,
+        0x03, 0xb6, 0xb5, 0x82, 0xd7, 0xbd, 0xb6, 0xb5, 0x03, 0xd7, 0xbd, 0x0c, 0xf7, 0xbd, 0x02,
+        0xd7, 0xbd, 0x86, 0xb6, 0xb5, 0x96, 0xb5, 0xf7, 0xbd, 0xb6, 0xb5, 0xf7, 0xbd, 0xd7, 0xbd,
+        0x09, 0x00, 0x00, 0x82, 0x59, 0xce, 0x96, 0xb5, 0x02, 0xb6, 0xb5, 0x81, 0x96, 0xb5, 0x02,
+        0xb6, 0xb5, 0x02, 0xd7, 0xbd, 0x07, 0xf7, 0xbd, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x05,
+        0xf7, 0xbd, 0x02, 0xd7, 0xbd, 0x02, 0xb6, 0xb5, 0x81, 0x34, 0xa5, 0x02, 0xb6, 0xb5, 0x82,
+        0x96, 0xb5, 0x59, 0xce, 0x0d, 0x00, 0x00, 0x85, 0xd7, 0xbd, 0x79, 0xce, 0xb6, 0xb5, 0xd7,
+        0xbd, 0x96, 0xb5, 0x02, 0xb6, 0xb5, 0x09, 0xd7, 0xbd, 0x82, 0xb6, 0xb5, 0xd7, 0xbd, 0x03,
+        0xb6, 0xb5, 0x83, 0x96, 0xb5, 0xf7, 0xbd, 0xb6, 0xb5, 0x0d, 0x00, 0x00, 0x86, 0x9e, 0xf7,
+        0xb6, 0xb5, 0xd7, 0xbd, 0xb6, 0xb5, 0x18, 0xc6, 0x96, 0xb5, 0x03, 0xb6, 0xb5, 0x05, 0xd7,
+        0xbd, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x03, 0x96, 0xb5, 0x03, 0xb6, 0xb5, 0x81, 0x1c,
+        0xe7, 0x02, 0xb6, 0xb5, 0x02, 0x18, 0xc6, 0x12, 0x00, 0x00, 0x87, 0x59, 0xce, 0x55, 0xad,
+        0xb6, 0xb5, 0x96, 0xb5, 0xd7, 0xbd, 0x75, 0xad, 0xb6, 0xb5, 0x05, 0x96, 0xb5, 0x02, 0xb6,
+        0xb5, 0x86, 0x55, 0xad, 0xd7, 0xbd, 0x96, 0xb5, 0xd7, 0xbd, 0x55, 0xad, 0x18, 0xc6, 0x12,
+        0x00, 0x00, 0x02, 0x59, 0xce, 0x02, 0x96, 0xb5, 0x83, 0x38, 0xc6, 0xd7, 0xbd, 0xb6, 0xb5,
+        0x04, 0x96, 0xb5, 0x81, 0x9e, 0xf7, 0x15, 0x00, 0x00, 0x03, 0x96, 0xb5, 0x02, 0xb6, 0xb5,
+        0x83, 0xf7, 0xbd, 0xf3, 0x9c, 0x59, 0xce, 0x19, 0x00, 0x00, 0x83, 0x18, 0xc6, 0x59, 0xce,
+        0xd7, 0xbd, 0x05, 0x96, 0xb5, 0x84, 0xb6, 0xb5, 0xd7, 0xbd, 0x59, 0xce, 0x18, 0xc6, 0x19,
+        0x00, 0x00, 0x84, 0x9e, 0xf7, 0xf3, 0x9c, 0xf7, 0xbd, 0xb6, 0xb5, 0x04, 0x96, 0xb5, 0x81,
+        0x9e, 0xf7, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+        0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+        0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+        0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+        0x00, 0x00, 0x53, 0x00, 0x00, 0x85, 0x01, 0x0f, 0x26, 0x39, 0x44, 0x46, 0x40, 0x30, 0x1a,
+        0x06, 0x0e, 0x00, 0x00, 0x85, 0x05, 0x19, 0x30, 0x3f, 0x46, 0x44, 0x39, 0x26, 0x0f, 0x01,
+        0x18, 0x00, 0x00, 0x89, 0x00, 0x05, 0x2d, 0x5d, 0x9c, 0xc3, 0xdb, 0xee, 0xfa, 0xfc, 0xf6,
+        0xe5, 0xce, 0xb5, 0x80, 0x46, 0x17, 0x00, 0x0a, 0x00, 0x00, 0x89, 0x00, 0x16, 0x45, 0x7c,
+        0xb3, 0xce, 0xe6, 0xf5, 0xfc, 0xfa, 0xee, 0xdb, 0xc3, 0x9e, 0x5e, 0x2e, 0x05, 0x00, 0x15,
+        0x00, 0x00, 0x83, 0x00, 0x10, 0x52, 0xa5, 0xe4, 0xfd, 0x05, 0xff, 0xff, 0x83, 0xff, 0xf7,
+        0xc8, 0x7e, 0x2c, 0x01, 0x08, 0x00, 0x00, 0x83, 0x00, 0x2a, 0x7c, 0xc7, 0xf6, 0xff, 0x05,
+        0xff, 0xff, 0x83, 0xfd, 0xe4, 0xa5, 0x52, 0x10, 0x00, 0x13, 0x00, 0x00, 0x83, 0x00, 0x11,
+        0x59, 0xbc, 0xf6, 0xff, 0x08, 0xff, 0xff, 0x82, 0xe1, 0x8e, 0x31, 0x02, 0x06, 0x00, 0x00,
+        0x82, 0x01, 0x2e, 0x8a, 0xde, 0x08, 0xff, 0xff, 0x83, 0xff, 0xf6, 0xbc, 0x5a, 0x12, 0x00,
+        0x11, 0x00, 0x00, 0x83, 0x00, 0x1c, 0x5d, 0xbe, 0xf8, 0xff, 0x0a, 0xff, 0xff, 0x82, 0xe3,
+        0x92, 0x38, 0x0b, 0x04, 0x00, 0x00, 0x82, 0x09, 0x35, 0x8d, 0xe1, 0x0a, 0xff, 0xff, 0x83,
+        0xff, 0xf8, 0xbf, 0x5e, 0x1c, 0x00, 0x0e, 0x00, 0x00, 0x84, 0x11, 0x26, 0x30, 0x5b, 0x93,
+        0xd1, 0xf9, 0xff, 0x0c, 0xff, 0xff, 0x86, 0xec, 0xb1, 0x79, 0x40, 0x29, 0x23, 0x23, 0x29,
+        0x40, 0x76, 0xad, 0xea, 0x0c, 0xff, 0xff, 0x84, 0xff, 0xf9, 0xd1, 0x94, 0x5b, 0x30, 0x26,
+        0x11, 0x0c, 0x00, 0x00, 0x82, 0x6e, 0xec, 0xed, 0xf7, 0x0f, 0xff, 0xff, 0x84, 0xff, 0xf1,
+        0xeb, 0xe9, 0xe9, 0xeb, 0xf1, 0xfe, 0x0f, 0xff, 0xff, 0x82, 0xf7, 0xed, 0xee, 0x75, 0x0c,
+        0x00, 0x00, 0x81, 0x78, 0xff, 0x07, 0xff, 0xff, 0x84, 0xf4, 0xec, 0xea, 0xe9, 0xea, 0xed,
+        0xfa, 0xff, 0x0e, 0xff, 0xff, 0x84, 0xff, 0xfb, 0xee, 0xea, 0xe9, 0xe9, 0xeb, 0xf3, 0x07,
+        0xff, 0xff, 0x81, 0xff, 0x81, 0x0c, 0x00, 0x00, 0x81, 0x77, 0xff, 0x05, 0xff, 0xff, 0x87,
+        0xff, 0xf4, 0xc0, 0x86, 0x4d, 0x2c, 0x24, 0x23, 0x27, 0x34, 0x67, 0x9e, 0xdd, 0xfd, 0x0c,
+        0xff, 0xff, 0x87, 0xfd, 0xdf, 0x9e, 0x69, 0x37, 0x27, 0x22, 0x23, 0x2b, 0x48, 0x84, 0xbc,
+        0xf2, 0xff, 0x05, 0xff, 0xff, 0x81, 0xff, 0x80, 0x0c, 0x00, 0x00, 0x81, 0x77, 0xff, 0x04,
+        0xff, 0xff, 0x83, 0xff, 0xef, 0xaa, 0x4b, 0x12, 0x00, 0x03, 0x00, 0x00, 0x83, 0x00, 0x03,
+        0x26, 0x74, 0xd0, 0xfd, 0x0a, 0xff, 0xff, 0x83, 0xfd, 0xd1, 0x76, 0x27, 0x03, 0x00, 0x03,
+        0x00, 0x00, 0x83, 0x00, 0x10, 0x46, 0xa3, 0xed, 0xff, 0x04, 0xff, 0xff, 0x81, 0xff, 0x80,
+        0x0c, 0x00, 0x00, 0x81, 0x77, 0xff, 0x03, 0xff, 0xff, 0x83, 0xff, 0xee, 0xa5, 0x43, 0x09,
+        0x00, 0x06, 0x00, 0x00, 0x82, 0x1d, 0x6f, 0xcb, 0xfb, 0x08, 0xff, 0xff, 0x82, 0xfc, 0xce,
+        0x72, 0x1e, 0x06, 0x00, 0x00, 0x83, 0x00, 0x07, 0x3f, 0xa0, 0xea, 0xff, 0x03, 0xff, 0xff,
+        0x81, 0xff, 0x80, 0x0c, 0x00, 0x00, 0x81, 0x77, 0xff, 0x02, 0xff, 0xff, 0x83, 0xfb, 0xd6,
+        0x91, 0x3d, 0x07, 0x00, 0x08, 0x00, 0x00, 0x83, 0x19, 0x60, 0xb2, 0xed, 0xfe, 0xff, 0x04,
+        0xff, 0xff, 0x83, 0xff, 0xfe, 0xef, 0xb6, 0x66, 0x1c, 0x08, 0x00, 0x00, 0x83, 0x00, 0x05,
+        0x37, 0x8c, 0xd3, 0xfa, 0x02, 0xff, 0xff, 0x81, 0xff, 0x80, 0x0c, 0x00, 0x00, 0x84, 0x77,
+        0xfa, 0xe9, 0xd4, 0xbd, 0x8d, 0x51, 0x21, 0x0b, 0x00, 0x00, 0x88, 0x09, 0x37, 0x67, 0xa6,
+        0xc7, 0xdf, 0xf2, 0xfb, 0xfb, 0xf1, 0xdf, 0xc7, 0xaa, 0x6c, 0x39, 0x0b, 0x0b, 0x00, 0x00,
+        0x84, 0x1e, 0x4d, 0x87, 0xb9, 0xd1, 0xe8, 0xfc, 0x7e, 0x0c, 0x00, 0x00, 0x83, 0x22, 0x43,
+        0x34, 0x20, 0x0a, 0x00, 0x0d, 0x00, 0x00, 0x86, 0x00, 0x02, 0x12, 0x2a, 0x3c, 0x45, 0x45,
+        0x3c, 0x2a, 0x12, 0x02, 0x00, 0x0d, 0x00, 0x00, 0x83, 0x00, 0x08, 0x1d, 0x32, 0x42, 0x23,
+        0x7f, 0x00, 0x00, 0x29, 0x00, 0x00, 0x87, 0x00, 0x06, 0x1d, 0x3a, 0x5f, 0x7e, 0x90, 0x93,
+        0x88, 0x70, 0x4d, 0x2b, 0x12, 0x00, 0x0c, 0x00, 0x00, 0x87, 0x00, 0x11, 0x29, 0x4c, 0x70,
+        0x88, 0x93, 0x8f, 0x7e, 0x5f, 0x3a, 0x1e, 0x06, 0x00, 0x17, 0x00, 0x00, 0x89, 0x04, 0x25,
+        0x6b, 0xa4, 0xd7, 0xf1, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf5, 0xea, 0xc0, 0x8d, 0x46,
+        0x11, 0x0a, 0x00, 0x00, 0x89, 0x10, 0x44, 0x8c, 0xbd, 0xe9, 0xf5, 0xfc, 0xff, 0xff, 0xff,
+        0xff, 0xf9, 0xf1, 0xd9, 0xa4, 0x6c, 0x25, 0x04, 0x15, 0x00, 0x00, 0x83, 0x05, 0x3a, 0x95,
+        0xdd, 0xfc, 0xff, 0x06, 0xff, 0xff, 0x82, 0xf1, 0xbe, 0x68, 0x19, 0x08, 0x00, 0x00, 0x82,
+        0x17, 0x64, 0xbd, 0xf0, 0x06, 0xff, 0xff, 0x83, 0xff, 0xfc, 0xdd, 0x95, 0x3a, 0x05, 0x13,
+        0x00, 0x00, 0x82, 0x06, 0x3a, 0x9b, 0xe9, 0x09, 0xff, 0xff, 0x82, 0xfb, 0xcb, 0x6d, 0x1b,
+        0x06, 0x00, 0x00, 0x82, 0x18, 0x69, 0xc8, 0xfa, 0x09, 0xff, 0xff, 0x82, 0xea, 0x9c, 0x3d,
+        0x06, 0x10, 0x00, 0x00, 0x83, 0x00, 0x05, 0x16, 0x50, 0xa0, 0xea, 0x0b, 0xff, 0xff, 0x83,
+        0xfc, 0xcf, 0x79, 0x2e, 0x0b, 0x00, 0x02, 0x00, 0x00, 0x83, 0x00, 0x0a, 0x2b, 0x75, 0xcb,
+        0xfb, 0x0b, 0xff, 0xff, 0x83, 0xeb, 0xa1, 0x50, 0x16, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x83,
+        0x2f, 0x67, 0x71, 0x9e, 0xd3, 0xf4, 0x0d, 0xff, 0xff, 0x86, 0xff, 0xe5, 0xbd, 0x82, 0x6a,
+        0x63, 0x63, 0x6a, 0x81, 0xba, 0xe3, 0xff, 0x0d, 0xff, 0xff, 0x83, 0xf4, 0xd4, 0x9e, 0x71,
+        0x68, 0x31, 0x0c, 0x00, 0x00, 0x81, 0x79, 0xff, 0x24, 0xff, 0xff, 0x81, 0xff, 0x81, 0x0c,
+        0x00, 0x00, 0x81, 0x77, 0xff, 0x06, 0xff, 0xff, 0x85, 0xff, 0xf4, 0xce, 0xb7, 0xb2, 0xb0,
+        0xb4, 0xbc, 0xe0, 0xfc, 0x0e, 0xff, 0xff, 0x85, 0xfc, 0xe1, 0xbf, 0xb3, 0xb0, 0xb1, 0xb6,
+        0xcb, 0xf3, 0xff, 0x06, 0xff, 0xff, 0x81, 0xff, 0x80, 0x0c, 0x00, 0x00, 0x81, 0x77, 0xff,
+        0x05, 0xff, 0xff, 0x87, 0xfc, 0xcd, 0x7f, 0x3f, 0x1a, 0x06, 0x02, 0x01, 0x04, 0x0b, 0x2a,
+        0x55, 0xa5, 0xe6, 0x0c, 0xff, 0xff, 0x87, 0xe8, 0xa8, 0x56, 0x2b, 0x0d, 0x03, 0x00, 0x01,
+        0x06, 0x17, 0x3d, 0x7a, 0xc8, 0xfa, 0x05, 0xff, 0xff, 0x81, 0xff, 0x80, 0x0c, 0x00, 0x00,
+        0x81, 0x77, 0xff, 0x04, 0xff, 0xff, 0x82, 0xfa, 0xc5, 0x66, 0x19, 0x05, 0x00, 0x00, 0x82,
+        0x05, 0x34, 0x93, 0xe4, 0x0a, 0xff, 0xff, 0x82, 0xe5, 0x95, 0x37, 0x05, 0x05, 0x00, 0x00,
+        0x82, 0x14, 0x5e, 0xc1, 0xf9, 0x04, 0xff, 0xff, 0x81, 0xff, 0x80, 0x0c, 0x00, 0x00, 0x81,
+        0x77, 0xff, 0x03, 0xff, 0xff, 0x82, 0xf4, 0xc0, 0x60, 0x14, 0x07, 0x00, 0x00, 0x82, 0x02,
+        0x31, 0x8b, 0xdc, 0x08, 0xff, 0xff, 0x82, 0xdf, 0x90, 0x33, 0x03, 0x07, 0x00, 0x00, 0x82,
+        0x12, 0x5b, 0xba, 0xf2, 0x03, 0xff, 0xff, 0x81, 0xff, 0x80, 0x0c, 0x00, 0x00, 0x85, 0x79,
+        0xff, 0xff, 0xff, 0xff, 0xf2, 0xd7, 0x9a, 0x4b, 0x10, 0x09, 0x00, 0x00, 0x83, 0x02, 0x26,
+        0x6b, 0xbe, 0xe2, 0xfb, 0x04, 0xff, 0xff, 0x83, 0xfd, 0xe4, 0xc0, 0x70, 0x2a, 0x02, 0x09,
+        0x00, 0x00, 0x85, 0x0e, 0x47, 0x96, 0xd5, 0xef, 0xff, 0xff, 0xff, 0xff, 0x81, 0x0c, 0x00,
+        0x00, 0x84, 0x66, 0xd1, 0xb9, 0x98, 0x73, 0x48, 0x1b, 0x04, 0x0b, 0x00, 0x00, 0x88, 0x00,
+        0x0c, 0x2b, 0x5d, 0x83, 0xa9, 0xc5, 0xd4, 0xd4, 0xc5, 0xa9, 0x83, 0x60, 0x2f, 0x0d, 0x00,
+        0x0b, 0x00, 0x00, 0x84, 0x03, 0x18, 0x44, 0x70, 0x94, 0xb6, 0xd2, 0x6b, 0x0c, 0x00, 0x00,
+        0x82, 0x08, 0x10, 0x0b, 0x05, 0x0f, 0x00, 0x00, 0x84, 0x00, 0x08, 0x0d, 0x10, 0x10, 0x0d,
+        0x08, 0x00, 0x0f, 0x00, 0x00, 0x82, 0x04, 0x0b, 0x0f, 0x08, 0x78, 0x00, 0x00, 0x84, 0x07,
+        0x0d, 0x10, 0x11, 0x0f, 0x0a, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x84, 0x00, 0x03, 0x0a, 0x0f,
+        0x11, 0x10, 0x0d, 0x07, 0x1a, 0x00, 0x00, 0x88, 0x08, 0x24, 0x54, 0x7c, 0xa2, 0xc1, 0xd3,
+        0xd6, 0xcb, 0xb3, 0x8f, 0x6b, 0x3e, 0x14, 0x01, 0x00, 0x0a, 0x00, 0x00, 0x88, 0x00, 0x01,
+        0x13, 0x3b, 0x69, 0x8e, 0xb3, 0xcb, 0xd6, 0xd3, 0xc1, 0xa2, 0x7d, 0x56, 0x24, 0x08, 0x17,
+        0x00, 0x00, 0x83, 0x1c, 0x5e, 0xaf, 0xde, 0xf8, 0xff, 0x04, 0xff, 0xff, 0x83, 0xec, 0xcf,
+        0x86, 0x3c, 0x09, 0x00, 0x08, 0x00, 0x00, 0x83, 0x00, 0x08, 0x3b, 0x86, 0xcd, 0xeb, 0x04,
+        0xff, 0xff, 0x83, 0xff, 0xf9, 0xde, 0xb0, 0x5e, 0x1d, 0x15, 0x00, 0x00, 0x82, 0x21, 0x75,
+        0xd0, 0xfb, 0x07, 0xff, 0xff, 0x83, 0xff, 0xec, 0xac, 0x4a, 0x0b, 0x00, 0x06, 0x00, 0x00,
+        0x83, 0x00, 0x09, 0x46, 0xa7, 0xeb, 0xff, 0x07, 0xff, 0xff, 0x82, 0xfb, 0xd2, 0x79, 0x22,
+        0x12, 0x00, 0x00, 0x83, 0x00, 0x01, 0x24, 0x7a, 0xd6, 0xff, 0x09, 0xff, 0xff, 0x83, 0xff,
+        0xf2, 0xb0, 0x4d, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x83, 0x00, 0x0c, 0x49, 0xad, 0xf1, 0xff,
+        0x09, 0xff, 0xff, 0x83, 0xff, 0xd7, 0x7d, 0x25, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x84, 0x00,
+        0x03, 0x09, 0x23, 0x4a, 0x92, 0xda, 0xff, 0x0b, 0xff, 0xff, 0x88, 0xff, 0xf4, 0xbd, 0x6c,
+        0x36, 0x13, 0x05, 0x01, 0x01, 0x05, 0x12, 0x34, 0x67, 0xba, 0xf2, 0xff, 0x0b, 0xff, 0xff,
+        0x84, 0xff, 0xdb, 0x94, 0x4a, 0x23, 0x09, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x83, 0x53, 0xb4,
+        0xba, 0xd8, 0xf9, 0xff, 0x0e, 0xff, 0xff, 0x85, 0xed, 0xc5, 0xb5, 0xb1, 0xb1, 0xb5, 0xc5,
+        0xeb, 0xfe, 0xff, 0x0d, 0xff, 0xff, 0x83, 0xff, 0xf9, 0xd8, 0xba, 0xb6, 0x58, 0x0c, 0x00,
+        0x00, 0x81, 0x7a, 0xff, 0x24, 0xff, 0xff, 0x81, 0xff, 0x82, 0x0c, 0x00, 0x00, 0x81, 0x77,
+        0xff, 0x06, 0xff, 0xff, 0x86, 0xec, 0xc9, 0x8f, 0x6c, 0x64, 0x62, 0x68, 0x74, 0xaa, 0xda,
+        0xf9, 0xff, 0x0c, 0xff, 0xff, 0x86, 0xff, 0xfb, 0xdb, 0xac, 0x76, 0x67, 0x62, 0x63, 0x6a,
+        0x8a, 0xc7, 0xea, 0x06, 0xff, 0xff, 0x81, 0xff, 0x80, 0x0c, 0x00, 0x00, 0x81, 0x77, 0xff,
+        0x05, 0xff, 0xff, 0x83, 0xdd, 0x8b, 0x3d, 0x0e, 0x03, 0x00, 0x02, 0x00, 0x00, 0x83, 0x07,
+        0x1e, 0x5f, 0xb4, 0xf3, 0xff, 0x0a, 0xff, 0xff, 0x83, 0xff, 0xf4, 0xb7, 0x62, 0x1e, 0x07,
+        0x02, 0x00, 0x00, 0x83, 0x00, 0x02, 0x0e, 0x3a, 0x87, 0xda, 0x05, 0xff, 0xff, 0x81, 0xff,
+        0x80, 0x0c, 0x00, 0x00, 0x81, 0x77, 0xff, 0x04, 0xff, 0xff, 0x82, 0xdb, 0x84, 0x2a, 0x01,
+        0x05, 0x00, 0x00, 0x83, 0x00, 0x0d, 0x4e, 0xb1, 0xf2, 0xff, 0x08, 0xff, 0xff, 0x83, 0xff,
+        0xf3, 0xb3, 0x52, 0x0e, 0x00, 0x05, 0x00, 0x00, 0x83, 0x01, 0x26, 0x7f, 0xd7, 0xfe, 0xff,
+        0x03, 0xff, 0xff, 0x81, 0xff, 0x80, 0x0c, 0x00, 0x00, 0x81, 0x77, 0xff, 0x02, 0xff, 0xff,
+        0x83, 0xff, 0xf7, 0xce, 0x7d, 0x26, 0x01, 0x07, 0x00, 0x00, 0x83, 0x00, 0x0c, 0x4a, 0xa4,
+        0xe6, 0xff, 0x06, 0xff, 0xff, 0x83, 0xff, 0xe8, 0xa9, 0x4e, 0x0d, 0x00, 0x07, 0x00, 0x00,
+        0x83, 0x00, 0x23, 0x77, 0xca, 0xf6, 0xff, 0x02, 0xff, 0xff, 0x81, 0xff, 0x80, 0x0c, 0x00,
+        0x00, 0x85, 0x7a, 0xff, 0xfe, 0xf6, 0xee, 0xcb, 0x99, 0x57, 0x19, 0x00, 0x09, 0x00, 0x00,
+        0x84, 0x00, 0x07, 0x2e, 0x7a, 0xac, 0xdf, 0xf2, 0xfa, 0x02, 0xff, 0xff, 0x84, 0xfa, 0xf2,
+        0xe2, 0xb0, 0x7c, 0x32, 0x09, 0x00, 0x09, 0x00, 0x00, 0x85, 0x00, 0x16, 0x53, 0x95, 0xc6,
+        0xec, 0xf6, 0xfd, 0xff, 0x82, 0x0c, 0x00, 0x00, 0x84, 0x46, 0x8d, 0x76, 0x54, 0x30, 0x17,
+        0x02, 0x00, 0x0c, 0x00, 0x00, 0x86, 0x09, 0x21, 0x40, 0x65, 0x81, 0x91, 0x91, 0x82, 0x66,
+        0x40, 0x23, 0x0b, 0x0c, 0x00, 0x00, 0x84, 0x00, 0x01, 0x15, 0x2f, 0x51, 0x73, 0x8d, 0x4a,
+        0x7f, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x85, 0x00, 0x0d, 0x26, 0x39, 0x44, 0x46, 0x3f, 0x30,
+        0x1a, 0x06, 0x0e, 0x00, 0x00, 0x85, 0x04, 0x1a, 0x30, 0x40, 0x46, 0x44, 0x39, 0x26, 0x0e,
+        0x01, 0x18, 0x00, 0x00, 0x89, 0x00, 0x05, 0x2d, 0x5e, 0x9c, 0xc1, 0xdb, 0xee, 0xfa, 0xfc,
+        0xf5, 0xe6, 0xce, 0xb5, 0x7d, 0x45, 0x16, 0x00, 0x0a, 0x00, 0x00, 0x89, 0x00, 0x15, 0x45,
+        0x7c, 0xb3, 0xce, 0xe6, 0xf5, 0xfc, 0xfa, 0xee, 0xdb, 0xc3, 0x9d, 0x5e, 0x2d, 0x05, 0x00,
+        0x15, 0x00, 0x00, 0x83, 0x00, 0x0f, 0x50, 0xa5, 0xe4, 0xfd, 0x05, 0xff, 0xff, 0x83, 0xff,
+        0xf7, 0xc7, 0x7d, 0x2c, 0x01, 0x08, 0x00, 0x00, 0x83, 0x00, 0x2a, 0x7c, 0xc7, 0xf6, 0xff,
+        0x05, 0xff, 0xff, 0x83, 0xfd, 0xe4, 0xa5, 0x52, 0x10, 0x00, 0x13, 0x00, 0x00, 0x83, 0x00,
+        0x10, 0x58, 0xb8, 0xf6, 0xff, 0x08, 0xff, 0xff, 0x82, 0xe1, 0x8c, 0x2f, 0x02, 0x06, 0x00,
+        0x00, 0x82, 0x01, 0x2d, 0x8a, 0xde, 0x08, 0xff, 0xff, 0x83, 0xff, 0xf6, 0xbc, 0x59, 0x12,
+        0x00, 0x11, 0x00, 0x00, 0x83, 0x00, 0x1b, 0x5d, 0xbc, 0xf7, 0xff, 0x0a, 0xff, 0xff, 0x82,
+        0xe3, 0x90, 0x36, 0x0a, 0x04, 0x00, 0x00, 0x82, 0x09, 0x35, 0x8d, 0xe0, 0x0a, 0xff, 0xff,
+        0x83, 0xff, 0xf8, 0xbf, 0x5e, 0x1c, 0x00, 0x0e, 0x00, 0x00, 0x84, 0x10, 0x26, 0x30, 0x59,
+        0x90, 0xce, 0xf9, 0xff, 0x0c, 0xff, 0xff, 0x86, 0xeb, 0xb0, 0x79, 0x40, 0x29, 0x23, 0x23,
+        0x29, 0x40, 0x76, 0xad, 0xea, 0x0c, 0xff, 0xff, 0x84, 0xff, 0xf9, 0xd1, 0x93, 0x5b, 0x30,
+        0x26, 0x11, 0x0c, 0x00, 0x00, 0x82, 0x6e, 0xec, 0xed, 0xf7, 0x0f, 0xff, 0xff, 0x84, 0xff,
+        0xf1, 0xeb, 0xe9, 0xe9, 0xeb, 0xf1, 0xfe, 0x0f, 0xff, 0xff, 0x82, 0xf7, 0xed, 0xee, 0x75,
+        0x0c, 0x00, 0x00, 0x81, 0x78, 0xff, 0x07, 0xff, 0xff, 0x84, 0xf4, 0xec, 0xe9, 0xe9, 0xea,
+        0xed, 0xfa, 0xff, 0x0e, 0xff, 0xff, 0x84, 0xff, 0xfa, 0xed, 0xea, 0xe9, 0xe9, 0xeb, 0xf3,
+        0x07, 0xff, 0xff, 0x81, 0xff, 0x81, 0x0c, 0x00, 0x00, 0x81, 0x77, 0xff, 0x05, 0xff, 0xff,
+        0x87, 0xff, 0xf3, 0xbf, 0x84, 0x4c, 0x2c, 0x23, 0x22, 0x27, 0x34, 0x67, 0x9e, 0xdd, 0xfd,
+        0x0c, 0xff, 0xff, 0x87, 0xfd, 0xdf, 0x9f, 0x67, 0x32, 0x26, 0x22, 0x23, 0x28, 0x48, 0x84,
+        0xbc, 0xf2, 0xff, 0x05, 0xff, 0xff, 0x81, 0xff, 0x80, 0x0c, 0x00, 0x00, 0x81, 0x77, 0xff,
+        0x04, 0xff, 0xff, 0x83, 0xff, 0xef, 0xa6, 0x49, 0x12, 0x00, 0x03, 0x00, 0x00, 0x83, 0x00,
+        0x03, 0x26, 0x72, 0xce, 0xfd, 0x0a, 0xff, 0xff, 0x83, 0xfd, 0xd0, 0x76, 0x27, 0x03, 0x00,
+        0x03, 0x00, 0x00, 0x83, 0x00, 0x10, 0x44, 0xa3, 0xed, 0xff, 0x04, 0xff, 0xff, 0x81, 0xff,
+        0x80, 0x0c, 0x00, 0x00, 0x81, 0x77, 0xff, 0x03, 0xff, 0xff, 0x83, 0xff, 0xed, 0xa3, 0x42,
+        0x08, 0x00, 0x06, 0x00, 0x00, 0x82, 0x1c, 0x6f, 0xcb, 0xfb, 0x08, 0xff, 0xff, 0x82, 0xfc,
+        0xce, 0x6f, 0x1d, 0x06, 0x00, 0x00, 0x83, 0x00, 0x07, 0x3f, 0x9e, 0xea, 0xff, 0x03, 0xff,
+        0xff, 0x81, 0xff, 0x80, 0x0c, 0x00, 0x00, 0x81, 0x78, 0xff, 0x02, 0xff, 0xff, 0x83, 0xfb,
+        0xd5, 0x91, 0x3c, 0x07, 0x00, 0x08, 0x00, 0x00, 0x83, 0x19, 0x60, 0xb2, 0xed, 0xfe, 0xff,
+        0x04, 0xff, 0xff, 0x83, 0xff, 0xfe, 0xee, 0xb6, 0x66, 0x1c, 0x08, 0x00, 0x00, 0x83, 0x00,
+        0x05, 0x37, 0x8c, 0xd3, 0xfa, 0x02, 0xff, 0xff, 0x81, 0xff, 0x80, 0x0c, 0x00, 0x00, 0x84,
+        0x75, 0xf9, 0xe9, 0xd3, 0xbb, 0x8d, 0x51, 0x20, 0x0b, 0x00, 0x00, 0x88, 0x09, 0x36, 0x67,
+        0xa6, 0xc6, 0xdd, 0xf0, 0xfb, 0xfb, 0xf1, 0xdf, 0xc7, 0xa9, 0x6a, 0x38, 0x0b, 0x0b, 0x00,
+        0x00, 0x84, 0x1e, 0x4d, 0x87, 0xb9, 0xd1, 0xe8, 0xfc, 0x7e, 0x0c, 0x00, 0x00, 0x83, 0x20,
+        0x42, 0x34, 0x1e, 0x08, 0x00, 0x0d, 0x00, 0x00, 0x86, 0x00, 0x02, 0x12, 0x28, 0x3b, 0x45,
+        0x45, 0x3c, 0x2a, 0x12, 0x02, 0x00, 0x0d, 0x00, 0x00, 0x83, 0x00, 0x08, 0x1d, 0x32, 0x42,
+        0x23, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+        0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x11, 0x00, 0x00,
 
 };
 
 const lv_image_dsc_t image_haze_fog_dust_smoke = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.cf = LV_COLOR_FORMAT_RGB565A8,
-    .header.flags = 0,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
     .header.w = 100,
     .header.h = 100,
     .header.stride = 200,
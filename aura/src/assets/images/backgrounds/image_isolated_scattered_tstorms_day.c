@@ -26,2156 +26,372 @@ static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST
     LV_ATTRIBUTE_IMAGE_ISOLATED_SCATTERED_TSTORMS_DAY uint8_t
         image_isolated_scattered_tstorms_day_map[] = {
 
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xf5, 0x8b, 0xed,
-            0xa9, 0xfe, 0xc9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xaa, 0xfe,
-            0x8b, 0xed, 0xc8, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xa5, 0xaa, 0xfe, 0x68, 0xaa, 0x0a, 0xdd,
-            0xc9, 0xfe, 0x09, 0xff, 0x26, 0xff, 0xca, 0xfe, 0xea, 0xfe, 0xeb, 0xfe, 0xea, 0xfe,
-            0xc9, 0xfe, 0x45, 0xff, 0x09, 0xff, 0xc9, 0xfe, 0x0a, 0xdd, 0x68, 0xaa, 0xaa, 0xfe,
-            0xd2, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xa5, 0xe8, 0xfe, 0xc9, 0xfe,
-            0xe8, 0xfe, 0x0c, 0xee, 0xc9, 0xfe, 0xc9, 0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-            0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc9, 0xfe, 0xc9, 0xfe, 0xc9, 0xfe, 0x2c, 0xee,
-            0xe8, 0xfe, 0xca, 0xfe, 0xe8, 0xfe, 0xd2, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xf6, 0x6b, 0xf6,
-            0xe8, 0xfe, 0xea, 0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-            0xc8, 0xfe, 0xc8, 0xfe, 0xc9, 0xfe, 0xea, 0xfe, 0xe8, 0xfe, 0x6b, 0xf6, 0x8a, 0xf6,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfe,
-            0xe9, 0xfe, 0xe0, 0xff, 0xc9, 0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc9, 0xfe,
-            0xe0, 0xff, 0xe9, 0xfe, 0xe9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xa5, 0x1c, 0xf7,
-            0xb9, 0xe6, 0x3c, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x3c, 0xe7, 0x3d, 0xe7, 0x5d, 0xef, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x3c, 0xef,
-            0xda, 0xe6, 0x1b, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0xe9, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xca, 0xfe, 0xc9, 0xfe, 0xc9, 0xfe, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xef, 0xfb, 0xee,
-            0x5d, 0xef, 0x5d, 0xef, 0x61, 0xba, 0x3c, 0xef, 0x7d, 0xef, 0x5c, 0xef, 0x5c, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x3c, 0xef,
-            0x5d, 0xef, 0x3c, 0xef, 0xff, 0xf7, 0x5d, 0xef, 0x3c, 0xef, 0x37, 0xde, 0x78, 0xde,
-            0x00, 0x00, 0xe9, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xea, 0xfe,
-            0xe9, 0xfe, 0xc8, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xef, 0x1b, 0xe7,
-            0x5d, 0xef, 0x52, 0xe5, 0x5c, 0xef, 0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef,
-            0xff, 0xff, 0x5c, 0xef, 0x1d, 0xe7, 0xc9, 0xfe, 0xea, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc8, 0xfe, 0xea, 0xfe, 0xc9, 0xfe, 0xc9, 0xfe, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xe7, 0xba, 0xe6,
-            0x5d, 0xef, 0xba, 0xe6, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0xfb, 0xf7, 0x80, 0xfa, 0xc8, 0xfe,
-            0xa8, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xaf, 0xed, 0x8a, 0xfe,
-            0x8b, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xa5, 0x9e, 0xf7,
-            0x3c, 0xef, 0xff, 0xff, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0xcf, 0xf6, 0xa8, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc8, 0xfe, 0xe7, 0xfe, 0x95, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xe6,
-            0xff, 0xff, 0x5d, 0xef, 0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x39, 0xef, 0xcf, 0xf6, 0xa8, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe,
-            0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0x6b, 0xf6, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x1b, 0xef, 0x51, 0xd5, 0x7d, 0xef, 0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x14, 0xf7,
-            0xa9, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xe5, 0xfe,
-            0x11, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0xb9, 0xe6, 0xf5, 0xe5, 0xbe, 0xef, 0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x16, 0xf7, 0xab, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0xda, 0xe6, 0xff, 0xff, 0xbf, 0xf7, 0x5c, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x38, 0xef, 0xab, 0xfe,
-            0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xaf, 0xe5, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xad, 0xdf, 0xf7, 0x7d, 0xef, 0x3c, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x37, 0xef, 0xaa, 0xfe, 0x87, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0x25, 0xff,
-            0xd0, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xf7, 0x5c, 0xef,
-            0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x16, 0xf7, 0x89, 0xfe, 0x87, 0xfe,
-            0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0x4a, 0xf6, 0x69, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xe7,
-            0x3c, 0xef, 0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0xf3, 0xf6, 0x88, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0xb9, 0xe6, 0xff, 0xff, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5b, 0xef, 0xce, 0xf6, 0x87, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x7d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x38, 0xef, 0xa9, 0xfe,
-            0x87, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xe7, 0x78, 0xde, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0xf1, 0xf6, 0x87, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-            0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe,
-            0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe,
-            0xa7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xef, 0x5c, 0xef,
-            0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x39, 0xef, 0xaa, 0xfe, 0x87, 0xfe, 0xa7, 0xfe,
-            0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe,
-            0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe,
-            0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x1b, 0xef, 0xff, 0xff, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0xd0, 0xf6,
-            0x87, 0xfe, 0x87, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe,
-            0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe,
-            0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa8, 0xfe,
-            0xa8, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0xd2, 0xa5, 0x5c, 0xef, 0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x37, 0xef, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0xa9, 0xfe,
-            0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe,
-            0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0xa9, 0xfe, 0xa8, 0xfe, 0xa7, 0xfe, 0x86, 0xfe,
-            0x87, 0xfe, 0x2b, 0xe5, 0x09, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0x5d, 0xef, 0x3c, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5b, 0xef, 0x5b, 0xef, 0x5b, 0xef,
-            0x5b, 0xef, 0x5a, 0xef, 0x5a, 0xef, 0x5a, 0xef, 0x5a, 0xef, 0x5a, 0xef, 0x5a, 0xef,
-            0x5a, 0xef, 0x5a, 0xef, 0x5a, 0xef, 0x5a, 0xef, 0x5a, 0xef, 0x39, 0xef, 0x37, 0xef,
-            0x14, 0xf7, 0xf0, 0xf6, 0xcd, 0xf6, 0xe0, 0xff, 0x3c, 0xef, 0x1b, 0xe7, 0x7d, 0xef,
-            0xda, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xe6, 0xff, 0xff,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x3c, 0xef,
-            0x77, 0xde, 0x1c, 0xe7, 0x3e, 0xcf, 0xda, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x3c, 0xef, 0x1b, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0x1b, 0xe7, 0x3c, 0xe7, 0x78, 0xe6, 0xfb, 0xe6,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x5d, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef,
-            0xff, 0xf7, 0x1c, 0xef, 0x5c, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xef, 0x3c, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3b, 0xef, 0xf9, 0xee, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5c, 0xef, 0xff, 0xff, 0xfb, 0xe6, 0xba, 0xe6, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xef,
-            0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x95, 0xf6, 0x53, 0xee,
-            0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0xff, 0xff,
-            0x37, 0xde, 0xb0, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0xfa, 0xee,
-            0xcd, 0xfd, 0x32, 0xee, 0xfb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x3c, 0xef, 0x3c, 0xe7, 0x5d, 0xef, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xef, 0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x3c, 0xe7, 0x52, 0xf6, 0x89, 0xfd, 0x32, 0xee, 0xdb, 0xde, 0xdb, 0xde, 0xfb, 0xde,
-            0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0xfb, 0xe6, 0xfb, 0xe6, 0xba, 0xe6,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x3d, 0xe7, 0xb7, 0xee, 0xab, 0xfd, 0x89, 0xfd, 0x32, 0xee, 0xdb, 0xde,
-            0xdb, 0xde, 0xdb, 0xde, 0xfb, 0xde, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef,
-            0xff, 0xff, 0x99, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0x1b, 0xef, 0xee, 0xfd, 0x89, 0xfd, 0x89, 0xfd,
-            0x32, 0xee, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x3c, 0xe7, 0xfb, 0xe6, 0x1b, 0xe7, 0x37, 0xde, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x5d, 0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0x74, 0xf6, 0x8a, 0xfd,
-            0x89, 0xfd, 0x89, 0xfd, 0x32, 0xee, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xfb, 0xde,
-            0xfb, 0xde, 0x1c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0x5d, 0xef, 0xff, 0xff,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xef, 0x1c, 0xe7, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0xf8, 0xee,
-            0xcc, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x32, 0xee, 0xdb, 0xde, 0xdb, 0xde,
-            0xdb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef,
-            0x99, 0xe6, 0xfb, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xef,
-            0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xe7,
-            0x3b, 0xe7, 0x30, 0xf6, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x69, 0xfd, 0x12, 0xee,
-            0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7,
-            0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5c, 0xef, 0x3c, 0xe7, 0x3c, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x3c, 0xe7, 0x95, 0xee, 0x8a, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd,
-            0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x1c, 0xe7,
-            0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x1b, 0xe7, 0x3c, 0xe7, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xe6, 0xda, 0xe6, 0x5c, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xe7, 0xfa, 0xee, 0xcd, 0xfd, 0x89, 0xfd, 0x89, 0xfd,
-            0x89, 0xfd, 0x89, 0xfd, 0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde,
-            0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7,
-            0x3c, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xde, 0x7e, 0xef,
-            0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xe7, 0x3c, 0xe7, 0x52, 0xf6, 0x89, 0xfd,
-            0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6,
-            0xdb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0xda, 0xe6, 0x3c, 0xe7, 0xfb, 0xe6, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xe7, 0xd7, 0xee,
-            0xab, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x69, 0xfd,
-            0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7,
-            0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0x5d, 0xef, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xe7, 0xfb, 0xe6, 0x3c, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7,
-            0x1b, 0xef, 0xee, 0xfd, 0x69, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd,
-            0x89, 0xfd, 0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x1c, 0xe7,
-            0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xde, 0x7e, 0xef,
-            0x1b, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x3c, 0xe7, 0x74, 0xf6, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd,
-            0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde,
-            0xfb, 0xde, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x3c, 0xef, 0x3c, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x78, 0xde, 0xdb, 0xe6, 0xda, 0xde, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xe7, 0xf8, 0xee, 0xcc, 0xfd, 0x89, 0xfd, 0x89, 0xfd,
-            0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x69, 0xfd, 0x12, 0xee,
-            0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x3c, 0xef, 0x1b, 0xe7, 0x3c, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xd6, 0xbf, 0xf7, 0x1b, 0xe7, 0x3c, 0xe7,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3b, 0xef, 0x30, 0xf6, 0x89, 0xfd,
-            0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd,
-            0x68, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x1c, 0xe7,
-            0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0x1c, 0xe7, 0x3c, 0xe7, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xd6, 0xfb, 0xe6,
-            0xda, 0xe6, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xe7, 0x95, 0xee,
-            0x8a, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd,
-            0x89, 0xfd, 0x89, 0xfd, 0x68, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde,
-            0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0x1b, 0xe7,
-            0x1c, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x20, 0x8a, 0xfb, 0xde, 0xdb, 0xde, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xe7,
-            0xfa, 0xee, 0xcd, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd,
-            0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x68, 0xfd, 0x12, 0xee, 0xdb, 0xd6,
-            0xdb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7,
-            0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7,
-            0x1c, 0xe7, 0x9e, 0xef, 0x37, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xde, 0xda, 0xe6, 0xff, 0xe7, 0x1c, 0xe7,
-            0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x52, 0xf6, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd,
-            0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x69, 0xfd, 0x68, 0xfd,
-            0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7,
-            0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x3c, 0xe7, 0xfb, 0xe6, 0x1b, 0xe7, 0x79, 0xe6, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xe6,
-            0xda, 0xe6, 0x78, 0xde, 0x1c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x3c, 0xe7, 0x3d, 0xe7, 0xd7, 0xee, 0xab, 0xfd, 0x89, 0xfd, 0x89, 0xfd,
-            0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x11, 0xee, 0xb9, 0xde, 0xb9, 0xde, 0xd9, 0xe6, 0xda, 0xe6,
-            0xfa, 0xe6, 0xfa, 0xe6, 0xfa, 0xe6, 0xfa, 0xe6, 0xfa, 0xe6, 0xfa, 0xe6, 0xfa, 0xe6,
-            0xfa, 0xe6, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0x1b, 0xe7, 0x73, 0xc5, 0xb9, 0xde, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0xfb, 0xe6, 0xdb, 0xe6, 0xba, 0xde, 0x1c, 0xe7, 0x3c, 0xe7,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0x1b, 0xef, 0xee, 0xfd, 0x89, 0xfd,
-            0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x8a, 0xfd, 0xac, 0xfd, 0xac, 0xfd,
-            0xac, 0xfd, 0xac, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd, 0xcc, 0xfd,
-            0xcc, 0xfd, 0xab, 0xfd, 0x32, 0xf6, 0x1b, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7,
-            0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0xba, 0xde, 0xdb, 0xde,
-            0xfb, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xde, 0x1c, 0xe7, 0xdb, 0xde,
-            0xba, 0xde, 0x1c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x3c, 0xe7, 0x3c, 0xe7, 0x73, 0xf6,
-            0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x89, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x8a, 0xfd, 0x97, 0xe6, 0xfc, 0xde, 0x1c, 0xe7,
-            0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7, 0x1b, 0xe7,
-            0xbf, 0xef, 0x78, 0xde, 0xd2, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0xda, 0xe6, 0xfb, 0xde, 0xfb, 0xe6, 0xda, 0xe6, 0xfb, 0xe6, 0x3c, 0xe7, 0x3c, 0xe7,
-            0xd8, 0xee, 0xac, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x68, 0xfd, 0x69, 0xfd, 0x12, 0xee, 0xdb, 0xde,
-            0xfb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xe7,
-            0xfb, 0xe6, 0x37, 0xde, 0xba, 0xde, 0xba, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xe6, 0x1c, 0xe7, 0xfb, 0xe6, 0x98, 0xe6,
-            0xdb, 0xde, 0xfb, 0xe6, 0x30, 0xf6, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0xcd, 0xf5,
-            0xb9, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xfb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x1c, 0xe7,
-            0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x3c, 0xe7, 0x1b, 0xe7, 0x9a, 0xde, 0xba, 0xde, 0xda, 0xde, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0xfb, 0xe6, 0xda, 0xde, 0x2f, 0xfe, 0xee, 0xf5, 0x8a, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x8a, 0xfd, 0x56, 0xe6, 0xbb, 0xd6, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xfb, 0xde,
-            0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x1c, 0xe7, 0xfb, 0xde, 0x59, 0xd6, 0x9a, 0xde, 0xba, 0xde, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0xc8, 0xe4, 0x6a, 0xfd, 0x8a, 0xfd, 0x89, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0xf0, 0xed, 0xba, 0xd6, 0xba, 0xd6, 0xdb, 0xde, 0xdb, 0xde,
-            0xfb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x3c, 0xe7, 0x1b, 0xe7, 0xdb, 0xde, 0x07, 0xab, 0x99, 0xde, 0x9a, 0xd6,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xe4, 0x08, 0x8b, 0x89, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0xac, 0xf5, 0x98, 0xde, 0xba, 0xd6, 0xba, 0xd6,
-            0xdb, 0xde, 0xdb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0xdb, 0xde, 0x9a, 0xd6, 0x1c, 0xdf, 0x79, 0xde,
-            0x78, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xa5, 0x8a, 0xfd, 0x6a, 0xfd,
-            0x6a, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x69, 0xfd, 0x13, 0xe6, 0x9a, 0xd6,
-            0x9a, 0xd6, 0x9a, 0xd6, 0xba, 0xd6, 0xdb, 0xde, 0xdb, 0xde, 0xfb, 0xde, 0xfb, 0xde,
-            0xfb, 0xde, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7,
-            0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7,
-            0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x3c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7,
-            0x1c, 0xe7, 0xfb, 0xe6, 0xfb, 0xe6, 0xdb, 0xde, 0xba, 0xde, 0x7e, 0xef, 0xba, 0xde,
-            0x1c, 0xdf, 0x58, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xdd,
-            0xaa, 0xfd, 0xaa, 0xfd, 0x89, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x4a, 0xf5,
-            0x37, 0xce, 0x59, 0xce, 0x59, 0xce, 0x59, 0xce, 0x79, 0xce, 0x79, 0xd6, 0x99, 0xd6,
-            0x9a, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6,
-            0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6,
-            0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6,
-            0xba, 0xd6, 0xdb, 0xde, 0xdb, 0xe6, 0x79, 0xde, 0xf6, 0xcd, 0xfb, 0xde, 0xda, 0xde,
-            0x1e, 0xef, 0xf2, 0xad, 0xd2, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x8b, 0xfe, 0xee, 0x7d, 0xc8, 0xfd, 0x8a, 0xfd, 0x89, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x48, 0xfd, 0x08, 0xf5, 0xd2, 0xdd, 0x59, 0xc6, 0x38, 0xc6, 0x38, 0xc6, 0x59, 0xce,
-            0x79, 0xce, 0x79, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0x9a, 0xd6, 0xba, 0xd6, 0xba, 0xd6,
-            0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6,
-            0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6,
-            0xba, 0xd6, 0xba, 0xd6, 0xba, 0xd6, 0xdb, 0xde, 0xdb, 0xe6, 0x99, 0xde, 0x98, 0xde,
-            0xdb, 0xe6, 0xdb, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x2a, 0xfd, 0x6a, 0xfd, 0xaa, 0xfd, 0x89, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd, 0x69, 0xfd,
-            0x69, 0xfd, 0x69, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x28, 0xfd, 0xc8, 0xfd, 0x10, 0x22, 0x2b, 0xed, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x9d, 0xfc, 0x46, 0x5f, 0x2f,
-            0x5f, 0x2f, 0x7f, 0x27, 0xd2, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xfd, 0x8b, 0xf5, 0x89, 0xfd,
-            0x69, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x48, 0xfd, 0xc8, 0xec, 0xe8, 0xec, 0xc8, 0xe4,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x2f, 0x3f, 0x3f,
-            0x5f, 0x1f, 0x7f, 0x37, 0x9f, 0x57, 0x5f, 0x2f, 0x5f, 0x27, 0x3f, 0x2f, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xfd,
-            0x6a, 0xfd, 0x29, 0xfd, 0x28, 0xfd, 0x28, 0xfd, 0x28, 0xfd, 0x28, 0xfd, 0x28, 0xfd,
-            0x28, 0xfd, 0x28, 0xfd, 0x28, 0xfd, 0x28, 0xfd, 0x28, 0xfd, 0x28, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x48, 0xfd, 0x28, 0xfd,
-            0xc6, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x2f,
-            0x5f, 0x37, 0x5f, 0x0f, 0x5f, 0x2f, 0x5f, 0x1f, 0x5f, 0x1f, 0x5f, 0x3f, 0x5f, 0x27,
-            0x5f, 0x07, 0x5f, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x6a, 0xfd, 0x6a, 0xfd, 0x49, 0xfd, 0x48, 0xfd, 0x48, 0xfd, 0x48, 0xfd,
-            0x28, 0xfd, 0x28, 0xfd, 0x28, 0xfd, 0x28, 0xfd, 0x28, 0xfd, 0x28, 0xfd, 0x48, 0xfd,
-            0xa9, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x48, 0xfd,
-            0x49, 0x82, 0xe9, 0xec, 0xd2, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x5f, 0x2f, 0x5f, 0x37, 0xbf, 0x77, 0x5f, 0x27, 0x3f, 0x17, 0x3f, 0x07, 0x3f, 0x0f,
-            0x3f, 0x1f, 0x5f, 0x2f, 0x5f, 0x27, 0x3f, 0x0f, 0x7f, 0x2f, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x48, 0xfd, 0x08, 0xf5, 0x28, 0xf5, 0xe8, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x5f, 0x2f, 0x5f, 0x37, 0xbf, 0x6f, 0x5f, 0x1f, 0x3f, 0x0f, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x17, 0x5f, 0x2f, 0x3f, 0x1f, 0xff, 0x06,
-            0x7f, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x28, 0xf5, 0x48, 0xfd, 0x80, 0xfe, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x3f, 0x2f, 0x5f, 0x37, 0x5f, 0x0f, 0x5f, 0x1f, 0x3f, 0x0f,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x17,
-            0x5f, 0x2f, 0x5f, 0x27, 0x5f, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x48, 0xfd, 0x49, 0xed, 0x48, 0xf5, 0x0a, 0xdd,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x27, 0x5f, 0x1f, 0x5f, 0x27,
-            0x3f, 0x0f, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x5f, 0x17, 0xff, 0xbf, 0x5f, 0x27, 0x7f, 0x17, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x48, 0xfd, 0x08, 0xf5, 0x28, 0xfd,
-            0x08, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x2f,
-            0xdf, 0xaf, 0x3f, 0x17, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x0f, 0x5f, 0x1f, 0x5f, 0x1f,
-            0x5f, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x28, 0xfd,
-            0xc7, 0xfd, 0xc8, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x3f, 0x17, 0x5f, 0x1f, 0x3f, 0x0f, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x0f, 0x1f, 0x07, 0x5f, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x48, 0xfd, 0xe8, 0xec, 0x08, 0xf5, 0xc8, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x0f, 0x3f, 0x0f, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x17, 0x3f, 0x0f, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x48, 0xfd, 0x68, 0xfd, 0xa2, 0xff, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x07, 0x1f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x1f, 0x07, 0x1f, 0x07,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x28, 0xfd, 0x49, 0xbc, 0x08, 0xed, 0x8f, 0xbd,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x1f, 0x07, 0x1f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x1f, 0x07, 0x1f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x48, 0xfd, 0x08, 0xf5, 0x08, 0xf5,
-            0xe6, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x1f, 0x07, 0xff, 0x06, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x1f, 0x07, 0xbe, 0x06, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x48, 0xfd, 0x28, 0xf5,
-            0x48, 0xfd, 0xe8, 0xec, 0xb0, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0xff, 0x06, 0x1f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x1f, 0x07, 0x1f, 0x07, 0xdf, 0x0e, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x48, 0xfd, 0xe8, 0xe4, 0x08, 0xed, 0x08, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x06,
-            0x1f, 0x07, 0xdf, 0x06, 0x1f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0xff, 0x06, 0xbf, 0x06, 0xdf, 0x06,
-            0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x48, 0xfd, 0x28, 0xf5, 0x08, 0xf5, 0x27, 0xf4, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0xdf, 0x06, 0xbf, 0x06, 0x3e, 0x06, 0xff, 0x06, 0x1f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x1f, 0x07, 0xff, 0x06, 0xdf, 0x06,
-            0xdf, 0x06, 0x3f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x28, 0xfd, 0xa6, 0xfd, 0x4b, 0xe5, 0xc9, 0xf5,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x06, 0xbf, 0x06, 0xff, 0x0f,
-            0xdf, 0x06, 0xdf, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xdf, 0x06,
-            0xbf, 0x06, 0xdf, 0x06, 0x9f, 0x0f, 0xbf, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xfd,
-            0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x48, 0xfd, 0xe8, 0xf4, 0x08, 0xf5,
-            0x29, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0xdf, 0x06, 0xbf, 0x06, 0xdf, 0x06, 0x3a, 0x4c, 0xbe, 0x06, 0x9e, 0x06, 0xbe, 0x06,
-            0xbf, 0x06, 0xff, 0x06, 0xdf, 0x06, 0xff, 0x06, 0xbf, 0x06, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x48, 0xfd, 0x28, 0xf5,
-            0x68, 0xfd, 0x28, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x17, 0x9f, 0x06, 0xdf, 0x06, 0xdf, 0x06,
-            0xbf, 0x06, 0xbf, 0x06, 0xdf, 0x06, 0xff, 0x16, 0x3f, 0x0f, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xfd, 0x68, 0xfd, 0x68, 0xfd, 0x48, 0xfd,
-            0x48, 0xfd, 0xf8, 0x07, 0x69, 0xed, 0xa7, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0xd2, 0xa5, 0x9f, 0x1f, 0x5f, 0x2f, 0x5f, 0x2f, 0x9f, 0x1f,
-            0xd2, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xfd, 0x68, 0xfd,
-            0x68, 0xfd, 0x48, 0xfd, 0x08, 0xf5, 0x28, 0xf5, 0xc9, 0xf5, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x2f, 0x3f, 0x47, 0x5f, 0x17, 0x5f, 0x2f,
-            0x5f, 0x2f, 0x5f, 0x17, 0x3f, 0x47, 0x3f, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x68, 0xfd, 0x68, 0xfd, 0x48, 0xfd, 0x28, 0xfd, 0x48, 0xfd, 0x47, 0xfd, 0xb0, 0xe5,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x2f, 0x5f, 0x37, 0x3f, 0x0f,
-            0x5f, 0x27, 0x3f, 0x17, 0x3f, 0x17, 0x5f, 0x27, 0x3f, 0x0f, 0x5f, 0x37, 0x5f, 0x2f,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x48, 0xfd, 0x48, 0xfd, 0x28, 0xfd, 0xe8, 0xec, 0xc8, 0xec,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x2f, 0x5f, 0x37,
-            0x9f, 0x7f, 0x5f, 0x27, 0x3f, 0x0f, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x0f, 0x5f, 0x27,
-            0x9f, 0x7f, 0x5f, 0x37, 0x7f, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xf5, 0x69, 0xf5, 0x89, 0xf5,
-            0x05, 0xec, 0xa7, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x17,
-            0x7f, 0x37, 0xdf, 0x04, 0x5f, 0x1f, 0x3f, 0x0f, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x0f, 0x5f, 0x1f, 0xdf, 0x04, 0x7f, 0x37, 0x7f, 0x17, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xf5,
-            0xa9, 0xf5, 0xa9, 0xf5, 0xa9, 0xf5, 0xd2, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x3f, 0x17, 0x3f, 0x0f, 0x5f, 0x1f, 0x3f, 0x0f, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x0f, 0x5f, 0x1f, 0x3f, 0x0f,
-            0x3f, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x7f, 0x17, 0x5f, 0x27, 0x5f, 0x27, 0x3f, 0x0f, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x0f, 0x5f, 0x27, 0x5f, 0x27, 0x7f, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1f, 0x1f, 0x07, 0x5f, 0x17,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x5f, 0x17, 0x1f, 0x07, 0x3f, 0x1f, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x1f,
-            0x5f, 0x1f, 0x3f, 0x0f, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x0f, 0x5f, 0x1f,
-            0x5f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x3f, 0x0f, 0x3f, 0x0f, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x0f, 0x3f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x07, 0x1f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x1f, 0x07, 0x1f, 0x07, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x07, 0x1f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x1f, 0x07, 0x1f, 0x07,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0xdf, 0x06, 0xdf, 0x06, 0x1f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x1f, 0x07,
-            0xdf, 0x06, 0xdf, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x1e, 0x06, 0x3f, 0x07, 0xff, 0x06, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0xff, 0x06, 0x3f, 0x07, 0x1e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x17, 0xdf, 0x06, 0xbf, 0x06,
-            0xff, 0x06, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x3f, 0x07, 0xff, 0x06, 0xbf, 0x06, 0xdf, 0x06, 0x7f, 0x17, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0xdf, 0x06, 0xff, 0x06, 0xdf, 0x06, 0xff, 0x06, 0x1f, 0x07, 0x1f, 0x07, 0x3f, 0x07,
-            0x3f, 0x07, 0x1f, 0x07, 0x1f, 0x07, 0xff, 0x06, 0xdf, 0x06, 0xff, 0x06, 0xdf, 0x06,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x07, 0xdf, 0x06, 0x9e, 0x06, 0xbf, 0x06,
-            0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xff, 0x06, 0xbf, 0x06, 0x9e, 0x06, 0xdf, 0x06,
-            0x1f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x06, 0xbe, 0x06,
-            0xbe, 0x06, 0xbf, 0x06, 0xdd, 0x0d, 0x5e, 0x06, 0x5e, 0x06, 0xdd, 0x0d, 0xbf, 0x06,
-            0xbe, 0x06, 0xbe, 0x06, 0xbf, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0xbf, 0x06, 0xdf, 0x0e, 0xdf, 0x06, 0xbf, 0x06, 0xbf, 0x06,
-            0xdf, 0x06, 0xdf, 0x0e, 0xbf, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x03, 0x06, 0x08, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x02, 0x20, 0x50, 0x71, 0x99, 0xb5, 0xc6, 0xbc, 0x9e, 0x74, 0x50, 0x20,
-            0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x08, 0x43, 0x9b, 0xd7, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xfa, 0xd7, 0x9b, 0x43, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x34, 0xa5, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xa5, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x09, 0x6c, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x68, 0x08, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x33, 0x4b,
-            0x6f, 0x88, 0x99, 0xa4, 0x9d, 0x8c, 0x6a, 0x48, 0x2f, 0x13, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x10, 0x8a, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x89,
-            0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1e, 0x57, 0x9c, 0xc8,
-            0xf1, 0xf8, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xec, 0xc1, 0x93, 0x48,
-            0x15, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x8e, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xfb, 0x8e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x89, 0xd4, 0xf9,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xf4, 0xc7, 0x79, 0x23, 0x00, 0x01, 0x76, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xf8, 0x76, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x8e, 0xe3, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xd5, 0x74, 0x5e, 0xe9, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x65, 0xd5, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf4, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x14, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x99, 0xf7,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x65,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xbe,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xbd, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-            0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xf2, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x29, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x1c, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0x06, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x09, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0x19, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x5f, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x2d,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xf5, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xec, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xde, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xda, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xcc, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0x01, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d,
-            0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x81, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x88,
-            0x32, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x10, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xe2, 0x7f, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x27, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x4b, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xf8, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x45,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xfd, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xd3, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xab, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x15, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x6f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x54, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0x9f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xef, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xd8, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xd9, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xf1, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xa9,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x33, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xf8, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xfc, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xc0, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xf4, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d,
-            0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xe8, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x0c, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x34, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x28, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x84, 0xfb, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0x02, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x94,
-            0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x21,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x0e, 0x8f, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee,
-            0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x0a, 0x7e, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xf6, 0x76, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x53, 0xd5, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xf6, 0x81, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xfc, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xe9, 0x6f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xc4,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xfd, 0xc0, 0x45, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-            0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xf8, 0xc8, 0x6c, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x3d, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xf4, 0xde, 0xc9, 0x96, 0x50, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x0e, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xa6, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
-            0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
-            0x58, 0x57, 0x47, 0x29, 0x0e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x68, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xd4, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xf8, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xac, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x09, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x71, 0x81, 0x7f, 0x80, 0x80,
-            0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x84, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x33, 0xa6, 0x73, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc7, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x7d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x01, 0x49, 0xd6, 0xff, 0xfa, 0x93, 0x16, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc8, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x18, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x01, 0x5b, 0xe5, 0xff, 0xff, 0xff, 0xfe, 0xaa, 0x1c, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc8,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x4d, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0x9f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x08, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0x06, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xfb, 0x72, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x08, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x27,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x82, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x08, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-            0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xd7, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xac, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xf5,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x0d, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc8, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xe3, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x1a,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc8, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xfd, 0x7c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x6f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xd3, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc8,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x3c, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xa0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x08, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xef, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xf7, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x08, 0xc8, 0xff, 0xff, 0xff, 0xff, 0x94, 0x06, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xe8, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x08, 0xc8, 0xff, 0xff, 0xff, 0xd4, 0x26, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x59, 0xde,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xa6, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc8, 0xff, 0xff, 0xf8, 0x63, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x31, 0x8c, 0xc6, 0xea, 0xdc, 0xac, 0x60, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc8, 0xff, 0xff, 0xac, 0x0d,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x26, 0x20, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc8, 0xff, 0xe4,
-            0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc9,
-            0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x08, 0xcb, 0xc6, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x09, 0xb9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xbf, 0xbf, 0x39, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x09, 0x5e, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x51, 0xdb, 0xff, 0xff, 0xdb,
-            0x51, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xe8, 0xff, 0xff,
-            0xff, 0xff, 0xe8, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xe2, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xc0,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x17, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x68, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x68, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x0d, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc,
-            0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x30, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xe5, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xfa, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xc3, 0xff, 0xff, 0xff,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xfd,
-            0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x71, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x12, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0x12, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x1a, 0x9b, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x9b, 0x1a, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x45, 0x87, 0xbd, 0xbd, 0x87, 0x45, 0x08,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x07, 0x01,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0x00, 0x00, 0x00, 0xf2, 0x14, 0x00, 0x00, 0x30, 0x75, 0x00, 0x00, 0x7f, 0x00, 0x00,
+        0x7f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x84, 0xc8, 0xf5, 0x8b, 0xed, 0xa9, 0xfe, 0xc9, 0xfe,
+        0x03, 0xe9, 0xfe, 0x84, 0xc8, 0xfe, 0xaa, 0xfe, 0x8b, 0xed, 0xc8, 0xf5, 0x55, 0x00, 0x00,
+        0x93, 0xd2, 0xa5, 0xaa, 0xfe, 0x68, 0xaa, 0x0a, 0xdd, 0xc9, 0xfe, 0x09, 0xff, 0x26, 0xff,
+        0xca, 0xfe, 0xea, 0xfe, 0xeb, 0xfe, 0xea, 0xfe, 0xc9, 0xfe, 0x45, 0xff, 0x09, 0xff, 0xc9,
+        0xfe, 0x0a, 0xdd, 0x68, 0xaa, 0xaa, 0xfe, 0xd2, 0xa5, 0x50, 0x00, 0x00, 0x85, 0xd2, 0xa5,
+        0xe8, 0xfe, 0xc9, 0xfe, 0xe8, 0xfe, 0x0c, 0xee, 0x03, 0xc9, 0xfe, 0x02, 0xc8, 0xfe, 0x81,
+        0xe8, 0xfe, 0x02, 0xc8, 0xfe, 0x03, 0xc9, 0xfe, 0x85, 0x2c, 0xee, 0xe8, 0xfe, 0xca, 0xfe,
+        0xe8, 0xfe, 0xd2, 0xa5, 0x4e, 0x00, 0x00, 0x85, 0x8a, 0xf6, 0x6b, 0xf6, 0xe8, 0xfe, 0xea,
+        0xfe, 0xc9, 0xfe, 0x04, 0xc8, 0xfe, 0x05, 0xc7, 0xfe, 0x04, 0xc8, 0xfe, 0x85, 0xc9, 0xfe,
+        0xea, 0xfe, 0xe8, 0xfe, 0x6b, 0xf6, 0x8a, 0xf6, 0x4c, 0x00, 0x00, 0x02, 0xe9, 0xfe, 0x81,
+        0xe0, 0xff, 0x02, 0xc9, 0xfe, 0x02, 0xc8, 0xfe, 0x0c, 0xc7, 0xfe, 0x02, 0xc8, 0xfe, 0x82,
+        0xc9, 0xfe, 0xe0, 0xff, 0x02, 0xe9, 0xfe, 0x33, 0x00, 0x00, 0x84, 0xd2, 0xa5, 0x1c, 0xf7,
+        0xb9, 0xe6, 0x3c, 0xef, 0x03, 0x7d, 0xef, 0x02, 0x5d, 0xef, 0x84, 0x3c, 0xe7, 0x3d, 0xe7,
+        0x5d, 0xef, 0x7e, 0xef, 0x02, 0x7d, 0xef, 0x83, 0x3c, 0xef, 0xda, 0xe6, 0x1b, 0xf7, 0x05,
+        0x00, 0x00, 0x02, 0xe9, 0xfe, 0x82, 0xea, 0xfe, 0xc9, 0xfe, 0x02, 0xc8, 0xfe, 0x10, 0xc7,
+        0xfe, 0x02, 0xc8, 0xfe, 0x81, 0xca, 0xfe, 0x02, 0xc9, 0xfe, 0x30, 0x00, 0x00, 0x82, 0x1b,
+        0xef, 0xfb, 0xee, 0x02, 0x5d, 0xef, 0x83, 0x61, 0xba, 0x3c, 0xef, 0x7d, 0xef, 0x02, 0x5c,
+        0xef, 0x02, 0x5d, 0xef, 0x02, 0x7d, 0xef, 0x8b, 0x5d, 0xef, 0x5c, 0xef, 0x3c, 0xef, 0x5d,
+        0xef, 0x3c, 0xef, 0xff, 0xf7, 0x5d, 0xef, 0x3c, 0xef, 0x37, 0xde, 0x78, 0xde, 0x00, 0x00,
+        0x02, 0xe9, 0xfe, 0x83, 0xea, 0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0x14, 0xc7, 0xfe, 0x84, 0xc8,
+        0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0x2d, 0x00, 0x00, 0x86, 0x3c, 0xef, 0x1b, 0xe7,
+        0x5d, 0xef, 0x52, 0xe5, 0x5c, 0xef, 0x3c, 0xef, 0x10, 0x5d, 0xef, 0x86, 0x3c, 0xef, 0xff,
+        0xff, 0x5c, 0xef, 0x1d, 0xe7, 0xc9, 0xfe, 0xea, 0xfe, 0x02, 0xc8, 0xfe, 0x16, 0xc7, 0xfe,
+        0x82, 0xc8, 0xfe, 0xea, 0xfe, 0x02, 0xc9, 0xfe, 0x2a, 0x00, 0x00, 0x85, 0x1b, 0xe7, 0xba,
+        0xe6, 0x5d, 0xef, 0xba, 0xe6, 0x5c, 0xef, 0x15, 0x5d, 0xef, 0x86, 0x5c, 0xef, 0xfb, 0xf7,
+        0x80, 0xfa, 0xc8, 0xfe, 0xa8, 0xfe, 0xa7, 0xfe, 0x17, 0xc7, 0xfe, 0x84, 0xc8, 0xfe, 0xaf,
+        0xed, 0x8a, 0xfe, 0x8b, 0xfe, 0x27, 0x00, 0x00, 0x85, 0xd2, 0xa5, 0x9e, 0xf7, 0x3c, 0xef,
+        0xff, 0xff, 0x5c, 0xef, 0x19, 0x5d, 0xef, 0x82, 0xcf, 0xf6, 0xa8, 0xfe, 0x03, 0xa7, 0xfe,
+        0x17, 0xc7, 0xfe, 0x83, 0xc8, 0xfe, 0xe7, 0xfe, 0x95, 0xf5, 0x26, 0x00, 0x00, 0x84, 0xd9,
+        0xe6, 0xff, 0xff, 0x5d, 0xef, 0x3c, 0xef, 0x1b, 0x5d, 0xef, 0x83, 0x39, 0xef, 0xcf, 0xf6,
+        0xa8, 0xfe, 0x03, 0xa7, 0xfe, 0x17, 0xc7, 0xfe, 0x83, 0xc9, 0xfe, 0xc8, 0xfe, 0x6b, 0xf6,
+        0x24, 0x00, 0x00, 0x84, 0x1b, 0xef, 0x51, 0xd5, 0x7d, 0xef, 0x3c, 0xef, 0x1d, 0x5d, 0xef,
+        0x83, 0x5c, 0xef, 0x14, 0xf7, 0xa9, 0xfe, 0x03, 0xa7, 0xfe, 0x16, 0xc7, 0xfe, 0x83, 0xc8,
+        0xfe, 0xe5, 0xfe, 0x11, 0xe6, 0x23, 0x00, 0x00, 0x84, 0xb9, 0xe6, 0xf5, 0xe5, 0xbe, 0xef,
+        0x3c, 0xef, 0x20, 0x5d, 0xef, 0x82, 0x16, 0xf7, 0xab, 0xfe, 0x03, 0xa7, 0xfe, 0x16, 0xc7,
+        0xfe, 0x02, 0xa9, 0xfe, 0x22, 0x00, 0x00, 0x84, 0xda, 0xe6, 0xff, 0xff, 0xbf, 0xf7, 0x5c,
+        0xef, 0x22, 0x5d, 0xef, 0x82, 0x38, 0xef, 0xab, 0xfe, 0x03, 0xa7, 0xfe, 0x15, 0xc7, 0xfe,
+        0x83, 0xc8, 0xfe, 0xc7, 0xfe, 0xaf, 0xe5, 0x20, 0x00, 0x00, 0x84, 0xf2, 0xad, 0xdf, 0xf7,
+        0x7d, 0xef, 0x3c, 0xef, 0x24, 0x5d, 0xef, 0x83, 0x37, 0xef, 0xaa, 0xfe, 0x87, 0xfe, 0x02,
+        0xa7, 0xfe, 0x14, 0xc7, 0xfe, 0x83, 0xc8, 0xfe, 0x25, 0xff, 0xd0, 0xdc, 0x20, 0x00, 0x00,
+        0x83, 0x5d, 0xf7, 0x5c, 0xef, 0x3c, 0xef, 0x26, 0x5d, 0xef, 0x83, 0x16, 0xf7, 0x89, 0xfe,
+        0x87, 0xfe, 0x02, 0xa7, 0xfe, 0x14, 0xc7, 0xfe, 0x82, 0x4a, 0xf6, 0x69, 0xf6, 0x1f, 0x00,
+        0x00, 0x81, 0x1c, 0xe7, 0x02, 0x3c, 0xef, 0x28, 0x5d, 0xef, 0x82, 0xf3, 0xf6, 0x88, 0xfe,
+        0x02, 0xa7, 0xfe, 0x14, 0xc7, 0xfe, 0x02, 0xc8, 0xfe, 0x1f, 0x00, 0x00, 0x83, 0xb9, 0xe6,
+        0xff, 0xff, 0x5c, 0xef, 0x28, 0x5d, 0xef, 0x83, 0x5b, 0xef, 0xce, 0xf6, 0x87, 0xfe, 0x02,
+        0xa7, 0xfe, 0x13, 0xc7, 0xfe, 0x02, 0xc8, 0xfe, 0x1e, 0x00, 0x00, 0x83, 0x7d, 0xef, 0x5d,
+        0xef, 0x5c, 0xef, 0x2a, 0x5d, 0xef, 0x83, 0x38, 0xef, 0xa9, 0xfe, 0x87, 0xfe, 0x02, 0xa7,
+        0xfe, 0x14, 0xc7, 0xfe, 0x1e, 0x00, 0x00, 0x82, 0x1c, 0xe7, 0x78, 0xde, 0x2c, 0x5d, 0xef,
+        0x82, 0xf1, 0xf6, 0x87, 0xfe, 0x02, 0xa7, 0xfe, 0x06, 0xc7, 0xfe, 0x0b, 0xa7, 0xfe, 0x81,
+        0xc7, 0xfe, 0x02, 0xc8, 0xfe, 0x1d, 0x00, 0x00, 0x81, 0x3c, 0xef, 0x02, 0x5c, 0xef, 0x2c,
+        0x5d, 0xef, 0x83, 0x39, 0xef, 0xaa, 0xfe, 0x87, 0xfe, 0x12, 0xa7, 0xfe, 0x83, 0xc7, 0xfe,
+        0xc9, 0xfe, 0xc8, 0xfe, 0x1d, 0x00, 0x00, 0x82, 0x1b, 0xef, 0xff, 0xff, 0x2d, 0x5d, 0xef,
+        0x82, 0x5c, 0xef, 0xd0, 0xf6, 0x02, 0x87, 0xfe, 0x12, 0xa7, 0xfe, 0x02, 0xa8, 0xfe, 0x1c,
+        0x00, 0x00, 0x83, 0xd2, 0xa5, 0x5c, 0xef, 0x3c, 0xef, 0x2e, 0x5d, 0xef, 0x81, 0x37, 0xef,
+        0x04, 0xaa, 0xfe, 0x0c, 0xa9, 0xfe, 0x86, 0xa8, 0xfe, 0xa7, 0xfe, 0x86, 0xfe, 0x87, 0xfe,
+        0x2b, 0xe5, 0x09, 0xf6, 0x1c, 0x00, 0x00, 0x83, 0x1d, 0xff, 0x5d, 0xef, 0x3c, 0xef, 0x2e,
+        0x5d, 0xef, 0x81, 0x5c, 0xef, 0x04, 0x5b, 0xef, 0x0b, 0x5a, 0xef, 0x8a, 0x39, 0xef, 0x37,
+        0xef, 0x14, 0xf7, 0xf0, 0xf6, 0xcd, 0xf6, 0xe0, 0xff, 0x3c, 0xef, 0x1b, 0xe7, 0x7d, 0xef,
+        0xda, 0xe6, 0x19, 0x00, 0x00, 0x82, 0xb9, 0xe6, 0xff, 0xff, 0x42, 0x5d, 0xef, 0x02, 0x5c,
+        0xef, 0x86, 0x5d, 0xef, 0x3c, 0xef, 0x77, 0xde, 0x1c, 0xe7, 0x3e, 0xcf, 0xda, 0xee, 0x18,
+        0x00, 0x00, 0x82, 0x3c, 0xef, 0x1b, 0xe7, 0x46, 0x5d, 0xef, 0x85, 0x3c, 0xef, 0x1b, 0xe7,
+        0x3c, 0xe7, 0x78, 0xe6, 0xfb, 0xe6, 0x17, 0x00, 0x00, 0x82, 0x5d, 0xef, 0x5c, 0xef, 0x48,
+        0x5d, 0xef, 0x84, 0x3c, 0xef, 0xff, 0xf7, 0x1c, 0xef, 0x5c, 0xef, 0x16, 0x00, 0x00, 0x82,
+        0x5d, 0xef, 0x3c, 0xef, 0x19, 0x5d, 0xef, 0x82, 0x3b, 0xef, 0xf9, 0xee, 0x04, 0x3c, 0xe7,
+        0x2a, 0x5d, 0xef, 0x84, 0x5c, 0xef, 0xff, 0xff, 0xfb, 0xe6, 0xba, 0xe6, 0x15, 0x00, 0x00,
+        0x82, 0x5d, 0xef, 0x3c, 0xef, 0x18, 0x5d, 0xef, 0x84, 0x5d, 0xe7, 0x95, 0xf6, 0x53, 0xee,
+        0x1c, 0xe7, 0x04, 0x3c, 0xe7, 0x2a, 0x5d, 0xef, 0x84, 0x3c, 0xef, 0xff, 0xff, 0x37, 0xde,
+        0xb0, 0xe5, 0x14, 0x00, 0x00, 0x19, 0x5d, 0xef, 0x84, 0x5d, 0xe7, 0xfa, 0xee, 0xcd, 0xfd,
+        0x32, 0xee, 0x02, 0xfb, 0xde, 0x81, 0x1c, 0xe7, 0x03, 0x3c, 0xe7, 0x29, 0x5d, 0xef, 0x84,
+        0x3c, 0xef, 0x3c, 0xe7, 0x5d, 0xef, 0xff, 0xff, 0x14, 0x00, 0x00, 0x82, 0x5d, 0xef, 0x3c,
+        0xef, 0x17, 0x5d, 0xef, 0x84, 0x3c, 0xe7, 0x52, 0xf6, 0x89, 0xfd, 0x32, 0xee, 0x02, 0xdb,
+        0xde, 0x82, 0xfb, 0xde, 0x1c, 0xe7, 0x02, 0x3c, 0xe7, 0x2a, 0x5d, 0xef, 0x81, 0x3c, 0xe7,
+        0x02, 0xfb, 0xe6, 0x81, 0xba, 0xe6, 0x13, 0x00, 0x00, 0x18, 0x5d, 0xef, 0x85, 0x3d, 0xe7,
+        0xb7, 0xee, 0xab, 0xfd, 0x89, 0xfd, 0x32, 0xee, 0x03, 0xdb, 0xde, 0x81, 0xfb, 0xde, 0x03,
+        0x3c, 0xe7, 0x2a, 0x5d, 0xef, 0x83, 0x3c, 0xef, 0xff, 0xff, 0x99, 0xde, 0x13, 0x00, 0x00,
+        0x17, 0x5d, 0xef, 0x83, 0x5d, 0xe7, 0x1b, 0xef, 0xee, 0xfd, 0x02, 0x89, 0xfd, 0x81, 0x32,
+        0xee, 0x03, 0xdb, 0xde, 0x82, 0xfb, 0xde, 0x1c, 0xe7, 0x02, 0x3c, 0xe7, 0x2a, 0x5d, 0xef,
+        0x84, 0x3c, 0xe7, 0xfb, 0xe6, 0x1b, 0xe7, 0x37, 0xde, 0x12, 0x00, 0x00, 0x82, 0x5d, 0xef,
+        0x5c, 0xef, 0x15, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0x74, 0xf6, 0x8a, 0xfd, 0x02, 0x89, 0xfd,
+        0x81, 0x32, 0xee, 0x03, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x82, 0x1c, 0xe7, 0x3c, 0xe7, 0x2b,
+        0x5d, 0xef, 0x83, 0x3c, 0xef, 0x5d, 0xef, 0xff, 0xff, 0x12, 0x00, 0x00, 0x82, 0x5d, 0xef,
+        0x1c, 0xe7, 0x14, 0x5d, 0xef, 0x83, 0x5d, 0xe7, 0xf8, 0xee, 0xcc, 0xfd, 0x03, 0x89, 0xfd,
+        0x81, 0x32, 0xee, 0x03, 0xdb, 0xde, 0x81, 0xfb, 0xde, 0x02, 0x1c, 0xe7, 0x81, 0x3c, 0xe7,
+        0x2b, 0x5d, 0xef, 0x83, 0x3c, 0xef, 0x99, 0xe6, 0xfb, 0xe6, 0x12, 0x00, 0x00, 0x82, 0x5d,
+        0xef, 0x3c, 0xef, 0x13, 0x5d, 0xef, 0x83, 0x3d, 0xe7, 0x3b, 0xe7, 0x30, 0xf6, 0x03, 0x89,
+        0xfd, 0x82, 0x69, 0xfd, 0x12, 0xee, 0x03, 0xdb, 0xde, 0x81, 0xfb, 0xde, 0x03, 0x1c, 0xe7,
+        0x81, 0x3c, 0xe7, 0x2a, 0x5d, 0xef, 0x83, 0x5c, 0xef, 0x3c, 0xe7, 0x3c, 0xef, 0x12, 0x00,
+        0x00, 0x02, 0x3c, 0xe7, 0x13, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0x95, 0xee, 0x8a, 0xfd, 0x03,
+        0x89, 0xfd, 0x85, 0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c,
+        0xe7, 0x03, 0x3c, 0xe7, 0x2a, 0x5d, 0xef, 0x82, 0x1b, 0xe7, 0x3c, 0xe7, 0x12, 0x00, 0x00,
+        0x83, 0xfb, 0xe6, 0xda, 0xe6, 0x5c, 0xef, 0x11, 0x5d, 0xef, 0x83, 0x3d, 0xe7, 0xfa, 0xee,
+        0xcd, 0xfd, 0x04, 0x89, 0xfd, 0x85, 0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb,
+        0xde, 0x03, 0x1c, 0xe7, 0x02, 0x3c, 0xe7, 0x82, 0x1c, 0xe7, 0x3c, 0xe7, 0x29, 0x5d, 0xef,
+        0x82, 0x3c, 0xe7, 0x3c, 0xef, 0x12, 0x00, 0x00, 0x83, 0x78, 0xde, 0x7e, 0xef, 0x3c, 0xe7,
+        0x10, 0x5d, 0xef, 0x83, 0x3d, 0xe7, 0x3c, 0xe7, 0x52, 0xf6, 0x05, 0x89, 0xfd, 0x85, 0x69,
+        0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x02, 0x3c, 0xe7,
+        0x81, 0x1c, 0xe7, 0x02, 0x3c, 0xe7, 0x2a, 0x5d, 0xef, 0x12, 0x00, 0x00, 0x83, 0xda, 0xe6,
+        0x3c, 0xe7, 0xfb, 0xe6, 0x10, 0x5d, 0xef, 0x83, 0x3d, 0xe7, 0xd7, 0xee, 0xab, 0xfd, 0x05,
+        0x89, 0xfd, 0x85, 0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x05, 0x1c,
+        0xe7, 0x04, 0x3c, 0xe7, 0x27, 0x5d, 0xef, 0x82, 0x3c, 0xe7, 0x5d, 0xef, 0x13, 0x00, 0x00,
+        0x83, 0x1b, 0xe7, 0xfb, 0xe6, 0x3c, 0xef, 0x0e, 0x5d, 0xef, 0x84, 0x5d, 0xe7, 0x1b, 0xef,
+        0xee, 0xfd, 0x69, 0xfd, 0x05, 0x89, 0xfd, 0x85, 0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb,
+        0xde, 0xfb, 0xde, 0x04, 0x1c, 0xe7, 0x06, 0x3c, 0xe7, 0x28, 0x5d, 0xef, 0x13, 0x00, 0x00,
+        0x83, 0x16, 0xde, 0x7e, 0xef, 0x1b, 0xe7, 0x0e, 0x5d, 0xef, 0x82, 0x3c, 0xe7, 0x74, 0xf6,
+        0x07, 0x89, 0xfd, 0x85, 0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x03,
+        0x1c, 0xe7, 0x08, 0x3c, 0xe7, 0x25, 0x5d, 0xef, 0x02, 0x3c, 0xef, 0x13, 0x00, 0x00, 0x84,
+        0x78, 0xde, 0xdb, 0xe6, 0xda, 0xde, 0x3c, 0xe7, 0x0c, 0x5d, 0xef, 0x83, 0x5d, 0xe7, 0xf8,
+        0xee, 0xcc, 0xfd, 0x07, 0x89, 0xfd, 0x85, 0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde,
+        0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x09, 0x3c, 0xe7, 0x23, 0x5d, 0xef, 0x83, 0x3c, 0xef, 0x1b,
+        0xe7, 0x3c, 0xe7, 0x14, 0x00, 0x00, 0x84, 0x38, 0xd6, 0xbf, 0xf7, 0x1b, 0xe7, 0x3c, 0xe7,
+        0x0b, 0x5d, 0xef, 0x82, 0x3b, 0xef, 0x30, 0xf6, 0x08, 0x89, 0xfd, 0x85, 0x68, 0xfd, 0x12,
+        0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x0a, 0x3c, 0xe7, 0x22, 0x5d,
+        0xef, 0x83, 0x3c, 0xef, 0x1c, 0xe7, 0x3c, 0xe7, 0x14, 0x00, 0x00, 0x84, 0x58, 0xd6, 0xfb,
+        0xe6, 0xda, 0xe6, 0x3c, 0xe7, 0x0a, 0x5d, 0xef, 0x83, 0x3d, 0xe7, 0x95, 0xee, 0x8a, 0xfd,
+        0x08, 0x89, 0xfd, 0x85, 0x68, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x03,
+        0x1c, 0xe7, 0x0b, 0x3c, 0xe7, 0x21, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0x1b, 0xe7, 0x1c, 0xe7,
+        0x15, 0x00, 0x00, 0x84, 0x20, 0x8a, 0xfb, 0xde, 0xdb, 0xde, 0x3c, 0xe7, 0x08, 0x5d, 0xef,
+        0x83, 0x3d, 0xe7, 0xfa, 0xee, 0xcd, 0xfd, 0x09, 0x89, 0xfd, 0x85, 0x68, 0xfd, 0x12, 0xee,
+        0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x06, 0x1c, 0xe7, 0x09, 0x3c, 0xe7, 0x1f, 0x5d, 0xef,
+        0x84, 0x3c, 0xe7, 0x1c, 0xe7, 0x9e, 0xef, 0x37, 0xde, 0x15, 0x00, 0x00, 0x85, 0xd9, 0xde,
+        0xda, 0xe6, 0xff, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x06, 0x5d, 0xef, 0x02, 0x3c, 0xe7, 0x81,
+        0x52, 0xf6, 0x09, 0x89, 0xfd, 0x86, 0x69, 0xfd, 0x68, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb,
+        0xde, 0xfb, 0xde, 0x06, 0x1c, 0xe7, 0x0a, 0x3c, 0xe7, 0x1e, 0x5d, 0xef, 0x84, 0x3c, 0xe7,
+        0xfb, 0xe6, 0x1b, 0xe7, 0x79, 0xe6, 0x16, 0x00, 0x00, 0x02, 0xda, 0xe6, 0x83, 0x78, 0xde,
+        0x1c, 0xe7, 0x3c, 0xe7, 0x04, 0x5d, 0xef, 0x84, 0x3c, 0xe7, 0x3d, 0xe7, 0xd7, 0xee, 0xab,
+        0xfd, 0x07, 0x89, 0xfd, 0x04, 0x69, 0xfd, 0x81, 0x11, 0xee, 0x02, 0xb9, 0xde, 0x82, 0xd9,
+        0xe6, 0xda, 0xe6, 0x08, 0xfa, 0xe6, 0x04, 0x1c, 0xe7, 0x04, 0x3c, 0xe7, 0x1c, 0x5d, 0xef,
+        0x84, 0x3c, 0xe7, 0x1b, 0xe7, 0x73, 0xc5, 0xb9, 0xde, 0x18, 0x00, 0x00, 0x85, 0xfb, 0xe6,
+        0xdb, 0xe6, 0xba, 0xde, 0x1c, 0xe7, 0x3c, 0xe7, 0x03, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0x1b,
+        0xef, 0xee, 0xfd, 0x06, 0x89, 0xfd, 0x06, 0x69, 0xfd, 0x81, 0x8a, 0xfd, 0x04, 0xac, 0xfd,
+        0x06, 0xcc, 0xfd, 0x83, 0xab, 0xfd, 0x32, 0xf6, 0x1b, 0xe7, 0x04, 0x1c, 0xe7, 0x04, 0x3c,
+        0xe7, 0x1b, 0x5d, 0xef, 0x84, 0x3c, 0xe7, 0xba, 0xde, 0xdb, 0xde, 0xfb, 0xe6, 0x18, 0x00,
+        0x00, 0x87, 0x37, 0xde, 0x1c, 0xe7, 0xdb, 0xde, 0xba, 0xde, 0x1c, 0xe7, 0x3c, 0xe7, 0x5d,
+        0xef, 0x02, 0x3c, 0xe7, 0x81, 0x73, 0xf6, 0x04, 0x89, 0xfd, 0x0e, 0x69, 0xfd, 0x06, 0x68,
+        0xfd, 0x83, 0x8a, 0xfd, 0x97, 0xe6, 0xfc, 0xde, 0x05, 0x1c, 0xe7, 0x04, 0x3c, 0xe7, 0x19,
+        0x5d, 0xef, 0x85, 0x3c, 0xe7, 0x1b, 0xe7, 0xbf, 0xef, 0x78, 0xde, 0xd2, 0xa5, 0x19, 0x00,
+        0x00, 0x85, 0xda, 0xe6, 0xfb, 0xde, 0xfb, 0xe6, 0xda, 0xe6, 0xfb, 0xe6, 0x02, 0x3c, 0xe7,
+        0x82, 0xd8, 0xee, 0xac, 0xfd, 0x16, 0x69, 0xfd, 0x84, 0x68, 0xfd, 0x69, 0xfd, 0x12, 0xee,
+        0xdb, 0xde, 0x03, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x05, 0x3c, 0xe7, 0x17, 0x5d, 0xef, 0x83,
+        0x3c, 0xe7, 0xfb, 0xe6, 0x37, 0xde, 0x02, 0xba, 0xde, 0x1b, 0x00, 0x00, 0x87, 0xd9, 0xe6,
+        0x1c, 0xe7, 0xfb, 0xe6, 0x98, 0xe6, 0xdb, 0xde, 0xfb, 0xe6, 0x30, 0xf6, 0x15, 0x69, 0xfd,
+        0x03, 0x68, 0xfd, 0x82, 0xcd, 0xf5, 0xb9, 0xde, 0x02, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x04,
+        0x1c, 0xe7, 0x05, 0x3c, 0xe7, 0x15, 0x5d, 0xef, 0x85, 0x3c, 0xe7, 0x1b, 0xe7, 0x9a, 0xde,
+        0xba, 0xde, 0xda, 0xde, 0x1e, 0x00, 0x00, 0x85, 0xfb, 0xe6, 0xda, 0xde, 0x2f, 0xfe, 0xee,
+        0xf5, 0x8a, 0xfd, 0x14, 0x69, 0xfd, 0x03, 0x68, 0xfd, 0x83, 0x8a, 0xfd, 0x56, 0xe6, 0xbb,
+        0xd6, 0x03, 0xdb, 0xde, 0x81, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x07, 0x3c, 0xe7, 0x13, 0x5d,
+        0xef, 0x85, 0x1c, 0xe7, 0xfb, 0xde, 0x59, 0xd6, 0x9a, 0xde, 0xba, 0xde, 0x1f, 0x00, 0x00,
+        0x84, 0xc8, 0xe4, 0x6a, 0xfd, 0x8a, 0xfd, 0x89, 0xfd, 0x13, 0x69, 0xfd, 0x05, 0x68, 0xfd,
+        0x81, 0xf0, 0xed, 0x02, 0xba, 0xd6, 0x02, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x03, 0x1c, 0xe7,
+        0x08, 0x3c, 0xe7, 0x10, 0x5d, 0xef, 0x86, 0x3c, 0xe7, 0x1b, 0xe7, 0xdb, 0xde, 0x07, 0xab,
+        0x99, 0xde, 0x9a, 0xd6, 0x20, 0x00, 0x00, 0x83, 0xe9, 0xe4, 0x08, 0x8b, 0x89, 0xfd, 0x12,
+        0x69, 0xfd, 0x06, 0x68, 0xfd, 0x82, 0xac, 0xf5, 0x98, 0xde, 0x02, 0xba, 0xd6, 0x02, 0xdb,
+        0xde, 0x81, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x0a, 0x3c, 0xe7, 0x0c, 0x5d, 0xef, 0x02, 0x3c,
+        0xe7, 0x86, 0x1c, 0xe7, 0xdb, 0xde, 0x9a, 0xd6, 0x1c, 0xdf, 0x79, 0xde, 0x78, 0xde, 0x1f,
+        0x00, 0x00, 0x82, 0xd2, 0xa5, 0x8a, 0xfd, 0x02, 0x6a, 0xfd, 0x11, 0x69, 0xfd, 0x07, 0x68,
+        0xfd, 0x82, 0x69, 0xfd, 0x13, 0xe6, 0x03, 0x9a, 0xd6, 0x81, 0xba, 0xd6, 0x02, 0xdb, 0xde,
+        0x03, 0xfb, 0xde, 0x0b, 0x1c, 0xe7, 0x07, 0x3c, 0xe7, 0x83, 0x1c, 0xe7, 0x3c, 0xe7, 0x1c,
+        0xe7, 0x02, 0xfb, 0xe6, 0x86, 0xdb, 0xde, 0xba, 0xde, 0x7e, 0xef, 0xba, 0xde, 0x1c, 0xdf,
+        0x58, 0xd6, 0x20, 0x00, 0x00, 0x81, 0x0a, 0xdd, 0x02, 0xaa, 0xfd, 0x81, 0x89, 0xfd, 0x0f,
+        0x69, 0xfd, 0x09, 0x68, 0xfd, 0x82, 0x4a, 0xf5, 0x37, 0xce, 0x03, 0x59, 0xce, 0x83, 0x79,
+        0xce, 0x79, 0xd6, 0x99, 0xd6, 0x03, 0x9a, 0xd6, 0x13, 0xba, 0xd6, 0x89, 0xdb, 0xde, 0xdb,
+        0xe6, 0x79, 0xde, 0xf6, 0xcd, 0xfb, 0xde, 0xda, 0xde, 0x1e, 0xef, 0xf2, 0xad, 0xd2, 0xa5,
+        0x20, 0x00, 0x00, 0x85, 0x8b, 0xfe, 0xee, 0x7d, 0xc8, 0xfd, 0x8a, 0xfd, 0x89, 0xfd, 0x0c,
+        0x69, 0xfd, 0x0b, 0x68, 0xfd, 0x84, 0x48, 0xfd, 0x08, 0xf5, 0xd2, 0xdd, 0x59, 0xc6, 0x02,
+        0x38, 0xc6, 0x83, 0x59, 0xce, 0x79, 0xce, 0x79, 0xd6, 0x03, 0x9a, 0xd6, 0x13, 0xba, 0xd6,
+        0x84, 0xdb, 0xde, 0xdb, 0xe6, 0x99, 0xde, 0x98, 0xde, 0x02, 0xdb, 0xe6, 0x23, 0x00, 0x00,
+        0x84, 0x2a, 0xfd, 0x6a, 0xfd, 0xaa, 0xfd, 0x89, 0xfd, 0x0a, 0x69, 0xfd, 0x0e, 0x68, 0xfd,
+        0x84, 0x28, 0xfd, 0xc8, 0xfd, 0x10, 0x22, 0x2b, 0xed, 0x13, 0x00, 0x00, 0x82, 0xf3, 0x9d,
+        0xfc, 0x46, 0x02, 0x5f, 0x2f, 0x82, 0x7f, 0x27, 0xd2, 0xa5, 0x2b, 0x00, 0x00, 0x84, 0x8b,
+        0xfd, 0x8b, 0xf5, 0x89, 0xfd, 0x69, 0xfd, 0x17, 0x68, 0xfd, 0x84, 0x48, 0xfd, 0xc8, 0xec,
+        0xe8, 0xec, 0xc8, 0xe4, 0x13, 0x00, 0x00, 0x88, 0x3f, 0x2f, 0x3f, 0x3f, 0x5f, 0x1f, 0x7f,
+        0x37, 0x9f, 0x57, 0x5f, 0x2f, 0x5f, 0x27, 0x3f, 0x2f, 0x2a, 0x00, 0x00, 0x02, 0x6a, 0xfd,
+        0x81, 0x29, 0xfd, 0x0b, 0x28, 0xfd, 0x0d, 0x68, 0xfd, 0x83, 0x48, 0xfd, 0x28, 0xfd, 0xc6,
+        0xfc, 0x13, 0x00, 0x00, 0x84, 0x5f, 0x2f, 0x5f, 0x37, 0x5f, 0x0f, 0x5f, 0x2f, 0x02, 0x5f,
+        0x1f, 0x84, 0x5f, 0x3f, 0x5f, 0x27, 0x5f, 0x07, 0x5f, 0x2f, 0x29, 0x00, 0x00, 0x02, 0x6a,
+        0xfd, 0x81, 0x49, 0xfd, 0x03, 0x48, 0xfd, 0x06, 0x28, 0xfd, 0x82, 0x48, 0xfd, 0xa9, 0xfd,
+        0x0c, 0x68, 0xfd, 0x84, 0x48, 0xfd, 0x49, 0x82, 0xe9, 0xec, 0xd2, 0xa5, 0x12, 0x00, 0x00,
+        0x8c, 0x5f, 0x2f, 0x5f, 0x37, 0xbf, 0x77, 0x5f, 0x27, 0x3f, 0x17, 0x3f, 0x07, 0x3f, 0x0f,
+        0x3f, 0x1f, 0x5f, 0x2f, 0x5f, 0x27, 0x3f, 0x0f, 0x7f, 0x2f, 0x34, 0x00, 0x00, 0x0d, 0x68,
+        0xfd, 0x84, 0x48, 0xfd, 0x08, 0xf5, 0x28, 0xf5, 0xe8, 0xec, 0x12, 0x00, 0x00, 0x85, 0x5f,
+        0x2f, 0x5f, 0x37, 0xbf, 0x6f, 0x5f, 0x1f, 0x3f, 0x0f, 0x04, 0x3f, 0x07, 0x85, 0x3f, 0x17,
+        0x5f, 0x2f, 0x3f, 0x1f, 0xff, 0x06, 0x7f, 0x17, 0x33, 0x00, 0x00, 0x0d, 0x68, 0xfd, 0x83,
+        0x28, 0xf5, 0x48, 0xfd, 0x80, 0xfe, 0x12, 0x00, 0x00, 0x85, 0x3f, 0x2f, 0x5f, 0x37, 0x5f,
+        0x0f, 0x5f, 0x1f, 0x3f, 0x0f, 0x06, 0x3f, 0x07, 0x84, 0x3f, 0x17, 0x5f, 0x2f, 0x5f, 0x27,
+        0x5f, 0x2f, 0x33, 0x00, 0x00, 0x0c, 0x68, 0xfd, 0x84, 0x48, 0xfd, 0x49, 0xed, 0x48, 0xf5,
+        0x0a, 0xdd, 0x12, 0x00, 0x00, 0x84, 0x7f, 0x27, 0x5f, 0x1f, 0x5f, 0x27, 0x3f, 0x0f, 0x08,
+        0x3f, 0x07, 0x84, 0x5f, 0x17, 0xff, 0xbf, 0x5f, 0x27, 0x7f, 0x17, 0x32, 0x00, 0x00, 0x0b,
+        0x68, 0xfd, 0x84, 0x48, 0xfd, 0x08, 0xf5, 0x28, 0xfd, 0x08, 0xfd, 0x13, 0x00, 0x00, 0x83,
+        0x5f, 0x2f, 0xdf, 0xaf, 0x3f, 0x17, 0x09, 0x3f, 0x07, 0x81, 0x3f, 0x0f, 0x02, 0x5f, 0x1f,
+        0x81, 0x5f, 0x27, 0x32, 0x00, 0x00, 0x0b, 0x68, 0xfd, 0x83, 0x28, 0xfd, 0xc7, 0xfd, 0xc8,
+        0xe4, 0x14, 0x00, 0x00, 0x83, 0x3f, 0x17, 0x5f, 0x1f, 0x3f, 0x0f, 0x0a, 0x3f, 0x07, 0x83,
+        0x3f, 0x0f, 0x1f, 0x07, 0x5f, 0x27, 0x32, 0x00, 0x00, 0x0a, 0x68, 0xfd, 0x84, 0x48, 0xfd,
+        0xe8, 0xec, 0x08, 0xf5, 0xc8, 0xe4, 0x14, 0x00, 0x00, 0x02, 0x3f, 0x0f, 0x0c, 0x3f, 0x07,
+        0x82, 0x3f, 0x17, 0x3f, 0x0f, 0x32, 0x00, 0x00, 0x0a, 0x68, 0xfd, 0x83, 0x48, 0xfd, 0x68,
+        0xfd, 0xa2, 0xff, 0x15, 0x00, 0x00, 0x82, 0x3f, 0x07, 0x1f, 0x07, 0x0c, 0x3f, 0x07, 0x02,
+        0x1f, 0x07, 0x32, 0x00, 0x00, 0x09, 0x68, 0xfd, 0x84, 0x28, 0xfd, 0x49, 0xbc, 0x08, 0xed,
+        0x8f, 0xbd, 0x15, 0x00, 0x00, 0x02, 0x1f, 0x07, 0x0c, 0x3f, 0x07, 0x02, 0x1f, 0x07, 0x32,
+        0x00, 0x00, 0x08, 0x68, 0xfd, 0x81, 0x48, 0xfd, 0x02, 0x08, 0xf5, 0x81, 0xe6, 0xf4, 0x16,
+        0x00, 0x00, 0x82, 0x1f, 0x07, 0xff, 0x06, 0x0b, 0x3f, 0x07, 0x83, 0x1f, 0x07, 0xbe, 0x06,
+        0xff, 0x06, 0x32, 0x00, 0x00, 0x07, 0x68, 0xfd, 0x85, 0x48, 0xfd, 0x28, 0xf5, 0x48, 0xfd,
+        0xe8, 0xec, 0xb0, 0xe5, 0x16, 0x00, 0x00, 0x02, 0xff, 0x06, 0x81, 0x1f, 0x07, 0x0a, 0x3f,
+        0x07, 0x02, 0x1f, 0x07, 0x81, 0xdf, 0x0e, 0x32, 0x00, 0x00, 0x07, 0x68, 0xfd, 0x82, 0x48,
+        0xfd, 0xe8, 0xe4, 0x02, 0x08, 0xed, 0x17, 0x00, 0x00, 0x84, 0x9e, 0x06, 0x1f, 0x07, 0xdf,
+        0x06, 0x1f, 0x07, 0x08, 0x3f, 0x07, 0x84, 0xff, 0x06, 0xbf, 0x06, 0xdf, 0x06, 0xff, 0x0e,
+        0x32, 0x00, 0x00, 0x06, 0x68, 0xfd, 0x84, 0x48, 0xfd, 0x28, 0xf5, 0x08, 0xf5, 0x27, 0xf4,
+        0x18, 0x00, 0x00, 0x85, 0xdf, 0x06, 0xbf, 0x06, 0x3e, 0x06, 0xff, 0x06, 0x1f, 0x07, 0x05,
+        0x3f, 0x07, 0x82, 0x1f, 0x07, 0xff, 0x06, 0x02, 0xdf, 0x06, 0x81, 0x3f, 0x0f, 0x33, 0x00,
+        0x00, 0x06, 0x68, 0xfd, 0x84, 0x28, 0xfd, 0xa6, 0xfd, 0x4b, 0xe5, 0xc9, 0xf5, 0x19, 0x00,
+        0x00, 0x83, 0xdf, 0x06, 0xbf, 0x06, 0xff, 0x0f, 0x02, 0xdf, 0x06, 0x04, 0xff, 0x06, 0x85,
+        0xdf, 0x06, 0xbf, 0x06, 0xdf, 0x06, 0x9f, 0x0f, 0xbf, 0x06, 0x33, 0x00, 0x00, 0x05, 0x68,
+        0xfd, 0x84, 0x48, 0xfd, 0xe8, 0xf4, 0x08, 0xf5, 0x29, 0xf5, 0x1b, 0x00, 0x00, 0x8c, 0xdf,
+        0x06, 0xbf, 0x06, 0xdf, 0x06, 0x3a, 0x4c, 0xbe, 0x06, 0x9e, 0x06, 0xbe, 0x06, 0xbf, 0x06,
+        0xff, 0x06, 0xdf, 0x06, 0xff, 0x06, 0xbf, 0x06, 0x34, 0x00, 0x00, 0x04, 0x68, 0xfd, 0x84,
+        0x48, 0xfd, 0x28, 0xf5, 0x68, 0xfd, 0x28, 0xfd, 0x1d, 0x00, 0x00, 0x82, 0x7f, 0x17, 0x9f,
+        0x06, 0x02, 0xdf, 0x06, 0x02, 0xbf, 0x06, 0x83, 0xdf, 0x06, 0xff, 0x16, 0x3f, 0x0f, 0x36,
+        0x00, 0x00, 0x03, 0x68, 0xfd, 0x02, 0x48, 0xfd, 0x83, 0xf8, 0x07, 0x69, 0xed, 0xa7, 0xec,
+        0x0c, 0x00, 0x00, 0x82, 0xd2, 0xa5, 0x9f, 0x1f, 0x02, 0x5f, 0x2f, 0x82, 0x9f, 0x1f, 0xd2,
+        0xa5, 0x4a, 0x00, 0x00, 0x03, 0x68, 0xfd, 0x84, 0x48, 0xfd, 0x08, 0xf5, 0x28, 0xf5, 0xc9,
+        0xf5, 0x0c, 0x00, 0x00, 0x83, 0x3f, 0x2f, 0x3f, 0x47, 0x5f, 0x17, 0x02, 0x5f, 0x2f, 0x83,
+        0x5f, 0x17, 0x3f, 0x47, 0x3f, 0x2f, 0x49, 0x00, 0x00, 0x02, 0x68, 0xfd, 0x85, 0x48, 0xfd,
+        0x28, 0xfd, 0x48, 0xfd, 0x47, 0xfd, 0xb0, 0xe5, 0x0b, 0x00, 0x00, 0x84, 0x5f, 0x2f, 0x5f,
+        0x37, 0x3f, 0x0f, 0x5f, 0x27, 0x02, 0x3f, 0x17, 0x84, 0x5f, 0x27, 0x3f, 0x0f, 0x5f, 0x37,
+        0x5f, 0x2f, 0x48, 0x00, 0x00, 0x02, 0x48, 0xfd, 0x83, 0x28, 0xfd, 0xe8, 0xec, 0xc8, 0xec,
+        0x0c, 0x00, 0x00, 0x85, 0x7f, 0x2f, 0x5f, 0x37, 0x9f, 0x7f, 0x5f, 0x27, 0x3f, 0x0f, 0x02,
+        0x3f, 0x07, 0x85, 0x3f, 0x0f, 0x5f, 0x27, 0x9f, 0x7f, 0x5f, 0x37, 0x7f, 0x2f, 0x47, 0x00,
+        0x00, 0x85, 0x89, 0xf5, 0x69, 0xf5, 0x89, 0xf5, 0x05, 0xec, 0xa7, 0xec, 0x0b, 0x00, 0x00,
+        0x85, 0x7f, 0x17, 0x7f, 0x37, 0xdf, 0x04, 0x5f, 0x1f, 0x3f, 0x0f, 0x04, 0x3f, 0x07, 0x85,
+        0x3f, 0x0f, 0x5f, 0x1f, 0xdf, 0x04, 0x7f, 0x37, 0x7f, 0x17, 0x46, 0x00, 0x00, 0x04, 0xa9,
+        0xf5, 0x81, 0xd2, 0xa5, 0x0b, 0x00, 0x00, 0x84, 0x3f, 0x17, 0x3f, 0x0f, 0x5f, 0x1f, 0x3f,
+        0x0f, 0x06, 0x3f, 0x07, 0x84, 0x3f, 0x0f, 0x5f, 0x1f, 0x3f, 0x0f, 0x3f, 0x17, 0x55, 0x00,
+        0x00, 0x81, 0x7f, 0x17, 0x02, 0x5f, 0x27, 0x81, 0x3f, 0x0f, 0x08, 0x3f, 0x07, 0x81, 0x3f,
+        0x0f, 0x02, 0x5f, 0x27, 0x81, 0x7f, 0x17, 0x54, 0x00, 0x00, 0x83, 0x3f, 0x1f, 0x1f, 0x07,
+        0x5f, 0x17, 0x0a, 0x3f, 0x07, 0x83, 0x5f, 0x17, 0x1f, 0x07, 0x3f, 0x1f, 0x54, 0x00, 0x00,
+        0x02, 0x5f, 0x1f, 0x81, 0x3f, 0x0f, 0x0a, 0x3f, 0x07, 0x81, 0x3f, 0x0f, 0x02, 0x5f, 0x1f,
+        0x54, 0x00, 0x00, 0x02, 0x3f, 0x0f, 0x0c, 0x3f, 0x07, 0x02, 0x3f, 0x0f, 0x54, 0x00, 0x00,
+        0x02, 0x1f, 0x07, 0x0c, 0x3f, 0x07, 0x02, 0x1f, 0x07, 0x54, 0x00, 0x00, 0x02, 0x1f, 0x07,
+        0x0c, 0x3f, 0x07, 0x02, 0x1f, 0x07, 0x54, 0x00, 0x00, 0x02, 0xdf, 0x06, 0x81, 0x1f, 0x07,
+        0x0a, 0x3f, 0x07, 0x81, 0x1f, 0x07, 0x02, 0xdf, 0x06, 0x54, 0x00, 0x00, 0x83, 0x1e, 0x06,
+        0x3f, 0x07, 0xff, 0x06, 0x0a, 0x3f, 0x07, 0x83, 0xff, 0x06, 0x3f, 0x07, 0x1e, 0x06, 0x54,
+        0x00, 0x00, 0x84, 0x7f, 0x17, 0xdf, 0x06, 0xbf, 0x06, 0xff, 0x06, 0x08, 0x3f, 0x07, 0x84,
+        0xff, 0x06, 0xbf, 0x06, 0xdf, 0x06, 0x7f, 0x17, 0x55, 0x00, 0x00, 0x84, 0xdf, 0x06, 0xff,
+        0x06, 0xdf, 0x06, 0xff, 0x06, 0x02, 0x1f, 0x07, 0x02, 0x3f, 0x07, 0x02, 0x1f, 0x07, 0x84,
+        0xff, 0x06, 0xdf, 0x06, 0xff, 0x06, 0xdf, 0x06, 0x57, 0x00, 0x00, 0x84, 0x1f, 0x07, 0xdf,
+        0x06, 0x9e, 0x06, 0xbf, 0x06, 0x04, 0xff, 0x06, 0x84, 0xbf, 0x06, 0x9e, 0x06, 0xdf, 0x06,
+        0x1f, 0x07, 0x58, 0x00, 0x00, 0x81, 0xbf, 0x06, 0x02, 0xbe, 0x06, 0x82, 0xbf, 0x06, 0xdd,
+        0x0d, 0x02, 0x5e, 0x06, 0x82, 0xdd, 0x0d, 0xbf, 0x06, 0x02, 0xbe, 0x06, 0x81, 0xbf, 0x06,
+        0x5a, 0x00, 0x00, 0x83, 0xbf, 0x06, 0xdf, 0x0e, 0xdf, 0x06, 0x02, 0xbf, 0x06, 0x83, 0xdf,
+        0x06, 0xdf, 0x0e, 0xbf, 0x06, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x2d,
+        0x00, 0x00, 0x83, 0x03, 0x06, 0x08, 0x07, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x87, 0x02, 0x20,
+        0x50, 0x71, 0x99, 0xb5, 0xc6, 0xbc, 0x9e, 0x74, 0x50, 0x20, 0x02, 0x00, 0x2a, 0x00, 0x00,
+        0x83, 0x08, 0x43, 0x9b, 0xd7, 0xfa, 0xff, 0x03, 0xff, 0xff, 0x83, 0xfa, 0xd7, 0x9b, 0x43,
+        0x08, 0x00, 0x28, 0x00, 0x00, 0x82, 0x00, 0x34, 0xa5, 0xf0, 0x06, 0xff, 0xff, 0x82, 0xff,
+        0xf0, 0xa5, 0x34, 0x27, 0x00, 0x00, 0x82, 0x00, 0x09, 0x6c, 0xe2, 0x08, 0xff, 0xff, 0x82,
+        0xff, 0xe1, 0x68, 0x08, 0x1b, 0x00, 0x00, 0x87, 0x00, 0x17, 0x33, 0x4b, 0x6f, 0x88, 0x99,
+        0xa4, 0x9d, 0x8c, 0x6a, 0x48, 0x2f, 0x13, 0x04, 0x00, 0x00, 0x82, 0x10, 0x8a, 0xf7, 0xff,
+        0x09, 0xff, 0xff, 0x82, 0xf7, 0x89, 0x0f, 0x00, 0x18, 0x00, 0x00, 0x85, 0x00, 0x01, 0x1e,
+        0x57, 0x9c, 0xc8, 0xf1, 0xf8, 0xfd, 0xff, 0x02, 0xff, 0xff, 0x87, 0xfc, 0xf8, 0xec, 0xc1,
+        0x93, 0x48, 0x15, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x8e, 0xfb, 0x0a, 0xff, 0xff, 0x82, 0xff,
+        0xfb, 0x8e, 0x0c, 0x17, 0x00, 0x00, 0x83, 0x00, 0x03, 0x30, 0x89, 0xd4, 0xf9, 0x07, 0xff,
+        0xff, 0x85, 0xff, 0xf4, 0xc7, 0x79, 0x23, 0x00, 0x01, 0x76, 0xf8, 0xff, 0x0b, 0xff, 0xff,
+        0x82, 0xf8, 0x76, 0x02, 0x00, 0x16, 0x00, 0x00, 0x82, 0x26, 0x8e, 0xe3, 0xff, 0x09, 0xff,
+        0xff, 0x83, 0xff, 0xfe, 0xd5, 0x74, 0x5e, 0xe9, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xea, 0x48,
+        0x00, 0x15, 0x00, 0x00, 0x82, 0x0a, 0x65, 0xd5, 0xff, 0x0b, 0xff, 0xff, 0x82, 0xff, 0xfc,
+        0xf4, 0xff, 0x0d, 0xff, 0xff, 0x81, 0xbd, 0x14, 0x14, 0x00, 0x00, 0x82, 0x00, 0x1e, 0x99,
+        0xf7, 0x1b, 0xff, 0xff, 0x81, 0xfa, 0x65, 0x14, 0x00, 0x00, 0x81, 0x2a, 0xbe, 0x1c, 0xff,
+        0xff, 0x82, 0xff, 0xbd, 0x11, 0x00, 0x12, 0x00, 0x00, 0x82, 0x00, 0x30, 0xc9, 0xff, 0x1c,
+        0xff, 0xff, 0x82, 0xff, 0xf2, 0x40, 0x00, 0x12, 0x00, 0x00, 0x81, 0x29, 0xc8, 0x1e, 0xff,
+        0xff, 0x81, 0x87, 0x00, 0x11, 0x00, 0x00, 0x82, 0x00, 0x1c, 0xbc, 0xff, 0x1e, 0xff, 0xff,
+        0x81, 0xaf, 0x06, 0x11, 0x00, 0x00, 0x81, 0x09, 0x95, 0x1f, 0xff, 0xff, 0x81, 0xcb, 0x19,
+        0x11, 0x00, 0x00, 0x81, 0x5f, 0xf6, 0x1f, 0xff, 0xff, 0x81, 0xe8, 0x2d, 0x10, 0x00, 0x00,
+        0x82, 0x00, 0x22, 0xd0, 0xff, 0x1f, 0xff, 0xff, 0x81, 0xf5, 0x35, 0x10, 0x00, 0x00, 0x81,
+        0x02, 0x86, 0x20, 0xff, 0xff, 0x81, 0xec, 0x2f, 0x10, 0x00, 0x00, 0x81, 0x29, 0xde, 0x20,
+        0xff, 0xff, 0x81, 0xda, 0x23, 0x10, 0x00, 0x00, 0x81, 0x7e, 0xff, 0x20, 0xff, 0xff, 0x81,
+        0xc0, 0x12, 0x0f, 0x00, 0x00, 0x82, 0x00, 0x17, 0xcc, 0xff, 0x20, 0xff, 0xff, 0x81, 0xa4,
+        0x01, 0x0f, 0x00, 0x00, 0x82, 0x00, 0x4d, 0xf4, 0xff, 0x1f, 0xff, 0xff, 0x82, 0xff, 0xfe,
+        0x81, 0x00, 0x0f, 0x00, 0x00, 0x81, 0x00, 0x8c, 0x21, 0xff, 0xff, 0x82, 0xde, 0x88, 0x32,
+        0x01, 0x0e, 0x00, 0x00, 0x81, 0x10, 0xbb, 0x22, 0xff, 0xff, 0x82, 0xe2, 0x7f, 0x1a, 0x00,
+        0x0d, 0x00, 0x00, 0x81, 0x27, 0xe8, 0x23, 0xff, 0xff, 0x81, 0xbf, 0x38, 0x0d, 0x00, 0x00,
+        0x81, 0x3d, 0xf1, 0x23, 0xff, 0xff, 0x82, 0xff, 0xd9, 0x4b, 0x00, 0x0c, 0x00, 0x00, 0x81,
+        0x5e, 0xf8, 0x24, 0xff, 0xff, 0x81, 0xdf, 0x45, 0x0c, 0x00, 0x00, 0x81, 0x74, 0xfd, 0x24,
+        0xff, 0xff, 0x82, 0xff, 0xd3, 0x2d, 0x00, 0x0b, 0x00, 0x00, 0x81, 0x85, 0xff, 0x25, 0xff,
+        0xff, 0x81, 0xab, 0x0d, 0x0b, 0x00, 0x00, 0x81, 0x90, 0xff, 0x25, 0xff, 0xff, 0x81, 0xf7,
+        0x5f, 0x0b, 0x00, 0x00, 0x81, 0x83, 0xff, 0x25, 0xff, 0xff, 0x82, 0xff, 0xc6, 0x15, 0x00,
+        0x0a, 0x00, 0x00, 0x81, 0x6f, 0xfc, 0x25, 0xff, 0xff, 0x82, 0xff, 0xf6, 0x54, 0x00, 0x0a,
+        0x00, 0x00, 0x81, 0x52, 0xf6, 0x26, 0xff, 0xff, 0x81, 0x9f, 0x05, 0x0a, 0x00, 0x00, 0x81,
+        0x31, 0xef, 0x26, 0xff, 0xff, 0x81, 0xd8, 0x1e, 0x0a, 0x00, 0x00, 0x81, 0x1d, 0xd9, 0x26,
+        0xff, 0xff, 0x81, 0xf1, 0x3c, 0x0a, 0x00, 0x00, 0x81, 0x08, 0xa9, 0x26, 0xff, 0xff, 0x81,
+        0xf9, 0x62, 0x0a, 0x00, 0x00, 0x81, 0x00, 0x78, 0x26, 0xff, 0xff, 0x81, 0xff, 0x82, 0x0a,
+        0x00, 0x00, 0x82, 0x00, 0x33, 0xe9, 0xff, 0x25, 0xff, 0xff, 0x81, 0xff, 0x92, 0x0a, 0x00,
+        0x00, 0x82, 0x00, 0x0c, 0xb2, 0xff, 0x25, 0xff, 0xff, 0x81, 0xff, 0x8a, 0x0b, 0x00, 0x00,
+        0x81, 0x5d, 0xf8, 0x25, 0xff, 0xff, 0x81, 0xfc, 0x6e, 0x0b, 0x00, 0x00, 0x81, 0x13, 0xc0,
+        0x25, 0xff, 0xff, 0x81, 0xf4, 0x49, 0x0b, 0x00, 0x00, 0x82, 0x00, 0x5d, 0xf7, 0xff, 0x24,
+        0xff, 0xff, 0x81, 0xe8, 0x28, 0x0b, 0x00, 0x00, 0x82, 0x00, 0x0c, 0xa8, 0xff, 0x24, 0xff,
+        0xff, 0x81, 0xb5, 0x0d, 0x0c, 0x00, 0x00, 0x81, 0x34, 0xde, 0x23, 0xff, 0xff, 0x82, 0xff,
+        0xfe, 0x73, 0x00, 0x0c, 0x00, 0x00, 0x82, 0x00, 0x60, 0xf3, 0xff, 0x22, 0xff, 0xff, 0x82,
+        0xff, 0xdd, 0x28, 0x00, 0x0c, 0x00, 0x00, 0x82, 0x00, 0x06, 0x84, 0xfb, 0x22, 0xff, 0xff,
+        0x82, 0xff, 0x85, 0x02, 0x00, 0x0d, 0x00, 0x00, 0x82, 0x0c, 0x94, 0xfd, 0xff, 0x21, 0xff,
+        0xff, 0x81, 0xcd, 0x21, 0x0e, 0x00, 0x00, 0x82, 0x00, 0x0e, 0x8f, 0xfa, 0x0e, 0xff, 0xff,
+        0x81, 0xfe, 0xff, 0x11, 0xff, 0xff, 0x82, 0xff, 0xee, 0x52, 0x00, 0x0f, 0x00, 0x00, 0x82,
+        0x0a, 0x7e, 0xee, 0xff, 0x1f, 0xff, 0xff, 0x82, 0xf6, 0x76, 0x03, 0x00, 0x0f, 0x00, 0x00,
+        0x82, 0x00, 0x04, 0x53, 0xd5, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xfe, 0x11, 0xff, 0xff, 0x82,
+        0xff, 0xf6, 0x81, 0x0a, 0x11, 0x00, 0x00, 0x82, 0x00, 0x6e, 0xfc, 0xff, 0x1d, 0xff, 0xff,
+        0x82, 0xe9, 0x6f, 0x09, 0x00, 0x11, 0x00, 0x00, 0x81, 0x1a, 0xc4, 0x0c, 0xff, 0xff, 0x81,
+        0xfe, 0xff, 0x10, 0xff, 0xff, 0x82, 0xfd, 0xc0, 0x45, 0x01, 0x11, 0x00, 0x00, 0x82, 0x00,
+        0x01, 0x81, 0xff, 0x0c, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x0f, 0xff, 0xff, 0x82, 0xf8, 0xc8,
+        0x6c, 0x16, 0x12, 0x00, 0x00, 0x82, 0x00, 0x3d, 0xe8, 0xff, 0x1a, 0xff, 0xff, 0x83, 0xf4,
+        0xde, 0xc9, 0x96, 0x50, 0x16, 0x13, 0x00, 0x00, 0x81, 0x0e, 0xb0, 0x0c, 0xff, 0xff, 0x81,
+        0xa6, 0x58, 0x0d, 0x58, 0x58, 0x83, 0x58, 0x57, 0x47, 0x29, 0x0e, 0x02, 0x14, 0x00, 0x00,
+        0x81, 0x68, 0xf9, 0x0b, 0xff, 0xff, 0x82, 0xff, 0xd4, 0x25, 0x00, 0x23, 0x00, 0x00, 0x82,
+        0x00, 0x28, 0xd8, 0xff, 0x0b, 0xff, 0xff, 0x81, 0xf8, 0x63, 0x24, 0x00, 0x00, 0x81, 0x09,
+        0x9f, 0x0c, 0xff, 0xff, 0x81, 0xac, 0x0d, 0x0c, 0x00, 0x00, 0x81, 0x09, 0x02, 0x17, 0x00,
+        0x00, 0x82, 0x15, 0x71, 0x81, 0x7f, 0x03, 0x80, 0x80, 0x82, 0x80, 0x7f, 0x84, 0xe4, 0x05,
+        0xff, 0xff, 0x82, 0xff, 0xe4, 0x38, 0x00, 0x0b, 0x00, 0x00, 0x83, 0x00, 0x33, 0xa6, 0x73,
+        0x0a, 0x00, 0x1c, 0x00, 0x00, 0x81, 0x04, 0xc7, 0x05, 0xff, 0xff, 0x82, 0xfd, 0x7d, 0x01,
+        0x00, 0x0a, 0x00, 0x00, 0x84, 0x00, 0x01, 0x49, 0xd6, 0xff, 0xfa, 0x93, 0x16, 0x1c, 0x00,
+        0x00, 0x81, 0x08, 0xc8, 0x05, 0xff, 0xff, 0x81, 0xc2, 0x18, 0x0b, 0x00, 0x00, 0x85, 0x01,
+        0x5b, 0xe5, 0xff, 0xff, 0xff, 0xfe, 0xaa, 0x1c, 0x00, 0x1b, 0x00, 0x00, 0x81, 0x08, 0xc8,
+        0x04, 0xff, 0xff, 0x82, 0xff, 0xef, 0x4d, 0x00, 0x0b, 0x00, 0x00, 0x81, 0x48, 0xe5, 0x03,
+        0xff, 0xff, 0x81, 0x9f, 0x0e, 0x1b, 0x00, 0x00, 0x81, 0x08, 0xc8, 0x04, 0xff, 0xff, 0x82,
+        0xff, 0x95, 0x06, 0x00, 0x0a, 0x00, 0x00, 0x82, 0x00, 0x21, 0xcc, 0xff, 0x03, 0xff, 0xff,
+        0x82, 0xfb, 0x72, 0x01, 0x00, 0x1a, 0x00, 0x00, 0x81, 0x08, 0xc8, 0x04, 0xff, 0xff, 0x81,
+        0xd5, 0x27, 0x0b, 0x00, 0x00, 0x81, 0x01, 0x82, 0x04, 0xff, 0xff, 0x82, 0xff, 0xdb, 0x28,
+        0x00, 0x1a, 0x00, 0x00, 0x81, 0x08, 0xc8, 0x03, 0xff, 0xff, 0x82, 0xff, 0xf8, 0x64, 0x00,
+        0x0b, 0x00, 0x00, 0x81, 0x1d, 0xd7, 0x05, 0xff, 0xff, 0x81, 0x77, 0x00, 0x1a, 0x00, 0x00,
+        0x81, 0x08, 0xc8, 0x03, 0xff, 0xff, 0x82, 0xff, 0xac, 0x0d, 0x00, 0x0b, 0x00, 0x00, 0x81,
+        0x51, 0xf5, 0x05, 0xff, 0xff, 0x81, 0xb5, 0x0d, 0x1a, 0x00, 0x00, 0x81, 0x08, 0xc8, 0x03,
+        0xff, 0xff, 0x81, 0xe3, 0x38, 0x0c, 0x00, 0x00, 0x81, 0x79, 0xff, 0x05, 0xff, 0xff, 0x81,
+        0xdd, 0x1a, 0x1a, 0x00, 0x00, 0x81, 0x08, 0xc8, 0x02, 0xff, 0xff, 0x82, 0xff, 0xfd, 0x7c,
+        0x01, 0x0c, 0x00, 0x00, 0x81, 0x6f, 0xfe, 0x05, 0xff, 0xff, 0x81, 0xd3, 0x16, 0x1a, 0x00,
+        0x00, 0x81, 0x08, 0xc8, 0x02, 0xff, 0xff, 0x82, 0xff, 0xc1, 0x18, 0x00, 0x0c, 0x00, 0x00,
+        0x81, 0x3c, 0xee, 0x05, 0xff, 0xff, 0x81, 0xa0, 0x06, 0x1a, 0x00, 0x00, 0x81, 0x08, 0xc8,
+        0x02, 0xff, 0xff, 0x81, 0xef, 0x4c, 0x0d, 0x00, 0x00, 0x81, 0x0f, 0xbb, 0x04, 0xff, 0xff,
+        0x82, 0xff, 0xf7, 0x58, 0x00, 0x1a, 0x00, 0x00, 0x81, 0x08, 0xc8, 0x02, 0xff, 0xff, 0x81,
+        0x94, 0x06, 0x0d, 0x00, 0x00, 0x82, 0x00, 0x47, 0xe8, 0xff, 0x03, 0xff, 0xff, 0x82, 0xff,
+        0xa3, 0x0d, 0x00, 0x1a, 0x00, 0x00, 0x84, 0x08, 0xc8, 0xff, 0xff, 0xff, 0xd4, 0x26, 0x00,
+        0x0d, 0x00, 0x00, 0x82, 0x00, 0x02, 0x59, 0xde, 0x02, 0xff, 0xff, 0x82, 0xff, 0xf9, 0xa6,
+        0x1c, 0x1b, 0x00, 0x00, 0x83, 0x08, 0xc8, 0xff, 0xff, 0xf8, 0x63, 0x0f, 0x00, 0x00, 0x85,
+        0x00, 0x31, 0x8c, 0xc6, 0xea, 0xdc, 0xac, 0x60, 0x0e, 0x00, 0x1b, 0x00, 0x00, 0x83, 0x08,
+        0xc8, 0xff, 0xff, 0xac, 0x0d, 0x10, 0x00, 0x00, 0x83, 0x00, 0x15, 0x26, 0x20, 0x09, 0x00,
+        0x1c, 0x00, 0x00, 0x83, 0x08, 0xc8, 0xff, 0xe4, 0x38, 0x00, 0x2f, 0x00, 0x00, 0x82, 0x08,
+        0xc9, 0xff, 0x7c, 0x30, 0x00, 0x00, 0x82, 0x08, 0xcb, 0xc6, 0x17, 0x08, 0x00, 0x00, 0x82,
+        0x00, 0x16, 0x16, 0x00, 0x26, 0x00, 0x00, 0x82, 0x09, 0xb9, 0x50, 0x00, 0x08, 0x00, 0x00,
+        0x82, 0x39, 0xbf, 0xbf, 0x39, 0x26, 0x00, 0x00, 0x82, 0x09, 0x5e, 0x09, 0x00, 0x07, 0x00,
+        0x00, 0x84, 0x02, 0x51, 0xdb, 0xff, 0xff, 0xdb, 0x51, 0x02, 0x25, 0x00, 0x00, 0x81, 0x01,
+        0x06, 0x08, 0x00, 0x00, 0x81, 0x5b, 0xe8, 0x02, 0xff, 0xff, 0x81, 0xe8, 0x5b, 0x2d, 0x00,
+        0x00, 0x82, 0x00, 0x40, 0xe2, 0xff, 0x02, 0xff, 0xff, 0x82, 0xff, 0xe2, 0x40, 0x00, 0x2c,
+        0x00, 0x00, 0x81, 0x17, 0xc0, 0x04, 0xff, 0xff, 0x81, 0xc0, 0x17, 0x2c, 0x00, 0x00, 0x81,
+        0x68, 0xfc, 0x04, 0xff, 0xff, 0x81, 0xfc, 0x68, 0x2b, 0x00, 0x00, 0x82, 0x00, 0x0d, 0xbc,
+        0xff, 0x04, 0xff, 0xff, 0x82, 0xff, 0xbc, 0x0d, 0x00, 0x2a, 0x00, 0x00, 0x82, 0x00, 0x30,
+        0xe5, 0xff, 0x04, 0xff, 0xff, 0x82, 0xff, 0xe5, 0x30, 0x00, 0x2a, 0x00, 0x00, 0x82, 0x00,
+        0x44, 0xfa, 0xff, 0x04, 0xff, 0xff, 0x82, 0xff, 0xfa, 0x44, 0x00, 0x2a, 0x00, 0x00, 0x82,
+        0x00, 0x35, 0xea, 0xff, 0x04, 0xff, 0xff, 0x82, 0xff, 0xea, 0x35, 0x00, 0x2a, 0x00, 0x00,
+        0x82, 0x00, 0x11, 0xc3, 0xff, 0x04, 0xff, 0xff, 0x82, 0xff, 0xc3, 0x11, 0x00, 0x2b, 0x00,
+        0x00, 0x81, 0x71, 0xfd, 0x04, 0xff, 0xff, 0x81, 0xfd, 0x71, 0x2c, 0x00, 0x00, 0x81, 0x12,
+        0xab, 0x04, 0xff, 0xff, 0x81, 0xab, 0x12, 0x2c, 0x00, 0x00, 0x82, 0x00, 0x1a, 0x9b, 0xf1,
+        0x02, 0xff, 0xff, 0x82, 0xf1, 0x9b, 0x1a, 0x00, 0x2d, 0x00, 0x00, 0x84, 0x08, 0x45, 0x87,
+        0xbd, 0xbd, 0x87, 0x45, 0x08, 0x2f, 0x00, 0x00, 0x82, 0x01, 0x07, 0x07, 0x01, 0x7f, 0x00,
+        0x00, 0x2f, 0x00, 0x00,
 
 };
 
 const lv_image_dsc_t image_isolated_scattered_tstorms_day = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.cf = LV_COLOR_FORMAT_RGB565A8,
-    .header.flags = 0,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
     .header.w = 100,
     .header.h = 100,
     .header.stride = 200,
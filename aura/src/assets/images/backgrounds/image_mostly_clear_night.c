@@ -25,2013 +25,283 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_MOSTLY_CLEAR_NIGHT
     uint8_t image_mostly_clear_night_map[] = {
 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xc6, 0x00, 0x00, 0xff, 0xd6, 0x1f,
-        0xd7, 0x1f, 0xd7, 0x1f, 0xd7, 0x1f, 0xcf, 0xff, 0xce, 0x9e, 0xbe, 0xbf, 0xef, 0xdf, 0xef,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xe7, 0xde, 0xc6, 0xfe, 0xd6, 0x1f, 0xd7, 0x1f, 0xd7,
-        0xff, 0xce, 0xfe, 0xde, 0x1f, 0xd7, 0x1f, 0xd7, 0x1f, 0xd7, 0x1f, 0xd7, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd7, 0xdf, 0xce, 0x1f, 0xd7, 0x1f, 0xd7, 0xfd,
-        0xe6, 0x1f, 0xd7, 0x1f, 0xd7, 0x1f, 0xd7, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xdf, 0xc6, 0x9e, 0xc6, 0xbe, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xe7, 0xff, 0xce, 0x1f, 0xd7, 0x1f, 0xd7, 0xff, 0xe7,
-        0x1f, 0xd7, 0x1f, 0xd7, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xbe, 0xc6, 0xdf, 0xc6, 0x9b, 0xad,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xc6, 0xbf, 0xe7, 0xff, 0xce, 0x1f, 0xd7, 0x3f,
-        0xdf, 0x1f, 0xd7, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xbe, 0xc6, 0x7a,
-        0x9d, 0x3d, 0xb6, 0x7e, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xc6, 0x3f, 0xd7, 0xff, 0xce, 0x1f, 0xd7,
-        0xdf, 0xce, 0x1f, 0xd7, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xdf, 0xce, 0x7e, 0xbe, 0x9e, 0xbe, 0xff, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xd7, 0xfd, 0xde, 0x1f,
-        0xd7, 0xdf, 0xce, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0x7d, 0xc6, 0x7d, 0xc6, 0x3c, 0xbe, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xc6, 0x3f, 0xd7,
-        0x1f, 0xd7, 0x1f, 0xcf, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xbe, 0xc6, 0xbf, 0xc6, 0xfe,
-        0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe,
-        0xd6, 0x3f, 0xd7, 0x1f, 0xd7, 0x1f, 0xd7, 0x1f, 0xd7, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce,
-        0x7e, 0xbe, 0x5d, 0xbe, 0x7d, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xbf, 0xce, 0xda, 0xc5, 0x1f, 0xd7, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xbf, 0xc6, 0xfd, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xce, 0xdf, 0xce, 0x1f, 0xd7, 0x1f, 0xd7, 0x1f, 0xcf,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xde, 0xce, 0xde, 0xce, 0xff, 0xce, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd7, 0xff, 0xd6, 0x5f, 0xd7, 0x1f,
-        0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xbe, 0xce,
-        0xde, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd7, 0x1f, 0xd7,
-        0xdf, 0xc6, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xdf, 0xc6, 0xbe, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe,
-        0xce, 0x1f, 0xd7, 0xdd, 0xff, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xbf, 0xce, 0xde, 0xce, 0x5f, 0xd7, 0x1f, 0xd7, 0x1f, 0xcf, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0xbe, 0xce, 0x1f, 0xd7, 0x1f, 0xd7, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xbf, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xc6, 0x1f, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xd7,
-        0xff, 0xce, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x1f, 0xd7, 0x1f, 0xd7, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xbe, 0xce, 0x3f, 0xd7, 0xdf, 0xc6, 0x1f, 0xd7, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xd7, 0x1f, 0xd7, 0xff, 0xd6,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xe7, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x7e,
-        0xc6, 0x9e, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x59, 0xf7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0x15, 0xfc, 0xdf, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xe7, 0xff, 0xd6, 0xfe, 0xd6, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xbf, 0xbe, 0x5f, 0xe7, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xbe, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0x5f, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xd7, 0x3f, 0xdf, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xbf, 0xbe, 0x7f, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdc, 0xcd, 0xbe, 0xce, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd7, 0x5f, 0xe7, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xce, 0xff, 0xce,
-        0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0x1f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x9f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xcf, 0xff, 0xce, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
-        0xcf, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xbe, 0xc6,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7f, 0xc7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xde, 0xce, 0x9e, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xcf, 0x1f, 0xd7, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
-        0xd7, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xcf, 0x1f, 0xcf, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xdf, 0xce, 0x3f, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0x1f, 0xd7, 0x1f, 0xcf, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0x1f, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xbf, 0xbe, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0x1f, 0xd7, 0x1f,
-        0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf,
-        0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xdf, 0xce, 0xbf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0xff, 0xd6, 0xff, 0xd6, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f,
-        0xcf, 0xde, 0xce, 0x5f, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf,
-        0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0x1f, 0xd7, 0xfe, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xbf, 0xa6, 0xfe, 0xd6,
-        0x1f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0x3f, 0xae, 0x5f, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xd6, 0xff, 0xce, 0xff, 0xce, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xfb, 0xe6, 0xff, 0xd6, 0x1f, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x3f, 0xd7, 0x5f, 0xe7, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce,
-        0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0xff,
-        0xce, 0xdf, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x9e, 0xc6, 0x7d, 0xbe, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xfe, 0xd6, 0x3e, 0xdf, 0x3e, 0xe7, 0x5e, 0xe7, 0x5e, 0xe7,
-        0x3e, 0xdf, 0x1e, 0xd7, 0xff, 0xce, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xff, 0xce, 0x3e, 0xdf, 0x5e, 0xef, 0x7e, 0xef, 0x7d, 0xef, 0x7d,
-        0xf7, 0x9d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x9e, 0xf7, 0x7e, 0xef, 0x5e, 0xe7, 0x1e, 0xd7,
-        0xdf, 0xc6, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xce, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xd6, 0xff, 0xce,
-        0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
-        0xcf, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0x1e, 0xd7, 0x7e, 0xef, 0x9e, 0xf7, 0x7d, 0xf7,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x9d, 0xf7, 0x7e, 0xef, 0x3e, 0xdf, 0xde, 0xce, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0x1f, 0xd7, 0x1f, 0xd7, 0x9f, 0xbe, 0x5f, 0xe7, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x3d, 0xe7, 0x1f, 0xd7, 0xff, 0xce, 0x3e, 0xdf, 0x7e, 0xef, 0x7d,
-        0xf7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xf7, 0x5e, 0xe7, 0xde,
-        0xce, 0x9e, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce,
-        0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0xff, 0xce, 0x5c,
-        0xd6, 0x9e, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd7, 0x1d, 0xdf, 0x3a, 0xce, 0x7e, 0xef,
-        0x9e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xf7, 0x7e, 0xef, 0xde, 0xce, 0x9e, 0xbe, 0xbe, 0xc6, 0xbf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xce, 0x5f, 0xe7, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x14, 0x9c,
-        0xff, 0x5e, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xf7, 0x5e, 0xe7, 0xbe, 0xc6,
-        0x9e, 0xbe, 0xbe, 0xc6, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0xfe, 0xce, 0xff, 0xce,
-        0x9f, 0xc6, 0x1f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x3f, 0xdf, 0x5d, 0xef, 0x5e, 0xe7, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x1e, 0xd7, 0x9e, 0xbe, 0x9e, 0xbe, 0xbe, 0xc6, 0xbf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xff,
-        0xce, 0xff, 0xce, 0xff, 0xd6, 0xff, 0xce, 0xde, 0xce, 0xde, 0xce, 0x5f, 0xe7, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xbf, 0x9b, 0xff, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5e, 0xef, 0xbe, 0xc6, 0x9e, 0xbe, 0x9e,
-        0xbe, 0xbf, 0xc6, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x3f, 0xcf, 0x1f,
-        0xd7, 0x3f, 0xd7, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xdf, 0x3d, 0xe7, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x3e, 0xdf, 0xde, 0xce, 0xfe, 0xd6, 0xfe, 0xd6, 0xfe, 0xd6, 0xfe, 0xce, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0x1f, 0xcf, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7d, 0xf7, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x9d, 0xf7, 0x9e, 0xf7, 0x9e, 0xf7, 0x9e, 0xf7, 0x7e, 0xef,
-        0x7e, 0xef, 0x5e, 0xe7, 0xfe, 0xd6, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce,
-        0x1f, 0xcf, 0x1f, 0xd7, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xff, 0x5e, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xf7, 0x7e, 0xef, 0x1e, 0xdf, 0xbf, 0xc6,
-        0xbf, 0xc6, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0xff, 0xce, 0xff, 0xd6, 0x1f, 0xd7,
-        0x1f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xae, 0x5e, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7e, 0xef, 0x1e, 0xdf, 0xbe, 0xc6, 0xbe, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff,
-        0xce, 0x1f, 0xd7, 0x5f, 0xe7, 0x1f, 0xcf, 0x1f, 0xd7, 0xff, 0xd6, 0xff, 0xf7, 0xbf, 0xce,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0xde, 0xce, 0x9e, 0xbe, 0xbe,
-        0xc6, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0x1f,
-        0xdf, 0xdf, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0x1f, 0xd7, 0xbf, 0xce, 0xff, 0xff, 0x5f, 0xe7,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xdf, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xf7,
-        0x3d, 0xe7, 0x7e, 0xbe, 0x9e, 0xbe, 0xbf, 0xc6, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xcf, 0x1f, 0xd7, 0x1f, 0xd7, 0x5f,
-        0xb7, 0xdf, 0xc6, 0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xcf, 0x1f, 0xcf, 0x1f, 0xcf,
-        0x1f, 0xd7, 0x1f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xff, 0x5d, 0xe7, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x9d, 0xc6, 0x5d, 0xb6, 0x9e, 0xbe, 0xbf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf,
-        0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xff, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0x1f, 0xcf, 0x1f, 0xcf, 0xff, 0xce, 0xff, 0xce, 0x1f,
-        0xd7, 0x1f, 0xd7, 0x1f, 0xd7, 0xfe, 0xd6, 0x1f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0xbd, 0xff, 0x5e, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0xdd, 0xd6, 0x1d,
-        0xb6, 0x5e, 0xbe, 0xbe, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xdf, 0xce,
-        0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce,
-        0xff, 0xce, 0xff, 0xce, 0xff, 0xce, 0xdf, 0xce, 0xdf, 0xc6, 0x7d, 0x95, 0x1f, 0xd7, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xe7, 0x3d, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x9d, 0xf7, 0xfd, 0xde, 0x1d, 0xb6, 0x3d, 0xb6, 0x7e, 0xbe, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0x9e, 0xbe, 0x3d, 0xb6,
-        0x7e, 0xbe, 0x1f, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xbe, 0x5d, 0xbe, 0x5d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xf7, 0xfd, 0xde, 0x1d, 0xb6, 0x3d, 0xb6, 0x5d, 0xb6,
-        0x9e, 0xbe, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xce, 0xdf, 0xce, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbe,
-        0xc6, 0x5e, 0xbe, 0x7e, 0xbe, 0x7f, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x5d, 0xbe, 0x3c, 0xef, 0x1d, 0xdf, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0xbd, 0xce, 0x1d,
-        0xb6, 0x3d, 0xb6, 0x5d, 0xb6, 0x5e, 0xb6, 0x9e, 0xbe, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xbf, 0xc6, 0x7e, 0xbe, 0x9e, 0xbe, 0xbf, 0xc6, 0x5d, 0xbe, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xe7, 0x9b, 0xce, 0x3b, 0xbe, 0x3d, 0xe7, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x5d, 0xef, 0x5d, 0xc6, 0x1d, 0xb6, 0x3d, 0xb6, 0x5d, 0xb6, 0x5e, 0xbe, 0x7e, 0xbe, 0x9e,
-        0xbe, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0x9e, 0xc6, 0x9e, 0xbe, 0x1d, 0xb6, 0x5e, 0xb6,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xde, 0xfc,
-        0xde, 0xfc, 0xde, 0x3d, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0xfd, 0xde, 0x1d, 0xb6, 0x3d, 0xb6, 0x3d, 0xb6, 0x5d, 0xb6,
-        0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0xbe, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0x9e, 0xc6, 0xff, 0xf7, 0x5d,
-        0xbe, 0x9e, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xbd, 0xa5, 0x7c, 0xef, 0xdc, 0xd6, 0x3d, 0xe7, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xe7, 0x5c, 0xbe, 0x1d, 0xb6, 0x3d,
-        0xb6, 0x3d, 0xb6, 0x5e, 0xb6, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0xbf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0x9e, 0xbe,
-        0x5b, 0xa5, 0x5d, 0xb6, 0x5d, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xc6, 0x3d, 0xb6, 0xfb, 0xff,
-        0xdc, 0xd6, 0x3c, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x7c, 0xc6,
-        0x1d, 0xb6, 0x1d, 0xb6, 0x3d, 0xb6, 0x5d, 0xb6, 0x5e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e,
-        0xbe, 0x7e, 0xbe, 0x9e, 0xbe, 0xbe, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf,
-        0xc6, 0x9e, 0xbe, 0x5a, 0x9d, 0x5d, 0xbe, 0x5d, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x3c, 0xbe, 0x1c, 0xb6, 0xfc, 0xde, 0xfc, 0xde, 0x1c, 0xdf, 0x3d, 0xe7, 0x5d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x1c,
-        0xe7, 0x7c, 0xc6, 0x1d, 0xb6, 0x1d, 0xb6, 0x3d, 0xb6, 0x3d, 0xb6, 0x5d, 0xb6, 0x7e, 0xbe,
-        0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0xbe, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xbe, 0xc6, 0x9e, 0xbe, 0xff, 0xff, 0x5d, 0xb6, 0x5d, 0xbe, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xe7, 0x5c, 0xef, 0x3c, 0xe7, 0x13,
-        0x00, 0xbb, 0xd6, 0x1c, 0xdf, 0x3c, 0xe7, 0x5d, 0xe7, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-        0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d,
-        0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3d, 0xe7,
-        0x1c, 0xdf, 0xbc, 0xce, 0x3c, 0xb6, 0x1d, 0xb6, 0x3d, 0xb6, 0x3d, 0xb6, 0x3d, 0xb6, 0x5d,
-        0xb6, 0x5e, 0xb6, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe,
-        0x9e, 0xbe, 0x9e, 0xbe, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0x9e, 0xc6, 0x5e, 0xb6, 0x7e, 0xbe, 0x5d, 0xbe, 0x5d, 0xbe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x3c, 0xbe, 0x5d, 0xbe, 0xbf, 0x85, 0xdb, 0xd6, 0xfb, 0xff, 0x9c, 0xc6, 0xbe, 0xce, 0xdc,
-        0xde, 0xdb, 0xde, 0xfb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xfb, 0xde, 0xfb, 0xde,
-        0x7b, 0xce, 0x3c, 0xbe, 0x3c, 0xbe, 0x5c, 0xbe, 0x5c, 0xbe, 0x5c, 0xbe, 0x5c, 0xbe, 0x5c,
-        0xbe, 0x5c, 0xbe, 0x3c, 0xbe, 0x3c, 0xb6, 0x1d, 0xb6, 0x3d, 0xb6, 0x3d, 0xb6, 0x3d, 0xb6,
-        0x5d, 0xb6, 0x5d, 0xb6, 0x5e, 0xb6, 0x7e, 0xbe, 0x7e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e,
-        0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0xbf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0x9e, 0xbe, 0x5e, 0xbe, 0x7e, 0xbe, 0x3d,
-        0xbe, 0xbf, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xbe, 0x3b, 0x95, 0xbc, 0xce,
-        0x9d, 0xce, 0xbe, 0xc6, 0xdc, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb,
-        0xde, 0xdb, 0xde, 0xdb, 0xd6, 0xff, 0x7c, 0xfd, 0xad, 0x1d, 0xb6, 0x3d, 0xb6, 0x5d, 0xb6,
-        0x5d, 0xb6, 0x5d, 0xb6, 0x5d, 0xb6, 0x5d, 0xb6, 0x5d, 0xb6, 0x5d, 0xb6, 0x5d, 0xb6, 0x5d,
-        0xb6, 0x5d, 0xb6, 0x5d, 0xb6, 0x5e, 0xb6, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x9e, 0xbe,
-        0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-        0xbe, 0xbe, 0xbe, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0x7e, 0xbe, 0x3d, 0xb6,
-        0x5e, 0xb6, 0x5e, 0xb6, 0x5e, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xc6, 0x1d, 0xae, 0x3d, 0xb6, 0x9c, 0xa5, 0x3d,
-        0xb6, 0x1d, 0xb6, 0x3d, 0xb6, 0x5e, 0xb6, 0x5e, 0xb6, 0x5e, 0xb6, 0x5e, 0xb6, 0x5e, 0xb6,
-        0x5e, 0xb6, 0x5e, 0xb6, 0x5e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e,
-        0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
-        0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xc6, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0x7e, 0xbe, 0x7e,
-        0xbe, 0xbf, 0xbe, 0x5e, 0xbe, 0x5e, 0xb6, 0xbe, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7e, 0xbe, 0x1f, 0xd7, 0x1d, 0xae, 0xb9, 0x8c, 0x3d, 0xb6, 0x3d, 0xb6, 0x5e, 0xb6, 0x7e,
-        0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe,
-        0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0xbe, 0xc6, 0xbe,
-        0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6,
-        0xbe, 0xc6, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf,
-        0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0x9e, 0xbe,
-        0x7e, 0xbe, 0xdc, 0xad, 0x7e, 0xbe, 0x7d, 0xbe, 0x7d, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xc6, 0x5b, 0x95, 0xdc, 0xad, 0x1d, 0xae,
-        0x3d, 0xb6, 0x3d, 0xb6, 0x5e, 0xb6, 0x7e, 0xbe, 0x7e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e,
-        0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xc6, 0x9e, 0xc6,
-        0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe,
-        0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6,
-        0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0x9e,
-        0xbe, 0x7e, 0xbe, 0x3d, 0xb6, 0x7e, 0xbe, 0x3d, 0xb6, 0x3f, 0xa6, 0x3c, 0xbe, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x1f, 0xdf, 0xff, 0xff, 0x3d, 0xb6, 0x3d, 0xb6, 0x7e, 0xbe, 0x5d, 0xb6, 0x5e, 0xbe,
-        0x7e, 0xbe, 0x9e, 0xbe, 0x9e, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe,
-        0xc6, 0xbe, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6,
-        0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe, 0xc6, 0xbe,
-        0xc6, 0xbf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xdf, 0xc6, 0xbf, 0xc6, 0xbe, 0xc6,
-        0x9e, 0xbe, 0x9e, 0xbe, 0x3d, 0xb6, 0x7e, 0xbe, 0x5e, 0xbe, 0x5e, 0xbe, 0xbe, 0xce, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xe7, 0x3b, 0x8d, 0x7e,
-        0xbe, 0x5d, 0xb6, 0x0e, 0x70, 0x3d, 0xb6, 0x5e, 0xb6, 0x7e, 0xbe, 0x7e, 0xbe, 0x9e, 0xbe,
-        0x9e, 0xc6, 0xbe, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf,
-        0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6,
-        0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbe, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbe, 0xc6, 0x9e,
-        0xbe, 0x9e, 0xbe, 0x7e, 0xbe, 0x9b, 0xa5, 0x9e, 0xbe, 0x5e, 0xb6, 0x7e, 0xce, 0x9e, 0xc6,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xb6, 0x5e, 0xbe, 0x3d, 0xb6, 0x5e, 0xbe, 0xba,
-        0xad, 0x1d, 0xb6, 0x7e, 0xbe, 0x5e, 0xbe, 0x7e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe,
-        0x9e, 0xc6, 0xbe, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf, 0xc6, 0xbf,
-        0xc6, 0xbe, 0xc6, 0x9e, 0xc6, 0x9e, 0xbe, 0x9e, 0xbe, 0x9e, 0xbe, 0x7e, 0xbe, 0x5e, 0xbe,
-        0x7e, 0xbe, 0x5d, 0xb6, 0x1c, 0xae, 0x9e, 0xbe, 0x7e, 0xbe, 0x3d, 0xb6, 0x5e, 0xb6, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x5f, 0xe7, 0xbc, 0xa5, 0x5d, 0xbe, 0x3d, 0xb6, 0x5d, 0xb6, 0x9e, 0xbe, 0xdb, 0xb5, 0x3d,
-        0xb6, 0x5d, 0xb6, 0x7e, 0xbe, 0x9e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe,
-        0x5e, 0xb6, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x7e, 0xbe, 0x5d, 0xbe, 0x3d, 0xb6, 0x3d,
-        0xb6, 0xde, 0xce, 0xbe, 0xc6, 0x9e, 0xbe, 0x5e, 0xb6, 0x5d, 0xbe, 0x9a, 0x8d, 0xbf, 0xce,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xc6,
-        0xff, 0xff, 0x5d, 0xbe, 0x5d, 0xb6, 0x5e, 0xb6, 0x5d, 0xb6, 0x7e, 0xbe, 0xbf, 0xc6, 0xdf,
-        0xc6, 0xff, 0xce, 0x5f, 0xd7, 0x7f, 0xd7, 0x1f, 0xcf, 0xdf, 0xc6, 0xbf, 0xc6, 0x7e, 0xbe,
-        0x5d, 0xb6, 0x3d, 0xb6, 0x5e, 0xb6, 0xde, 0xc6, 0x94, 0x52, 0x1f, 0xcf, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x15, 0x2d, 0x40, 0x55, 0x6f, 0x7c, 0x20, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1a, 0x3f,
-        0x7e, 0xa5, 0xc4, 0xea, 0xf7, 0xf9, 0xff, 0xa7, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x58, 0x9a, 0xce, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xe6, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x35, 0x84,
-        0xd0, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x03, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x40, 0xa2, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x39,
-        0x9e, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0x94, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x85, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x3e, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x05, 0x4e, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xb2, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x88, 0xf0, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5e,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x2a, 0xac, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xd0, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xa2, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x58, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0x53, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xe7, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xbb, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x3e, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x91, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd0, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xf7, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x04, 0x84, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x28, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xee, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x23, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xb5, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8b,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0x02, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x0b, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xf1, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x3e, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0x04, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x57, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xd2, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xa0, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x36, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-        0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xfd, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xfe, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x01, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x04, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xc5,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xf1, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x68, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x3e, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xf9,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xe8, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x14, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xf8, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xb9, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x56, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xfb, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x6e, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x2e, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xf9,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xf6, 0x6a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x2c, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4,
-        0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xc4,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0x25, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7c, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xfe, 0xa6, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
-        0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x9a, 0x12,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xe0, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xa2, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0x70, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xed,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xc7, 0x3c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x6e, 0x0c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x75, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xa3, 0x2b, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xc8, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x6d, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xfb, 0xbc, 0x4e, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xaf,
-        0x52, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9f, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xbf, 0x65, 0x24, 0x02,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xda, 0xa2, 0x54, 0x1f, 0x03, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x02, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xd5, 0xa8, 0x78, 0x3e, 0x21, 0x0a, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xfe, 0xf5, 0xda, 0xb0, 0x9d, 0x88, 0x5e, 0x3f, 0x32, 0x2a, 0x2a, 0x18,
-        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xf9, 0xf3, 0xf0, 0xf0, 0xe6, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x2c, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x9b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xad, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x1f, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x0a, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xe5, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xd0,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x58, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xdc, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xea, 0x5e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x58, 0x01,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x1c, 0x81, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x73,
-        0xba, 0xdd, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xbb, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x27, 0x47, 0x57, 0x58,
-        0x58, 0x58, 0x58, 0x58, 0x57, 0x8a, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x90, 0x19, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x04, 0x4f, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xd3, 0x5b, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x86, 0xe5,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x94, 0x27, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x37, 0xa4, 0xee, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xf3, 0xaf, 0x45, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x44, 0xa0, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xb1, 0x4e, 0x0b,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x07, 0x39, 0x89, 0xd3, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xfa, 0xdc, 0x96, 0x40, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1c, 0x58, 0x9c, 0xd2, 0xf4, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xdb, 0xa2, 0x61, 0x21,
-        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x3f,
-        0x7c, 0xa5, 0xc3, 0xe9, 0xf6, 0xf8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf9,
-        0xf7, 0xef, 0xcc, 0xab, 0x84, 0x47, 0x21, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x14, 0x2c, 0x3b,
-        0x4f, 0x6b, 0x83, 0x93, 0xa2, 0xa3, 0x94, 0x89, 0x6d, 0x53, 0x40, 0x30, 0x1a, 0x05, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0x00, 0x00, 0x30, 0x75, 0x00, 0x00, 0x7f, 0x00, 0x00,
+        0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x68, 0x00, 0x00,
+        0x83, 0x9e, 0xc6, 0x00, 0x00, 0xff, 0xd6, 0x03, 0x1f, 0xd7, 0x85, 0x1f, 0xcf, 0xff, 0xce,
+        0x9e, 0xbe, 0xbf, 0xef, 0xdf, 0xef, 0x55, 0x00, 0x00, 0x83, 0x5f, 0xe7, 0xde, 0xc6, 0xfe,
+        0xd6, 0x02, 0x1f, 0xd7, 0x82, 0xff, 0xce, 0xfe, 0xde, 0x04, 0x1f, 0xd7, 0x04, 0xff, 0xce,
+        0x53, 0x00, 0x00, 0x82, 0x1f, 0xd7, 0xdf, 0xce, 0x02, 0x1f, 0xd7, 0x81, 0xfd, 0xe6, 0x04,
+        0x1f, 0xd7, 0x05, 0xff, 0xce, 0x83, 0xdf, 0xc6, 0x9e, 0xc6, 0xbe, 0xc6, 0x50, 0x00, 0x00,
+        0x82, 0x5f, 0xe7, 0xff, 0xce, 0x02, 0x1f, 0xd7, 0x81, 0xff, 0xe7, 0x03, 0x1f, 0xd7, 0x08,
+        0xff, 0xce, 0x84, 0xdf, 0xce, 0xbe, 0xc6, 0xdf, 0xc6, 0x9b, 0xad, 0x4e, 0x00, 0x00, 0x85,
+        0xbe, 0xc6, 0xbf, 0xe7, 0xff, 0xce, 0x1f, 0xd7, 0x3f, 0xdf, 0x02, 0x1f, 0xd7, 0x0b, 0xff,
+        0xce, 0x84, 0xbe, 0xc6, 0x7a, 0x9d, 0x3d, 0xb6, 0x7e, 0xbe, 0x4c, 0x00, 0x00, 0x85, 0x9e,
+        0xc6, 0x3f, 0xd7, 0xff, 0xce, 0x1f, 0xd7, 0xdf, 0xce, 0x02, 0x1f, 0xd7, 0x0c, 0xff, 0xce,
+        0x84, 0xdf, 0xce, 0x7e, 0xbe, 0x9e, 0xbe, 0xff, 0xef, 0x4c, 0x00, 0x00, 0x85, 0x1e, 0xd7,
+        0xfd, 0xde, 0x1f, 0xd7, 0xdf, 0xce, 0x1f, 0xd7, 0x0f, 0xff, 0xce, 0x81, 0xdf, 0xce, 0x02,
+        0x7d, 0xc6, 0x81, 0x3c, 0xbe, 0x4a, 0x00, 0x00, 0x85, 0x9e, 0xc6, 0x3f, 0xd7, 0x1f, 0xd7,
+        0x1f, 0xcf, 0x1f, 0xd7, 0x10, 0xff, 0xce, 0x84, 0xdf, 0xce, 0xbe, 0xc6, 0xbf, 0xc6, 0xfe,
+        0xc5, 0x4a, 0x00, 0x00, 0x82, 0xfe, 0xd6, 0x3f, 0xd7, 0x04, 0x1f, 0xd7, 0x10, 0xff, 0xce,
+        0x84, 0xdf, 0xce, 0x7e, 0xbe, 0x5d, 0xbe, 0x7d, 0xbe, 0x49, 0x00, 0x00, 0x82, 0xbf, 0xce,
+        0xda, 0xc5, 0x02, 0x1f, 0xd7, 0x14, 0xff, 0xce, 0x82, 0xbf, 0xc6, 0xfd, 0xad, 0x49, 0x00,
+        0x00, 0x82, 0xbe, 0xce, 0xdf, 0xce, 0x02, 0x1f, 0xd7, 0x81, 0x1f, 0xcf, 0x13, 0xff, 0xce,
+        0x02, 0xde, 0xce, 0x81, 0xff, 0xce, 0x48, 0x00, 0x00, 0x84, 0x1f, 0xd7, 0xff, 0xd6, 0x5f,
+        0xd7, 0x1f, 0xd7, 0x14, 0xff, 0xce, 0x83, 0xdf, 0xce, 0xbe, 0xce, 0xde, 0xce, 0x48, 0x00,
+        0x00, 0x02, 0x1f, 0xd7, 0x82, 0xdf, 0xc6, 0x1f, 0xd7, 0x16, 0xff, 0xce, 0x82, 0xdf, 0xc6,
+        0xbe, 0xce, 0x47, 0x00, 0x00, 0x84, 0xbe, 0xce, 0x1f, 0xd7, 0xdd, 0xff, 0x1f, 0xd7, 0x16,
+        0xff, 0xce, 0x02, 0xdf, 0xce, 0x47, 0x00, 0x00, 0x85, 0xbf, 0xce, 0xde, 0xce, 0x5f, 0xd7,
+        0x1f, 0xd7, 0x1f, 0xcf, 0x16, 0xff, 0xce, 0x02, 0xdf, 0xce, 0x46, 0x00, 0x00, 0x82, 0xff,
+        0xce, 0xbe, 0xce, 0x02, 0x1f, 0xd7, 0x18, 0xff, 0xce, 0x81, 0xbf, 0xbe, 0x46, 0x00, 0x00,
+        0x81, 0x9e, 0xc6, 0x1c, 0xff, 0xce, 0x82, 0xff, 0xc6, 0x1f, 0xcf, 0x45, 0x00, 0x00, 0x83,
+        0x3f, 0xd7, 0xff, 0xce, 0xdf, 0xce, 0x1b, 0xff, 0xce, 0x45, 0x00, 0x00, 0x03, 0x1f, 0xd7,
+        0x1c, 0xff, 0xce, 0x44, 0x00, 0x00, 0x84, 0xbe, 0xce, 0x3f, 0xd7, 0xdf, 0xc6, 0x1f, 0xd7,
+        0x1c, 0xff, 0xce, 0x44, 0x00, 0x00, 0x83, 0x5f, 0xd7, 0x1f, 0xd7, 0xff, 0xd6, 0x1d, 0xff,
+        0xce, 0x43, 0x00, 0x00, 0x81, 0x5f, 0xe7, 0x1e, 0xff, 0xce, 0x82, 0x7e, 0xc6, 0x9e, 0xc6,
+        0x43, 0x00, 0x00, 0x81, 0x59, 0xf7, 0x1e, 0xff, 0xce, 0x82, 0x15, 0xfc, 0xdf, 0xce, 0x42,
+        0x00, 0x00, 0x83, 0x5f, 0xe7, 0xff, 0xd6, 0xfe, 0xd6, 0x1d, 0xff, 0xce, 0x82, 0xbf, 0xbe,
+        0x5f, 0xe7, 0x42, 0x00, 0x00, 0x81, 0xdf, 0xbe, 0x20, 0xff, 0xce, 0x81, 0x5f, 0xe7, 0x42,
+        0x00, 0x00, 0x82, 0x1f, 0xd7, 0x3f, 0xdf, 0x1e, 0xff, 0xce, 0x82, 0xbf, 0xbe, 0x7f, 0xef,
+        0x41, 0x00, 0x00, 0x81, 0x1f, 0xd7, 0x20, 0xff, 0xce, 0x82, 0xdc, 0xcd, 0xbe, 0xce, 0x41,
+        0x00, 0x00, 0x82, 0x1f, 0xd7, 0x5f, 0xe7, 0x1f, 0xff, 0xce, 0x02, 0xdf, 0xce, 0x40, 0x00,
+        0x00, 0x83, 0xbf, 0xce, 0xff, 0xce, 0x1f, 0xd7, 0x1f, 0xff, 0xce, 0x02, 0x1f, 0xd7, 0x40,
+        0x00, 0x00, 0x81, 0x9f, 0xd7, 0x21, 0xff, 0xce, 0x82, 0x1f, 0xcf, 0xff, 0xce, 0x40, 0x00,
+        0x00, 0x82, 0xff, 0xce, 0x1f, 0xd7, 0x22, 0xff, 0xce, 0x40, 0x00, 0x00, 0x22, 0xff, 0xce,
+        0x82, 0xdf, 0xce, 0xff, 0xce, 0x3f, 0x00, 0x00, 0x81, 0x1f, 0xcf, 0x23, 0xff, 0xce, 0x82,
+        0xdf, 0xce, 0xbe, 0xc6, 0x3e, 0x00, 0x00, 0x81, 0x7f, 0xc7, 0x23, 0xff, 0xce, 0x82, 0xde,
+        0xce, 0x9e, 0xc6, 0x3e, 0x00, 0x00, 0x82, 0x1f, 0xcf, 0x1f, 0xd7, 0x24, 0xff, 0xce, 0x3e,
+        0x00, 0x00, 0x02, 0x1f, 0xd7, 0x24, 0xff, 0xce, 0x3e, 0x00, 0x00, 0x02, 0x1f, 0xcf, 0x23,
+        0xff, 0xce, 0x82, 0xdf, 0xce, 0x3f, 0xdf, 0x3d, 0x00, 0x00, 0x25, 0xff, 0xce, 0x02, 0x1f,
+        0xd7, 0x81, 0x1f, 0xcf, 0x3c, 0x00, 0x00, 0x81, 0xdf, 0xce, 0x26, 0xff, 0xce, 0x81, 0x1f,
+        0xcf, 0x3c, 0x00, 0x00, 0x81, 0xdf, 0xc6, 0x25, 0xff, 0xce, 0x82, 0xbf, 0xbe, 0xff, 0xce,
+        0x3c, 0x00, 0x00, 0x81, 0xdf, 0xc6, 0x25, 0xff, 0xce, 0x03, 0x1f, 0xd7, 0x3b, 0x00, 0x00,
+        0x81, 0xdf, 0xc6, 0x26, 0xff, 0xce, 0x82, 0xdf, 0xce, 0xbf, 0xff, 0x3b, 0x00, 0x00, 0x81,
+        0xdf, 0xce, 0x26, 0xff, 0xce, 0x81, 0x1f, 0xd7, 0x02, 0xff, 0xd6, 0x3a, 0x00, 0x00, 0x81,
+        0xdf, 0xce, 0x27, 0xff, 0xce, 0x83, 0x1f, 0xcf, 0xde, 0xce, 0x5f, 0xe7, 0x39, 0x00, 0x00,
+        0x81, 0xdf, 0xc6, 0x27, 0xff, 0xce, 0x02, 0x1f, 0xd7, 0x81, 0xfe, 0xce, 0x39, 0x00, 0x00,
+        0x81, 0xdf, 0xc6, 0x28, 0xff, 0xce, 0x83, 0xbf, 0xa6, 0xfe, 0xd6, 0x1f, 0xd7, 0x38, 0x00,
+        0x00, 0x81, 0xdf, 0xc6, 0x2a, 0xff, 0xce, 0x82, 0x3f, 0xae, 0x5f, 0xe7, 0x37, 0x00, 0x00,
+        0x2a, 0xff, 0xce, 0x81, 0xff, 0xd6, 0x02, 0xff, 0xce, 0x37, 0x00, 0x00, 0x81, 0xdf, 0xce,
+        0x2a, 0xff, 0xce, 0x83, 0xfb, 0xe6, 0xff, 0xd6, 0x1f, 0xcf, 0x36, 0x00, 0x00, 0x02, 0xdf,
+        0xc6, 0x81, 0xdf, 0xce, 0x03, 0xff, 0xce, 0x10, 0xdf, 0xce, 0x17, 0xff, 0xce, 0x82, 0x3f,
+        0xd7, 0x5f, 0xe7, 0x35, 0x00, 0x00, 0x04, 0xff, 0xce, 0x02, 0xdf, 0xce, 0x10, 0xdf, 0xc6,
+        0x02, 0xdf, 0xce, 0x14, 0xff, 0xce, 0x83, 0x1f, 0xd7, 0xff, 0xce, 0xdf, 0xc6, 0x35, 0x00,
+        0x00, 0x82, 0x9e, 0xc6, 0x7d, 0xbe, 0x05, 0xdf, 0xc6, 0x84, 0xdf, 0xce, 0xfe, 0xd6, 0x3e,
+        0xdf, 0x3e, 0xe7, 0x02, 0x5e, 0xe7, 0x83, 0x3e, 0xdf, 0x1e, 0xd7, 0xff, 0xce, 0x08, 0xdf,
+        0xc6, 0x02, 0xdf, 0xce, 0x16, 0xff, 0xce, 0x34, 0x00, 0x00, 0x81, 0xff, 0xff, 0x04, 0xdf,
+        0xc6, 0x87, 0xff, 0xce, 0x3e, 0xdf, 0x5e, 0xef, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xf7, 0x9d,
+        0xf7, 0x02, 0x7d, 0xf7, 0x86, 0x9e, 0xf7, 0x7e, 0xef, 0x5e, 0xe7, 0x1e, 0xd7, 0xdf, 0xc6,
+        0xbf, 0xc6, 0x05, 0xdf, 0xc6, 0x02, 0xdf, 0xce, 0x13, 0xff, 0xce, 0x81, 0xff, 0xd6, 0x02,
+        0xff, 0xce, 0x33, 0x00, 0x00, 0x81, 0x1f, 0xcf, 0x03, 0xdf, 0xc6, 0x84, 0x1e, 0xd7, 0x7e,
+        0xef, 0x9e, 0xf7, 0x7d, 0xf7, 0x08, 0x7d, 0xef, 0x84, 0x9d, 0xf7, 0x7e, 0xef, 0x3e, 0xdf,
+        0xde, 0xce, 0x03, 0xbf, 0xc6, 0x03, 0xdf, 0xc6, 0x02, 0xdf, 0xce, 0x0f, 0xff, 0xce, 0x02,
+        0xdf, 0xce, 0x02, 0xff, 0xce, 0x02, 0x1f, 0xd7, 0x82, 0x9f, 0xbe, 0x5f, 0xe7, 0x31, 0x00,
+        0x00, 0x86, 0x3d, 0xe7, 0x1f, 0xd7, 0xff, 0xce, 0x3e, 0xdf, 0x7e, 0xef, 0x7d, 0xf7, 0x0c,
+        0x7d, 0xef, 0x84, 0x7d, 0xf7, 0x5e, 0xe7, 0xde, 0xce, 0x9e, 0xc6, 0x02, 0xbf, 0xc6, 0x03,
+        0xdf, 0xc6, 0x02, 0xdf, 0xce, 0x0c, 0xff, 0xce, 0x05, 0xdf, 0xce, 0x02, 0xff, 0xce, 0x84,
+        0x1f, 0xd7, 0xff, 0xce, 0x5c, 0xd6, 0x9e, 0xc6, 0x2f, 0x00, 0x00, 0x85, 0x1f, 0xd7, 0x1d,
+        0xdf, 0x3a, 0xce, 0x7e, 0xef, 0x9e, 0xef, 0x0f, 0x7d, 0xef, 0x86, 0x7d, 0xf7, 0x7e, 0xef,
+        0xde, 0xce, 0x9e, 0xbe, 0xbe, 0xc6, 0xbf, 0xc6, 0x03, 0xdf, 0xc6, 0x81, 0xdf, 0xce, 0x0b,
+        0xff, 0xce, 0x07, 0xdf, 0xce, 0x03, 0xff, 0xce, 0x81, 0x1f, 0xd7, 0x02, 0xff, 0xce, 0x81,
+        0x5f, 0xe7, 0x2d, 0x00, 0x00, 0x83, 0xdf, 0x14, 0x9c, 0xff, 0x5e, 0xe7, 0x12, 0x7d, 0xef,
+        0x86, 0x7d, 0xf7, 0x5e, 0xe7, 0xbe, 0xc6, 0x9e, 0xbe, 0xbe, 0xc6, 0xbf, 0xc6, 0x03, 0xdf,
+        0xc6, 0x81, 0xdf, 0xce, 0x08, 0xff, 0xce, 0x0b, 0xdf, 0xce, 0x86, 0xff, 0xce, 0x1f, 0xd7,
+        0xfe, 0xce, 0xff, 0xce, 0x9f, 0xc6, 0x1f, 0xd7, 0x2b, 0x00, 0x00, 0x84, 0x3f, 0xdf, 0x5d,
+        0xef, 0x5e, 0xe7, 0x7e, 0xef, 0x14, 0x7d, 0xef, 0x81, 0x1e, 0xd7, 0x02, 0x9e, 0xbe, 0x82,
+        0xbe, 0xc6, 0xbf, 0xc6, 0x04, 0xdf, 0xc6, 0x02, 0xdf, 0xce, 0x03, 0xff, 0xce, 0x0e, 0xdf,
+        0xce, 0x02, 0xff, 0xce, 0x82, 0xff, 0xd6, 0xff, 0xce, 0x02, 0xde, 0xce, 0x81, 0x5f, 0xe7,
+        0x29, 0x00, 0x00, 0x83, 0x5f, 0xbf, 0x9b, 0xff, 0x7e, 0xef, 0x15, 0x7d, 0xef, 0x82, 0x5e,
+        0xef, 0xbe, 0xc6, 0x02, 0x9e, 0xbe, 0x02, 0xbf, 0xc6, 0x08, 0xdf, 0xc6, 0x0f, 0xdf, 0xce,
+        0x03, 0xff, 0xce, 0x84, 0x3f, 0xcf, 0x1f, 0xd7, 0x3f, 0xd7, 0xff, 0xce, 0x28, 0x00, 0x00,
+        0x82, 0x3d, 0xdf, 0x3d, 0xe7, 0x17, 0x7d, 0xef, 0x82, 0x3e, 0xdf, 0xde, 0xce, 0x03, 0xfe,
+        0xd6, 0x81, 0xfe, 0xce, 0x09, 0xdf, 0xc6, 0x0f, 0xdf, 0xce, 0x02, 0xff, 0xce, 0x83, 0x1f,
+        0xd7, 0x1f, 0xcf, 0xdf, 0xce, 0x02, 0xff, 0xce, 0x26, 0x00, 0x00, 0x82, 0x7d, 0xf7, 0x7e,
+        0xef, 0x17, 0x7d, 0xef, 0x81, 0x9d, 0xf7, 0x03, 0x9e, 0xf7, 0x02, 0x7e, 0xef, 0x83, 0x5e,
+        0xe7, 0xfe, 0xd6, 0xbf, 0xc6, 0x07, 0xdf, 0xc6, 0x0f, 0xdf, 0xce, 0x04, 0xff, 0xce, 0x83,
+        0x1f, 0xcf, 0x1f, 0xd7, 0xff, 0xce, 0x25, 0x00, 0x00, 0x82, 0xfd, 0xff, 0x5e, 0xe7, 0x1d,
+        0x7d, 0xef, 0x83, 0x7d, 0xf7, 0x7e, 0xef, 0x1e, 0xdf, 0x03, 0xbf, 0xc6, 0x04, 0xdf, 0xc6,
+        0x0e, 0xdf, 0xce, 0x03, 0xdf, 0xc6, 0x03, 0xff, 0xce, 0x83, 0x1f, 0xd7, 0xff, 0xce, 0xff,
+        0xd6, 0x02, 0x1f, 0xd7, 0x22, 0x00, 0x00, 0x82, 0x3f, 0xae, 0x5e, 0xef, 0x1f, 0x7d, 0xef,
+        0x82, 0x7e, 0xef, 0x1e, 0xdf, 0x02, 0xbe, 0xc6, 0x02, 0xbf, 0xc6, 0x03, 0xdf, 0xc6, 0x0c,
+        0xdf, 0xce, 0x06, 0xdf, 0xc6, 0x03, 0xff, 0xce, 0x87, 0x1f, 0xd7, 0x5f, 0xe7, 0x1f, 0xcf,
+        0x1f, 0xd7, 0xff, 0xd6, 0xff, 0xf7, 0xbf, 0xce, 0x1e, 0x00, 0x00, 0x23, 0x7d, 0xef, 0x84,
+        0xde, 0xce, 0x9e, 0xbe, 0xbe, 0xc6, 0xbf, 0xc6, 0x04, 0xdf, 0xc6, 0x0a, 0xdf, 0xce, 0x09,
+        0xdf, 0xc6, 0x04, 0xff, 0xce, 0x84, 0x1f, 0xd7, 0x1f, 0xdf, 0xdf, 0xce, 0xff, 0xce, 0x02,
+        0x1f, 0xd7, 0x83, 0xbf, 0xce, 0xff, 0xff, 0x5f, 0xe7, 0x19, 0x00, 0x00, 0x81, 0x1d, 0xdf,
+        0x21, 0x7d, 0xef, 0x84, 0x7d, 0xf7, 0x3d, 0xe7, 0x7e, 0xbe, 0x9e, 0xbe, 0x02, 0xbf, 0xc6,
+        0x03, 0xdf, 0xc6, 0x08, 0xdf, 0xce, 0x0d, 0xdf, 0xc6, 0x81, 0xdf, 0xce, 0x04, 0xff, 0xce,
+        0x81, 0x1f, 0xcf, 0x02, 0x1f, 0xd7, 0x82, 0x5f, 0xb7, 0xdf, 0xc6, 0x03, 0xff, 0xce, 0x03,
+        0x1f, 0xcf, 0x02, 0x1f, 0xd7, 0x12, 0x00, 0x00, 0x82, 0xf7, 0xff, 0x5d, 0xe7, 0x22, 0x7d,
+        0xef, 0x84, 0x9d, 0xc6, 0x5d, 0xb6, 0x9e, 0xbe, 0xbf, 0xc6, 0x03, 0xdf, 0xc6, 0x07, 0xdf,
+        0xce, 0x12, 0xdf, 0xc6, 0x81, 0xdf, 0xce, 0x04, 0xff, 0xce, 0x02, 0x1f, 0xcf, 0x02, 0xff,
+        0xce, 0x03, 0x1f, 0xd7, 0x82, 0xfe, 0xd6, 0x1f, 0xd7, 0x12, 0x00, 0x00, 0x82, 0xbd, 0xff,
+        0x5e, 0xe7, 0x22, 0x7d, 0xef, 0x84, 0xdd, 0xd6, 0x1d, 0xb6, 0x5e, 0xbe, 0xbe, 0xc6, 0x03,
+        0xdf, 0xc6, 0x06, 0xdf, 0xce, 0x19, 0xdf, 0xc6, 0x81, 0xdf, 0xce, 0x03, 0xff, 0xce, 0x84,
+        0xdf, 0xce, 0xdf, 0xc6, 0x7d, 0x95, 0x1f, 0xd7, 0x12, 0x00, 0x00, 0x02, 0x3d, 0xe7, 0x21,
+        0x7d, 0xef, 0x86, 0x9d, 0xf7, 0xfd, 0xde, 0x1d, 0xb6, 0x3d, 0xb6, 0x7e, 0xbe, 0xbf, 0xc6,
+        0x02, 0xdf, 0xc6, 0x04, 0xdf, 0xce, 0x1f, 0xdf, 0xc6, 0x84, 0x9e, 0xbe, 0x3d, 0xb6, 0x7e,
+        0xbe, 0x1f, 0xd7, 0x12, 0x00, 0x00, 0x83, 0x7d, 0xbe, 0x5d, 0xbe, 0x5d, 0xef, 0x20, 0x7d,
+        0xef, 0x86, 0x7d, 0xf7, 0xfd, 0xde, 0x1d, 0xb6, 0x3d, 0xb6, 0x5d, 0xb6, 0x9e, 0xbe, 0x02,
+        0xdf, 0xc6, 0x02, 0xdf, 0xce, 0x20, 0xdf, 0xc6, 0x84, 0xbe, 0xc6, 0x5e, 0xbe, 0x7e, 0xbe,
+        0x7f, 0xbe, 0x13, 0x00, 0x00, 0x83, 0x5d, 0xbe, 0x3c, 0xef, 0x1d, 0xdf, 0x21, 0x7d, 0xef,
+        0x86, 0xbd, 0xce, 0x1d, 0xb6, 0x3d, 0xb6, 0x5d, 0xb6, 0x5e, 0xb6, 0x9e, 0xbe, 0x22, 0xdf,
+        0xc6, 0x85, 0xbf, 0xc6, 0x7e, 0xbe, 0x9e, 0xbe, 0xbf, 0xc6, 0x5d, 0xbe, 0x13, 0x00, 0x00,
+        0x84, 0x5f, 0xe7, 0x9b, 0xce, 0x3b, 0xbe, 0x3d, 0xe7, 0x1f, 0x7d, 0xef, 0x88, 0x5d, 0xef,
+        0x5d, 0xc6, 0x1d, 0xb6, 0x3d, 0xb6, 0x5d, 0xb6, 0x5e, 0xbe, 0x7e, 0xbe, 0x9e, 0xbe, 0x20,
+        0xdf, 0xc6, 0x85, 0xbf, 0xc6, 0x9e, 0xc6, 0x9e, 0xbe, 0x1d, 0xb6, 0x5e, 0xb6, 0x15, 0x00,
+        0x00, 0x81, 0xdb, 0xde, 0x02, 0xfc, 0xde, 0x81, 0x3d, 0xe7, 0x1e, 0x7d, 0xef, 0x82, 0xfd,
+        0xde, 0x1d, 0xb6, 0x02, 0x3d, 0xb6, 0x81, 0x5d, 0xb6, 0x03, 0x7e, 0xbe, 0x81, 0xbe, 0xc6,
+        0x1e, 0xdf, 0xc6, 0x85, 0xbf, 0xc6, 0x9e, 0xc6, 0xff, 0xf7, 0x5d, 0xbe, 0x9e, 0xc6, 0x17,
+        0x00, 0x00, 0x84, 0xbd, 0xa5, 0x7c, 0xef, 0xdc, 0xd6, 0x3d, 0xe7, 0x1c, 0x7d, 0xef, 0x83,
+        0x5d, 0xe7, 0x5c, 0xbe, 0x1d, 0xb6, 0x02, 0x3d, 0xb6, 0x81, 0x5e, 0xb6, 0x04, 0x7e, 0xbe,
+        0x81, 0xbf, 0xc6, 0x1c, 0xdf, 0xc6, 0x85, 0xbf, 0xc6, 0x9e, 0xbe, 0x5b, 0xa5, 0x5d, 0xb6,
+        0x5d, 0xbe, 0x18, 0x00, 0x00, 0x85, 0x9e, 0xc6, 0x3d, 0xb6, 0xfb, 0xff, 0xdc, 0xd6, 0x3c,
+        0xe7, 0x1a, 0x7d, 0xef, 0x82, 0x5d, 0xef, 0x7c, 0xc6, 0x02, 0x1d, 0xb6, 0x83, 0x3d, 0xb6,
+        0x5d, 0xb6, 0x5e, 0xbe, 0x04, 0x7e, 0xbe, 0x82, 0x9e, 0xbe, 0xbe, 0xc6, 0x1a, 0xdf, 0xc6,
+        0x83, 0xbf, 0xc6, 0x9e, 0xbe, 0x5a, 0x9d, 0x02, 0x5d, 0xbe, 0x1a, 0x00, 0x00, 0x82, 0x3c,
+        0xbe, 0x1c, 0xb6, 0x02, 0xfc, 0xde, 0x83, 0x1c, 0xdf, 0x3d, 0xe7, 0x5d, 0xef, 0x16, 0x7d,
+        0xef, 0x82, 0x1c, 0xe7, 0x7c, 0xc6, 0x02, 0x1d, 0xb6, 0x02, 0x3d, 0xb6, 0x81, 0x5d, 0xb6,
+        0x04, 0x7e, 0xbe, 0x03, 0x9e, 0xbe, 0x81, 0xbe, 0xc6, 0x18, 0xdf, 0xc6, 0x85, 0xbe, 0xc6,
+        0x9e, 0xbe, 0xff, 0xff, 0x5d, 0xb6, 0x5d, 0xbe, 0x1c, 0x00, 0x00, 0x88, 0x5f, 0xe7, 0x5c,
+        0xef, 0x3c, 0xe7, 0x13, 0x00, 0xbb, 0xd6, 0x1c, 0xdf, 0x3c, 0xe7, 0x5d, 0xe7, 0x11, 0x5d,
+        0xef, 0x85, 0x3d, 0xe7, 0x1c, 0xdf, 0xbc, 0xce, 0x3c, 0xb6, 0x1d, 0xb6, 0x03, 0x3d, 0xb6,
+        0x82, 0x5d, 0xb6, 0x5e, 0xb6, 0x03, 0x7e, 0xbe, 0x05, 0x9e, 0xbe, 0x81, 0xbf, 0xc6, 0x16,
+        0xdf, 0xc6, 0x83, 0x9e, 0xc6, 0x5e, 0xb6, 0x7e, 0xbe, 0x02, 0x5d, 0xbe, 0x1e, 0x00, 0x00,
+        0x8a, 0x3c, 0xbe, 0x5d, 0xbe, 0xbf, 0x85, 0xdb, 0xd6, 0xfb, 0xff, 0x9c, 0xc6, 0xbe, 0xce,
+        0xdc, 0xde, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x81, 0x7b, 0xce,
+        0x02, 0x3c, 0xbe, 0x06, 0x5c, 0xbe, 0x83, 0x3c, 0xbe, 0x3c, 0xb6, 0x1d, 0xb6, 0x03, 0x3d,
+        0xb6, 0x02, 0x5d, 0xb6, 0x81, 0x5e, 0xb6, 0x02, 0x7e, 0xbe, 0x08, 0x9e, 0xbe, 0x81, 0xbf,
+        0xc6, 0x13, 0xdf, 0xc6, 0x86, 0xbf, 0xc6, 0x9e, 0xbe, 0x5e, 0xbe, 0x7e, 0xbe, 0x3d, 0xbe,
+        0xbf, 0xce, 0x21, 0x00, 0x00, 0x86, 0x3c, 0xbe, 0x3b, 0x95, 0xbc, 0xce, 0x9d, 0xce, 0xbe,
+        0xc6, 0xdc, 0xde, 0x06, 0xdb, 0xde, 0x85, 0xdb, 0xd6, 0xff, 0x7c, 0xfd, 0xad, 0x1d, 0xb6,
+        0x3d, 0xb6, 0x0b, 0x5d, 0xb6, 0x81, 0x5e, 0xb6, 0x03, 0x7e, 0xbe, 0x04, 0x9e, 0xbe, 0x06,
+        0xbe, 0xbe, 0x81, 0xbf, 0xc6, 0x11, 0xdf, 0xc6, 0x83, 0xbf, 0xc6, 0x7e, 0xbe, 0x3d, 0xb6,
+        0x03, 0x5e, 0xb6, 0x2d, 0x00, 0x00, 0x87, 0x9e, 0xc6, 0x1d, 0xae, 0x3d, 0xb6, 0x9c, 0xa5,
+        0x3d, 0xb6, 0x1d, 0xb6, 0x3d, 0xb6, 0x07, 0x5e, 0xb6, 0x81, 0x5e, 0xbe, 0x05, 0x7e, 0xbe,
+        0x04, 0x9e, 0xbe, 0x07, 0xbe, 0xbe, 0x82, 0xbe, 0xc6, 0xbf, 0xc6, 0x0e, 0xdf, 0xc6, 0x81,
+        0xbf, 0xc6, 0x02, 0x7e, 0xbe, 0x84, 0xbf, 0xbe, 0x5e, 0xbe, 0x5e, 0xb6, 0xbe, 0xce, 0x30,
+        0x00, 0x00, 0x84, 0x7e, 0xbe, 0x1f, 0xd7, 0x1d, 0xae, 0xb9, 0x8c, 0x02, 0x3d, 0xb6, 0x81,
+        0x5e, 0xb6, 0x08, 0x7e, 0xbe, 0x06, 0x9e, 0xbe, 0x0a, 0xbe, 0xc6, 0x81, 0xbf, 0xc6, 0x0b,
+        0xdf, 0xc6, 0x85, 0xbf, 0xc6, 0x9e, 0xbe, 0x7e, 0xbe, 0xdc, 0xad, 0x7e, 0xbe, 0x02, 0x7d,
+        0xbe, 0x33, 0x00, 0x00, 0x84, 0x9e, 0xc6, 0x5b, 0x95, 0xdc, 0xad, 0x1d, 0xae, 0x02, 0x3d,
+        0xb6, 0x81, 0x5e, 0xb6, 0x02, 0x7e, 0xbe, 0x08, 0x9e, 0xbe, 0x02, 0x9e, 0xc6, 0x0c, 0xbe,
+        0xc6, 0x81, 0xbf, 0xc6, 0x08, 0xdf, 0xc6, 0x88, 0xbf, 0xc6, 0x9e, 0xbe, 0x7e, 0xbe, 0x3d,
+        0xb6, 0x7e, 0xbe, 0x3d, 0xb6, 0x3f, 0xa6, 0x3c, 0xbe, 0x36, 0x00, 0x00, 0x82, 0x1f, 0xdf,
+        0xff, 0xff, 0x02, 0x3d, 0xb6, 0x86, 0x7e, 0xbe, 0x5d, 0xb6, 0x5e, 0xbe, 0x7e, 0xbe, 0x9e,
+        0xbe, 0x9e, 0xc6, 0x06, 0xbe, 0xc6, 0x09, 0xbf, 0xc6, 0x05, 0xbe, 0xc6, 0x81, 0xbf, 0xc6,
+        0x04, 0xdf, 0xc6, 0x82, 0xbf, 0xc6, 0xbe, 0xc6, 0x02, 0x9e, 0xbe, 0x82, 0x3d, 0xb6, 0x7e,
+        0xbe, 0x02, 0x5e, 0xbe, 0x81, 0xbe, 0xce, 0x3a, 0x00, 0x00, 0x87, 0x5f, 0xe7, 0x3b, 0x8d,
+        0x7e, 0xbe, 0x5d, 0xb6, 0x0e, 0x70, 0x3d, 0xb6, 0x5e, 0xb6, 0x02, 0x7e, 0xbe, 0x83, 0x9e,
+        0xbe, 0x9e, 0xc6, 0xbe, 0xc6, 0x10, 0xbf, 0xc6, 0x81, 0xbe, 0xc6, 0x02, 0xbf, 0xc6, 0x81,
+        0xbe, 0xc6, 0x02, 0x9e, 0xbe, 0x86, 0x7e, 0xbe, 0x9b, 0xa5, 0x9e, 0xbe, 0x5e, 0xb6, 0x7e,
+        0xce, 0x9e, 0xc6, 0x3f, 0x00, 0x00, 0x89, 0x3d, 0xb6, 0x5e, 0xbe, 0x3d, 0xb6, 0x5e, 0xbe,
+        0xba, 0xad, 0x1d, 0xb6, 0x7e, 0xbe, 0x5e, 0xbe, 0x7e, 0xbe, 0x03, 0x9e, 0xbe, 0x82, 0x9e,
+        0xc6, 0xbe, 0xc6, 0x06, 0xbf, 0xc6, 0x82, 0xbe, 0xc6, 0x9e, 0xc6, 0x03, 0x9e, 0xbe, 0x89,
+        0x7e, 0xbe, 0x5e, 0xbe, 0x7e, 0xbe, 0x5d, 0xb6, 0x1c, 0xae, 0x9e, 0xbe, 0x7e, 0xbe, 0x3d,
+        0xb6, 0x5e, 0xb6, 0x44, 0x00, 0x00, 0x8b, 0x5f, 0xe7, 0xbc, 0xa5, 0x5d, 0xbe, 0x3d, 0xb6,
+        0x5d, 0xb6, 0x9e, 0xbe, 0xdb, 0xb5, 0x3d, 0xb6, 0x5d, 0xb6, 0x7e, 0xbe, 0x9e, 0xbe, 0x04,
+        0x7e, 0xbe, 0x81, 0x5e, 0xb6, 0x04, 0x7e, 0xbe, 0x81, 0x5d, 0xbe, 0x02, 0x3d, 0xb6, 0x87,
+        0xde, 0xce, 0xbe, 0xc6, 0x9e, 0xbe, 0x5e, 0xb6, 0x5d, 0xbe, 0x9a, 0x8d, 0xbf, 0xce, 0x4a,
+        0x00, 0x00, 0x96, 0x9e, 0xc6, 0xff, 0xff, 0x5d, 0xbe, 0x5d, 0xb6, 0x5e, 0xb6, 0x5d, 0xb6,
+        0x7e, 0xbe, 0xbf, 0xc6, 0xdf, 0xc6, 0xff, 0xce, 0x5f, 0xd7, 0x7f, 0xd7, 0x1f, 0xcf, 0xdf,
+        0xc6, 0xbf, 0xc6, 0x7e, 0xbe, 0x5d, 0xb6, 0x3d, 0xb6, 0x5e, 0xb6, 0xde, 0xc6, 0x94, 0x52,
+        0x1f, 0xcf, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f,
+        0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x10,
+        0x00, 0x00, 0x85, 0x00, 0x03, 0x15, 0x2d, 0x40, 0x55, 0x6f, 0x7c, 0x20, 0x00, 0x2b, 0x00,
+        0x00, 0x87, 0x00, 0x01, 0x1a, 0x3f, 0x7e, 0xa5, 0xc4, 0xea, 0xf7, 0xf9, 0xff, 0xa7, 0x0b,
+        0x00, 0x2a, 0x00, 0x00, 0x83, 0x00, 0x1b, 0x58, 0x9a, 0xce, 0xf3, 0x03, 0xff, 0xff, 0x81,
+        0xe6, 0x38, 0x2a, 0x00, 0x00, 0x83, 0x07, 0x35, 0x84, 0xd0, 0xf8, 0xff, 0x04, 0xff, 0xff,
+        0x81, 0x90, 0x03, 0x29, 0x00, 0x00, 0x82, 0x07, 0x40, 0xa2, 0xea, 0x05, 0xff, 0xff, 0x82,
+        0xff, 0xe3, 0x32, 0x00, 0x28, 0x00, 0x00, 0x82, 0x03, 0x39, 0x9e, 0xec, 0x06, 0xff, 0xff,
+        0x82, 0xff, 0x94, 0x03, 0x00, 0x27, 0x00, 0x00, 0x82, 0x00, 0x1b, 0x85, 0xe7, 0x07, 0xff,
+        0xff, 0x81, 0xed, 0x3e, 0x27, 0x00, 0x00, 0x82, 0x00, 0x05, 0x4e, 0xc4, 0x08, 0xff, 0xff,
+        0x81, 0xb2, 0x09, 0x27, 0x00, 0x00, 0x82, 0x11, 0x88, 0xf0, 0xff, 0x07, 0xff, 0xff, 0x82,
+        0xff, 0xfc, 0x5e, 0x00, 0x26, 0x00, 0x00, 0x82, 0x00, 0x2a, 0xac, 0xfe, 0x08, 0xff, 0xff,
+        0x82, 0xff, 0xd9, 0x23, 0x00, 0x26, 0x00, 0x00, 0x81, 0x40, 0xd0, 0x09, 0xff, 0xff, 0x82,
+        0xff, 0xa2, 0x03, 0x00, 0x25, 0x00, 0x00, 0x82, 0x00, 0x4a, 0xdd, 0xff, 0x09, 0xff, 0xff,
+        0x81, 0xfd, 0x58, 0x25, 0x00, 0x00, 0x82, 0x00, 0x01, 0x53, 0xe3, 0x0a, 0xff, 0xff, 0x81,
+        0xe4, 0x2e, 0x25, 0x00, 0x00, 0x82, 0x00, 0x4f, 0xe7, 0xff, 0x0a, 0xff, 0xff, 0x81, 0xbb,
+        0x0a, 0x25, 0x00, 0x00, 0x81, 0x3e, 0xde, 0x0b, 0xff, 0xff, 0x81, 0x91, 0x00, 0x24, 0x00,
+        0x00, 0x82, 0x00, 0x2f, 0xd0, 0xff, 0x0a, 0xff, 0xff, 0x82, 0xff, 0xfc, 0x5c, 0x00, 0x24,
+        0x00, 0x00, 0x81, 0x15, 0xb6, 0x0b, 0xff, 0xff, 0x82, 0xff, 0xf7, 0x3e, 0x00, 0x23, 0x00,
+        0x00, 0x82, 0x00, 0x04, 0x84, 0xfe, 0x0b, 0xff, 0xff, 0x82, 0xff, 0xe0, 0x28, 0x00, 0x23,
+        0x00, 0x00, 0x82, 0x00, 0x52, 0xee, 0xff, 0x0b, 0xff, 0xff, 0x82, 0xff, 0xc6, 0x15, 0x00,
+        0x23, 0x00, 0x00, 0x81, 0x23, 0xcf, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xb5, 0x09, 0x00, 0x22,
+        0x00, 0x00, 0x82, 0x00, 0x03, 0x8b, 0xff, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xac, 0x02, 0x00,
+        0x22, 0x00, 0x00, 0x82, 0x00, 0x3b, 0xe7, 0xff, 0x0c, 0xff, 0xff, 0x81, 0xff, 0xa9, 0x23,
+        0x00, 0x00, 0x81, 0x0b, 0xab, 0x0d, 0xff, 0xff, 0x81, 0xff, 0xa7, 0x23, 0x00, 0x00, 0x81,
+        0x46, 0xf1, 0x0d, 0xff, 0xff, 0x81, 0xff, 0xa7, 0x22, 0x00, 0x00, 0x82, 0x00, 0x07, 0xa2,
+        0xff, 0x0d, 0xff, 0xff, 0x81, 0xff, 0xa7, 0x22, 0x00, 0x00, 0x82, 0x00, 0x3e, 0xeb, 0xff,
+        0x0d, 0xff, 0xff, 0x81, 0xff, 0xa9, 0x22, 0x00, 0x00, 0x81, 0x02, 0x90, 0x0e, 0xff, 0xff,
+        0x82, 0xff, 0xae, 0x04, 0x00, 0x21, 0x00, 0x00, 0x81, 0x1d, 0xd4, 0x0e, 0xff, 0xff, 0x82,
+        0xff, 0xb9, 0x0c, 0x00, 0x21, 0x00, 0x00, 0x81, 0x57, 0xf7, 0x0e, 0xff, 0xff, 0x82, 0xff,
+        0xd2, 0x1e, 0x00, 0x20, 0x00, 0x00, 0x82, 0x00, 0x04, 0xa0, 0xff, 0x0e, 0xff, 0xff, 0x82,
+        0xff, 0xf1, 0x36, 0x00, 0x20, 0x00, 0x00, 0x82, 0x00, 0x1f, 0xd8, 0xff, 0x0e, 0xff, 0xff,
+        0x82, 0xff, 0xfa, 0x47, 0x00, 0x20, 0x00, 0x00, 0x82, 0x00, 0x40, 0xf4, 0xff, 0x0e, 0xff,
+        0xff, 0x82, 0xff, 0xfd, 0x67, 0x00, 0x20, 0x00, 0x00, 0x82, 0x00, 0x7b, 0xfe, 0xff, 0x0f,
+        0xff, 0xff, 0x81, 0xa1, 0x01, 0x20, 0x00, 0x00, 0x81, 0x04, 0xa8, 0x10, 0xff, 0xff, 0x81,
+        0xc9, 0x16, 0x20, 0x00, 0x00, 0x81, 0x15, 0xc5, 0x10, 0xff, 0xff, 0x81, 0xf1, 0x3b, 0x20,
+        0x00, 0x00, 0x81, 0x2b, 0xe7, 0x10, 0xff, 0xff, 0x81, 0xfe, 0x68, 0x20, 0x00, 0x00, 0x81,
+        0x3e, 0xf6, 0x10, 0xff, 0xff, 0x82, 0xff, 0xb2, 0x08, 0x00, 0x1f, 0x00, 0x00, 0x81, 0x57,
+        0xf9, 0x10, 0xff, 0xff, 0x82, 0xff, 0xe8, 0x34, 0x00, 0x1f, 0x00, 0x00, 0x81, 0x71, 0xfd,
+        0x11, 0xff, 0xff, 0x81, 0x77, 0x00, 0x1f, 0x00, 0x00, 0x81, 0x88, 0xff, 0x11, 0xff, 0xff,
+        0x81, 0xc7, 0x14, 0x1f, 0x00, 0x00, 0x81, 0x9a, 0xff, 0x11, 0xff, 0xff, 0x81, 0xf8, 0x5a,
+        0x1f, 0x00, 0x00, 0x81, 0xa4, 0xff, 0x11, 0xff, 0xff, 0x82, 0xff, 0xb9, 0x0f, 0x00, 0x1e,
+        0x00, 0x00, 0x81, 0xa1, 0xff, 0x11, 0xff, 0xff, 0x82, 0xff, 0xf6, 0x56, 0x00, 0x1e, 0x00,
+        0x00, 0x81, 0x92, 0xff, 0x12, 0xff, 0xff, 0x81, 0xbb, 0x13, 0x1e, 0x00, 0x00, 0x81, 0x82,
+        0xff, 0x12, 0xff, 0xff, 0x81, 0xfb, 0x70, 0x1e, 0x00, 0x00, 0x81, 0x6e, 0xfd, 0x12, 0xff,
+        0xff, 0x82, 0xff, 0xdc, 0x2e, 0x00, 0x1d, 0x00, 0x00, 0x81, 0x52, 0xf9, 0x13, 0xff, 0xff,
+        0x81, 0xa0, 0x0a, 0x1d, 0x00, 0x00, 0x81, 0x3c, 0xf6, 0x13, 0xff, 0xff, 0x82, 0xf6, 0x6a,
+        0x01, 0x00, 0x1c, 0x00, 0x00, 0x81, 0x2c, 0xe8, 0x13, 0xff, 0xff, 0x82, 0xff, 0xe4, 0x43,
+        0x00, 0x1c, 0x00, 0x00, 0x81, 0x15, 0xc4, 0x14, 0xff, 0xff, 0x81, 0xca, 0x25, 0x1c, 0x00,
+        0x00, 0x81, 0x04, 0xa9, 0x14, 0xff, 0xff, 0x82, 0xff, 0xb1, 0x1c, 0x00, 0x1b, 0x00, 0x00,
+        0x82, 0x00, 0x7c, 0xfe, 0xff, 0x13, 0xff, 0xff, 0x82, 0xff, 0xfe, 0xa6, 0x16, 0x1b, 0x00,
+        0x00, 0x82, 0x00, 0x3f, 0xf2, 0xff, 0x14, 0xff, 0xff, 0x82, 0xfd, 0x9a, 0x12, 0x00, 0x1a,
+        0x00, 0x00, 0x82, 0x00, 0x24, 0xe0, 0xff, 0x07, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x0c, 0xff,
+        0xff, 0x82, 0xff, 0xfc, 0xa2, 0x1c, 0x1a, 0x00, 0x00, 0x82, 0x01, 0x70, 0xf7, 0xff, 0x08,
+        0xff, 0xff, 0x81, 0xfe, 0xff, 0x0c, 0xff, 0xff, 0x82, 0xff, 0xb6, 0x27, 0x00, 0x19, 0x00,
+        0x00, 0x81, 0x52, 0xed, 0x17, 0xff, 0xff, 0x82, 0xc7, 0x3c, 0x01, 0x00, 0x17, 0x00, 0x00,
+        0x82, 0x00, 0x1b, 0xca, 0xff, 0x17, 0xff, 0xff, 0x82, 0xff, 0xe2, 0x6e, 0x0c, 0x17, 0x00,
+        0x00, 0x82, 0x00, 0x75, 0xfe, 0xff, 0x18, 0xff, 0xff, 0x82, 0xf9, 0xa3, 0x2b, 0x00, 0x16,
+        0x00, 0x00, 0x81, 0x15, 0xc8, 0x1a, 0xff, 0xff, 0x82, 0xd9, 0x6d, 0x13, 0x00, 0x15, 0x00,
+        0x00, 0x81, 0x41, 0xf4, 0x1a, 0xff, 0xff, 0x83, 0xff, 0xfb, 0xbc, 0x4e, 0x09, 0x00, 0x14,
+        0x00, 0x00, 0x81, 0x72, 0xff, 0x1b, 0xff, 0xff, 0x83, 0xff, 0xf2, 0xaf, 0x52, 0x11, 0x00,
+        0x12, 0x00, 0x00, 0x82, 0x00, 0x01, 0x9f, 0xff, 0x1c, 0xff, 0xff, 0x83, 0xff, 0xf6, 0xbf,
+        0x65, 0x24, 0x02, 0x11, 0x00, 0x00, 0x82, 0x00, 0x02, 0xb6, 0xff, 0x1d, 0xff, 0xff, 0x84,
+        0xff, 0xfd, 0xda, 0xa2, 0x54, 0x1f, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x82, 0x00, 0x02, 0xaf,
+        0xff, 0x1f, 0xff, 0xff, 0x84, 0xf9, 0xd5, 0xa8, 0x78, 0x3e, 0x21, 0x0a, 0x00, 0x0e, 0x00,
+        0x00, 0x81, 0x8f, 0xff, 0x20, 0xff, 0xff, 0x87, 0xff, 0xfe, 0xf5, 0xda, 0xb0, 0x9d, 0x88,
+        0x5e, 0x3f, 0x32, 0x2a, 0x2a, 0x18, 0x01, 0x0a, 0x00, 0x00, 0x81, 0x5b, 0xfd, 0x23, 0xff,
+        0xff, 0x84, 0xff, 0xf9, 0xf3, 0xf0, 0xf0, 0xe6, 0x5a, 0x00, 0x0a, 0x00, 0x00, 0x81, 0x2c,
+        0xe2, 0x25, 0xff, 0xff, 0x82, 0xff, 0x9b, 0x0a, 0x00, 0x0a, 0x00, 0x00, 0x81, 0x08, 0xad,
+        0x25, 0xff, 0xff, 0x81, 0xc1, 0x1f, 0x0b, 0x00, 0x00, 0x82, 0x00, 0x4d, 0xf2, 0xff, 0x23,
+        0xff, 0xff, 0x82, 0xff, 0xdc, 0x37, 0x00, 0x0b, 0x00, 0x00, 0x82, 0x00, 0x0a, 0xa3, 0xff,
+        0x23, 0xff, 0xff, 0x81, 0xe5, 0x4b, 0x0d, 0x00, 0x00, 0x81, 0x29, 0xd0, 0x22, 0xff, 0xff,
+        0x82, 0xff, 0xea, 0x58, 0x00, 0x0d, 0x00, 0x00, 0x82, 0x00, 0x42, 0xdc, 0xff, 0x21, 0xff,
+        0xff, 0x82, 0xea, 0x5e, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x81, 0x38, 0xc1, 0x0d, 0xff, 0xff,
+        0x81, 0xff, 0xfe, 0x12, 0xff, 0xff, 0x82, 0xff, 0xe5, 0x58, 0x01, 0x0f, 0x00, 0x00, 0x82,
+        0x00, 0x1c, 0x81, 0xdf, 0x1f, 0xff, 0xff, 0x81, 0xd8, 0x48, 0x11, 0x00, 0x00, 0x83, 0x00,
+        0x2d, 0x73, 0xba, 0xdd, 0xf4, 0x1c, 0xff, 0xff, 0x82, 0xff, 0xbb, 0x33, 0x00, 0x12, 0x00,
+        0x00, 0x83, 0x00, 0x0a, 0x27, 0x47, 0x57, 0x58, 0x02, 0x58, 0x58, 0x82, 0x57, 0x8a, 0xed,
+        0xff, 0x03, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x12, 0xff, 0xff, 0x82, 0xff, 0xf4, 0x90, 0x19,
+        0x18, 0x00, 0x00, 0x82, 0x00, 0x04, 0x4f, 0xca, 0x16, 0xff, 0xff, 0x82, 0xd3, 0x5b, 0x07,
+        0x00, 0x19, 0x00, 0x00, 0x82, 0x00, 0x1f, 0x86, 0xe5, 0x14, 0xff, 0xff, 0x82, 0xed, 0x94,
+        0x27, 0x00, 0x1b, 0x00, 0x00, 0x82, 0x02, 0x37, 0xa4, 0xee, 0x12, 0xff, 0xff, 0x82, 0xf3,
+        0xaf, 0x45, 0x05, 0x1d, 0x00, 0x00, 0x82, 0x08, 0x44, 0xa0, 0xe9, 0x10, 0xff, 0xff, 0x82,
+        0xef, 0xb1, 0x4e, 0x0b, 0x1f, 0x00, 0x00, 0x83, 0x07, 0x39, 0x89, 0xd3, 0xf8, 0xff, 0x0c,
+        0xff, 0xff, 0x83, 0xff, 0xfa, 0xdc, 0x96, 0x40, 0x0b, 0x21, 0x00, 0x00, 0x84, 0x00, 0x1c,
+        0x58, 0x9c, 0xd2, 0xf4, 0xfe, 0xff, 0x09, 0xff, 0xff, 0x83, 0xf6, 0xdb, 0xa2, 0x61, 0x21,
+        0x03, 0x23, 0x00, 0x00, 0x86, 0x00, 0x02, 0x1c, 0x3f, 0x7c, 0xa5, 0xc3, 0xe9, 0xf6, 0xf8,
+        0xfc, 0xff, 0x02, 0xff, 0xff, 0x86, 0xff, 0xfc, 0xf9, 0xf7, 0xef, 0xcc, 0xab, 0x84, 0x47,
+        0x21, 0x04, 0x00, 0x26, 0x00, 0x00, 0x8a, 0x00, 0x02, 0x14, 0x2c, 0x3b, 0x4f, 0x6b, 0x83,
+        0x93, 0xa2, 0xa3, 0x94, 0x89, 0x6d, 0x53, 0x40, 0x30, 0x1a, 0x05, 0x00, 0x7f, 0x00, 0x00,
+        0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x27, 0x00, 0x00,
 
 };
 
 const lv_image_dsc_t image_mostly_clear_night = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.cf = LV_COLOR_FORMAT_RGB565A8,
-    .header.flags = 0,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
     .header.w = 100,
     .header.h = 100,
     .header.stride = 200,
@@ -25,2013 +25,310 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_MOSTLY_SUNNY uint8_t
     image_mostly_sunny_map[] = {
 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xe7, 0xfe, 0xea, 0xfe, 0xea,
-        0xfe, 0xea, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xa6, 0xfe, 0xa5, 0xfe,
-        0xa5, 0xfe, 0xa6, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xe8, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xea,
-        0xfe, 0xea, 0xfe, 0xe7, 0xfe, 0x2a, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xf6, 0xe0, 0xff, 0xea, 0xfe, 0xea, 0xfe, 0xe9, 0xfe,
-        0xc8, 0xfe, 0xeb, 0xfe, 0x0b, 0xff, 0xea, 0xfe, 0xea, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xea, 0xfe,
-        0xe9, 0xfe, 0xea, 0xfe, 0x0b, 0xff, 0xec, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xea,
-        0xfe, 0x08, 0xff, 0xcd, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xfe, 0x0b, 0xff, 0xea, 0xfe, 0xe9, 0xfe, 0xec,
-        0xfe, 0xea, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe,
-        0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xe8, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xea, 0xfe, 0x0c, 0xff, 0xe9, 0xfe, 0xe9, 0xfe, 0x0b, 0xff, 0xea, 0xfe, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xfe, 0x06, 0xff, 0xea, 0xfe, 0xea, 0xfe, 0x74, 0xff,
-        0xea, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xea, 0xfe,
-        0x96, 0xff, 0xe9, 0xfe, 0xea, 0xfe, 0x02, 0xff, 0xcd, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xf6, 0x6d, 0xf6, 0xea, 0xfe, 0xea, 0xfe, 0xeb,
-        0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0x0a, 0xff, 0xe8, 0xfe, 0xea, 0xfe,
-        0xf0, 0xfe, 0xcc, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xc6, 0xfe, 0xea, 0xfe, 0x09, 0xff,
-        0xeb, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xe9,
-        0xfe, 0xe9, 0xfe, 0x0b, 0xff, 0xe9, 0xfe, 0xea, 0xfe, 0xc6, 0xfe, 0x0d, 0xff, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xfe, 0xeb, 0xfe, 0xe9,
-        0xfe, 0x0c, 0xff, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0x0d, 0xff, 0xe9,
-        0xfe, 0xeb, 0xfe, 0xea, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xe9, 0xfe,
-        0xea, 0xfe, 0xe8, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc8, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xa5, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xa9, 0xfe, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea,
-        0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xeb, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0xea, 0xfe,
-        0xe9, 0xfe, 0x09, 0xff, 0xe9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xa9, 0xfe, 0xaa, 0xfe, 0xea, 0xfe, 0xeb, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0x70, 0xf6, 0x6d, 0xf6, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xfe, 0xea, 0xfe, 0x09, 0xff, 0xea, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc9, 0xfe, 0xe7,
-        0xfe, 0x69, 0xfe, 0x47, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xfe, 0xeb, 0xfe, 0xc7, 0xfe, 0xea,
-        0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe,
-        0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc8, 0xfe, 0xc9, 0xfe, 0x6a, 0xff, 0xca, 0xfe, 0xeb, 0xfe, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xfe, 0xeb, 0xfe,
-        0x54, 0xff, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0xba, 0xff,
-        0xeb, 0xfe, 0xeb, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea,
-        0xfe, 0xeb, 0xfe, 0x54, 0xff, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xbb, 0xff, 0xca, 0xfe, 0x47, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xa9, 0xfe, 0xea, 0xfe, 0xc7, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe,
-        0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc9, 0xfe, 0x69, 0xff, 0x68,
-        0xfe, 0x6d, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xfe, 0xaa, 0xfe, 0x09, 0xff, 0xea, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc8, 0xfe, 0xe6, 0xfe, 0x71, 0xf6, 0xe9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xe9, 0xfe, 0xea, 0xfe, 0xea,
-        0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0xe8, 0xfe,
-        0xa9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfe,
-        0xea, 0xfe, 0xeb, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe,
-        0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8,
-        0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xeb, 0xfe, 0xea, 0xfe, 0xeb, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8,
-        0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xea, 0xfe, 0xea, 0xfe, 0xea, 0xfe, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0x0c, 0xff, 0xc7, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xe8, 0xfe,
-        0x83, 0xfe, 0x0c, 0xff, 0xa9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xfe, 0xe9, 0xfe, 0xea, 0xfe,
-        0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0x0a, 0xff, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xf6, 0xea,
-        0xfe, 0x0c, 0xff, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8,
-        0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0x0d, 0xff, 0xea,
-        0xfe, 0xcc, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x6f, 0xf6, 0xe9, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8,
-        0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe,
-        0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xf3, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xfe, 0xea, 0xfe, 0xeb, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe,
-        0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8,
-        0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xcd, 0xfe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe,
-        0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8,
-        0xfe, 0xe8, 0xfe, 0x63, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0xea, 0xfe, 0xeb, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xa8, 0xfe, 0xa8, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe,
-        0xc8, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xb6, 0xff, 0xe9, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0x90, 0xfe, 0xc8, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xf6, 0xe9, 0xfe,
-        0xea, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xcd, 0xfe, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xe0, 0xff, 0xe8, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xa7, 0xfe,
-        0xc7, 0xfe, 0x08, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xfe, 0xec, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0x2e, 0xff, 0xea, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0xe9, 0xfe,
-        0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
-        0xff, 0xc8, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc8, 0xfe, 0xc7, 0xfe, 0xa9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xe8, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xa6, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xfe, 0xeb, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0x48, 0xfe, 0x87,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9,
-        0xfe, 0xea, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe,
-        0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa7, 0xfe, 0xc6,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7,
-        0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xa7, 0xfe, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xc7, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0xe6,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7,
-        0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xa6, 0xfe, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa7, 0xfe, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa7, 0xfe, 0xc6,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xa6, 0xfe, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xe7, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0xe6, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa7, 0xfe, 0xc6,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0x86, 0xfe, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xc7, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa7, 0xfe, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9,
-        0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7,
-        0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xa6, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x67, 0xfe, 0x47, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xa7, 0xfe, 0xca, 0xfe, 0xed, 0xfe, 0x12, 0xf7, 0x35, 0xf7, 0x56, 0xf7, 0x35, 0xf7,
-        0x33, 0xf7, 0x10, 0xf7, 0xcb, 0xfe, 0xc8, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x28, 0xfe, 0x67, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0xff, 0xa7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xca, 0xfe, 0x12, 0xf7, 0x59, 0xf7, 0x7c, 0xf7, 0x7d, 0xef, 0x7e,
-        0xef, 0x9e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x9d, 0xf7, 0x7c, 0xf7, 0x56, 0xf7, 0xee, 0xfe,
-        0xa8, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xff,
-        0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
-        0xff, 0xa7, 0xfe, 0xa7, 0xfe, 0xa8, 0xfe, 0x0f, 0xff, 0x79, 0xf7, 0x7d, 0xf7, 0x7e, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e,
-        0xef, 0x9e, 0xef, 0x7c, 0xf7, 0x35, 0xf7, 0xcb, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe,
-        0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xa6, 0xfe, 0xa6, 0xfe, 0xa9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1b, 0xef, 0xef, 0xf6, 0xcc, 0xfe, 0x33, 0xf7, 0x7c, 0xf7, 0x7e,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x59, 0xf7, 0xcd,
-        0xfe, 0x87, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xe6, 0xf9, 0xee, 0x6a, 0xd5, 0x5c, 0xef,
-        0x7d, 0xef, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x9e, 0xef, 0x5a, 0xf7, 0xcc, 0xf6, 0x87, 0xfe, 0x87, 0xfe, 0xa7, 0xfe, 0xa7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0xc7, 0xf5, 0x46, 0xfe, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0xbf,
-        0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x58, 0xf7, 0xaa, 0xfe,
-        0x87, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa7, 0xfe,
-        0xa6, 0xfe, 0xe1, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x14, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x13, 0xf7, 0x87, 0xfe, 0x87, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xa6, 0xfe, 0x87, 0xfe, 0x86, 0xfe, 0xcd, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xc3, 0xff, 0xff, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7b, 0xf7, 0xab, 0xfe, 0x67, 0xfe, 0x87,
-        0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x69, 0xe3, 0x47, 0xfe, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xef, 0x3c, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x35, 0xf7, 0xef, 0xf6, 0xef, 0xf6, 0xef, 0xf6, 0xee, 0xfe, 0xcb, 0xfe, 0xc8, 0xfe, 0xa7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe,
-        0x46, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x9e, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x9e, 0xef, 0x9e, 0xf7, 0x9e, 0xf7, 0x9e, 0xf7, 0x7d, 0xf7,
-        0x7b, 0xf7, 0x36, 0xf7, 0xed, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6,
-        0xfe, 0x87, 0xfe, 0x87, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7c, 0xf7, 0x12, 0xf7, 0xa8, 0xfe,
-        0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x80, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xf7, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e,
-        0xef, 0x7d, 0xf7, 0x13, 0xf7, 0xa8, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x46, 0xf6, 0x66, 0xfe, 0xcd, 0xfe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7d, 0xf7, 0xcf, 0xf6, 0x86, 0xfe, 0xa7,
-        0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0xa6,
-        0xfe, 0xf1, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef,
-        0x38, 0xf7, 0x69, 0xf6, 0x86, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe,
-        0x86, 0xfe, 0x27, 0xf6, 0x87, 0xfe, 0xac, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x5c, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xf7, 0xae, 0xf6, 0x46, 0xf6, 0x87, 0xfe, 0xa7, 0xfe,
-        0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x64, 0xf6, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0xff, 0xf7, 0x3c, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0xf3, 0xf6, 0x06,
-        0xf6, 0x46, 0xf6, 0x87, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0xc6, 0xfe, 0x47, 0xfe, 0xa9,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xe7, 0x1b, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x9e, 0xef, 0xf5, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x66, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x06, 0xf6,
-        0x46, 0xfe, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xe6, 0x98, 0xde, 0x5d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0xf5, 0xee, 0x06, 0xf6, 0x26, 0xf6, 0x46, 0xf6,
-        0x67, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6,
-        0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x45, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7d, 0xde, 0x5d, 0xef, 0x1c, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0xd2, 0xf6, 0x26,
-        0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x87, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x85, 0xfe, 0xa9, 0xfe, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xff, 0xba, 0xde, 0x79, 0xde, 0x3c, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x5c, 0xef, 0x6d, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x87,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0x84, 0xfe, 0xcf, 0xed, 0x46, 0xf6,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xde, 0x1b,
-        0xe7, 0xda, 0xe6, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7e, 0xef, 0xf8, 0xee, 0x28, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6,
-        0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x87, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0xe6, 0xfe, 0x48,
-        0xfe, 0x6d, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xa0, 0xe4, 0x5f, 0xe7, 0x1b, 0xe7, 0x5c, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5c, 0xef, 0x4e, 0xee, 0x06, 0xf6, 0x26,
-        0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x87, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe,
-        0xa7, 0xdc, 0x46, 0xfe, 0x47, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xf6, 0x34, 0xe6, 0xff, 0xf7,
-        0xda, 0xde, 0x3c, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5c, 0xef, 0x71, 0xee,
-        0x07, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x66, 0xfe, 0x66,
-        0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x87, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6,
-        0xfe, 0x66, 0xfe, 0xa7, 0xdc, 0x46, 0xf6, 0x46, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x58, 0xde, 0x15, 0xde, 0xfd, 0xde, 0xda, 0xe6, 0x1c, 0xe7, 0x3c, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7d, 0xef, 0x3b,
-        0xef, 0x71, 0xee, 0x07, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xf6,
-        0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0xa7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xa6, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0xe6, 0xfe, 0x46, 0xfe, 0x46, 0xf6, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xfe, 0x3f, 0xd7, 0xda, 0xe6, 0xc7,
-        0xa2, 0xda, 0xde, 0x1b, 0xe7, 0x3c, 0xe7, 0x3c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-        0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d,
-        0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x3c, 0xef,
-        0x19, 0xef, 0xb4, 0xee, 0x2c, 0xee, 0x06, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46,
-        0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe,
-        0x86, 0xfe, 0x86, 0xfe, 0xa6, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x46, 0xfe, 0x64, 0xfe, 0x48, 0xfe, 0x47, 0xfe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x99, 0xe6, 0x99, 0xde, 0x36, 0xe6, 0xdb, 0xde, 0xff, 0xff, 0x79, 0xde, 0xda, 0xe6, 0xdb,
-        0xde, 0xdb, 0xde, 0xfb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xfb, 0xde, 0xfb, 0xde,
-        0x73, 0xe6, 0x4e, 0xee, 0x4d, 0xee, 0x4d, 0xee, 0x4d, 0xee, 0x4d, 0xee, 0x4d, 0xee, 0x4d,
-        0xee, 0x4d, 0xee, 0x4c, 0xee, 0x29, 0xf6, 0x27, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6,
-        0x46, 0xf6, 0x46, 0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86,
-        0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0xa6, 0xfe, 0xc7, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0xef,
-        0xed, 0x6d, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xee, 0xd2, 0xfe, 0xdb, 0xde,
-        0x99, 0xde, 0xba, 0xe6, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb, 0xde, 0xdb,
-        0xde, 0xdb, 0xde, 0xda, 0xde, 0x60, 0xfd, 0x05, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6,
-        0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46,
-        0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe,
-        0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86,
-        0xfe, 0x86, 0xfe, 0xa6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x06, 0xf6,
-        0x66, 0xfe, 0x65, 0xfe, 0x46, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xfe, 0x06, 0xf6, 0x27, 0xf6, 0xe4, 0xed, 0x26,
-        0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6,
-        0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66,
-        0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe,
-        0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0xa6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x46,
-        0xfe, 0xa6, 0xfe, 0x46, 0xfe, 0x45, 0xf6, 0xa9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x47, 0xfe, 0x48, 0xfe, 0x06, 0xf6, 0x86, 0xed, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x66,
-        0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe,
-        0x66, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86,
-        0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe,
-        0x86, 0xfe, 0xa6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe,
-        0x66, 0xfe, 0x68, 0xfe, 0x66, 0xfe, 0x67, 0xfe, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xfe, 0xc4, 0xdc, 0xe6, 0xf5, 0x06, 0xf6,
-        0x27, 0xf6, 0x26, 0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86,
-        0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe,
-        0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86,
-        0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0xa6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x86,
-        0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x66, 0xfe, 0x87, 0xfe, 0x64, 0xf6, 0xa9, 0xfe, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xac, 0xfe, 0xeb, 0xff, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xfe,
-        0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86,
-        0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe,
-        0xa6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86,
-        0xfe, 0xa6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe,
-        0x66, 0xfe, 0x66, 0xfe, 0x67, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0xd1, 0xf6, 0xac, 0xfe, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xfe, 0xa0, 0xe4, 0x26,
-        0xf6, 0x46, 0xf6, 0x8d, 0xfe, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe,
-        0x86, 0xfe, 0x86, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6,
-        0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe,
-        0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x86,
-        0xfe, 0x86, 0xfe, 0x46, 0xfe, 0x2c, 0xf5, 0x66, 0xfe, 0x66, 0xfe, 0xa0, 0xf5, 0xcd, 0xfe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xfe, 0x67, 0xfe, 0x46, 0xf6, 0x46, 0xfe, 0x27,
-        0xfe, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe,
-        0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86,
-        0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x46, 0xfe,
-        0x66, 0xfe, 0x46, 0xfe, 0xe7, 0xf5, 0x86, 0xfe, 0x66, 0xfe, 0x67, 0xfe, 0x46, 0xfe, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0xcd, 0xfe, 0xe1, 0xf5, 0x46, 0xfe, 0x26, 0xf6, 0x46, 0xf6, 0x86, 0xfe, 0x48, 0xfe, 0x26,
-        0xf6, 0x26, 0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x46, 0xf6,
-        0x46, 0xf6, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x46, 0xfe, 0x47, 0xf6, 0x46, 0xf6, 0x66,
-        0xfe, 0x48, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0xe1, 0xf5, 0xcd, 0xfe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xfe,
-        0xff, 0xff, 0x67, 0xfe, 0x46, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x86, 0xfe, 0x86,
-        0xfe, 0xc6, 0xfe, 0x27, 0xff, 0x27, 0xff, 0xe7, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x66, 0xfe,
-        0x46, 0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x67, 0xfe, 0xf0, 0xff, 0x4a, 0xff, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x16, 0x2b, 0x3d, 0x57, 0x70, 0x89, 0x99, 0xa2,
-        0xa2, 0x99, 0x89, 0x70, 0x57, 0x3c, 0x2b, 0x16, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x1f, 0x3f,
-        0x7e, 0xaa, 0xc6, 0xe8, 0xf6, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf9,
-        0xf6, 0xe8, 0xc6, 0xa9, 0x7d, 0x40, 0x1f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x01, 0x1e, 0x5a, 0xa1, 0xd7, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-        0xf4, 0xd7, 0xa0, 0x59, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x40, 0x91,
-        0xd7, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xd6,
-        0x91, 0x40, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x48, 0xa8, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xa7, 0x47, 0x0a,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x42,
-        0xac, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xac, 0x3f, 0x03, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x8b, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x8b, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x07, 0x5b, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xd1, 0x59, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x8d, 0xf3, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x8c,
-        0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x35, 0xb9, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb7, 0x33, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xd9, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xe1, 0x51, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0x5f, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x5e,
-        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xe8, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x51, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x46, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xd9, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xd7, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x16, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x07, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x8c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xf3, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xf2, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x22, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0,
-        0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8b,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0x03, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x0b, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xa9, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xf2, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x45, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x40, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xec, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x01,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x5a, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xf8, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xa1, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
-        0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x1f, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
-        0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xf3, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xfe, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-        0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x05, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x03, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xc6,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xe7, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x3d, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x3c, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xf9,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xfc, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x6d, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x6d, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xf9,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xf6, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x2d, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x2a, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xc5,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xc4, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xa7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7c, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7b, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-        0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xf4, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xe5, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7,
-        0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0x70, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x03, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xed,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xf7, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x1d,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x72, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xc7, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xed, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x08, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9e, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xaa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x3e, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x02, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf,
-        0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x30, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xfe, 0x8a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb0, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x15, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x0a, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xe1, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xcb,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x52, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xd8, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xe8, 0x5e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x52, 0x01,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x1c, 0x81, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2e, 0x79,
-        0xbe, 0xde, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-        0xb5, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x29, 0x49, 0x57, 0x58,
-        0x58, 0x58, 0x58, 0x58, 0x58, 0x94, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x8a, 0x15, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x06, 0x57, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xcf, 0x57, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x90, 0xeb,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x88, 0x21, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0xae, 0xf2, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xf0, 0xa9, 0x3f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x48, 0xa9, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xa6, 0x47, 0x09,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x09, 0x3f, 0x8e, 0xd5, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xf7, 0xd4, 0x8f, 0x3f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0x1e, 0x5c, 0x9f, 0xd6, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf4, 0xd6, 0x9f, 0x56, 0x1c,
-        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1e, 0x42,
-        0x7f, 0xa8, 0xc6, 0xeb, 0xf6, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf9,
-        0xf6, 0xe7, 0xc4, 0xa8, 0x7a, 0x3e, 0x1e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x16, 0x2d, 0x3c,
-        0x52, 0x70, 0x85, 0x93, 0xa2, 0xa1, 0x98, 0x89, 0x71, 0x54, 0x3a, 0x2b, 0x15, 0x04, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0x00, 0x00, 0x00, 0x4f, 0x11, 0x00, 0x00, 0x30, 0x75, 0x00, 0x00, 0x7f, 0x00, 0x00,
+        0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x68, 0x00, 0x00,
+        0x82, 0x2a, 0xff, 0xe7, 0xfe, 0x04, 0xea, 0xfe, 0x84, 0xe9, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe,
+        0xa6, 0xfe, 0x02, 0xa5, 0xfe, 0x85, 0xa6, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xe8, 0xfe, 0xe9,
+        0xfe, 0x03, 0xea, 0xfe, 0x82, 0xe7, 0xfe, 0x2a, 0xff, 0x4a, 0x00, 0x00, 0x82, 0x6d, 0xf6,
+        0xe0, 0xff, 0x02, 0xea, 0xfe, 0x84, 0xe9, 0xfe, 0xc8, 0xfe, 0xeb, 0xfe, 0x0b, 0xff, 0x03,
+        0xea, 0xfe, 0x08, 0xe9, 0xfe, 0x87, 0xea, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0x0b, 0xff, 0xec,
+        0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0x02, 0xea, 0xfe, 0x82, 0x08, 0xff, 0xcd, 0xfe, 0x44, 0x00,
+        0x00, 0x85, 0xea, 0xfe, 0x0b, 0xff, 0xea, 0xfe, 0xe9, 0xfe, 0xec, 0xfe, 0x02, 0xea, 0xfe,
+        0x05, 0xe9, 0xfe, 0x81, 0xe8, 0xfe, 0x0a, 0xc8, 0xfe, 0x81, 0xe8, 0xfe, 0x04, 0xe9, 0xfe,
+        0x82, 0xea, 0xfe, 0x0c, 0xff, 0x02, 0xe9, 0xfe, 0x82, 0x0b, 0xff, 0xea, 0xfe, 0x3f, 0x00,
+        0x00, 0x82, 0xcd, 0xfe, 0x06, 0xff, 0x02, 0xea, 0xfe, 0x81, 0x74, 0xff, 0x02, 0xea, 0xfe,
+        0x03, 0xe9, 0xfe, 0x16, 0xc8, 0xfe, 0x02, 0xe9, 0xfe, 0x86, 0xea, 0xfe, 0x96, 0xff, 0xe9,
+        0xfe, 0xea, 0xfe, 0x02, 0xff, 0xcd, 0xfe, 0x3a, 0x00, 0x00, 0x02, 0x6d, 0xf6, 0x02, 0xea,
+        0xfe, 0x82, 0xeb, 0xfe, 0xea, 0xfe, 0x03, 0xe9, 0xfe, 0x16, 0xc8, 0xfe, 0x03, 0xc7, 0xfe,
+        0x03, 0xc8, 0xfe, 0x87, 0xe9, 0xfe, 0xea, 0xfe, 0x0a, 0xff, 0xe8, 0xfe, 0xea, 0xfe, 0xf0,
+        0xfe, 0xcc, 0xfe, 0x36, 0x00, 0x00, 0x86, 0x0d, 0xff, 0xc6, 0xfe, 0xea, 0xfe, 0x09, 0xff,
+        0xeb, 0xfe, 0xea, 0xfe, 0x02, 0xe9, 0xfe, 0x1a, 0xc8, 0xfe, 0x05, 0xc7, 0xfe, 0x02, 0xc8,
+        0xfe, 0x02, 0xe9, 0xfe, 0x85, 0x0b, 0xff, 0xe9, 0xfe, 0xea, 0xfe, 0xc6, 0xfe, 0x0d, 0xff,
+        0x33, 0x00, 0x00, 0x02, 0xeb, 0xfe, 0x83, 0xe9, 0xfe, 0x0c, 0xff, 0xea, 0xfe, 0x02, 0xe9,
+        0xfe, 0x1c, 0xc8, 0xfe, 0x08, 0xc7, 0xfe, 0x81, 0xc8, 0xfe, 0x02, 0xe9, 0xfe, 0x84, 0x0d,
+        0xff, 0xe9, 0xfe, 0xeb, 0xfe, 0xea, 0xfe, 0x30, 0x00, 0x00, 0x85, 0x0d, 0xff, 0xe9, 0xfe,
+        0xea, 0xfe, 0xe8, 0xfe, 0xea, 0xfe, 0x02, 0xe9, 0xfe, 0x1e, 0xc8, 0xfe, 0x0a, 0xc7, 0xfe,
+        0x87, 0xc8, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xa5, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xa9, 0xfe,
+        0x2d, 0x00, 0x00, 0x85, 0xea, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xeb, 0xfe, 0xea, 0xfe, 0x02,
+        0xe9, 0xfe, 0x81, 0xe8, 0xfe, 0x1e, 0xc8, 0xfe, 0x0c, 0xc7, 0xfe, 0x86, 0xc8, 0xfe, 0xe9,
+        0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0x09, 0xff, 0xe9, 0xfe, 0x2b, 0x00, 0x00, 0x85, 0xa9, 0xfe,
+        0xaa, 0xfe, 0xea, 0xfe, 0xeb, 0xfe, 0xea, 0xfe, 0x02, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1d,
+        0xc8, 0xfe, 0x0d, 0xc7, 0xfe, 0x02, 0xc8, 0xfe, 0x84, 0xe9, 0xfe, 0xc8, 0xfe, 0x70, 0xf6,
+        0x6d, 0xf6, 0x29, 0x00, 0x00, 0x02, 0xea, 0xfe, 0x82, 0x09, 0xff, 0xea, 0xfe, 0x04, 0xe9,
+        0xfe, 0x03, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x0f, 0xc7, 0xfe, 0x85, 0xc8, 0xfe, 0xc9, 0xfe,
+        0xe7, 0xfe, 0x69, 0xfe, 0x47, 0xfe, 0x27, 0x00, 0x00, 0x02, 0xeb, 0xfe, 0x82, 0xc7, 0xfe,
+        0xea, 0xfe, 0x05, 0xe9, 0xfe, 0x04, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe, 0x10, 0xc7, 0xfe, 0x85,
+        0xc8, 0xfe, 0xc9, 0xfe, 0x6a, 0xff, 0xca, 0xfe, 0xeb, 0xfe, 0x25, 0x00, 0x00, 0x02, 0xeb,
+        0xfe, 0x82, 0x54, 0xff, 0xea, 0xfe, 0x07, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe,
+        0x11, 0xc7, 0xfe, 0x83, 0xc8, 0xfe, 0xe9, 0xfe, 0xba, 0xff, 0x02, 0xeb, 0xfe, 0x23, 0x00,
+        0x00, 0x84, 0xea, 0xfe, 0xeb, 0xfe, 0x54, 0xff, 0xea, 0xfe, 0x08, 0xe9, 0xfe, 0x03, 0xe8,
+        0xfe, 0x1c, 0xc8, 0xfe, 0x12, 0xc7, 0xfe, 0x02, 0xc8, 0xfe, 0x83, 0xbb, 0xff, 0xca, 0xfe,
+        0x47, 0xfe, 0x21, 0x00, 0x00, 0x84, 0xa9, 0xfe, 0xea, 0xfe, 0xc7, 0xfe, 0xea, 0xfe, 0x09,
+        0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe, 0x14, 0xc7, 0xfe, 0x84, 0xc9, 0xfe, 0x69,
+        0xff, 0x68, 0xfe, 0x6d, 0xf6, 0x1f, 0x00, 0x00, 0x84, 0xea, 0xfe, 0xaa, 0xfe, 0x09, 0xff,
+        0xea, 0xfe, 0x0a, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe, 0x15, 0xc7, 0xfe, 0x84,
+        0xc8, 0xfe, 0xe6, 0xfe, 0x71, 0xf6, 0xe9, 0xfe, 0x1d, 0x00, 0x00, 0x82, 0x0d, 0xff, 0xe9,
+        0xfe, 0x02, 0xea, 0xfe, 0x0a, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x16, 0xc7,
+        0xfe, 0x84, 0xc9, 0xfe, 0xc8, 0xfe, 0xe8, 0xfe, 0xa9, 0xfe, 0x1c, 0x00, 0x00, 0x83, 0xe9,
+        0xfe, 0xea, 0xfe, 0xeb, 0xfe, 0x0b, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x16,
+        0xc7, 0xfe, 0x81, 0xc8, 0xfe, 0x03, 0xe9, 0xfe, 0x1b, 0x00, 0x00, 0x84, 0xeb, 0xfe, 0xea,
+        0xfe, 0xeb, 0xfe, 0xea, 0xfe, 0x0a, 0xe9, 0xfe, 0x04, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x17,
+        0xc7, 0xfe, 0x81, 0xc8, 0xfe, 0x03, 0xea, 0xfe, 0x19, 0x00, 0x00, 0x84, 0x0d, 0xff, 0x0c,
+        0xff, 0xc7, 0xfe, 0xea, 0xfe, 0x0a, 0xe9, 0xfe, 0x04, 0xe8, 0xfe, 0x1e, 0xc8, 0xfe, 0x18,
+        0xc7, 0xfe, 0x84, 0xe8, 0xfe, 0x83, 0xfe, 0x0c, 0xff, 0xa9, 0xfe, 0x18, 0x00, 0x00, 0x83,
+        0xc6, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0x0a, 0xe9, 0xfe, 0x05, 0xe8, 0xfe, 0x1e, 0xc8, 0xfe,
+        0x19, 0xc7, 0xfe, 0x02, 0xc8, 0xfe, 0x81, 0x0a, 0xff, 0x17, 0x00, 0x00, 0x83, 0x6d, 0xf6,
+        0xea, 0xfe, 0x0c, 0xff, 0x02, 0xe9, 0xfe, 0x02, 0xe8, 0xfe, 0x05, 0xe9, 0xfe, 0x06, 0xe8,
+        0xfe, 0x1f, 0xc8, 0xfe, 0x19, 0xc7, 0xfe, 0x84, 0xc8, 0xfe, 0x0d, 0xff, 0xea, 0xfe, 0xcc,
+        0xfe, 0x16, 0x00, 0x00, 0x84, 0x6f, 0xf6, 0xe9, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0x0d, 0xe8,
+        0xfe, 0x1f, 0xc8, 0xfe, 0x1b, 0xc7, 0xfe, 0x83, 0xc8, 0xfe, 0xc7, 0xfe, 0xf3, 0xfe, 0x15,
+        0x00, 0x00, 0x85, 0xcd, 0xfe, 0xea, 0xfe, 0xeb, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0x0b, 0xe8,
+        0xfe, 0x21, 0xc8, 0xfe, 0x1c, 0xc7, 0xfe, 0x83, 0xe9, 0xfe, 0xc8, 0xfe, 0xcd, 0xfe, 0x14,
+        0x00, 0x00, 0x81, 0xe3, 0xfe, 0x02, 0xe9, 0xfe, 0x81, 0xc9, 0xfe, 0x04, 0xc8, 0xfe, 0x06,
+        0xe8, 0xfe, 0x23, 0xc8, 0xfe, 0x1c, 0xc7, 0xfe, 0x83, 0xc8, 0xfe, 0xe8, 0xfe, 0x63, 0xff,
+        0x14, 0x00, 0x00, 0x83, 0xea, 0xfe, 0xeb, 0xfe, 0xe9, 0xfe, 0x2e, 0xc8, 0xfe, 0x1d, 0xc7,
+        0xfe, 0x02, 0xa8, 0xfe, 0x13, 0x00, 0x00, 0x81, 0xea, 0xfe, 0x02, 0xe9, 0xfe, 0x2e, 0xc8,
+        0xfe, 0x1e, 0xc7, 0xfe, 0x83, 0xc8, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0x12, 0x00, 0x00, 0x83,
+        0x0b, 0xff, 0xb6, 0xff, 0xe9, 0xfe, 0x2e, 0xc8, 0xfe, 0x1f, 0xc7, 0xfe, 0x82, 0x90, 0xfe,
+        0xc8, 0xfe, 0x11, 0x00, 0x00, 0x84, 0x6d, 0xf6, 0xe9, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0x2e,
+        0xc8, 0xfe, 0x1f, 0xc7, 0xfe, 0x83, 0xc8, 0xfe, 0xc7, 0xfe, 0xcd, 0xfe, 0x10, 0x00, 0x00,
+        0x83, 0xe0, 0xff, 0xe8, 0xfe, 0xe9, 0xfe, 0x2e, 0xc8, 0xfe, 0x20, 0xc7, 0xfe, 0x83, 0xa7,
+        0xfe, 0xc7, 0xfe, 0x08, 0xff, 0x10, 0x00, 0x00, 0x83, 0xea, 0xfe, 0xec, 0xfe, 0xe9, 0xfe,
+        0x2e, 0xc8, 0xfe, 0x21, 0xc7, 0xfe, 0x82, 0x2e, 0xff, 0xea, 0xfe, 0x10, 0x00, 0x00, 0x02,
+        0xe9, 0xfe, 0x81, 0xe8, 0xfe, 0x2d, 0xc8, 0xfe, 0x22, 0xc7, 0xfe, 0x02, 0xe8, 0xfe, 0x0f,
+        0x00, 0x00, 0x83, 0x2a, 0xff, 0xc8, 0xfe, 0xe9, 0xfe, 0x2e, 0xc8, 0xfe, 0x22, 0xc7, 0xfe,
+        0x83, 0xc8, 0xfe, 0xc7, 0xfe, 0xa9, 0xfe, 0x0e, 0x00, 0x00, 0x83, 0xe8, 0xfe, 0xc8, 0xfe,
+        0xe9, 0xfe, 0x2d, 0xc8, 0xfe, 0x23, 0xc7, 0xfe, 0x83, 0xc8, 0xfe, 0xa6, 0xfe, 0xff, 0xff,
+        0x0e, 0x00, 0x00, 0x82, 0xea, 0xfe, 0xeb, 0xfe, 0x2e, 0xc8, 0xfe, 0x24, 0xc7, 0xfe, 0x82,
+        0x48, 0xfe, 0x87, 0xfe, 0x0e, 0x00, 0x00, 0x82, 0xe9, 0xfe, 0xea, 0xfe, 0x2d, 0xc8, 0xfe,
+        0x23, 0xc7, 0xfe, 0x81, 0xc6, 0xfe, 0x03, 0xa7, 0xfe, 0x0e, 0x00, 0x00, 0x02, 0xe9, 0xfe,
+        0x2d, 0xc8, 0xfe, 0x23, 0xc7, 0xfe, 0x02, 0xc6, 0xfe, 0x02, 0xa7, 0xfe, 0x0e, 0x00, 0x00,
+        0x2e, 0xc8, 0xfe, 0x23, 0xc7, 0xfe, 0x03, 0xc6, 0xfe, 0x82, 0xa7, 0xfe, 0xc6, 0xfe, 0x0e,
+        0x00, 0x00, 0x82, 0xc7, 0xfe, 0xe9, 0xfe, 0x2b, 0xc8, 0xfe, 0x24, 0xc7, 0xfe, 0x03, 0xc6,
+        0xfe, 0x82, 0xa7, 0xfe, 0xc6, 0xfe, 0x0e, 0x00, 0x00, 0x82, 0xc7, 0xfe, 0xe9, 0xfe, 0x2a,
+        0xc8, 0xfe, 0x25, 0xc7, 0xfe, 0x03, 0xc6, 0xfe, 0x82, 0xc7, 0xfe, 0xc6, 0xfe, 0x0e, 0x00,
+        0x00, 0x82, 0xc7, 0xfe, 0xe9, 0xfe, 0x29, 0xc8, 0xfe, 0x25, 0xc7, 0xfe, 0x04, 0xc6, 0xfe,
+        0x82, 0xa6, 0xfe, 0xe6, 0xfe, 0x0e, 0x00, 0x00, 0x82, 0xc7, 0xfe, 0xe8, 0xfe, 0x28, 0xc8,
+        0xfe, 0x26, 0xc7, 0xfe, 0x04, 0xc6, 0xfe, 0x82, 0xa6, 0xfe, 0xc6, 0xfe, 0x0e, 0x00, 0x00,
+        0x29, 0xc8, 0xfe, 0x26, 0xc7, 0xfe, 0x05, 0xc6, 0xfe, 0x82, 0xa7, 0xfe, 0xc6, 0xfe, 0x0e,
+        0x00, 0x00, 0x28, 0xc8, 0xfe, 0x27, 0xc7, 0xfe, 0x05, 0xc6, 0xfe, 0x82, 0xa7, 0xfe, 0xc6,
+        0xfe, 0x0e, 0x00, 0x00, 0x81, 0xc7, 0xfe, 0x26, 0xc8, 0xfe, 0x27, 0xc7, 0xfe, 0x06, 0xc6,
+        0xfe, 0x82, 0xa6, 0xfe, 0xc6, 0xfe, 0x0e, 0x00, 0x00, 0x81, 0xe7, 0xfe, 0x25, 0xc8, 0xfe,
+        0x28, 0xc7, 0xfe, 0x06, 0xc6, 0xfe, 0x82, 0xa6, 0xfe, 0xe6, 0xfe, 0x0e, 0x00, 0x00, 0x81,
+        0xc7, 0xfe, 0x24, 0xc8, 0xfe, 0x28, 0xc7, 0xfe, 0x07, 0xc6, 0xfe, 0x82, 0xa7, 0xfe, 0xc6,
+        0xfe, 0x0e, 0x00, 0x00, 0x81, 0xc7, 0xfe, 0x22, 0xc8, 0xfe, 0x2a, 0xc7, 0xfe, 0x07, 0xc6,
+        0xfe, 0x82, 0x86, 0xfe, 0xc6, 0xfe, 0x0e, 0x00, 0x00, 0x81, 0xc7, 0xfe, 0x20, 0xc8, 0xfe,
+        0x2b, 0xc7, 0xfe, 0x08, 0xc6, 0xfe, 0x82, 0xa7, 0xfe, 0xc6, 0xfe, 0x0e, 0x00, 0x00, 0x20,
+        0xc8, 0xfe, 0x2c, 0xc7, 0xfe, 0x07, 0xc6, 0xfe, 0x03, 0xa6, 0xfe, 0x0e, 0x00, 0x00, 0x02,
+        0xc9, 0xfe, 0x81, 0xc8, 0xfe, 0x08, 0xc7, 0xfe, 0x06, 0xa7, 0xfe, 0x07, 0xc7, 0xfe, 0x05,
+        0xc8, 0xfe, 0x2e, 0xc7, 0xfe, 0x08, 0xc6, 0xfe, 0x81, 0xa6, 0xfe, 0x02, 0x66, 0xfe, 0x0e,
+        0x00, 0x00, 0x82, 0x67, 0xfe, 0x47, 0xfe, 0x04, 0xc7, 0xfe, 0x8b, 0xa7, 0xfe, 0xca, 0xfe,
+        0xed, 0xfe, 0x12, 0xf7, 0x35, 0xf7, 0x56, 0xf7, 0x35, 0xf7, 0x33, 0xf7, 0x10, 0xf7, 0xcb,
+        0xfe, 0xc8, 0xfe, 0x04, 0xa7, 0xfe, 0x05, 0xc7, 0xfe, 0x81, 0xc8, 0xfe, 0x30, 0xc7, 0xfe,
+        0x08, 0xc6, 0xfe, 0x83, 0xa6, 0xfe, 0x28, 0xfe, 0x67, 0xfe, 0x0e, 0x00, 0x00, 0x82, 0xad,
+        0xff, 0xa7, 0xfe, 0x03, 0xc7, 0xfe, 0x87, 0xca, 0xfe, 0x12, 0xf7, 0x59, 0xf7, 0x7c, 0xf7,
+        0x7d, 0xef, 0x7e, 0xef, 0x9e, 0xef, 0x02, 0x7e, 0xef, 0x85, 0x9d, 0xf7, 0x7c, 0xf7, 0x56,
+        0xf7, 0xee, 0xfe, 0xa8, 0xfe, 0x04, 0xa7, 0xfe, 0x33, 0xc7, 0xfe, 0x09, 0xc6, 0xfe, 0x02,
+        0xa6, 0xfe, 0x81, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x81, 0x2a, 0xff, 0x02, 0xa7, 0xfe, 0x85,
+        0xa8, 0xfe, 0x0f, 0xff, 0x79, 0xf7, 0x7d, 0xf7, 0x7e, 0xef, 0x07, 0x7d, 0xef, 0x85, 0x7e,
+        0xef, 0x9e, 0xef, 0x7c, 0xf7, 0x35, 0xf7, 0xcb, 0xfe, 0x04, 0xa7, 0xfe, 0x31, 0xc7, 0xfe,
+        0x0a, 0xc6, 0xfe, 0x02, 0xa6, 0xfe, 0x81, 0xa9, 0xfe, 0x0e, 0x00, 0x00, 0x86, 0x1b, 0xef,
+        0xef, 0xf6, 0xcc, 0xfe, 0x33, 0xf7, 0x7c, 0xf7, 0x7e, 0xef, 0x0b, 0x7d, 0xef, 0x02, 0x7e,
+        0xef, 0x83, 0x59, 0xf7, 0xcd, 0xfe, 0x87, 0xfe, 0x03, 0xa7, 0xfe, 0x30, 0xc7, 0xfe, 0x09,
+        0xc6, 0xfe, 0x83, 0xa6, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x0e, 0x00, 0x00, 0x86, 0x99, 0xe6,
+        0xf9, 0xee, 0x6a, 0xd5, 0x5c, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x0e, 0x7d, 0xef, 0x83, 0x9e,
+        0xef, 0x5a, 0xf7, 0xcc, 0xf6, 0x02, 0x87, 0xfe, 0x02, 0xa7, 0xfe, 0x2e, 0xc7, 0xfe, 0x0a,
+        0xc6, 0xfe, 0x83, 0xa6, 0xfe, 0xc7, 0xf5, 0x46, 0xfe, 0x0e, 0x00, 0x00, 0x83, 0x01, 0xaa,
+        0xbf, 0xef, 0x5d, 0xef, 0x12, 0x7d, 0xef, 0x84, 0x7e, 0xef, 0x58, 0xf7, 0xaa, 0xfe, 0x87,
+        0xfe, 0x03, 0xa7, 0xfe, 0x2c, 0xc7, 0xfe, 0x0b, 0xc6, 0xfe, 0x83, 0xa7, 0xfe, 0xa6, 0xfe,
+        0xe1, 0xf5, 0x0d, 0x00, 0x00, 0x83, 0x14, 0xef, 0x5d, 0xef, 0x3c, 0xef, 0x15, 0x7d, 0xef,
+        0x81, 0x13, 0xf7, 0x02, 0x87, 0xfe, 0x03, 0xa7, 0xfe, 0x2a, 0xc7, 0xfe, 0x0b, 0xc6, 0xfe,
+        0x84, 0xa6, 0xfe, 0x87, 0xfe, 0x86, 0xfe, 0xcd, 0xfe, 0x0d, 0x00, 0x00, 0x83, 0x40, 0xc3,
+        0xff, 0xff, 0x5d, 0xef, 0x14, 0x7d, 0xef, 0x85, 0x7e, 0xef, 0x7b, 0xf7, 0xab, 0xfe, 0x67,
+        0xfe, 0x87, 0xfe, 0x03, 0xa7, 0xfe, 0x29, 0xc7, 0xfe, 0x0b, 0xc6, 0xfe, 0x83, 0xa6, 0xfe,
+        0x69, 0xe3, 0x47, 0xfe, 0x0e, 0x00, 0x00, 0x02, 0x3c, 0xef, 0x17, 0x7d, 0xef, 0x81, 0x35,
+        0xf7, 0x03, 0xef, 0xf6, 0x84, 0xee, 0xfe, 0xcb, 0xfe, 0xc8, 0xfe, 0xa7, 0xfe, 0x26, 0xc7,
+        0xfe, 0x0b, 0xc6, 0xfe, 0x03, 0xa6, 0xfe, 0x81, 0x46, 0xfe, 0x0e, 0x00, 0x00, 0x82, 0x9e,
+        0xef, 0x5d, 0xef, 0x17, 0x7d, 0xef, 0x81, 0x9e, 0xef, 0x03, 0x9e, 0xf7, 0x84, 0x7d, 0xf7,
+        0x7b, 0xf7, 0x36, 0xf7, 0xed, 0xfe, 0x03, 0xa7, 0xfe, 0x22, 0xc7, 0xfe, 0x0c, 0xc6, 0xfe,
+        0x81, 0xa6, 0xfe, 0x02, 0x87, 0xfe, 0x0f, 0x00, 0x00, 0x82, 0xff, 0xff, 0x5d, 0xef, 0x1c,
+        0x7d, 0xef, 0x02, 0x7e, 0xef, 0x83, 0x7c, 0xf7, 0x12, 0xf7, 0xa8, 0xfe, 0x05, 0xa7, 0xfe,
+        0x1d, 0xc7, 0xfe, 0x0c, 0xc6, 0xfe, 0x81, 0xa6, 0xfe, 0x02, 0x86, 0xfe, 0x81, 0x80, 0xfe,
+        0x0f, 0x00, 0x00, 0x81, 0x3c, 0xf7, 0x1f, 0x7d, 0xef, 0x84, 0x7e, 0xef, 0x7d, 0xf7, 0x13,
+        0xf7, 0xa8, 0xfe, 0x04, 0xa7, 0xfe, 0x1c, 0xc7, 0xfe, 0x0d, 0xc6, 0xfe, 0x84, 0xa6, 0xfe,
+        0x46, 0xf6, 0x66, 0xfe, 0xcd, 0xfe, 0x0f, 0x00, 0x00, 0x21, 0x7d, 0xef, 0x84, 0x7e, 0xef,
+        0x7d, 0xf7, 0xcf, 0xf6, 0x86, 0xfe, 0x04, 0xa7, 0xfe, 0x1a, 0xc7, 0xfe, 0x0d, 0xc6, 0xfe,
+        0x84, 0xa6, 0xfe, 0x86, 0xfe, 0xa6, 0xfe, 0xf1, 0xf5, 0x10, 0x00, 0x00, 0x22, 0x7d, 0xef,
+        0x84, 0x7e, 0xef, 0x38, 0xf7, 0x69, 0xf6, 0x86, 0xfe, 0x04, 0xa7, 0xfe, 0x18, 0xc7, 0xfe,
+        0x0d, 0xc6, 0xfe, 0x85, 0xa6, 0xfe, 0x86, 0xfe, 0x27, 0xf6, 0x87, 0xfe, 0xac, 0xfe, 0x10,
+        0x00, 0x00, 0x82, 0xff, 0xff, 0x5c, 0xef, 0x21, 0x7d, 0xef, 0x84, 0x7d, 0xf7, 0xae, 0xf6,
+        0x46, 0xf6, 0x87, 0xfe, 0x03, 0xa7, 0xfe, 0x17, 0xc7, 0xfe, 0x0e, 0xc6, 0xfe, 0x81, 0xa6,
+        0xfe, 0x02, 0x66, 0xfe, 0x81, 0x64, 0xf6, 0x11, 0x00, 0x00, 0x82, 0xff, 0xf7, 0x3c, 0xef,
+        0x21, 0x7d, 0xef, 0x85, 0x7e, 0xef, 0xf3, 0xf6, 0x06, 0xf6, 0x46, 0xf6, 0x87, 0xfe, 0x02,
+        0xa7, 0xfe, 0x16, 0xc7, 0xfe, 0x0e, 0xc6, 0xfe, 0x85, 0xa6, 0xfe, 0x86, 0xfe, 0xc6, 0xfe,
+        0x47, 0xfe, 0xa9, 0xfe, 0x11, 0x00, 0x00, 0x82, 0x1c, 0xe7, 0x1b, 0xe7, 0x21, 0x7d, 0xef,
+        0x85, 0x9e, 0xef, 0xf5, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x66, 0xfe, 0x02, 0xa7, 0xfe, 0x15,
+        0xc7, 0xfe, 0x0e, 0xc6, 0xfe, 0x85, 0xa6, 0xfe, 0x86, 0xfe, 0x06, 0xf6, 0x46, 0xfe, 0x66,
+        0xfe, 0x12, 0x00, 0x00, 0x83, 0x99, 0xe6, 0x98, 0xde, 0x5d, 0xef, 0x20, 0x7d, 0xef, 0x87,
+        0x7e, 0xef, 0xf5, 0xee, 0x06, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x67, 0xfe, 0xa7, 0xfe, 0x14,
+        0xc7, 0xfe, 0x0f, 0xc6, 0xfe, 0x81, 0xa6, 0xfe, 0x02, 0x66, 0xfe, 0x81, 0x45, 0xf6, 0x13,
+        0x00, 0x00, 0x83, 0x7d, 0xde, 0x5d, 0xef, 0x1c, 0xe7, 0x21, 0x7d, 0xef, 0x81, 0xd2, 0xf6,
+        0x03, 0x26, 0xf6, 0x83, 0x46, 0xf6, 0x87, 0xfe, 0xa7, 0xfe, 0x12, 0xc7, 0xfe, 0x0f, 0xc6,
+        0xfe, 0x81, 0x86, 0xfe, 0x02, 0x66, 0xfe, 0x82, 0x85, 0xfe, 0xa9, 0xfe, 0x13, 0x00, 0x00,
+        0x84, 0xcb, 0xff, 0xba, 0xde, 0x79, 0xde, 0x3c, 0xef, 0x1f, 0x7d, 0xef, 0x82, 0x5c, 0xef,
+        0x6d, 0xf6, 0x02, 0x26, 0xf6, 0x02, 0x46, 0xf6, 0x82, 0x66, 0xfe, 0x87, 0xfe, 0x11, 0xc7,
+        0xfe, 0x0f, 0xc6, 0xfe, 0x85, 0xa6, 0xfe, 0x66, 0xfe, 0x84, 0xfe, 0xcf, 0xed, 0x46, 0xf6,
+        0x15, 0x00, 0x00, 0x84, 0xdb, 0xde, 0x1b, 0xe7, 0xda, 0xe6, 0x5d, 0xef, 0x1d, 0x7d, 0xef,
+        0x83, 0x7e, 0xef, 0xf8, 0xee, 0x28, 0xf6, 0x02, 0x26, 0xf6, 0x82, 0x46, 0xf6, 0x46, 0xfe,
+        0x02, 0x66, 0xfe, 0x81, 0x87, 0xfe, 0x0e, 0xc7, 0xfe, 0x10, 0xc6, 0xfe, 0x85, 0xa6, 0xfe,
+        0x66, 0xfe, 0xe6, 0xfe, 0x48, 0xfe, 0x6d, 0xf6, 0x17, 0x00, 0x00, 0x84, 0xa0, 0xe4, 0x5f,
+        0xe7, 0x1b, 0xe7, 0x5c, 0xef, 0x1c, 0x7d, 0xef, 0x83, 0x5c, 0xef, 0x4e, 0xee, 0x06, 0xf6,
+        0x02, 0x26, 0xf6, 0x82, 0x46, 0xf6, 0x46, 0xfe, 0x03, 0x66, 0xfe, 0x81, 0x87, 0xfe, 0x0c,
+        0xc7, 0xfe, 0x10, 0xc6, 0xfe, 0x85, 0xa6, 0xfe, 0x66, 0xfe, 0xa7, 0xdc, 0x46, 0xfe, 0x47,
+        0xfe, 0x18, 0x00, 0x00, 0x85, 0x6d, 0xf6, 0x34, 0xe6, 0xff, 0xf7, 0xda, 0xde, 0x3c, 0xe7,
+        0x1a, 0x7d, 0xef, 0x85, 0x5c, 0xef, 0x71, 0xee, 0x07, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x02,
+        0x46, 0xf6, 0x05, 0x66, 0xfe, 0x81, 0x87, 0xfe, 0x09, 0xc7, 0xfe, 0x11, 0xc6, 0xfe, 0x83,
+        0xa6, 0xfe, 0x66, 0xfe, 0xa7, 0xdc, 0x02, 0x46, 0xf6, 0x1a, 0x00, 0x00, 0x86, 0x58, 0xde,
+        0x15, 0xde, 0xfd, 0xde, 0xda, 0xe6, 0x1c, 0xe7, 0x3c, 0xef, 0x15, 0x7d, 0xef, 0x85, 0x7e,
+        0xef, 0x7d, 0xef, 0x3b, 0xef, 0x71, 0xee, 0x07, 0xf6, 0x03, 0x26, 0xf6, 0x02, 0x46, 0xf6,
+        0x05, 0x66, 0xfe, 0x82, 0x86, 0xfe, 0xa7, 0xfe, 0x07, 0xc7, 0xfe, 0x10, 0xc6, 0xfe, 0x86,
+        0xa6, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0xe6, 0xfe, 0x46, 0xfe, 0x46, 0xf6, 0x1c, 0x00, 0x00,
+        0x88, 0xcd, 0xfe, 0x3f, 0xd7, 0xda, 0xe6, 0xc7, 0xa2, 0xda, 0xde, 0x1b, 0xe7, 0x3c, 0xe7,
+        0x3c, 0xef, 0x11, 0x5d, 0xef, 0x85, 0x3c, 0xef, 0x19, 0xef, 0xb4, 0xee, 0x2c, 0xee, 0x06,
+        0xf6, 0x03, 0x26, 0xf6, 0x02, 0x46, 0xf6, 0x03, 0x66, 0xfe, 0x05, 0x86, 0xfe, 0x81, 0xa6,
+        0xfe, 0x04, 0xc7, 0xfe, 0x11, 0xc6, 0xfe, 0x86, 0xa6, 0xfe, 0x86, 0xfe, 0x46, 0xfe, 0x64,
+        0xfe, 0x48, 0xfe, 0x47, 0xfe, 0x1e, 0x00, 0x00, 0x87, 0x99, 0xe6, 0x99, 0xde, 0x36, 0xe6,
+        0xdb, 0xde, 0xff, 0xff, 0x79, 0xde, 0xda, 0xe6, 0x02, 0xdb, 0xde, 0x81, 0xfb, 0xde, 0x03,
+        0xdb, 0xde, 0x02, 0xfb, 0xde, 0x82, 0x73, 0xe6, 0x4e, 0xee, 0x07, 0x4d, 0xee, 0x83, 0x4c,
+        0xee, 0x29, 0xf6, 0x27, 0xf6, 0x03, 0x26, 0xf6, 0x02, 0x46, 0xf6, 0x81, 0x46, 0xfe, 0x02,
+        0x66, 0xfe, 0x08, 0x86, 0xfe, 0x82, 0xa6, 0xfe, 0xc7, 0xfe, 0x12, 0xc6, 0xfe, 0x82, 0xa6,
+        0xfe, 0x86, 0xfe, 0x02, 0x66, 0xfe, 0x82, 0xef, 0xed, 0x6d, 0xf6, 0x21, 0x00, 0x00, 0x85,
+        0xd7, 0xee, 0xd2, 0xfe, 0xdb, 0xde, 0x99, 0xde, 0xba, 0xe6, 0x07, 0xdb, 0xde, 0x83, 0xda,
+        0xde, 0x60, 0xfd, 0x05, 0xf6, 0x08, 0x26, 0xf6, 0x06, 0x46, 0xf6, 0x81, 0x46, 0xfe, 0x02,
+        0x66, 0xfe, 0x0a, 0x86, 0xfe, 0x81, 0xa6, 0xfe, 0x10, 0xc6, 0xfe, 0x87, 0xa6, 0xfe, 0x86,
+        0xfe, 0x66, 0xfe, 0x06, 0xf6, 0x66, 0xfe, 0x65, 0xfe, 0x46, 0xf6, 0x2d, 0x00, 0x00, 0x87,
+        0x47, 0xfe, 0x06, 0xf6, 0x27, 0xf6, 0xe4, 0xed, 0x26, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x08,
+        0x46, 0xf6, 0x05, 0x66, 0xfe, 0x0c, 0x86, 0xfe, 0x81, 0xa6, 0xfe, 0x0d, 0xc6, 0xfe, 0x02,
+        0xa6, 0xfe, 0x86, 0x86, 0xfe, 0x46, 0xfe, 0xa6, 0xfe, 0x46, 0xfe, 0x45, 0xf6, 0xa9, 0xfe,
+        0x30, 0x00, 0x00, 0x84, 0x47, 0xfe, 0x48, 0xfe, 0x06, 0xf6, 0x86, 0xed, 0x02, 0x26, 0xf6,
+        0x81, 0x46, 0xf6, 0x09, 0x66, 0xfe, 0x0f, 0x86, 0xfe, 0x81, 0xa6, 0xfe, 0x0a, 0xc6, 0xfe,
+        0x02, 0xa6, 0xfe, 0x86, 0x86, 0xfe, 0x66, 0xfe, 0x68, 0xfe, 0x66, 0xfe, 0x67, 0xfe, 0x66,
+        0xfe, 0x33, 0x00, 0x00, 0x87, 0x47, 0xfe, 0xc4, 0xdc, 0xe6, 0xf5, 0x06, 0xf6, 0x27, 0xf6,
+        0x26, 0xf6, 0x46, 0xfe, 0x02, 0x66, 0xfe, 0x16, 0x86, 0xfe, 0x81, 0xa6, 0xfe, 0x07, 0xc6,
+        0xfe, 0x02, 0xa6, 0xfe, 0x81, 0x86, 0xfe, 0x02, 0x46, 0xfe, 0x84, 0x66, 0xfe, 0x87, 0xfe,
+        0x64, 0xf6, 0xa9, 0xfe, 0x36, 0x00, 0x00, 0x82, 0xac, 0xfe, 0xeb, 0xff, 0x03, 0x26, 0xf6,
+        0x82, 0x46, 0xf6, 0x46, 0xfe, 0x02, 0x66, 0xfe, 0x06, 0x86, 0xfe, 0x09, 0xa6, 0xfe, 0x06,
+        0x86, 0xfe, 0x81, 0xa6, 0xfe, 0x03, 0xc6, 0xfe, 0x02, 0xa6, 0xfe, 0x81, 0x86, 0xfe, 0x02,
+        0x66, 0xfe, 0x81, 0x67, 0xfe, 0x02, 0x66, 0xfe, 0x82, 0xd1, 0xf6, 0xac, 0xfe, 0x3a, 0x00,
+        0x00, 0x88, 0xcd, 0xfe, 0xa0, 0xe4, 0x26, 0xf6, 0x46, 0xf6, 0x8d, 0xfe, 0x26, 0xf6, 0x46,
+        0xf6, 0x46, 0xfe, 0x02, 0x66, 0xfe, 0x02, 0x86, 0xfe, 0x09, 0xa6, 0xfe, 0x09, 0x86, 0xfe,
+        0x81, 0xa6, 0xfe, 0x03, 0x86, 0xfe, 0x82, 0x46, 0xfe, 0x2c, 0xf5, 0x02, 0x66, 0xfe, 0x82,
+        0xa0, 0xf5, 0xcd, 0xfe, 0x3f, 0x00, 0x00, 0x86, 0x46, 0xfe, 0x67, 0xfe, 0x46, 0xf6, 0x46,
+        0xfe, 0x27, 0xfe, 0x26, 0xf6, 0x02, 0x46, 0xf6, 0x03, 0x66, 0xfe, 0x0e, 0x86, 0xfe, 0x89,
+        0x66, 0xfe, 0x46, 0xfe, 0x66, 0xfe, 0x46, 0xfe, 0xe7, 0xf5, 0x86, 0xfe, 0x66, 0xfe, 0x67,
+        0xfe, 0x46, 0xfe, 0x44, 0x00, 0x00, 0x87, 0xcd, 0xfe, 0xe1, 0xf5, 0x46, 0xfe, 0x26, 0xf6,
+        0x46, 0xf6, 0x86, 0xfe, 0x48, 0xfe, 0x02, 0x26, 0xf6, 0x81, 0x46, 0xfe, 0x02, 0x66, 0xfe,
+        0x82, 0x86, 0xfe, 0x66, 0xfe, 0x02, 0x46, 0xf6, 0x03, 0x66, 0xfe, 0x85, 0x46, 0xfe, 0x47,
+        0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x48, 0xfe, 0x02, 0x66, 0xfe, 0x02, 0x46, 0xfe, 0x82, 0xe1,
+        0xf5, 0xcd, 0xfe, 0x4a, 0x00, 0x00, 0x87, 0xa9, 0xfe, 0xff, 0xff, 0x67, 0xfe, 0x46, 0xf6,
+        0x26, 0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x02, 0x86, 0xfe, 0x81, 0xc6, 0xfe, 0x02, 0x27, 0xff,
+        0x84, 0xe7, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x02, 0x46, 0xf6, 0x84, 0x66, 0xfe,
+        0x67, 0xfe, 0xf0, 0xff, 0x4a, 0xff, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+        0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+        0x7f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x8a, 0x00, 0x05, 0x16, 0x2b, 0x3d, 0x57, 0x70, 0x89,
+        0x99, 0xa2, 0xa2, 0x99, 0x89, 0x70, 0x57, 0x3c, 0x2b, 0x16, 0x05, 0x00, 0x26, 0x00, 0x00,
+        0x86, 0x00, 0x05, 0x1f, 0x3f, 0x7e, 0xaa, 0xc6, 0xe8, 0xf6, 0xf9, 0xfd, 0xff, 0x02, 0xff,
+        0xff, 0x86, 0xff, 0xfd, 0xf9, 0xf6, 0xe8, 0xc6, 0xa9, 0x7d, 0x40, 0x1f, 0x04, 0x00, 0x23,
+        0x00, 0x00, 0x83, 0x01, 0x1e, 0x5a, 0xa1, 0xd7, 0xf4, 0x09, 0xff, 0xff, 0x84, 0xff, 0xfe,
+        0xf4, 0xd7, 0xa0, 0x59, 0x1e, 0x01, 0x21, 0x00, 0x00, 0x83, 0x09, 0x40, 0x91, 0xd7, 0xf8,
+        0xff, 0x0c, 0xff, 0xff, 0x83, 0xff, 0xf8, 0xd6, 0x91, 0x40, 0x09, 0x1f, 0x00, 0x00, 0x82,
+        0x0a, 0x48, 0xa8, 0xee, 0x10, 0xff, 0xff, 0x82, 0xee, 0xa7, 0x47, 0x0a, 0x1d, 0x00, 0x00,
+        0x82, 0x04, 0x42, 0xac, 0xf1, 0x12, 0xff, 0xff, 0x82, 0xf1, 0xac, 0x3f, 0x03, 0x1b, 0x00,
+        0x00, 0x82, 0x00, 0x22, 0x8b, 0xea, 0x14, 0xff, 0xff, 0x82, 0xe9, 0x8b, 0x22, 0x00, 0x19,
+        0x00, 0x00, 0x82, 0x00, 0x07, 0x5b, 0xd1, 0x16, 0xff, 0xff, 0x82, 0xd1, 0x59, 0x06, 0x00,
+        0x18, 0x00, 0x00, 0x82, 0x17, 0x8d, 0xf3, 0xff, 0x16, 0xff, 0xff, 0x82, 0xff, 0xf2, 0x8c,
+        0x16, 0x17, 0x00, 0x00, 0x82, 0x00, 0x35, 0xb9, 0xfe, 0x18, 0xff, 0xff, 0x82, 0xfe, 0xb7,
+        0x33, 0x00, 0x16, 0x00, 0x00, 0x81, 0x46, 0xd9, 0x1a, 0xff, 0xff, 0x81, 0xd8, 0x44, 0x15,
+        0x00, 0x00, 0x82, 0x01, 0x54, 0xe2, 0xff, 0x1a, 0xff, 0xff, 0x82, 0xff, 0xe1, 0x51, 0x01,
+        0x13, 0x00, 0x00, 0x82, 0x00, 0x01, 0x5f, 0xe8, 0x1c, 0xff, 0xff, 0x82, 0xe8, 0x5e, 0x01,
+        0x00, 0x12, 0x00, 0x00, 0x82, 0x00, 0x54, 0xe8, 0xff, 0x1c, 0xff, 0xff, 0x82, 0xff, 0xe8,
+        0x51, 0x00, 0x12, 0x00, 0x00, 0x81, 0x46, 0xe2, 0x1e, 0xff, 0xff, 0x81, 0xe1, 0x43, 0x11,
+        0x00, 0x00, 0x82, 0x00, 0x35, 0xd9, 0xff, 0x1e, 0xff, 0xff, 0x82, 0xff, 0xd7, 0x33, 0x00,
+        0x10, 0x00, 0x00, 0x81, 0x18, 0xba, 0x20, 0xff, 0xff, 0x81, 0xb7, 0x16, 0x0f, 0x00, 0x00,
+        0x82, 0x00, 0x07, 0x8e, 0xff, 0x20, 0xff, 0xff, 0x82, 0xfe, 0x8c, 0x06, 0x00, 0x0e, 0x00,
+        0x00, 0x82, 0x00, 0x5b, 0xf3, 0xff, 0x20, 0xff, 0xff, 0x82, 0xff, 0xf2, 0x59, 0x00, 0x0e,
+        0x00, 0x00, 0x81, 0x22, 0xd1, 0x22, 0xff, 0xff, 0x81, 0xd0, 0x21, 0x0d, 0x00, 0x00, 0x82,
+        0x00, 0x04, 0x8b, 0xff, 0x22, 0xff, 0xff, 0x82, 0xff, 0x8a, 0x03, 0x00, 0x0c, 0x00, 0x00,
+        0x82, 0x00, 0x42, 0xea, 0xff, 0x22, 0xff, 0xff, 0x82, 0xff, 0xe9, 0x40, 0x00, 0x0c, 0x00,
+        0x00, 0x81, 0x0b, 0xae, 0x24, 0xff, 0xff, 0x81, 0xa9, 0x09, 0x0c, 0x00, 0x00, 0x81, 0x48,
+        0xf2, 0x24, 0xff, 0xff, 0x81, 0xf0, 0x45, 0x0b, 0x00, 0x00, 0x82, 0x00, 0x09, 0xa7, 0xff,
+        0x24, 0xff, 0xff, 0x82, 0xff, 0xa6, 0x08, 0x00, 0x0a, 0x00, 0x00, 0x82, 0x00, 0x40, 0xee,
+        0xff, 0x24, 0xff, 0xff, 0x82, 0xff, 0xec, 0x3e, 0x00, 0x0a, 0x00, 0x00, 0x81, 0x01, 0x90,
+        0x26, 0xff, 0xff, 0x81, 0x8f, 0x01, 0x0a, 0x00, 0x00, 0x81, 0x1e, 0xd6, 0x26, 0xff, 0xff,
+        0x81, 0xd5, 0x1d, 0x0a, 0x00, 0x00, 0x81, 0x5a, 0xf8, 0x26, 0xff, 0xff, 0x81, 0xf8, 0x57,
+        0x09, 0x00, 0x00, 0x82, 0x00, 0x05, 0xa1, 0xff, 0x26, 0xff, 0xff, 0x82, 0xff, 0xa0, 0x04,
+        0x00, 0x08, 0x00, 0x00, 0x82, 0x00, 0x1f, 0xd8, 0xff, 0x26, 0xff, 0xff, 0x82, 0xff, 0xd7,
+        0x1f, 0x00, 0x08, 0x00, 0x00, 0x82, 0x00, 0x3f, 0xf4, 0xff, 0x26, 0xff, 0xff, 0x82, 0xff,
+        0xf3, 0x3e, 0x00, 0x08, 0x00, 0x00, 0x82, 0x00, 0x7b, 0xfe, 0xff, 0x26, 0xff, 0xff, 0x82,
+        0xff, 0xfe, 0x7a, 0x00, 0x08, 0x00, 0x00, 0x81, 0x05, 0xa9, 0x28, 0xff, 0xff, 0x81, 0xa8,
+        0x03, 0x08, 0x00, 0x00, 0x81, 0x16, 0xc6, 0x28, 0xff, 0xff, 0x81, 0xc4, 0x15, 0x08, 0x00,
+        0x00, 0x81, 0x2b, 0xe8, 0x28, 0xff, 0xff, 0x81, 0xe7, 0x2b, 0x08, 0x00, 0x00, 0x81, 0x3d,
+        0xf6, 0x28, 0xff, 0xff, 0x81, 0xf6, 0x3c, 0x08, 0x00, 0x00, 0x81, 0x56, 0xf9, 0x28, 0xff,
+        0xff, 0x81, 0xf9, 0x54, 0x08, 0x00, 0x00, 0x81, 0x6f, 0xfd, 0x28, 0xff, 0xff, 0x81, 0xfc,
+        0x6d, 0x08, 0x00, 0x00, 0x81, 0x89, 0xff, 0x28, 0xff, 0xff, 0x81, 0xff, 0x86, 0x08, 0x00,
+        0x00, 0x81, 0x98, 0xff, 0x28, 0xff, 0xff, 0x81, 0xff, 0x98, 0x08, 0x00, 0x00, 0x81, 0xa2,
+        0xff, 0x28, 0xff, 0xff, 0x81, 0xff, 0xa3, 0x08, 0x00, 0x00, 0x81, 0xa1, 0xff, 0x28, 0xff,
+        0xff, 0x81, 0xff, 0xa3, 0x08, 0x00, 0x00, 0x81, 0x94, 0xff, 0x28, 0xff, 0xff, 0x81, 0xff,
+        0x98, 0x08, 0x00, 0x00, 0x81, 0x85, 0xff, 0x28, 0xff, 0xff, 0x81, 0xff, 0x86, 0x08, 0x00,
+        0x00, 0x81, 0x6d, 0xfc, 0x28, 0xff, 0xff, 0x81, 0xfc, 0x6d, 0x08, 0x00, 0x00, 0x81, 0x54,
+        0xf9, 0x28, 0xff, 0xff, 0x81, 0xf9, 0x54, 0x08, 0x00, 0x00, 0x81, 0x3d, 0xf6, 0x28, 0xff,
+        0xff, 0x81, 0xf6, 0x3a, 0x08, 0x00, 0x00, 0x81, 0x2d, 0xea, 0x28, 0xff, 0xff, 0x81, 0xe7,
+        0x2a, 0x08, 0x00, 0x00, 0x81, 0x16, 0xc5, 0x28, 0xff, 0xff, 0x81, 0xc4, 0x15, 0x08, 0x00,
+        0x00, 0x81, 0x04, 0xa9, 0x28, 0xff, 0xff, 0x81, 0xa7, 0x03, 0x08, 0x00, 0x00, 0x82, 0x00,
+        0x7c, 0xfe, 0xff, 0x26, 0xff, 0xff, 0x82, 0xff, 0xfe, 0x7b, 0x00, 0x08, 0x00, 0x00, 0x82,
+        0x00, 0x40, 0xf3, 0xff, 0x26, 0xff, 0xff, 0x82, 0xff, 0xf4, 0x3f, 0x00, 0x08, 0x00, 0x00,
+        0x82, 0x00, 0x26, 0xe5, 0xff, 0x26, 0xff, 0xff, 0x82, 0xff, 0xd7, 0x1e, 0x00, 0x08, 0x00,
+        0x00, 0x82, 0x01, 0x70, 0xf8, 0xff, 0x26, 0xff, 0xff, 0x82, 0xff, 0x9f, 0x03, 0x00, 0x08,
+        0x00, 0x00, 0x81, 0x50, 0xed, 0x27, 0xff, 0xff, 0x81, 0xf7, 0x57, 0x08, 0x00, 0x00, 0x82,
+        0x00, 0x19, 0xc5, 0xff, 0x27, 0xff, 0xff, 0x81, 0xd4, 0x1d, 0x08, 0x00, 0x00, 0x82, 0x00,
+        0x72, 0xfc, 0xff, 0x27, 0xff, 0xff, 0x81, 0x8e, 0x01, 0x08, 0x00, 0x00, 0x81, 0x15, 0xc7,
+        0x27, 0xff, 0xff, 0x82, 0xff, 0xed, 0x3f, 0x00, 0x08, 0x00, 0x00, 0x81, 0x43, 0xf6, 0x27,
+        0xff, 0xff, 0x82, 0xff, 0xa5, 0x08, 0x00, 0x08, 0x00, 0x00, 0x81, 0x71, 0xff, 0x27, 0xff,
+        0xff, 0x81, 0xf1, 0x46, 0x08, 0x00, 0x00, 0x82, 0x00, 0x01, 0x9e, 0xff, 0x27, 0xff, 0xff,
+        0x81, 0xaa, 0x0a, 0x08, 0x00, 0x00, 0x82, 0x00, 0x02, 0xb6, 0xff, 0x26, 0xff, 0xff, 0x82,
+        0xff, 0xe8, 0x3e, 0x00, 0x08, 0x00, 0x00, 0x82, 0x00, 0x02, 0xb1, 0xff, 0x26, 0xff, 0xff,
+        0x82, 0xff, 0x88, 0x03, 0x00, 0x09, 0x00, 0x00, 0x81, 0x8f, 0xff, 0x26, 0xff, 0xff, 0x81,
+        0xcf, 0x21, 0x0a, 0x00, 0x00, 0x81, 0x5f, 0xfd, 0x25, 0xff, 0xff, 0x82, 0xff, 0xf2, 0x57,
+        0x00, 0x0a, 0x00, 0x00, 0x81, 0x30, 0xe6, 0x25, 0xff, 0xff, 0x82, 0xfe, 0x8a, 0x06, 0x00,
+        0x0a, 0x00, 0x00, 0x81, 0x09, 0xb0, 0x25, 0xff, 0xff, 0x81, 0xb5, 0x15, 0x0b, 0x00, 0x00,
+        0x82, 0x00, 0x4f, 0xf3, 0xff, 0x23, 0xff, 0xff, 0x82, 0xff, 0xd7, 0x32, 0x00, 0x0b, 0x00,
+        0x00, 0x82, 0x00, 0x0a, 0xa2, 0xff, 0x23, 0xff, 0xff, 0x81, 0xe1, 0x42, 0x0d, 0x00, 0x00,
+        0x81, 0x28, 0xcb, 0x22, 0xff, 0xff, 0x82, 0xff, 0xe8, 0x52, 0x00, 0x0d, 0x00, 0x00, 0x82,
+        0x00, 0x3c, 0xd8, 0xff, 0x21, 0xff, 0xff, 0x82, 0xe8, 0x5e, 0x01, 0x00, 0x0e, 0x00, 0x00,
+        0x81, 0x35, 0xc0, 0x20, 0xff, 0xff, 0x82, 0xff, 0xe1, 0x52, 0x01, 0x0f, 0x00, 0x00, 0x82,
+        0x00, 0x1c, 0x81, 0xe0, 0x1f, 0xff, 0xff, 0x81, 0xd7, 0x42, 0x11, 0x00, 0x00, 0x83, 0x01,
+        0x2e, 0x79, 0xbe, 0xde, 0xf5, 0x1c, 0xff, 0xff, 0x82, 0xfe, 0xb5, 0x32, 0x00, 0x12, 0x00,
+        0x00, 0x83, 0x00, 0x0b, 0x29, 0x49, 0x57, 0x58, 0x02, 0x58, 0x58, 0x82, 0x58, 0x94, 0xf1,
+        0xff, 0x16, 0xff, 0xff, 0x82, 0xff, 0xf2, 0x8a, 0x15, 0x18, 0x00, 0x00, 0x82, 0x00, 0x06,
+        0x57, 0xd1, 0x16, 0xff, 0xff, 0x82, 0xcf, 0x57, 0x06, 0x00, 0x19, 0x00, 0x00, 0x82, 0x00,
+        0x25, 0x90, 0xeb, 0x14, 0xff, 0xff, 0x82, 0xe8, 0x88, 0x21, 0x00, 0x1b, 0x00, 0x00, 0x82,
+        0x05, 0x40, 0xae, 0xf2, 0x12, 0xff, 0xff, 0x82, 0xf0, 0xa9, 0x3f, 0x03, 0x1d, 0x00, 0x00,
+        0x82, 0x0c, 0x48, 0xa9, 0xed, 0x10, 0xff, 0xff, 0x82, 0xed, 0xa6, 0x47, 0x09, 0x1f, 0x00,
+        0x00, 0x83, 0x09, 0x3f, 0x8e, 0xd5, 0xf9, 0xff, 0x0c, 0xff, 0xff, 0x83, 0xff, 0xf7, 0xd4,
+        0x8f, 0x3f, 0x08, 0x21, 0x00, 0x00, 0x83, 0x01, 0x1e, 0x5c, 0x9f, 0xd6, 0xf4, 0x09, 0xff,
+        0xff, 0x84, 0xff, 0xfe, 0xf4, 0xd6, 0x9f, 0x56, 0x1c, 0x01, 0x23, 0x00, 0x00, 0x86, 0x00,
+        0x03, 0x1e, 0x42, 0x7f, 0xa8, 0xc6, 0xeb, 0xf6, 0xf9, 0xfd, 0xff, 0x02, 0xff, 0xff, 0x86,
+        0xff, 0xfd, 0xf9, 0xf6, 0xe7, 0xc4, 0xa8, 0x7a, 0x3e, 0x1e, 0x03, 0x00, 0x26, 0x00, 0x00,
+        0x8a, 0x00, 0x03, 0x16, 0x2d, 0x3c, 0x52, 0x70, 0x85, 0x93, 0xa2, 0xa1, 0x98, 0x89, 0x71,
+        0x54, 0x3a, 0x2b, 0x15, 0x04, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00,
+        0x27, 0x00, 0x00,
 
 };
 
 const lv_image_dsc_t image_mostly_sunny = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.cf = LV_COLOR_FORMAT_RGB565A8,
-    .header.flags = 0,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
     .header.w = 100,
     .header.h = 100,
     .header.stride = 200,
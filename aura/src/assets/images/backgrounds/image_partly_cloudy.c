@@ -25,2013 +25,338 @@
 static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_PARTLY_CLOUDY
     uint8_t image_partly_cloudy_map[] = {
 
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xf6, 0x6a, 0xf6, 0xea, 0xfe, 0xea,
-        0xfe, 0xea, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xa6, 0xfe, 0xa5, 0xfe,
-        0xa5, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xea,
-        0xfe, 0xea, 0xfe, 0x6a, 0xf6, 0x6a, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0xc9, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xea, 0xfe,
-        0x27, 0xff, 0xea, 0xfe, 0xea, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xea, 0xfe, 0xea, 0xfe, 0xea, 0xfe, 0x26, 0xff, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xc9, 0xfe, 0xe9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x88, 0xf5, 0xeb, 0xff, 0xea, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xea,
-        0xfe, 0xea, 0xfe, 0xea, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe,
-        0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xea, 0xfe, 0xea, 0xfe, 0xe8, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xeb, 0xff, 0x88,
-        0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xea, 0xfe, 0xca, 0xfe,
-        0xea, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe,
-        0xeb, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0x0a, 0xff, 0xe9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xea, 0xfe, 0xea,
-        0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xc9, 0xfe, 0xea, 0xfe,
-        0xea, 0xfe, 0xe9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xfe, 0xca, 0xff, 0xca, 0xfe, 0xea, 0xfe,
-        0xea, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xe9,
-        0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xc8, 0xfe, 0xc9, 0xfe, 0x6b, 0xfb, 0xe9, 0xfe, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xf5, 0x2a, 0xff, 0xca, 0xfe, 0xea,
-        0xfe, 0xca, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xca, 0xfe, 0xe9,
-        0xfe, 0xea, 0xfe, 0x2a, 0xff, 0x88, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0x0a, 0xff,
-        0x0a, 0xff, 0x8a, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc8, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0x10, 0xff, 0xe9, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49,
-        0xfe, 0x00, 0x38, 0xea, 0xfe, 0xea, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc9, 0xfe, 0xc9, 0xfe,
-        0xc8, 0xfe, 0x1f, 0x00, 0x29, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xe9, 0xfe, 0xc9, 0xfe, 0x0a, 0xff, 0xea, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0x29, 0xff, 0xca, 0xfe, 0xe9, 0xfe, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0xe9, 0xfe, 0x29, 0xfe, 0xea, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc9, 0xfe, 0xff,
-        0xff, 0xe9, 0xfe, 0xe9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xfe, 0xea, 0xfe, 0xe8, 0xfe, 0xea,
-        0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe,
-        0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0x0b, 0xff, 0xe9, 0xfe, 0xe9, 0xfe, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xfe, 0xea, 0xfe,
-        0x0b, 0xff, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xe8, 0xfe, 0x0a, 0xff,
-        0xe9, 0xfe, 0xe9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9,
-        0xfe, 0xea, 0xfe, 0x0b, 0xff, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xe9, 0xfe, 0x0a, 0xff, 0xe9, 0xfe, 0xe9, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xe9, 0xfe, 0xe9, 0xfe, 0xe7, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe,
-        0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xe8, 0xfe, 0x0b, 0xff, 0xe9,
-        0xfe, 0xe9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xfe, 0xca, 0xfe, 0x6c, 0xfe, 0xea, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc8, 0xfe, 0xe9, 0xfe, 0xff, 0xff, 0xca, 0xfe, 0x29, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0x00, 0x00, 0x0a, 0xff, 0xea,
-        0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc9, 0xfe, 0x08, 0xff, 0x1f, 0x00,
-        0xe9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xf5, 0x0a, 0xff,
-        0xea, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe,
-        0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8,
-        0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0x88, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x0a, 0xff, 0xea, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8,
-        0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc9, 0xfe, 0xe9, 0xfe, 0x29, 0xff, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xea, 0xfe, 0xc9, 0xfe, 0x69, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe,
-        0x12, 0xff, 0xc9, 0xfe, 0xe9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0xe9, 0xfe, 0xea, 0xfe,
-        0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe9,
-        0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0x4a, 0xfb, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0xca,
-        0xfe, 0xca, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe9, 0xfe,
-        0xe9, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8,
-        0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xcb, 0xfe, 0xc9,
-        0xfe, 0xe9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xea, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8,
-        0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe,
-        0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xe9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0xea, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe,
-        0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xe8,
-        0xfe, 0xe8, 0xfe, 0xe8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xfe, 0xc9, 0xfe, 0xe9,
-        0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xe8, 0xfe, 0xe8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8,
-        0xfe, 0xc7, 0xfe, 0x0b, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xf6,
-        0xe9, 0xfe, 0xc9, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xe9, 0xfe, 0xe9, 0xfe, 0x88, 0xf5, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x11, 0x00, 0xe9, 0xfe, 0xe9, 0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc9,
-        0xfe, 0xeb, 0xfe, 0x0e, 0xff, 0x11, 0xff, 0x34, 0xf7, 0x35, 0xf7, 0x56, 0xf7, 0x56, 0xf7,
-        0x56, 0xf7, 0x34, 0xf7, 0x32, 0xf7, 0x0f, 0xff, 0xec, 0xfe, 0xca, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xe7, 0xfe,
-        0xe8, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xea, 0xfe, 0xeb, 0xfe, 0xe9, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc9, 0xfe,
-        0xec, 0xfe, 0x32, 0xf7, 0x57, 0xf7, 0x7b, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7e, 0xef, 0x7e,
-        0xef, 0x7e, 0xef, 0x9e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7d, 0xf7, 0x7d, 0xf7, 0x7c, 0xf7,
-        0x59, 0xf7, 0x35, 0xf7, 0xee, 0xfe, 0xca, 0xfe, 0xa8, 0xfe, 0xa8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xcb, 0xfe, 0xc9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0xe9, 0xfe,
-        0xc9, 0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc9,
-        0xfe, 0x0f, 0xff, 0x57, 0xf7, 0x7c, 0xf7, 0x7d, 0xf7, 0x7e, 0xef, 0x7e, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7d, 0xf7, 0x59, 0xf7, 0x12, 0xf7,
-        0xcb, 0xfe, 0xa8, 0xfe, 0xa8, 0xfe, 0xa8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xc9, 0xfe, 0xe8, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc9, 0xfe, 0x0e, 0xff, 0x57, 0xf7, 0x7d, 0xf7, 0x7e, 0xef, 0x7e, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7e, 0xef, 0x7d, 0xf7, 0x7a, 0xf7, 0x12, 0xf7, 0xca, 0xfe, 0xa7, 0xfe, 0xa8, 0xfe,
-        0xa8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc6, 0xfe, 0xea, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xeb, 0xfe, 0x34, 0xf7, 0x7c, 0xf7, 0x7e, 0xef, 0x7e, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7d, 0xf7, 0x58,
-        0xf7, 0xee, 0xfe, 0xa8, 0xfe, 0xa8, 0xfe, 0xa8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc9, 0xfe, 0xc9, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0xc9, 0xfe,
-        0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xed, 0xfe, 0x58, 0xf7, 0x7e, 0xef, 0x7e, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7c, 0xf7, 0x11, 0xf7, 0xa9, 0xfe, 0xa8, 0xfe, 0xa8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe,
-        0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a,
-        0xf6, 0xc8, 0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0x0f, 0xff, 0x7b, 0xf7, 0x7e, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7d, 0xf7,
-        0x34, 0xf7, 0xa9, 0xfe, 0xa7, 0xfe, 0xa8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8,
-        0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0x6a, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x6a, 0xf6, 0x06, 0xff, 0xc8, 0xfe, 0xc8, 0xfe, 0x10, 0xf7, 0x7c,
-        0xf7, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7d, 0xf7, 0x35, 0xf7, 0xa9, 0xfe, 0xa7, 0xfe, 0xa8, 0xfe,
-        0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0x04, 0xff, 0x6a, 0xf6, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xfe, 0xe9, 0xfe, 0xc8, 0xfe,
-        0x0f, 0xff, 0x7c, 0xf7, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7d, 0xef, 0x35,
-        0xf7, 0xa9, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xea, 0xfe, 0xe9,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9,
-        0xfe, 0xc7, 0xfe, 0x0f, 0xff, 0x7b, 0xf7, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7e, 0xef, 0x7d, 0xef, 0x13, 0xf7, 0xa8, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7,
-        0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x5d, 0xef, 0x35, 0xf7, 0x34, 0xf7, 0x7a, 0xf7, 0x7e, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7c, 0xf7, 0xef, 0xf6,
-        0x87, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xef, 0x1a, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7e, 0xef, 0x5a, 0xf7, 0xcb, 0xfe, 0x87, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe,
-        0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc7, 0xfe, 0xa6,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xf7, 0x9d, 0xef, 0x5d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x35, 0xf7, 0x88, 0xfe, 0x87,
-        0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc7, 0xfe, 0xa6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x3c, 0xef, 0x3c, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef,
-        0x7c, 0xf7, 0xce, 0xf6, 0x87, 0xfe, 0x87, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa7, 0xfe, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x3c, 0xef, 0x9e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x36, 0xf7, 0x88, 0xfe, 0x87, 0xfe, 0xa7, 0xfe,
-        0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc7, 0xfe, 0xa6,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xe6, 0xda, 0xe6, 0xfb, 0xe6, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7c, 0xf7, 0xcd,
-        0xfe, 0x87, 0xfe, 0x87, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xa7, 0xfe,
-        0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc7, 0xfe, 0xa6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xdd, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7e, 0xef, 0x34, 0xf7, 0xaa, 0xfe, 0xaa, 0xfe, 0xaa, 0xfe, 0xca, 0xfe, 0xca,
-        0xfe, 0xca, 0xfe, 0xca, 0xfe, 0xc9, 0xfe, 0xc8, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe,
-        0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xff, 0xff, 0xbf, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xf7, 0x7b, 0xf7, 0x7b, 0xf7,
-        0x7b, 0xf7, 0x7b, 0xf7, 0x7b, 0xf7, 0x7b, 0xf7, 0x7b, 0xf7, 0x59, 0xf7, 0x56, 0xf7, 0x12,
-        0xf7, 0xed, 0xfe, 0xc8, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe,
-        0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0xc7,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xe6, 0xfb, 0xee, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x7e, 0xef,
-        0x7e, 0xef, 0x9e, 0xef, 0x7e, 0xef, 0x7c, 0xf7, 0x58, 0xf7, 0x10, 0xf7, 0xa9, 0xfe, 0xa7,
-        0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xa6, 0xfe, 0xc7, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xee, 0x5c, 0xef, 0x5d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7e, 0xef,
-        0x7d, 0xf7, 0x58, 0xf7, 0xee, 0xfe, 0xa7, 0xfe, 0xa6, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7,
-        0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b,
-        0xee, 0x9e, 0xf7, 0x7d, 0xf7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7c, 0xf7, 0x13, 0xf7, 0xa8, 0xfe,
-        0x86, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa7, 0xfe, 0xc6,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xfa, 0xee, 0xff, 0xf7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e,
-        0xef, 0x7d, 0xef, 0x35, 0xf7, 0xa9, 0xfe, 0x86, 0xfe, 0x87, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe,
-        0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7,
-        0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc7, 0xfe, 0xa6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xef, 0x4c, 0xc4, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x35, 0xf7, 0x88, 0xfe, 0x86,
-        0xfe, 0x87, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa7, 0xfe, 0xc6, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d,
-        0xf7, 0x5d, 0xf7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0xf2, 0xf6, 0x67, 0xfe, 0x87, 0xfe, 0x87, 0xfe, 0xa7, 0xfe, 0xa6, 0xfe, 0xa7,
-        0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7c, 0xef, 0xae, 0xf6, 0x66, 0xfe, 0x87, 0xfe,
-        0xa7, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc7, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xf7, 0x7d, 0xf7, 0x7d, 0xf7,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x38,
-        0xf7, 0x49, 0xf6, 0x66, 0xfe, 0x87, 0xfe, 0xa7, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xc7, 0xfe,
-        0xc7, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x06, 0xf6, 0x26, 0xf6, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d,
-        0xf7, 0x5d, 0xf7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0xaf, 0xf6, 0x26, 0xf6, 0x86, 0xfe, 0xa7, 0xfe, 0xa6,
-        0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x45, 0xff, 0x08,
-        0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7d, 0xf7, 0x3c, 0xf7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x37, 0xf7, 0x27, 0xf6,
-        0x26, 0xf6, 0x86, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xc7, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe,
-        0x86, 0xfe, 0xa6, 0xfe, 0x29, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xef, 0xff, 0xff, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x5c, 0xef, 0x6c, 0xf6, 0x06, 0xf6, 0x46, 0xf6, 0x86, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe,
-        0xa6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0xa6, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6,
-        0xee, 0xbf, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0xd1, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x46,
-        0xf6, 0x86, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x26, 0xf6, 0x46, 0xfe, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x40, 0xf5, 0x3d, 0xef, 0x3c, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x15, 0xf7,
-        0x27, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x66, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xa6, 0xfe, 0xc6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe,
-        0xc6, 0xfe, 0x05, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xf6, 0xfb, 0xe6, 0x1b, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7e, 0xef, 0x38, 0xef, 0x28, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xfe, 0x66, 0xfe,
-        0xa6, 0xfe, 0xa6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6,
-        0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0xa6, 0xfe, 0x26, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x78, 0xe6, 0xba, 0xe6, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5a, 0xef, 0x48, 0xf6, 0x26, 0xf6, 0x46,
-        0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0xa6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe,
-        0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x06, 0xf6, 0x46, 0xf6, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x7e, 0xef, 0x5d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5b, 0xef,
-        0x48, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0xa6,
-        0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0xa6, 0xfe,
-        0xa4, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xef, 0x3b, 0xef,
-        0x3c, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x5a, 0xef, 0x48, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x66, 0xfe,
-        0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0xa6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0xc6, 0xfe, 0x86,
-        0xfe, 0x27, 0xf6, 0x46, 0xfe, 0x88, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xe0, 0xfa, 0xff, 0xff, 0x5c, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x39, 0xef, 0x48, 0xf6, 0x26, 0xf6, 0x46,
-        0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0xa6, 0xfe,
-        0xc6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x27, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xf6, 0x1b, 0xe7, 0xfb, 0xe6, 0x5d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0xf6, 0xee,
-        0x27, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x86,
-        0xfe, 0x86, 0xfe, 0x86, 0xfe, 0xa6, 0xfe, 0x86, 0xfe, 0x26, 0xf6, 0x46, 0xfe, 0x87, 0xfe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x99, 0xde, 0x11, 0xc5, 0x5c, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7e, 0xef, 0xb2, 0xee, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x66, 0xfe,
-        0x66, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x46, 0xfe, 0xa6,
-        0xfe, 0x05, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xe6, 0xdb, 0xe6, 0xb9, 0xe6, 0x5c, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5c, 0xef, 0x6d, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46,
-        0xf6, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe,
-        0x46, 0xfe, 0xe6, 0xf5, 0x06, 0xf6, 0x26, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xc3, 0xff,
-        0xf7, 0x1c, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x39, 0xef, 0x48, 0xf6,
-        0x26, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86,
-        0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x26, 0xf6, 0x26, 0xfe, 0xdf, 0xfd, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xf7, 0xdd, 0xfb, 0xe6, 0xda, 0xe6, 0x3c, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0xb1, 0xee, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe,
-        0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x46, 0xf6, 0x65, 0xfd, 0x26, 0xf6, 0x26,
-        0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xef, 0xfb, 0xe6, 0x98, 0xde,
-        0x3c, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7e, 0xef, 0x19, 0xef, 0x29, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x66,
-        0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x46, 0xfe, 0x06, 0xf6,
-        0x26, 0xf6, 0x45, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x7f, 0xdf, 0xfc, 0xe6, 0xba, 0xde, 0x3c, 0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0x90, 0xee, 0x26, 0xf6, 0x26, 0xf6,
-        0x46, 0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x66,
-        0xfe, 0x26, 0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x88, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xf6, 0x00, 0x88, 0x7e, 0xe7, 0x78, 0xde, 0x1c,
-        0xe7, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0xd5, 0xee, 0x27,
-        0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x86, 0xfe,
-        0x86, 0xfe, 0x66, 0xfe, 0x46, 0xf6, 0x65, 0xfe, 0x1f, 0x00, 0x26, 0xf6, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xcc,
-        0xe1, 0xb1, 0x7e, 0xe7, 0xb9, 0xe6, 0x1c, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0xf8, 0xee, 0x2a, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x66,
-        0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x26, 0xf6, 0xc5, 0xf4, 0x06, 0xf6, 0xc7, 0xf5,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xcc, 0x00, 0x00, 0xdb, 0xde, 0x37, 0xde, 0xfb, 0xe6,
-        0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0xf8, 0xee, 0x2a, 0xee, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6,
-        0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x46, 0xf6, 0x24, 0xe5, 0x05,
-        0xf6, 0x26, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xf5, 0xfe,
-        0xde, 0x79, 0xde, 0x47, 0xbb, 0xba, 0xe6, 0x1b, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x5d, 0xef, 0xd6, 0xee, 0x2a, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26,
-        0xf6, 0x46, 0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x46, 0xf6,
-        0xe6, 0xf5, 0x26, 0xf6, 0x05, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xdd, 0xd5, 0xd5, 0x7e, 0xe7, 0x17, 0xd6, 0xba,
-        0xe6, 0x1c, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x3b, 0xef, 0x92, 0xee, 0x28, 0xf6, 0x26, 0xf6,
-        0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x66,
-        0xfe, 0x46, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xcc,
-        0xff, 0xf7, 0x58, 0xde, 0xff, 0xef, 0x17, 0xde, 0xba, 0xde, 0x1b, 0xe7, 0x3c, 0xef, 0x5d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7e, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d,
-        0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef, 0x7d, 0xef,
-        0x7d, 0xef, 0x7e, 0xef, 0x7e, 0xef, 0x5d, 0xef, 0x3b, 0xef, 0xb4, 0xee, 0x2b, 0xee, 0x26,
-        0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe,
-        0x66, 0xfe, 0x66, 0xfe, 0x26, 0xf6, 0x24, 0xe5, 0x26, 0xf6, 0x26, 0xf6, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xd5, 0xff, 0xe7, 0x37, 0xde, 0x9e, 0xef,
-        0xf0, 0xcc, 0x79, 0xde, 0xda, 0xe6, 0xfb, 0xe6, 0x1a, 0xe7, 0x19, 0xef, 0x3b, 0xef, 0x5c,
-        0xef, 0x5c, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-        0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d,
-        0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef,
-        0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d, 0xef, 0x5d,
-        0xef, 0x5d, 0xef, 0x5c, 0xef, 0x3b, 0xef, 0x19, 0xef, 0xd6, 0xe6, 0x70, 0xee, 0x2a, 0xee,
-        0x06, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xfe, 0x66,
-        0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x46, 0xf6, 0x26, 0xf6, 0x05, 0xfd, 0x25, 0xf6, 0x05, 0xf6,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xba, 0xde, 0x12, 0xd5, 0xce, 0xdc, 0x79, 0xde, 0xbf, 0xe7, 0x98, 0x82, 0x2b, 0xee,
-        0x0b, 0xee, 0x0b, 0xee, 0x2c, 0xee, 0x2d, 0xee, 0x2d, 0xee, 0x2d, 0xee, 0x2d, 0xee, 0x2d,
-        0xee, 0x2d, 0xee, 0x2d, 0xee, 0x2d, 0xee, 0x2d, 0xee, 0x2d, 0xee, 0x2d, 0xee, 0x2d, 0xee,
-        0x2d, 0xee, 0x2d, 0xee, 0x2d, 0xee, 0x2d, 0xee, 0x2d, 0xee, 0x2d, 0xee, 0x2d, 0xee, 0x2d,
-        0xee, 0x2d, 0xee, 0x2d, 0xee, 0x4d, 0xee, 0x4d, 0xee, 0x4d, 0xee, 0x4d, 0xee, 0x4d, 0xee,
-        0x4d, 0xee, 0x4d, 0xee, 0x4d, 0xee, 0x4d, 0xee, 0x4d, 0xee, 0x2b, 0xee, 0x29, 0xf6, 0x07,
-        0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xfe,
-        0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x46, 0xf6, 0x26, 0xf6, 0x45, 0xf6, 0x06,
-        0xf6, 0x26, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xf5, 0xbf, 0x67, 0x53,
-        0xd5, 0x7b, 0xde, 0x09, 0xf6, 0xc3, 0xf5, 0xe5, 0xf5, 0xe5, 0xf5, 0x06, 0xf6, 0x06, 0xf6,
-        0x06, 0xf6, 0x06, 0xf6, 0x06, 0xf6, 0x06, 0xf6, 0x06, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x26,
-        0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6,
-        0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26,
-        0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xf6,
-        0x46, 0xf6, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xfe, 0x46, 0xfe, 0x46,
-        0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x46, 0xfe, 0x26, 0xf6, 0x26, 0xf6,
-        0x26, 0xf6, 0x1f, 0x78, 0xc7, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x65, 0xfe, 0x06,
-        0xf6, 0x06, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6,
-        0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46,
-        0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6,
-        0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x66, 0xf6, 0x66,
-        0xf6, 0x66, 0xf6, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe,
-        0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x46, 0xf6, 0x26,
-        0xf6, 0x65, 0xfd, 0x26, 0xf6, 0x66, 0xfe, 0x26, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xf5,
-        0x25, 0xf6, 0x06, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x06, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x26,
-        0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6,
-        0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x66, 0xf6, 0x66,
-        0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe,
-        0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66,
-        0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x46, 0xf6,
-        0x26, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x45, 0xfe, 0x88, 0xf5, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xf6, 0xbf, 0xfc, 0x26, 0xf6, 0xe6, 0xf5,
-        0x06, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x66, 0xfe, 0x66,
-        0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe,
-        0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x86,
-        0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe,
-        0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x46,
-        0xf6, 0x26, 0xf6, 0x06, 0xf6, 0x46, 0xf6, 0x26, 0xf6, 0x9f, 0xfd, 0x26, 0xf6, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x26, 0xfe, 0x46, 0xfe, 0x06, 0xf6, 0x06, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x26, 0xf6,
-        0x26, 0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66,
-        0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe,
-        0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86,
-        0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x66, 0xfe,
-        0x46, 0xf6, 0x46, 0xf6, 0x26, 0xf6, 0x25, 0xf6, 0x26, 0xf6, 0x26, 0xfe, 0x26, 0xfe, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xfe, 0x26, 0xfe, 0x06,
-        0xf6, 0x26, 0xf6, 0xe5, 0xf5, 0x06, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x66, 0xfe,
-        0x66, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86,
-        0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe,
-        0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x46,
-        0xfe, 0x26, 0xf6, 0x26, 0xf6, 0xe6, 0xf5, 0x46, 0xfe, 0x26, 0xf6, 0x68, 0xfe, 0x87, 0xfe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x88, 0xf5, 0x83, 0xfe, 0x06, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x26,
-        0xfe, 0x06, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x66, 0xfe,
-        0x66, 0xfe, 0x66, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86, 0xfe, 0x86,
-        0xfe, 0x86, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x66, 0xfe, 0x46, 0xfe, 0x46, 0xf6,
-        0x46, 0xfe, 0x06, 0xf6, 0x06, 0xf6, 0x46, 0xf6, 0x26, 0xf6, 0x06, 0xf6, 0x83, 0xfe, 0x88,
-        0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x26, 0xfe, 0x25, 0xfe, 0x26, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0xa4, 0xfe, 0x06, 0xf6, 0x06,
-        0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6,
-        0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x46, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x06,
-        0xf6, 0x06, 0xf6, 0xc4, 0xfe, 0x46, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x25, 0xfe, 0x26, 0xfe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xf6,
-        0x08, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x66, 0xf6, 0xa6, 0xfe, 0xc6,
-        0xfe, 0xe7, 0xfe, 0x27, 0xff, 0x27, 0xff, 0xe7, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe,
-        0x46, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x26, 0xf6, 0x08, 0xf6, 0x29, 0xf6, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x22, 0x32, 0x50, 0x73, 0x87, 0x97, 0xa0, 0xa5,
-        0xa5, 0xa0, 0x97, 0x87, 0x71, 0x4f, 0x32, 0x22, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x28, 0x57,
-        0x8e, 0xba, 0xd9, 0xef, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-        0xf9, 0xef, 0xd9, 0xbb, 0x8c, 0x56, 0x28, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x07, 0x2a, 0x6e, 0xb2, 0xe4, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xf8, 0xe4, 0xb2, 0x6e, 0x2a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x53, 0xa2,
-        0xe1, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xe1,
-        0xa2, 0x53, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x5b, 0xba, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xb7, 0x59, 0x13,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x54,
-        0xbd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xbc, 0x53, 0x09, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x9f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x9d, 0x30, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x0d, 0x6f, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xdd, 0x6e, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x9f, 0xf8, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x9f,
-        0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x45, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x43, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x59, 0xe3, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x58, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x69, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xea, 0x67, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-        0x73, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x72,
-        0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x69, 0xf0, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x67, 0x02, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x59, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xe3, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xe2, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x23, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x0d, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6f, 0xf8, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xf8, 0x6e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x31, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd,
-        0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x9f,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x09, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x13, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xbd, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xf6, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x59, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x53, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xf3, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xa3, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa1, 0x06,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x6e, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xfb, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xb2, 0xff, 0xff, 0xff, 0xff,
-        0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb2,
-        0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x28, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x28, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56,
-        0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xf8, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x0f, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0x0e, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xd8,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xee, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x03, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x4f, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xeb, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xad, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x4b, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xa8, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xb9, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x25, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e,
-        0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xf9, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9c,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x31, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x06, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xba, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xa2,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xf8, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1,
-        0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xf1, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xfb, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x17, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x29,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-        0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xfc, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xf4, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x10, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xe2, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xbc, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x53, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x22, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xf2,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd,
-        0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x8a, 0xfd, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x6e, 0x01, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x16, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0x9f, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x24, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xb6, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xa0, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xe9, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x0e, 0x78, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x65, 0x01, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-        0x3f, 0xb6, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xf0, 0x72, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x61, 0xc2, 0xf8,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x65, 0x04,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x56, 0xa8, 0xe0, 0xfe, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x2b, 0x5c, 0x96, 0xd9, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xc8, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0x27, 0xa0, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x9f, 0x24, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x0d, 0x6e, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xdd, 0x6e, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x9d, 0xf1,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x9d, 0x31, 0x01, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x53, 0xbc, 0xf7, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xf7, 0xbc, 0x53, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x5b, 0xb9, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xb8, 0x5a, 0x12,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x11, 0x51, 0xa3, 0xe1, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xfc, 0xe1, 0xa1, 0x51, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-        0x2a, 0x6c, 0xb1, 0xe2, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xe2, 0xb1, 0x6c, 0x2a,
-        0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x27, 0x56,
-        0x8d, 0xba, 0xd8, 0xee, 0xf9, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-        0xf9, 0xee, 0xd8, 0xbb, 0x8c, 0x54, 0x27, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x21, 0x31, 0x50,
-        0x72, 0x86, 0x96, 0xa0, 0xa5, 0xa5, 0xa0, 0x96, 0x86, 0x72, 0x50, 0x31, 0x21, 0x0f, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x01, 0x00, 0x00, 0x00, 0xfa, 0x12, 0x00, 0x00, 0x30, 0x75, 0x00, 0x00, 0x7f, 0x00, 0x00,
+        0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x68, 0x00, 0x00,
+        0x02, 0x6a, 0xf6, 0x04, 0xea, 0xfe, 0x84, 0xe9, 0xfe, 0xc8, 0xfe, 0xc7, 0xfe, 0xa6, 0xfe,
+        0x02, 0xa5, 0xfe, 0x02, 0xa6, 0xfe, 0x83, 0xc7, 0xfe, 0xc8, 0xfe, 0xe9, 0xfe, 0x03, 0xea,
+        0xfe, 0x02, 0x6a, 0xf6, 0x4a, 0x00, 0x00, 0x83, 0xe9, 0xfe, 0xc9, 0xfe, 0xe9, 0xfe, 0x02,
+        0xea, 0xfe, 0x81, 0x27, 0xff, 0x03, 0xea, 0xfe, 0x0c, 0xe9, 0xfe, 0x03, 0xea, 0xfe, 0x81,
+        0x26, 0xff, 0x03, 0xe9, 0xfe, 0x82, 0xc9, 0xfe, 0xe9, 0xfe, 0x43, 0x00, 0x00, 0x82, 0x88,
+        0xf5, 0xeb, 0xff, 0x02, 0xea, 0xfe, 0x81, 0xe9, 0xfe, 0x04, 0xea, 0xfe, 0x03, 0xe9, 0xfe,
+        0x02, 0xe8, 0xfe, 0x0b, 0xc8, 0xfe, 0x04, 0xe9, 0xfe, 0x02, 0xea, 0xfe, 0x85, 0xe8, 0xfe,
+        0xe9, 0xfe, 0xea, 0xfe, 0xeb, 0xff, 0x88, 0xf5, 0x3e, 0x00, 0x00, 0x02, 0xe9, 0xfe, 0x02,
+        0xea, 0xfe, 0x81, 0xca, 0xfe, 0x02, 0xea, 0xfe, 0x03, 0xe9, 0xfe, 0x81, 0xe8, 0xfe, 0x15,
+        0xc8, 0xfe, 0x03, 0xe9, 0xfe, 0x81, 0xeb, 0xfe, 0x02, 0xe9, 0xfe, 0x82, 0x0a, 0xff, 0xe9,
+        0xfe, 0x3a, 0x00, 0x00, 0x02, 0xe9, 0xfe, 0x04, 0xea, 0xfe, 0x03, 0xe9, 0xfe, 0x16, 0xc8,
+        0xfe, 0x03, 0xc7, 0xfe, 0x03, 0xc8, 0xfe, 0x03, 0xe9, 0xfe, 0x81, 0xc9, 0xfe, 0x02, 0xea,
+        0xfe, 0x81, 0xe9, 0xfe, 0x36, 0x00, 0x00, 0x83, 0xea, 0xfe, 0xca, 0xff, 0xca, 0xfe, 0x03,
+        0xea, 0xfe, 0x02, 0xe9, 0xfe, 0x1a, 0xc8, 0xfe, 0x05, 0xc7, 0xfe, 0x02, 0xc8, 0xfe, 0x02,
+        0xe9, 0xfe, 0x85, 0xea, 0xfe, 0xc8, 0xfe, 0xc9, 0xfe, 0x6b, 0xfb, 0xe9, 0xfe, 0x32, 0x00,
+        0x00, 0x86, 0x88, 0xf5, 0x2a, 0xff, 0xca, 0xfe, 0xea, 0xfe, 0xca, 0xfe, 0xea, 0xfe, 0x02,
+        0xe9, 0xfe, 0x1c, 0xc8, 0xfe, 0x08, 0xc7, 0xfe, 0x81, 0xc8, 0xfe, 0x02, 0xe9, 0xfe, 0x85,
+        0xca, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0x2a, 0xff, 0x88, 0xf5, 0x2f, 0x00, 0x00, 0x81, 0xe9,
+        0xfe, 0x02, 0x0a, 0xff, 0x82, 0x8a, 0xfe, 0xea, 0xfe, 0x02, 0xe9, 0xfe, 0x1e, 0xc8, 0xfe,
+        0x0a, 0xc7, 0xfe, 0x81, 0xc8, 0xfe, 0x02, 0xe9, 0xfe, 0x84, 0x10, 0xff, 0xe9, 0xfe, 0xc8,
+        0xfe, 0xe9, 0xfe, 0x2d, 0x00, 0x00, 0x82, 0x49, 0xfe, 0x00, 0x38, 0x03, 0xea, 0xfe, 0x02,
+        0xe9, 0xfe, 0x81, 0xe8, 0xfe, 0x1e, 0xc8, 0xfe, 0x0c, 0xc7, 0xfe, 0x81, 0xc8, 0xfe, 0x02,
+        0xc9, 0xfe, 0x83, 0xc8, 0xfe, 0x1f, 0x00, 0x29, 0xfe, 0x2b, 0x00, 0x00, 0x83, 0xe9, 0xfe,
+        0xc9, 0xfe, 0x0a, 0xff, 0x02, 0xea, 0xfe, 0x02, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1d, 0xc8,
+        0xfe, 0x0d, 0xc7, 0xfe, 0x02, 0xc8, 0xfe, 0x84, 0xe9, 0xfe, 0x29, 0xff, 0xca, 0xfe, 0xe9,
+        0xfe, 0x29, 0x00, 0x00, 0x02, 0xe9, 0xfe, 0x82, 0x29, 0xfe, 0xea, 0xfe, 0x04, 0xe9, 0xfe,
+        0x03, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x0f, 0xc7, 0xfe, 0x83, 0xc8, 0xfe, 0xc9, 0xfe, 0xff,
+        0xff, 0x02, 0xe9, 0xfe, 0x27, 0x00, 0x00, 0x02, 0xea, 0xfe, 0x82, 0xe8, 0xfe, 0xea, 0xfe,
+        0x05, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x10, 0xc7, 0xfe, 0x83, 0xc8, 0xfe,
+        0xe9, 0xfe, 0x0b, 0xff, 0x02, 0xe9, 0xfe, 0x25, 0x00, 0x00, 0x02, 0xea, 0xfe, 0x82, 0x0b,
+        0xff, 0xea, 0xfe, 0x07, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe, 0x11, 0xc7, 0xfe,
+        0x83, 0xc8, 0xfe, 0xe8, 0xfe, 0x0a, 0xff, 0x02, 0xe9, 0xfe, 0x23, 0x00, 0x00, 0x84, 0xe9,
+        0xfe, 0xea, 0xfe, 0x0b, 0xff, 0xea, 0xfe, 0x08, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1c, 0xc8,
+        0xfe, 0x13, 0xc7, 0xfe, 0x82, 0xe9, 0xfe, 0x0a, 0xff, 0x02, 0xe9, 0xfe, 0x21, 0x00, 0x00,
+        0x02, 0xe9, 0xfe, 0x81, 0xe7, 0xfe, 0x0a, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe,
+        0x14, 0xc7, 0xfe, 0x82, 0xe8, 0xfe, 0x0b, 0xff, 0x02, 0xe9, 0xfe, 0x1f, 0x00, 0x00, 0x84,
+        0x49, 0xfe, 0xca, 0xfe, 0x6c, 0xfe, 0xea, 0xfe, 0x09, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1d,
+        0xc8, 0xfe, 0x14, 0xc7, 0xfe, 0x85, 0xc8, 0xfe, 0xe9, 0xfe, 0xff, 0xff, 0xca, 0xfe, 0x29,
+        0xfe, 0x1d, 0x00, 0x00, 0x84, 0xe9, 0xfe, 0x00, 0x00, 0x0a, 0xff, 0xea, 0xfe, 0x0a, 0xe9,
+        0xfe, 0x03, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x15, 0xc7, 0xfe, 0x85, 0xc8, 0xfe, 0xc9, 0xfe,
+        0x08, 0xff, 0x1f, 0x00, 0xe9, 0xfe, 0x1b, 0x00, 0x00, 0x82, 0x88, 0xf5, 0x0a, 0xff, 0x02,
+        0xea, 0xfe, 0x0a, 0xe9, 0xfe, 0x04, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x16, 0xc7, 0xfe, 0x82,
+        0xc8, 0xfe, 0xe9, 0xfe, 0x02, 0xc8, 0xfe, 0x81, 0x88, 0xf5, 0x1a, 0x00, 0x00, 0x81, 0x0a,
+        0xff, 0x02, 0xea, 0xfe, 0x0b, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1e, 0xc8, 0xfe, 0x17, 0xc7,
+        0xfe, 0x84, 0xc8, 0xfe, 0xc9, 0xfe, 0xe9, 0xfe, 0x29, 0xff, 0x19, 0x00, 0x00, 0x83, 0xea,
+        0xfe, 0xc9, 0xfe, 0x69, 0xfe, 0x0b, 0xe9, 0xfe, 0x04, 0xe8, 0xfe, 0x1e, 0xc8, 0xfe, 0x18,
+        0xc7, 0xfe, 0x84, 0xc8, 0xfe, 0x12, 0xff, 0xc9, 0xfe, 0xe9, 0xfe, 0x18, 0x00, 0x00, 0x83,
+        0xca, 0xff, 0xe9, 0xfe, 0xea, 0xfe, 0x0a, 0xe9, 0xfe, 0x04, 0xe8, 0xfe, 0x1f, 0xc8, 0xfe,
+        0x18, 0xc7, 0xfe, 0x81, 0xc8, 0xfe, 0x02, 0xe9, 0xfe, 0x81, 0x4a, 0xfb, 0x17, 0x00, 0x00,
+        0x81, 0xe9, 0xfe, 0x02, 0xca, 0xfe, 0x02, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x03, 0xe9, 0xfe,
+        0x07, 0xe8, 0xfe, 0x1f, 0xc8, 0xfe, 0x19, 0xc7, 0xfe, 0x84, 0xc8, 0xfe, 0xcb, 0xfe, 0xc9,
+        0xfe, 0xe9, 0xfe, 0x16, 0x00, 0x00, 0x84, 0xea, 0xfe, 0xe9, 0xfe, 0xea, 0xfe, 0xe9, 0xfe,
+        0x0c, 0xe8, 0xfe, 0x20, 0xc8, 0xfe, 0x1b, 0xc7, 0xfe, 0x83, 0xc8, 0xfe, 0xc7, 0xfe, 0xe9,
+        0xfe, 0x15, 0x00, 0x00, 0x81, 0xe9, 0xfe, 0x02, 0xea, 0xfe, 0x82, 0xe9, 0xfe, 0xc8, 0xfe,
+        0x0a, 0xe8, 0xfe, 0x22, 0xc8, 0xfe, 0x1c, 0xc7, 0xfe, 0x83, 0xc9, 0xfe, 0xc8, 0xfe, 0xe9,
+        0xfe, 0x14, 0x00, 0x00, 0x84, 0xea, 0xfe, 0xc9, 0xfe, 0xe9, 0xfe, 0xc9, 0xfe, 0x04, 0xc8,
+        0xfe, 0x02, 0xe8, 0xfe, 0x27, 0xc8, 0xfe, 0x1c, 0xc7, 0xfe, 0x83, 0xc8, 0xfe, 0xc7, 0xfe,
+        0x0b, 0xff, 0x13, 0x00, 0x00, 0x84, 0x2a, 0xf6, 0xe9, 0xfe, 0xc9, 0xfe, 0xe9, 0xfe, 0x2e,
+        0xc8, 0xfe, 0x1d, 0xc7, 0xfe, 0x02, 0xe9, 0xfe, 0x81, 0x88, 0xf5, 0x12, 0x00, 0x00, 0x81,
+        0x11, 0x00, 0x02, 0xe9, 0xfe, 0x81, 0xc9, 0xfe, 0x09, 0xc8, 0xfe, 0x86, 0xc9, 0xfe, 0xeb,
+        0xfe, 0x0e, 0xff, 0x11, 0xff, 0x34, 0xf7, 0x35, 0xf7, 0x03, 0x56, 0xf7, 0x85, 0x34, 0xf7,
+        0x32, 0xf7, 0x0f, 0xff, 0xec, 0xfe, 0xca, 0xfe, 0x16, 0xc8, 0xfe, 0x1e, 0xc7, 0xfe, 0x83,
+        0xc8, 0xfe, 0xe7, 0xfe, 0xe8, 0xff, 0x12, 0x00, 0x00, 0x83, 0xea, 0xfe, 0xeb, 0xfe, 0xe9,
+        0xfe, 0x07, 0xc8, 0xfe, 0x85, 0xc9, 0xfe, 0xec, 0xfe, 0x32, 0xf7, 0x57, 0xf7, 0x7b, 0xf7,
+        0x02, 0x7d, 0xf7, 0x03, 0x7e, 0xef, 0x81, 0x9e, 0xef, 0x02, 0x7e, 0xef, 0x02, 0x7d, 0xf7,
+        0x85, 0x7c, 0xf7, 0x59, 0xf7, 0x35, 0xf7, 0xee, 0xfe, 0xca, 0xfe, 0x02, 0xa8, 0xfe, 0x11,
+        0xc8, 0xfe, 0x1f, 0xc7, 0xfe, 0x82, 0xcb, 0xfe, 0xc9, 0xfe, 0x11, 0x00, 0x00, 0x02, 0xe9,
+        0xfe, 0x02, 0xc9, 0xfe, 0x05, 0xc8, 0xfe, 0x85, 0xc9, 0xfe, 0x0f, 0xff, 0x57, 0xf7, 0x7c,
+        0xf7, 0x7d, 0xf7, 0x02, 0x7e, 0xef, 0x0a, 0x7d, 0xef, 0x03, 0x7e, 0xef, 0x84, 0x7d, 0xf7,
+        0x59, 0xf7, 0x12, 0xf7, 0xcb, 0xfe, 0x03, 0xa8, 0xfe, 0x0e, 0xc8, 0xfe, 0x1f, 0xc7, 0xfe,
+        0x02, 0xc8, 0xfe, 0x81, 0xe9, 0xfe, 0x10, 0x00, 0x00, 0x83, 0xc9, 0xfe, 0xe8, 0xfe, 0xe9,
+        0xfe, 0x04, 0xc8, 0xfe, 0x84, 0xc9, 0xfe, 0x0e, 0xff, 0x57, 0xf7, 0x7d, 0xf7, 0x02, 0x7e,
+        0xef, 0x11, 0x7d, 0xef, 0x86, 0x7e, 0xef, 0x7d, 0xf7, 0x7a, 0xf7, 0x12, 0xf7, 0xca, 0xfe,
+        0xa7, 0xfe, 0x02, 0xa8, 0xfe, 0x0b, 0xc8, 0xfe, 0x21, 0xc7, 0xfe, 0x82, 0xc6, 0xfe, 0xea,
+        0xfe, 0x10, 0x00, 0x00, 0x83, 0xe9, 0xfe, 0xea, 0xfe, 0xe9, 0xfe, 0x03, 0xc8, 0xfe, 0x83,
+        0xeb, 0xfe, 0x34, 0xf7, 0x7c, 0xf7, 0x02, 0x7e, 0xef, 0x15, 0x7d, 0xef, 0x84, 0x7e, 0xef,
+        0x7d, 0xf7, 0x58, 0xf7, 0xee, 0xfe, 0x03, 0xa8, 0xfe, 0x0a, 0xc8, 0xfe, 0x21, 0xc7, 0xfe,
+        0x02, 0xc9, 0xfe, 0x10, 0x00, 0x00, 0x82, 0xe9, 0xfe, 0xc9, 0xfe, 0x03, 0xc8, 0xfe, 0x82,
+        0xed, 0xfe, 0x58, 0xf7, 0x02, 0x7e, 0xef, 0x19, 0x7d, 0xef, 0x84, 0x7e, 0xef, 0x7c, 0xf7,
+        0x11, 0xf7, 0xa9, 0xfe, 0x02, 0xa8, 0xfe, 0x08, 0xc8, 0xfe, 0x22, 0xc7, 0xfe, 0x82, 0xc8,
+        0xfe, 0xc7, 0xfe, 0x0f, 0x00, 0x00, 0x83, 0x6a, 0xf6, 0xc8, 0xfe, 0xc9, 0xfe, 0x02, 0xc8,
+        0xfe, 0x83, 0x0f, 0xff, 0x7b, 0xf7, 0x7e, 0xef, 0x1c, 0x7d, 0xef, 0x86, 0x7e, 0xef, 0x7d,
+        0xf7, 0x34, 0xf7, 0xa9, 0xfe, 0xa7, 0xfe, 0xa8, 0xfe, 0x07, 0xc8, 0xfe, 0x24, 0xc7, 0xfe,
+        0x81, 0x6a, 0xf6, 0x0e, 0x00, 0x00, 0x82, 0x6a, 0xf6, 0x06, 0xff, 0x02, 0xc8, 0xfe, 0x83,
+        0x10, 0xf7, 0x7c, 0xf7, 0x7e, 0xef, 0x1e, 0x7d, 0xef, 0x87, 0x7e, 0xef, 0x7d, 0xf7, 0x35,
+        0xf7, 0xa9, 0xfe, 0xa7, 0xfe, 0xa8, 0xfe, 0xc8, 0xfe, 0x03, 0xc7, 0xfe, 0x81, 0xc8, 0xfe,
+        0x24, 0xc7, 0xfe, 0x82, 0x04, 0xff, 0x6a, 0xf6, 0x0e, 0x00, 0x00, 0x02, 0xe9, 0xfe, 0x84,
+        0xc8, 0xfe, 0x0f, 0xff, 0x7c, 0xf7, 0x7e, 0xef, 0x20, 0x7d, 0xef, 0x84, 0x7e, 0xef, 0x7d,
+        0xef, 0x35, 0xf7, 0xa9, 0xfe, 0x04, 0xa7, 0xfe, 0x81, 0xc8, 0xfe, 0x25, 0xc7, 0xfe, 0x82,
+        0xea, 0xfe, 0xe9, 0xfe, 0x0e, 0x00, 0x00, 0x85, 0xc9, 0xfe, 0xc7, 0xfe, 0x0f, 0xff, 0x7b,
+        0xf7, 0x7e, 0xef, 0x22, 0x7d, 0xef, 0x84, 0x7e, 0xef, 0x7d, 0xef, 0x13, 0xf7, 0xa8, 0xfe,
+        0x04, 0xa7, 0xfe, 0x23, 0xc7, 0xfe, 0x81, 0xc6, 0xfe, 0x03, 0xc7, 0xfe, 0x0d, 0x00, 0x00,
+        0x85, 0x5d, 0xef, 0x35, 0xf7, 0x34, 0xf7, 0x7a, 0xf7, 0x7e, 0xef, 0x24, 0x7d, 0xef, 0x84,
+        0x7e, 0xef, 0x7c, 0xf7, 0xef, 0xf6, 0x87, 0xfe, 0x04, 0xa7, 0xfe, 0x22, 0xc7, 0xfe, 0x81,
+        0xc6, 0xfe, 0x03, 0xc7, 0xfe, 0x0d, 0x00, 0x00, 0x82, 0x5c, 0xef, 0x1a, 0xef, 0x28, 0x7d,
+        0xef, 0x84, 0x7e, 0xef, 0x5a, 0xf7, 0xcb, 0xfe, 0x87, 0xfe, 0x04, 0xa7, 0xfe, 0x21, 0xc7,
+        0xfe, 0x02, 0xc6, 0xfe, 0x82, 0xc7, 0xfe, 0xa6, 0xfe, 0x0c, 0x00, 0x00, 0x83, 0x7d, 0xf7,
+        0x9d, 0xef, 0x5d, 0xef, 0x29, 0x7d, 0xef, 0x84, 0x7e, 0xef, 0x35, 0xf7, 0x88, 0xfe, 0x87,
+        0xfe, 0x03, 0xa7, 0xfe, 0x20, 0xc7, 0xfe, 0x03, 0xc6, 0xfe, 0x82, 0xc7, 0xfe, 0xa6, 0xfe,
+        0x0c, 0x00, 0x00, 0x02, 0x3c, 0xef, 0x2a, 0x7d, 0xef, 0x83, 0x7e, 0xef, 0x7c, 0xf7, 0xce,
+        0xf6, 0x02, 0x87, 0xfe, 0x03, 0xa7, 0xfe, 0x1f, 0xc7, 0xfe, 0x03, 0xc6, 0xfe, 0x82, 0xa7,
+        0xfe, 0xc6, 0xfe, 0x0b, 0x00, 0x00, 0x82, 0x3c, 0xef, 0x9e, 0xef, 0x2c, 0x7d, 0xef, 0x84,
+        0x7e, 0xef, 0x36, 0xf7, 0x88, 0xfe, 0x87, 0xfe, 0x04, 0xa7, 0xfe, 0x1d, 0xc7, 0xfe, 0x04,
+        0xc6, 0xfe, 0x82, 0xc7, 0xfe, 0xa6, 0xfe, 0x0a, 0x00, 0x00, 0x83, 0xf9, 0xe6, 0xda, 0xe6,
+        0xfb, 0xe6, 0x2c, 0x7d, 0xef, 0x83, 0x7e, 0xef, 0x7c, 0xf7, 0xcd, 0xfe, 0x02, 0x87, 0xfe,
+        0x03, 0xa7, 0xfe, 0x81, 0xc7, 0xfe, 0x02, 0xa7, 0xfe, 0x1a, 0xc7, 0xfe, 0x04, 0xc6, 0xfe,
+        0x82, 0xc7, 0xfe, 0xa6, 0xfe, 0x0a, 0x00, 0x00, 0x81, 0xf0, 0xdd, 0x2f, 0x7d, 0xef, 0x82,
+        0x7e, 0xef, 0x34, 0xf7, 0x03, 0xaa, 0xfe, 0x04, 0xca, 0xfe, 0x82, 0xc9, 0xfe, 0xc8, 0xfe,
+        0x02, 0xa7, 0xfe, 0x81, 0xc7, 0xfe, 0x05, 0xa7, 0xfe, 0x11, 0xc7, 0xfe, 0x06, 0xc6, 0xfe,
+        0x0a, 0x00, 0x00, 0x82, 0xff, 0xff, 0xbf, 0xef, 0x2f, 0x7d, 0xef, 0x81, 0x7d, 0xf7, 0x07,
+        0x7b, 0xf7, 0x85, 0x59, 0xf7, 0x56, 0xf7, 0x12, 0xf7, 0xed, 0xfe, 0xc8, 0xfe, 0x07, 0xa7,
+        0xfe, 0x0e, 0xc7, 0xfe, 0x05, 0xc6, 0xfe, 0x82, 0xa6, 0xfe, 0xc7, 0xfe, 0x0a, 0x00, 0x00,
+        0x82, 0x99, 0xe6, 0xfb, 0xee, 0x30, 0x7d, 0xef, 0x08, 0x7e, 0xef, 0x86, 0x9e, 0xef, 0x7e,
+        0xef, 0x7c, 0xf7, 0x58, 0xf7, 0x10, 0xf7, 0xa9, 0xfe, 0x06, 0xa7, 0xfe, 0x0d, 0xc7, 0xfe,
+        0x05, 0xc6, 0xfe, 0x82, 0xa6, 0xfe, 0xc7, 0xfe, 0x09, 0x00, 0x00, 0x83, 0x2c, 0xee, 0x5c,
+        0xef, 0x5d, 0xef, 0x3a, 0x7d, 0xef, 0x02, 0x7e, 0xef, 0x85, 0x7d, 0xf7, 0x58, 0xf7, 0xee,
+        0xfe, 0xa7, 0xfe, 0xa6, 0xfe, 0x05, 0xa7, 0xfe, 0x0a, 0xc7, 0xfe, 0x06, 0xc6, 0xfe, 0x82,
+        0xc7, 0xfe, 0xc6, 0xfe, 0x09, 0x00, 0x00, 0x83, 0x2b, 0xee, 0x9e, 0xf7, 0x7d, 0xf7, 0x3d,
+        0x7d, 0xef, 0x85, 0x7e, 0xef, 0x7c, 0xf7, 0x13, 0xf7, 0xa8, 0xfe, 0x86, 0xfe, 0x05, 0xa7,
+        0xfe, 0x09, 0xc7, 0xfe, 0x06, 0xc6, 0xfe, 0x82, 0xa7, 0xfe, 0xc6, 0xfe, 0x09, 0x00, 0x00,
+        0x82, 0xfa, 0xee, 0xff, 0xf7, 0x3f, 0x7d, 0xef, 0x86, 0x7e, 0xef, 0x7d, 0xef, 0x35, 0xf7,
+        0xa9, 0xfe, 0x86, 0xfe, 0x87, 0xfe, 0x04, 0xa7, 0xfe, 0x07, 0xc7, 0xfe, 0x07, 0xc6, 0xfe,
+        0x82, 0xc7, 0xfe, 0xa6, 0xfe, 0x09, 0x00, 0x00, 0x82, 0x3c, 0xef, 0x4c, 0xc4, 0x42, 0x7d,
+        0xef, 0x84, 0x35, 0xf7, 0x88, 0xfe, 0x86, 0xfe, 0x87, 0xfe, 0x04, 0xa7, 0xfe, 0x06, 0xc7,
+        0xfe, 0x07, 0xc6, 0xfe, 0x82, 0xa7, 0xfe, 0xc6, 0xfe, 0x09, 0x00, 0x00, 0x82, 0x7d, 0xf7,
+        0x5d, 0xf7, 0x43, 0x7d, 0xef, 0x82, 0xf2, 0xf6, 0x67, 0xfe, 0x02, 0x87, 0xfe, 0x83, 0xa7,
+        0xfe, 0xa6, 0xfe, 0xa7, 0xfe, 0x05, 0xc7, 0xfe, 0x07, 0xc6, 0xfe, 0x03, 0xa6, 0xfe, 0x09,
+        0x00, 0x00, 0x03, 0x7d, 0xf7, 0x42, 0x7d, 0xef, 0x85, 0x7c, 0xef, 0xae, 0xf6, 0x66, 0xfe,
+        0x87, 0xfe, 0xa7, 0xfe, 0x02, 0xa6, 0xfe, 0x81, 0xa7, 0xfe, 0x03, 0xc7, 0xfe, 0x08, 0xc6,
+        0xfe, 0x03, 0xa6, 0xfe, 0x09, 0x00, 0x00, 0x03, 0x7d, 0xf7, 0x42, 0x7d, 0xef, 0x86, 0x7e,
+        0xef, 0x38, 0xf7, 0x49, 0xf6, 0x66, 0xfe, 0x87, 0xfe, 0xa7, 0xfe, 0x02, 0xa6, 0xfe, 0x03,
+        0xc7, 0xfe, 0x08, 0xc6, 0xfe, 0x83, 0xa6, 0xfe, 0x06, 0xf6, 0x26, 0xf6, 0x09, 0x00, 0x00,
+        0x82, 0x7d, 0xf7, 0x5d, 0xf7, 0x45, 0x7d, 0xef, 0x84, 0xaf, 0xf6, 0x26, 0xf6, 0x86, 0xfe,
+        0xa7, 0xfe, 0x03, 0xa6, 0xfe, 0x81, 0xc7, 0xfe, 0x09, 0xc6, 0xfe, 0x83, 0xa6, 0xfe, 0x45,
+        0xff, 0x08, 0xee, 0x09, 0x00, 0x00, 0x82, 0x7d, 0xf7, 0x3c, 0xf7, 0x44, 0x7d, 0xef, 0x85,
+        0x7e, 0xef, 0x37, 0xf7, 0x27, 0xf6, 0x26, 0xf6, 0x86, 0xfe, 0x03, 0xa6, 0xfe, 0x81, 0xc7,
+        0xfe, 0x08, 0xc6, 0xfe, 0x84, 0xa6, 0xfe, 0x86, 0xfe, 0xa6, 0xfe, 0x29, 0xf6, 0x09, 0x00,
+        0x00, 0x82, 0x1a, 0xef, 0xff, 0xff, 0x45, 0x7d, 0xef, 0x85, 0x5c, 0xef, 0x6c, 0xf6, 0x06,
+        0xf6, 0x46, 0xf6, 0x86, 0xfe, 0x03, 0xa6, 0xfe, 0x08, 0xc6, 0xfe, 0x83, 0xa6, 0xfe, 0x86,
+        0xfe, 0xa6, 0xfe, 0x0a, 0x00, 0x00, 0x82, 0xb6, 0xee, 0xbf, 0xef, 0x46, 0x7d, 0xef, 0x85,
+        0xd1, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x86, 0xfe, 0x03, 0xa6, 0xfe, 0x07, 0xc6,
+        0xfe, 0x83, 0xa6, 0xfe, 0x26, 0xf6, 0x46, 0xfe, 0x0a, 0x00, 0x00, 0x83, 0x40, 0xf5, 0x3d,
+        0xef, 0x3c, 0xef, 0x44, 0x7d, 0xef, 0x86, 0x7e, 0xef, 0x15, 0xf7, 0x27, 0xf6, 0x26, 0xf6,
+        0x46, 0xf6, 0x66, 0xfe, 0x03, 0xa6, 0xfe, 0x06, 0xc6, 0xfe, 0x84, 0xa6, 0xfe, 0x86, 0xfe,
+        0xc6, 0xfe, 0x05, 0xfe, 0x0a, 0x00, 0x00, 0x83, 0x2a, 0xf6, 0xfb, 0xe6, 0x1b, 0xef, 0x44,
+        0x7d, 0xef, 0x87, 0x7e, 0xef, 0x38, 0xef, 0x28, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xfe,
+        0x66, 0xfe, 0x02, 0xa6, 0xfe, 0x06, 0xc6, 0xfe, 0x84, 0xa6, 0xfe, 0x86, 0xfe, 0xa6, 0xfe,
+        0x26, 0xfe, 0x0b, 0x00, 0x00, 0x82, 0x78, 0xe6, 0xba, 0xe6, 0x45, 0x7d, 0xef, 0x85, 0x5a,
+        0xef, 0x48, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xfe, 0x02, 0x66, 0xfe, 0x81, 0xa6, 0xfe,
+        0x06, 0xc6, 0xfe, 0x83, 0xa6, 0xfe, 0x06, 0xf6, 0x46, 0xf6, 0x0c, 0x00, 0x00, 0x83, 0xff,
+        0xff, 0x7e, 0xef, 0x5d, 0xef, 0x44, 0x7d, 0xef, 0x83, 0x5b, 0xef, 0x48, 0xf6, 0x26, 0xf6,
+        0x02, 0x46, 0xf6, 0x03, 0x66, 0xfe, 0x81, 0xa6, 0xfe, 0x04, 0xc6, 0xfe, 0x84, 0xa6, 0xfe,
+        0x86, 0xfe, 0xa6, 0xfe, 0xa4, 0xff, 0x0c, 0x00, 0x00, 0x83, 0x7d, 0xef, 0x3b, 0xef, 0x3c,
+        0xef, 0x44, 0x7d, 0xef, 0x83, 0x5a, 0xef, 0x48, 0xf6, 0x26, 0xf6, 0x02, 0x46, 0xf6, 0x03,
+        0x66, 0xfe, 0x82, 0x86, 0xfe, 0xa6, 0xfe, 0x03, 0xc6, 0xfe, 0x84, 0x86, 0xfe, 0x27, 0xf6,
+        0x46, 0xfe, 0x88, 0xf5, 0x0d, 0x00, 0x00, 0x83, 0xe0, 0xfa, 0xff, 0xff, 0x5c, 0xef, 0x42,
+        0x7d, 0xef, 0x84, 0x7e, 0xef, 0x39, 0xef, 0x48, 0xf6, 0x26, 0xf6, 0x02, 0x46, 0xf6, 0x02,
+        0x66, 0xfe, 0x03, 0x86, 0xfe, 0x86, 0xa6, 0xfe, 0xc6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe, 0x86,
+        0xfe, 0x27, 0xf6, 0x0e, 0x00, 0x00, 0x84, 0x2a, 0xf6, 0x1b, 0xe7, 0xfb, 0xe6, 0x5d, 0xef,
+        0x41, 0x7d, 0xef, 0x85, 0x7e, 0xef, 0xf6, 0xee, 0x27, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x03,
+        0x66, 0xfe, 0x04, 0x86, 0xfe, 0x85, 0xa6, 0xfe, 0x86, 0xfe, 0x26, 0xf6, 0x46, 0xfe, 0x87,
+        0xfe, 0x0f, 0x00, 0x00, 0x83, 0x99, 0xde, 0x11, 0xc5, 0x5c, 0xef, 0x41, 0x7d, 0xef, 0x83,
+        0x7e, 0xef, 0xb2, 0xee, 0x26, 0xf6, 0x02, 0x46, 0xf6, 0x03, 0x66, 0xfe, 0x05, 0x86, 0xfe,
+        0x83, 0x46, 0xfe, 0xa6, 0xfe, 0x05, 0xfe, 0x10, 0x00, 0x00, 0x84, 0xda, 0xe6, 0xdb, 0xe6,
+        0xb9, 0xe6, 0x5c, 0xef, 0x40, 0x7d, 0xef, 0x83, 0x5c, 0xef, 0x6d, 0xf6, 0x26, 0xf6, 0x02,
+        0x46, 0xf6, 0x03, 0x66, 0xfe, 0x04, 0x86, 0xfe, 0x84, 0x46, 0xfe, 0xe6, 0xf5, 0x06, 0xf6,
+        0x26, 0xfe, 0x11, 0x00, 0x00, 0x83, 0x49, 0xc3, 0xff, 0xf7, 0x1c, 0xe7, 0x3f, 0x7d, 0xef,
+        0x84, 0x7e, 0xef, 0x39, 0xef, 0x48, 0xf6, 0x26, 0xf6, 0x02, 0x46, 0xf6, 0x02, 0x66, 0xfe,
+        0x04, 0x86, 0xfe, 0x84, 0x66, 0xfe, 0x26, 0xf6, 0x26, 0xfe, 0xdf, 0xfd, 0x12, 0x00, 0x00,
+        0x84, 0xf7, 0xdd, 0xfb, 0xe6, 0xda, 0xe6, 0x3c, 0xe7, 0x3f, 0x7d, 0xef, 0x81, 0xb1, 0xee,
+        0x02, 0x26, 0xf6, 0x82, 0x46, 0xf6, 0x46, 0xfe, 0x02, 0x66, 0xfe, 0x04, 0x86, 0xfe, 0x82,
+        0x46, 0xf6, 0x65, 0xfd, 0x02, 0x26, 0xf6, 0x13, 0x00, 0x00, 0x84, 0x1c, 0xef, 0xfb, 0xe6,
+        0x98, 0xde, 0x3c, 0xef, 0x3c, 0x7d, 0xef, 0x83, 0x7e, 0xef, 0x19, 0xef, 0x29, 0xf6, 0x02,
+        0x26, 0xf6, 0x81, 0x46, 0xf6, 0x02, 0x66, 0xfe, 0x04, 0x86, 0xfe, 0x84, 0x46, 0xfe, 0x06,
+        0xf6, 0x26, 0xf6, 0x45, 0xfe, 0x15, 0x00, 0x00, 0x84, 0x7f, 0xdf, 0xfc, 0xe6, 0xba, 0xde,
+        0x3c, 0xe7, 0x3b, 0x7d, 0xef, 0x82, 0x5d, 0xef, 0x90, 0xee, 0x02, 0x26, 0xf6, 0x02, 0x46,
+        0xf6, 0x02, 0x66, 0xfe, 0x03, 0x86, 0xfe, 0x85, 0x66, 0xfe, 0x26, 0xf6, 0x46, 0xfe, 0x66,
+        0xfe, 0x88, 0xf5, 0x15, 0x00, 0x00, 0x85, 0x2a, 0xf6, 0x00, 0x88, 0x7e, 0xe7, 0x78, 0xde,
+        0x1c, 0xe7, 0x3a, 0x7d, 0xef, 0x82, 0xd5, 0xee, 0x27, 0xf6, 0x02, 0x26, 0xf6, 0x83, 0x46,
+        0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x03, 0x86, 0xfe, 0x85, 0x66, 0xfe, 0x46, 0xf6, 0x65, 0xfe,
+        0x1f, 0x00, 0x26, 0xf6, 0x17, 0x00, 0x00, 0x86, 0xf1, 0xcc, 0xe1, 0xb1, 0x7e, 0xe7, 0xb9,
+        0xe6, 0x1c, 0xe7, 0x5d, 0xef, 0x37, 0x7d, 0xef, 0x82, 0xf8, 0xee, 0x2a, 0xf6, 0x02, 0x26,
+        0xf6, 0x82, 0x46, 0xf6, 0x46, 0xfe, 0x02, 0x66, 0xfe, 0x02, 0x86, 0xfe, 0x85, 0x66, 0xfe,
+        0x26, 0xf6, 0xc5, 0xf4, 0x06, 0xf6, 0xc7, 0xf5, 0x19, 0x00, 0x00, 0x86, 0xf1, 0xcc, 0x00,
+        0x00, 0xdb, 0xde, 0x37, 0xde, 0xfb, 0xe6, 0x5d, 0xef, 0x35, 0x7d, 0xef, 0x82, 0xf8, 0xee,
+        0x2a, 0xee, 0x03, 0x26, 0xf6, 0x81, 0x46, 0xf6, 0x02, 0x66, 0xfe, 0x02, 0x86, 0xfe, 0x85,
+        0x66, 0xfe, 0x46, 0xf6, 0x24, 0xe5, 0x05, 0xf6, 0x26, 0xfe, 0x1b, 0x00, 0x00, 0x87, 0x88,
+        0xf5, 0xfe, 0xde, 0x79, 0xde, 0x47, 0xbb, 0xba, 0xe6, 0x1b, 0xe7, 0x5d, 0xef, 0x31, 0x7d,
+        0xef, 0x83, 0x5d, 0xef, 0xd6, 0xee, 0x2a, 0xf6, 0x03, 0x26, 0xf6, 0x82, 0x46, 0xf6, 0x46,
+        0xfe, 0x02, 0x66, 0xfe, 0x86, 0x86, 0xfe, 0x66, 0xfe, 0x46, 0xf6, 0xe6, 0xf5, 0x26, 0xf6,
+        0x05, 0xf6, 0x1e, 0x00, 0x00, 0x87, 0xf6, 0xdd, 0xd5, 0xd5, 0x7e, 0xe7, 0x17, 0xd6, 0xba,
+        0xe6, 0x1c, 0xe7, 0x5d, 0xef, 0x2e, 0x7d, 0xef, 0x83, 0x3b, 0xef, 0x92, 0xee, 0x28, 0xf6,
+        0x03, 0x26, 0xf6, 0x82, 0x46, 0xf6, 0x46, 0xfe, 0x02, 0x66, 0xfe, 0x84, 0x86, 0xfe, 0x66,
+        0xfe, 0x46, 0xf6, 0x06, 0xf6, 0x02, 0x26, 0xf6, 0x20, 0x00, 0x00, 0x89, 0xf1, 0xcc, 0xff,
+        0xf7, 0x58, 0xde, 0xff, 0xef, 0x17, 0xde, 0xba, 0xde, 0x1b, 0xe7, 0x3c, 0xef, 0x5d, 0xef,
+        0x02, 0x7d, 0xef, 0x81, 0x7e, 0xef, 0x23, 0x7d, 0xef, 0x02, 0x7e, 0xef, 0x84, 0x5d, 0xef,
+        0x3b, 0xef, 0xb4, 0xee, 0x2b, 0xee, 0x04, 0x26, 0xf6, 0x82, 0x46, 0xf6, 0x46, 0xfe, 0x04,
+        0x66, 0xfe, 0x82, 0x26, 0xf6, 0x24, 0xe5, 0x02, 0x26, 0xf6, 0x23, 0x00, 0x00, 0x8b, 0x12,
+        0xd5, 0xff, 0xe7, 0x37, 0xde, 0x9e, 0xef, 0xf0, 0xcc, 0x79, 0xde, 0xda, 0xe6, 0xfb, 0xe6,
+        0x1a, 0xe7, 0x19, 0xef, 0x3b, 0xef, 0x02, 0x5c, 0xef, 0x1e, 0x5d, 0xef, 0x87, 0x5c, 0xef,
+        0x3b, 0xef, 0x19, 0xef, 0xd6, 0xe6, 0x70, 0xee, 0x2a, 0xee, 0x06, 0xf6, 0x03, 0x26, 0xf6,
+        0x02, 0x46, 0xf6, 0x81, 0x46, 0xfe, 0x03, 0x66, 0xfe, 0x85, 0x46, 0xf6, 0x26, 0xf6, 0x05,
+        0xfd, 0x25, 0xf6, 0x05, 0xf6, 0x26, 0x00, 0x00, 0x87, 0xba, 0xde, 0x12, 0xd5, 0xce, 0xdc,
+        0x79, 0xde, 0xbf, 0xe7, 0x98, 0x82, 0x2b, 0xee, 0x02, 0x0b, 0xee, 0x81, 0x2c, 0xee, 0x16,
+        0x2d, 0xee, 0x0a, 0x4d, 0xee, 0x83, 0x2b, 0xee, 0x29, 0xf6, 0x07, 0xf6, 0x03, 0x26, 0xf6,
+        0x03, 0x46, 0xf6, 0x81, 0x46, 0xfe, 0x04, 0x66, 0xfe, 0x85, 0x46, 0xf6, 0x26, 0xf6, 0x45,
+        0xf6, 0x06, 0xf6, 0x26, 0xfe, 0x29, 0x00, 0x00, 0x86, 0x88, 0xf5, 0xbf, 0x67, 0x53, 0xd5,
+        0x7b, 0xde, 0x09, 0xf6, 0xc3, 0xf5, 0x02, 0xe5, 0xf5, 0x08, 0x06, 0xf6, 0x16, 0x26, 0xf6,
+        0x03, 0x46, 0xf6, 0x02, 0x46, 0xfe, 0x02, 0x46, 0xf6, 0x03, 0x46, 0xfe, 0x04, 0x66, 0xfe,
+        0x81, 0x46, 0xfe, 0x03, 0x26, 0xf6, 0x82, 0x1f, 0x78, 0xc7, 0xf5, 0x2d, 0x00, 0x00, 0x84,
+        0x26, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x65, 0xfe, 0x03, 0x06, 0xf6, 0x05, 0x26, 0xf6, 0x15,
+        0x46, 0xf6, 0x03, 0x66, 0xf6, 0x04, 0x46, 0xfe, 0x08, 0x66, 0xfe, 0x86, 0x46, 0xf6, 0x26,
+        0xf6, 0x65, 0xfd, 0x26, 0xf6, 0x66, 0xfe, 0x26, 0xf6, 0x2f, 0x00, 0x00, 0x82, 0x88, 0xf5,
+        0x25, 0xf6, 0x02, 0x06, 0xf6, 0x81, 0x26, 0xf6, 0x02, 0x06, 0xf6, 0x02, 0x26, 0xf6, 0x0d,
+        0x46, 0xf6, 0x81, 0x66, 0xf6, 0x16, 0x66, 0xfe, 0x83, 0x46, 0xf6, 0x26, 0xf6, 0x06, 0xf6,
+        0x02, 0x26, 0xf6, 0x82, 0x45, 0xfe, 0x88, 0xf5, 0x32, 0x00, 0x00, 0x84, 0x26, 0xf6, 0xbf,
+        0xfc, 0x26, 0xf6, 0xe6, 0xf5, 0x02, 0x06, 0xf6, 0x81, 0x26, 0xf6, 0x02, 0x46, 0xf6, 0x11,
+        0x66, 0xfe, 0x0e, 0x86, 0xfe, 0x88, 0x66, 0xfe, 0x46, 0xf6, 0x26, 0xf6, 0x06, 0xf6, 0x46,
+        0xf6, 0x26, 0xf6, 0x9f, 0xfd, 0x26, 0xf6, 0x36, 0x00, 0x00, 0x82, 0x26, 0xfe, 0x46, 0xfe,
+        0x03, 0x06, 0xf6, 0x03, 0x26, 0xf6, 0x81, 0x46, 0xf6, 0x0c, 0x66, 0xfe, 0x0e, 0x86, 0xfe,
+        0x02, 0x66, 0xfe, 0x02, 0x46, 0xf6, 0x83, 0x26, 0xf6, 0x25, 0xf6, 0x26, 0xf6, 0x02, 0x26,
+        0xfe, 0x3a, 0x00, 0x00, 0x02, 0x26, 0xfe, 0x84, 0x06, 0xf6, 0x26, 0xf6, 0xe5, 0xf5, 0x06,
+        0xf6, 0x02, 0x26, 0xf6, 0x81, 0x46, 0xf6, 0x02, 0x66, 0xfe, 0x13, 0x86, 0xfe, 0x02, 0x66,
+        0xfe, 0x81, 0x46, 0xfe, 0x02, 0x26, 0xf6, 0x85, 0xe6, 0xf5, 0x46, 0xfe, 0x26, 0xf6, 0x68,
+        0xfe, 0x87, 0xfe, 0x3e, 0x00, 0x00, 0x82, 0x88, 0xf5, 0x83, 0xfe, 0x02, 0x06, 0xf6, 0x83,
+        0x26, 0xf6, 0x26, 0xfe, 0x06, 0xf6, 0x02, 0x26, 0xf6, 0x82, 0x46, 0xf6, 0x46, 0xfe, 0x04,
+        0x66, 0xfe, 0x07, 0x86, 0xfe, 0x04, 0x66, 0xfe, 0x83, 0x46, 0xfe, 0x46, 0xf6, 0x46, 0xfe,
+        0x02, 0x06, 0xf6, 0x85, 0x46, 0xf6, 0x26, 0xf6, 0x06, 0xf6, 0x83, 0xfe, 0x88, 0xf5, 0x43,
+        0x00, 0x00, 0x86, 0x26, 0xfe, 0x25, 0xfe, 0x26, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0xa4, 0xfe,
+        0x02, 0x06, 0xf6, 0x04, 0x26, 0xf6, 0x08, 0x46, 0xf6, 0x02, 0x26, 0xf6, 0x02, 0x06, 0xf6,
+        0x86, 0xc4, 0xfe, 0x46, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x25, 0xfe, 0x26, 0xfe, 0x4a, 0x00,
+        0x00, 0x82, 0x29, 0xf6, 0x08, 0xf6, 0x04, 0x26, 0xf6, 0x84, 0x66, 0xf6, 0xa6, 0xfe, 0xc6,
+        0xfe, 0xe7, 0xfe, 0x02, 0x27, 0xff, 0x85, 0xe7, 0xfe, 0xe6, 0xfe, 0xa6, 0xfe, 0x66, 0xfe,
+        0x46, 0xf6, 0x03, 0x26, 0xf6, 0x82, 0x08, 0xf6, 0x29, 0xf6, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+        0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00,
+        0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x8a, 0x00, 0x0f, 0x22, 0x32,
+        0x50, 0x73, 0x87, 0x97, 0xa0, 0xa5, 0xa5, 0xa0, 0x97, 0x87, 0x71, 0x4f, 0x32, 0x22, 0x0f,
+        0x00, 0x26, 0x00, 0x00, 0x85, 0x00, 0x0c, 0x28, 0x57, 0x8e, 0xba, 0xd9, 0xef, 0xf9, 0xfd,
+        0x04, 0xff, 0xff, 0x85, 0xfd, 0xf9, 0xef, 0xd9, 0xbb, 0x8c, 0x56, 0x28, 0x0c, 0x00, 0x23,
+        0x00, 0x00, 0x83, 0x07, 0x2a, 0x6e, 0xb2, 0xe4, 0xf8, 0x0a, 0xff, 0xff, 0x83, 0xf8, 0xe4,
+        0xb2, 0x6e, 0x2a, 0x07, 0x21, 0x00, 0x00, 0x83, 0x11, 0x53, 0xa2, 0xe1, 0xfc, 0xff, 0x0c,
+        0xff, 0xff, 0x83, 0xff, 0xfc, 0xe1, 0xa2, 0x53, 0x10, 0x1f, 0x00, 0x00, 0x82, 0x13, 0x5b,
+        0xba, 0xf5, 0x10, 0xff, 0xff, 0x82, 0xf4, 0xb7, 0x59, 0x13, 0x1d, 0x00, 0x00, 0x82, 0x09,
+        0x54, 0xbd, 0xf7, 0x12, 0xff, 0xff, 0x82, 0xf6, 0xbc, 0x53, 0x09, 0x1b, 0x00, 0x00, 0x82,
+        0x01, 0x31, 0x9f, 0xf1, 0x14, 0xff, 0xff, 0x82, 0xf1, 0x9d, 0x30, 0x01, 0x19, 0x00, 0x00,
+        0x82, 0x00, 0x0d, 0x6f, 0xde, 0x16, 0xff, 0xff, 0x82, 0xdd, 0x6e, 0x0d, 0x00, 0x18, 0x00,
+        0x00, 0x82, 0x24, 0x9f, 0xf8, 0xff, 0x16, 0xff, 0xff, 0x82, 0xff, 0xf8, 0x9f, 0x23, 0x17,
+        0x00, 0x00, 0x82, 0x00, 0x45, 0xc9, 0xff, 0x18, 0xff, 0xff, 0x82, 0xff, 0xc7, 0x43, 0x00,
+        0x15, 0x00, 0x00, 0x82, 0x00, 0x02, 0x59, 0xe3, 0x1a, 0xff, 0xff, 0x82, 0xe2, 0x58, 0x02,
+        0x00, 0x14, 0x00, 0x00, 0x82, 0x04, 0x69, 0xea, 0xff, 0x1a, 0xff, 0xff, 0x82, 0xff, 0xea,
+        0x67, 0x04, 0x13, 0x00, 0x00, 0x82, 0x00, 0x04, 0x73, 0xf0, 0x1c, 0xff, 0xff, 0x82, 0xf0,
+        0x72, 0x04, 0x00, 0x12, 0x00, 0x00, 0x82, 0x02, 0x69, 0xf0, 0xff, 0x1c, 0xff, 0xff, 0x82,
+        0xff, 0xf0, 0x67, 0x02, 0x12, 0x00, 0x00, 0x81, 0x59, 0xeb, 0x1e, 0xff, 0xff, 0x81, 0xea,
+        0x58, 0x11, 0x00, 0x00, 0x82, 0x00, 0x45, 0xe3, 0xff, 0x1e, 0xff, 0xff, 0x82, 0xff, 0xe2,
+        0x43, 0x00, 0x10, 0x00, 0x00, 0x81, 0x24, 0xc9, 0x20, 0xff, 0xff, 0x81, 0xc7, 0x23, 0x0f,
+        0x00, 0x00, 0x82, 0x00, 0x0d, 0xa0, 0xff, 0x20, 0xff, 0xff, 0x82, 0xff, 0x9f, 0x0d, 0x00,
+        0x0e, 0x00, 0x00, 0x82, 0x01, 0x6f, 0xf8, 0xff, 0x20, 0xff, 0xff, 0x82, 0xff, 0xf8, 0x6e,
+        0x01, 0x0e, 0x00, 0x00, 0x81, 0x31, 0xde, 0x22, 0xff, 0xff, 0x81, 0xdd, 0x2f, 0x0d, 0x00,
+        0x00, 0x82, 0x00, 0x09, 0x9f, 0xff, 0x22, 0xff, 0xff, 0x82, 0xff, 0x9d, 0x09, 0x00, 0x0c,
+        0x00, 0x00, 0x82, 0x00, 0x54, 0xf1, 0xff, 0x22, 0xff, 0xff, 0x82, 0xff, 0xf1, 0x52, 0x00,
+        0x0c, 0x00, 0x00, 0x81, 0x13, 0xbd, 0x24, 0xff, 0xff, 0x81, 0xbd, 0x13, 0x0c, 0x00, 0x00,
+        0x81, 0x59, 0xf6, 0x24, 0xff, 0xff, 0x81, 0xf6, 0x59, 0x0b, 0x00, 0x00, 0x82, 0x00, 0x11,
+        0xba, 0xff, 0x24, 0xff, 0xff, 0x82, 0xff, 0xb7, 0x0f, 0x00, 0x0a, 0x00, 0x00, 0x82, 0x00,
+        0x53, 0xf5, 0xff, 0x05, 0xff, 0xff, 0x81, 0xfe, 0xff, 0x04, 0xff, 0xff, 0x81, 0xfe, 0xff,
+        0x19, 0xff, 0xff, 0x82, 0xff, 0xf3, 0x50, 0x00, 0x0a, 0x00, 0x00, 0x81, 0x07, 0xa3, 0x04,
+        0xff, 0xff, 0x81, 0xfe, 0xff, 0x21, 0xff, 0xff, 0x81, 0xa1, 0x06, 0x0a, 0x00, 0x00, 0x81,
+        0x2a, 0xe1, 0x26, 0xff, 0xff, 0x81, 0xdf, 0x28, 0x0a, 0x00, 0x00, 0x81, 0x6e, 0xfc, 0x26,
+        0xff, 0xff, 0x81, 0xfb, 0x6a, 0x09, 0x00, 0x00, 0x84, 0x00, 0x0c, 0xb2, 0xff, 0xff, 0xff,
+        0xff, 0xfe, 0x24, 0xff, 0xff, 0x82, 0xff, 0xb2, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x82, 0x00,
+        0x28, 0xe3, 0xff, 0x26, 0xff, 0xff, 0x82, 0xff, 0xe3, 0x28, 0x00, 0x08, 0x00, 0x00, 0x82,
+        0x00, 0x56, 0xf8, 0xff, 0x26, 0xff, 0xff, 0x82, 0xff, 0xf8, 0x55, 0x00, 0x08, 0x00, 0x00,
+        0x81, 0x00, 0x8c, 0x28, 0xff, 0xff, 0x81, 0x8c, 0x00, 0x08, 0x00, 0x00, 0x81, 0x0f, 0xba,
+        0x28, 0xff, 0xff, 0x81, 0xba, 0x0e, 0x08, 0x00, 0x00, 0x81, 0x21, 0xd8, 0x28, 0xff, 0xff,
+        0x81, 0xd6, 0x20, 0x08, 0x00, 0x00, 0x81, 0x36, 0xf1, 0x28, 0xff, 0xff, 0x81, 0xee, 0x31,
+        0x07, 0x00, 0x00, 0x82, 0x00, 0x03, 0x8b, 0xff, 0x28, 0xff, 0xff, 0x81, 0xf9, 0x4f, 0x07,
+        0x00, 0x00, 0x82, 0x00, 0x42, 0xeb, 0xff, 0x28, 0xff, 0xff, 0x81, 0xfd, 0x70, 0x07, 0x00,
+        0x00, 0x81, 0x0b, 0xad, 0x29, 0xff, 0xff, 0x81, 0xff, 0x84, 0x07, 0x00, 0x00, 0x81, 0x4b,
+        0xf3, 0x29, 0xff, 0xff, 0x81, 0xff, 0x95, 0x06, 0x00, 0x00, 0x82, 0x00, 0x07, 0xa8, 0xff,
+        0x29, 0xff, 0xff, 0x81, 0xff, 0x9f, 0x06, 0x00, 0x00, 0x82, 0x00, 0x33, 0xe8, 0xff, 0x29,
+        0xff, 0xff, 0x81, 0xff, 0xa5, 0x06, 0x00, 0x00, 0x81, 0x00, 0x73, 0x2a, 0xff, 0xff, 0x81,
+        0xff, 0xa5, 0x06, 0x00, 0x00, 0x81, 0x07, 0xb9, 0x2a, 0xff, 0xff, 0x81, 0xff, 0x9f, 0x06,
+        0x00, 0x00, 0x81, 0x25, 0xdb, 0x2a, 0xff, 0xff, 0x81, 0xff, 0x95, 0x06, 0x00, 0x00, 0x81,
+        0x4e, 0xfa, 0x2a, 0xff, 0xff, 0x81, 0xff, 0x84, 0x06, 0x00, 0x00, 0x81, 0x67, 0xff, 0x2a,
+        0xff, 0xff, 0x81, 0xfd, 0x70, 0x06, 0x00, 0x00, 0x81, 0x82, 0xff, 0x2a, 0xff, 0xff, 0x81,
+        0xf9, 0x4f, 0x05, 0x00, 0x00, 0x82, 0x00, 0x03, 0x9c, 0xff, 0x2a, 0xff, 0xff, 0x81, 0xed,
+        0x31, 0x05, 0x00, 0x00, 0x82, 0x00, 0x06, 0xb1, 0xff, 0x2a, 0xff, 0xff, 0x81, 0xd7, 0x20,
+        0x05, 0x00, 0x00, 0x82, 0x00, 0x06, 0xb2, 0xff, 0x2a, 0xff, 0xff, 0x81, 0xba, 0x0f, 0x05,
+        0x00, 0x00, 0x82, 0x00, 0x04, 0xa2, 0xff, 0x2a, 0xff, 0xff, 0x81, 0x8b, 0x00, 0x05, 0x00,
+        0x00, 0x82, 0x00, 0x02, 0x93, 0xff, 0x29, 0xff, 0xff, 0x82, 0xff, 0xf8, 0x54, 0x00, 0x06,
+        0x00, 0x00, 0x81, 0x76, 0xff, 0x29, 0xff, 0xff, 0x82, 0xff, 0xe1, 0x27, 0x00, 0x06, 0x00,
+        0x00, 0x81, 0x5e, 0xff, 0x29, 0xff, 0xff, 0x82, 0xff, 0xb1, 0x0c, 0x00, 0x06, 0x00, 0x00,
+        0x81, 0x41, 0xf1, 0x29, 0xff, 0xff, 0x81, 0xfb, 0x6b, 0x07, 0x00, 0x00, 0x81, 0x17, 0xd0,
+        0x29, 0xff, 0xff, 0x81, 0xe0, 0x29, 0x07, 0x00, 0x00, 0x81, 0x03, 0xa2, 0x29, 0xff, 0xff,
+        0x81, 0xa0, 0x06, 0x07, 0x00, 0x00, 0x82, 0x00, 0x58, 0xfc, 0xff, 0x27, 0xff, 0xff, 0x82,
+        0xff, 0xf4, 0x50, 0x00, 0x07, 0x00, 0x00, 0x82, 0x00, 0x1f, 0xd4, 0xff, 0x27, 0xff, 0xff,
+        0x82, 0xff, 0xb8, 0x10, 0x00, 0x08, 0x00, 0x00, 0x81, 0x87, 0xff, 0x27, 0xff, 0xff, 0x81,
+        0xf7, 0x5a, 0x09, 0x00, 0x00, 0x81, 0x2f, 0xe2, 0x27, 0xff, 0xff, 0x81, 0xbc, 0x12, 0x09,
+        0x00, 0x00, 0x81, 0x01, 0x87, 0x26, 0xff, 0xff, 0x82, 0xff, 0xf1, 0x53, 0x00, 0x09, 0x00,
+        0x00, 0x82, 0x00, 0x22, 0xd1, 0xff, 0x25, 0xff, 0xff, 0x82, 0xff, 0x9d, 0x09, 0x00, 0x0a,
+        0x00, 0x00, 0x81, 0x59, 0xf2, 0x25, 0xff, 0xff, 0x81, 0xdd, 0x31, 0x0b, 0x00, 0x00, 0x82,
+        0x05, 0x8a, 0xfd, 0xff, 0x23, 0xff, 0xff, 0x82, 0xff, 0xf8, 0x6e, 0x01, 0x0b, 0x00, 0x00,
+        0x82, 0x00, 0x16, 0xae, 0xff, 0x23, 0xff, 0xff, 0x82, 0xff, 0x9f, 0x0d, 0x00, 0x0c, 0x00,
+        0x00, 0x81, 0x1f, 0xba, 0x23, 0xff, 0xff, 0x81, 0xc8, 0x24, 0x0d, 0x00, 0x00, 0x82, 0x00,
+        0x24, 0xb6, 0xff, 0x21, 0xff, 0xff, 0x82, 0xff, 0xe2, 0x44, 0x00, 0x0e, 0x00, 0x00, 0x82,
+        0x1c, 0xa0, 0xf9, 0xff, 0x20, 0xff, 0xff, 0x81, 0xe9, 0x58, 0x0f, 0x00, 0x00, 0x82, 0x00,
+        0x0e, 0x78, 0xe8, 0x1f, 0xff, 0xff, 0x82, 0xff, 0xf0, 0x65, 0x01, 0x10, 0x00, 0x00, 0x82,
+        0x02, 0x3f, 0xb6, 0xf9, 0x1e, 0xff, 0xff, 0x82, 0xf0, 0x72, 0x04, 0x00, 0x11, 0x00, 0x00,
+        0x82, 0x12, 0x61, 0xc2, 0xf8, 0x1c, 0xff, 0xff, 0x82, 0xff, 0xe9, 0x65, 0x04, 0x13, 0x00,
+        0x00, 0x83, 0x14, 0x56, 0xa8, 0xe0, 0xfe, 0xff, 0x1a, 0xff, 0xff, 0x82, 0xe2, 0x58, 0x01,
+        0x00, 0x14, 0x00, 0x00, 0x83, 0x05, 0x2b, 0x5c, 0x96, 0xd9, 0xff, 0x18, 0xff, 0xff, 0x82,
+        0xff, 0xc8, 0x44, 0x00, 0x16, 0x00, 0x00, 0x83, 0x00, 0x01, 0x27, 0xa0, 0xf8, 0xff, 0x16,
+        0xff, 0xff, 0x82, 0xff, 0xf8, 0x9f, 0x24, 0x18, 0x00, 0x00, 0x82, 0x00, 0x0d, 0x6e, 0xde,
+        0x16, 0xff, 0xff, 0x82, 0xdd, 0x6e, 0x0d, 0x00, 0x19, 0x00, 0x00, 0x82, 0x01, 0x31, 0x9d,
+        0xf1, 0x14, 0xff, 0xff, 0x82, 0xf1, 0x9d, 0x31, 0x01, 0x1b, 0x00, 0x00, 0x82, 0x09, 0x53,
+        0xbc, 0xf7, 0x12, 0xff, 0xff, 0x82, 0xf7, 0xbc, 0x53, 0x09, 0x1d, 0x00, 0x00, 0x82, 0x12,
+        0x5b, 0xb9, 0xf4, 0x10, 0xff, 0xff, 0x82, 0xf4, 0xb8, 0x5a, 0x12, 0x1f, 0x00, 0x00, 0x83,
+        0x11, 0x51, 0xa3, 0xe1, 0xfc, 0xff, 0x0c, 0xff, 0xff, 0x83, 0xff, 0xfc, 0xe1, 0xa1, 0x51,
+        0x10, 0x21, 0x00, 0x00, 0x83, 0x07, 0x2a, 0x6c, 0xb1, 0xe2, 0xf8, 0x0a, 0xff, 0xff, 0x83,
+        0xf8, 0xe2, 0xb1, 0x6c, 0x2a, 0x06, 0x23, 0x00, 0x00, 0x85, 0x00, 0x0c, 0x27, 0x56, 0x8d,
+        0xba, 0xd8, 0xee, 0xf9, 0xfd, 0x04, 0xff, 0xff, 0x85, 0xfd, 0xf9, 0xee, 0xd8, 0xbb, 0x8c,
+        0x54, 0x27, 0x0c, 0x00, 0x26, 0x00, 0x00, 0x8a, 0x00, 0x0f, 0x21, 0x31, 0x50, 0x72, 0x86,
+        0x96, 0xa0, 0xa5, 0xa5, 0xa0, 0x96, 0x86, 0x72, 0x50, 0x31, 0x21, 0x0f, 0x00, 0x7f, 0x00,
+        0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x27, 0x00, 0x00,
 
 };
 
 const lv_image_dsc_t image_partly_cloudy = {
     .header.magic = LV_IMAGE_HEADER_MAGIC,
     .header.cf = LV_COLOR_FORMAT_RGB565A8,
-    .header.flags = 0,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
     .header.w = 100,
     .header.h = 100,
     .header.stride = 200,
@@ -0,0 +1,234 @@
+// Generated by tools/flatten_images.py from image_blizzard.c: pre-blended onto the
+// main screen gradient at y = 4. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_BLIZZARD_OPAQUE
+  #define LV_ATTRIBUTE_IMAGE_BLIZZARD_OPAQUE
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_BLIZZARD_OPAQUE uint8_t
+    image_blizzard_opaque_map[] = {
+
+        0x01, 0x00, 0x00, 0x00, 0x0b, 0x0b, 0x00, 0x00, 0x20, 0x4e, 0x00, 0x00, 0x7f, 0x90, 0x2a,
+        0x7f, 0x90, 0x2a, 0x7f, 0x90, 0x2a, 0x13, 0x90, 0x2a, 0x7f, 0x8f, 0x2a, 0x7f, 0x8f, 0x2a,
+        0x7f, 0x8f, 0x2a, 0x7f, 0x8f, 0x2a, 0x5c, 0x8f, 0x2a, 0x7f, 0x6f, 0x2a, 0x7f, 0x6f, 0x2a,
+        0x7f, 0x6f, 0x2a, 0x7f, 0x6f, 0x2a, 0x7f, 0x6f, 0x2a, 0x06, 0x6f, 0x2a, 0x81, 0xf0, 0x42,
+        0x04, 0x13, 0x6c, 0x84, 0x13, 0x64, 0x92, 0x53, 0xd0, 0x3a, 0x8f, 0x2a, 0x16, 0x6f, 0x2a,
+        0x82, 0x8f, 0x32, 0x92, 0x5b, 0x02, 0xb2, 0x5b, 0x82, 0x92, 0x5b, 0x8f, 0x32, 0x3f, 0x6f,
+        0x2a, 0x81, 0x13, 0x64, 0x05, 0x3c, 0xe7, 0x85, 0xdb, 0xd6, 0x39, 0xbe, 0x57, 0x9d, 0xf3,
+        0x63, 0xd0, 0x3a, 0x14, 0x6f, 0x2a, 0x82, 0xf0, 0x3a, 0xd7, 0xb5, 0x02, 0x18, 0xc6, 0x82,
+        0xd7, 0xb5, 0xf0, 0x3a, 0x3f, 0x6f, 0x2a, 0x81, 0xf3, 0x63, 0x08, 0x1c, 0xe7, 0x84, 0xdb,
+        0xde, 0xf8, 0xb5, 0x13, 0x64, 0x8f, 0x2a, 0x12, 0x6f, 0x2a, 0x82, 0xf0, 0x3a, 0xb6, 0xad,
+        0x02, 0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xf0, 0x3a, 0x3f, 0x6f, 0x2a, 0x81, 0xf3, 0x63, 0x0a,
+        0x1c, 0xe7, 0x83, 0xdb, 0xde, 0xf5, 0x8c, 0xaf, 0x32, 0x11, 0x6f, 0x2a, 0x82, 0xf0, 0x3a,
+        0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xf0, 0x3a, 0x3f, 0x6f, 0x2a, 0x81, 0xf3,
+        0x63, 0x0c, 0x1c, 0xe7, 0x82, 0x57, 0x9d, 0xaf, 0x32, 0x10, 0x6f, 0x2a, 0x82, 0xf0, 0x3a,
+        0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xf0, 0x3a, 0x3f, 0x6f, 0x2a, 0x81, 0xf3,
+        0x63, 0x0d, 0x1c, 0xe7, 0x82, 0xf5, 0x8c, 0x8f, 0x2a, 0x07, 0x6f, 0x2a, 0x83, 0xd0, 0x3a,
+        0x53, 0x74, 0x31, 0x4b, 0x05, 0x6f, 0x2a, 0x82, 0xf0, 0x3a, 0xb6, 0xad, 0x02, 0xf7, 0xbd,
+        0x82, 0xb6, 0xad, 0xf0, 0x3a, 0x05, 0x6f, 0x2a, 0x83, 0x31, 0x4b, 0x53, 0x74, 0xd0, 0x3a,
+        0x37, 0x6f, 0x2a, 0x81, 0xf3, 0x63, 0x0d, 0x1c, 0xe7, 0x82, 0xbb, 0xd6, 0xd3, 0x63, 0x07,
+        0x6f, 0x2a, 0x85, 0x53, 0x74, 0x18, 0xc6, 0x96, 0xad, 0x53, 0x74, 0xf0, 0x3a, 0x03, 0x6f,
+        0x2a, 0x82, 0xf0, 0x3a, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xf0, 0x3a, 0x03,
+        0x6f, 0x2a, 0x85, 0xf0, 0x3a, 0x53, 0x74, 0x96, 0xad, 0x18, 0xc6, 0x33, 0x74, 0x37, 0x6f,
+        0x2a, 0x81, 0xf3, 0x63, 0x0e, 0x1c, 0xe7, 0x82, 0xd8, 0xb5, 0xd0, 0x3a, 0x05, 0x6f, 0x2a,
+        0x82, 0x31, 0x4b, 0x96, 0xad, 0x02, 0xf7, 0xbd, 0x87, 0x18, 0xc6, 0x76, 0xa5, 0xd2, 0x63,
+        0xaf, 0x32, 0x6f, 0x2a, 0xf0, 0x3a, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x87, 0xb6, 0xad, 0xf0,
+        0x3a, 0x6f, 0x2a, 0xaf, 0x32, 0xd2, 0x63, 0x56, 0xa5, 0x18, 0xc6, 0x02, 0xf7, 0xbd, 0x82,
+        0x96, 0xad, 0x10, 0x43, 0x36, 0x6f, 0x2a, 0x82, 0xd2, 0x5b, 0x79, 0xc6, 0x03, 0x59, 0xc6,
+        0x82, 0x79, 0xc6, 0xdb, 0xde, 0x08, 0x1c, 0xe7, 0x82, 0xdb, 0xde, 0xf3, 0x63, 0x05, 0x6f,
+        0x2a, 0x81, 0x12, 0x6c, 0x06, 0xf7, 0xbd, 0x84, 0xf5, 0x94, 0x51, 0x53, 0x10, 0x43, 0xb6,
+        0xad, 0x02, 0xf7, 0xbd, 0x84, 0xb6, 0xad, 0x10, 0x43, 0x51, 0x53, 0xf5, 0x94, 0x06, 0xf7,
+        0xbd, 0x81, 0x12, 0x6c, 0x36, 0x6f, 0x2a, 0x81, 0x8f, 0x2a, 0x03, 0xf0, 0x3a, 0x84, 0xd0,
+        0x32, 0xf0, 0x3a, 0xd2, 0x63, 0xf8, 0xb5, 0x08, 0x1c, 0xe7, 0x82, 0x57, 0x9d, 0x8f, 0x2a,
+        0x04, 0x6f, 0x2a, 0x83, 0xaf, 0x32, 0xf2, 0x63, 0x35, 0xa5, 0x05, 0xf7, 0xbd, 0x83, 0xb7,
+        0xb5, 0xf5, 0x94, 0xd6, 0xb5, 0x02, 0xf7, 0xbd, 0x83, 0xd6, 0xb5, 0xf5, 0x94, 0xb7, 0xb5,
+        0x05, 0xf7, 0xbd, 0x83, 0x35, 0xa5, 0xd2, 0x63, 0xaf, 0x32, 0x3d, 0x6f, 0x2a, 0x82, 0x10,
+        0x43, 0xf9, 0xb5, 0x07, 0x1c, 0xe7, 0x82, 0x39, 0xbe, 0xd0, 0x3a, 0x06, 0x6f, 0x2a, 0x83,
+        0xf0, 0x3a, 0x53, 0x7c, 0x76, 0xad, 0x04, 0xf7, 0xbd, 0x81, 0x18, 0xc6, 0x09, 0xf7, 0xbd,
+        0x83, 0x76, 0xad, 0x32, 0x74, 0xf0, 0x3a, 0x40, 0x6f, 0x2a, 0x82, 0xd3, 0x63, 0xdb, 0xde,
+        0x06, 0x1c, 0xe7, 0x82, 0x9a, 0xce, 0x71, 0x53, 0x08, 0x6f, 0x2a, 0x83, 0x30, 0x4b, 0xb4,
+        0x8c, 0xd6, 0xb5, 0x0a, 0xf7, 0xbd, 0x83, 0xd6, 0xb5, 0xb4, 0x8c, 0x30, 0x4b, 0x42, 0x6f,
+        0x2a, 0x82, 0xf0, 0x3a, 0x9a, 0xce, 0x07, 0x1c, 0xe7, 0x81, 0xd3, 0x63, 0x09, 0x6f, 0x2a,
+        0x83, 0x8f, 0x32, 0x71, 0x53, 0x15, 0x9d, 0x08, 0xf7, 0xbd, 0x83, 0x15, 0x9d, 0x71, 0x53,
+        0x8f, 0x32, 0x43, 0x6f, 0x2a, 0x82, 0xf0, 0x3a, 0x7a, 0xce, 0x07, 0x1c, 0xe7, 0x81, 0xf3,
+        0x63, 0x0a, 0x6f, 0x2a, 0x82, 0xf0, 0x3a, 0xb4, 0x84, 0x08, 0xf7, 0xbd, 0x82, 0xb4, 0x84,
+        0xf0, 0x3a, 0x44, 0x6f, 0x2a, 0x82, 0x71, 0x53, 0xbb, 0xd6, 0x06, 0x1c, 0xe7, 0x82, 0xbb,
+        0xd6, 0x92, 0x53, 0x08, 0x6f, 0x2a, 0x84, 0xcf, 0x32, 0x13, 0x6c, 0x76, 0xad, 0x18, 0xc6,
+        0x08, 0xf7, 0xbd, 0x84, 0x18, 0xc6, 0x76, 0xad, 0x13, 0x6c, 0xcf, 0x32, 0x41, 0x6f, 0x2a,
+        0x82, 0x8f, 0x2a, 0x57, 0x9d, 0x07, 0x1c, 0xe7, 0x82, 0x59, 0xc6, 0x11, 0x43, 0x06, 0x6f,
+        0x2a, 0x84, 0x8f, 0x2a, 0x92, 0x5b, 0x35, 0x9d, 0x18, 0xc6, 0x0c, 0xf7, 0xbd, 0x84, 0x18,
+        0xc6, 0x35, 0x9d, 0x92, 0x5b, 0x8f, 0x2a, 0x3e, 0x6f, 0x2a, 0x83, 0xf0, 0x3a, 0x16, 0x8d,
+        0xfb, 0xde, 0x07, 0x1c, 0xe7, 0x82, 0x97, 0xa5, 0x8f, 0x2a, 0x05, 0x6f, 0x2a, 0x82, 0x51,
+        0x4b, 0xb4, 0x84, 0x06, 0xf7, 0xbd, 0x82, 0x56, 0xa5, 0xd6, 0xb5, 0x02, 0xf7, 0xbd, 0x82,
+        0xd6, 0xb5, 0x56, 0xa5, 0x06, 0xf7, 0xbd, 0x82, 0xd4, 0x8c, 0x31, 0x4b, 0x18, 0x6f, 0x2a,
+        0x81, 0x33, 0x6c, 0x24, 0x77, 0xa5, 0x81, 0x39, 0xbe, 0x09, 0x1c, 0xe7, 0x81, 0x54, 0x74,
+        0x05, 0x6f, 0x2a, 0x83, 0xb2, 0x63, 0xb7, 0xb5, 0x18, 0xc6, 0x04, 0xf7, 0xbd, 0x84, 0x76,
+        0xad, 0x12, 0x6c, 0x51, 0x53, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x84, 0xb6, 0xad, 0x51, 0x53,
+        0x12, 0x6c, 0x76, 0xad, 0x05, 0xf7, 0xbd, 0x82, 0xb7, 0xb5, 0xb2, 0x63, 0x0d, 0x6f, 0x2a,
+        0x0a, 0x6e, 0x2a, 0x81, 0x36, 0x95, 0x0e, 0x3c, 0xe7, 0x1f, 0x1c, 0xe7, 0x82, 0x59, 0xc6,
+        0x0f, 0x43, 0x05, 0x6e, 0x2a, 0x82, 0x70, 0x53, 0xd6, 0xb5, 0x03, 0xf7, 0xbd, 0x86, 0xb6,
+        0xad, 0x73, 0x84, 0x0f, 0x43, 0x6e, 0x2a, 0xef, 0x3a, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x86,
+        0xb6, 0xad, 0xef, 0x3a, 0x6e, 0x2a, 0x0f, 0x43, 0x73, 0x84, 0x96, 0xad, 0x03, 0xf7, 0xbd,
+        0x82, 0xd6, 0xb5, 0x70, 0x53, 0x0d, 0x6e, 0x2a, 0x0a, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x0e,
+        0x3c, 0xe7, 0x1f, 0x1c, 0xe7, 0x81, 0x74, 0x7c, 0x07, 0x4e, 0x2a, 0x85, 0xb3, 0x84, 0xf7,
+        0xbd, 0xd6, 0xb5, 0xd4, 0x8c, 0x30, 0x4b, 0x03, 0x4e, 0x2a, 0x82, 0xcf, 0x3a, 0xb6, 0xad,
+        0x02, 0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xcf, 0x3a, 0x03, 0x4e, 0x2a, 0x85, 0x30, 0x4b, 0xd4,
+        0x8c, 0xd6, 0xb5, 0xf7, 0xbd, 0x93, 0x84, 0x18, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x0e, 0x3c,
+        0xe7, 0x1e, 0x1c, 0xe7, 0x82, 0x97, 0xa5, 0xaf, 0x32, 0x07, 0x4e, 0x2a, 0x84, 0xef, 0x42,
+        0xf4, 0x94, 0x91, 0x5b, 0x6e, 0x32, 0x04, 0x4e, 0x2a, 0x82, 0xcf, 0x3a, 0xb6, 0xad, 0x02,
+        0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xcf, 0x3a, 0x04, 0x4e, 0x2a, 0x84, 0x6e, 0x32, 0xb1, 0x63,
+        0xf4, 0x94, 0x0f, 0x43, 0x18, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x0d, 0x3c, 0xe7, 0x1e, 0x1c,
+        0xe7, 0x82, 0x18, 0xb6, 0x10, 0x43, 0x09, 0x4e, 0x2a, 0x81, 0x6e, 0x32, 0x06, 0x4e, 0x2a,
+        0x82, 0xcf, 0x3a, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xcf, 0x3a, 0x06, 0x4e,
+        0x2a, 0x81, 0x6e, 0x32, 0x19, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x0d, 0x3c, 0xe7, 0x1d, 0x1c,
+        0xe7, 0x82, 0xb7, 0xad, 0x10, 0x4b, 0x11, 0x4e, 0x2a, 0x82, 0xcf, 0x3a, 0xb6, 0xad, 0x02,
+        0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xcf, 0x3a, 0x20, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x0d, 0x3c,
+        0xe7, 0x1b, 0x1c, 0xe7, 0x83, 0x79, 0xc6, 0xf5, 0x94, 0xcf, 0x3a, 0x12, 0x4e, 0x2a, 0x82,
+        0xcf, 0x3a, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xcf, 0x3a, 0x20, 0x4e, 0x2a,
+        0x81, 0x16, 0x95, 0x25, 0x1c, 0xe7, 0x85, 0xba, 0xd6, 0x38, 0xbe, 0x16, 0x95, 0x51, 0x53,
+        0x6e, 0x2a, 0x13, 0x4e, 0x2a, 0x82, 0xcf, 0x3a, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x82, 0xb6,
+        0xad, 0xcf, 0x3a, 0x20, 0x4e, 0x2a, 0x81, 0xf2, 0x6b, 0x23, 0x36, 0x9d, 0x84, 0xf5, 0x94,
+        0x94, 0x84, 0xb2, 0x5b, 0xcf, 0x3a, 0x16, 0x4e, 0x2a, 0x82, 0x8e, 0x32, 0x53, 0x7c, 0x02,
+        0x73, 0x84, 0x82, 0x53, 0x7c, 0x8e, 0x32, 0x7f, 0x4e, 0x2a, 0x7f, 0x4e, 0x2a, 0x4e, 0x4e,
+        0x2a, 0x81, 0xef, 0x42, 0x43, 0x51, 0x53, 0x82, 0x10, 0x43, 0x8e, 0x32, 0x1e, 0x4e, 0x2a,
+        0x82, 0xf5, 0x8c, 0x3c, 0xe7, 0x42, 0xfb, 0xde, 0x85, 0x9a, 0xce, 0xd8, 0xb5, 0xf5, 0x8c,
+        0x91, 0x5b, 0x8e, 0x32, 0x1b, 0x4e, 0x2a, 0x82, 0x36, 0x95, 0x3c, 0xe7, 0x45, 0x1c, 0xe7,
+        0x84, 0xdb, 0xde, 0xb8, 0xad, 0xd2, 0x63, 0x6e, 0x2a, 0x19, 0x4e, 0x2a, 0x81, 0xf5, 0x8c,
+        0x48, 0x1c, 0xe7, 0x83, 0xbb, 0xd6, 0xf5, 0x8c, 0xaf, 0x3a, 0x18, 0x4e, 0x2a, 0x81, 0xf5,
+        0x8c, 0x4a, 0x1c, 0xe7, 0x82, 0x57, 0xa5, 0xaf, 0x3a, 0x17, 0x4e, 0x2a, 0x81, 0xf5, 0x8c,
+        0x4b, 0x1c, 0xe7, 0x82, 0x36, 0x9d, 0x8e, 0x32, 0x16, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x4b,
+        0x1c, 0xe7, 0x82, 0xdb, 0xde, 0x54, 0x7c, 0x16, 0x4e, 0x2a, 0x81, 0x16, 0x95, 0x4c, 0x1c,
+        0xe7, 0x82, 0x59, 0xc6, 0xf0, 0x42, 0x15, 0x4e, 0x2a, 0x82, 0xd5, 0x8c, 0xfb, 0xde, 0x43,
+        0xba, 0xd6, 0x09, 0x1c, 0xe7, 0x81, 0xb5, 0x84, 0x15, 0x4e, 0x2a, 0x81, 0xcf, 0x3a, 0x43,
+        0x30, 0x4b, 0x82, 0xf2, 0x63, 0xb7, 0xad, 0x08, 0x1c, 0xe7, 0x82, 0xf8, 0xb5, 0xaf, 0x3a,
+        0x59, 0x4e, 0x2a, 0x82, 0xaf, 0x32, 0x76, 0xa5, 0x07, 0x1c, 0xe7, 0x82, 0xbb, 0xd6, 0x51,
+        0x53, 0x5a, 0x4e, 0x2a, 0x82, 0x30, 0x4b, 0x79, 0xc6, 0x06, 0x1c, 0xe7, 0x82, 0xdb, 0xde,
+        0x13, 0x6c, 0x5a, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0xd8, 0xb5, 0x07, 0x1c, 0xe7, 0x81, 0xd5,
+        0x8c, 0x14, 0x4e, 0x2a, 0x81, 0x13, 0x6c, 0x11, 0x77, 0xa5, 0x84, 0xf5, 0x8c, 0xf2, 0x63,
+        0x30, 0x4b, 0x6e, 0x2a, 0x15, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x53, 0x7c, 0x02, 0xf5, 0x94,
+        0x82, 0xd4, 0x8c, 0x10, 0x4b, 0x16, 0x4e, 0x2a, 0x81, 0xb8, 0xad, 0x07, 0x1c, 0xe7, 0x81,
+        0xd5, 0x8c, 0x14, 0x4e, 0x2a, 0x81, 0x16, 0x95, 0x12, 0x1c, 0xe7, 0x85, 0xfb, 0xde, 0xba,
+        0xce, 0x97, 0xa5, 0xf2, 0x63, 0x8e, 0x32, 0x14, 0x4e, 0x2a, 0x81, 0x56, 0xa5, 0x03, 0x18,
+        0xc6, 0x81, 0x91, 0x5b, 0x15, 0x4e, 0x2a, 0x82, 0x8e, 0x32, 0xf8, 0xb5, 0x07, 0x1c, 0xe7,
+        0x81, 0x94, 0x84, 0x14, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x15, 0x1c, 0xe7, 0x83, 0xfb, 0xde,
+        0x97, 0xa5, 0x51, 0x53, 0x13, 0x4e, 0x2a, 0x82, 0x35, 0x9d, 0x18, 0xc6, 0x02, 0xf7, 0xbd,
+        0x81, 0x71, 0x5b, 0x15, 0x4e, 0x2a, 0x82, 0xf2, 0x63, 0xdb, 0xde, 0x06, 0x1c, 0xe7, 0x82,
+        0xdb, 0xde, 0xb2, 0x5b, 0x0a, 0x4e, 0x2a, 0x0a, 0x2e, 0x2a, 0x81, 0xd5, 0x8c, 0x17, 0x1c,
+        0xe7, 0x82, 0x9a, 0xce, 0xd2, 0x63, 0x12, 0x2e, 0x2a, 0x81, 0x35, 0x9d, 0x03, 0xf7, 0xbd,
+        0x81, 0x71, 0x5b, 0x13, 0x2e, 0x2a, 0x83, 0x4e, 0x2a, 0x91, 0x5b, 0x39, 0xc6, 0x07, 0x1c,
+        0xe7, 0x82, 0x79, 0xc6, 0xd0, 0x42, 0x14, 0x2e, 0x2a, 0x81, 0xd5, 0x8c, 0x18, 0x1c, 0xe7,
+        0x82, 0x9a, 0xce, 0xb2, 0x63, 0x09, 0x2e, 0x2a, 0x82, 0x6e, 0x32, 0x4e, 0x2a, 0x06, 0x2e,
+        0x2a, 0x81, 0x35, 0x9d, 0x03, 0xf7, 0xbd, 0x81, 0x71, 0x5b, 0x06, 0x2e, 0x2a, 0x82, 0x6e,
+        0x32, 0x4e, 0x2a, 0x05, 0x2e, 0x2a, 0x82, 0x8f, 0x3a, 0x74, 0x7c, 0x04, 0xb5, 0x84, 0x82,
+        0x57, 0xa5, 0xbb, 0xd6, 0x08, 0x1c, 0xe7, 0x82, 0x36, 0x9d, 0x4e, 0x2a, 0x14, 0x2e, 0x2a,
+        0x81, 0xd5, 0x8c, 0x19, 0x1c, 0xe7, 0x82, 0x59, 0xc6, 0x31, 0x53, 0x07, 0x2e, 0x2a, 0x84,
+        0x8f, 0x32, 0xf4, 0x94, 0x73, 0x7c, 0xcf, 0x3a, 0x05, 0x2e, 0x2a, 0x81, 0x15, 0x9d, 0x03,
+        0xf7, 0xbd, 0x81, 0x71, 0x5b, 0x04, 0x2e, 0x2a, 0x84, 0x4e, 0x2a, 0x71, 0x5b, 0x35, 0x9d,
+        0xd2, 0x63, 0x05, 0x2e, 0x2a, 0x82, 0xf0, 0x42, 0xbb, 0xd6, 0x0d, 0x1c, 0xe7, 0x82, 0xdb,
+        0xde, 0xd2, 0x6b, 0x0b, 0x2e, 0x2a, 0x0a, 0x2d, 0x2a, 0x81, 0xd5, 0x8c, 0x1a, 0x1c, 0xe7,
+        0x82, 0x56, 0xa5, 0x4d, 0x2a, 0x06, 0x2d, 0x2a, 0x81, 0x12, 0x6c, 0x02, 0x18, 0xc6, 0x83,
+        0x96, 0xad, 0xf1, 0x6b, 0x8e, 0x32, 0x03, 0x2d, 0x2a, 0x81, 0x14, 0x9d, 0x03, 0xf7, 0xbd,
+        0x81, 0x70, 0x5b, 0x03, 0x2d, 0x2a, 0x86, 0x0f, 0x4b, 0xb3, 0x84, 0xd7, 0xb5, 0xf7, 0xbd,
+        0x55, 0xa5, 0xae, 0x3a, 0x04, 0x2d, 0x2a, 0x82, 0xef, 0x42, 0xbb, 0xd6, 0x0d, 0x1c, 0xe7,
+        0x82, 0x97, 0xa5, 0x6d, 0x32, 0x15, 0x2d, 0x2a, 0x81, 0x15, 0x95, 0x1a, 0x1c, 0xe7, 0x82,
+        0xbb, 0xd6, 0xb1, 0x63, 0x05, 0x2d, 0x2a, 0x82, 0xef, 0x42, 0x96, 0xad, 0x03, 0x18, 0xc6,
+        0x86, 0xf7, 0xbd, 0x35, 0x9d, 0x70, 0x5b, 0x4d, 0x2a, 0x2d, 0x2a, 0x14, 0x9d, 0x03, 0xf7,
+        0xbd, 0x86, 0x70, 0x5b, 0x2d, 0x2a, 0xae, 0x3a, 0x52, 0x7c, 0xb6, 0xb5, 0x18, 0xc6, 0x02,
+        0xf7, 0xbd, 0x82, 0x18, 0xc6, 0x52, 0x7c, 0x04, 0x2d, 0x2a, 0x82, 0xef, 0x42, 0xbb, 0xd6,
+        0x0c, 0x1c, 0xe7, 0x82, 0x79, 0xc6, 0x70, 0x53, 0x16, 0x2d, 0x2a, 0x81, 0xd2, 0x6b, 0x11,
+        0x36, 0x9d, 0x82, 0xb7, 0xad, 0xdb, 0xde, 0x08, 0x1c, 0xe7, 0x82, 0x56, 0xa5, 0x4d, 0x2a,
+        0x04, 0x2d, 0x2a, 0x83, 0xef, 0x42, 0x15, 0x9d, 0xf7, 0xbd, 0x04, 0x18, 0xc6, 0x84, 0xd7,
+        0xb5, 0xb3, 0x84, 0x0f, 0x4b, 0x14, 0x9d, 0x03, 0xf7, 0xbd, 0x02, 0xb1, 0x63, 0x82, 0x55,
+        0xa5, 0x18, 0xc6, 0x04, 0xf7, 0xbd, 0x83, 0xd6, 0xb5, 0x32, 0x7c, 0x4d, 0x2a, 0x03, 0x2d,
+        0x2a, 0x82, 0xef, 0x42, 0xbb, 0xd6, 0x0b, 0x1c, 0xe7, 0x82, 0xba, 0xd6, 0x12, 0x6c, 0x29,
+        0x2d, 0x2a, 0x83, 0x6d, 0x32, 0x12, 0x6c, 0x9a, 0xce, 0x07, 0x1c, 0xe7, 0x82, 0x7a, 0xce,
+        0xae, 0x3a, 0x05, 0x2d, 0x2a, 0x84, 0x8e, 0x3a, 0xf1, 0x73, 0x76, 0xad, 0xf7, 0xbd, 0x02,
+        0x18, 0xc6, 0x84, 0xf7, 0xbd, 0x18, 0xc6, 0xb6, 0xb5, 0xd7, 0xb5, 0x03, 0xf7, 0xbd, 0x81,
+        0x96, 0xad, 0x05, 0xf7, 0xbd, 0x83, 0xd6, 0xb5, 0xb4, 0x8c, 0x2f, 0x53, 0x05, 0x2d, 0x2a,
+        0x82, 0xef, 0x42, 0xbb, 0xd6, 0x0a, 0x1c, 0xe7, 0x83, 0x79, 0xc6, 0xf2, 0x6b, 0x4d, 0x2a,
+        0x0d, 0x2d, 0x2a, 0x1e, 0x2d, 0x22, 0x82, 0x33, 0x74, 0xdb, 0xde, 0x06, 0x1c, 0xe7, 0x82,
+        0xdb, 0xde, 0xb1, 0x5b, 0x07, 0x2d, 0x22, 0x83, 0xee, 0x3a, 0x93, 0x84, 0xb6, 0xad, 0x0d,
+        0xf7, 0xbd, 0x83, 0x35, 0xa5, 0xb0, 0x5b, 0x4d, 0x2a, 0x06, 0x2d, 0x22, 0x82, 0xef, 0x3a,
+        0xbb, 0xd6, 0x08, 0x1c, 0xe7, 0x83, 0xfb, 0xde, 0xd7, 0xad, 0x91, 0x53, 0x2d, 0x2d, 0x22,
+        0x82, 0x8e, 0x32, 0x19, 0xbe, 0x07, 0x1c, 0xe7, 0x81, 0x74, 0x7c, 0x09, 0x2d, 0x22, 0x83,
+        0x2f, 0x4b, 0xd4, 0x94, 0xd6, 0xb5, 0x09, 0xf7, 0xbd, 0x83, 0x76, 0xad, 0x12, 0x74, 0x8e,
+        0x32, 0x08, 0x2d, 0x22, 0x82, 0xef, 0x3a, 0xbb, 0xd6, 0x05, 0x1c, 0xe7, 0x85, 0xfb, 0xde,
+        0xba, 0xd6, 0xb7, 0xad, 0x33, 0x74, 0x8e, 0x32, 0x2f, 0x2d, 0x22, 0x81, 0xb7, 0xad, 0x07,
+        0x1c, 0xe7, 0x81, 0xd5, 0x8c, 0x0a, 0x2d, 0x22, 0x83, 0x4d, 0x2a, 0xd1, 0x63, 0xd6, 0xb5,
+        0x07, 0xf7, 0xbd, 0x82, 0x14, 0x95, 0xee, 0x3a, 0x0a, 0x2d, 0x22, 0x82, 0xae, 0x32, 0x77,
+        0xa5, 0x04, 0xb7, 0xad, 0x84, 0x36, 0x9d, 0x33, 0x74, 0x50, 0x53, 0x8e, 0x32, 0x30, 0x2d,
+        0x22, 0x82, 0x4d, 0x22, 0xb7, 0xad, 0x07, 0x1c, 0xe7, 0x81, 0xb4, 0x84, 0x09, 0x2d, 0x22,
+        0x83, 0x4d, 0x22, 0x30, 0x4b, 0xf4, 0x8c, 0x08, 0xf7, 0xbd, 0x83, 0x96, 0xad, 0x12, 0x6c,
+        0x8e, 0x2a, 0x0a, 0x2d, 0x22, 0x05, 0x4d, 0x22, 0x34, 0x2d, 0x22, 0x82, 0xef, 0x3a, 0x7a,
+        0xce, 0x06, 0x1c, 0xe7, 0x82, 0xdb, 0xde, 0x13, 0x6c, 0x08, 0x2d, 0x22, 0x84, 0xce, 0x3a,
+        0x93, 0x7c, 0xd7, 0xb5, 0x18, 0xc6, 0x09, 0xf7, 0xbd, 0x84, 0x18, 0xc6, 0x55, 0x9d, 0x91,
+        0x5b, 0x6d, 0x2a, 0x40, 0x2d, 0x22, 0x82, 0x6d, 0x2a, 0x56, 0x9d, 0x07, 0x1c, 0xe7, 0x82,
+        0xbb, 0xd6, 0x50, 0x53, 0x06, 0x2d, 0x22, 0x84, 0x8e, 0x2a, 0x12, 0x6c, 0x96, 0xad, 0x18,
+        0xc6, 0x0e, 0xf7, 0xbd, 0x82, 0xf4, 0x8c, 0x30, 0x4b, 0x38, 0x2d, 0x22, 0x82, 0x4d, 0x22,
+        0x8e, 0x32, 0x02, 0xcf, 0x3a, 0x85, 0x8e, 0x32, 0xce, 0x3a, 0x70, 0x53, 0x76, 0x9d, 0xdb,
+        0xde, 0x07, 0x1c, 0xe7, 0x82, 0xf8, 0xb5, 0x8e, 0x32, 0x04, 0x2d, 0x22, 0x84, 0x6d, 0x2a,
+        0x91, 0x5b, 0x55, 0x9d, 0x18, 0xc6, 0x04, 0xf7, 0xbd, 0x83, 0xd6, 0xb5, 0xb4, 0x8c, 0x75,
+        0xa5, 0x03, 0xf7, 0xbd, 0x82, 0xb4, 0x8c, 0x35, 0xa5, 0x05, 0xf7, 0xbd, 0x83, 0xb6, 0xb5,
+        0x73, 0x7c, 0xce, 0x3a, 0x36, 0x2d, 0x22, 0x83, 0xef, 0x3a, 0x59, 0xc6, 0xba, 0xce, 0x02,
+        0x9a, 0xce, 0x82, 0xba, 0xce, 0xbb, 0xd6, 0x09, 0x1c, 0xe7, 0x81, 0xd4, 0x84, 0x05, 0x2d,
+        0x22, 0x82, 0x30, 0x4b, 0xd7, 0xb5, 0x05, 0xf7, 0xbd, 0x84, 0xf4, 0x94, 0x70, 0x53, 0x6d,
+        0x2a, 0x14, 0x95, 0x03, 0xf7, 0xbd, 0x84, 0x70, 0x53, 0xae, 0x32, 0x52, 0x7c, 0x96, 0xad,
+        0x05, 0xf7, 0xbd, 0x81, 0xb4, 0x8c, 0x36, 0x2d, 0x22, 0x82, 0xef, 0x3a, 0xbb, 0xd6, 0x0d,
+        0x1c, 0xe7, 0x82, 0x59, 0xc6, 0xef, 0x42, 0x05, 0x2d, 0x22, 0x82, 0x6d, 0x2a, 0xf4, 0x94,
+        0x03, 0xf7, 0xbd, 0x83, 0x55, 0xa5, 0xd1, 0x63, 0x8e, 0x32, 0x02, 0x2d, 0x22, 0x81, 0x14,
+        0x95, 0x03, 0xf7, 0xbd, 0x81, 0x70, 0x53, 0x02, 0x2d, 0x22, 0x83, 0x0f, 0x4b, 0x93, 0x8c,
+        0xd6, 0xb5, 0x02, 0xf7, 0xbd, 0x82, 0xd6, 0xb5, 0x70, 0x5b, 0x36, 0x2d, 0x22, 0x82, 0xef,
+        0x3a, 0xbb, 0xd6, 0x0d, 0x1c, 0xe7, 0x81, 0x74, 0x7c, 0x07, 0x2d, 0x22, 0x85, 0x50, 0x4b,
+        0xd6, 0xb5, 0xb6, 0xad, 0x52, 0x7c, 0xce, 0x3a, 0x04, 0x2d, 0x22, 0x81, 0x14, 0x95, 0x03,
+        0xf7, 0xbd, 0x81, 0x70, 0x53, 0x03, 0x2d, 0x22, 0x86, 0x4d, 0x2a, 0x70, 0x53, 0x15, 0x9d,
+        0xf7, 0xbd, 0x93, 0x8c, 0x4d, 0x2a, 0x36, 0x2d, 0x22, 0x82, 0xef, 0x3a, 0xbb, 0xd6, 0x0c,
+        0x1c, 0xe7, 0x82, 0x76, 0x9d, 0x8e, 0x32, 0x08, 0x2d, 0x22, 0x82, 0xd1, 0x63, 0x0f, 0x4b,
+        0x06, 0x2d, 0x22, 0x81, 0x14, 0x95, 0x03, 0xf7, 0xbd, 0x81, 0x70, 0x53, 0x05, 0x2d, 0x22,
+        0x83, 0x8e, 0x32, 0xd1, 0x63, 0xef, 0x42, 0x37, 0x2d, 0x22, 0x82, 0xef, 0x3a, 0xbb, 0xd6,
+        0x0b, 0x1c, 0xe7, 0x82, 0xb7, 0xad, 0xcf, 0x3a, 0x11, 0x2d, 0x22, 0x81, 0x14, 0x95, 0x03,
+        0xf7, 0xbd, 0x81, 0x70, 0x53, 0x3f, 0x2d, 0x22, 0x82, 0xef, 0x3a, 0xbb, 0xd6, 0x0a, 0x1c,
+        0xe7, 0x82, 0x36, 0x9d, 0xcf, 0x3a, 0x12, 0x2d, 0x22, 0x81, 0x14, 0x95, 0x03, 0xf7, 0xbd,
+        0x81, 0x70, 0x53, 0x3f, 0x2d, 0x22, 0x82, 0xef, 0x3a, 0xbb, 0xd6, 0x08, 0x1c, 0xe7, 0x83,
+        0xf8, 0xb5, 0x33, 0x74, 0x6d, 0x2a, 0x13, 0x2d, 0x22, 0x81, 0x14, 0x95, 0x03, 0xf7, 0xbd,
+        0x81, 0x70, 0x53, 0x3f, 0x2d, 0x22, 0x82, 0xcf, 0x3a, 0x9a, 0xce, 0x04, 0xfb, 0xde, 0x85,
+        0x9a, 0xce, 0x18, 0xbe, 0x56, 0x9d, 0x12, 0x6c, 0xae, 0x32, 0x15, 0x2d, 0x22, 0x81, 0xf4,
+        0x94, 0x03, 0xd7, 0xbd, 0x81, 0x50, 0x53, 0x3f, 0x2d, 0x22, 0x82, 0x6d, 0x2a, 0x91, 0x53,
+        0x04, 0xb1, 0x5b, 0x83, 0x50, 0x53, 0xae, 0x32, 0x4d, 0x22, 0x17, 0x2d, 0x22, 0x81, 0x0f,
+        0x4b, 0x03, 0x50, 0x53, 0x81, 0x8e, 0x32, 0x7f, 0x2d, 0x22, 0x72, 0x2d, 0x22, 0x7f, 0x0d,
+        0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d,
+        0x22, 0x26, 0x0d, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c,
+        0x22, 0x5c, 0x0c, 0x22,
+
+};
+
+const lv_image_dsc_t image_blizzard_opaque = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
+    .header.w = 100,
+    .header.h = 100,
+    .header.stride = 200,
+    .header.reserved_2 = 0,
+    .data_size = sizeof(image_blizzard_opaque_map),
+    .data = image_blizzard_opaque_map,
+    .reserved = NULL,
+};
@@ -0,0 +1,163 @@
+// Generated by tools/flatten_images.py from image_blowing_snow.c: pre-blended onto the
+// main screen gradient at y = 4. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_BLOWING_SNOW_OPAQUE
+  #define LV_ATTRIBUTE_IMAGE_BLOWING_SNOW_OPAQUE
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_BLOWING_SNOW_OPAQUE uint8_t
+    image_blowing_snow_opaque_map[] = {
+
+        0x01, 0x00, 0x00, 0x00, 0xe9, 0x06, 0x00, 0x00, 0x20, 0x4e, 0x00, 0x00, 0x7f, 0x90, 0x2a,
+        0x7f, 0x90, 0x2a, 0x7f, 0x90, 0x2a, 0x13, 0x90, 0x2a, 0x7f, 0x8f, 0x2a, 0x7f, 0x8f, 0x2a,
+        0x7f, 0x8f, 0x2a, 0x7f, 0x8f, 0x2a, 0x5c, 0x8f, 0x2a, 0x7f, 0x6f, 0x2a, 0x7f, 0x6f, 0x2a,
+        0x7f, 0x6f, 0x2a, 0x7f, 0x6f, 0x2a, 0x7f, 0x6f, 0x2a, 0x7f, 0x6f, 0x2a, 0x7f, 0x6f, 0x2a,
+        0x7f, 0x6f, 0x2a, 0x7f, 0x6f, 0x2a, 0x62, 0x6f, 0x2a, 0x81, 0xaf, 0x32, 0x05, 0x31, 0x43,
+        0x82, 0xf0, 0x3a, 0x8f, 0x2a, 0x18, 0x6f, 0x2a, 0x04, 0xf0, 0x42, 0x40, 0x6f, 0x2a, 0x81,
+        0xd3, 0x63, 0x04, 0xdb, 0xd6, 0x86, 0xba, 0xce, 0x39, 0xbe, 0x77, 0xa5, 0x74, 0x7c, 0x31,
+        0x4b, 0x8f, 0x2a, 0x14, 0x6f, 0x2a, 0x82, 0xf0, 0x3a, 0x96, 0xad, 0x02, 0xd7, 0xb5, 0x82,
+        0x96, 0xad, 0xf0, 0x3a, 0x3f, 0x6f, 0x2a, 0x81, 0xf3, 0x63, 0x08, 0x1c, 0xe7, 0x83, 0x9a,
+        0xce, 0xf6, 0x8c, 0x11, 0x43, 0x13, 0x6f, 0x2a, 0x82, 0xf0, 0x3a, 0xb6, 0xad, 0x02, 0xf7,
+        0xbd, 0x82, 0xb6, 0xad, 0xf0, 0x3a, 0x3f, 0x6f, 0x2a, 0x81, 0xf3, 0x63, 0x0a, 0x1c, 0xe7,
+        0x82, 0x59, 0xc6, 0x33, 0x6c, 0x12, 0x6f, 0x2a, 0x82, 0xf0, 0x3a, 0xb6, 0xad, 0x02, 0xf7,
+        0xbd, 0x82, 0xb6, 0xad, 0xf0, 0x3a, 0x3f, 0x6f, 0x2a, 0x81, 0xf3, 0x63, 0x0b, 0x1c, 0xe7,
+        0x83, 0xbb, 0xd6, 0x95, 0x7c, 0x8f, 0x2a, 0x10, 0x6f, 0x2a, 0x82, 0xf0, 0x3a, 0xb6, 0xad,
+        0x02, 0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xf0, 0x3a, 0x3f, 0x6f, 0x2a, 0x81, 0xf3, 0x63, 0x0c,
+        0x1c, 0xe7, 0x82, 0xdb, 0xde, 0x33, 0x6c, 0x08, 0x6f, 0x2a, 0x83, 0x8f, 0x32, 0x92, 0x5b,
+        0xcf, 0x32, 0x05, 0x6f, 0x2a, 0x82, 0xf0, 0x3a, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x82, 0xb6,
+        0xad, 0xf0, 0x3a, 0x05, 0x6f, 0x2a, 0x83, 0xaf, 0x32, 0x91, 0x53, 0x8f, 0x32, 0x37, 0x6f,
+        0x2a, 0x81, 0xf3, 0x63, 0x0d, 0x1c, 0xe7, 0x82, 0x7a, 0xce, 0x71, 0x53, 0x07, 0x6f, 0x2a,
+        0x85, 0xd2, 0x63, 0xd7, 0xb5, 0x35, 0x9d, 0x92, 0x5b, 0x8f, 0x2a, 0x03, 0x6f, 0x2a, 0x82,
+        0xf0, 0x3a, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xf0, 0x3a, 0x03, 0x6f, 0x2a,
+        0x85, 0x8f, 0x2a, 0x92, 0x5b, 0x15, 0x9d, 0xd7, 0xb5, 0xd2, 0x63, 0x37, 0x6f, 0x2a, 0x81,
+        0xf3, 0x63, 0x0e, 0x1c, 0xe7, 0x82, 0x77, 0xa5, 0x8f, 0x2a, 0x05, 0x6f, 0x2a, 0x82, 0xf0,
+        0x3a, 0x36, 0x9d, 0x02, 0xf7, 0xbd, 0x83, 0xd7, 0xb5, 0xb4, 0x84, 0x31, 0x4b, 0x02, 0x6f,
+        0x2a, 0x82, 0xf0, 0x3a, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xf0, 0x3a, 0x02,
+        0x6f, 0x2a, 0x83, 0x31, 0x4b, 0xb4, 0x84, 0xd7, 0xb5, 0x02, 0xf7, 0xbd, 0x82, 0x36, 0x9d,
+        0xf0, 0x3a, 0x36, 0x6f, 0x2a, 0x81, 0xf3, 0x63, 0x05, 0xfb, 0xde, 0x09, 0x1c, 0xe7, 0x82,
+        0xbb, 0xd6, 0xb2, 0x5b, 0x05, 0x6f, 0x2a, 0x81, 0x13, 0x6c, 0x04, 0xf7, 0xbd, 0x83, 0x18,
+        0xc6, 0xd7, 0xb5, 0x54, 0x7c, 0x02, 0xf0, 0x3a, 0x81, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x81,
+        0xb6, 0xad, 0x02, 0xf0, 0x3a, 0x82, 0x54, 0x7c, 0xb7, 0xb5, 0x05, 0xf7, 0xbd, 0x81, 0x12,
+        0x6c, 0x36, 0x6f, 0x2a, 0x81, 0xd0, 0x32, 0x05, 0x92, 0x53, 0x82, 0xb5, 0x84, 0x79, 0xc6,
+        0x08, 0x1c, 0xe7, 0x81, 0xf6, 0x8c, 0x05, 0x6f, 0x2a, 0x83, 0xf0, 0x42, 0x94, 0x84, 0xb6,
+        0xad, 0x04, 0xf7, 0xbd, 0x84, 0x18, 0xc6, 0x56, 0xa5, 0x53, 0x7c, 0xb6, 0xad, 0x02, 0xf7,
+        0xbd, 0x84, 0xb6, 0xad, 0x53, 0x7c, 0x56, 0xa5, 0x18, 0xc6, 0x04, 0xf7, 0xbd, 0x83, 0x96,
+        0xad, 0x94, 0x84, 0xf0, 0x42, 0x3d, 0x6f, 0x2a, 0x82, 0x72, 0x53, 0x7a, 0xce, 0x07, 0x1c,
+        0xe7, 0x82, 0xf9, 0xb5, 0xaf, 0x32, 0x06, 0x6f, 0x2a, 0x83, 0x71, 0x53, 0xf5, 0x94, 0xd6,
+        0xb5, 0x04, 0xf7, 0xbd, 0x81, 0x18, 0xc6, 0x04, 0xf7, 0xbd, 0x81, 0x18, 0xc6, 0x04, 0xf7,
+        0xbd, 0x83, 0xd6, 0xb5, 0xf5, 0x94, 0x71, 0x53, 0x40, 0x6f, 0x2a, 0x82, 0x54, 0x74, 0xdb,
+        0xde, 0x06, 0x1c, 0xe7, 0x82, 0x9a, 0xce, 0x31, 0x4b, 0x07, 0x6f, 0x2a, 0x83, 0x8f, 0x32,
+        0xb1, 0x5b, 0x35, 0xa5, 0x0c, 0xf7, 0xbd, 0x83, 0x35, 0xa5, 0xb1, 0x5b, 0x8f, 0x32, 0x10,
+        0x6f, 0x2a, 0x31, 0x6e, 0x2a, 0x82, 0x10, 0x43, 0x9a, 0xce, 0x06, 0x1c, 0xe7, 0x82, 0xdb,
+        0xde, 0xd2, 0x63, 0x09, 0x6e, 0x2a, 0x83, 0xcf, 0x3a, 0x12, 0x74, 0x76, 0xad, 0x08, 0xf7,
+        0xbd, 0x83, 0x76, 0xad, 0x12, 0x74, 0xcf, 0x3a, 0x12, 0x6e, 0x2a, 0x31, 0x4e, 0x2a, 0x82,
+        0xaf, 0x3a, 0x7a, 0xce, 0x07, 0x1c, 0xe7, 0x81, 0xf2, 0x63, 0x0a, 0x4e, 0x2a, 0x82, 0x8e,
+        0x32, 0x73, 0x84, 0x08, 0xf7, 0xbd, 0x82, 0x73, 0x84, 0x8e, 0x32, 0x44, 0x4e, 0x2a, 0x82,
+        0x30, 0x4b, 0x9a, 0xce, 0x06, 0x1c, 0xe7, 0x82, 0xdb, 0xde, 0x91, 0x5b, 0x08, 0x4e, 0x2a,
+        0x84, 0x6e, 0x2a, 0x50, 0x53, 0xf4, 0x94, 0xd7, 0xb5, 0x08, 0xf7, 0xbd, 0x84, 0xd7, 0xb5,
+        0xf4, 0x94, 0x50, 0x53, 0x6e, 0x2a, 0x42, 0x4e, 0x2a, 0x81, 0xb5, 0x84, 0x07, 0x1c, 0xe7,
+        0x82, 0x7a, 0xce, 0x10, 0x4b, 0x07, 0x4e, 0x2a, 0x84, 0xef, 0x42, 0x73, 0x7c, 0xb7, 0xb5,
+        0x18, 0xc6, 0x0b, 0xf7, 0xbd, 0x83, 0xb7, 0xb5, 0x73, 0x7c, 0xef, 0x42, 0x3f, 0x4e, 0x2a,
+        0x83, 0x6e, 0x2a, 0x13, 0x6c, 0xba, 0xce, 0x07, 0x1c, 0xe7, 0x82, 0xb7, 0xad, 0x8e, 0x32,
+        0x05, 0x4e, 0x2a, 0x84, 0xaf, 0x32, 0x33, 0x74, 0x96, 0xad, 0x18, 0xc6, 0x04, 0xf7, 0xbd,
+        0x81, 0xd6, 0xb5, 0x04, 0xf7, 0xbd, 0x81, 0xd6, 0xb5, 0x05, 0xf7, 0xbd, 0x83, 0x76, 0xad,
+        0xf2, 0x6b, 0xaf, 0x32, 0x18, 0x4e, 0x2a, 0x81, 0x91, 0x5b, 0x22, 0x74, 0x7c, 0x84, 0x54,
+        0x74, 0x74, 0x7c, 0x77, 0xa5, 0xdb, 0xd6, 0x08, 0x1c, 0xe7, 0x81, 0x94, 0x84, 0x05, 0x4e,
+        0x2a, 0x83, 0x71, 0x53, 0x35, 0x9d, 0x18, 0xc6, 0x04, 0xf7, 0xbd, 0x84, 0xd6, 0xb5, 0xb4,
+        0x8c, 0xb1, 0x63, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x84, 0xb6, 0xad, 0xb1, 0x63, 0xb4, 0x8c,
+        0xb6, 0xb5, 0x04, 0xf7, 0xbd, 0x83, 0x18, 0xc6, 0x35, 0x9d, 0x50, 0x53, 0x17, 0x4e, 0x2a,
+        0x81, 0x36, 0x95, 0x24, 0x3c, 0xe7, 0x09, 0x1c, 0xe7, 0x82, 0x9a, 0xce, 0x30, 0x4b, 0x05,
+        0x4e, 0x2a, 0x81, 0xb1, 0x63, 0x05, 0xf7, 0xbd, 0x85, 0x15, 0x9d, 0x91, 0x5b, 0x6e, 0x32,
+        0xcf, 0x3a, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x85, 0xb6, 0xad, 0xcf, 0x3a, 0x6e, 0x32, 0x91,
+        0x5b, 0x15, 0x9d, 0x05, 0xf7, 0xbd, 0x81, 0xb1, 0x63, 0x17, 0x4e, 0x2a, 0x81, 0xf5, 0x8c,
+        0x0c, 0x3c, 0xe7, 0x21, 0x1c, 0xe7, 0x82, 0xd5, 0x8c, 0x6e, 0x2a, 0x05, 0x4e, 0x2a, 0x82,
+        0x8e, 0x32, 0xf4, 0x94, 0x02, 0xf7, 0xbd, 0x83, 0x55, 0xa5, 0xf2, 0x6b, 0xaf, 0x3a, 0x02,
+        0x4e, 0x2a, 0x82, 0xcf, 0x3a, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xcf, 0x3a,
+        0x02, 0x4e, 0x2a, 0x83, 0xaf, 0x3a, 0xf2, 0x6b, 0x55, 0xa5, 0x02, 0xf7, 0xbd, 0x82, 0xf4,
+        0x94, 0x8e, 0x32, 0x17, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x0c, 0x3c, 0xe7, 0x20, 0x1c, 0xe7,
+        0x82, 0x38, 0xbe, 0xef, 0x42, 0x07, 0x4e, 0x2a, 0x84, 0x50, 0x53, 0x55, 0xa5, 0x73, 0x84,
+        0xef, 0x42, 0x04, 0x4e, 0x2a, 0x82, 0xcf, 0x3a, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x82, 0xb6,
+        0xad, 0xcf, 0x3a, 0x04, 0x4e, 0x2a, 0x84, 0xef, 0x42, 0x53, 0x7c, 0x55, 0xa5, 0x50, 0x53,
+        0x18, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x0b, 0x3c, 0xe7, 0x20, 0x1c, 0xe7, 0x82, 0x79, 0xc6,
+        0x91, 0x5b, 0x09, 0x4e, 0x2a, 0x81, 0xef, 0x42, 0x06, 0x4e, 0x2a, 0x82, 0xcf, 0x3a, 0xb6,
+        0xad, 0x02, 0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xcf, 0x3a, 0x06, 0x4e, 0x2a, 0x81, 0xef, 0x42,
+        0x19, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x0b, 0x3c, 0xe7, 0x1f, 0x1c, 0xe7, 0x82, 0x59, 0xc6,
+        0xd2, 0x63, 0x11, 0x4e, 0x2a, 0x82, 0xcf, 0x3a, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x82, 0xb6,
+        0xad, 0xcf, 0x3a, 0x20, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x0a, 0x3c, 0xe7, 0x1e, 0x1c, 0xe7,
+        0x83, 0xdb, 0xde, 0xb7, 0xad, 0x71, 0x53, 0x12, 0x4e, 0x2a, 0x82, 0xcf, 0x3a, 0xb6, 0xad,
+        0x02, 0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xcf, 0x3a, 0x20, 0x4e, 0x2a, 0x81, 0x36, 0x95, 0x09,
+        0x3c, 0xe7, 0x1d, 0x1c, 0xe7, 0x84, 0xbb, 0xd6, 0xf8, 0xb5, 0x33, 0x74, 0xaf, 0x32, 0x13,
+        0x4e, 0x2a, 0x82, 0xcf, 0x3a, 0xb6, 0xad, 0x02, 0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xcf, 0x3a,
+        0x20, 0x4e, 0x2a, 0x81, 0x94, 0x84, 0x23, 0x18, 0xbe, 0x85, 0xf8, 0xb5, 0x56, 0xa5, 0x74,
+        0x7c, 0x71, 0x53, 0xaf, 0x32, 0x15, 0x4e, 0x2a, 0x82, 0xaf, 0x3a, 0xf5, 0x9c, 0x02, 0x35,
+        0xa5, 0x82, 0xf5, 0x9c, 0xaf, 0x3a, 0x20, 0x4e, 0x2a, 0x81, 0x6e, 0x2a, 0x24, 0x8e, 0x32,
+        0x81, 0x6e, 0x2a, 0x19, 0x4e, 0x2a, 0x04, 0x6e, 0x32, 0x7f, 0x4e, 0x2a, 0x6a, 0x4e, 0x2a,
+        0x81, 0x6e, 0x2a, 0x43, 0x8e, 0x32, 0x81, 0x6e, 0x2a, 0x1f, 0x4e, 0x2a, 0x81, 0xb5, 0x84,
+        0x43, 0x59, 0xc6, 0x84, 0xd8, 0xad, 0xd5, 0x8c, 0x13, 0x6c, 0xcf, 0x3a, 0x1c, 0x4e, 0x2a,
+        0x81, 0x16, 0x95, 0x45, 0x1c, 0xe7, 0x84, 0xdb, 0xde, 0x59, 0xc6, 0xd5, 0x8c, 0x10, 0x43,
+        0x1a, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x48, 0x1c, 0xe7, 0x83, 0x59, 0xc6, 0x13, 0x6c, 0x6e,
+        0x2a, 0x18, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x49, 0x1c, 0xe7, 0x83, 0xbb, 0xd6, 0xb5, 0x84,
+        0x6e, 0x2a, 0x17, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x4a, 0x1c, 0xe7, 0x82, 0xdb, 0xde, 0x74,
+        0x7c, 0x17, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x4b, 0x1c, 0xe7, 0x82, 0xbb, 0xd6, 0xd2, 0x63,
+        0x16, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x4c, 0x1c, 0xe7, 0x82, 0xd8, 0xb5, 0xaf, 0x3a, 0x15,
+        0x4e, 0x2a, 0x81, 0x16, 0x95, 0x22, 0x1c, 0xe7, 0x21, 0xfb, 0xde, 0x09, 0x1c, 0xe7, 0x82,
+        0xdb, 0xde, 0x33, 0x74, 0x15, 0x4e, 0x2a, 0x81, 0x51, 0x53, 0x41, 0x33, 0x74, 0x84, 0x12,
+        0x6c, 0x33, 0x74, 0xd5, 0x8c, 0x59, 0xc6, 0x08, 0x1c, 0xe7, 0x82, 0x76, 0xa5, 0x8e, 0x32,
+        0x0a, 0x4e, 0x2a, 0x4f, 0x2e, 0x2a, 0x82, 0x10, 0x4b, 0xf8, 0xb5, 0x07, 0x1c, 0xe7, 0x82,
+        0x9a, 0xce, 0x10, 0x4b, 0x5a, 0x2e, 0x2a, 0x82, 0x92, 0x5b, 0xbb, 0xd6, 0x06, 0x1c, 0xe7,
+        0x82, 0xdb, 0xde, 0xd2, 0x63, 0x5a, 0x2e, 0x2a, 0x82, 0x6e, 0x32, 0xd8, 0xb5, 0x07, 0x1c,
+        0xe7, 0x81, 0x95, 0x84, 0x0a, 0x2e, 0x2a, 0x51, 0x2d, 0x2a, 0x81, 0xb7, 0xad, 0x07, 0x1c,
+        0xe7, 0x81, 0xd5, 0x8c, 0x5a, 0x2d, 0x2a, 0x82, 0x4d, 0x2a, 0xd8, 0xb5, 0x07, 0x1c, 0xe7,
+        0x81, 0xb4, 0x8c, 0x5a, 0x2d, 0x2a, 0x82, 0x70, 0x53, 0x9a, 0xce, 0x06, 0x1c, 0xe7, 0x82,
+        0xdb, 0xde, 0xf2, 0x6b, 0x59, 0x2d, 0x2a, 0x82, 0xef, 0x42, 0xd8, 0xb5, 0x07, 0x1c, 0xe7,
+        0x82, 0xbb, 0xd6, 0xef, 0x4a, 0x0a, 0x2d, 0x2a, 0x48, 0x2d, 0x22, 0x82, 0x4d, 0x22, 0x71,
+        0x53, 0x03, 0x91, 0x5b, 0x83, 0x91, 0x53, 0x53, 0x74, 0x19, 0xbe, 0x08, 0x1c, 0xe7, 0x82,
+        0xb7, 0xad, 0x6d, 0x2a, 0x52, 0x2d, 0x22, 0x82, 0xef, 0x3a, 0xbb, 0xd6, 0x0e, 0x1c, 0xe7,
+        0x81, 0x53, 0x74, 0x53, 0x2d, 0x22, 0x82, 0xef, 0x3a, 0xbb, 0xd6, 0x0d, 0x1c, 0xe7, 0x82,
+        0xf8, 0xb5, 0xae, 0x32, 0x53, 0x2d, 0x22, 0x82, 0xef, 0x3a, 0xbb, 0xd6, 0x0c, 0x1c, 0xe7,
+        0x82, 0xdb, 0xde, 0x12, 0x6c, 0x54, 0x2d, 0x22, 0x82, 0xef, 0x3a, 0xbb, 0xd6, 0x0b, 0x1c,
+        0xe7, 0x83, 0xfb, 0xde, 0xb4, 0x84, 0x4d, 0x22, 0x54, 0x2d, 0x22, 0x82, 0xef, 0x3a, 0xbb,
+        0xd6, 0x0a, 0x1c, 0xe7, 0x83, 0xdb, 0xde, 0xd5, 0x8c, 0x6d, 0x2a, 0x55, 0x2d, 0x22, 0x82,
+        0xef, 0x3a, 0xbb, 0xd6, 0x09, 0x1c, 0xe7, 0x83, 0x79, 0xc6, 0x74, 0x7c, 0x6d, 0x2a, 0x56,
+        0x2d, 0x22, 0x82, 0xef, 0x3a, 0xbb, 0xd6, 0x06, 0x1c, 0xe7, 0x84, 0xfb, 0xde, 0x7a, 0xce,
+        0x36, 0x9d, 0x50, 0x4b, 0x58, 0x2d, 0x22, 0x82, 0xcf, 0x3a, 0x39, 0xc6, 0x03, 0x7a, 0xce,
+        0x86, 0x59, 0xc6, 0x18, 0xbe, 0x56, 0x9d, 0x73, 0x7c, 0x0f, 0x43, 0x4d, 0x22, 0x59, 0x2d,
+        0x22, 0x81, 0x4d, 0x22, 0x04, 0xcf, 0x3a, 0x83, 0xce, 0x3a, 0xae, 0x32, 0x4d, 0x22, 0x7f,
+        0x2d, 0x22, 0x7f, 0x2d, 0x22, 0x7f, 0x2d, 0x22, 0x7f, 0x2d, 0x22, 0x7f, 0x2d, 0x22, 0x7f,
+        0x2d, 0x22, 0x3a, 0x2d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f,
+        0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x26, 0x0d, 0x22, 0x7f, 0x0c, 0x22, 0x7f,
+        0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x5c, 0x0c, 0x22,
+
+};
+
+const lv_image_dsc_t image_blowing_snow_opaque = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
+    .header.w = 100,
+    .header.h = 100,
+    .header.stride = 200,
+    .header.reserved_2 = 0,
+    .data_size = sizeof(image_blowing_snow_opaque_map),
+    .data = image_blowing_snow_opaque_map,
+    .reserved = NULL,
+};
@@ -0,0 +1,153 @@
+// Generated by tools/flatten_images.py from image_clear_night.c: pre-blended onto the
+// main screen gradient at y = 4. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_CLEAR_NIGHT_OPAQUE
+  #define LV_ATTRIBUTE_IMAGE_CLEAR_NIGHT_OPAQUE
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_CLEAR_NIGHT_OPAQUE uint8_t
+    image_clear_night_opaque_map[] = {
+
+        0x01, 0x00, 0x00, 0x00, 0x56, 0x06, 0x00, 0x00, 0x20, 0x4e, 0x00, 0x00, 0x7f, 0x90, 0x2a,
+        0x7f, 0x90, 0x2a, 0x7f, 0x90, 0x2a, 0x13, 0x90, 0x2a, 0x7f, 0x8f, 0x2a, 0x7f, 0x8f, 0x2a,
+        0x7f, 0x8f, 0x2a, 0x3d, 0x8f, 0x2a, 0x87, 0xf0, 0x32, 0x52, 0x43, 0xb3, 0x53, 0x14, 0x5c,
+        0x76, 0x6c, 0x96, 0x74, 0x11, 0x3b, 0x59, 0x8f, 0x2a, 0x86, 0xf0, 0x32, 0xb3, 0x53, 0xd7,
+        0x7c, 0x79, 0x95, 0xfb, 0xa5, 0x7d, 0xbe, 0x02, 0xbe, 0xc6, 0x83, 0xff, 0xce, 0x59, 0x8d,
+        0xaf, 0x2a, 0x33, 0x8f, 0x2a, 0x23, 0x6f, 0x2a, 0x85, 0xd0, 0x32, 0xf4, 0x5b, 0x18, 0x8d,
+        0x1c, 0xae, 0x9e, 0xbe, 0x06, 0xff, 0xce, 0x82, 0x5d, 0xb6, 0x52, 0x43, 0x54, 0x6f, 0x2a,
+        0x85, 0x8f, 0x2a, 0x52, 0x4b, 0xb7, 0x7c, 0x1c, 0xae, 0xbe, 0xc6, 0x09, 0xff, 0xce, 0x81,
+        0xd8, 0x7c, 0x53, 0x6f, 0x2a, 0x84, 0x8f, 0x2a, 0x93, 0x53, 0x59, 0x95, 0x7d, 0xbe, 0x0b,
+        0xff, 0xce, 0x82, 0x3d, 0xb6, 0x31, 0x43, 0x52, 0x6f, 0x2a, 0x83, 0x52, 0x4b, 0x39, 0x8d,
+        0x9e, 0xbe, 0x0d, 0xff, 0xce, 0x81, 0xf8, 0x84, 0x51, 0x6f, 0x2a, 0x83, 0xd0, 0x32, 0xd7,
+        0x7c, 0x7d, 0xbe, 0x0e, 0xff, 0xce, 0x82, 0x9e, 0xbe, 0x73, 0x53, 0x4f, 0x6f, 0x2a, 0x83,
+        0x8f, 0x2a, 0xd4, 0x5b, 0xdb, 0xa5, 0x10, 0xff, 0xce, 0x82, 0x7a, 0x95, 0x8f, 0x2a, 0x4e,
+        0x6f, 0x2a, 0x83, 0xb0, 0x32, 0xd7, 0x7c, 0x9e, 0xbe, 0x11, 0xff, 0xce, 0x81, 0x15, 0x64,
+        0x4e, 0x6f, 0x2a, 0x82, 0x32, 0x43, 0x7a, 0x95, 0x12, 0xff, 0xce, 0x82, 0x3c, 0xae, 0xf1,
+        0x3a, 0x4d, 0x6f, 0x2a, 0x82, 0x93, 0x53, 0x1c, 0xae, 0x13, 0xff, 0xce, 0x81, 0x39, 0x8d,
+        0x4d, 0x6f, 0x2a, 0x82, 0xd4, 0x5b, 0x5d, 0xb6, 0x14, 0xff, 0xce, 0x81, 0xf4, 0x5b, 0x4c,
+        0x6f, 0x2a, 0x82, 0xd4, 0x5b, 0x7d, 0xbe, 0x14, 0xff, 0xce, 0x82, 0x7d, 0xbe, 0x32, 0x43,
+        0x4b, 0x6f, 0x2a, 0x82, 0xd4, 0x5b, 0x7d, 0xbe, 0x15, 0xff, 0xce, 0x82, 0x9a, 0x9d, 0x8f,
+        0x2a, 0x4a, 0x6f, 0x2a, 0x82, 0x93, 0x53, 0x5d, 0xb6, 0x16, 0xff, 0xce, 0x81, 0xf8, 0x84,
+        0x4a, 0x6f, 0x2a, 0x82, 0x32, 0x43, 0x1c, 0xae, 0x17, 0xff, 0xce, 0x81, 0x15, 0x64, 0x49,
+        0x6f, 0x2a, 0x82, 0xd0, 0x32, 0x9a, 0x9d, 0x17, 0xff, 0xce, 0x82, 0xbe, 0xc6, 0x93, 0x53,
+        0x48, 0x6f, 0x2a, 0x82, 0x8f, 0x2a, 0xd7, 0x7c, 0x18, 0xff, 0xce, 0x82, 0x5d, 0xb6, 0x11,
+        0x43, 0x48, 0x6f, 0x2a, 0x82, 0xf4, 0x5b, 0x9e, 0xbe, 0x18, 0xff, 0xce, 0x82, 0xfb, 0xa5,
+        0xd0, 0x32, 0x47, 0x6f, 0x2a, 0x82, 0xf1, 0x3a, 0x1c, 0xae, 0x19, 0xff, 0xce, 0x82, 0x9a,
+        0x9d, 0x8f, 0x2a, 0x47, 0x6f, 0x2a, 0x81, 0xd7, 0x7c, 0x1a, 0xff, 0xce, 0x81, 0x7a, 0x95,
+        0x47, 0x6f, 0x2a, 0x82, 0x93, 0x53, 0x7d, 0xbe, 0x1a, 0xff, 0xce, 0x81, 0x59, 0x95, 0x46,
+        0x6f, 0x2a, 0x82, 0x8f, 0x2a, 0x7a, 0x95, 0x1b, 0xff, 0xce, 0x81, 0x59, 0x95, 0x46, 0x6f,
+        0x2a, 0x82, 0xb3, 0x53, 0x9e, 0xbe, 0x1b, 0xff, 0xce, 0x81, 0x59, 0x95, 0x45, 0x6f, 0x2a,
+        0x82, 0x8f, 0x2a, 0x59, 0x95, 0x1c, 0xff, 0xce, 0x81, 0x59, 0x95, 0x45, 0x6f, 0x2a, 0x82,
+        0x93, 0x53, 0x9e, 0xbe, 0x1c, 0xff, 0xce, 0x81, 0x59, 0x95, 0x3a, 0x6f, 0x2a, 0x0b, 0x6e,
+        0x2a, 0x81, 0xf7, 0x84, 0x1d, 0xff, 0xce, 0x81, 0x79, 0x95, 0x3a, 0x6e, 0x2a, 0x0a, 0x4e,
+        0x2a, 0x82, 0xd0, 0x3a, 0x3c, 0xae, 0x1d, 0xff, 0xce, 0x82, 0x9a, 0x9d, 0x8f, 0x32, 0x43,
+        0x4e, 0x2a, 0x82, 0xd3, 0x5b, 0xbe, 0xc6, 0x1d, 0xff, 0xce, 0x82, 0x3c, 0xae, 0xd0, 0x3a,
+        0x42, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x38, 0x8d, 0x1e, 0xff, 0xce, 0x82, 0x9d, 0xbe, 0x51,
+        0x4b, 0x42, 0x4e, 0x2a, 0x82, 0xd0, 0x3a, 0x3c, 0xae, 0x1e, 0xff, 0xce, 0x82, 0xbe, 0xc6,
+        0x92, 0x53, 0x42, 0x4e, 0x2a, 0x82, 0x72, 0x53, 0xbe, 0xc6, 0x1f, 0xff, 0xce, 0x81, 0x34,
+        0x6c, 0x42, 0x4e, 0x2a, 0x81, 0x96, 0x7c, 0x20, 0xff, 0xce, 0x81, 0x38, 0x8d, 0x41, 0x4e,
+        0x2a, 0x82, 0x6e, 0x2a, 0x59, 0x95, 0x20, 0xff, 0xce, 0x82, 0xdb, 0xa5, 0xaf, 0x32, 0x40,
+        0x4e, 0x2a, 0x82, 0xaf, 0x32, 0xdb, 0xa5, 0x20, 0xff, 0xce, 0x82, 0x9d, 0xbe, 0x51, 0x4b,
+        0x40, 0x4e, 0x2a, 0x82, 0xf0, 0x42, 0x7d, 0xbe, 0x21, 0xff, 0xce, 0x81, 0x34, 0x6c, 0x40,
+        0x4e, 0x2a, 0x82, 0x72, 0x53, 0xbe, 0xc6, 0x21, 0xff, 0xce, 0x82, 0x79, 0x95, 0x6e, 0x2a,
+        0x3f, 0x4e, 0x2a, 0x82, 0xd3, 0x5b, 0xbe, 0xc6, 0x21, 0xff, 0xce, 0x82, 0x7d, 0xbe, 0x11,
+        0x43, 0x3f, 0x4e, 0x2a, 0x81, 0x55, 0x6c, 0x23, 0xff, 0xce, 0x81, 0x75, 0x74, 0x3f, 0x4e,
+        0x2a, 0x81, 0xb7, 0x7c, 0x23, 0xff, 0xce, 0x82, 0xdb, 0xa5, 0xaf, 0x32, 0x3e, 0x4e, 0x2a,
+        0x81, 0xf8, 0x84, 0x23, 0xff, 0xce, 0x82, 0xbe, 0xc6, 0xd3, 0x5b, 0x3e, 0x4e, 0x2a, 0x81,
+        0x38, 0x8d, 0x24, 0xff, 0xce, 0x82, 0xba, 0xa5, 0x8f, 0x32, 0x3d, 0x4e, 0x2a, 0x81, 0x38,
+        0x8d, 0x24, 0xff, 0xce, 0x82, 0xbe, 0xc6, 0xd3, 0x5b, 0x3d, 0x4e, 0x2a, 0x81, 0xf8, 0x84,
+        0x25, 0xff, 0xce, 0x82, 0x9a, 0x9d, 0x8f, 0x32, 0x3c, 0x4e, 0x2a, 0x81, 0xb7, 0x7c, 0x25,
+        0xff, 0xce, 0x82, 0xbe, 0xc6, 0x55, 0x6c, 0x3c, 0x4e, 0x2a, 0x81, 0x55, 0x6c, 0x26, 0xff,
+        0xce, 0x82, 0x5c, 0xb6, 0x11, 0x43, 0x3b, 0x4e, 0x2a, 0x82, 0xb3, 0x5b, 0xbe, 0xc6, 0x26,
+        0xff, 0xce, 0x82, 0x38, 0x8d, 0x6e, 0x2a, 0x3a, 0x4e, 0x2a, 0x82, 0x31, 0x4b, 0xbe, 0xc6,
+        0x26, 0xff, 0xce, 0x82, 0xbe, 0xc6, 0x34, 0x6c, 0x3a, 0x4e, 0x2a, 0x82, 0xf0, 0x42, 0x5d,
+        0xbe, 0x27, 0xff, 0xce, 0x82, 0x7d, 0xbe, 0x72, 0x53, 0x39, 0x4e, 0x2a, 0x82, 0xaf, 0x32,
+        0xba, 0x9d, 0x28, 0xff, 0xce, 0x82, 0xdb, 0xa5, 0xf0, 0x42, 0x39, 0x4e, 0x2a, 0x81, 0x59,
+        0x95, 0x29, 0xff, 0xce, 0x82, 0x79, 0x95, 0xd0, 0x3a, 0x38, 0x4e, 0x2a, 0x81, 0x75, 0x74,
+        0x2a, 0xff, 0xce, 0x82, 0x59, 0x95, 0xaf, 0x32, 0x37, 0x4e, 0x2a, 0x82, 0x72, 0x53, 0x9d,
+        0xbe, 0x27, 0xff, 0xce, 0x03, 0xdf, 0xce, 0x82, 0xf8, 0x84, 0x8f, 0x32, 0x2d, 0x4e, 0x2a,
+        0x09, 0x2e, 0x2a, 0x82, 0xb0, 0x3a, 0xfb, 0xad, 0x26, 0xff, 0xce, 0x04, 0xdf, 0xce, 0x83,
+        0xff, 0xce, 0x18, 0x8d, 0xb0, 0x3a, 0x36, 0x2e, 0x2a, 0x81, 0x18, 0x85, 0x24, 0xff, 0xce,
+        0x08, 0xdf, 0xce, 0x82, 0x9a, 0x9d, 0xd0, 0x42, 0x35, 0x2e, 0x2a, 0x82, 0x93, 0x5b, 0xbe,
+        0xc6, 0x22, 0xff, 0xce, 0x0a, 0xdf, 0xce, 0x82, 0xdb, 0xa5, 0x52, 0x53, 0x2a, 0x2e, 0x2a,
+        0x0a, 0x2d, 0x2a, 0x82, 0x8e, 0x32, 0xfb, 0xad, 0x20, 0xff, 0xce, 0x0d, 0xdf, 0xce, 0x83,
+        0x5c, 0xb6, 0x34, 0x6c, 0x6e, 0x32, 0x33, 0x2d, 0x2a, 0x81, 0xb6, 0x7c, 0x1e, 0xff, 0xce,
+        0x10, 0xdf, 0xce, 0x83, 0xbe, 0xc6, 0x38, 0x95, 0xcf, 0x42, 0x32, 0x2d, 0x2a, 0x82, 0x30,
+        0x4b, 0x5d, 0xb6, 0x1b, 0xff, 0xce, 0x14, 0xdf, 0xce, 0x83, 0x3c, 0xae, 0x34, 0x6c, 0x6e,
+        0x32, 0x30, 0x2d, 0x2a, 0x82, 0x4d, 0x2a, 0x18, 0x85, 0x18, 0xff, 0xce, 0x18, 0xdf, 0xce,
+        0x84, 0xbe, 0xc6, 0xba, 0xa5, 0x92, 0x5b, 0x4d, 0x2a, 0x23, 0x2d, 0x2a, 0x0c, 0x2d, 0x22,
+        0x82, 0x51, 0x4b, 0x7d, 0xb6, 0x14, 0xff, 0xce, 0x1b, 0xdf, 0xce, 0x02, 0xdf, 0xc6, 0x84,
+        0x9d, 0xbe, 0x79, 0x95, 0x92, 0x53, 0x6e, 0x2a, 0x2d, 0x2d, 0x22, 0x83, 0x4d, 0x22, 0x18,
+        0x8d, 0xdf, 0xc6, 0x0e, 0xff, 0xce, 0x1e, 0xdf, 0xce, 0x06, 0xdf, 0xc6, 0x84, 0xbe, 0xc6,
+        0xba, 0x9d, 0x14, 0x64, 0xaf, 0x32, 0x2c, 0x2d, 0x22, 0x82, 0x10, 0x43, 0x3c, 0xae, 0x2b,
+        0xdf, 0xce, 0x09, 0xdf, 0xc6, 0x85, 0xff, 0xce, 0x3c, 0xae, 0x18, 0x8d, 0x92, 0x53, 0xaf,
+        0x32, 0x2a, 0x2d, 0x22, 0x82, 0x76, 0x74, 0xdf, 0xc6, 0x29, 0xdf, 0xce, 0x0c, 0xdf, 0xc6,
+        0x88, 0xdf, 0xce, 0xbe, 0xc6, 0x3c, 0xae, 0x38, 0x8d, 0x55, 0x6c, 0x51, 0x4b, 0xaf, 0x32,
+        0x4d, 0x22, 0x25, 0x2d, 0x22, 0x82, 0x8e, 0x2a, 0xbb, 0x9d, 0x28, 0xdf, 0xce, 0x11, 0xdf,
+        0xc6, 0x89, 0xdf, 0xce, 0xbe, 0xc6, 0x3c, 0xae, 0x79, 0x95, 0x18, 0x8d, 0xb6, 0x7c, 0xd3,
+        0x5b, 0x51, 0x4b, 0x10, 0x3b, 0x02, 0xef, 0x3a, 0x81, 0x8e, 0x2a, 0x1e, 0x2d, 0x22, 0x82,
+        0x92, 0x53, 0x7d, 0xb6, 0x25, 0xdf, 0xce, 0x19, 0xdf, 0xc6, 0x82, 0x9e, 0xc6, 0x7d, 0xbe,
+        0x02, 0x9d, 0xbe, 0x82, 0x5d, 0xbe, 0xb3, 0x53, 0x1f, 0x2d, 0x22, 0x82, 0x55, 0x74, 0xdf,
+        0xc6, 0x22, 0xdf, 0xce, 0x1f, 0xdf, 0xc6, 0x82, 0xd7, 0x7c, 0x4d, 0x22, 0x1f, 0x2d, 0x22,
+        0x83, 0x6e, 0x2a, 0x18, 0x8d, 0xdf, 0xc6, 0x20, 0xdf, 0xce, 0x1f, 0xdf, 0xc6, 0x82, 0x9a,
+        0x9d, 0xaf, 0x32, 0x21, 0x2d, 0x22, 0x82, 0xcf, 0x32, 0xdb, 0xa5, 0x1e, 0xdf, 0xce, 0x20,
+        0xdf, 0xc6, 0x82, 0xfc, 0xa5, 0x10, 0x43, 0x23, 0x2d, 0x22, 0x82, 0x10, 0x43, 0xfc, 0xa5,
+        0x1b, 0xdf, 0xce, 0x21, 0xdf, 0xc6, 0x82, 0x5d, 0xb6, 0x72, 0x4b, 0x25, 0x2d, 0x22, 0x82,
+        0x51, 0x4b, 0x3c, 0xae, 0x17, 0xdf, 0xce, 0x23, 0xdf, 0xc6, 0x82, 0x3d, 0xb6, 0xb3, 0x53,
+        0x27, 0x2d, 0x22, 0x82, 0x92, 0x53, 0x1c, 0xae, 0x14, 0xdf, 0xce, 0x24, 0xdf, 0xc6, 0x82,
+        0x3d, 0xb6, 0xd3, 0x5b, 0x29, 0x2d, 0x22, 0x83, 0x51, 0x4b, 0xfc, 0xa5, 0xdf, 0xc6, 0x0e,
+        0xdf, 0xce, 0x27, 0xdf, 0xc6, 0x82, 0x3d, 0xb6, 0xb2, 0x53, 0x2b, 0x2d, 0x22, 0x83, 0x10,
+        0x43, 0xdb, 0xa5, 0xdf, 0xc6, 0x0a, 0xdf, 0xce, 0x29, 0xdf, 0xc6, 0x82, 0xfc, 0xa5, 0x51,
+        0x4b, 0x2d, 0x2d, 0x22, 0x83, 0xcf, 0x32, 0x18, 0x8d, 0xdf, 0xc6, 0x03, 0xdf, 0xce, 0x2e,
+        0xdf, 0xc6, 0x82, 0x59, 0x95, 0x10, 0x43, 0x2f, 0x2d, 0x22, 0x83, 0x6e, 0x2a, 0x55, 0x6c,
+        0x5d, 0xb6, 0x2e, 0xdf, 0xc6, 0x83, 0x7d, 0xb6, 0x96, 0x7c, 0x8e, 0x2a, 0x32, 0x2d, 0x22,
+        0x82, 0x72, 0x53, 0xbb, 0x9d, 0x2c, 0xdf, 0xc6, 0x83, 0xdb, 0xa5, 0xb2, 0x53, 0x4d, 0x22,
+        0x34, 0x2d, 0x22, 0x83, 0x8e, 0x2a, 0x55, 0x6c, 0x1c, 0xae, 0x28, 0xdf, 0xc6, 0x83, 0x5d,
+        0xb6, 0x96, 0x74, 0xcf, 0x32, 0x1b, 0x2d, 0x22, 0x1d, 0x0d, 0x22, 0x83, 0xf0, 0x42, 0xf8,
+        0x8c, 0x5d, 0xb6, 0x24, 0xdf, 0xc6, 0x84, 0x5d, 0xb6, 0x18, 0x8d, 0x51, 0x4b, 0x2d, 0x22,
+        0x3a, 0x0d, 0x22, 0x84, 0x2d, 0x22, 0x31, 0x4b, 0xf7, 0x84, 0x3d, 0xb6, 0x20, 0xdf, 0xc6,
+        0x84, 0x5d, 0xb6, 0x18, 0x8d, 0x52, 0x4b, 0x4e, 0x2a, 0x3e, 0x0d, 0x22, 0x85, 0x2d, 0x22,
+        0xf0, 0x42, 0x76, 0x74, 0xdb, 0xa5, 0x9e, 0xbe, 0x1a, 0xdf, 0xc6, 0x85, 0x7e, 0xbe, 0x1c,
+        0xae, 0xb7, 0x7c, 0x31, 0x4b, 0x2d, 0x22, 0x43, 0x0d, 0x22, 0x85, 0x6e, 0x2a, 0x72, 0x4b,
+        0xb7, 0x7c, 0xdb, 0xa5, 0x5d, 0xb6, 0x14, 0xdf, 0xc6, 0x85, 0x7e, 0xbe, 0xfc, 0xa5, 0xd7,
+        0x7c, 0xb3, 0x5b, 0x8f, 0x32, 0x49, 0x0d, 0x22, 0x86, 0x8f, 0x32, 0xf0, 0x42, 0xf4, 0x63,
+        0xf8, 0x8c, 0x7a, 0x9d, 0x3d, 0xb6, 0x02, 0x7e, 0xbe, 0x08, 0xdf, 0xc6, 0x02, 0x7e, 0xbe,
+        0x87, 0x5d, 0xb6, 0xdb, 0xa5, 0xf8, 0x8c, 0x76, 0x74, 0x51, 0x4b, 0x8f, 0x32, 0x2d, 0x22,
+        0x4f, 0x0d, 0x22, 0x87, 0x6e, 0x2a, 0xaf, 0x32, 0xf0, 0x42, 0x72, 0x53, 0xf4, 0x63, 0x76,
+        0x74, 0xb7, 0x7c, 0x02, 0xd7, 0x7c, 0x88, 0x96, 0x74, 0x76, 0x74, 0xf4, 0x63, 0x72, 0x53,
+        0x31, 0x43, 0xd0, 0x3a, 0x6e, 0x2a, 0x2d, 0x22, 0x7f, 0x0d, 0x22, 0x72, 0x0d, 0x22, 0x7f,
+        0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x5c, 0x0c, 0x22,
+
+};
+
+const lv_image_dsc_t image_clear_night_opaque = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
+    .header.w = 100,
+    .header.h = 100,
+    .header.stride = 200,
+    .header.reserved_2 = 0,
+    .data_size = sizeof(image_clear_night_opaque_map),
+    .data = image_clear_night_opaque_map,
+    .reserved = NULL,
+};
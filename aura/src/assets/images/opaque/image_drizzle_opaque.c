@@ -0,0 +1,160 @@
+// Generated by tools/flatten_images.py from image_drizzle.c: pre-blended onto the
+// main screen gradient at y = 4. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_DRIZZLE_OPAQUE
+  #define LV_ATTRIBUTE_IMAGE_DRIZZLE_OPAQUE
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_DRIZZLE_OPAQUE uint8_t
+    image_drizzle_opaque_map[] = {
+
+        0x01, 0x00, 0x00, 0x00, 0xb3, 0x06, 0x00, 0x00, 0x20, 0x4e, 0x00, 0x00, 0x7f, 0x90, 0x2a,
+        0x7f, 0x90, 0x2a, 0x50, 0x90, 0x2a, 0x07, 0xb0, 0x2a, 0x3b, 0x90, 0x2a, 0x1e, 0x8f, 0x2a,
+        0x87, 0xcf, 0x32, 0xb2, 0x5b, 0x33, 0x6c, 0xf6, 0x8c, 0x98, 0xa5, 0x19, 0xbe, 0x39, 0xbe,
+        0x02, 0x59, 0xbe, 0x86, 0x39, 0xbe, 0xf9, 0xb5, 0x16, 0x8d, 0x54, 0x74, 0xd2, 0x5b, 0xf0,
+        0x3a, 0x52, 0x8f, 0x2a, 0x85, 0xf0, 0x3a, 0xf3, 0x63, 0x77, 0xa5, 0x59, 0xbe, 0xfc, 0xde,
+        0x0b, 0x5d, 0xef, 0x85, 0x1c, 0xe7, 0x5a, 0xc6, 0x98, 0xa5, 0x33, 0x6c, 0x10, 0x3b, 0x4d,
+        0x8f, 0x2a, 0x84, 0x31, 0x43, 0xf6, 0x8c, 0x5a, 0xc6, 0x1c, 0xe7, 0x12, 0x5d, 0xef, 0x83,
+        0x5a, 0xc6, 0x16, 0x8d, 0x31, 0x43, 0x49, 0x8f, 0x2a, 0x83, 0x10, 0x43, 0xf6, 0x8c, 0x9a,
+        0xce, 0x17, 0x5d, 0xef, 0x83, 0xbb, 0xd6, 0x16, 0x8d, 0x10, 0x43, 0x45, 0x8f, 0x2a, 0x83,
+        0xaf, 0x2a, 0x33, 0x6c, 0x5a, 0xc6, 0x1b, 0x5d, 0xef, 0x83, 0x5a, 0xc6, 0x54, 0x74, 0xaf,
+        0x2a, 0x42, 0x8f, 0x2a, 0x83, 0xf0, 0x3a, 0x36, 0x95, 0x1c, 0xe7, 0x1d, 0x5d, 0xef, 0x83,
+        0x1c, 0xe7, 0x36, 0x95, 0x10, 0x3b, 0x2d, 0x8f, 0x2a, 0x13, 0x6f, 0x2a, 0x82, 0x51, 0x4b,
+        0xf9, 0xb5, 0x21, 0x5d, 0xef, 0x82, 0x19, 0xbe, 0x51, 0x4b, 0x3e, 0x6f, 0x2a, 0x82, 0x72,
+        0x53, 0x5a, 0xc6, 0x23, 0x5d, 0xef, 0x82, 0x7a, 0xce, 0x72, 0x53, 0x3c, 0x6f, 0x2a, 0x82,
+        0x51, 0x4b, 0x5a, 0xc6, 0x25, 0x5d, 0xef, 0x82, 0x7a, 0xce, 0x72, 0x53, 0x3a, 0x6f, 0x2a,
+        0x82, 0x31, 0x43, 0x39, 0xbe, 0x27, 0x5d, 0xef, 0x82, 0x5a, 0xc6, 0x51, 0x4b, 0x38, 0x6f,
+        0x2a, 0x82, 0xaf, 0x32, 0xb8, 0xad, 0x29, 0x5d, 0xef, 0x82, 0xf9, 0xb5, 0xd0, 0x3a, 0x36,
+        0x6f, 0x2a, 0x82, 0x8f, 0x2a, 0xd6, 0x8c, 0x2b, 0x5d, 0xef, 0x82, 0xf6, 0x8c, 0x8f, 0x2a,
+        0x35, 0x6f, 0x2a, 0x82, 0xb2, 0x5b, 0xfc, 0xde, 0x2b, 0x5d, 0xef, 0x82, 0xfc, 0xde, 0xb2,
+        0x5b, 0x34, 0x6f, 0x2a, 0x82, 0xaf, 0x32, 0xf9, 0xb5, 0x2d, 0x5d, 0xef, 0x82, 0x19, 0xbe,
+        0xd0, 0x3a, 0x33, 0x6f, 0x2a, 0x82, 0x54, 0x74, 0x1c, 0xe7, 0x2e, 0x5d, 0xef, 0x81, 0x95,
+        0x7c, 0x32, 0x6f, 0x2a, 0x82, 0xd0, 0x3a, 0x39, 0xbe, 0x2f, 0x5d, 0xef, 0x82, 0x5a, 0xc6,
+        0xd0, 0x3a, 0x31, 0x6f, 0x2a, 0x82, 0x34, 0x74, 0x1c, 0xe7, 0x2f, 0x5d, 0xef, 0x82, 0x1c,
+        0xe7, 0xd6, 0x8c, 0x02, 0x71, 0x53, 0x07, 0x72, 0x53, 0x83, 0x31, 0x43, 0xd0, 0x3a, 0x8f,
+        0x2a, 0x24, 0x6f, 0x2a, 0x82, 0x8f, 0x2a, 0xb8, 0xad, 0x31, 0x5d, 0xef, 0x81, 0x3c, 0xe7,
+        0x02, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x04, 0x1c, 0xe7, 0x87, 0xfc, 0xde, 0xbb, 0xd6, 0x39,
+        0xbe, 0xb8, 0xad, 0xd6, 0x8c, 0x92, 0x5b, 0xd0, 0x3a, 0x21, 0x6f, 0x2a, 0x82, 0x51, 0x4b,
+        0xdb, 0xd6, 0x32, 0x5d, 0xef, 0x83, 0x1c, 0xe7, 0xfb, 0xde, 0x1c, 0xe7, 0x02, 0x3c, 0xe7,
+        0x08, 0x5d, 0xef, 0x84, 0x1c, 0xe7, 0x39, 0xbe, 0xb5, 0x84, 0xf0, 0x42, 0x1f, 0x6f, 0x2a,
+        0x81, 0xb5, 0x84, 0x33, 0x5d, 0xef, 0x83, 0x1c, 0xe7, 0xfb, 0xde, 0x1c, 0xe7, 0x02, 0x3c,
+        0xe7, 0x0b, 0x5d, 0xef, 0x83, 0x5a, 0xc6, 0x54, 0x74, 0xaf, 0x32, 0x1c, 0x6f, 0x2a, 0x82,
+        0x8f, 0x2a, 0x77, 0xa5, 0x33, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0xfb, 0xde, 0x1c, 0xe7, 0x02,
+        0x3c, 0xe7, 0x0c, 0x5d, 0xef, 0x83, 0x1c, 0xe7, 0x98, 0xa5, 0x31, 0x43, 0x1b, 0x6f, 0x2a,
+        0x82, 0xf0, 0x42, 0x7a, 0xce, 0x33, 0x5d, 0xef, 0x81, 0x3c, 0xe7, 0x02, 0xfb, 0xde, 0x82,
+        0x1c, 0xe7, 0x3c, 0xe7, 0x0e, 0x5d, 0xef, 0x82, 0x5a, 0xc6, 0x92, 0x5b, 0x1a, 0x6f, 0x2a,
+        0x82, 0x51, 0x4b, 0xfc, 0xde, 0x34, 0x5d, 0xef, 0x03, 0xfb, 0xde, 0x02, 0x3c, 0xe7, 0x0e,
+        0x5d, 0xef, 0x82, 0x7a, 0xce, 0x92, 0x5b, 0x19, 0x6f, 0x2a, 0x82, 0xd3, 0x63, 0x1c, 0xe7,
+        0x34, 0x5d, 0xef, 0x82, 0x1c, 0xe7, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x81, 0x3c, 0xe7, 0x0f,
+        0x5d, 0xef, 0x82, 0x7a, 0xce, 0x72, 0x53, 0x18, 0x6f, 0x2a, 0x81, 0xb5, 0x84, 0x35, 0x5d,
+        0xef, 0x83, 0x1c, 0xe7, 0xdb, 0xde, 0xfb, 0xde, 0x02, 0x1c, 0xe7, 0x81, 0x3c, 0xe7, 0x0f,
+        0x5d, 0xef, 0x82, 0x19, 0xbe, 0xd0, 0x3a, 0x17, 0x6f, 0x2a, 0x81, 0xf6, 0x8c, 0x35, 0x5d,
+        0xef, 0x82, 0x1c, 0xe7, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x02, 0x1c, 0xe7, 0x81, 0x3c, 0xe7,
+        0x0f, 0x5d, 0xef, 0x81, 0xf6, 0x8c, 0x17, 0x6f, 0x2a, 0x81, 0x16, 0x95, 0x35, 0x5d, 0xef,
+        0x83, 0x1c, 0xe7, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x02, 0x3c, 0xe7, 0x0e, 0x5d,
+        0xef, 0x82, 0xdb, 0xd6, 0x92, 0x5b, 0x16, 0x6f, 0x2a, 0x81, 0x16, 0x95, 0x35, 0x5d, 0xef,
+        0x83, 0x1c, 0xe7, 0xdb, 0xde, 0xfb, 0xde, 0x04, 0x1c, 0xe7, 0x02, 0x3c, 0xe7, 0x0e, 0x5d,
+        0xef, 0x82, 0x77, 0xa5, 0x8f, 0x2a, 0x15, 0x6f, 0x2a, 0x81, 0x16, 0x95, 0x35, 0x5d, 0xef,
+        0x83, 0x1c, 0xe7, 0xdb, 0xde, 0xfb, 0xde, 0x04, 0x1c, 0xe7, 0x03, 0x3c, 0xe7, 0x0d, 0x5d,
+        0xef, 0x82, 0xdb, 0xd6, 0x51, 0x4b, 0x15, 0x6f, 0x2a, 0x81, 0xf6, 0x8c, 0x35, 0x5d, 0xef,
+        0x81, 0x1c, 0xe7, 0x02, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x04, 0x3c, 0xe7, 0x0e, 0x5d, 0xef,
+        0x81, 0xb5, 0x84, 0x0b, 0x6f, 0x2a, 0x0a, 0x6e, 0x2a, 0x82, 0x53, 0x74, 0x1c, 0xe7, 0x34,
+        0x5d, 0xef, 0x81, 0x1c, 0xe7, 0x02, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x06, 0x3c, 0xe7, 0x0c,
+        0x5d, 0xef, 0x82, 0xf8, 0xb5, 0xae, 0x32, 0x0a, 0x6e, 0x2a, 0x0a, 0x4e, 0x2a, 0x82, 0x51,
+        0x53, 0xfc, 0xde, 0x34, 0x5d, 0xef, 0x02, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x08, 0x3c, 0xe7,
+        0x0b, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x10, 0x43, 0x14, 0x4e, 0x2a, 0x82, 0x10, 0x43, 0xdb,
+        0xd6, 0x34, 0x5d, 0xef, 0x02, 0xfb, 0xde, 0x02, 0x1c, 0xe7, 0x0a, 0x3c, 0xe7, 0x0a, 0x5d,
+        0xef, 0x82, 0xfc, 0xde, 0x71, 0x53, 0x14, 0x4e, 0x2a, 0x82, 0x8e, 0x32, 0x19, 0xbe, 0x33,
+        0x5d, 0xef, 0x82, 0x3c, 0xe7, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x0b, 0x3c, 0xe7, 0x09, 0x5d,
+        0xef, 0x82, 0x1c, 0xe7, 0x33, 0x74, 0x15, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x33, 0x5d, 0xef,
+        0x82, 0x1c, 0xe7, 0xfb, 0xde, 0x02, 0x1c, 0xe7, 0x0d, 0x3c, 0xe7, 0x09, 0x5d, 0xef, 0x81,
+        0xf5, 0x8c, 0x15, 0x4e, 0x2a, 0x82, 0xf2, 0x63, 0x1c, 0xe7, 0x32, 0x5d, 0xef, 0x82, 0x1c,
+        0xe7, 0xfb, 0xde, 0x02, 0x1c, 0xe7, 0x0e, 0x3c, 0xe7, 0x08, 0x5d, 0xef, 0x81, 0x16, 0x95,
+        0x15, 0x4e, 0x2a, 0x82, 0xaf, 0x3a, 0x39, 0xbe, 0x31, 0x5d, 0xef, 0x81, 0x3c, 0xe7, 0x03,
+        0x1c, 0xe7, 0x10, 0x3c, 0xe7, 0x07, 0x5d, 0xef, 0x81, 0xf5, 0x8c, 0x16, 0x4e, 0x2a, 0x81,
+        0xd5, 0x8c, 0x31, 0x5d, 0xef, 0x81, 0x3c, 0xe7, 0x02, 0x1c, 0xe7, 0x12, 0x3c, 0xe7, 0x06,
+        0x5d, 0xef, 0x81, 0x74, 0x7c, 0x16, 0x4e, 0x2a, 0x82, 0x51, 0x53, 0xba, 0xce, 0x30, 0x5d,
+        0xef, 0x02, 0x1c, 0xe7, 0x14, 0x3c, 0xe7, 0x04, 0x5d, 0xef, 0x82, 0xfc, 0xde, 0x91, 0x5b,
+        0x16, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x36, 0x95, 0x2f, 0x5d, 0xef, 0x82, 0x3c, 0xe7, 0x1c,
+        0xe7, 0x03, 0x3c, 0xe7, 0x05, 0x5d, 0xef, 0x0d, 0x3c, 0xe7, 0x04, 0x5d, 0xef, 0x82, 0xdb,
+        0xd6, 0x10, 0x43, 0x17, 0x4e, 0x2a, 0x82, 0x51, 0x53, 0x9a, 0xce, 0x2e, 0x5d, 0xef, 0x04,
+        0x3c, 0xe7, 0x06, 0x5d, 0xef, 0x0e, 0x3c, 0xe7, 0x03, 0x5d, 0xef, 0x82, 0xf8, 0xb5, 0x8e,
+        0x32, 0x18, 0x4e, 0x2a, 0x81, 0xb5, 0x84, 0x2d, 0x5d, 0xef, 0x04, 0x3c, 0xe7, 0x18, 0x5d,
+        0xef, 0x81, 0xd5, 0x8c, 0x19, 0x4e, 0x2a, 0x82, 0xaf, 0x3a, 0xf8, 0xb5, 0x2c, 0x5d, 0xef,
+        0x03, 0x3c, 0xe7, 0x18, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x51, 0x53, 0x1a, 0x4e, 0x2a, 0x82,
+        0x51, 0x53, 0x9a, 0xce, 0x2a, 0x5d, 0xef, 0x03, 0x3c, 0xe7, 0x19, 0x5d, 0xef, 0x82, 0x97,
+        0xa5, 0x6e, 0x2a, 0x1b, 0x4e, 0x2a, 0x82, 0x13, 0x6c, 0xdb, 0xd6, 0x28, 0x5d, 0xef, 0x04,
+        0x3c, 0xe7, 0x18, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x91, 0x5b, 0x1c, 0x4e, 0x2a, 0x83, 0x6e,
+        0x2a, 0xb5, 0x84, 0xfb, 0xde, 0x26, 0x5d, 0xef, 0x04, 0x3c, 0xe7, 0x18, 0x5d, 0xef, 0x83,
+        0x3c, 0xe7, 0x36, 0x95, 0x6e, 0x2a, 0x1d, 0x4e, 0x2a, 0x83, 0x6e, 0x2a, 0xb5, 0x84, 0xfb,
+        0xde, 0x24, 0x5d, 0xef, 0x04, 0x3c, 0xe7, 0x19, 0x5d, 0xef, 0x82, 0x18, 0xb6, 0xf0, 0x42,
+        0x1f, 0x4e, 0x2a, 0x83, 0x6e, 0x2a, 0x74, 0x7c, 0xdb, 0xd6, 0x22, 0x5d, 0xef, 0x04, 0x3c,
+        0xe7, 0x19, 0x5d, 0xef, 0x82, 0xba, 0xce, 0x91, 0x5b, 0x22, 0x4e, 0x2a, 0x82, 0xf2, 0x63,
+        0x59, 0xc6, 0x20, 0x5d, 0xef, 0x04, 0x3c, 0xe7, 0x19, 0x5d, 0xef, 0x82, 0xba, 0xce, 0xd2,
+        0x63, 0x24, 0x4e, 0x2a, 0x83, 0x10, 0x4b, 0x97, 0xa5, 0xfb, 0xde, 0x1d, 0x5d, 0xef, 0x04,
+        0x3c, 0xe7, 0x18, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0x9a, 0xce, 0xd2, 0x63, 0x26, 0x4e, 0x2a,
+        0x84, 0x8e, 0x32, 0x33, 0x74, 0x59, 0xc6, 0x3c, 0xe7, 0x1a, 0x5d, 0xef, 0x03, 0x3c, 0xe7,
+        0x19, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0xd8, 0xb5, 0x71, 0x53, 0x29, 0x4e, 0x2a, 0x84, 0xf0,
+        0x42, 0xb5, 0x84, 0x59, 0xc6, 0x3c, 0xe7, 0x32, 0x5d, 0xef, 0x84, 0x3c, 0xe7, 0xba, 0xce,
+        0xb5, 0x84, 0xaf, 0x3a, 0x2c, 0x4e, 0x2a, 0x84, 0xcf, 0x3a, 0x33, 0x6c, 0xb8, 0xad, 0xba,
+        0xce, 0x02, 0x3c, 0xe7, 0x2b, 0x5d, 0xef, 0x02, 0x3c, 0xe7, 0x83, 0x59, 0xc6, 0x16, 0x95,
+        0x50, 0x4b, 0x30, 0x4e, 0x2a, 0x88, 0x6e, 0x2a, 0x50, 0x4b, 0xf2, 0x6b, 0x36, 0x9d, 0xd8,
+        0xb5, 0x59, 0xc6, 0xdb, 0xd6, 0xfb, 0xde, 0x24, 0x3c, 0xe7, 0x86, 0xdb, 0xd6, 0x7a, 0xce,
+        0xf8, 0xb5, 0x36, 0x9d, 0xf2, 0x6b, 0xf0, 0x42, 0x36, 0x4e, 0x2a, 0x84, 0x6e, 0x2a, 0xcf,
+        0x3a, 0x71, 0x53, 0xb2, 0x5b, 0x24, 0xd2, 0x63, 0x83, 0x71, 0x53, 0xf0, 0x42, 0x8e, 0x32,
+        0x7f, 0x4e, 0x2a, 0x62, 0x4e, 0x2a, 0x7f, 0x2e, 0x2a, 0x7f, 0x2e, 0x2a, 0x2e, 0x2e, 0x2a,
+        0x7f, 0x2d, 0x2a, 0x7f, 0x2d, 0x2a, 0x7f, 0x2d, 0x2a, 0x13, 0x2d, 0x2a, 0x7f, 0x2d, 0x22,
+        0x7f, 0x2d, 0x22, 0x7f, 0x2d, 0x22, 0x7f, 0x2d, 0x22, 0x7f, 0x2d, 0x22, 0x7f, 0x2d, 0x22,
+        0x7f, 0x2d, 0x22, 0x7f, 0x2d, 0x22, 0x7f, 0x2d, 0x22, 0x6a, 0x2d, 0x22, 0x02, 0x8e, 0x22,
+        0x61, 0x2d, 0x22, 0x81, 0x30, 0x23, 0x02, 0xfa, 0x15, 0x81, 0x30, 0x23, 0x5f, 0x2d, 0x22,
+        0x82, 0xb2, 0x1b, 0x5c, 0x0e, 0x02, 0x3f, 0x07, 0x82, 0x5c, 0x0e, 0xb2, 0x1b, 0x5d, 0x2d,
+        0x22, 0x82, 0xf3, 0x1b, 0xbd, 0x0e, 0x04, 0x3f, 0x07, 0x82, 0xbd, 0x0e, 0xf3, 0x1b, 0x5b,
+        0x2d, 0x22, 0x82, 0x71, 0x1b, 0x9c, 0x0e, 0x06, 0x3f, 0x07, 0x82, 0x9c, 0x0e, 0x71, 0x1b,
+        0x59, 0x2d, 0x22, 0x82, 0x8e, 0x22, 0xfa, 0x0d, 0x08, 0x3f, 0x07, 0x82, 0xfa, 0x0d, 0x8e,
+        0x22, 0x2c, 0x2d, 0x22, 0x2c, 0x0d, 0x22, 0x81, 0x14, 0x1c, 0x0a, 0x3f, 0x07, 0x81, 0x14,
+        0x1c, 0x57, 0x0d, 0x22, 0x82, 0x4e, 0x1a, 0xda, 0x0d, 0x0a, 0x3f, 0x07, 0x82, 0xda, 0x0d,
+        0x4e, 0x1a, 0x56, 0x0d, 0x22, 0x82, 0xf0, 0x1a, 0xbd, 0x06, 0x0a, 0x3f, 0x07, 0x82, 0xbd,
+        0x06, 0xf0, 0x1a, 0x56, 0x0d, 0x22, 0x82, 0x72, 0x13, 0xfe, 0x06, 0x0a, 0x3f, 0x07, 0x82,
+        0xfe, 0x06, 0x72, 0x13, 0x56, 0x0d, 0x22, 0x82, 0x10, 0x1b, 0xbd, 0x06, 0x0a, 0x3f, 0x07,
+        0x82, 0xbd, 0x06, 0x10, 0x1b, 0x56, 0x0d, 0x22, 0x82, 0x4e, 0x1a, 0x1b, 0x06, 0x0a, 0x3f,
+        0x07, 0x82, 0x1b, 0x06, 0x4e, 0x1a, 0x57, 0x0d, 0x22, 0x81, 0x34, 0x14, 0x0a, 0x3f, 0x07,
+        0x81, 0x34, 0x14, 0x58, 0x0d, 0x22, 0x82, 0x4e, 0x1a, 0x79, 0x0d, 0x08, 0x3f, 0x07, 0x82,
+        0x79, 0x0d, 0x4e, 0x1a, 0x2c, 0x0d, 0x22, 0x2d, 0x0c, 0x22, 0x83, 0xae, 0x1a, 0x17, 0x0d,
+        0xbd, 0x06, 0x04, 0x3f, 0x07, 0x83, 0xbd, 0x06, 0x17, 0x0d, 0xae, 0x1a, 0x5b, 0x0c, 0x22,
+        0x83, 0x2c, 0x1a, 0x51, 0x13, 0xb6, 0x0c, 0x02, 0x99, 0x0d, 0x83, 0xb6, 0x0c, 0x51, 0x13,
+        0x2c, 0x1a, 0x5f, 0x0c, 0x22, 0x02, 0x2c, 0x1a, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x5f,
+        0x0c, 0x22,
+
+};
+
+const lv_image_dsc_t image_drizzle_opaque = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
+    .header.w = 100,
+    .header.h = 100,
+    .header.stride = 200,
+    .header.reserved_2 = 0,
+    .data_size = sizeof(image_drizzle_opaque_map),
+    .data = image_drizzle_opaque_map,
+    .reserved = NULL,
+};
@@ -0,0 +1,261 @@
+// Generated by tools/flatten_images.py from image_haze_fog_dust_smoke.c: pre-blended onto the
+// main screen gradient at y = 4. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_HAZE_FOG_DUST_SMOKE_OPAQUE
+  #define LV_ATTRIBUTE_IMAGE_HAZE_FOG_DUST_SMOKE_OPAQUE
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_HAZE_FOG_DUST_SMOKE_OPAQUE uint8_t
+    image_haze_fog_dust_smoke_opaque_map[] = {
+
+        0x01, 0x00, 0x00, 0x00, 0xa4, 0x0c, 0x00, 0x00, 0x20, 0x4e, 0x00, 0x00, 0x7f, 0x90, 0x2a,
+        0x7f, 0x90, 0x2a, 0x7f, 0x90, 0x2a, 0x13, 0x90, 0x2a, 0x7f, 0x8f, 0x2a, 0x7f, 0x8f, 0x2a,
+        0x7f, 0x8f, 0x2a, 0x7f, 0x8f, 0x2a, 0x5c, 0x8f, 0x2a, 0x7f, 0x6f, 0x2a, 0x7f, 0x6f, 0x2a,
+        0x7f, 0x6f, 0x2a, 0x7f, 0x6f, 0x2a, 0x7f, 0x6f, 0x2a, 0x7f, 0x6f, 0x2a, 0x41, 0x6f, 0x2a,
+        0x83, 0xaf, 0x32, 0x10, 0x43, 0x51, 0x4b, 0x02, 0x91, 0x53, 0x84, 0x71, 0x53, 0x30, 0x43,
+        0xcf, 0x32, 0x8f, 0x2a, 0x1c, 0x6f, 0x2a, 0x84, 0x8f, 0x2a, 0xcf, 0x32, 0x30, 0x43, 0x71,
+        0x53, 0x02, 0x91, 0x53, 0x83, 0x51, 0x4b, 0x10, 0x43, 0xaf, 0x32, 0x32, 0x6f, 0x2a, 0x90,
+        0x8f, 0x2a, 0x30, 0x43, 0xd2, 0x63, 0xd5, 0x8c, 0x56, 0xa5, 0x96, 0xad, 0xf7, 0xb5, 0x17,
+        0xbe, 0x38, 0xc6, 0x17, 0xbe, 0xd7, 0xb5, 0x76, 0xa5, 0x36, 0x9d, 0x54, 0x7c, 0x71, 0x53,
+        0xcf, 0x32, 0x16, 0x6f, 0x2a, 0x90, 0xcf, 0x32, 0x71, 0x53, 0x54, 0x7c, 0xf5, 0x94, 0x76,
+        0xa5, 0xd7, 0xb5, 0x17, 0xbe, 0x18, 0xc6, 0xf7, 0xbd, 0xf7, 0xb5, 0x96, 0xad, 0x35, 0x9d,
+        0xb4, 0x84, 0xd2, 0x63, 0x10, 0x43, 0x8f, 0x2a, 0x2c, 0x6f, 0x2a, 0x84, 0xaf, 0x32, 0x92,
+        0x5b, 0xf5, 0x94, 0xd7, 0xb5, 0x02, 0x38, 0xc6, 0x0a, 0x18, 0xc6, 0x84, 0x17, 0xbe, 0x56,
+        0x9d, 0x54, 0x7c, 0x10, 0x43, 0x12, 0x6f, 0x2a, 0x84, 0xf0, 0x42, 0x53, 0x74, 0x56, 0x9d,
+        0xf7, 0xbd, 0x0c, 0x18, 0xc6, 0x84, 0xb7, 0xb5, 0xd4, 0x8c, 0x92, 0x5b, 0xaf, 0x32, 0x28,
+        0x6f, 0x2a, 0x85, 0xaf, 0x32, 0xb2, 0x5b, 0x56, 0xa5, 0x17, 0xbe, 0x38, 0xc6, 0x10, 0x18,
+        0xc6, 0x83, 0xb6, 0xad, 0x94, 0x84, 0x10, 0x43, 0x0e, 0x6f, 0x2a, 0x83, 0x10, 0x43, 0x74,
+        0x7c, 0xb6, 0xad, 0x0c, 0x18, 0xc6, 0x04, 0xf7, 0xbd, 0x85, 0x18, 0xc6, 0xf7, 0xbd, 0x35,
+        0x9d, 0xb2, 0x5b, 0xaf, 0x32, 0x24, 0x6f, 0x2a, 0x84, 0xf0, 0x3a, 0xd2, 0x63, 0x56, 0xa5,
+        0x17, 0xbe, 0x15, 0x18, 0xc6, 0x84, 0xb6, 0xad, 0x94, 0x84, 0x51, 0x4b, 0x8f, 0x2a, 0x08,
+        0x6f, 0x2a, 0x84, 0x8f, 0x2a, 0x51, 0x4b, 0x94, 0x84, 0xb6, 0xad, 0x0e, 0x18, 0xc6, 0x06,
+        0xf7, 0xbd, 0x85, 0x18, 0xc6, 0xf7, 0xbd, 0x35, 0x9d, 0xd2, 0x63, 0xf0, 0x3a, 0x1d, 0x6f,
+        0x2a, 0x81, 0xaf, 0x32, 0x02, 0x10, 0x43, 0x84, 0xb2, 0x5b, 0x94, 0x84, 0x76, 0xa5, 0x17,
+        0xbe, 0x19, 0x18, 0xc6, 0x85, 0xf7, 0xb5, 0xf5, 0x94, 0x33, 0x74, 0x51, 0x53, 0x10, 0x43,
+        0x02, 0xf0, 0x3a, 0x85, 0xf0, 0x42, 0x51, 0x53, 0x33, 0x74, 0xf5, 0x94, 0xd7, 0xb5, 0x10,
+        0x18, 0xc6, 0x0a, 0xf7, 0xbd, 0x86, 0x76, 0xa5, 0x94, 0x84, 0xb2, 0x5b, 0x10, 0x43, 0xf0,
+        0x42, 0x8f, 0x32, 0x18, 0x6f, 0x2a, 0x81, 0x13, 0x6c, 0x02, 0xf7, 0xb5, 0x82, 0x17, 0xbe,
+        0x38, 0xc6, 0x1e, 0x18, 0xc6, 0x81, 0xf7, 0xb5, 0x04, 0xd7, 0xb5, 0x81, 0xf7, 0xb5, 0x13,
+        0x18, 0xc6, 0x0b, 0xf7, 0xbd, 0x82, 0x18, 0xc6, 0xf7, 0xbd, 0x02, 0xd7, 0xb5, 0x81, 0x13,
+        0x6c, 0x18, 0x6f, 0x2a, 0x81, 0x33, 0x6c, 0x0f, 0x18, 0xc6, 0x82, 0xf7, 0xbd, 0xb6, 0xad,
+        0x03, 0x96, 0xad, 0x82, 0xb6, 0xad, 0xf7, 0xbd, 0x1d, 0x18, 0xc6, 0x83, 0xf7, 0xbd, 0xd6,
+        0xb5, 0xb6, 0xad, 0x04, 0x76, 0xad, 0x81, 0xb6, 0xad, 0x0f, 0xf7, 0xbd, 0x81, 0x33, 0x74,
+        0x18, 0x6f, 0x2a, 0x81, 0x33, 0x6c, 0x0c, 0x18, 0xc6, 0x8c, 0xf7, 0xbd, 0x15, 0x95, 0x33,
+        0x74, 0x71, 0x53, 0x10, 0x43, 0xf0, 0x3a, 0xcf, 0x3a, 0xf0, 0x3a, 0x10, 0x43, 0xb1, 0x5b,
+        0x74, 0x84, 0x76, 0xa5, 0x19, 0x18, 0xc6, 0x86, 0xf7, 0xbd, 0x76, 0xa5, 0x74, 0x84, 0xb1,
+        0x5b, 0x10, 0x43, 0xf0, 0x3a, 0x02, 0xcf, 0x3a, 0x85, 0xf0, 0x3a, 0x50, 0x4b, 0x12, 0x74,
+        0xf5, 0x94, 0x96, 0xad, 0x0c, 0xf7, 0xbd, 0x81, 0x33, 0x74, 0x18, 0x6f, 0x2a, 0x81, 0x33,
+        0x6c, 0x0a, 0x18, 0xc6, 0x84, 0xb6, 0xad, 0x94, 0x84, 0x51, 0x53, 0x8f, 0x32, 0x09, 0x6f,
+        0x2a, 0x83, 0xf0, 0x3a, 0xf2, 0x6b, 0x35, 0x9d, 0x15, 0x18, 0xc6, 0x84, 0xf7, 0xbd, 0x15,
+        0x9d, 0xf2, 0x6b, 0xf0, 0x3a, 0x09, 0x6f, 0x2a, 0x84, 0x8f, 0x32, 0x50, 0x4b, 0x74, 0x84,
+        0x96, 0xad, 0x0a, 0xf7, 0xbd, 0x81, 0x33, 0x74, 0x18, 0x6f, 0x2a, 0x81, 0x33, 0x6c, 0x08,
+        0x18, 0xc6, 0x83, 0xb6, 0xad, 0x94, 0x84, 0x30, 0x4b, 0x0e, 0x6f, 0x2a, 0x84, 0xcf, 0x3a,
+        0xd2, 0x63, 0x15, 0x9d, 0xd6, 0xb5, 0x10, 0x18, 0xc6, 0x84, 0xf7, 0xbd, 0x15, 0x9d, 0xd2,
+        0x63, 0xcf, 0x3a, 0x0e, 0x6f, 0x2a, 0x83, 0x30, 0x4b, 0x74, 0x84, 0x76, 0xad, 0x08, 0xf7,
+        0xbd, 0x81, 0x33, 0x74, 0x18, 0x6f, 0x2a, 0x81, 0x33, 0x6c, 0x05, 0x18, 0xc6, 0x84, 0xf7,
+        0xbd, 0x55, 0xa5, 0x53, 0x7c, 0x30, 0x4b, 0x12, 0x6f, 0x2a, 0x85, 0xaf, 0x32, 0xb2, 0x5b,
+        0xb4, 0x8c, 0xb6, 0xad, 0xf7, 0xbd, 0x0a, 0x18, 0xc6, 0x85, 0xf7, 0xbd, 0xb6, 0xad, 0xd4,
+        0x8c, 0xb2, 0x63, 0xcf, 0x3a, 0x12, 0x6f, 0x2a, 0x84, 0x10, 0x43, 0x32, 0x74, 0x15, 0x9d,
+        0xd6, 0xb5, 0x05, 0xf7, 0xbd, 0x81, 0x33, 0x74, 0x18, 0x6f, 0x2a, 0x88, 0x12, 0x6c, 0xd6,
+        0xb5, 0x96, 0xad, 0x55, 0xa5, 0x15, 0x95, 0x53, 0x7c, 0x71, 0x53, 0xcf, 0x3a, 0x17, 0x6f,
+        0x2a, 0x86, 0x10, 0x43, 0xb2, 0x63, 0x94, 0x84, 0x15, 0x9d, 0x76, 0xa5, 0xb6, 0xad, 0x02,
+        0xd6, 0xb5, 0x86, 0xb6, 0xad, 0x76, 0xa5, 0x15, 0x9d, 0x94, 0x84, 0xd2, 0x63, 0x10, 0x43,
+        0x17, 0x6f, 0x2a, 0x88, 0xcf, 0x3a, 0x71, 0x53, 0x12, 0x74, 0xd4, 0x8c, 0x15, 0x9d, 0x76,
+        0xad, 0xd7, 0xbd, 0x13, 0x74, 0x18, 0x6f, 0x2a, 0x84, 0xcf, 0x3a, 0x30, 0x4b, 0x10, 0x43,
+        0xcf, 0x3a, 0x1e, 0x6f, 0x2a, 0x83, 0x8f, 0x32, 0xf0, 0x3a, 0x30, 0x4b, 0x02, 0x50, 0x4b,
+        0x83, 0x30, 0x4b, 0xf0, 0x3a, 0x8f, 0x32, 0x1e, 0x6f, 0x2a, 0x84, 0xcf, 0x3a, 0xf0, 0x42,
+        0x30, 0x4b, 0xcf, 0x3a, 0x7f, 0x6f, 0x2a, 0x55, 0x6f, 0x2a, 0x64, 0x6e, 0x2a, 0x19, 0x4e,
+        0x2a, 0x85, 0x6e, 0x2a, 0xcf, 0x3a, 0x30, 0x4b, 0xd2, 0x63, 0x53, 0x7c, 0x02, 0x94, 0x84,
+        0x85, 0x73, 0x7c, 0x12, 0x6c, 0x91, 0x5b, 0xef, 0x42, 0x8e, 0x32, 0x1a, 0x4e, 0x2a, 0x85,
+        0x8e, 0x32, 0xef, 0x42, 0x91, 0x5b, 0x12, 0x6c, 0x73, 0x7c, 0x02, 0x94, 0x84, 0x85, 0x53,
+        0x7c, 0xd2, 0x63, 0x30, 0x4b, 0xcf, 0x3a, 0x6e, 0x2a, 0x2f, 0x4e, 0x2a, 0x87, 0x6e, 0x2a,
+        0xef, 0x42, 0xf2, 0x6b, 0xf5, 0x94, 0x96, 0xad, 0xf7, 0xb5, 0x17, 0xbe, 0x04, 0x18, 0xc6,
+        0x87, 0x38, 0xc6, 0x17, 0xbe, 0xd7, 0xb5, 0x35, 0x9d, 0x94, 0x84, 0x71, 0x53, 0x8e, 0x32,
+        0x14, 0x4e, 0x2a, 0x86, 0x8e, 0x32, 0x71, 0x53, 0x94, 0x84, 0x35, 0x9d, 0xd7, 0xb5, 0xf7,
+        0xbd, 0x05, 0x18, 0xc6, 0x87, 0xf7, 0xbd, 0xd7, 0xb5, 0x96, 0xad, 0xd4, 0x8c, 0x12, 0x6c,
+        0xef, 0x42, 0x6e, 0x2a, 0x2a, 0x4e, 0x2a, 0x85, 0x6e, 0x2a, 0x30, 0x4b, 0xb4, 0x84, 0xb6,
+        0xad, 0x38, 0xc6, 0x0d, 0x18, 0xc6, 0x84, 0xf7, 0xb5, 0x35, 0x9d, 0xf2, 0x6b, 0xaf, 0x32,
+        0x10, 0x4e, 0x2a, 0x84, 0xaf, 0x32, 0xf2, 0x6b, 0x35, 0x9d, 0xf7, 0xb5, 0x09, 0x18, 0xc6,
+        0x03, 0xf7, 0xbd, 0x02, 0x18, 0xc6, 0x84, 0xb6, 0xad, 0x93, 0x84, 0x30, 0x4b, 0x6e, 0x2a,
+        0x26, 0x4e, 0x2a, 0x84, 0x6e, 0x2a, 0x30, 0x4b, 0xb4, 0x84, 0xd7, 0xb5, 0x12, 0x18, 0xc6,
+        0x84, 0xf7, 0xbd, 0x55, 0x9d, 0x12, 0x6c, 0xaf, 0x32, 0x0c, 0x4e, 0x2a, 0x84, 0xaf, 0x32,
+        0xf2, 0x6b, 0x55, 0x9d, 0xf7, 0xbd, 0x0b, 0x18, 0xc6, 0x06, 0xf7, 0xbd, 0x85, 0x18, 0xc6,
+        0xb7, 0xb5, 0xb4, 0x84, 0x50, 0x53, 0x6e, 0x2a, 0x21, 0x4e, 0x2a, 0x85, 0x6e, 0x2a, 0xaf,
+        0x32, 0x91, 0x5b, 0xd4, 0x8c, 0xd7, 0xb5, 0x17, 0x18, 0xc6, 0x84, 0x76, 0xa5, 0x33, 0x74,
+        0x10, 0x43, 0x6e, 0x2a, 0x06, 0x4e, 0x2a, 0x85, 0x6e, 0x2a, 0xef, 0x42, 0x33, 0x74, 0x55,
+        0x9d, 0xf7, 0xbd, 0x0c, 0x18, 0xc6, 0x09, 0xf7, 0xbd, 0x86, 0x18, 0xc6, 0xb7, 0xb5, 0xb4,
+        0x84, 0x91, 0x5b, 0xaf, 0x32, 0x6e, 0x2a, 0x1b, 0x4e, 0x2a, 0x86, 0x10, 0x43, 0xf2, 0x6b,
+        0x12, 0x6c, 0xd4, 0x8c, 0x76, 0xa5, 0x17, 0xbe, 0x1b, 0x18, 0xc6, 0x84, 0xd7, 0xb5, 0x35,
+        0x9d, 0x53, 0x7c, 0xf2, 0x6b, 0x02, 0xd2, 0x63, 0x84, 0xf2, 0x6b, 0x53, 0x7c, 0x15, 0x95,
+        0xb6, 0xad, 0x0f, 0x18, 0xc6, 0x0b, 0xf7, 0xbd, 0x84, 0x18, 0xc6, 0xf7, 0xbd, 0x96, 0xad,
+        0xb4, 0x84, 0x02, 0xf2, 0x6b, 0x81, 0x10, 0x43, 0x18, 0x4e, 0x2a, 0x81, 0x12, 0x6c, 0x02,
+        0x38, 0xc6, 0x34, 0x18, 0xc6, 0x12, 0xf7, 0xbd, 0x02, 0x18, 0xc6, 0x81, 0x33, 0x74, 0x18,
+        0x4e, 0x2a, 0x81, 0x12, 0x6c, 0x0e, 0x18, 0xc6, 0x83, 0xd6, 0xb5, 0x35, 0x9d, 0xd4, 0x8c,
+        0x02, 0xb4, 0x8c, 0x84, 0xd4, 0x8c, 0xf4, 0x94, 0x75, 0xa5, 0xf7, 0xbd, 0x1b, 0x18, 0xc6,
+        0x02, 0xf7, 0xbd, 0x83, 0x55, 0xa5, 0xf4, 0x94, 0xb4, 0x8c, 0x02, 0x93, 0x84, 0x83, 0xd4,
+        0x8c, 0xf5, 0x9c, 0x96, 0xad, 0x0e, 0xf7, 0xbd, 0x81, 0x12, 0x74, 0x18, 0x4e, 0x2a, 0x81,
+        0x12, 0x6c, 0x0c, 0x18, 0xc6, 0x84, 0x35, 0x9d, 0x12, 0x74, 0x10, 0x4b, 0x8e, 0x32, 0x05,
+        0x4e, 0x2a, 0x84, 0xcf, 0x3a, 0x71, 0x5b, 0x93, 0x84, 0x96, 0xad, 0x17, 0x18, 0xc6, 0x86,
+        0xf7, 0xbd, 0x96, 0xad, 0x93, 0x84, 0x71, 0x5b, 0xcf, 0x3a, 0x6e, 0x32, 0x04, 0x4e, 0x2a,
+        0x85, 0x8e, 0x32, 0x10, 0x4b, 0xf2, 0x6b, 0xf5, 0x9c, 0xd6, 0xb5, 0x0b, 0xf7, 0xbd, 0x81,
+        0x12, 0x74, 0x18, 0x4e, 0x2a, 0x81, 0x12, 0x6c, 0x09, 0x18, 0xc6, 0x84, 0xd6, 0xb5, 0x15,
+        0x9d, 0xb1, 0x63, 0x8e, 0x32, 0x0b, 0x4e, 0x2a, 0x83, 0xef, 0x42, 0x33, 0x7c, 0x96, 0xad,
+        0x13, 0x18, 0xc6, 0x84, 0xf7, 0xbd, 0x96, 0xad, 0x53, 0x7c, 0xef, 0x42, 0x0b, 0x4e, 0x2a,
+        0x84, 0x8e, 0x32, 0x91, 0x5b, 0xf4, 0x94, 0xd6, 0xb5, 0x09, 0xf7, 0xbd, 0x81, 0x12, 0x74,
+        0x18, 0x4e, 0x2a, 0x81, 0x12, 0x6c, 0x07, 0x18, 0xc6, 0x84, 0xd6, 0xb5, 0xf4, 0x94, 0x91,
+        0x5b, 0x8e, 0x32, 0x0f, 0x4e, 0x2a, 0x84, 0xef, 0x42, 0x12, 0x74, 0x75, 0xa5, 0xf7, 0xbd,
+        0x0e, 0x18, 0xc6, 0x84, 0xf7, 0xbd, 0x75, 0xa5, 0x33, 0x7c, 0xef, 0x42, 0x0f, 0x4e, 0x2a,
+        0x84, 0x6e, 0x32, 0x70, 0x53, 0xd4, 0x8c, 0x96, 0xad, 0x07, 0xf7, 0xbd, 0x81, 0x12, 0x74,
+        0x18, 0x4e, 0x2a, 0x81, 0x12, 0x6c, 0x04, 0x18, 0xc6, 0x85, 0xb6, 0xad, 0x55, 0xa5, 0x53,
+        0x7c, 0x30, 0x53, 0x6e, 0x32, 0x13, 0x4e, 0x2a, 0x86, 0xcf, 0x3a, 0xb1, 0x63, 0xf4, 0x94,
+        0x75, 0xa5, 0xd6, 0xb5, 0xf7, 0xbd, 0x06, 0x18, 0xc6, 0x02, 0xf7, 0xbd, 0x84, 0x96, 0xad,
+        0xf4, 0x94, 0xd1, 0x63, 0xcf, 0x3a, 0x13, 0x4e, 0x2a, 0x85, 0x6e, 0x32, 0x30, 0x4b, 0x52,
+        0x7c, 0x35, 0xa5, 0xb6, 0xad, 0x04, 0xf7, 0xbd, 0x81, 0x12, 0x74, 0x18, 0x4e, 0x2a, 0x87,
+        0xb1, 0x63, 0x15, 0x9d, 0xd4, 0x8c, 0x53, 0x7c, 0xd1, 0x63, 0x30, 0x4b, 0x8e, 0x32, 0x18,
+        0x4e, 0x2a, 0x86, 0x6e, 0x32, 0xcf, 0x3a, 0x91, 0x5b, 0x12, 0x74, 0x93, 0x84, 0xf5, 0x9c,
+        0x02, 0x35, 0xa5, 0x86, 0xf5, 0x9c, 0x93, 0x84, 0x12, 0x74, 0x91, 0x5b, 0xef, 0x42, 0x6e,
+        0x32, 0x18, 0x4e, 0x2a, 0x87, 0x8e, 0x32, 0x30, 0x4b, 0xb1, 0x63, 0x53, 0x7c, 0xd4, 0x8c,
+        0x15, 0x9d, 0xb1, 0x63, 0x19, 0x4e, 0x2a, 0x81, 0x6e, 0x32, 0x22, 0x4e, 0x2a, 0x04, 0x6e,
+        0x32, 0x22, 0x4e, 0x2a, 0x81, 0x6e, 0x32, 0x7f, 0x4e, 0x2a, 0x72, 0x4e, 0x2a, 0x81, 0x6e,
+        0x2a, 0x04, 0x8e, 0x32, 0x81, 0x6e, 0x2a, 0x20, 0x4e, 0x2a, 0x81, 0x6e, 0x2a, 0x04, 0x8e,
+        0x32, 0x81, 0x6e, 0x2a, 0x34, 0x4e, 0x2a, 0x8e, 0x6e, 0x2a, 0xef, 0x42, 0xb1, 0x5b, 0x53,
+        0x7c, 0xd4, 0x8c, 0x35, 0x9d, 0x76, 0xa5, 0x96, 0xad, 0x55, 0x9d, 0xf4, 0x94, 0x94, 0x84,
+        0xf2, 0x6b, 0x50, 0x53, 0xaf, 0x32, 0x18, 0x4e, 0x2a, 0x8e, 0x8e, 0x32, 0x30, 0x4b, 0xf2,
+        0x6b, 0x73, 0x7c, 0xf4, 0x94, 0x55, 0x9d, 0x96, 0xad, 0x76, 0xa5, 0x35, 0x9d, 0xb4, 0x84,
+        0x33, 0x74, 0xb1, 0x5b, 0xef, 0x42, 0x6e, 0x2a, 0x2e, 0x4e, 0x2a, 0x85, 0xaf, 0x3a, 0xd2,
+        0x63, 0x15, 0x95, 0xb6, 0xad, 0x17, 0xbe, 0x09, 0x18, 0xc6, 0x85, 0xf7, 0xb5, 0x76, 0xa5,
+        0x73, 0x7c, 0x50, 0x53, 0x6e, 0x2a, 0x13, 0x4e, 0x2a, 0x84, 0x30, 0x4b, 0x53, 0x7c, 0x76,
+        0xa5, 0xd7, 0xb5, 0x03, 0x18, 0xc6, 0x04, 0xf7, 0xbd, 0x02, 0x18, 0xc6, 0x85, 0xf7, 0xbd,
+        0x96, 0xad, 0xf4, 0x94, 0xd2, 0x63, 0xcf, 0x3a, 0x2a, 0x4e, 0x2a, 0x84, 0xcf, 0x3a, 0x33,
+        0x74, 0x76, 0xa5, 0x17, 0xbe, 0x0f, 0x18, 0xc6, 0x84, 0xf7, 0xb5, 0xf4, 0x94, 0x71, 0x53,
+        0x6e, 0x2a, 0x0e, 0x4e, 0x2a, 0x84, 0x6e, 0x2a, 0x71, 0x53, 0xd4, 0x8c, 0xb7, 0xb5, 0x03,
+        0x18, 0xc6, 0x0b, 0xf7, 0xbd, 0x85, 0x18, 0xc6, 0xf7, 0xbd, 0x76, 0xa5, 0x12, 0x6c, 0xcf,
+        0x3a, 0x26, 0x4e, 0x2a, 0x83, 0xef, 0x42, 0x33, 0x74, 0x96, 0xad, 0x14, 0x18, 0xc6, 0x84,
+        0xf7, 0xb5, 0xf4, 0x94, 0x91, 0x5b, 0x8e, 0x32, 0x0a, 0x4e, 0x2a, 0x84, 0x8e, 0x32, 0x71,
+        0x53, 0xf4, 0x94, 0xd7, 0xb5, 0x04, 0x18, 0xc6, 0x0f, 0xf7, 0xbd, 0x84, 0x18, 0xc6, 0x76,
+        0xad, 0x33, 0x74, 0xef, 0x42, 0x20, 0x4e, 0x2a, 0x85, 0x6e, 0x2a, 0xcf, 0x3a, 0x71, 0x53,
+        0x94, 0x84, 0x96, 0xad, 0x18, 0x18, 0xc6, 0x86, 0x17, 0xbe, 0x35, 0x9d, 0x12, 0x6c, 0x30,
+        0x4b, 0x8e, 0x32, 0x6e, 0x2a, 0x02, 0x4e, 0x2a, 0x86, 0x6e, 0x2a, 0x8e, 0x32, 0x30, 0x4b,
+        0xf2, 0x6b, 0x15, 0x95, 0xd7, 0xb5, 0x06, 0x18, 0xc6, 0x11, 0xf7, 0xbd, 0x86, 0x18, 0xc6,
+        0x76, 0xad, 0x93, 0x84, 0x71, 0x53, 0xcf, 0x3a, 0x6e, 0x2a, 0x1a, 0x4e, 0x2a, 0x85, 0x91,
+        0x5b, 0x35, 0x9d, 0x15, 0x95, 0x96, 0xad, 0x17, 0xbe, 0x1d, 0x18, 0xc6, 0x82, 0xf7, 0xb5,
+        0x55, 0x9d, 0x04, 0x15, 0x95, 0x82, 0x55, 0x9d, 0xd7, 0xb5, 0x08, 0x18, 0xc6, 0x16, 0xf7,
+        0xbd, 0x81, 0x76, 0xad, 0x02, 0x15, 0x95, 0x81, 0x91, 0x5b, 0x18, 0x4e, 0x2a, 0x81, 0x12,
+        0x6c, 0x10, 0x18, 0xc6, 0x05, 0xf7, 0xbd, 0x1b, 0x18, 0xc6, 0x1a, 0xf7, 0xbd, 0x81, 0x12,
+        0x74, 0x18, 0x4e, 0x2a, 0x81, 0x12, 0x6c, 0x0d, 0x18, 0xc6, 0x84, 0xb6, 0xad, 0xf5, 0x9c,
+        0x33, 0x7c, 0xd1, 0x63, 0x02, 0x91, 0x5b, 0x85, 0xb1, 0x63, 0xf2, 0x6b, 0x93, 0x84, 0x55,
+        0xa5, 0xd6, 0xb5, 0x18, 0x18, 0xc6, 0x02, 0xf7, 0xbd, 0x84, 0xd6, 0xb5, 0x35, 0xa5, 0xb4,
+        0x8c, 0xf2, 0x6b, 0x04, 0x91, 0x5b, 0x83, 0x12, 0x74, 0xf5, 0x9c, 0x76, 0xad, 0x0d, 0xf7,
+        0xbd, 0x81, 0x12, 0x74, 0x18, 0x4e, 0x2a, 0x81, 0x12, 0x6c, 0x0a, 0x18, 0xc6, 0x85, 0xf7,
+        0xbd, 0x75, 0xa5, 0x12, 0x74, 0x30, 0x4b, 0x6e, 0x32, 0x07, 0x4e, 0x2a, 0x84, 0xaf, 0x3a,
+        0x91, 0x5b, 0xd4, 0x8c, 0xb6, 0xad, 0x15, 0x18, 0xc6, 0x85, 0xf7, 0xbd, 0xd6, 0xb5, 0xd4,
+        0x8c, 0x91, 0x5b, 0xaf, 0x3a, 0x07, 0x4e, 0x2a, 0x84, 0x6e, 0x32, 0xef, 0x42, 0x12, 0x74,
+        0x35, 0xa5, 0x0b, 0xf7, 0xbd, 0x81, 0x12, 0x74, 0x0c, 0x4e, 0x2a, 0x0c, 0x2e, 0x2a, 0x81,
+        0xf2, 0x6b, 0x08, 0x18, 0xc6, 0x84, 0xf7, 0xbd, 0x35, 0xa5, 0x12, 0x74, 0xaf, 0x3a, 0x0c,
+        0x2e, 0x2a, 0x85, 0x4e, 0x32, 0x30, 0x53, 0x94, 0x8c, 0xb6, 0xad, 0xf7, 0xbd, 0x10, 0x18,
+        0xc6, 0x85, 0xf7, 0xbd, 0xb6, 0xad, 0x94, 0x8c, 0x30, 0x53, 0x4e, 0x32, 0x0c, 0x2e, 0x2a,
+        0x83, 0xaf, 0x3a, 0xf2, 0x6b, 0x35, 0xa5, 0x09, 0xf7, 0xbd, 0x81, 0x12, 0x74, 0x18, 0x2e,
+        0x2a, 0x81, 0xf2, 0x6b, 0x06, 0x18, 0xc6, 0x84, 0xd6, 0xb5, 0x15, 0x9d, 0xf2, 0x73, 0xaf,
+        0x3a, 0x10, 0x2e, 0x2a, 0x84, 0x4e, 0x32, 0x10, 0x4b, 0x93, 0x84, 0x76, 0xad, 0x02, 0xf7,
+        0xbd, 0x0a, 0x18, 0xc6, 0x02, 0xf7, 0xbd, 0x84, 0x96, 0xad, 0x93, 0x84, 0x30, 0x53, 0x4e,
+        0x32, 0x10, 0x2e, 0x2a, 0x84, 0x8f, 0x3a, 0xd1, 0x63, 0xf5, 0x9c, 0xb6, 0xb5, 0x06, 0xf7,
+        0xbd, 0x81, 0x12, 0x74, 0x18, 0x2e, 0x2a, 0x89, 0xf2, 0x6b, 0x18, 0xc6, 0xf7, 0xbd, 0xd6,
+        0xb5, 0xb6, 0xad, 0xf5, 0x9c, 0x53, 0x7c, 0x50, 0x53, 0x6e, 0x32, 0x15, 0x2e, 0x2a, 0x86,
+        0xcf, 0x42, 0xd1, 0x63, 0x94, 0x8c, 0x55, 0xa5, 0xb6, 0xad, 0xd6, 0xb5, 0x04, 0xf7, 0xbd,
+        0x86, 0xd6, 0xb5, 0xb6, 0xad, 0x55, 0xa5, 0x94, 0x8c, 0xf2, 0x6b, 0xcf, 0x42, 0x15, 0x2e,
+        0x2a, 0x86, 0x6e, 0x32, 0x30, 0x53, 0x32, 0x7c, 0xf5, 0x9c, 0x96, 0xad, 0xb6, 0xb5, 0x02,
+        0xf7, 0xbd, 0x81, 0x12, 0x74, 0x0c, 0x2e, 0x2a, 0x0c, 0x2d, 0x2a, 0x86, 0x0f, 0x4b, 0x12,
+        0x74, 0xd1, 0x63, 0x50, 0x5b, 0xce, 0x42, 0x6d, 0x32, 0x1b, 0x2d, 0x2a, 0x84, 0x8e, 0x3a,
+        0x0f, 0x4b, 0x90, 0x5b, 0xf1, 0x6b, 0x02, 0x12, 0x74, 0x84, 0xf1, 0x6b, 0x90, 0x5b, 0x0f,
+        0x4b, 0x8e, 0x3a, 0x1b, 0x2d, 0x2a, 0x86, 0x6d, 0x32, 0xce, 0x42, 0x2f, 0x53, 0xb0, 0x63,
+        0x12, 0x74, 0x0f, 0x4b, 0x7f, 0x2d, 0x2a, 0x7f, 0x2d, 0x2a, 0x3a, 0x2d, 0x2a, 0x1b, 0x2d,
+        0x22, 0x83, 0x6d, 0x2a, 0xce, 0x3a, 0x0f, 0x43, 0x02, 0x50, 0x4b, 0x84, 0x30, 0x4b, 0xef,
+        0x3a, 0x8e, 0x2a, 0x4d, 0x22, 0x1c, 0x2d, 0x22, 0x84, 0x4d, 0x22, 0x8e, 0x2a, 0xef, 0x3a,
+        0x30, 0x4b, 0x02, 0x50, 0x4b, 0x83, 0x0f, 0x43, 0xce, 0x3a, 0x6d, 0x2a, 0x32, 0x2d, 0x22,
+        0x90, 0x4d, 0x22, 0xef, 0x3a, 0xb1, 0x5b, 0xb4, 0x8c, 0x35, 0x9d, 0x96, 0xa5, 0xf7, 0xb5,
+        0xf7, 0xbd, 0x18, 0xc6, 0x17, 0xbe, 0xd6, 0xb5, 0x75, 0xa5, 0x14, 0x95, 0x33, 0x74, 0x50,
+        0x4b, 0x8e, 0x2a, 0x16, 0x2d, 0x22, 0x90, 0x8e, 0x2a, 0x50, 0x4b, 0x33, 0x74, 0xf4, 0x8c,
+        0x75, 0xa5, 0xb6, 0xb5, 0xf7, 0xbd, 0x18, 0xc6, 0xf7, 0xbd, 0xd7, 0xb5, 0x76, 0xa5, 0x15,
+        0x9d, 0xb3, 0x84, 0xb1, 0x5b, 0xef, 0x3a, 0x4d, 0x22, 0x2c, 0x2d, 0x22, 0x84, 0x6d, 0x2a,
+        0x70, 0x53, 0xd4, 0x8c, 0xd6, 0xb5, 0x0c, 0x18, 0xc6, 0x84, 0xf7, 0xbd, 0x55, 0x9d, 0x33,
+        0x74, 0xef, 0x3a, 0x12, 0x2d, 0x22, 0x84, 0xce, 0x3a, 0x32, 0x74, 0x55, 0x9d, 0xf7, 0xbd,
+        0x02, 0x18, 0xc6, 0x09, 0xf7, 0xbd, 0x85, 0x18, 0xc6, 0xb6, 0xb5, 0xd4, 0x8c, 0x70, 0x53,
+        0x6d, 0x2a, 0x28, 0x2d, 0x22, 0x84, 0x6d, 0x2a, 0x91, 0x5b, 0x14, 0x95, 0xf7, 0xbd, 0x11,
+        0x18, 0xc6, 0x83, 0xb6, 0xad, 0x73, 0x7c, 0xef, 0x3a, 0x0e, 0x2d, 0x22, 0x84, 0xef, 0x3a,
+        0x53, 0x7c, 0xb6, 0xad, 0x18, 0xc6, 0x11, 0xf7, 0xbd, 0x83, 0x35, 0x9d, 0x91, 0x5b, 0x6d,
+        0x2a, 0x24, 0x2d, 0x22, 0x84, 0x8e, 0x2a, 0xb1, 0x5b, 0x35, 0x9d, 0xf7, 0xbd, 0x15, 0x18,
+        0xc6, 0x84, 0xb6, 0xad, 0x73, 0x7c, 0x0f, 0x43, 0x4d, 0x22, 0x08, 0x2d, 0x22, 0x85, 0x4d,
+        0x22, 0x0f, 0x43, 0x73, 0x7c, 0xb6, 0xad, 0x18, 0xc6, 0x15, 0xf7, 0xbd, 0x83, 0x35, 0x9d,
+        0xb1, 0x5b, 0xae, 0x32, 0x1d, 0x2d, 0x22, 0x87, 0x6d, 0x2a, 0xce, 0x3a, 0xef, 0x3a, 0x91,
+        0x5b, 0x73, 0x7c, 0x75, 0xa5, 0xf7, 0xbd, 0x19, 0x18, 0xc6, 0x85, 0xb6, 0xb5, 0xf4, 0x8c,
+        0x12, 0x6c, 0x30, 0x4b, 0xce, 0x3a, 0x02, 0xae, 0x32, 0x86, 0xce, 0x3a, 0x30, 0x4b, 0x12,
+        0x6c, 0xf4, 0x8c, 0xb6, 0xb5, 0x18, 0xc6, 0x19, 0xf7, 0xbd, 0x86, 0x55, 0xa5, 0x73, 0x7c,
+        0x91, 0x5b, 0xef, 0x3a, 0xce, 0x3a, 0x6d, 0x2a, 0x18, 0x2d, 0x22, 0x81, 0xf1, 0x63, 0x02,
+        0xf7, 0xb5, 0x81, 0xf7, 0xbd, 0x1c, 0x18, 0xc6, 0x81, 0xf7, 0xbd, 0x02, 0x18, 0xc6, 0x82,
+        0xd7, 0xb5, 0xb6, 0xb5, 0x02, 0xd6, 0xb5, 0x82, 0xb6, 0xb5, 0xd7, 0xb5, 0x02, 0x18, 0xc6,
+        0x1e, 0xf7, 0xbd, 0x02, 0xd7, 0xb5, 0x81, 0xf2, 0x6b, 0x18, 0x2d, 0x22, 0x81, 0xf2, 0x6b,
+        0x0e, 0x18, 0xc6, 0x83, 0xf7, 0xbd, 0xd6, 0xb5, 0x96, 0xad, 0x03, 0x76, 0xad, 0x83, 0xb6,
+        0xad, 0xd6, 0xb5, 0xf7, 0xbd, 0x07, 0x18, 0xc6, 0x16, 0xf7, 0xbd, 0x82, 0xd6, 0xb5, 0x96,
+        0xad, 0x04, 0x76, 0xad, 0x81, 0x96, 0xad, 0x0f, 0xf7, 0xbd, 0x81, 0x12, 0x6c, 0x18, 0x2d,
+        0x22, 0x81, 0xf2, 0x6b, 0x0b, 0x18, 0xc6, 0x86, 0xf7, 0xbd, 0xb6, 0xad, 0xd4, 0x94, 0xf1,
+        0x6b, 0x2f, 0x4b, 0xce, 0x3a, 0x02, 0x8e, 0x32, 0x86, 0xae, 0x32, 0xef, 0x42, 0x90, 0x5b,
+        0x73, 0x7c, 0x55, 0xa5, 0xf7, 0xbd, 0x03, 0x18, 0xc6, 0x16, 0xf7, 0xbd, 0x85, 0x55, 0xa5,
+        0x73, 0x7c, 0x90, 0x5b, 0xce, 0x3a, 0xae, 0x32, 0x02, 0x8e, 0x32, 0x85, 0xae, 0x32, 0x0f,
+        0x4b, 0xf1, 0x6b, 0xd4, 0x94, 0x96, 0xad, 0x0c, 0xf7, 0xbd, 0x81, 0x12, 0x6c, 0x18, 0x2d,
+        0x22, 0x81, 0xf2, 0x6b, 0x09, 0x18, 0xc6, 0x85, 0xf7, 0xbd, 0xb6, 0xad, 0x93, 0x84, 0x0f,
+        0x4b, 0x4d, 0x2a, 0x09, 0x2d, 0x22, 0x83, 0xae, 0x32, 0xb0, 0x5b, 0x15, 0x9d, 0x16, 0xf7,
+        0xbd, 0x83, 0x15, 0x9d, 0xd1, 0x63, 0xae, 0x32, 0x09, 0x2d, 0x22, 0x84, 0x4d, 0x2a, 0x0f,
+        0x4b, 0x52, 0x7c, 0x96, 0xad, 0x0a, 0xf7, 0xbd, 0x81, 0x12, 0x6c, 0x18, 0x2d, 0x22, 0x81,
+        0xf2, 0x6b, 0x07, 0x18, 0xc6, 0x84, 0xf7, 0xbd, 0xb6, 0xad, 0x73, 0x7c, 0x0f, 0x43, 0x0e,
+        0x2d, 0x22, 0x84, 0x8e, 0x32, 0xb0, 0x5b, 0xf4, 0x94, 0xd6, 0xb5, 0x11, 0xf7, 0xbd, 0x83,
+        0x15, 0x9d, 0xb0, 0x5b, 0x8e, 0x32, 0x0e, 0x2d, 0x22, 0x83, 0x0f, 0x43, 0x52, 0x7c, 0x76,
+        0xad, 0x08, 0xf7, 0xbd, 0x81, 0x12, 0x6c, 0x18, 0x2d, 0x22, 0x81, 0xf2, 0x6b, 0x04, 0x18,
+        0xc6, 0x85, 0xf7, 0xbd, 0xd6, 0xb5, 0x35, 0xa5, 0x32, 0x74, 0x0f, 0x43, 0x12, 0x2d, 0x22,
+        0x84, 0x6d, 0x2a, 0x70, 0x5b, 0x93, 0x8c, 0x96, 0xad, 0x0c, 0xf7, 0xbd, 0x84, 0x96, 0xad,
+        0xb4, 0x8c, 0x90, 0x5b, 0x8e, 0x32, 0x12, 0x2d, 0x22, 0x84, 0xee, 0x3a, 0x12, 0x74, 0x15,
+        0x9d, 0xb6, 0xb5, 0x05, 0xf7, 0xbd, 0x81, 0x12, 0x6c, 0x18, 0x2d, 0x22, 0x88, 0xf1, 0x63,
+        0xd6, 0xb5, 0x96, 0xad, 0x35, 0x9d, 0xb4, 0x8c, 0x32, 0x74, 0x2f, 0x4b, 0x8e, 0x32, 0x17,
+        0x2d, 0x22, 0x86, 0xee, 0x3a, 0x90, 0x5b, 0x93, 0x84, 0xf4, 0x94, 0x55, 0xa5, 0x96, 0xad,
+        0x02, 0xb6, 0xb5, 0x86, 0x96, 0xad, 0x55, 0xa5, 0xf4, 0x94, 0x72, 0x7c, 0x91, 0x5b, 0xee,
+        0x3a, 0x17, 0x2d, 0x22, 0x88, 0x8e, 0x32, 0x2f, 0x4b, 0xf1, 0x6b, 0xb3, 0x84, 0x15, 0x9d,
+        0x76, 0xad, 0xd7, 0xbd, 0xf2, 0x6b, 0x18, 0x2d, 0x22, 0x84, 0x8e, 0x32, 0xef, 0x42, 0xee,
+        0x3a, 0x8e, 0x32, 0x1e, 0x2d, 0x22, 0x83, 0x4d, 0x2a, 0xae, 0x32, 0xce, 0x3a, 0x02, 0x0f,
+        0x4b, 0x83, 0xef, 0x42, 0xae, 0x32, 0x4d, 0x2a, 0x1e, 0x2d, 0x22, 0x84, 0x8e, 0x32, 0xce,
+        0x3a, 0xef, 0x42, 0x8e, 0x32, 0x7f, 0x2d, 0x22, 0x7f, 0x2d, 0x22, 0x7f, 0x2d, 0x22, 0x1f,
+        0x2d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f,
+        0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x26, 0x0d, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x7f,
+        0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x5c, 0x0c, 0x22,
+
+};
+
+const lv_image_dsc_t image_haze_fog_dust_smoke_opaque = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
+    .header.w = 100,
+    .header.h = 100,
+    .header.stride = 200,
+    .header.reserved_2 = 0,
+    .data_size = sizeof(image_haze_fog_dust_smoke_opaque_map),
+    .data = image_haze_fog_dust_smoke_opaque_map,
+    .reserved = NULL,
+};
@@ -0,0 +1,249 @@
+// Generated by tools/flatten_images.py from image_isolated_scattered_tstorms_night.c: pre-blended onto the
+// main screen gradient at y = 4. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_ISOLATED_SCATTERED_TSTORMS_NIGHT_OPAQUE
+  #define LV_ATTRIBUTE_IMAGE_ISOLATED_SCATTERED_TSTORMS_NIGHT_OPAQUE
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_ISOLATED_SCATTERED_TSTORMS_NIGHT_OPAQUE uint8_t
+    image_isolated_scattered_tstorms_night_opaque_map[] = {
+
+        0x01, 0x00, 0x00, 0x00, 0xf2, 0x0b, 0x00, 0x00, 0x20, 0x4e, 0x00, 0x00, 0x7f, 0x90, 0x2a,
+        0x25, 0x90, 0x2a, 0x81, 0xb0, 0x2a, 0x60, 0x90, 0x2a, 0x85, 0xd0, 0x32, 0xb4, 0x53, 0x97,
+        0x74, 0xd7, 0x7c, 0xf1, 0x32, 0x5d, 0x90, 0x2a, 0x87, 0x11, 0x3b, 0x76, 0x6c, 0xfb, 0xa5,
+        0x9e, 0xbe, 0xff, 0xce, 0xba, 0x9d, 0xd0, 0x32, 0x22, 0x90, 0x2a, 0x39, 0x8f, 0x2a, 0x83,
+        0xaf, 0x2a, 0x14, 0x5c, 0xfb, 0xa5, 0x02, 0xff, 0xce, 0x02, 0xdf, 0xce, 0x81, 0x18, 0x85,
+        0x5b, 0x8f, 0x2a, 0x83, 0xd0, 0x32, 0xd7, 0x7c, 0x9e, 0xbe, 0x04, 0xff, 0xce, 0x82, 0xdf,
+        0xce, 0x18, 0x85, 0x5a, 0x8f, 0x2a, 0x82, 0xd0, 0x32, 0x18, 0x85, 0x06, 0xff, 0xce, 0x82,
+        0xdf, 0xce, 0xf8, 0x84, 0x59, 0x8f, 0x2a, 0x82, 0xaf, 0x2a, 0xd7, 0x7c, 0x07, 0xff, 0xce,
+        0x82, 0xdf, 0xce, 0x18, 0x85, 0x40, 0x8f, 0x2a, 0x8d, 0xf0, 0x3a, 0x71, 0x4b, 0xd2, 0x5b,
+        0x95, 0x7c, 0x16, 0x8d, 0x57, 0x9d, 0x77, 0xa5, 0x57, 0x9d, 0x16, 0x8d, 0x74, 0x74, 0xd2,
+        0x5b, 0x71, 0x4b, 0xcf, 0x32, 0x0c, 0x8f, 0x2a, 0x82, 0x14, 0x5c, 0x9e, 0xbe, 0x07, 0xff,
+        0xce, 0x83, 0xdf, 0xce, 0x39, 0x8d, 0xaf, 0x2a, 0x3c, 0x8f, 0x2a, 0x86, 0x10, 0x3b, 0x33,
+        0x6c, 0x77, 0xa5, 0x39, 0xbe, 0xfc, 0xde, 0x1c, 0xe7, 0x07, 0x5d, 0xef, 0x86, 0x1c, 0xe7,
+        0xdb, 0xd6, 0x19, 0xbe, 0x36, 0x95, 0xd2, 0x5b, 0xf0, 0x3a, 0x08, 0x8f, 0x2a, 0x82, 0x11,
+        0x3b, 0xfb, 0xa5, 0x09, 0xff, 0xce, 0x82, 0xfb, 0xa5, 0xf0, 0x32, 0x22, 0x8f, 0x2a, 0x18,
+        0x6f, 0x2a, 0x84, 0x51, 0x4b, 0x16, 0x95, 0x7a, 0xce, 0x1c, 0xe7, 0x0f, 0x5d, 0xef, 0x84,
+        0x1c, 0xe7, 0x39, 0xbe, 0xb5, 0x84, 0x31, 0x43, 0x06, 0x6f, 0x2a, 0x81, 0x56, 0x6c, 0x02,
+        0xdf, 0xce, 0x08, 0xff, 0xce, 0x82, 0x9e, 0xbe, 0x52, 0x4b, 0x38, 0x6f, 0x2a, 0x83, 0x11,
+        0x43, 0x16, 0x95, 0xbb, 0xd6, 0x15, 0x5d, 0xef, 0x83, 0x7a, 0xce, 0xb5, 0x84, 0xd0, 0x3a,
+        0x03, 0x6f, 0x2a, 0x83, 0xaf, 0x32, 0xdb, 0xa5, 0xdf, 0xc6, 0x02, 0xdf, 0xce, 0x07, 0xff,
+        0xce, 0x82, 0xdf, 0xce, 0xb7, 0x7c, 0x36, 0x6f, 0x2a, 0x83, 0x8f, 0x2a, 0x54, 0x74, 0x7a,
+        0xce, 0x19, 0x5d, 0xef, 0x86, 0x39, 0xbe, 0xb2, 0x5b, 0x8f, 0x2a, 0x6f, 0x2a, 0xb3, 0x53,
+        0x7e, 0xb6, 0x02, 0xdf, 0xc6, 0x02, 0xdf, 0xce, 0x06, 0xff, 0xce, 0x83, 0xdf, 0xce, 0x1c,
+        0xae, 0xd0, 0x32, 0x34, 0x6f, 0x2a, 0x83, 0xf0, 0x3a, 0x57, 0x9d, 0x1c, 0xe7, 0x1b, 0x5d,
+        0xef, 0x85, 0xfc, 0xde, 0xd6, 0x84, 0xaf, 0x32, 0x35, 0x6c, 0xbf, 0xc6, 0x03, 0xdf, 0xc6,
+        0x02, 0xdf, 0xce, 0x05, 0xff, 0xce, 0x02, 0xdf, 0xce, 0x81, 0x76, 0x74, 0x33, 0x6f, 0x2a,
+        0x82, 0x11, 0x43, 0x19, 0xbe, 0x1e, 0x5d, 0xef, 0x85, 0x1c, 0xe7, 0x98, 0xa5, 0x79, 0x95,
+        0xbe, 0xc6, 0xbf, 0xc6, 0x03, 0xdf, 0xc6, 0x02, 0xdf, 0xce, 0x04, 0xff, 0xce, 0x02, 0xdf,
+        0xce, 0x82, 0x5d, 0xb6, 0x72, 0x4b, 0x31, 0x6f, 0x2a, 0x82, 0x51, 0x4b, 0x39, 0xbe, 0x21,
+        0x5d, 0xef, 0x84, 0x3d, 0xe7, 0xde, 0xce, 0xbe, 0xc6, 0xbf, 0xc6, 0x03, 0xdf, 0xc6, 0x02,
+        0xdf, 0xce, 0x03, 0xff, 0xce, 0x03, 0xdf, 0xce, 0x82, 0xdb, 0xa5, 0xf0, 0x3a, 0x2f, 0x6f,
+        0x2a, 0x82, 0x11, 0x43, 0x39, 0xbe, 0x23, 0x5d, 0xef, 0x81, 0x3d, 0xdf, 0x02, 0xbe, 0xc6,
+        0x81, 0xbf, 0xc6, 0x03, 0xdf, 0xc6, 0x81, 0xdf, 0xce, 0x03, 0xff, 0xce, 0x04, 0xdf, 0xce,
+        0x82, 0x59, 0x95, 0xd0, 0x32, 0x2d, 0x6f, 0x2a, 0x82, 0xf0, 0x3a, 0xf9, 0xb5, 0x25, 0x5d,
+        0xef, 0x81, 0x1d, 0xdf, 0x02, 0xbe, 0xc6, 0x81, 0xbf, 0xc6, 0x03, 0xdf, 0xc6, 0x81, 0xdf,
+        0xce, 0x02, 0xff, 0xce, 0x04, 0xdf, 0xce, 0x83, 0xff, 0xce, 0x9a, 0x9d, 0x11, 0x43, 0x2b,
+        0x6f, 0x2a, 0x82, 0x8f, 0x2a, 0x57, 0x9d, 0x27, 0x5d, 0xef, 0x84, 0xfe, 0xd6, 0x9e, 0xc6,
+        0xbe, 0xc6, 0xbf, 0xc6, 0x02, 0xdf, 0xc6, 0x81, 0xdf, 0xce, 0x02, 0xff, 0xce, 0x06, 0xdf,
+        0xce, 0x83, 0x1c, 0xae, 0xf4, 0x5b, 0x8f, 0x2a, 0x29, 0x6f, 0x2a, 0x82, 0x34, 0x6c, 0x1c,
+        0xe7, 0x27, 0x5d, 0xef, 0x84, 0x5d, 0xe7, 0xde, 0xce, 0x9e, 0xc6, 0xbe, 0xc6, 0x03, 0xdf,
+        0xc6, 0x09, 0xdf, 0xce, 0x84, 0x9e, 0xbe, 0x59, 0x95, 0xb3, 0x53, 0xaf, 0x32, 0x26, 0x6f,
+        0x2a, 0x82, 0xf0, 0x3a, 0x5a, 0xc6, 0x29, 0x5d, 0xef, 0x81, 0x3d, 0xe7, 0x02, 0xbe, 0xc6,
+        0x81, 0xbf, 0xc6, 0x0c, 0xdf, 0xc6, 0x86, 0xdf, 0xce, 0xbe, 0xc6, 0xfb, 0xa5, 0xf8, 0x84,
+        0xf4, 0x5b, 0x93, 0x53, 0x02, 0x72, 0x4b, 0x81, 0xd0, 0x32, 0x20, 0x6f, 0x2a, 0x81, 0xf6,
+        0x8c, 0x2b, 0x5d, 0xef, 0x84, 0xfe, 0xd6, 0x9e, 0xc6, 0xbe, 0xc6, 0xbf, 0xc6, 0x0f, 0xdf,
+        0xc6, 0x02, 0x9e, 0xc6, 0x83, 0xbe, 0xc6, 0x9e, 0xbe, 0xb4, 0x5b, 0x1f, 0x6f, 0x2a, 0x82,
+        0x11, 0x43, 0xbb, 0xd6, 0x2b, 0x5d, 0xef, 0x81, 0x3d, 0xe7, 0x03, 0xbe, 0xc6, 0x81, 0xbf,
+        0xc6, 0x11, 0xdf, 0xc6, 0x82, 0xfc, 0xa5, 0xd0, 0x32, 0x1f, 0x6f, 0x2a, 0x81, 0xd6, 0x8c,
+        0x2d, 0x5d, 0xef, 0x84, 0xfe, 0xd6, 0x9e, 0xbe, 0x9e, 0xc6, 0xbe, 0xc6, 0x10, 0xbf, 0xc6,
+        0x82, 0x7e, 0xbe, 0x35, 0x64, 0x1f, 0x6f, 0x2a, 0x82, 0xd0, 0x3a, 0x39, 0xbe, 0x2d, 0x5d,
+        0xef, 0x81, 0x1d, 0xdf, 0x13, 0xbe, 0xc6, 0x82, 0x39, 0x95, 0xaf, 0x32, 0x1f, 0x6f, 0x2a,
+        0x82, 0xf3, 0x63, 0x1c, 0xe7, 0x2e, 0x5d, 0xef, 0x0f, 0x5d, 0xe7, 0x02, 0x3d, 0xe7, 0x83,
+        0x1e, 0xdf, 0x7d, 0xc6, 0xb3, 0x5b, 0x20, 0x6f, 0x2a, 0x81, 0x16, 0x95, 0x42, 0x5d, 0xef,
+        0x83, 0x7a, 0xce, 0xf6, 0x8c, 0x51, 0x4b, 0x1d, 0x6f, 0x2a, 0x82, 0xaf, 0x32, 0x19, 0xbe,
+        0x44, 0x5d, 0xef, 0x83, 0xbb, 0xd6, 0xd6, 0x84, 0xd0, 0x3a, 0x1b, 0x6f, 0x2a, 0x82, 0x31,
+        0x43, 0xdb, 0xd6, 0x46, 0x5d, 0xef, 0x82, 0x19, 0xbe, 0x71, 0x53, 0x1a, 0x6f, 0x2a, 0x82,
+        0x92, 0x53, 0xfc, 0xde, 0x18, 0x5d, 0xef, 0x82, 0x3b, 0xef, 0xf9, 0xee, 0x04, 0x3c, 0xe7,
+        0x29, 0x5d, 0xef, 0x82, 0x7a, 0xce, 0xd3, 0x63, 0x19, 0x6f, 0x2a, 0x82, 0x33, 0x6c, 0x1c,
+        0xe7, 0x17, 0x5d, 0xef, 0x84, 0x5d, 0xe7, 0x95, 0xf6, 0x53, 0xee, 0x1c, 0xe7, 0x04, 0x3c,
+        0xe7, 0x29, 0x5d, 0xef, 0x82, 0x9b, 0xce, 0xb2, 0x5b, 0x18, 0x6f, 0x2a, 0x81, 0xb5, 0x84,
+        0x17, 0x5d, 0xef, 0x84, 0x5d, 0xe7, 0xfa, 0xee, 0xcd, 0xfd, 0x32, 0xee, 0x02, 0xfb, 0xde,
+        0x81, 0x1c, 0xe7, 0x03, 0x3c, 0xe7, 0x29, 0x5d, 0xef, 0x82, 0x5a, 0xc6, 0x11, 0x43, 0x17,
+        0x6f, 0x2a, 0x81, 0xf6, 0x8c, 0x17, 0x5d, 0xef, 0x84, 0x3c, 0xe7, 0x52, 0xf6, 0x89, 0xfd,
+        0x32, 0xee, 0x02, 0xdb, 0xde, 0x82, 0xfb, 0xde, 0x1c, 0xe7, 0x02, 0x3c, 0xe7, 0x2a, 0x5d,
+        0xef, 0x82, 0x77, 0xa5, 0xaf, 0x32, 0x16, 0x6f, 0x2a, 0x81, 0x16, 0x95, 0x16, 0x5d, 0xef,
+        0x85, 0x3d, 0xe7, 0xb7, 0xee, 0xab, 0xfd, 0x89, 0xfd, 0x32, 0xee, 0x03, 0xdb, 0xde, 0x81,
+        0xfb, 0xde, 0x03, 0x3c, 0xe7, 0x29, 0x5d, 0xef, 0x82, 0x1c, 0xe7, 0x34, 0x6c, 0x0c, 0x6f,
+        0x2a, 0x0a, 0x6e, 0x2a, 0x81, 0xd5, 0x8c, 0x15, 0x5d, 0xef, 0x83, 0x5d, 0xe7, 0x1b, 0xef,
+        0x0e, 0xfe, 0x02, 0x89, 0xfd, 0x81, 0x32, 0xee, 0x03, 0xdb, 0xde, 0x82, 0xfb, 0xde, 0x1c,
+        0xe7, 0x02, 0x3c, 0xe7, 0x2a, 0x5d, 0xef, 0x82, 0x39, 0xbe, 0xcf, 0x3a, 0x0b, 0x6e, 0x2a,
+        0x0a, 0x4e, 0x2a, 0x81, 0x74, 0x7c, 0x15, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0x74, 0xf6, 0x8a,
+        0xfd, 0x02, 0x89, 0xfd, 0x82, 0x32, 0xee, 0xdb, 0xd6, 0x02, 0xdb, 0xde, 0x02, 0xfb, 0xde,
+        0x82, 0x1c, 0xe7, 0x3c, 0xe7, 0x2a, 0x5d, 0xef, 0x82, 0x1c, 0xe7, 0xf2, 0x63, 0x15, 0x4e,
+        0x2a, 0x82, 0xb2, 0x63, 0x1c, 0xe7, 0x13, 0x5d, 0xef, 0x83, 0x5d, 0xe7, 0xf9, 0xee, 0xcc,
+        0xfd, 0x03, 0x89, 0xfd, 0x82, 0x32, 0xee, 0xdb, 0xd6, 0x02, 0xdb, 0xde, 0x81, 0xfb, 0xde,
+        0x02, 0x1c, 0xe7, 0x81, 0x3c, 0xe7, 0x2b, 0x5d, 0xef, 0x82, 0x56, 0x9d, 0x6e, 0x2a, 0x14,
+        0x4e, 0x2a, 0x82, 0x30, 0x4b, 0xfc, 0xde, 0x12, 0x5d, 0xef, 0x83, 0x3d, 0xe7, 0x3b, 0xe7,
+        0x30, 0xf6, 0x03, 0x89, 0xfd, 0x83, 0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0x02, 0xdb, 0xde,
+        0x81, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x81, 0x3c, 0xe7, 0x2a, 0x5d, 0xef, 0x82, 0x7a, 0xce,
+        0xcf, 0x3a, 0x14, 0x4e, 0x2a, 0x82, 0xcf, 0x3a, 0x7a, 0xce, 0x12, 0x5d, 0xef, 0x83, 0x3c,
+        0xe7, 0x95, 0xf6, 0xaa, 0xfd, 0x03, 0x89, 0xfd, 0x85, 0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6,
+        0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x03, 0x3c, 0xe7, 0x29, 0x5d, 0xef, 0x82, 0xfc,
+        0xde, 0x51, 0x53, 0x14, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x77, 0xa5, 0x11, 0x5d, 0xef, 0x83,
+        0x3d, 0xe7, 0xfa, 0xee, 0xed, 0xfd, 0x04, 0x89, 0xfd, 0x85, 0x69, 0xfd, 0x12, 0xee, 0xdb,
+        0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x02, 0x3c, 0xe7, 0x82, 0x1c, 0xe7, 0x3c,
+        0xe7, 0x28, 0x5d, 0xef, 0x82, 0x1c, 0xe7, 0x13, 0x6c, 0x15, 0x4e, 0x2a, 0x81, 0x94, 0x7c,
+        0x10, 0x5d, 0xef, 0x83, 0x3d, 0xe7, 0x3c, 0xe7, 0x52, 0xf6, 0x05, 0x89, 0xfd, 0x85, 0x69,
+        0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x02, 0x3c, 0xe7,
+        0x81, 0x1c, 0xe7, 0x02, 0x3c, 0xe7, 0x28, 0x5d, 0xef, 0x81, 0xd5, 0x8c, 0x15, 0x4e, 0x2a,
+        0x82, 0x30, 0x4b, 0xdb, 0xd6, 0x0f, 0x5d, 0xef, 0x83, 0x3d, 0xe7, 0xd7, 0xee, 0xab, 0xfd,
+        0x05, 0x89, 0xfd, 0x85, 0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x05,
+        0x1c, 0xe7, 0x04, 0x3c, 0xe7, 0x27, 0x5d, 0xef, 0x81, 0xf5, 0x8c, 0x15, 0x4e, 0x2a, 0x82,
+        0x8e, 0x32, 0x98, 0xa5, 0x0e, 0x5d, 0xef, 0x83, 0x5d, 0xe7, 0x1b, 0xef, 0x0e, 0xfe, 0x06,
+        0x89, 0xfd, 0x85, 0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x04, 0x1c,
+        0xe7, 0x06, 0x3c, 0xe7, 0x26, 0x5d, 0xef, 0x81, 0xd5, 0x8c, 0x16, 0x4e, 0x2a, 0x82, 0x13,
+        0x6c, 0x1c, 0xe7, 0x0d, 0x5d, 0xef, 0x82, 0x3c, 0xe7, 0x74, 0xf6, 0x07, 0x89, 0xfd, 0x85,
+        0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x08, 0x3c,
+        0xe7, 0x25, 0x5d, 0xef, 0x81, 0x74, 0x7c, 0x16, 0x4e, 0x2a, 0x82, 0x8e, 0x32, 0xf8, 0xb5,
+        0x0c, 0x5d, 0xef, 0x83, 0x5d, 0xe7, 0xf9, 0xee, 0xcc, 0xfd, 0x07, 0x89, 0xfd, 0x85, 0x69,
+        0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x09, 0x3c, 0xe7,
+        0x23, 0x5d, 0xef, 0x82, 0x1c, 0xe7, 0x91, 0x5b, 0x17, 0x4e, 0x2a, 0x82, 0x13, 0x6c, 0xfb,
+        0xde, 0x0b, 0x5d, 0xef, 0x82, 0x3c, 0xef, 0x30, 0xf6, 0x08, 0x89, 0xfd, 0x85, 0x68, 0xfd,
+        0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x0a, 0x3c, 0xe7, 0x22,
+        0x5d, 0xef, 0x82, 0xba, 0xce, 0x10, 0x43, 0x17, 0x4e, 0x2a, 0x82, 0x8e, 0x32, 0x77, 0xa5,
+        0x0a, 0x5d, 0xef, 0x83, 0x3d, 0xe7, 0x95, 0xf6, 0x8a, 0xfd, 0x08, 0x89, 0xfd, 0x85, 0x68,
+        0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x0b, 0x3c, 0xe7,
+        0x21, 0x5d, 0xef, 0x82, 0xd8, 0xad, 0x8e, 0x32, 0x18, 0x4e, 0x2a, 0x82, 0x30, 0x4b, 0x9a,
+        0xce, 0x08, 0x5d, 0xef, 0x83, 0x3d, 0xe7, 0xfa, 0xee, 0xcd, 0xfd, 0x09, 0x89, 0xfd, 0x85,
+        0x68, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x06, 0x1c, 0xe7, 0x09, 0x3c,
+        0xe7, 0x1f, 0x5d, 0xef, 0x82, 0x3c, 0xe7, 0x54, 0x7c, 0x1a, 0x4e, 0x2a, 0x82, 0x13, 0x6c,
+        0xdb, 0xd6, 0x06, 0x5d, 0xef, 0x02, 0x3c, 0xe7, 0x81, 0x52, 0xf6, 0x09, 0x89, 0xfd, 0x86,
+        0x69, 0xfd, 0x68, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x06, 0x1c, 0xe7,
+        0x0a, 0x3c, 0xe7, 0x1e, 0x5d, 0xef, 0x82, 0x9a, 0xce, 0xf0, 0x42, 0x1a, 0x4e, 0x2a, 0x83,
+        0x6e, 0x2a, 0xb4, 0x84, 0x3c, 0xe7, 0x04, 0x5d, 0xef, 0x84, 0x3c, 0xe7, 0x3d, 0xe7, 0xb7,
+        0xee, 0xab, 0xfd, 0x07, 0x89, 0xfd, 0x04, 0x69, 0xfd, 0x81, 0x11, 0xee, 0x02, 0xb9, 0xde,
+        0x82, 0xd9, 0xe6, 0xda, 0xe6, 0x08, 0xfa, 0xe6, 0x04, 0x1c, 0xe7, 0x04, 0x3c, 0xe7, 0x1c,
+        0x5d, 0xef, 0x82, 0x3c, 0xe7, 0xb5, 0x84, 0x1c, 0x4e, 0x2a, 0x83, 0x8e, 0x32, 0xf5, 0x8c,
+        0x3c, 0xe7, 0x03, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0x1b, 0xef, 0xee, 0xfd, 0x06, 0x89, 0xfd,
+        0x06, 0x69, 0xfd, 0x81, 0x8a, 0xfd, 0x04, 0xac, 0xfd, 0x06, 0xcc, 0xfd, 0x83, 0xab, 0xfd,
+        0x32, 0xf6, 0x1b, 0xe7, 0x04, 0x1c, 0xe7, 0x04, 0x3c, 0xe7, 0x1b, 0x5d, 0xef, 0x82, 0x39,
+        0xbe, 0xcf, 0x3a, 0x1d, 0x4e, 0x2a, 0x84, 0x8e, 0x32, 0xf5, 0x8c, 0xfb, 0xde, 0x5d, 0xef,
+        0x02, 0x3c, 0xe7, 0x81, 0x73, 0xf6, 0x04, 0x89, 0xfd, 0x0e, 0x69, 0xfd, 0x06, 0x68, 0xfd,
+        0x83, 0x8b, 0xfd, 0x97, 0xe6, 0xfc, 0xde, 0x05, 0x1c, 0xe7, 0x04, 0x3c, 0xe7, 0x19, 0x5d,
+        0xef, 0x82, 0xdb, 0xd6, 0xb2, 0x5b, 0x1f, 0x4e, 0x2a, 0x86, 0x6e, 0x2a, 0x94, 0x84, 0xdb,
+        0xd6, 0x3c, 0xe7, 0xd8, 0xee, 0xcc, 0xfd, 0x16, 0x69, 0xfd, 0x84, 0x68, 0xfd, 0x69, 0xfd,
+        0x32, 0xee, 0xdb, 0xde, 0x03, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x05, 0x3c, 0xe7, 0x17, 0x5d,
+        0xef, 0x83, 0xfb, 0xde, 0x74, 0x7c, 0x6e, 0x2a, 0x21, 0x4e, 0x2a, 0x83, 0xd2, 0x63, 0x38,
+        0xc6, 0x30, 0xf6, 0x15, 0x69, 0xfd, 0x03, 0x68, 0xfd, 0x82, 0xcd, 0xf5, 0xb9, 0xde, 0x02,
+        0xdb, 0xde, 0x02, 0xfb, 0xde, 0x04, 0x1c, 0xe7, 0x05, 0x3c, 0xe7, 0x15, 0x5d, 0xef, 0x83,
+        0xfb, 0xde, 0xb5, 0x84, 0x6e, 0x2a, 0x23, 0x4e, 0x2a, 0x82, 0xce, 0x7b, 0x8a, 0xfd, 0x14,
+        0x69, 0xfd, 0x03, 0x68, 0xfd, 0x83, 0x8a, 0xfd, 0x55, 0xe6, 0xbb, 0xd6, 0x03, 0xdb, 0xde,
+        0x81, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x07, 0x3c, 0xe7, 0x12, 0x5d, 0xef, 0x84, 0x5c, 0xef,
+        0x9a, 0xce, 0x53, 0x74, 0x6e, 0x2a, 0x23, 0x4e, 0x2a, 0x82, 0x8d, 0x3a, 0xaa, 0xcc, 0x13,
+        0x69, 0xfd, 0x05, 0x68, 0xfd, 0x81, 0xf0, 0xed, 0x03, 0xba, 0xd6, 0x81, 0xdb, 0xde, 0x02,
+        0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x08, 0x3c, 0xe7, 0x10, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0xd8,
+        0xb5, 0x91, 0x5b, 0x25, 0x4e, 0x2a, 0x81, 0xcb, 0x93, 0x13, 0x69, 0xfd, 0x05, 0x68, 0xfd,
+        0x82, 0xac, 0xf5, 0x78, 0xde, 0x02, 0xba, 0xd6, 0x02, 0xdb, 0xde, 0x81, 0xfb, 0xde, 0x03,
+        0x1c, 0xe7, 0x0a, 0x3c, 0xe7, 0x0c, 0x5d, 0xef, 0x85, 0x3c, 0xe7, 0xfb, 0xde, 0xf8, 0xb5,
+        0x33, 0x74, 0xaf, 0x32, 0x25, 0x4e, 0x2a, 0x82, 0x0d, 0x5b, 0x09, 0xe5, 0x11, 0x69, 0xfd,
+        0x06, 0x68, 0xfd, 0x82, 0x69, 0xfd, 0x13, 0xe6, 0x03, 0x9a, 0xd6, 0x81, 0xba, 0xd6, 0x02,
+        0xdb, 0xde, 0x03, 0xfb, 0xde, 0x0b, 0x1c, 0xe7, 0x08, 0x3c, 0xe7, 0x86, 0xdb, 0xd6, 0x7a,
+        0xce, 0xd8, 0xb5, 0xf5, 0x94, 0xb2, 0x5b, 0xaf, 0x32, 0x26, 0x4e, 0x2a, 0x82, 0x6d, 0x32,
+        0x6a, 0xb4, 0x0f, 0x69, 0xfd, 0x09, 0x68, 0xfd, 0x82, 0x4a, 0xb4, 0x91, 0x63, 0x04, 0xb1,
+        0x5b, 0x81, 0xb1, 0x63, 0x04, 0xb2, 0x63, 0x13, 0xd2, 0x63, 0x83, 0x91, 0x5b, 0xf0, 0x42,
+        0x8e, 0x32, 0x29, 0x4e, 0x2a, 0x82, 0x8b, 0x7b, 0x49, 0xf5, 0x0d, 0x69, 0xfd, 0x0a, 0x68,
+        0xfd, 0x82, 0xc8, 0xd4, 0xad, 0x42, 0x48, 0x4e, 0x2a, 0x82, 0xad, 0x42, 0xe9, 0xd4, 0x0a,
+        0x69, 0xfd, 0x0d, 0x68, 0xfd, 0x82, 0x48, 0xf5, 0x6c, 0x73, 0x38, 0x4e, 0x2a, 0x10, 0x2e,
+        0x2a, 0x83, 0x2d, 0x2a, 0x2a, 0xac, 0x69, 0xfd, 0x17, 0x68, 0xfd, 0x82, 0x49, 0xb4, 0x4d,
+        0x32, 0x18, 0x2e, 0x2a, 0x81, 0x4e, 0x2a, 0x2f, 0x2e, 0x2a, 0x82, 0x6d, 0x3a, 0x6b, 0x83,
+        0x0a, 0xab, 0x93, 0x82, 0xaa, 0x93, 0x08, 0xe5, 0x0b, 0x68, 0xfd, 0x82, 0x08, 0xe5, 0xcc,
+        0x52, 0x18, 0x2e, 0x2a, 0x84, 0x31, 0x23, 0x79, 0x1d, 0x95, 0x24, 0x4e, 0x2a, 0x39, 0x2e,
+        0x2a, 0x82, 0x2d, 0x2a, 0xa9, 0xcc, 0x0b, 0x68, 0xfd, 0x81, 0xab, 0x93, 0x18, 0x2e, 0x2a,
+        0x86, 0x92, 0x23, 0x5c, 0x16, 0x3f, 0x07, 0xfe, 0x0e, 0xf7, 0x1c, 0x8f, 0x2a, 0x1c, 0x2e,
+        0x2a, 0x1c, 0x2d, 0x2a, 0x82, 0x2c, 0x2a, 0xa9, 0xcc, 0x0a, 0x68, 0xfd, 0x82, 0x69, 0xc4,
+        0x6c, 0x3a, 0x17, 0x2d, 0x2a, 0x82, 0xf3, 0x23, 0xbd, 0x0e, 0x04, 0x3f, 0x07, 0x82, 0x78,
+        0x1d, 0xcf, 0x2a, 0x37, 0x2d, 0x2a, 0x82, 0x2c, 0x2a, 0xa9, 0xcc, 0x09, 0x68, 0xfd, 0x82,
+        0x28, 0xed, 0x0b, 0x63, 0x17, 0x2d, 0x2a, 0x82, 0x92, 0x23, 0xbd, 0x0e, 0x06, 0x3f, 0x07,
+        0x82, 0x58, 0x1d, 0x6e, 0x2a, 0x36, 0x2d, 0x2a, 0x82, 0x2c, 0x2a, 0xa9, 0xcc, 0x09, 0x68,
+        0xfd, 0x82, 0xea, 0xa3, 0x2c, 0x2a, 0x16, 0x2d, 0x2a, 0x82, 0xcf, 0x22, 0x1b, 0x0e, 0x07,
+        0x3f, 0x07, 0x82, 0xfe, 0x06, 0x54, 0x24, 0x36, 0x2d, 0x2a, 0x82, 0x2c, 0x2a, 0xa9, 0xcc,
+        0x08, 0x68, 0xfd, 0x82, 0xc8, 0xd4, 0x8c, 0x42, 0x17, 0x2d, 0x2a, 0x81, 0xb6, 0x1c, 0x09,
+        0x3f, 0x07, 0x82, 0x5c, 0x0e, 0xef, 0x22, 0x19, 0x2d, 0x2a, 0x1c, 0x2d, 0x22, 0x82, 0x2c,
+        0x22, 0xa9, 0xcc, 0x07, 0x68, 0xfd, 0x82, 0x48, 0xf5, 0x6a, 0x73, 0x17, 0x2d, 0x22, 0x82,
+        0xcf, 0x1a, 0x5c, 0x0e, 0x0a, 0x3f, 0x07, 0x81, 0x75, 0x1c, 0x35, 0x2d, 0x22, 0x82, 0x2c,
+        0x22, 0xa9, 0xcc, 0x07, 0x68, 0xfd, 0x82, 0x49, 0xb4, 0x4c, 0x2a, 0x17, 0x2d, 0x22, 0x82,
+        0xb2, 0x1b, 0xfe, 0x06, 0x0a, 0x3f, 0x07, 0x82, 0xb9, 0x0d, 0x6e, 0x1a, 0x34, 0x2d, 0x22,
+        0x82, 0x2c, 0x22, 0xa9, 0xcc, 0x06, 0x68, 0xfd, 0x82, 0xc8, 0xdc, 0xcb, 0x4a, 0x18, 0x2d,
+        0x22, 0x81, 0x75, 0x14, 0x0b, 0x3f, 0x07, 0x82, 0x7c, 0x06, 0x8e, 0x1a, 0x34, 0x2d, 0x22,
+        0x82, 0x2c, 0x22, 0xa9, 0xcc, 0x06, 0x68, 0xfd, 0x81, 0x8a, 0x83, 0x19, 0x2d, 0x22, 0x81,
+        0x54, 0x14, 0x0b, 0x3f, 0x07, 0x82, 0x1b, 0x06, 0x8e, 0x1a, 0x34, 0x2d, 0x22, 0x82, 0x2c,
+        0x22, 0xa9, 0xcc, 0x05, 0x68, 0xfd, 0x82, 0x69, 0xc4, 0x6c, 0x32, 0x19, 0x2d, 0x22, 0x82,
+        0x51, 0x1b, 0xdd, 0x06, 0x0a, 0x3f, 0x07, 0x82, 0x38, 0x0d, 0x4d, 0x1a, 0x34, 0x2d, 0x22,
+        0x82, 0x2c, 0x22, 0xa9, 0xcc, 0x04, 0x68, 0xfd, 0x82, 0x08, 0xed, 0x0b, 0x63, 0x1a, 0x2d,
+        0x22, 0x82, 0x6e, 0x1a, 0xb9, 0x0d, 0x09, 0x3f, 0x07, 0x82, 0xde, 0x06, 0xd3, 0x13, 0x35,
+        0x2d, 0x22, 0x82, 0x2c, 0x22, 0xa9, 0xcc, 0x04, 0x68, 0xfd, 0x82, 0xea, 0xa3, 0x2c, 0x22,
+        0x1b, 0x2d, 0x22, 0x82, 0x72, 0x13, 0x9d, 0x06, 0x08, 0x3f, 0x07, 0x82, 0x18, 0x0d, 0x6e,
+        0x1a, 0x35, 0x2d, 0x22, 0x82, 0x2c, 0x22, 0xa9, 0xcc, 0x03, 0x68, 0xfd, 0x82, 0xc8, 0xd4,
+        0x8c, 0x42, 0x1d, 0x2d, 0x22, 0x82, 0xd3, 0x13, 0x7c, 0x06, 0x05, 0x3f, 0x07, 0x83, 0xde,
+        0x06, 0x38, 0x0d, 0xaf, 0x1a, 0x36, 0x2d, 0x22, 0x82, 0x2c, 0x22, 0xa9, 0xcc, 0x02, 0x68,
+        0xfd, 0x82, 0x48, 0xf5, 0x4b, 0x73, 0x1f, 0x2d, 0x22, 0x88, 0xf0, 0x1a, 0xb7, 0x0c, 0xfb,
+        0x05, 0x9d, 0x06, 0x7c, 0x06, 0x79, 0x0d, 0xd3, 0x13, 0x6e, 0x1a, 0x37, 0x2d, 0x22, 0x82,
+        0x2c, 0x22, 0xa9, 0xcc, 0x02, 0x68, 0xfd, 0x82, 0x49, 0xb4, 0x4c, 0x2a, 0x21, 0x2d, 0x22,
+        0x84, 0x8e, 0x1a, 0xcf, 0x1a, 0xaf, 0x1a, 0x4d, 0x1a, 0x39, 0x2d, 0x22, 0x85, 0x2c, 0x22,
+        0xa9, 0xcc, 0x68, 0xfd, 0xe8, 0xe4, 0xcb, 0x4a, 0x5f, 0x2d, 0x22, 0x84, 0x2c, 0x22, 0xa9,
+        0xcc, 0x68, 0xfd, 0xaa, 0x8b, 0x60, 0x2d, 0x22, 0x84, 0x2c, 0x22, 0xa9, 0xcc, 0x89, 0xcc,
+        0x6c, 0x32, 0x11, 0x2d, 0x22, 0x02, 0x8e, 0x22, 0x4d, 0x2d, 0x22, 0x83, 0x2c, 0x22, 0x49,
+        0xbc, 0x0b, 0x63, 0x11, 0x2d, 0x22, 0x81, 0x30, 0x23, 0x02, 0xfa, 0x15, 0x81, 0x30, 0x23,
+        0x4c, 0x2d, 0x22, 0x83, 0x2c, 0x22, 0x4b, 0x73, 0x2c, 0x22, 0x10, 0x2d, 0x22, 0x82, 0xb2,
+        0x1b, 0x5c, 0x0e, 0x02, 0x3f, 0x07, 0x82, 0x5c, 0x0e, 0xb2, 0x1b, 0x4c, 0x2d, 0x22, 0x81,
+        0x2c, 0x22, 0x10, 0x2d, 0x22, 0x82, 0xf3, 0x1b, 0xbd, 0x0e, 0x04, 0x3f, 0x07, 0x82, 0xbd,
+        0x0e, 0xf3, 0x1b, 0x5b, 0x2d, 0x22, 0x82, 0x71, 0x1b, 0x9c, 0x0e, 0x06, 0x3f, 0x07, 0x82,
+        0x9c, 0x0e, 0x71, 0x1b, 0x59, 0x2d, 0x22, 0x82, 0x8e, 0x22, 0xfa, 0x0d, 0x08, 0x3f, 0x07,
+        0x82, 0xfa, 0x0d, 0x8e, 0x22, 0x2c, 0x2d, 0x22, 0x2c, 0x0d, 0x22, 0x81, 0x34, 0x1c, 0x0a,
+        0x3f, 0x07, 0x81, 0x34, 0x1c, 0x57, 0x0d, 0x22, 0x82, 0x4e, 0x22, 0xda, 0x0d, 0x0a, 0x3f,
+        0x07, 0x82, 0xda, 0x0d, 0x4e, 0x22, 0x56, 0x0d, 0x22, 0x82, 0xf0, 0x1a, 0xbd, 0x06, 0x0a,
+        0x3f, 0x07, 0x82, 0xbd, 0x06, 0xf0, 0x1a, 0x56, 0x0d, 0x22, 0x82, 0x72, 0x13, 0xfe, 0x06,
+        0x0a, 0x3f, 0x07, 0x82, 0xfe, 0x06, 0x72, 0x13, 0x56, 0x0d, 0x22, 0x82, 0x10, 0x1b, 0xbd,
+        0x06, 0x0a, 0x3f, 0x07, 0x82, 0xbd, 0x06, 0x10, 0x1b, 0x56, 0x0d, 0x22, 0x82, 0x4e, 0x1a,
+        0xda, 0x0d, 0x0a, 0x3f, 0x07, 0x82, 0xda, 0x0d, 0x4e, 0x1a, 0x57, 0x0d, 0x22, 0x81, 0x34,
+        0x14, 0x0a, 0x3f, 0x07, 0x81, 0x34, 0x14, 0x58, 0x0d, 0x22, 0x82, 0x4e, 0x1a, 0x38, 0x0d,
+        0x08, 0x3f, 0x07, 0x82, 0x38, 0x0d, 0x4e, 0x1a, 0x2c, 0x0d, 0x22, 0x2d, 0x0c, 0x22, 0x84,
+        0x6d, 0x1a, 0x17, 0x0d, 0xbd, 0x06, 0x1f, 0x07, 0x02, 0x3f, 0x07, 0x84, 0x1f, 0x07, 0xbd,
+        0x06, 0x17, 0x0d, 0x6d, 0x1a, 0x5b, 0x0c, 0x22, 0x83, 0x2c, 0x1a, 0x51, 0x13, 0x96, 0x0c,
+        0x02, 0xba, 0x0d, 0x83, 0x96, 0x0c, 0x51, 0x13, 0x2c, 0x1a, 0x5f, 0x0c, 0x22, 0x02, 0x2c,
+        0x1a, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x5f, 0x0c, 0x22,
+
+};
+
+const lv_image_dsc_t image_isolated_scattered_tstorms_night_opaque = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
+    .header.w = 100,
+    .header.h = 100,
+    .header.stride = 200,
+    .header.reserved_2 = 0,
+    .data_size = sizeof(image_isolated_scattered_tstorms_night_opaque_map),
+    .data = image_isolated_scattered_tstorms_night_opaque_map,
+    .reserved = NULL,
+};
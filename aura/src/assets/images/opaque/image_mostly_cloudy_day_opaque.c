@@ -0,0 +1,190 @@
+// Generated by tools/flatten_images.py from image_mostly_cloudy_day.c: pre-blended onto the
+// main screen gradient at y = 4. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_MOSTLY_CLOUDY_DAY_OPAQUE
+  #define LV_ATTRIBUTE_IMAGE_MOSTLY_CLOUDY_DAY_OPAQUE
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_MOSTLY_CLOUDY_DAY_OPAQUE uint8_t
+    image_mostly_cloudy_day_opaque_map[] = {
+
+        0x01, 0x00, 0x00, 0x00, 0x74, 0x08, 0x00, 0x00, 0x20, 0x4e, 0x00, 0x00, 0x7f, 0x90, 0x2a,
+        0x7f, 0x90, 0x2a, 0x7f, 0x90, 0x2a, 0x13, 0x90, 0x2a, 0x7f, 0x8f, 0x2a, 0x7f, 0x8f, 0x2a,
+        0x7f, 0x8f, 0x2a, 0x7f, 0x8f, 0x2a, 0x5c, 0x8f, 0x2a, 0x7f, 0x6f, 0x2a, 0x7f, 0x6f, 0x2a,
+        0x7f, 0x6f, 0x2a, 0x4e, 0x6f, 0x2a, 0x8b, 0x8e, 0x2a, 0xce, 0x3a, 0x2e, 0x4b, 0xad, 0x63,
+        0x0c, 0x74, 0x2c, 0x7c, 0x0c, 0x74, 0xcd, 0x6b, 0x2d, 0x4b, 0xce, 0x3a, 0x8e, 0x2a, 0x56,
+        0x6f, 0x2a, 0x88, 0x8e, 0x2a, 0x2d, 0x4b, 0x2c, 0x7c, 0x2b, 0xb5, 0x29, 0xd6, 0x48, 0xde,
+        0x68, 0xee, 0x88, 0xf6, 0x02, 0xc8, 0xfe, 0x87, 0x88, 0xf6, 0x48, 0xe6, 0x29, 0xd6, 0x6a,
+        0xb5, 0x4c, 0x84, 0x4d, 0x53, 0x8e, 0x2a, 0x51, 0x6f, 0x2a, 0x84, 0x8e, 0x2a, 0xad, 0x63,
+        0x4b, 0xb5, 0x28, 0xde, 0x03, 0xc8, 0xfe, 0x09, 0xc7, 0xfe, 0x85, 0xc8, 0xfe, 0x48, 0xe6,
+        0x89, 0xbd, 0xec, 0x6b, 0xae, 0x32, 0x4e, 0x6f, 0x2a, 0x83, 0x4d, 0x53, 0x4b, 0xb5, 0x68,
+        0xee, 0x05, 0xc8, 0xfe, 0x0c, 0xc7, 0xfe, 0x84, 0x88, 0xf6, 0x89, 0xbd, 0xad, 0x63, 0x8e,
+        0x2a, 0x4a, 0x6f, 0x2a, 0x83, 0xae, 0x32, 0x4c, 0x84, 0x48, 0xe6, 0x07, 0xc8, 0xfe, 0x0e,
+        0xc7, 0xfe, 0x83, 0x68, 0xee, 0xcb, 0x94, 0xce, 0x3a, 0x48, 0x6f, 0x2a, 0x83, 0xee, 0x42,
+        0x2b, 0xad, 0x88, 0xf6, 0x08, 0xc8, 0xfe, 0x10, 0xc7, 0xfe, 0x82, 0x6a, 0xb5, 0x0e, 0x4b,
+        0x33, 0x6f, 0x2a, 0x84, 0x8f, 0x2a, 0xd0, 0x3a, 0x31, 0x43, 0x51, 0x4b, 0x03, 0x72, 0x53,
+        0x83, 0x51, 0x4b, 0x31, 0x43, 0xd0, 0x3a, 0x09, 0x6f, 0x2a, 0x82, 0xee, 0x42, 0x6a, 0xb5,
+        0x0a, 0xc8, 0xfe, 0x11, 0xc7, 0xfe, 0x82, 0xc9, 0xcd, 0x2d, 0x4b, 0x2e, 0x6f, 0x2a, 0x88,
+        0xd0, 0x3a, 0x51, 0x4b, 0x54, 0x74, 0x57, 0x9d, 0xb8, 0xad, 0x39, 0xbe, 0xbb, 0xd6, 0xfc,
+        0xde, 0x03, 0x1c, 0xe7, 0x88, 0xfc, 0xde, 0xbb, 0xd6, 0x39, 0xbe, 0xb8, 0xa5, 0x57, 0x9d,
+        0x13, 0x6c, 0x51, 0x4b, 0xaf, 0x32, 0x03, 0x6f, 0x2a, 0x82, 0xce, 0x3a, 0x6a, 0xb5, 0x0b,
+        0xc8, 0xfe, 0x12, 0xc7, 0xfe, 0x82, 0xc9, 0xcd, 0x0e, 0x4b, 0x2a, 0x6f, 0x2a, 0x86, 0xaf,
+        0x32, 0x92, 0x5b, 0xf6, 0x8c, 0x39, 0xbe, 0xfc, 0xde, 0x1c, 0xe7, 0x0d, 0x5d, 0xef, 0x87,
+        0x1c, 0xe7, 0xfc, 0xde, 0x19, 0xbe, 0xd6, 0x8c, 0x51, 0x4b, 0xcf, 0x3a, 0xea, 0xa4, 0x02,
+        0xa8, 0xfe, 0x0a, 0xc8, 0xfe, 0x13, 0xc7, 0xfe, 0x82, 0x6a, 0xb5, 0xce, 0x3a, 0x27, 0x6f,
+        0x2a, 0x84, 0xd0, 0x3a, 0x34, 0x74, 0xf9, 0xb5, 0xfc, 0xde, 0x15, 0x5d, 0xef, 0x84, 0xdb,
+        0xd6, 0x38, 0xbe, 0xb0, 0xee, 0xca, 0xfe, 0x03, 0xa8, 0xfe, 0x08, 0xc8, 0xfe, 0x14, 0xc7,
+        0xfe, 0x82, 0xab, 0x94, 0x8e, 0x2a, 0x24, 0x6f, 0x2a, 0x84, 0xaf, 0x32, 0x54, 0x74, 0x39,
+        0xbe, 0x1c, 0xe7, 0x19, 0x5d, 0xef, 0x85, 0x5c, 0xef, 0x39, 0xef, 0xf1, 0xf6, 0xa9, 0xfe,
+        0xa7, 0xfe, 0x02, 0xa8, 0xfe, 0x06, 0xc8, 0xfe, 0x14, 0xc7, 0xfe, 0x82, 0x67, 0xee, 0x8d,
+        0x63, 0x23, 0x6f, 0x2a, 0x83, 0x92, 0x5b, 0xf9, 0xb5, 0x1c, 0xe7, 0x1e, 0x5d, 0xef, 0x82,
+        0x37, 0xf7, 0xcd, 0xf6, 0x03, 0xa8, 0xfe, 0x05, 0xc8, 0xfe, 0x15, 0xc7, 0xfe, 0x82, 0x89,
+        0xbd, 0xae, 0x32, 0x20, 0x6f, 0x2a, 0x83, 0xaf, 0x32, 0xd6, 0x8c, 0xdb, 0xd6, 0x21, 0x5d,
+        0xef, 0x85, 0x5b, 0xef, 0x12, 0xf7, 0xa9, 0xfe, 0xa7, 0xfe, 0xa8, 0xfe, 0x04, 0xc8, 0xfe,
+        0x15, 0xc7, 0xfe, 0x82, 0x87, 0xf6, 0xec, 0x6b, 0x1f, 0x6f, 0x2a, 0x82, 0x31, 0x43, 0xb8,
+        0xad, 0x25, 0x5d, 0xef, 0x83, 0x36, 0xf7, 0xab, 0xfe, 0xa7, 0xfe, 0x02, 0xa8, 0xfe, 0x18,
+        0xc7, 0xfe, 0x82, 0x89, 0xbd, 0x8e, 0x2a, 0x1d, 0x6f, 0x2a, 0x82, 0x72, 0x53, 0x5a, 0xc6,
+        0x27, 0x5d, 0xef, 0x83, 0x38, 0xef, 0xcc, 0xf6, 0xa7, 0xfe, 0x03, 0xa8, 0xfe, 0x16, 0xc7,
+        0xfe, 0x82, 0x47, 0xe6, 0x4d, 0x53, 0x1c, 0x6f, 0x2a, 0x82, 0x92, 0x5b, 0x7a, 0xce, 0x29,
+        0x5d, 0xef, 0x83, 0x39, 0xef, 0xcd, 0xf6, 0x87, 0xfe, 0x02, 0xa7, 0xfe, 0x81, 0xa8, 0xfe,
+        0x16, 0xc7, 0xfe, 0x81, 0x4b, 0x84, 0x1b, 0x6f, 0x2a, 0x82, 0x92, 0x5b, 0xbb, 0xd6, 0x2b,
+        0x5d, 0xef, 0x82, 0x3a, 0xef, 0xcd, 0xf6, 0x02, 0x87, 0xfe, 0x02, 0xa7, 0xfe, 0x15, 0xc7,
+        0xfe, 0x82, 0x6a, 0xb5, 0x8e, 0x2a, 0x19, 0x6f, 0x2a, 0x82, 0x72, 0x53, 0x7a, 0xce, 0x2d,
+        0x5d, 0xef, 0x82, 0x39, 0xef, 0xac, 0xf6, 0x02, 0x87, 0xfe, 0x02, 0xa7, 0xfe, 0x14, 0xc7,
+        0xfe, 0x82, 0x08, 0xd6, 0xce, 0x3a, 0x18, 0x6f, 0x2a, 0x82, 0x11, 0x43, 0x39, 0xbe, 0x2f,
+        0x5d, 0xef, 0x82, 0x37, 0xef, 0xaa, 0xfe, 0x02, 0x87, 0xfe, 0x02, 0xa7, 0xfe, 0x13, 0xc7,
+        0xfe, 0x82, 0x47, 0xe6, 0x2d, 0x4b, 0x17, 0x6f, 0x2a, 0x82, 0x8f, 0x2a, 0x77, 0xa5, 0x31,
+        0x5d, 0xef, 0x83, 0x14, 0xf7, 0x88, 0xfe, 0x87, 0xfe, 0x02, 0xa7, 0xfe, 0x13, 0xc7, 0xfe,
+        0x82, 0x67, 0xee, 0xcd, 0x6b, 0x0e, 0x6f, 0x2a, 0x09, 0x6e, 0x2a, 0x82, 0x94, 0x7c, 0x1c,
+        0xe7, 0x31, 0x5d, 0xef, 0x83, 0x5c, 0xef, 0xcf, 0xf6, 0x87, 0xfe, 0x03, 0xa7, 0xfe, 0x13,
+        0xc7, 0xfe, 0x81, 0x0b, 0x74, 0x0e, 0x6e, 0x2a, 0x08, 0x4e, 0x2a, 0x82, 0x30, 0x4b, 0xbb,
+        0xd6, 0x33, 0x5d, 0xef, 0x83, 0x39, 0xef, 0xab, 0xf6, 0x87, 0xfe, 0x03, 0xa7, 0xfe, 0x12,
+        0xc7, 0xfe, 0x81, 0x0b, 0x7c, 0x15, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x77, 0xa5, 0x35, 0x5d,
+        0xef, 0x81, 0xf3, 0xf6, 0x02, 0x87, 0xfe, 0x02, 0xa7, 0xfe, 0x11, 0xc7, 0xfe, 0x82, 0x87,
+        0xf6, 0xeb, 0x73, 0x15, 0x4e, 0x2a, 0x82, 0xb1, 0x5b, 0xfc, 0xde, 0x35, 0x5d, 0xef, 0x82,
+        0x5b, 0xef, 0xac, 0xf6, 0x02, 0x87, 0xfe, 0x02, 0xa7, 0xfe, 0x10, 0xc7, 0xfe, 0x82, 0x67,
+        0xee, 0x8c, 0x63, 0x14, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x97, 0xa5, 0x37, 0x5d, 0xef, 0x83,
+        0x14, 0xf7, 0x88, 0xfe, 0x87, 0xfe, 0x02, 0xa7, 0xfe, 0x10, 0xc7, 0xfe, 0x82, 0x27, 0xde,
+        0xed, 0x4a, 0x14, 0x4e, 0x2a, 0x82, 0x71, 0x5b, 0xfc, 0xde, 0x37, 0x5d, 0xef, 0x82, 0x5b,
+        0xef, 0xac, 0xf6, 0x02, 0x87, 0xfe, 0x02, 0xa7, 0xfe, 0x0a, 0xc7, 0xfe, 0x05, 0xa7, 0xfe,
+        0x82, 0x08, 0xd6, 0xad, 0x3a, 0x14, 0x4e, 0x2a, 0x81, 0x36, 0x9d, 0x39, 0x5d, 0xef, 0x82,
+        0xf2, 0xf6, 0x67, 0xfe, 0x02, 0x87, 0xfe, 0x10, 0xa7, 0xfe, 0x82, 0x2a, 0xb5, 0x6d, 0x2a,
+        0x13, 0x4e, 0x2a, 0x82, 0xcf, 0x42, 0x7a, 0xce, 0x39, 0x5d, 0xef, 0x84, 0x39, 0xef, 0xaf,
+        0xf6, 0xae, 0xf6, 0xcf, 0xf6, 0x03, 0xef, 0xf6, 0x04, 0xef, 0xfe, 0x85, 0xee, 0xf6, 0xee,
+        0xfe, 0xed, 0xfe, 0xcb, 0xfe, 0xc8, 0xfe, 0x04, 0xa7, 0xfe, 0x81, 0x0b, 0x7c, 0x14, 0x4e,
+        0x2a, 0x82, 0xf2, 0x6b, 0x1c, 0xe7, 0x3a, 0x5d, 0xef, 0x82, 0xfc, 0xde, 0x1c, 0xe7, 0x02,
+        0x3c, 0xe7, 0x07, 0x5d, 0xef, 0x02, 0x5c, 0xef, 0x87, 0x5a, 0xef, 0x38, 0xef, 0x14, 0xf7,
+        0xee, 0xf6, 0xa9, 0xfe, 0x07, 0xde, 0x0c, 0x4b, 0x14, 0x4e, 0x2a, 0x81, 0x36, 0x9d, 0x3b,
+        0x5d, 0xef, 0x83, 0x1c, 0xe7, 0xdb, 0xde, 0x1c, 0xe7, 0x02, 0x3c, 0xe7, 0x0b, 0x5d, 0xef,
+        0x84, 0x5c, 0xef, 0x39, 0xef, 0x53, 0xd6, 0xef, 0x42, 0x13, 0x4e, 0x2a, 0x82, 0x8e, 0x32,
+        0x39, 0xbe, 0x3b, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0xdb, 0xde, 0xfb, 0xde, 0x02, 0x3c, 0xe7,
+        0x0e, 0x5d, 0xef, 0x83, 0x5a, 0xc6, 0x53, 0x74, 0x8e, 0x32, 0x11, 0x4e, 0x2a, 0x82, 0x51,
+        0x53, 0xdb, 0xd6, 0x3b, 0x5d, 0xef, 0x81, 0x3c, 0xe7, 0x02, 0xdb, 0xde, 0x82, 0xfb, 0xde,
+        0x3c, 0xe7, 0x0f, 0x5d, 0xef, 0x83, 0x1c, 0xe7, 0xb8, 0xad, 0x30, 0x4b, 0x10, 0x4e, 0x2a,
+        0x81, 0xf3, 0x6b, 0x3d, 0x5d, 0xef, 0x02, 0xdb, 0xde, 0x83, 0xfb, 0xde, 0x1c, 0xe7, 0x3c,
+        0xe7, 0x10, 0x5d, 0xef, 0x82, 0x7a, 0xce, 0xf3, 0x6b, 0x0f, 0x4e, 0x2a, 0x81, 0x74, 0x7c,
+        0x3d, 0x5d, 0xef, 0x82, 0xfb, 0xde, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x82, 0x1c, 0xe7, 0x3c,
+        0xe7, 0x10, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x33, 0x74, 0x0e, 0x4e, 0x2a, 0x81, 0x36, 0x9d,
+        0x3d, 0x5d, 0xef, 0x81, 0x1c, 0xe7, 0x02, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x82, 0x1c, 0xe7,
+        0x3c, 0xe7, 0x10, 0x5d, 0xef, 0x82, 0xfc, 0xde, 0x33, 0x74, 0x0c, 0x4e, 0x2a, 0x82, 0x6e,
+        0x2a, 0xb8, 0xad, 0x3d, 0x5d, 0xef, 0x81, 0x1c, 0xe7, 0x02, 0xdb, 0xde, 0x02, 0xfb, 0xde,
+        0x02, 0x1c, 0xe7, 0x11, 0x5d, 0xef, 0x82, 0xbb, 0xd6, 0x71, 0x53, 0x0b, 0x4e, 0x2a, 0x82,
+        0x6e, 0x2a, 0x19, 0xbe, 0x3d, 0x5d, 0xef, 0x81, 0x1c, 0xe7, 0x02, 0xdb, 0xde, 0x02, 0xfb,
+        0xde, 0x02, 0x1c, 0xe7, 0x81, 0x3c, 0xe7, 0x11, 0x5d, 0xef, 0x82, 0x39, 0xbe, 0xcf, 0x42,
+        0x0a, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x39, 0xbe, 0x3d, 0x5d, 0xef, 0x81, 0x1c, 0xe7, 0x02,
+        0xdb, 0xde, 0x02, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x81, 0x3c, 0xe7, 0x11, 0x5d, 0xef, 0x82,
+        0xf5, 0x8c, 0x6e, 0x2a, 0x09, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x39, 0xbe, 0x3d, 0x5d, 0xef,
+        0x81, 0x1c, 0xe7, 0x02, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x04, 0x1c, 0xe7, 0x81, 0x3c, 0xe7,
+        0x10, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x71, 0x5b, 0x09, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x19,
+        0xbe, 0x3d, 0x5d, 0xef, 0x81, 0x1c, 0xe7, 0x02, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x02, 0x1c,
+        0xe7, 0x04, 0x3c, 0xe7, 0x10, 0x5d, 0xef, 0x82, 0x97, 0xa5, 0x6e, 0x2a, 0x08, 0x4e, 0x2a,
+        0x82, 0x6e, 0x2a, 0xd8, 0xb5, 0x3d, 0x5d, 0xef, 0x81, 0x1c, 0xe7, 0x02, 0xdb, 0xde, 0x81,
+        0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x05, 0x3c, 0xe7, 0x0f, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x51,
+        0x53, 0x08, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x77, 0xa5, 0x3d, 0x5d, 0xef, 0x83, 0x1c, 0xe7,
+        0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x07, 0x3c, 0xe7, 0x0f, 0x5d, 0xef, 0x81, 0xb5,
+        0x8c, 0x09, 0x4e, 0x2a, 0x81, 0x74, 0x7c, 0x3d, 0x5d, 0xef, 0x83, 0xfb, 0xde, 0xdb, 0xde,
+        0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x08, 0x3c, 0xe7, 0x0e, 0x5d, 0xef, 0x82, 0x18, 0xbe, 0x8e,
+        0x32, 0x08, 0x4e, 0x2a, 0x81, 0xf2, 0x63, 0x3d, 0x5d, 0xef, 0x03, 0xfb, 0xde, 0x02, 0x1c,
+        0xe7, 0x0a, 0x3c, 0xe7, 0x0d, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x51, 0x53, 0x08, 0x4e, 0x2a,
+        0x82, 0x71, 0x53, 0xfc, 0xde, 0x3b, 0x5d, 0xef, 0x81, 0x3c, 0xe7, 0x02, 0xfb, 0xde, 0x03,
+        0x1c, 0xe7, 0x0b, 0x3c, 0xe7, 0x0d, 0x5d, 0xef, 0x81, 0x13, 0x74, 0x08, 0x4e, 0x2a, 0x82,
+        0xaf, 0x3a, 0x39, 0xc6, 0x3b, 0x5d, 0xef, 0x81, 0x3c, 0xe7, 0x02, 0xfb, 0xde, 0x02, 0x1c,
+        0xe7, 0x0d, 0x3c, 0xe7, 0x0c, 0x5d, 0xef, 0x81, 0xb5, 0x84, 0x09, 0x4e, 0x2a, 0x81, 0x77,
+        0xa5, 0x3b, 0x5d, 0xef, 0x82, 0x1c, 0xe7, 0xfb, 0xde, 0x02, 0x1c, 0xe7, 0x0f, 0x3c, 0xe7,
+        0x0b, 0x5d, 0xef, 0x82, 0x56, 0x9d, 0x6e, 0x2a, 0x03, 0x4e, 0x2a, 0x05, 0x2e, 0x2a, 0x81,
+        0x13, 0x6c, 0x3b, 0x5d, 0xef, 0x03, 0x1c, 0xe7, 0x11, 0x3c, 0xe7, 0x0a, 0x5d, 0xef, 0x82,
+        0xd8, 0xb5, 0x4e, 0x2a, 0x08, 0x2e, 0x2a, 0x82, 0xd0, 0x42, 0x59, 0xc6, 0x39, 0x5d, 0xef,
+        0x81, 0x3c, 0xe7, 0x03, 0x1c, 0xe7, 0x12, 0x3c, 0xe7, 0x09, 0x5d, 0xef, 0x82, 0xf9, 0xbd,
+        0x4e, 0x2a, 0x09, 0x2e, 0x2a, 0x81, 0x56, 0x9d, 0x39, 0x5d, 0xef, 0x81, 0x3c, 0xe7, 0x03,
+        0x1c, 0xe7, 0x13, 0x3c, 0xe7, 0x08, 0x5d, 0xef, 0x82, 0xb8, 0xad, 0x4e, 0x2a, 0x03, 0x2e,
+        0x2a, 0x06, 0x2d, 0x2a, 0x82, 0x71, 0x5b, 0xfb, 0xde, 0x38, 0x5d, 0xef, 0x02, 0x1c, 0xe7,
+        0x16, 0x3c, 0xe7, 0x07, 0x5d, 0xef, 0x82, 0x56, 0x9d, 0x4d, 0x2a, 0x09, 0x2d, 0x2a, 0x82,
+        0x6d, 0x32, 0xb7, 0xad, 0x37, 0x5d, 0xef, 0x82, 0x3c, 0xe7, 0x1c, 0xe7, 0x18, 0x3c, 0xe7,
+        0x06, 0x5d, 0xef, 0x81, 0x74, 0x7c, 0x0b, 0x2d, 0x2a, 0x82, 0x91, 0x63, 0xfb, 0xde, 0x36,
+        0x5d, 0xef, 0x05, 0x3c, 0xe7, 0x07, 0x5d, 0xef, 0x0f, 0x3c, 0xe7, 0x05, 0x5d, 0xef, 0x81,
+        0x12, 0x6c, 0x0b, 0x2d, 0x2a, 0x82, 0x6d, 0x32, 0x97, 0xa5, 0x35, 0x5d, 0xef, 0x05, 0x3c,
+        0xe7, 0x07, 0x5d, 0xef, 0x11, 0x3c, 0xe7, 0x03, 0x5d, 0xef, 0x82, 0xba, 0xce, 0x30, 0x53,
+        0x04, 0x2d, 0x2a, 0x08, 0x2d, 0x22, 0x82, 0x30, 0x4b, 0xba, 0xce, 0x34, 0x5d, 0xef, 0x03,
+        0x3c, 0xe7, 0x1d, 0x5d, 0xef, 0x82, 0x18, 0xb6, 0x6d, 0x2a, 0x0d, 0x2d, 0x22, 0x82, 0x94,
+        0x84, 0x3c, 0xe7, 0x32, 0x5d, 0xef, 0x03, 0x3c, 0xe7, 0x1e, 0x5d, 0xef, 0x81, 0xb4, 0x84,
+        0x0e, 0x2d, 0x22, 0x82, 0x6d, 0x2a, 0x77, 0xa5, 0x31, 0x5d, 0xef, 0x03, 0x3c, 0xe7, 0x1e,
+        0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x30, 0x4b, 0x0f, 0x2d, 0x22, 0x82, 0x0f, 0x43, 0x59, 0xc6,
+        0x30, 0x5d, 0xef, 0x02, 0x3c, 0xe7, 0x1f, 0x5d, 0xef, 0x82, 0x56, 0x9d, 0x4d, 0x22, 0x10,
+        0x2d, 0x22, 0x82, 0x70, 0x53, 0xba, 0xce, 0x2e, 0x5d, 0xef, 0x02, 0x3c, 0xe7, 0x1f, 0x5d,
+        0xef, 0x82, 0xdb, 0xd6, 0x50, 0x53, 0x12, 0x2d, 0x22, 0x82, 0xd1, 0x5b, 0xba, 0xce, 0x2c,
+        0x5d, 0xef, 0x02, 0x3c, 0xe7, 0x1f, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0xd5, 0x8c, 0x4d, 0x22,
+        0x13, 0x2d, 0x22, 0x82, 0xd1, 0x5b, 0xba, 0xce, 0x2a, 0x5d, 0xef, 0x02, 0x3c, 0xe7, 0x20,
+        0x5d, 0xef, 0x82, 0xf8, 0xb5, 0xae, 0x32, 0x15, 0x2d, 0x22, 0x82, 0x91, 0x5b, 0x7a, 0xce,
+        0x28, 0x5d, 0xef, 0x02, 0x3c, 0xe7, 0x20, 0x5d, 0xef, 0x82, 0x9a, 0xce, 0x50, 0x53, 0x17,
+        0x2d, 0x22, 0x83, 0x50, 0x4b, 0xf8, 0xb5, 0x3c, 0xe7, 0x25, 0x5d, 0xef, 0x02, 0x3c, 0xe7,
+        0x20, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0xf2, 0x63, 0x19, 0x2d, 0x22, 0x83, 0xae, 0x32, 0x15,
+        0x95, 0xfb, 0xde, 0x23, 0x5d, 0xef, 0x81, 0x3c, 0xe7, 0x21, 0x5d, 0xef, 0x82, 0xba, 0xce,
+        0x12, 0x6c, 0x1b, 0x2d, 0x22, 0x84, 0x4d, 0x22, 0xf2, 0x63, 0x19, 0xbe, 0x3c, 0xe7, 0x41,
+        0x5d, 0xef, 0x83, 0x3c, 0xe7, 0x39, 0xc6, 0x91, 0x5b, 0x1e, 0x2d, 0x22, 0x84, 0xae, 0x3a,
+        0xb4, 0x84, 0x7a, 0xce, 0x3c, 0xe7, 0x3e, 0x5d, 0xef, 0x83, 0xfb, 0xde, 0x77, 0xa5, 0xef,
+        0x42, 0x21, 0x2d, 0x22, 0x84, 0xcf, 0x3a, 0x94, 0x7c, 0x19, 0xbe, 0x3c, 0xe7, 0x3a, 0x5d,
+        0xef, 0x84, 0x3c, 0xe7, 0x19, 0xbe, 0x12, 0x6c, 0x6d, 0x2a, 0x24, 0x2d, 0x22, 0x84, 0xae,
+        0x32, 0xb1, 0x5b, 0x56, 0x9d, 0x7a, 0xce, 0x02, 0x3c, 0xe7, 0x33, 0x5d, 0xef, 0x85, 0x3c,
+        0xe7, 0xdb, 0xd6, 0xf7, 0xb5, 0x33, 0x74, 0xae, 0x32, 0x28, 0x2d, 0x22, 0x89, 0x4d, 0x22,
+        0xcf, 0x3a, 0x91, 0x5b, 0x94, 0x84, 0xb7, 0xb5, 0xf8, 0xbd, 0x7a, 0xce, 0xdb, 0xde, 0xfb,
+        0xde, 0x29, 0x3c, 0xe7, 0x88, 0xfb, 0xde, 0xdb, 0xd6, 0x7a, 0xce, 0x19, 0xbe, 0x97, 0xa5,
+        0x53, 0x74, 0x50, 0x4b, 0x6d, 0x2a, 0x2e, 0x2d, 0x22, 0x85, 0x4d, 0x22, 0x6d, 0x2a, 0xef,
+        0x42, 0x70, 0x53, 0x91, 0x5b, 0x29, 0xb1, 0x5b, 0x85, 0x91, 0x5b, 0x70, 0x53, 0xef, 0x42,
+        0x8e, 0x32, 0x4d, 0x22, 0x7f, 0x2d, 0x22, 0x5d, 0x2d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d,
+        0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x26, 0x0d,
+        0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x5c, 0x0c,
+        0x22,
+
+};
+
+const lv_image_dsc_t image_mostly_cloudy_day_opaque = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
+    .header.w = 100,
+    .header.h = 100,
+    .header.stride = 200,
+    .header.reserved_2 = 0,
+    .data_size = sizeof(image_mostly_cloudy_day_opaque_map),
+    .data = image_mostly_cloudy_day_opaque_map,
+    .reserved = NULL,
+};
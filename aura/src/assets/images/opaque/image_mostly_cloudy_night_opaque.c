@@ -0,0 +1,205 @@
+// Generated by tools/flatten_images.py from image_mostly_cloudy_night.c: pre-blended onto the
+// main screen gradient at y = 4. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_MOSTLY_CLOUDY_NIGHT_OPAQUE
+  #define LV_ATTRIBUTE_IMAGE_MOSTLY_CLOUDY_NIGHT_OPAQUE
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_MOSTLY_CLOUDY_NIGHT_OPAQUE uint8_t
+    image_mostly_cloudy_night_opaque_map[] = {
+
+        0x01, 0x00, 0x00, 0x00, 0x5f, 0x09, 0x00, 0x00, 0x20, 0x4e, 0x00, 0x00, 0x7f, 0x90, 0x2a,
+        0x7f, 0x90, 0x2a, 0x7f, 0x90, 0x2a, 0x13, 0x90, 0x2a, 0x7f, 0x8f, 0x2a, 0x7f, 0x8f, 0x2a,
+        0x0b, 0x8f, 0x2a, 0x84, 0x10, 0x3b, 0xb3, 0x53, 0xf4, 0x5b, 0xf0, 0x32, 0x5d, 0x8f, 0x2a,
+        0x87, 0xf0, 0x32, 0xf4, 0x5b, 0x39, 0x8d, 0xfc, 0xad, 0x9e, 0xc6, 0xdb, 0xa5, 0xcf, 0x32,
+        0x5b, 0x8f, 0x2a, 0x84, 0xf0, 0x32, 0x56, 0x6c, 0xdb, 0xa5, 0xbe, 0xc6, 0x03, 0xff, 0xce,
+        0x81, 0xb7, 0x7c, 0x5a, 0x8f, 0x2a, 0x83, 0xaf, 0x2a, 0xf4, 0x5b, 0xdb, 0xa5, 0x05, 0xff,
+        0xce, 0x82, 0xbe, 0xc6, 0xb3, 0x53, 0x20, 0x8f, 0x2a, 0x39, 0x6f, 0x2a, 0x83, 0xd0, 0x32,
+        0xd8, 0x84, 0x9e, 0xbe, 0x06, 0xff, 0xce, 0x82, 0x5d, 0xb6, 0x11, 0x3b, 0x58, 0x6f, 0x2a,
+        0x82, 0x11, 0x3b, 0x7a, 0x95, 0x08, 0xff, 0xce, 0x82, 0xdb, 0xa5, 0xaf, 0x32, 0x57, 0x6f,
+        0x2a, 0x82, 0x11, 0x3b, 0xfb, 0xa5, 0x09, 0xff, 0xce, 0x81, 0x7a, 0x95, 0x57, 0x6f, 0x2a,
+        0x82, 0xf1, 0x3a, 0x9a, 0x9d, 0x0a, 0xff, 0xce, 0x81, 0x59, 0x95, 0x56, 0x6f, 0x2a, 0x82,
+        0x8f, 0x2a, 0x18, 0x85, 0x0b, 0xff, 0xce, 0x81, 0x59, 0x95, 0x56, 0x6f, 0x2a, 0x82, 0x35,
+        0x6c, 0xbe, 0xc6, 0x0b, 0xff, 0xce, 0x81, 0x59, 0x95, 0x55, 0x6f, 0x2a, 0x82, 0x11, 0x3b,
+        0x1c, 0xae, 0x0c, 0xff, 0xce, 0x81, 0x59, 0x95, 0x55, 0x6f, 0x2a, 0x81, 0xb7, 0x7c, 0x0d,
+        0xff, 0xce, 0x82, 0x9a, 0x9d, 0xaf, 0x32, 0x53, 0x6f, 0x2a, 0x82, 0x11, 0x43, 0x5d, 0xb6,
+        0x0d, 0xff, 0xce, 0x82, 0x3c, 0xae, 0xf1, 0x3a, 0x53, 0x6f, 0x2a, 0x81, 0x76, 0x74, 0x0e,
+        0xff, 0xce, 0x82, 0xbe, 0xc6, 0x73, 0x53, 0x3e, 0x6f, 0x2a, 0x83, 0x8f, 0x2a, 0xf0, 0x3a,
+        0x51, 0x4b, 0x05, 0x72, 0x53, 0x83, 0x51, 0x4b, 0xd0, 0x3a, 0x8f, 0x2a, 0x09, 0x6f, 0x2a,
+        0x82, 0xb0, 0x32, 0xdb, 0xa5, 0x0f, 0xff, 0xce, 0x81, 0x76, 0x74, 0x3a, 0x6f, 0x2a, 0x88,
+        0xd0, 0x3a, 0x51, 0x4b, 0x95, 0x7c, 0x97, 0xa5, 0xd8, 0xad, 0x7a, 0xc6, 0xfb, 0xd6, 0x1c,
+        0xdf, 0x03, 0x3c, 0xe7, 0x88, 0x1c, 0xdf, 0xfb, 0xd6, 0x5a, 0xc6, 0xd8, 0xad, 0x57, 0x9d,
+        0x34, 0x6c, 0x51, 0x4b, 0xaf, 0x32, 0x05, 0x6f, 0x2a, 0x82, 0x52, 0x4b, 0x5d, 0xbe, 0x03,
+        0xdf, 0xce, 0x0c, 0xff, 0xce, 0x82, 0xdb, 0xa5, 0xaf, 0x32, 0x36, 0x6f, 0x2a, 0x85, 0xaf,
+        0x32, 0xb2, 0x5b, 0x16, 0x8d, 0x59, 0xbe, 0x1c, 0xdf, 0x0e, 0x7d, 0xef, 0x86, 0x3c, 0xe7,
+        0x1c, 0xdf, 0x19, 0xbe, 0xf6, 0x8c, 0x72, 0x53, 0x8f, 0x2a, 0x02, 0x6f, 0x2a, 0x81, 0x56,
+        0x6c, 0x04, 0xdf, 0xc6, 0x02, 0xdf, 0xce, 0x0a, 0xff, 0xce, 0x82, 0x9e, 0xbe, 0x73, 0x53,
+        0x34, 0x6f, 0x2a, 0x84, 0xd0, 0x3a, 0x74, 0x74, 0x39, 0xbe, 0x1c, 0xdf, 0x15, 0x7d, 0xef,
+        0x86, 0x1c, 0xdf, 0xd8, 0xad, 0xf3, 0x63, 0xaf, 0x32, 0xd7, 0x7c, 0xbf, 0xc6, 0x05, 0xdf,
+        0xc6, 0x81, 0xdf, 0xce, 0x0a, 0xff, 0xce, 0x81, 0x18, 0x85, 0x32, 0x6f, 0x2a, 0x84, 0xaf,
+        0x32, 0x74, 0x74, 0x59, 0xbe, 0x3c, 0xe7, 0x19, 0x7d, 0xef, 0x84, 0x3c, 0xe7, 0x39, 0xbe,
+        0x3b, 0xb6, 0xbe, 0xc6, 0x02, 0xbf, 0xc6, 0x04, 0xdf, 0xc6, 0x02, 0xdf, 0xce, 0x08, 0xff,
+        0xce, 0x82, 0x7d, 0xbe, 0x52, 0x4b, 0x30, 0x6f, 0x2a, 0x83, 0xb2, 0x5b, 0xf9, 0xb5, 0x3c,
+        0xe7, 0x1e, 0x7d, 0xef, 0x84, 0x3e, 0xe7, 0xde, 0xce, 0xbe, 0xc6, 0xbf, 0xc6, 0x04, 0xdf,
+        0xc6, 0x02, 0xdf, 0xce, 0x08, 0xff, 0xce, 0x82, 0x39, 0x95, 0x8f, 0x2a, 0x2d, 0x6f, 0x2a,
+        0x83, 0xaf, 0x32, 0xf6, 0x8c, 0x1c, 0xdf, 0x21, 0x7d, 0xef, 0x83, 0x5d, 0xef, 0x1e, 0xdf,
+        0xbe, 0xc6, 0x02, 0xbf, 0xc6, 0x04, 0xdf, 0xc6, 0x02, 0xdf, 0xce, 0x06, 0xff, 0xce, 0x82,
+        0xbe, 0xc6, 0x35, 0x6c, 0x2c, 0x6f, 0x2a, 0x82, 0x51, 0x4b, 0xf9, 0xb5, 0x25, 0x7d, 0xef,
+        0x84, 0x3e, 0xe7, 0xde, 0xce, 0xbe, 0xc6, 0xbf, 0xc6, 0x05, 0xdf, 0xc6, 0x81, 0xdf, 0xce,
+        0x06, 0xff, 0xce, 0x82, 0x5d, 0xb6, 0x52, 0x4b, 0x2a, 0x6f, 0x2a, 0x82, 0x72, 0x53, 0x7a,
+        0xc6, 0x27, 0x7d, 0xef, 0x83, 0x5e, 0xe7, 0xde, 0xce, 0xbe, 0xc6, 0x02, 0xbf, 0xc6, 0x04,
+        0xdf, 0xc6, 0x81, 0xdf, 0xce, 0x06, 0xff, 0xce, 0x82, 0x1c, 0xae, 0x11, 0x43, 0x28, 0x6f,
+        0x2a, 0x82, 0xb2, 0x5b, 0x9a, 0xce, 0x29, 0x7d, 0xef, 0x82, 0x5d, 0xe7, 0xde, 0xce, 0x02,
+        0xbe, 0xc6, 0x02, 0xbf, 0xc6, 0x03, 0xdf, 0xc6, 0x81, 0xdf, 0xce, 0x06, 0xff, 0xce, 0x82,
+        0xbb, 0xa5, 0x11, 0x43, 0x26, 0x6f, 0x2a, 0x82, 0x92, 0x5b, 0xdb, 0xd6, 0x2b, 0x7d, 0xef,
+        0x84, 0x5d, 0xef, 0xde, 0xce, 0x9e, 0xc6, 0xbe, 0xc6, 0x02, 0xbf, 0xc6, 0x02, 0xdf, 0xc6,
+        0x81, 0xdf, 0xce, 0x06, 0xff, 0xce, 0x83, 0xdf, 0xce, 0xdb, 0xa5, 0x52, 0x4b, 0x24, 0x6f,
+        0x2a, 0x82, 0x72, 0x53, 0x9a, 0xce, 0x2d, 0x7d, 0xef, 0x85, 0x5d, 0xe7, 0xbe, 0xce, 0x9e,
+        0xc6, 0xbe, 0xc6, 0xbf, 0xc6, 0x03, 0xdf, 0xc6, 0x81, 0xdf, 0xce, 0x05, 0xff, 0xce, 0x02,
+        0xdf, 0xce, 0x83, 0x3d, 0xb6, 0x15, 0x64, 0x8f, 0x2a, 0x21, 0x6f, 0x2a, 0x82, 0x11, 0x43,
+        0x7a, 0xc6, 0x2f, 0x7d, 0xef, 0x85, 0x3e, 0xe7, 0xbe, 0xc6, 0x9e, 0xc6, 0xbe, 0xc6, 0xbf,
+        0xc6, 0x02, 0xdf, 0xc6, 0x02, 0xdf, 0xce, 0x04, 0xff, 0xce, 0x03, 0xdf, 0xce, 0x83, 0x9e,
+        0xc6, 0x19, 0x8d, 0x32, 0x43, 0x1f, 0x6f, 0x2a, 0x82, 0x8f, 0x2a, 0x77, 0xa5, 0x31, 0x7d,
+        0xef, 0x81, 0x1e, 0xdf, 0x02, 0x9e, 0xc6, 0x82, 0xbe, 0xc6, 0xbf, 0xc6, 0x02, 0xdf, 0xc6,
+        0x81, 0xdf, 0xce, 0x04, 0xff, 0xce, 0x05, 0xdf, 0xce, 0x84, 0x3d, 0xb6, 0xd8, 0x84, 0x52,
+        0x4b, 0x8f, 0x2a, 0x13, 0x6f, 0x2a, 0x09, 0x6e, 0x2a, 0x82, 0x94, 0x7c, 0x3c, 0xe7, 0x31,
+        0x7d, 0xef, 0x85, 0x5d, 0xef, 0xfe, 0xd6, 0x9e, 0xc6, 0xbe, 0xc6, 0xbf, 0xc6, 0x03, 0xdf,
+        0xc6, 0x81, 0xdf, 0xce, 0x03, 0xff, 0xce, 0x07, 0xdf, 0xce, 0x86, 0x5d, 0xbe, 0x79, 0x95,
+        0x34, 0x6c, 0x31, 0x43, 0xcf, 0x32, 0x8e, 0x2a, 0x0f, 0x6e, 0x2a, 0x08, 0x4e, 0x2a, 0x82,
+        0x30, 0x4b, 0xbb, 0xd6, 0x33, 0x7d, 0xef, 0x85, 0x5d, 0xe7, 0xbe, 0xc6, 0x9e, 0xc6, 0xbe,
+        0xc6, 0xbf, 0xc6, 0x04, 0xdf, 0xc6, 0x81, 0xff, 0xce, 0x0b, 0xdf, 0xce, 0x83, 0x7d, 0xbe,
+        0xdb, 0xa5, 0x39, 0x95, 0x02, 0xf8, 0x84, 0x83, 0xd7, 0x7c, 0xf8, 0x84, 0xf4, 0x63, 0x11,
+        0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x77, 0xa5, 0x35, 0x7d, 0xef, 0x81, 0x1e, 0xdf, 0x02, 0x9e,
+        0xc6, 0x02, 0xbf, 0xc6, 0x03, 0xdf, 0xc6, 0x0e, 0xdf, 0xce, 0x04, 0xdf, 0xc6, 0x82, 0x9e,
+        0xbe, 0xd3, 0x5b, 0x11, 0x4e, 0x2a, 0x82, 0xb2, 0x5b, 0x1c, 0xdf, 0x35, 0x7d, 0xef, 0x85,
+        0x5d, 0xef, 0xde, 0xce, 0x9e, 0xbe, 0xbe, 0xc6, 0xbf, 0xc6, 0x04, 0xdf, 0xc6, 0x0d, 0xdf,
+        0xce, 0x04, 0xdf, 0xc6, 0x82, 0x59, 0x95, 0x8f, 0x32, 0x10, 0x4e, 0x2a, 0x82, 0x6e, 0x2a,
+        0x97, 0xa5, 0x37, 0x7d, 0xef, 0x81, 0x1e, 0xdf, 0x02, 0x9e, 0xc6, 0x82, 0xbe, 0xc6, 0xbf,
+        0xc6, 0x04, 0xdf, 0xc6, 0x0c, 0xdf, 0xce, 0x03, 0xdf, 0xc6, 0x82, 0x5d, 0xb6, 0x72, 0x4b,
+        0x11, 0x4e, 0x2a, 0x82, 0x91, 0x5b, 0x1c, 0xdf, 0x37, 0x7d, 0xef, 0x86, 0x5d, 0xef, 0xbe,
+        0xce, 0x9e, 0xbe, 0x9e, 0xc6, 0xbe, 0xc6, 0xbf, 0xc6, 0x11, 0xdf, 0xc6, 0x82, 0x9e, 0xbe,
+        0x35, 0x6c, 0x12, 0x4e, 0x2a, 0x81, 0x36, 0x9d, 0x39, 0x7d, 0xef, 0x81, 0xfe, 0xd6, 0x02,
+        0x9e, 0xbe, 0x81, 0x9e, 0xc6, 0x02, 0xbf, 0xc6, 0x10, 0xdf, 0xc6, 0x82, 0xf8, 0x84, 0x8f,
+        0x32, 0x11, 0x4e, 0x2a, 0x82, 0xef, 0x42, 0x9a, 0xce, 0x39, 0x7d, 0xef, 0x85, 0x3d, 0xe7,
+        0xdd, 0xce, 0xbd, 0xce, 0xde, 0xce, 0xde, 0xd6, 0x03, 0xfe, 0xd6, 0x81, 0x1e, 0xd7, 0x05,
+        0xfe, 0xd6, 0x81, 0xfe, 0xce, 0x05, 0xdf, 0xc6, 0x83, 0xbf, 0xc6, 0xf8, 0x84, 0xaf, 0x32,
+        0x12, 0x4e, 0x2a, 0x81, 0xf3, 0x6b, 0x3b, 0x7d, 0xef, 0x02, 0x1c, 0xe7, 0x02, 0x3c, 0xe7,
+        0x09, 0x5d, 0xef, 0x88, 0x5d, 0xe7, 0x3d, 0xe7, 0x1e, 0xdf, 0xfe, 0xd6, 0xde, 0xce, 0x7e,
+        0xbe, 0xd8, 0x84, 0xaf, 0x32, 0x13, 0x4e, 0x2a, 0x81, 0x77, 0xa5, 0x3b, 0x7d, 0xef, 0x83,
+        0x1c, 0xe7, 0xdb, 0xde, 0x1c, 0xe7, 0x02, 0x3c, 0xe7, 0x0c, 0x5d, 0xef, 0x83, 0x3d, 0xe7,
+        0x1a, 0xb6, 0x30, 0x4b, 0x13, 0x4e, 0x2a, 0x82, 0x8e, 0x32, 0x39, 0xbe, 0x3b, 0x7d, 0xef,
+        0x83, 0x3c, 0xe7, 0xdb, 0xde, 0xfb, 0xde, 0x02, 0x3c, 0xe7, 0x0e, 0x5d, 0xef, 0x83, 0x5a,
+        0xc6, 0x54, 0x74, 0x8e, 0x32, 0x11, 0x4e, 0x2a, 0x82, 0x91, 0x5b, 0xfc, 0xde, 0x3b, 0x7d,
+        0xef, 0x81, 0x5d, 0xef, 0x02, 0xdb, 0xde, 0x82, 0xfb, 0xde, 0x3c, 0xe7, 0x0f, 0x5d, 0xef,
+        0x83, 0x1c, 0xe7, 0xb8, 0xad, 0x30, 0x4b, 0x10, 0x4e, 0x2a, 0x81, 0x13, 0x6c, 0x3c, 0x7d,
+        0xef, 0x86, 0x5d, 0xef, 0xfb, 0xde, 0xdb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x3c, 0xe7, 0x10,
+        0x5d, 0xef, 0x82, 0x5a, 0xc6, 0xf2, 0x63, 0x0f, 0x4e, 0x2a, 0x81, 0x74, 0x7c, 0x3d, 0x7d,
+        0xef, 0x82, 0x1c, 0xe7, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x82, 0x1c, 0xe7, 0x3c, 0xe7, 0x10,
+        0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x33, 0x74, 0x0e, 0x4e, 0x2a, 0x81, 0x77, 0xa5, 0x3d, 0x7d,
+        0xef, 0x81, 0x3c, 0xe7, 0x02, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x82, 0x1c, 0xe7, 0x3c, 0xe7,
+        0x10, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x33, 0x74, 0x0c, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0xf8,
+        0xb5, 0x3d, 0x7d, 0xef, 0x81, 0x3c, 0xe7, 0x02, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x02, 0x1c,
+        0xe7, 0x11, 0x5d, 0xef, 0x82, 0xbb, 0xce, 0x71, 0x53, 0x0b, 0x4e, 0x2a, 0x82, 0x6e, 0x2a,
+        0x19, 0xbe, 0x3d, 0x7d, 0xef, 0x81, 0x3c, 0xe7, 0x02, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x02,
+        0x1c, 0xe7, 0x81, 0x3c, 0xe7, 0x11, 0x5d, 0xef, 0x82, 0x39, 0xbe, 0xcf, 0x3a, 0x0a, 0x4e,
+        0x2a, 0x82, 0x6e, 0x2a, 0x59, 0xbe, 0x3d, 0x7d, 0xef, 0x81, 0x3c, 0xe7, 0x02, 0xdb, 0xde,
+        0x02, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x81, 0x3c, 0xe7, 0x11, 0x5d, 0xef, 0x82, 0xf5, 0x8c,
+        0x6e, 0x2a, 0x09, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x39, 0xbe, 0x3d, 0x7d, 0xef, 0x81, 0x3c,
+        0xe7, 0x02, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x04, 0x1c, 0xe7, 0x81, 0x3c, 0xe7, 0x10, 0x5d,
+        0xef, 0x82, 0xdb, 0xd6, 0x71, 0x53, 0x09, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x39, 0xbe, 0x3d,
+        0x7d, 0xef, 0x81, 0x3c, 0xe7, 0x02, 0xdb, 0xde, 0x81, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x04,
+        0x3c, 0xe7, 0x10, 0x5d, 0xef, 0x82, 0x77, 0xa5, 0x6e, 0x2a, 0x08, 0x4e, 0x2a, 0x82, 0x6e,
+        0x2a, 0xf8, 0xb5, 0x3d, 0x7d, 0xef, 0x81, 0x3c, 0xe7, 0x02, 0xdb, 0xde, 0x81, 0xfb, 0xde,
+        0x03, 0x1c, 0xe7, 0x05, 0x3c, 0xe7, 0x0f, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x51, 0x53, 0x08,
+        0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x97, 0xa5, 0x3d, 0x7d, 0xef, 0x83, 0x1c, 0xe7, 0xdb, 0xde,
+        0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x07, 0x3c, 0xe7, 0x0f, 0x5d, 0xef, 0x81, 0xd5, 0x84, 0x09,
+        0x4e, 0x2a, 0x81, 0x95, 0x84, 0x3d, 0x7d, 0xef, 0x83, 0x1c, 0xe7, 0xdb, 0xde, 0xfb, 0xde,
+        0x03, 0x1c, 0xe7, 0x08, 0x3c, 0xe7, 0x0e, 0x5d, 0xef, 0x82, 0x39, 0xbe, 0x8e, 0x32, 0x08,
+        0x4e, 0x2a, 0x82, 0xf3, 0x6b, 0x5d, 0xef, 0x3b, 0x7d, 0xef, 0x81, 0x5d, 0xef, 0x03, 0xfb,
+        0xde, 0x02, 0x1c, 0xe7, 0x0a, 0x3c, 0xe7, 0x0d, 0x5d, 0xef, 0x82, 0xba, 0xce, 0x51, 0x53,
+        0x08, 0x4e, 0x2a, 0x82, 0x91, 0x5b, 0xfc, 0xde, 0x3b, 0x7d, 0xef, 0x81, 0x5d, 0xef, 0x02,
+        0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x0b, 0x3c, 0xe7, 0x0d, 0x5d, 0xef, 0x81, 0x13, 0x6c, 0x08,
+        0x4e, 0x2a, 0x82, 0xaf, 0x3a, 0x5a, 0xc6, 0x3b, 0x7d, 0xef, 0x82, 0x3c, 0xe7, 0xfb, 0xde,
+        0x03, 0x1c, 0xe7, 0x0d, 0x3c, 0xe7, 0x0c, 0x5d, 0xef, 0x81, 0xb5, 0x84, 0x09, 0x4e, 0x2a,
+        0x81, 0x97, 0xa5, 0x3b, 0x7d, 0xef, 0x82, 0x3c, 0xe7, 0xfb, 0xde, 0x02, 0x1c, 0xe7, 0x0f,
+        0x3c, 0xe7, 0x0b, 0x5d, 0xef, 0x82, 0x56, 0x9d, 0x6e, 0x2a, 0x03, 0x4e, 0x2a, 0x05, 0x2e,
+        0x2a, 0x82, 0x13, 0x6c, 0x5d, 0xef, 0x39, 0x7d, 0xef, 0x81, 0x5d, 0xef, 0x03, 0x1c, 0xe7,
+        0x11, 0x3c, 0xe7, 0x0a, 0x5d, 0xef, 0x82, 0xd8, 0xb5, 0x4e, 0x2a, 0x08, 0x2e, 0x2a, 0x82,
+        0xf0, 0x42, 0x9b, 0xd6, 0x39, 0x7d, 0xef, 0x81, 0x5d, 0xef, 0x03, 0x1c, 0xe7, 0x12, 0x3c,
+        0xe7, 0x09, 0x5d, 0xef, 0x82, 0xf9, 0xbd, 0x4e, 0x2a, 0x09, 0x2e, 0x2a, 0x81, 0x77, 0xa5,
+        0x39, 0x7d, 0xef, 0x81, 0x3c, 0xe7, 0x03, 0x1c, 0xe7, 0x13, 0x3c, 0xe7, 0x08, 0x5d, 0xef,
+        0x82, 0xb8, 0xad, 0x4e, 0x2a, 0x03, 0x2e, 0x2a, 0x06, 0x2d, 0x2a, 0x82, 0xb1, 0x63, 0x1c,
+        0xe7, 0x37, 0x7d, 0xef, 0x81, 0x5d, 0xef, 0x02, 0x1c, 0xe7, 0x16, 0x3c, 0xe7, 0x07, 0x5d,
+        0xef, 0x82, 0x56, 0x9d, 0x4d, 0x2a, 0x09, 0x2d, 0x2a, 0x82, 0x6e, 0x32, 0xb8, 0xad, 0x37,
+        0x7d, 0xef, 0x82, 0x5d, 0xef, 0x1c, 0xe7, 0x18, 0x3c, 0xe7, 0x06, 0x5d, 0xef, 0x81, 0x74,
+        0x7c, 0x0b, 0x2d, 0x2a, 0x82, 0xd2, 0x63, 0x1c, 0xe7, 0x35, 0x7d, 0xef, 0x81, 0x5d, 0xef,
+        0x05, 0x3c, 0xe7, 0x05, 0x5d, 0xef, 0x11, 0x3c, 0xe7, 0x05, 0x5d, 0xef, 0x81, 0x12, 0x6c,
+        0x0b, 0x2d, 0x2a, 0x83, 0x6d, 0x32, 0x97, 0xa5, 0x5d, 0xef, 0x34, 0x7d, 0xef, 0x81, 0x5d,
+        0xef, 0x04, 0x3c, 0xe7, 0x05, 0x5d, 0xef, 0x13, 0x3c, 0xe7, 0x03, 0x5d, 0xef, 0x82, 0xba,
+        0xce, 0x30, 0x53, 0x04, 0x2d, 0x2a, 0x08, 0x2d, 0x22, 0x82, 0x50, 0x53, 0xdb, 0xd6, 0x33,
+        0x7d, 0xef, 0x81, 0x5d, 0xef, 0x03, 0x3c, 0xe7, 0x1d, 0x5d, 0xef, 0x82, 0x18, 0xb6, 0x6d,
+        0x2a, 0x0d, 0x2d, 0x22, 0x82, 0xd4, 0x84, 0x5d, 0xef, 0x32, 0x7d, 0xef, 0x81, 0x5d, 0xef,
+        0x02, 0x3c, 0xe7, 0x1e, 0x5d, 0xef, 0x81, 0xb4, 0x84, 0x0e, 0x2d, 0x22, 0x83, 0x6d, 0x2a,
+        0x97, 0xa5, 0x5d, 0xef, 0x30, 0x7d, 0xef, 0x81, 0x5d, 0xef, 0x02, 0x3c, 0xe7, 0x1e, 0x5d,
+        0xef, 0x82, 0xdb, 0xd6, 0x30, 0x4b, 0x0f, 0x2d, 0x22, 0x83, 0x30, 0x4b, 0x9a, 0xce, 0x5d,
+        0xef, 0x2e, 0x7d, 0xef, 0x81, 0x5d, 0xef, 0x02, 0x3c, 0xe7, 0x1f, 0x5d, 0xef, 0x82, 0x56,
+        0x9d, 0x4d, 0x22, 0x10, 0x2d, 0x22, 0x82, 0x91, 0x5b, 0xba, 0xce, 0x2d, 0x7d, 0xef, 0x02,
+        0x5d, 0xef, 0x81, 0x3c, 0xe7, 0x1f, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x50, 0x4b, 0x12, 0x2d,
+        0x22, 0x82, 0xd2, 0x5b, 0xdb, 0xce, 0x2b, 0x7d, 0xef, 0x02, 0x5d, 0xef, 0x81, 0x3c, 0xe7,
+        0x1f, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0xd5, 0x8c, 0x4d, 0x22, 0x13, 0x2d, 0x22, 0x82, 0xf2,
+        0x63, 0xba, 0xce, 0x29, 0x7d, 0xef, 0x02, 0x5d, 0xef, 0x81, 0x3c, 0xe7, 0x20, 0x5d, 0xef,
+        0x82, 0xf8, 0xb5, 0xae, 0x32, 0x15, 0x2d, 0x22, 0x83, 0x91, 0x5b, 0xba, 0xce, 0x5d, 0xef,
+        0x26, 0x7d, 0xef, 0x02, 0x5d, 0xef, 0x81, 0x3c, 0xe7, 0x20, 0x5d, 0xef, 0x82, 0x9a, 0xce,
+        0x50, 0x4b, 0x17, 0x2d, 0x22, 0x83, 0x71, 0x53, 0x18, 0xb6, 0x5d, 0xef, 0x24, 0x7d, 0xef,
+        0x02, 0x5d, 0xef, 0x81, 0x3c, 0xe7, 0x20, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0xf2, 0x6b, 0x19,
+        0x2d, 0x22, 0x84, 0xae, 0x32, 0x36, 0x9d, 0x1c, 0xe7, 0x5d, 0xef, 0x21, 0x7d, 0xef, 0x23,
+        0x5d, 0xef, 0x82, 0xba, 0xce, 0xf2, 0x63, 0x1b, 0x2d, 0x22, 0x84, 0x4d, 0x22, 0xf2, 0x63,
+        0x39, 0xbe, 0x5d, 0xef, 0x1e, 0x7d, 0xef, 0x23, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0x39, 0xc6,
+        0xb1, 0x5b, 0x1e, 0x2d, 0x22, 0x84, 0xae, 0x32, 0xb4, 0x84, 0x9a, 0xce, 0x5d, 0xef, 0x1a,
+        0x7d, 0xef, 0x24, 0x5d, 0xef, 0x83, 0xfb, 0xde, 0x77, 0xa5, 0xef, 0x42, 0x21, 0x2d, 0x22,
+        0x85, 0xcf, 0x3a, 0x94, 0x84, 0x59, 0xc6, 0x3c, 0xe7, 0x5d, 0xef, 0x15, 0x7d, 0xef, 0x24,
+        0x5d, 0xef, 0x84, 0x3c, 0xe7, 0x19, 0xbe, 0x12, 0x6c, 0x6d, 0x2a, 0x24, 0x2d, 0x22, 0x85,
+        0xae, 0x32, 0xf2, 0x63, 0x77, 0xa5, 0x9a, 0xce, 0x3c, 0xe7, 0x02, 0x5d, 0xef, 0x0f, 0x7d,
+        0xef, 0x23, 0x5d, 0xef, 0x85, 0x3c, 0xe7, 0xdb, 0xd6, 0xd8, 0xb5, 0x33, 0x74, 0xae, 0x32,
+        0x28, 0x2d, 0x22, 0x88, 0x4d, 0x22, 0xcf, 0x3a, 0x91, 0x5b, 0xb4, 0x84, 0xd8, 0xb5, 0x19,
+        0xbe, 0x9a, 0xce, 0xfb, 0xde, 0x02, 0x3c, 0xe7, 0x05, 0x5d, 0xef, 0x24, 0x3c, 0xe7, 0x87,
+        0xdb, 0xd6, 0x9a, 0xce, 0x19, 0xbe, 0x97, 0xa5, 0x54, 0x74, 0x50, 0x4b, 0x6d, 0x2a, 0x2e,
+        0x2d, 0x22, 0x83, 0x4d, 0x22, 0x6d, 0x2a, 0x0f, 0x43, 0x02, 0x91, 0x5b, 0x02, 0xd1, 0x5b,
+        0x27, 0xb1, 0x5b, 0x85, 0x91, 0x5b, 0x70, 0x53, 0x0f, 0x43, 0x8e, 0x32, 0x4d, 0x22, 0x7f,
+        0x2d, 0x22, 0x5d, 0x2d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f,
+        0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x26, 0x0d, 0x22, 0x7f, 0x0c, 0x22, 0x7f,
+        0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x5c, 0x0c, 0x22,
+
+};
+
+const lv_image_dsc_t image_mostly_cloudy_night_opaque = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
+    .header.w = 100,
+    .header.h = 100,
+    .header.stride = 200,
+    .header.reserved_2 = 0,
+    .data_size = sizeof(image_mostly_cloudy_night_opaque_map),
+    .data = image_mostly_cloudy_night_opaque_map,
+    .reserved = NULL,
+};
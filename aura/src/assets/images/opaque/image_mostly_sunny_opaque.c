@@ -0,0 +1,215 @@
+// Generated by tools/flatten_images.py from image_mostly_sunny.c: pre-blended onto the
+// main screen gradient at y = 4. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_MOSTLY_SUNNY_OPAQUE
+  #define LV_ATTRIBUTE_IMAGE_MOSTLY_SUNNY_OPAQUE
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_MOSTLY_SUNNY_OPAQUE uint8_t
+    image_mostly_sunny_opaque_map[] = {
+
+        0x01, 0x00, 0x00, 0x00, 0xf6, 0x09, 0x00, 0x00, 0x20, 0x4e, 0x00, 0x00, 0x7f, 0x90, 0x2a,
+        0x7f, 0x90, 0x2a, 0x7f, 0x90, 0x2a, 0x13, 0x90, 0x2a, 0x7f, 0x8f, 0x2a, 0x7f, 0x8f, 0x2a,
+        0x7f, 0x8f, 0x2a, 0x3c, 0x8f, 0x2a, 0x88, 0xae, 0x2a, 0xee, 0x3a, 0x2e, 0x4b, 0x8d, 0x5b,
+        0x0d, 0x6c, 0x6c, 0x84, 0xcb, 0x94, 0x0b, 0xa5, 0x02, 0x2b, 0xad, 0x88, 0x0b, 0xa5, 0xcb,
+        0x94, 0x6c, 0x84, 0x0d, 0x6c, 0x8d, 0x5b, 0x2e, 0x4b, 0xee, 0x3a, 0xae, 0x2a, 0x4e, 0x8f,
+        0x2a, 0x89, 0xae, 0x2a, 0x0e, 0x43, 0x8d, 0x5b, 0xac, 0x94, 0x4b, 0xb5, 0xea, 0xcd, 0x69,
+        0xe6, 0xa9, 0xf6, 0xa8, 0xf6, 0x08, 0xc8, 0xfe, 0x02, 0x88, 0xf6, 0x87, 0x68, 0xe6, 0xea,
+        0xcd, 0x4b, 0xb5, 0xac, 0x94, 0x8d, 0x5b, 0x0e, 0x43, 0xae, 0x2a, 0x25, 0x8f, 0x2a, 0x23,
+        0x6f, 0x2a, 0x85, 0xee, 0x42, 0xed, 0x6b, 0x2b, 0xad, 0x29, 0xd6, 0xa9, 0xf6, 0x14, 0xc8,
+        0xfe, 0x85, 0x88, 0xf6, 0x09, 0xd6, 0x2b, 0xad, 0xec, 0x6b, 0xee, 0x42, 0x43, 0x6f, 0x2a,
+        0x85, 0x8e, 0x2a, 0x8d, 0x5b, 0xeb, 0x9c, 0x29, 0xd6, 0xa9, 0xf6, 0x16, 0xc8, 0xfe, 0x03,
+        0xc7, 0xfe, 0x86, 0xc8, 0xfe, 0x88, 0xf6, 0x09, 0xd6, 0xeb, 0x9c, 0x8d, 0x5b, 0x8e, 0x2a,
+        0x3e, 0x6f, 0x2a, 0x84, 0x8e, 0x2a, 0xad, 0x63, 0x4b, 0xb5, 0x89, 0xee, 0x1a, 0xc8, 0xfe,
+        0x05, 0xc7, 0xfe, 0x85, 0xc8, 0xfe, 0x68, 0xee, 0x4b, 0xb5, 0xad, 0x63, 0x8e, 0x2a, 0x3a,
+        0x6f, 0x2a, 0x84, 0x8e, 0x2a, 0x8d, 0x5b, 0x6a, 0xb5, 0x89, 0xee, 0x1c, 0xc8, 0xfe, 0x08,
+        0xc7, 0xfe, 0x83, 0x68, 0xee, 0x6a, 0xb5, 0x8d, 0x5b, 0x38, 0x6f, 0x2a, 0x83, 0xee, 0x42,
+        0xcb, 0x94, 0x69, 0xe6, 0x1e, 0xc8, 0xfe, 0x0a, 0xc7, 0xfe, 0x83, 0x48, 0xe6, 0xcb, 0x94,
+        0xee, 0x42, 0x34, 0x6f, 0x2a, 0x85, 0x8e, 0x2a, 0xed, 0x6b, 0x0a, 0xd6, 0xe9, 0xfe, 0xe8,
+        0xfe, 0x1e, 0xc8, 0xfe, 0x0c, 0xc7, 0xfe, 0x83, 0xe9, 0xd5, 0xec, 0x6b, 0x8e, 0x2a, 0x31,
+        0x6f, 0x2a, 0x84, 0xce, 0x3a, 0xec, 0x9c, 0x89, 0xee, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1d,
+        0xc8, 0xfe, 0x0d, 0xc7, 0xfe, 0x83, 0x68, 0xee, 0xcb, 0x9c, 0xce, 0x3a, 0x2f, 0x6f, 0x2a,
+        0x82, 0x4d, 0x53, 0x8a, 0xbd, 0x03, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x0f,
+        0xc7, 0xfe, 0x82, 0x89, 0xbd, 0x2d, 0x4b, 0x2d, 0x6f, 0x2a, 0x82, 0xad, 0x63, 0x29, 0xd6,
+        0x04, 0xe9, 0xfe, 0x04, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe, 0x10, 0xc7, 0xfe, 0x82, 0x09, 0xd6,
+        0x8d, 0x63, 0x2b, 0x6f, 0x2a, 0x82, 0xed, 0x6b, 0x49, 0xde, 0x06, 0xe9, 0xfe, 0x03, 0xe8,
+        0xfe, 0x1c, 0xc8, 0xfe, 0x11, 0xc7, 0xfe, 0x82, 0x28, 0xde, 0xcd, 0x6b, 0x29, 0x6f, 0x2a,
+        0x82, 0x0d, 0x74, 0x69, 0xe6, 0x07, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe, 0x12,
+        0xc7, 0xfe, 0x82, 0x48, 0xe6, 0x0c, 0x74, 0x27, 0x6f, 0x2a, 0x82, 0xed, 0x6b, 0x69, 0xe6,
+        0x08, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe, 0x13, 0xc7, 0xfe, 0x82, 0x47, 0xe6,
+        0xad, 0x6b, 0x25, 0x6f, 0x2a, 0x82, 0xad, 0x63, 0x49, 0xde, 0x09, 0xe9, 0xfe, 0x03, 0xe8,
+        0xfe, 0x1c, 0xc8, 0xfe, 0x14, 0xc7, 0xfe, 0x82, 0x28, 0xde, 0x6d, 0x5b, 0x23, 0x6f, 0x2a,
+        0x82, 0x4d, 0x53, 0x29, 0xd6, 0x09, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x15,
+        0xc7, 0xfe, 0x82, 0x08, 0xd6, 0x2d, 0x4b, 0x21, 0x6f, 0x2a, 0x82, 0xce, 0x3a, 0x8a, 0xbd,
+        0x0a, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x16, 0xc7, 0xfe, 0x82, 0x89, 0xbd,
+        0xce, 0x3a, 0x1f, 0x6f, 0x2a, 0x82, 0x8e, 0x2a, 0xec, 0x9c, 0x0a, 0xe9, 0xfe, 0x04, 0xe8,
+        0xfe, 0x1d, 0xc8, 0xfe, 0x17, 0xc7, 0xfe, 0x82, 0xcb, 0x9c, 0x8e, 0x2a, 0x1e, 0x6f, 0x2a,
+        0x82, 0xed, 0x6b, 0x89, 0xee, 0x09, 0xe9, 0xfe, 0x04, 0xe8, 0xfe, 0x1e, 0xc8, 0xfe, 0x17,
+        0xc7, 0xfe, 0x82, 0x67, 0xee, 0xec, 0x6b, 0x1d, 0x6f, 0x2a, 0x82, 0xee, 0x42, 0x0a, 0xd6,
+        0x09, 0xe9, 0xfe, 0x05, 0xe8, 0xfe, 0x1e, 0xc8, 0xfe, 0x18, 0xc7, 0xfe, 0x82, 0xe8, 0xd5,
+        0xee, 0x42, 0x1b, 0x6f, 0x2a, 0x83, 0x8e, 0x2a, 0xcb, 0x94, 0xe9, 0xfe, 0x02, 0xe8, 0xfe,
+        0x05, 0xe9, 0xfe, 0x06, 0xe8, 0xfe, 0x1f, 0xc8, 0xfe, 0x19, 0xc7, 0xfe, 0x81, 0xab, 0x94,
+        0x1b, 0x6f, 0x2a, 0x82, 0x8d, 0x5b, 0x69, 0xe6, 0x0d, 0xe8, 0xfe, 0x1f, 0xc8, 0xfe, 0x1a,
+        0xc7, 0xfe, 0x82, 0x47, 0xe6, 0x6d, 0x5b, 0x19, 0x6f, 0x2a, 0x83, 0x8e, 0x2a, 0x6a, 0xb5,
+        0xc8, 0xfe, 0x0b, 0xe8, 0xfe, 0x21, 0xc8, 0xfe, 0x1b, 0xc7, 0xfe, 0x82, 0x29, 0xb5, 0x8e,
+        0x2a, 0x18, 0x6f, 0x2a, 0x82, 0xad, 0x63, 0x69, 0xee, 0x04, 0xc8, 0xfe, 0x06, 0xe8, 0xfe,
+        0x23, 0xc8, 0xfe, 0x1b, 0xc7, 0xfe, 0x82, 0x67, 0xee, 0x8d, 0x63, 0x17, 0x6f, 0x2a, 0x82,
+        0x8e, 0x2a, 0x4b, 0xb5, 0x2e, 0xc8, 0xfe, 0x1c, 0xc7, 0xfe, 0x82, 0x29, 0xb5, 0x8e, 0x2a,
+        0x16, 0x6f, 0x2a, 0x82, 0x8d, 0x5b, 0x68, 0xee, 0x2d, 0xc8, 0xfe, 0x1d, 0xc7, 0xfe, 0x82,
+        0x67, 0xee, 0x6d, 0x5b, 0x0b, 0x6f, 0x2a, 0x0b, 0x6e, 0x2a, 0x81, 0xeb, 0x9c, 0x2e, 0xc8,
+        0xfe, 0x1e, 0xc7, 0xfe, 0x81, 0xca, 0x9c, 0x0b, 0x6e, 0x2a, 0x0a, 0x4e, 0x2a, 0x82, 0xcd,
+        0x42, 0x29, 0xd6, 0x2e, 0xc8, 0xfe, 0x1e, 0xc7, 0xfe, 0x82, 0x08, 0xd6, 0xcd, 0x42, 0x14,
+        0x4e, 0x2a, 0x82, 0xcc, 0x6b, 0x88, 0xf6, 0x2d, 0xc8, 0xfe, 0x1f, 0xc7, 0xfe, 0x82, 0x87,
+        0xf6, 0xcb, 0x6b, 0x13, 0x4e, 0x2a, 0x82, 0x6d, 0x2a, 0x2a, 0xad, 0x2e, 0xc8, 0xfe, 0x20,
+        0xc7, 0xfe, 0x82, 0x09, 0xad, 0x6e, 0x2a, 0x12, 0x4e, 0x2a, 0x82, 0xcd, 0x42, 0x28, 0xd6,
+        0x2d, 0xc8, 0xfe, 0x21, 0xc7, 0xfe, 0x82, 0x08, 0xd6, 0xcd, 0x42, 0x12, 0x4e, 0x2a, 0x82,
+        0x6c, 0x5b, 0x88, 0xf6, 0x2d, 0xc8, 0xfe, 0x21, 0xc7, 0xfe, 0x82, 0x67, 0xee, 0x6c, 0x5b,
+        0x12, 0x4e, 0x2a, 0x81, 0x6b, 0x8c, 0x2d, 0xc8, 0xfe, 0x23, 0xc7, 0xfe, 0x81, 0x4b, 0x8c,
+        0x11, 0x4e, 0x2a, 0x82, 0x6d, 0x2a, 0x2a, 0xb5, 0x2d, 0xc8, 0xfe, 0x23, 0xc7, 0xfe, 0x81,
+        0x29, 0xb5, 0x11, 0x4e, 0x2a, 0x82, 0xad, 0x3a, 0xc9, 0xcd, 0x2c, 0xc8, 0xfe, 0x23, 0xc7,
+        0xfe, 0x83, 0xc6, 0xfe, 0xa8, 0xcd, 0xad, 0x3a, 0x10, 0x4e, 0x2a, 0x82, 0xed, 0x4a, 0x48,
+        0xe6, 0x2c, 0xc8, 0xfe, 0x23, 0xc7, 0xfe, 0x83, 0xc6, 0xfe, 0x46, 0xe6, 0xec, 0x4a, 0x10,
+        0x4e, 0x2a, 0x82, 0x6c, 0x5b, 0x88, 0xf6, 0x2b, 0xc8, 0xfe, 0x23, 0xc7, 0xfe, 0x02, 0xc6,
+        0xfe, 0x82, 0x86, 0xf6, 0x4c, 0x5b, 0x10, 0x4e, 0x2a, 0x82, 0xcc, 0x6b, 0x88, 0xf6, 0x2a,
+        0xc8, 0xfe, 0x24, 0xc7, 0xfe, 0x02, 0xc6, 0xfe, 0x82, 0x86, 0xf6, 0xcb, 0x6b, 0x10, 0x4e,
+        0x2a, 0x81, 0x4b, 0x84, 0x2a, 0xc8, 0xfe, 0x25, 0xc7, 0xfe, 0x03, 0xc6, 0xfe, 0x81, 0x2a,
+        0x84, 0x10, 0x4e, 0x2a, 0x81, 0xab, 0x94, 0x29, 0xc8, 0xfe, 0x25, 0xc7, 0xfe, 0x04, 0xc6,
+        0xfe, 0x81, 0x89, 0x94, 0x10, 0x4e, 0x2a, 0x81, 0xea, 0xa4, 0x28, 0xc8, 0xfe, 0x26, 0xc7,
+        0xfe, 0x04, 0xc6, 0xfe, 0x81, 0xc9, 0xa4, 0x10, 0x4e, 0x2a, 0x81, 0x0a, 0xad, 0x27, 0xc8,
+        0xfe, 0x26, 0xc7, 0xfe, 0x05, 0xc6, 0xfe, 0x81, 0xe9, 0xac, 0x10, 0x4e, 0x2a, 0x81, 0x0a,
+        0xad, 0x26, 0xc8, 0xfe, 0x27, 0xc7, 0xfe, 0x05, 0xc6, 0xfe, 0x81, 0xe9, 0xac, 0x10, 0x4e,
+        0x2a, 0x81, 0xea, 0xa4, 0x25, 0xc8, 0xfe, 0x27, 0xc7, 0xfe, 0x06, 0xc6, 0xfe, 0x81, 0xc9,
+        0xa4, 0x10, 0x4e, 0x2a, 0x81, 0xaa, 0x94, 0x24, 0xc8, 0xfe, 0x28, 0xc7, 0xfe, 0x06, 0xc6,
+        0xfe, 0x81, 0x89, 0x94, 0x10, 0x4e, 0x2a, 0x81, 0x2b, 0x84, 0x23, 0xc8, 0xfe, 0x28, 0xc7,
+        0xfe, 0x07, 0xc6, 0xfe, 0x81, 0x2a, 0x84, 0x10, 0x4e, 0x2a, 0x82, 0xcb, 0x6b, 0x88, 0xf6,
+        0x20, 0xc8, 0xfe, 0x2a, 0xc7, 0xfe, 0x06, 0xc6, 0xfe, 0x82, 0x86, 0xf6, 0xab, 0x6b, 0x10,
+        0x4e, 0x2a, 0x82, 0x6c, 0x5b, 0x88, 0xf6, 0x1e, 0xc8, 0xfe, 0x2b, 0xc7, 0xfe, 0x07, 0xc6,
+        0xfe, 0x82, 0x86, 0xf6, 0x2c, 0x53, 0x10, 0x4e, 0x2a, 0x82, 0x0c, 0x4b, 0x48, 0xe6, 0x1d,
+        0xc8, 0xfe, 0x2c, 0xc7, 0xfe, 0x07, 0xc6, 0xfe, 0x82, 0x26, 0xe6, 0xec, 0x4a, 0x10, 0x4e,
+        0x2a, 0x82, 0xad, 0x3a, 0xc9, 0xcd, 0x08, 0xc7, 0xfe, 0x06, 0xa7, 0xfe, 0x07, 0xc7, 0xfe,
+        0x05, 0xc8, 0xfe, 0x2e, 0xc7, 0xfe, 0x08, 0xc6, 0xfe, 0x82, 0xa7, 0xcd, 0xad, 0x3a, 0x10,
+        0x4e, 0x2a, 0x82, 0x6d, 0x2a, 0x29, 0xb5, 0x03, 0xc7, 0xfe, 0x8b, 0xa7, 0xfe, 0xca, 0xfe,
+        0xed, 0xfe, 0x12, 0xf7, 0x35, 0xf7, 0x56, 0xf7, 0x35, 0xf7, 0x33, 0xf7, 0x10, 0xf7, 0xcb,
+        0xfe, 0xc8, 0xfe, 0x04, 0xa7, 0xfe, 0x05, 0xc7, 0xfe, 0x81, 0xc8, 0xfe, 0x30, 0xc7, 0xfe,
+        0x08, 0xc6, 0xfe, 0x81, 0x08, 0xb5, 0x12, 0x4e, 0x2a, 0x81, 0x8a, 0x94, 0x02, 0xc7, 0xfe,
+        0x87, 0xca, 0xfe, 0x12, 0xf7, 0x59, 0xf7, 0x7c, 0xf7, 0x7d, 0xef, 0x7e, 0xef, 0x9e, 0xef,
+        0x02, 0x7e, 0xef, 0x85, 0x9d, 0xf7, 0x7c, 0xf7, 0x56, 0xf7, 0xee, 0xfe, 0xa8, 0xfe, 0x04,
+        0xa7, 0xfe, 0x33, 0xc7, 0xfe, 0x09, 0xc6, 0xfe, 0x81, 0x4a, 0x8c, 0x12, 0x4e, 0x2a, 0x86,
+        0x4c, 0x5b, 0x48, 0xee, 0x0f, 0xff, 0x79, 0xf7, 0x7d, 0xf7, 0x7e, 0xef, 0x07, 0x7d, 0xef,
+        0x85, 0x7e, 0xef, 0x9e, 0xef, 0x7c, 0xf7, 0x35, 0xf7, 0xcb, 0xfe, 0x04, 0xa7, 0xfe, 0x31,
+        0xc7, 0xfe, 0x09, 0xc6, 0xfe, 0x82, 0x86, 0xf6, 0x4c, 0x5b, 0x09, 0x4e, 0x2a, 0x09, 0x2e,
+        0x2a, 0x84, 0xcd, 0x4a, 0xb2, 0xde, 0x7c, 0xf7, 0x7e, 0xef, 0x0b, 0x7d, 0xef, 0x02, 0x7e,
+        0xef, 0x83, 0x59, 0xf7, 0xcd, 0xfe, 0x87, 0xfe, 0x03, 0xa7, 0xfe, 0x30, 0xc7, 0xfe, 0x09,
+        0xc6, 0xfe, 0x82, 0xe7, 0xd5, 0xad, 0x42, 0x12, 0x2e, 0x2a, 0x83, 0x54, 0x7c, 0x3c, 0xe7,
+        0x7e, 0xef, 0x0e, 0x7d, 0xef, 0x83, 0x9e, 0xef, 0x5a, 0xf7, 0xcc, 0xf6, 0x02, 0x87, 0xfe,
+        0x02, 0xa7, 0xfe, 0x2e, 0xc7, 0xfe, 0x0a, 0xc6, 0xfe, 0x81, 0xe9, 0xac, 0x12, 0x2e, 0x2a,
+        0x82, 0xb2, 0x63, 0x1c, 0xdf, 0x11, 0x7d, 0xef, 0x84, 0x7e, 0xef, 0x58, 0xf7, 0xaa, 0xfe,
+        0x87, 0xfe, 0x03, 0xa7, 0xfe, 0x2c, 0xc7, 0xfe, 0x0a, 0xc6, 0xfe, 0x82, 0x86, 0xf6, 0xab,
+        0x6b, 0x0a, 0x2e, 0x2a, 0x07, 0x2d, 0x2a, 0x82, 0x8e, 0x3a, 0x39, 0xbe, 0x14, 0x7d, 0xef,
+        0x81, 0x13, 0xf7, 0x02, 0x87, 0xfe, 0x03, 0xa7, 0xfe, 0x2a, 0xc7, 0xfe, 0x0b, 0xc6, 0xfe,
+        0x82, 0xe7, 0xd5, 0xac, 0x42, 0x11, 0x2d, 0x2a, 0x81, 0x54, 0x7c, 0x14, 0x7d, 0xef, 0x85,
+        0x7e, 0xef, 0x7b, 0xf7, 0xab, 0xfe, 0x67, 0xfe, 0x87, 0xfe, 0x03, 0xa7, 0xfe, 0x29, 0xc7,
+        0xfe, 0x0b, 0xc6, 0xfe, 0x81, 0xa9, 0x9c, 0x11, 0x2d, 0x2a, 0x82, 0x8e, 0x3a, 0x39, 0xbe,
+        0x16, 0x7d, 0xef, 0x81, 0x35, 0xf7, 0x03, 0xef, 0xf6, 0x84, 0xee, 0xfe, 0xcb, 0xfe, 0xc8,
+        0xfe, 0xa7, 0xfe, 0x26, 0xc7, 0xfe, 0x0b, 0xc6, 0xfe, 0x82, 0x46, 0xee, 0x4b, 0x5b, 0x11,
+        0x2d, 0x2a, 0x82, 0x71, 0x5b, 0x3c, 0xe7, 0x16, 0x7d, 0xef, 0x81, 0x9e, 0xef, 0x03, 0x9e,
+        0xf7, 0x84, 0x7d, 0xf7, 0x7b, 0xf7, 0x36, 0xf7, 0xed, 0xfe, 0x03, 0xa7, 0xfe, 0x22, 0xc7,
+        0xfe, 0x0c, 0xc6, 0xfe, 0x82, 0x08, 0xb5, 0x4c, 0x2a, 0x0b, 0x2d, 0x2a, 0x06, 0x2d, 0x22,
+        0x81, 0x54, 0x74, 0x1c, 0x7d, 0xef, 0x02, 0x7e, 0xef, 0x83, 0x7c, 0xf7, 0x12, 0xf7, 0xa8,
+        0xfe, 0x05, 0xa7, 0xfe, 0x1d, 0xc7, 0xfe, 0x0c, 0xc6, 0xfe, 0x82, 0x46, 0xee, 0x4b, 0x5b,
+        0x12, 0x2d, 0x22, 0x81, 0x77, 0x9d, 0x1e, 0x7d, 0xef, 0x84, 0x7e, 0xef, 0x7d, 0xf7, 0x13,
+        0xf7, 0xa8, 0xfe, 0x04, 0xa7, 0xfe, 0x1c, 0xc7, 0xfe, 0x0d, 0xc6, 0xfe, 0x82, 0x08, 0xad,
+        0x4c, 0x22, 0x12, 0x2d, 0x22, 0x81, 0xf8, 0xad, 0x1f, 0x7d, 0xef, 0x84, 0x7e, 0xef, 0x7d,
+        0xf7, 0xcf, 0xf6, 0x86, 0xfe, 0x04, 0xa7, 0xfe, 0x1a, 0xc7, 0xfe, 0x0d, 0xc6, 0xfe, 0x82,
+        0x26, 0xe6, 0x2b, 0x53, 0x13, 0x2d, 0x22, 0x81, 0xb8, 0xad, 0x20, 0x7d, 0xef, 0x84, 0x7e,
+        0xef, 0x38, 0xf7, 0x69, 0xf6, 0x86, 0xfe, 0x04, 0xa7, 0xfe, 0x18, 0xc7, 0xfe, 0x0d, 0xc6,
+        0xfe, 0x82, 0xa6, 0xfe, 0x69, 0x94, 0x14, 0x2d, 0x22, 0x81, 0x15, 0x95, 0x21, 0x7d, 0xef,
+        0x84, 0x7d, 0xf7, 0xae, 0xf6, 0x46, 0xf6, 0x87, 0xfe, 0x03, 0xa7, 0xfe, 0x17, 0xc7, 0xfe,
+        0x0e, 0xc6, 0xfe, 0x82, 0xc7, 0xcd, 0xac, 0x3a, 0x14, 0x2d, 0x22, 0x81, 0x12, 0x6c, 0x21,
+        0x7d, 0xef, 0x85, 0x7e, 0xef, 0xf3, 0xf6, 0x06, 0xf6, 0x46, 0xf6, 0x87, 0xfe, 0x02, 0xa7,
+        0xfe, 0x16, 0xc7, 0xfe, 0x0e, 0xc6, 0xfe, 0x82, 0x46, 0xee, 0xaa, 0x6b, 0x15, 0x2d, 0x22,
+        0x82, 0x0f, 0x43, 0xfb, 0xd6, 0x20, 0x7d, 0xef, 0x85, 0x9e, 0xef, 0xf5, 0xf6, 0x06, 0xf6,
+        0x26, 0xf6, 0x66, 0xfe, 0x02, 0xa7, 0xfe, 0x15, 0xc7, 0xfe, 0x0e, 0xc6, 0xfe, 0x83, 0xa6,
+        0xfe, 0x69, 0x94, 0x2c, 0x22, 0x15, 0x2d, 0x22, 0x82, 0x4d, 0x22, 0xb8, 0xad, 0x20, 0x7d,
+        0xef, 0x87, 0x7e, 0xef, 0xf5, 0xee, 0x06, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x67, 0xfe, 0xa7,
+        0xfe, 0x14, 0xc7, 0xfe, 0x0f, 0xc6, 0xfe, 0x82, 0x47, 0xbd, 0x8c, 0x32, 0x17, 0x2d, 0x22,
+        0x82, 0xb1, 0x5b, 0x1c, 0xdf, 0x20, 0x7d, 0xef, 0x81, 0xd2, 0xf6, 0x03, 0x26, 0xf6, 0x83,
+        0x46, 0xf6, 0x87, 0xfe, 0xa7, 0xfe, 0x12, 0xc7, 0xfe, 0x0f, 0xc6, 0xfe, 0x82, 0xc7, 0xd5,
+        0xeb, 0x4a, 0x18, 0x2d, 0x22, 0x82, 0x4d, 0x22, 0x56, 0x9d, 0x1f, 0x7d, 0xef, 0x82, 0x5c,
+        0xef, 0x6d, 0xf6, 0x02, 0x26, 0xf6, 0x02, 0x46, 0xf6, 0x82, 0x66, 0xfe, 0x87, 0xfe, 0x11,
+        0xc7, 0xfe, 0x0f, 0xc6, 0xfe, 0x82, 0x06, 0xde, 0x2b, 0x53, 0x1a, 0x2d, 0x22, 0x82, 0xcf,
+        0x3a, 0x39, 0xbe, 0x1d, 0x7d, 0xef, 0x83, 0x7e, 0xef, 0xf8, 0xee, 0x28, 0xf6, 0x02, 0x26,
+        0xf6, 0x82, 0x46, 0xf6, 0x46, 0xfe, 0x02, 0x66, 0xfe, 0x81, 0x87, 0xfe, 0x0e, 0xc7, 0xfe,
+        0x10, 0xc6, 0xfe, 0x82, 0x26, 0xe6, 0x6a, 0x63, 0x1c, 0x2d, 0x22, 0x82, 0x50, 0x53, 0x79,
+        0xce, 0x1c, 0x7d, 0xef, 0x83, 0x5c, 0xef, 0x4e, 0xee, 0x06, 0xf6, 0x02, 0x26, 0xf6, 0x82,
+        0x46, 0xf6, 0x46, 0xfe, 0x03, 0x66, 0xfe, 0x81, 0x87, 0xfe, 0x0c, 0xc7, 0xfe, 0x10, 0xc6,
+        0xfe, 0x82, 0x26, 0xe6, 0xaa, 0x73, 0x1e, 0x2d, 0x22, 0x82, 0x2f, 0x4b, 0xf8, 0xb5, 0x1a,
+        0x7d, 0xef, 0x85, 0x5c, 0xef, 0x71, 0xee, 0x07, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x02, 0x46,
+        0xf6, 0x05, 0x66, 0xfe, 0x81, 0x87, 0xfe, 0x09, 0xc7, 0xfe, 0x11, 0xc6, 0xfe, 0x82, 0x06,
+        0xde, 0x6a, 0x63, 0x20, 0x2d, 0x22, 0x83, 0xae, 0x3a, 0x94, 0x84, 0x9a, 0xce, 0x15, 0x7d,
+        0xef, 0x85, 0x7e, 0xef, 0x7d, 0xef, 0x3b, 0xef, 0x71, 0xee, 0x07, 0xf6, 0x03, 0x26, 0xf6,
+        0x02, 0x46, 0xf6, 0x05, 0x66, 0xfe, 0x82, 0x86, 0xfe, 0xa7, 0xfe, 0x07, 0xc7, 0xfe, 0x10,
+        0xc6, 0xfe, 0x83, 0xa6, 0xfe, 0xc7, 0xd5, 0x2b, 0x53, 0x23, 0x2d, 0x22, 0x85, 0xef, 0x42,
+        0x73, 0x7c, 0xf8, 0xb5, 0x9a, 0xce, 0x1c, 0xe7, 0x10, 0x5d, 0xef, 0x85, 0x3c, 0xef, 0x19,
+        0xef, 0xb4, 0xee, 0x2c, 0xee, 0x06, 0xf6, 0x03, 0x26, 0xf6, 0x02, 0x46, 0xf6, 0x03, 0x66,
+        0xfe, 0x05, 0x86, 0xfe, 0x81, 0xa6, 0xfe, 0x04, 0xc7, 0xfe, 0x11, 0xc6, 0xfe, 0x83, 0xa6,
+        0xfe, 0x47, 0xbd, 0xeb, 0x4a, 0x26, 0x2d, 0x22, 0x85, 0x4d, 0x22, 0xcf, 0x3a, 0x70, 0x53,
+        0xb1, 0x5b, 0xd1, 0x5b, 0x03, 0xb1, 0x5b, 0x02, 0xd1, 0x5b, 0x82, 0xb0, 0x94, 0xed, 0xdd,
+        0x07, 0x4d, 0xee, 0x83, 0x4c, 0xee, 0x29, 0xf6, 0x27, 0xf6, 0x03, 0x26, 0xf6, 0x02, 0x46,
+        0xf6, 0x81, 0x46, 0xfe, 0x02, 0x66, 0xfe, 0x08, 0x86, 0xfe, 0x82, 0xa6, 0xfe, 0xc7, 0xfe,
+        0x12, 0xc6, 0xfe, 0x83, 0x46, 0xee, 0x69, 0x94, 0x8c, 0x32, 0x31, 0x2d, 0x22, 0x83, 0x2c,
+        0x22, 0x6a, 0x63, 0x67, 0xcd, 0x07, 0x26, 0xf6, 0x06, 0x46, 0xf6, 0x81, 0x46, 0xfe, 0x02,
+        0x66, 0xfe, 0x0a, 0x86, 0xfe, 0x81, 0xa6, 0xfe, 0x10, 0xc6, 0xfe, 0x84, 0xa6, 0xfe, 0xa7,
+        0xcd, 0x8a, 0x6b, 0x2c, 0x22, 0x34, 0x2d, 0x22, 0x83, 0xcb, 0x42, 0x49, 0x94, 0xc6, 0xdd,
+        0x08, 0x46, 0xf6, 0x05, 0x66, 0xfe, 0x0c, 0x86, 0xfe, 0x81, 0xa6, 0xfe, 0x0d, 0xc6, 0xfe,
+        0x84, 0xa6, 0xfe, 0x26, 0xe6, 0x69, 0x94, 0xac, 0x3a, 0x1b, 0x2d, 0x22, 0x1c, 0x0d, 0x22,
+        0x84, 0x0c, 0x22, 0x0b, 0x53, 0xc8, 0xac, 0xe6, 0xe5, 0x09, 0x66, 0xfe, 0x0f, 0x86, 0xfe,
+        0x81, 0xa6, 0xfe, 0x0a, 0xc6, 0xfe, 0x84, 0xa6, 0xfe, 0x46, 0xee, 0xe8, 0xac, 0x0b, 0x53,
+        0x3b, 0x0d, 0x22, 0x85, 0x4c, 0x2a, 0x2b, 0x5b, 0xc8, 0xac, 0x06, 0xee, 0x66, 0xfe, 0x16,
+        0x86, 0xfe, 0x81, 0xa6, 0xfe, 0x07, 0xc6, 0xfe, 0x85, 0xa6, 0xfe, 0x46, 0xee, 0xe8, 0xac,
+        0x2b, 0x5b, 0x2c, 0x22, 0x3e, 0x0d, 0x22, 0x85, 0x2c, 0x22, 0x0b, 0x53, 0x69, 0x9c, 0xa7,
+        0xd5, 0x26, 0xf6, 0x06, 0x86, 0xfe, 0x09, 0xa6, 0xfe, 0x06, 0x86, 0xfe, 0x81, 0xa6, 0xfe,
+        0x03, 0xc6, 0xfe, 0x86, 0xa6, 0xfe, 0x66, 0xf6, 0xc7, 0xd5, 0x69, 0x9c, 0x0b, 0x53, 0x2c,
+        0x22, 0x43, 0x0d, 0x22, 0x85, 0x8c, 0x3a, 0x8a, 0x6b, 0xa8, 0xa4, 0xa7, 0xd5, 0x26, 0xf6,
+        0x02, 0x86, 0xfe, 0x09, 0xa6, 0xfe, 0x09, 0x86, 0xfe, 0x85, 0x66, 0xf6, 0xc7, 0xd5, 0xc8,
+        0xa4, 0x8a, 0x6b, 0x8c, 0x3a, 0x49, 0x0d, 0x22, 0x86, 0x8c, 0x3a, 0x0b, 0x53, 0x29, 0x8c,
+        0xc8, 0xac, 0x67, 0xcd, 0xe6, 0xe5, 0x02, 0x46, 0xf6, 0x08, 0x86, 0xfe, 0x02, 0x46, 0xf6,
+        0x86, 0x06, 0xe6, 0x87, 0xcd, 0xc8, 0xac, 0xe9, 0x83, 0x0b, 0x53, 0x8c, 0x3a, 0x50, 0x0d,
+        0x22, 0x87, 0x6c, 0x32, 0xcb, 0x42, 0x0b, 0x53, 0x4a, 0x63, 0xe9, 0x7b, 0x69, 0x94, 0x69,
+        0x9c, 0x02, 0xa8, 0xa4, 0x88, 0x88, 0xa4, 0x49, 0x94, 0xe9, 0x7b, 0x6a, 0x6b, 0xeb, 0x4a,
+        0xab, 0x42, 0x6c, 0x32, 0x2c, 0x22, 0x7f, 0x0d, 0x22, 0x72, 0x0d, 0x22, 0x7f, 0x0c, 0x22,
+        0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x5c, 0x0c, 0x22,
+
+};
+
+const lv_image_dsc_t image_mostly_sunny_opaque = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
+    .header.w = 100,
+    .header.h = 100,
+    .header.stride = 200,
+    .header.reserved_2 = 0,
+    .data_size = sizeof(image_mostly_sunny_opaque_map),
+    .data = image_mostly_sunny_opaque_map,
+    .reserved = NULL,
+};
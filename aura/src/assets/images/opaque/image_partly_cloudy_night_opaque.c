@@ -0,0 +1,181 @@
+// Generated by tools/flatten_images.py from image_partly_cloudy_night.c: pre-blended onto the
+// main screen gradient at y = 4. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_PARTLY_CLOUDY_NIGHT_OPAQUE
+  #define LV_ATTRIBUTE_IMAGE_PARTLY_CLOUDY_NIGHT_OPAQUE
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_PARTLY_CLOUDY_NIGHT_OPAQUE uint8_t
+    image_partly_cloudy_night_opaque_map[] = {
+
+        0x01, 0x00, 0x00, 0x00, 0xf3, 0x07, 0x00, 0x00, 0x20, 0x4e, 0x00, 0x00, 0x7f, 0x90, 0x2a,
+        0x7f, 0x90, 0x2a, 0x7f, 0x90, 0x2a, 0x13, 0x90, 0x2a, 0x7f, 0x8f, 0x2a, 0x7f, 0x8f, 0x2a,
+        0x7f, 0x8f, 0x2a, 0x3d, 0x8f, 0x2a, 0x87, 0xcf, 0x32, 0x31, 0x43, 0x92, 0x4b, 0xd3, 0x53,
+        0x35, 0x64, 0x76, 0x74, 0xf0, 0x32, 0x59, 0x8f, 0x2a, 0x86, 0xf0, 0x3a, 0x92, 0x4b, 0x96,
+        0x74, 0x59, 0x95, 0xba, 0xa5, 0x9d, 0xc6, 0x02, 0xde, 0xce, 0x83, 0x1f, 0xcf, 0x18, 0x85,
+        0xaf, 0x2a, 0x33, 0x8f, 0x2a, 0x23, 0x6f, 0x2a, 0x85, 0xd0, 0x3a, 0xd4, 0x5b, 0xf8, 0x84,
+        0xfb, 0xad, 0xbe, 0xc6, 0x02, 0x1f, 0xcf, 0x04, 0xff, 0xce, 0x82, 0x5d, 0xb6, 0x32, 0x43,
+        0x54, 0x6f, 0x2a, 0x85, 0x8f, 0x2a, 0x52, 0x4b, 0xb7, 0x7c, 0xfb, 0xad, 0xde, 0xce, 0x06,
+        0x1f, 0xcf, 0x03, 0xff, 0xce, 0x81, 0xd7, 0x7c, 0x53, 0x6f, 0x2a, 0x85, 0x8f, 0x2a, 0x72,
+        0x4b, 0x18, 0x8d, 0x9d, 0xc6, 0x1f, 0xd7, 0x08, 0x1f, 0xcf, 0x02, 0xff, 0xce, 0x82, 0x5d,
+        0xb6, 0x32, 0x43, 0x52, 0x6f, 0x2a, 0x83, 0x32, 0x43, 0x38, 0x8d, 0x9d, 0xc6, 0x0b, 0x1f,
+        0xcf, 0x02, 0xff, 0xce, 0x81, 0xd7, 0x7c, 0x51, 0x6f, 0x2a, 0x84, 0xd0, 0x32, 0xb7, 0x7c,
+        0x7d, 0xbe, 0x1f, 0xd7, 0x0d, 0x1f, 0xcf, 0x82, 0x7d, 0xbe, 0x52, 0x4b, 0x50, 0x6f, 0x2a,
+        0x82, 0xb3, 0x53, 0xdb, 0xa5, 0x02, 0x1f, 0xd7, 0x0e, 0x1f, 0xcf, 0x82, 0x59, 0x95, 0x8f,
+        0x2a, 0x4e, 0x6f, 0x2a, 0x83, 0xb0, 0x32, 0xb7, 0x7c, 0x9d, 0xc6, 0x04, 0x1f, 0xd7, 0x0c,
+        0x1f, 0xcf, 0x82, 0xbe, 0xc6, 0xf4, 0x5b, 0x4e, 0x6f, 0x2a, 0x82, 0x11, 0x43, 0x79, 0x95,
+        0x06, 0x1f, 0xd7, 0x0c, 0x1f, 0xcf, 0x82, 0x5c, 0xae, 0xf1, 0x3a, 0x4d, 0x6f, 0x2a, 0x82,
+        0x72, 0x4b, 0xfb, 0xad, 0x07, 0x1f, 0xd7, 0x0c, 0x1f, 0xcf, 0x81, 0x39, 0x8d, 0x4d, 0x6f,
+        0x2a, 0x82, 0xb3, 0x53, 0x7d, 0xbe, 0x09, 0x1f, 0xd7, 0x0b, 0x1f, 0xcf, 0x81, 0xd4, 0x5b,
+        0x4c, 0x6f, 0x2a, 0x82, 0xb3, 0x53, 0x7d, 0xbe, 0x0a, 0x1f, 0xd7, 0x0a, 0x1f, 0xcf, 0x82,
+        0x7d, 0xb6, 0x11, 0x43, 0x4b, 0x6f, 0x2a, 0x82, 0xb3, 0x53, 0x7d, 0xbe, 0x0b, 0x1f, 0xd7,
+        0x0a, 0x1f, 0xcf, 0x82, 0x9a, 0x9d, 0x8f, 0x2a, 0x4a, 0x6f, 0x2a, 0x82, 0x72, 0x4b, 0x7d,
+        0xbe, 0x0c, 0x1f, 0xd7, 0x0a, 0x1f, 0xcf, 0x81, 0xd7, 0x7c, 0x4a, 0x6f, 0x2a, 0x82, 0x11,
+        0x43, 0x3c, 0xb6, 0x0c, 0x1f, 0xd7, 0x0a, 0x1f, 0xcf, 0x82, 0xde, 0xc6, 0xd4, 0x5b, 0x49,
+        0x6f, 0x2a, 0x82, 0xb0, 0x32, 0x9a, 0x9d, 0x0d, 0x1f, 0xd7, 0x0a, 0x1f, 0xcf, 0x82, 0xde,
+        0xc6, 0x52, 0x4b, 0x49, 0x6f, 0x2a, 0x81, 0xb7, 0x7c, 0x0e, 0x1f, 0xd7, 0x0a, 0x1f, 0xcf,
+        0x82, 0x3c, 0xae, 0x11, 0x43, 0x48, 0x6f, 0x2a, 0x82, 0xb3, 0x53, 0xbe, 0xc6, 0x0d, 0x1f,
+        0xd7, 0x0b, 0x1f, 0xcf, 0x82, 0xdb, 0xa5, 0xaf, 0x32, 0x47, 0x6f, 0x2a, 0x82, 0xf1, 0x3a,
+        0xfb, 0xad, 0x0d, 0x1f, 0xd7, 0x0c, 0x1f, 0xcf, 0x82, 0x9a, 0x95, 0x8f, 0x2a, 0x47, 0x6f,
+        0x2a, 0x81, 0xb7, 0x7c, 0x0e, 0x1f, 0xd7, 0x0c, 0x1f, 0xcf, 0x81, 0x79, 0x95, 0x47, 0x6f,
+        0x2a, 0x82, 0x72, 0x4b, 0x9d, 0xc6, 0x0d, 0x1f, 0xd7, 0x0d, 0x1f, 0xcf, 0x81, 0x79, 0x95,
+        0x46, 0x6f, 0x2a, 0x82, 0x8f, 0x2a, 0x79, 0x95, 0x09, 0x1f, 0xd7, 0x12, 0x1f, 0xcf, 0x81,
+        0x79, 0x95, 0x46, 0x6f, 0x2a, 0x82, 0x93, 0x53, 0xbe, 0xbe, 0x04, 0x1f, 0xcf, 0x02, 0x1f,
+        0xd7, 0x81, 0x1f, 0xcf, 0x14, 0xff, 0xce, 0x81, 0x59, 0x95, 0x45, 0x6f, 0x2a, 0x82, 0x8f,
+        0x2a, 0x59, 0x95, 0x05, 0x1f, 0xcf, 0x17, 0xff, 0xce, 0x81, 0x59, 0x95, 0x45, 0x6f, 0x2a,
+        0x82, 0x72, 0x4b, 0x9d, 0xc6, 0x03, 0x1f, 0xcf, 0x07, 0xff, 0xce, 0x02, 0x1f, 0xd7, 0x81,
+        0x3e, 0xdf, 0x06, 0x5e, 0xe7, 0x83, 0x3e, 0xdf, 0x3f, 0xdf, 0x1f, 0xd7, 0x06, 0xff, 0xce,
+        0x81, 0x59, 0x95, 0x3a, 0x6f, 0x2a, 0x0b, 0x6e, 0x2a, 0x81, 0xd7, 0x84, 0x03, 0x1f, 0xcf,
+        0x05, 0xff, 0xce, 0x83, 0x1f, 0xd7, 0x3e, 0xdf, 0x5e, 0xe7, 0x02, 0x7e, 0xef, 0x82, 0x9e,
+        0xef, 0x7d, 0xef, 0x05, 0x7d, 0xf7, 0x87, 0x7e, 0xef, 0x9e, 0xef, 0x7e, 0xef, 0x7e, 0xe7,
+        0x3e, 0xe7, 0x1f, 0xd7, 0xff, 0xce, 0x02, 0xdf, 0xce, 0x81, 0x59, 0x95, 0x3a, 0x6e, 0x2a,
+        0x0a, 0x4e, 0x2a, 0x83, 0xaf, 0x3a, 0x1b, 0xb6, 0x1f, 0xcf, 0x05, 0xff, 0xce, 0x82, 0x3f,
+        0xdf, 0x5e, 0xe7, 0x02, 0x7e, 0xef, 0x81, 0x7d, 0xf7, 0x0c, 0x7d, 0xef, 0x02, 0x7d, 0xf7,
+        0x02, 0x7e, 0xef, 0x84, 0x3e, 0xdf, 0xff, 0xce, 0x59, 0x95, 0x6e, 0x2a, 0x43, 0x4e, 0x2a,
+        0x82, 0xb3, 0x5b, 0xde, 0xc6, 0x04, 0xff, 0xce, 0x84, 0x1f, 0xd7, 0x5e, 0xe7, 0x7e, 0xef,
+        0x7d, 0xf7, 0x13, 0x7d, 0xef, 0x02, 0x7e, 0xef, 0x82, 0x3b, 0xb6, 0xd0, 0x3a, 0x43, 0x4e,
+        0x2a, 0x81, 0x18, 0x8d, 0x03, 0xff, 0xce, 0x84, 0x1f, 0xd7, 0x5e, 0xe7, 0x7e, 0xef, 0x7d,
+        0xf7, 0x17, 0x7d, 0xef, 0x83, 0x7e, 0xef, 0xd9, 0xad, 0x51, 0x53, 0x41, 0x4e, 0x2a, 0x82,
+        0xd0, 0x3a, 0x1b, 0xae, 0x02, 0xff, 0xce, 0x82, 0x1f, 0xd7, 0x7e, 0xef, 0x1c, 0x7d, 0xef,
+        0x83, 0xbc, 0xd6, 0x33, 0x74, 0x6e, 0x2a, 0x3f, 0x4e, 0x2a, 0x86, 0x51, 0x4b, 0x9d, 0xbe,
+        0xff, 0xce, 0x3f, 0xdf, 0x7e, 0xef, 0x7d, 0xf7, 0x1d, 0x7d, 0xef, 0x83, 0x3c, 0xe7, 0xd6,
+        0x8c, 0x6e, 0x2a, 0x3e, 0x4e, 0x2a, 0x84, 0x75, 0x74, 0xff, 0xce, 0x3e, 0xdf, 0x7e, 0xef,
+        0x20, 0x7d, 0xef, 0x83, 0x3c, 0xe7, 0x37, 0x95, 0x8f, 0x32, 0x3d, 0x4e, 0x2a, 0x83, 0x38,
+        0x8d, 0x3f, 0xdf, 0x7e, 0xef, 0x23, 0x7d, 0xef, 0x82, 0xf6, 0x8c, 0x6e, 0x2a, 0x3b, 0x4e,
+        0x2a, 0x83, 0x8f, 0x32, 0xfa, 0xad, 0x7e, 0xef, 0x24, 0x7d, 0xef, 0x82, 0x3c, 0xe7, 0xb5,
+        0x84, 0x3b, 0x4e, 0x2a, 0x82, 0x31, 0x4b, 0xfc, 0xd6, 0x26, 0x7d, 0xef, 0x82, 0xfb, 0xd6,
+        0xd2, 0x63, 0x3a, 0x4e, 0x2a, 0x81, 0xf6, 0x8c, 0x28, 0x7d, 0xef, 0x82, 0x5a, 0xbe, 0xef,
+        0x42, 0x38, 0x4e, 0x2a, 0x82, 0x92, 0x5b, 0xfc, 0xd6, 0x29, 0x7d, 0xef, 0x82, 0x36, 0x95,
+        0x6e, 0x2a, 0x36, 0x4e, 0x2a, 0x82, 0x8e, 0x32, 0xd8, 0xad, 0x2a, 0x7d, 0xef, 0x82, 0xfb,
+        0xd6, 0x51, 0x53, 0x36, 0x4e, 0x2a, 0x82, 0xd2, 0x63, 0x3c, 0xe7, 0x2b, 0x7d, 0xef, 0x82,
+        0x77, 0xa5, 0x6e, 0x2a, 0x34, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x97, 0xa5, 0x2c, 0x7d, 0xef,
+        0x82, 0xfb, 0xd6, 0x30, 0x4b, 0x34, 0x4e, 0x2a, 0x82, 0x51, 0x53, 0xfb, 0xd6, 0x2d, 0x7d,
+        0xef, 0x82, 0xf5, 0x8c, 0xaf, 0x3a, 0x04, 0xf0, 0x42, 0x02, 0xaf, 0x3a, 0x81, 0x8e, 0x32,
+        0x2c, 0x4e, 0x2a, 0x81, 0xb5, 0x84, 0x2e, 0x7d, 0xef, 0x81, 0x3d, 0xe7, 0x06, 0xdc, 0xd6,
+        0x86, 0x9a, 0xce, 0xf8, 0xb5, 0x57, 0x9d, 0x75, 0x7c, 0x30, 0x4b, 0x6e, 0x2a, 0x27, 0x4e,
+        0x2a, 0x82, 0x6e, 0x2a, 0xf8, 0xb5, 0x39, 0x7d, 0xef, 0x84, 0xfb, 0xd6, 0xd9, 0xad, 0x13,
+        0x6c, 0x8f, 0x32, 0x25, 0x4e, 0x2a, 0x82, 0x10, 0x43, 0xbb, 0xd6, 0x3b, 0x7d, 0xef, 0x83,
+        0x3d, 0xe7, 0xf8, 0xb5, 0x91, 0x5b, 0x24, 0x4e, 0x2a, 0x82, 0xd2, 0x63, 0x3c, 0xe7, 0x3d,
+        0x7d, 0xef, 0x83, 0xfb, 0xd6, 0x74, 0x7c, 0x6e, 0x2a, 0x22, 0x4e, 0x2a, 0x81, 0x54, 0x74,
+        0x3f, 0x7d, 0xef, 0x83, 0x3c, 0xe7, 0x36, 0x95, 0x8e, 0x32, 0x21, 0x4e, 0x2a, 0x81, 0xf6,
+        0x8c, 0x41, 0x7d, 0xef, 0x82, 0x36, 0x95, 0x6e, 0x2a, 0x1f, 0x4e, 0x2a, 0x82, 0x6e, 0x2a,
+        0x77, 0xa5, 0x41, 0x7d, 0xef, 0x82, 0x3c, 0xe7, 0x74, 0x7c, 0x1f, 0x4e, 0x2a, 0x82, 0x6e,
+        0x2a, 0xd8, 0xad, 0x42, 0x7d, 0xef, 0x82, 0xfb, 0xd6, 0x91, 0x5b, 0x1e, 0x4e, 0x2a, 0x82,
+        0x6e, 0x2a, 0xf8, 0xb5, 0x43, 0x7d, 0xef, 0x82, 0xf8, 0xb5, 0x8e, 0x32, 0x1d, 0x4e, 0x2a,
+        0x82, 0x6e, 0x2a, 0x97, 0xa5, 0x43, 0x7d, 0xef, 0x82, 0x3c, 0xe7, 0xf3, 0x6b, 0x1e, 0x4e,
+        0x2a, 0x81, 0x56, 0x9d, 0x44, 0x7d, 0xef, 0x82, 0xd8, 0xad, 0x6e, 0x2a, 0x19, 0x4e, 0x2a,
+        0x04, 0x2e, 0x2a, 0x81, 0x95, 0x84, 0x44, 0x7d, 0xef, 0x82, 0xfb, 0xd6, 0x10, 0x4b, 0x1d,
+        0x2e, 0x2a, 0x81, 0x13, 0x74, 0x45, 0x7d, 0xef, 0x81, 0x74, 0x7c, 0x1d, 0x2e, 0x2a, 0x82,
+        0x71, 0x5b, 0x1c, 0xdf, 0x44, 0x7d, 0xef, 0x81, 0x16, 0x95, 0x19, 0x2e, 0x2a, 0x04, 0x2d,
+        0x2a, 0x82, 0x8e, 0x3a, 0x7a, 0xc6, 0x44, 0x7d, 0xef, 0x82, 0xd8, 0xb5, 0x6d, 0x32, 0x1d,
+        0x2d, 0x2a, 0x81, 0x97, 0xa5, 0x44, 0x7d, 0xef, 0x82, 0x9a, 0xce, 0x8e, 0x3a, 0x1d, 0x2d,
+        0x2a, 0x81, 0xf2, 0x6b, 0x44, 0x7d, 0xef, 0x82, 0xbb, 0xd6, 0x8e, 0x3a, 0x1d, 0x2d, 0x2a,
+        0x82, 0xcf, 0x3a, 0x9a, 0xce, 0x43, 0x7d, 0xef, 0x82, 0x9a, 0xce, 0x8e, 0x3a, 0x18, 0x2d,
+        0x2a, 0x06, 0x2d, 0x22, 0x81, 0xd5, 0x8c, 0x43, 0x7d, 0xef, 0x82, 0x19, 0xb6, 0x6e, 0x2a,
+        0x1e, 0x2d, 0x22, 0x82, 0x0f, 0x43, 0xbb, 0xce, 0x42, 0x7d, 0xef, 0x82, 0x36, 0x95, 0x4d,
+        0x22, 0x1f, 0x2d, 0x22, 0x81, 0xd5, 0x8c, 0x42, 0x7d, 0xef, 0x81, 0x94, 0x7c, 0x20, 0x2d,
+        0x22, 0x82, 0xcf, 0x3a, 0x3a, 0xbe, 0x40, 0x7d, 0xef, 0x84, 0x3c, 0xe7, 0x14, 0x6c, 0x6e,
+        0x2a, 0x4d, 0x22, 0x1f, 0x2d, 0x22, 0x82, 0xd2, 0x5b, 0x1c, 0xdf, 0x3f, 0x7d, 0xef, 0x89,
+        0x1d, 0xdf, 0xfb, 0xad, 0x5a, 0x95, 0xb7, 0x7c, 0x96, 0x74, 0x35, 0x6c, 0x72, 0x53, 0x10,
+        0x43, 0xf0, 0x3a, 0x02, 0xcf, 0x32, 0x81, 0x8e, 0x2a, 0x17, 0x2d, 0x22, 0x82, 0x4d, 0x22,
+        0xd5, 0x8c, 0x3f, 0x7d, 0xef, 0x87, 0x9c, 0xc6, 0xfc, 0xad, 0xfd, 0xad, 0x1d, 0xae, 0x1d,
+        0xb6, 0x3d, 0xb6, 0x1c, 0xae, 0x02, 0xfc, 0xa5, 0x83, 0xfc, 0xad, 0xdc, 0xad, 0x72, 0x4b,
+        0x18, 0x2d, 0x22, 0x82, 0x8e, 0x32, 0x97, 0xa5, 0x3d, 0x7d, 0xef, 0x84, 0x1d, 0xdf, 0x1c,
+        0xb6, 0xfd, 0xad, 0x1d, 0xae, 0x02, 0x1d, 0xb6, 0x02, 0x3d, 0xb6, 0x02, 0x5e, 0xb6, 0x82,
+        0x3e, 0xb6, 0x96, 0x74, 0x1a, 0x2d, 0x22, 0x82, 0xae, 0x32, 0xd8, 0xb5, 0x3b, 0x7d, 0xef,
+        0x86, 0x5d, 0xef, 0x7c, 0xc6, 0xfc, 0xad, 0xfd, 0xad, 0x1d, 0xae, 0x1d, 0xb6, 0x02, 0x3d,
+        0xb6, 0x03, 0x5e, 0xb6, 0x82, 0x18, 0x85, 0x6e, 0x2a, 0x1b, 0x2d, 0x22, 0x82, 0xcf, 0x3a,
+        0xb7, 0xad, 0x3a, 0x7d, 0xef, 0x84, 0xbc, 0xd6, 0xfc, 0xad, 0xfd, 0xad, 0x1d, 0xae, 0x02,
+        0x1d, 0xb6, 0x82, 0x3d, 0xb6, 0x5d, 0xb6, 0x02, 0x5e, 0xb6, 0x82, 0x9a, 0x9d, 0xf0, 0x3a,
+        0x1d, 0x2d, 0x22, 0x83, 0xae, 0x32, 0x56, 0x9d, 0x1c, 0xe7, 0x37, 0x7d, 0xef, 0x82, 0xfc,
+        0xde, 0x1c, 0xb6, 0x02, 0xfd, 0xad, 0x82, 0x1d, 0xae, 0x1d, 0xb6, 0x02, 0x3d, 0xb6, 0x02,
+        0x5e, 0xb6, 0x82, 0xbb, 0x9d, 0x51, 0x4b, 0x1f, 0x2d, 0x22, 0x83, 0x6d, 0x2a, 0x54, 0x74,
+        0xdb, 0xd6, 0x35, 0x7d, 0xef, 0x83, 0xfc, 0xde, 0x1c, 0xb6, 0xfd, 0xad, 0x02, 0x1d, 0xae,
+        0x81, 0x1d, 0xb6, 0x02, 0x3d, 0xb6, 0x84, 0x5e, 0xb6, 0x5e, 0xbe, 0xdb, 0xa5, 0x52, 0x4b,
+        0x22, 0x2d, 0x22, 0x83, 0x50, 0x4b, 0xb7, 0xad, 0x1c, 0xe7, 0x31, 0x7d, 0xef, 0x84, 0x5d,
+        0xef, 0xdc, 0xd6, 0x1c, 0xb6, 0xfd, 0xad, 0x02, 0x1d, 0xae, 0x81, 0x1d, 0xb6, 0x02, 0x3d,
+        0xb6, 0x02, 0x5e, 0xb6, 0x82, 0xdc, 0xa5, 0x92, 0x53, 0x24, 0x2d, 0x22, 0x84, 0x4d, 0x2a,
+        0xf2, 0x63, 0xf8, 0xb5, 0x1c, 0xe7, 0x2e, 0x7d, 0xef, 0x85, 0x1c, 0xe7, 0x7c, 0xc6, 0xfc,
+        0xad, 0xfd, 0xad, 0x1d, 0xae, 0x02, 0x1d, 0xb6, 0x02, 0x3d, 0xb6, 0x02, 0x5e, 0xb6, 0x82,
+        0xbb, 0x9d, 0x52, 0x4b, 0x27, 0x2d, 0x22, 0x85, 0x6d, 0x2a, 0xb1, 0x5b, 0x77, 0x9d, 0x9a,
+        0xce, 0x5d, 0xef, 0x28, 0x7d, 0xef, 0x86, 0x5d, 0xef, 0x1c, 0xe7, 0x9c, 0xce, 0x1c, 0xb6,
+        0xfd, 0xad, 0x1d, 0xae, 0x03, 0x1d, 0xb6, 0x02, 0x3d, 0xb6, 0x02, 0x5e, 0xb6, 0x82, 0x7a,
+        0x95, 0x11, 0x43, 0x2b, 0x2d, 0x22, 0x85, 0xef, 0x42, 0xd2, 0x63, 0x15, 0x8d, 0x19, 0xbe,
+        0xfc, 0xde, 0x02, 0x3d, 0xe7, 0x20, 0x5d, 0xef, 0x87, 0x3c, 0xe7, 0xfc, 0xde, 0xdc, 0xd6,
+        0x7c, 0xc6, 0x1c, 0xb6, 0xfd, 0xad, 0x1d, 0xae, 0x03, 0x1d, 0xb6, 0x03, 0x3d, 0xb6, 0x02,
+        0x5e, 0xb6, 0x82, 0xf8, 0x84, 0xf0, 0x3a, 0x2f, 0x2d, 0x22, 0x84, 0x6e, 0x2a, 0x14, 0x6c,
+        0xda, 0xa5, 0x3c, 0xbe, 0x1b, 0x5c, 0xbe, 0x05, 0x3c, 0xbe, 0x82, 0x3c, 0xb6, 0x1c, 0xb6,
+        0x03, 0x1d, 0xb6, 0x05, 0x3d, 0xb6, 0x03, 0x5e, 0xb6, 0x83, 0xfc, 0xa5, 0x55, 0x6c, 0x4d,
+        0x2a, 0x32, 0x2d, 0x22, 0x83, 0x31, 0x43, 0x39, 0x95, 0x3d, 0xb6, 0x18, 0x5d, 0xb6, 0x0e,
+        0x3d, 0xb6, 0x03, 0x5e, 0xb6, 0x02, 0x7e, 0xbe, 0x83, 0x7a, 0x95, 0x72, 0x4b, 0x4d, 0x22,
+        0x34, 0x2d, 0x22, 0x84, 0x6e, 0x2a, 0x14, 0x64, 0xbb, 0x9d, 0x5e, 0xbe, 0x15, 0x7e, 0xbe,
+        0x07, 0x5e, 0xbe, 0x07, 0x5e, 0xb6, 0x81, 0x5e, 0xbe, 0x03, 0x7e, 0xbe, 0x83, 0xdc, 0xa5,
+        0x76, 0x74, 0xaf, 0x32, 0x1b, 0x2d, 0x22, 0x1d, 0x0d, 0x22, 0x83, 0xaf, 0x3a, 0x76, 0x74,
+        0xdc, 0xad, 0x24, 0x7e, 0xbe, 0x83, 0xfc, 0xad, 0xd7, 0x7c, 0x11, 0x43, 0x3c, 0x0d, 0x22,
+        0x83, 0xf0, 0x3a, 0x96, 0x74, 0xfc, 0xad, 0x1f, 0x9e, 0xbe, 0x84, 0x7e, 0xbe, 0x1c, 0xae,
+        0xd7, 0x7c, 0x31, 0x4b, 0x40, 0x0d, 0x22, 0x85, 0xd0, 0x3a, 0x35, 0x6c, 0x7a, 0x95, 0x5d,
+        0xb6, 0x9e, 0xc6, 0x09, 0xbe, 0xc6, 0x06, 0x9e, 0xc6, 0x0a, 0x9e, 0xbe, 0x84, 0x3d, 0xb6,
+        0xbb, 0xa5, 0x76, 0x74, 0xf0, 0x3a, 0x44, 0x0d, 0x22, 0x86, 0x6e, 0x2a, 0x31, 0x4b, 0x97,
+        0x7c, 0x9a, 0x9d, 0x3c, 0xae, 0x9e, 0xc6, 0x11, 0xbf, 0xc6, 0x87, 0x9e, 0xc6, 0x9e, 0xbe,
+        0x5d, 0xb6, 0xbb, 0xa5, 0x97, 0x7c, 0x72, 0x53, 0x8f, 0x32, 0x49, 0x0d, 0x22, 0x87, 0x6e,
+        0x2a, 0xf0, 0x42, 0xd4, 0x63, 0xb7, 0x7c, 0x39, 0x8d, 0xfc, 0xad, 0x5d, 0xb6, 0x02, 0x7d,
+        0xbe, 0x05, 0xbf, 0xc6, 0x8a, 0xbe, 0xc6, 0x7d, 0xbe, 0x5d, 0xbe, 0x5d, 0xb6, 0x1c, 0xae,
+        0x59, 0x95, 0xd8, 0x84, 0x35, 0x6c, 0x11, 0x43, 0x8f, 0x32, 0x50, 0x0d, 0x22, 0x87, 0x4e,
+        0x2a, 0xaf, 0x32, 0xf0, 0x42, 0x51, 0x4b, 0xb3, 0x5b, 0x14, 0x64, 0x76, 0x74, 0x02, 0xb7,
+        0x7c, 0x87, 0x76, 0x74, 0x35, 0x6c, 0xb3, 0x5b, 0x31, 0x4b, 0xf0, 0x42, 0xd0, 0x3a, 0x4d,
+        0x2a, 0x7f, 0x0d, 0x22, 0x73, 0x0d, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c,
+        0x22, 0x7f, 0x0c, 0x22, 0x5c, 0x0c, 0x22,
+
+};
+
+const lv_image_dsc_t image_partly_cloudy_night_opaque = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
+    .header.w = 100,
+    .header.h = 100,
+    .header.stride = 200,
+    .header.reserved_2 = 0,
+    .data_size = sizeof(image_partly_cloudy_night_opaque_map),
+    .data = image_partly_cloudy_night_opaque_map,
+    .reserved = NULL,
+};
@@ -0,0 +1,244 @@
+// Generated by tools/flatten_images.py from image_partly_cloudy.c: pre-blended onto the
+// main screen gradient at y = 4. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_PARTLY_CLOUDY_OPAQUE
+  #define LV_ATTRIBUTE_IMAGE_PARTLY_CLOUDY_OPAQUE
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_PARTLY_CLOUDY_OPAQUE uint8_t
+    image_partly_cloudy_opaque_map[] = {
+
+        0x01, 0x00, 0x00, 0x00, 0xa7, 0x0b, 0x00, 0x00, 0x20, 0x4e, 0x00, 0x00, 0x7f, 0x90, 0x2a,
+        0x7f, 0x90, 0x2a, 0x7f, 0x90, 0x2a, 0x13, 0x90, 0x2a, 0x7f, 0x8f, 0x2a, 0x7f, 0x8f, 0x2a,
+        0x7f, 0x8f, 0x2a, 0x3c, 0x8f, 0x2a, 0x88, 0xce, 0x32, 0x0e, 0x43, 0x4e, 0x4b, 0xcd, 0x6b,
+        0x6c, 0x84, 0xcb, 0x94, 0x0b, 0xa5, 0x2b, 0xad, 0x02, 0x4b, 0xb5, 0x88, 0x2b, 0xad, 0x0b,
+        0xa5, 0xcb, 0x94, 0x6c, 0x84, 0xcd, 0x6b, 0x4e, 0x4b, 0x0e, 0x43, 0xce, 0x32, 0x4e, 0x8f,
+        0x2a, 0x89, 0xce, 0x32, 0x2e, 0x4b, 0x0d, 0x6c, 0xec, 0x9c, 0xaa, 0xbd, 0x29, 0xd6, 0x89,
+        0xee, 0xa8, 0xf6, 0xe8, 0xfe, 0x09, 0xc8, 0xfe, 0x88, 0x88, 0xf6, 0x68, 0xee, 0x29, 0xd6,
+        0xaa, 0xbd, 0xeb, 0x9c, 0x0c, 0x6c, 0x2e, 0x4b, 0xce, 0x32, 0x25, 0x8f, 0x2a, 0x22, 0x6f,
+        0x2a, 0x87, 0x8e, 0x2a, 0x0e, 0x4b, 0x4c, 0x84, 0x6a, 0xb5, 0x69, 0xe6, 0xa9, 0xf6, 0xe8,
+        0xfe, 0x13, 0xc8, 0xfe, 0x86, 0x88, 0xf6, 0x48, 0xe6, 0x6a, 0xb5, 0x4c, 0x84, 0x0e, 0x4b,
+        0x8e, 0x2a, 0x42, 0x6f, 0x2a, 0x85, 0xae, 0x32, 0xcd, 0x6b, 0x2b, 0xad, 0x49, 0xde, 0xe9,
+        0xfe, 0x16, 0xc8, 0xfe, 0x03, 0xc7, 0xfe, 0x02, 0xc8, 0xfe, 0x84, 0x28, 0xde, 0x2b, 0xad,
+        0xcd, 0x6b, 0xae, 0x32, 0x3e, 0x6f, 0x2a, 0x84, 0xae, 0x32, 0xed, 0x6b, 0x8a, 0xbd, 0xa9,
+        0xf6, 0x1a, 0xc8, 0xfe, 0x05, 0xc7, 0xfe, 0x85, 0xc8, 0xfe, 0x88, 0xf6, 0x8a, 0xbd, 0xec,
+        0x6b, 0xae, 0x32, 0x3a, 0x6f, 0x2a, 0x84, 0x8e, 0x2a, 0xed, 0x6b, 0xca, 0xc5, 0xa9, 0xf6,
+        0x1c, 0xc8, 0xfe, 0x08, 0xc7, 0xfe, 0x84, 0x88, 0xf6, 0xca, 0xc5, 0xcd, 0x6b, 0x8e, 0x2a,
+        0x37, 0x6f, 0x2a, 0x83, 0x2e, 0x4b, 0x2b, 0xad, 0x89, 0xee, 0x1e, 0xc8, 0xfe, 0x0a, 0xc7,
+        0xfe, 0x83, 0x68, 0xee, 0x2b, 0xad, 0x2d, 0x4b, 0x34, 0x6f, 0x2a, 0x85, 0xae, 0x32, 0x4c,
+        0x84, 0x49, 0xde, 0xe9, 0xfe, 0xe8, 0xfe, 0x1e, 0xc8, 0xfe, 0x0c, 0xc7, 0xfe, 0x83, 0x28,
+        0xde, 0x4c, 0x84, 0xae, 0x32, 0x31, 0x6f, 0x2a, 0x84, 0x0e, 0x4b, 0x2b, 0xad, 0xa9, 0xf6,
+        0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x0d, 0xc7, 0xfe, 0x83, 0x88, 0xf6, 0x0a,
+        0xad, 0xee, 0x42, 0x2f, 0x6f, 0x2a, 0x82, 0xad, 0x63, 0xea, 0xcd, 0x03, 0xe9, 0xfe, 0x03,
+        0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x0f, 0xc7, 0xfe, 0x82, 0xc9, 0xcd, 0x6d, 0x5b, 0x2d, 0x6f,
+        0x2a, 0x82, 0xed, 0x6b, 0x49, 0xde, 0x04, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe,
+        0x10, 0xc7, 0xfe, 0x82, 0x28, 0xde, 0xec, 0x6b, 0x2a, 0x6f, 0x2a, 0x83, 0x8e, 0x2a, 0x2c,
+        0x7c, 0x69, 0xe6, 0x06, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe, 0x11, 0xc7, 0xfe,
+        0x83, 0x48, 0xe6, 0x2c, 0x7c, 0x8e, 0x2a, 0x27, 0x6f, 0x2a, 0x83, 0x8e, 0x2a, 0x4c, 0x84,
+        0x89, 0xee, 0x07, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe, 0x12, 0xc7, 0xfe, 0x83,
+        0x67, 0xee, 0x4c, 0x84, 0x8e, 0x2a, 0x26, 0x6f, 0x2a, 0x82, 0x2c, 0x7c, 0x89, 0xee, 0x08,
+        0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe, 0x13, 0xc7, 0xfe, 0x82, 0x67, 0xee, 0x2c,
+        0x7c, 0x25, 0x6f, 0x2a, 0x82, 0xed, 0x6b, 0x69, 0xe6, 0x08, 0xe9, 0xfe, 0x03, 0xe8, 0xfe,
+        0x1d, 0xc8, 0xfe, 0x14, 0xc7, 0xfe, 0x82, 0x48, 0xe6, 0xec, 0x6b, 0x23, 0x6f, 0x2a, 0x82,
+        0xad, 0x63, 0x49, 0xde, 0x09, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x15, 0xc7,
+        0xfe, 0x82, 0x28, 0xde, 0x6d, 0x5b, 0x21, 0x6f, 0x2a, 0x82, 0x0e, 0x4b, 0xea, 0xcd, 0x09,
+        0xe9, 0xfe, 0x04, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x16, 0xc7, 0xfe, 0x82, 0xc9, 0xcd, 0xee,
+        0x42, 0x1f, 0x6f, 0x2a, 0x82, 0xae, 0x32, 0x2b, 0xad, 0x0a, 0xe9, 0xfe, 0x03, 0xe8, 0xfe,
+        0x1e, 0xc8, 0xfe, 0x17, 0xc7, 0xfe, 0x82, 0x0a, 0xad, 0xae, 0x32, 0x1e, 0x6f, 0x2a, 0x82,
+        0x4c, 0x84, 0xa9, 0xf6, 0x09, 0xe9, 0xfe, 0x04, 0xe8, 0xfe, 0x1e, 0xc8, 0xfe, 0x17, 0xc7,
+        0xfe, 0x82, 0x87, 0xf6, 0x4b, 0x84, 0x1d, 0x6f, 0x2a, 0x82, 0x2e, 0x4b, 0x49, 0xde, 0x09,
+        0xe9, 0xfe, 0x04, 0xe8, 0xfe, 0x1f, 0xc8, 0xfe, 0x18, 0xc7, 0xfe, 0x82, 0x28, 0xde, 0x2d,
+        0x4b, 0x1b, 0x6f, 0x2a, 0x83, 0x8e, 0x2a, 0x2b, 0xad, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x03,
+        0xe9, 0xfe, 0x07, 0xe8, 0xfe, 0x1f, 0xc8, 0xfe, 0x19, 0xc7, 0xfe, 0x82, 0x0a, 0xad, 0x8e,
+        0x2a, 0x1a, 0x6f, 0x2a, 0x82, 0xed, 0x6b, 0x89, 0xee, 0x0c, 0xe8, 0xfe, 0x20, 0xc8, 0xfe,
+        0x1a, 0xc7, 0xfe, 0x82, 0x67, 0xee, 0xac, 0x6b, 0x19, 0x6f, 0x2a, 0x83, 0xae, 0x32, 0xca,
+        0xc5, 0xc8, 0xfe, 0x0a, 0xe8, 0xfe, 0x22, 0xc8, 0xfe, 0x1b, 0xc7, 0xfe, 0x82, 0xa9, 0xc5,
+        0xae, 0x32, 0x18, 0x6f, 0x2a, 0x82, 0xec, 0x6b, 0x89, 0xf6, 0x04, 0xc8, 0xfe, 0x02, 0xe8,
+        0xfe, 0x27, 0xc8, 0xfe, 0x1b, 0xc7, 0xfe, 0x82, 0x87, 0xf6, 0xec, 0x6b, 0x17, 0x6f, 0x2a,
+        0x82, 0xae, 0x32, 0x8a, 0xbd, 0x2e, 0xc8, 0xfe, 0x1c, 0xc7, 0xfe, 0x82, 0x89, 0xbd, 0xae,
+        0x32, 0x16, 0x6f, 0x2a, 0x82, 0xcd, 0x6b, 0x89, 0xf6, 0x09, 0xc8, 0xfe, 0x86, 0xc9, 0xfe,
+        0xeb, 0xfe, 0x0e, 0xff, 0x11, 0xff, 0x34, 0xf7, 0x35, 0xf7, 0x03, 0x56, 0xf7, 0x85, 0x34,
+        0xf7, 0x32, 0xf7, 0x0f, 0xff, 0xec, 0xfe, 0xca, 0xfe, 0x16, 0xc8, 0xfe, 0x1d, 0xc7, 0xfe,
+        0x82, 0x67, 0xee, 0xac, 0x6b, 0x0b, 0x6f, 0x2a, 0x0a, 0x6e, 0x2a, 0x82, 0x8d, 0x2a, 0x2a,
+        0xad, 0x07, 0xc8, 0xfe, 0x85, 0xc9, 0xfe, 0xec, 0xfe, 0x32, 0xf7, 0x57, 0xf7, 0x7b, 0xf7,
+        0x02, 0x7d, 0xf7, 0x03, 0x7e, 0xef, 0x81, 0x9e, 0xef, 0x02, 0x7e, 0xef, 0x02, 0x7d, 0xf7,
+        0x85, 0x7c, 0xf7, 0x59, 0xf7, 0x35, 0xf7, 0xee, 0xfe, 0xca, 0xfe, 0x02, 0xa8, 0xfe, 0x11,
+        0xc8, 0xfe, 0x1e, 0xc7, 0xfe, 0x82, 0x09, 0xad, 0x8d, 0x2a, 0x0a, 0x6e, 0x2a, 0x0a, 0x4e,
+        0x2a, 0x82, 0xed, 0x4a, 0x29, 0xde, 0x05, 0xc8, 0xfe, 0x85, 0xc9, 0xfe, 0x0f, 0xff, 0x57,
+        0xf7, 0x7c, 0xf7, 0x7d, 0xf7, 0x02, 0x7e, 0xef, 0x0a, 0x7d, 0xef, 0x03, 0x7e, 0xef, 0x84,
+        0x7d, 0xf7, 0x59, 0xf7, 0x12, 0xf7, 0xcb, 0xfe, 0x03, 0xa8, 0xfe, 0x0e, 0xc8, 0xfe, 0x1e,
+        0xc7, 0xfe, 0x82, 0x27, 0xde, 0xed, 0x4a, 0x14, 0x4e, 0x2a, 0x81, 0x4b, 0x84, 0x04, 0xc8,
+        0xfe, 0x84, 0xc9, 0xfe, 0x0e, 0xff, 0x57, 0xf7, 0x7d, 0xf7, 0x02, 0x7e, 0xef, 0x11, 0x7d,
+        0xef, 0x86, 0x7e, 0xef, 0x7d, 0xf7, 0x7a, 0xf7, 0x12, 0xf7, 0xca, 0xfe, 0xa7, 0xfe, 0x02,
+        0xa8, 0xfe, 0x0b, 0xc8, 0xfe, 0x1f, 0xc7, 0xfe, 0x82, 0x87, 0xf6, 0x0b, 0x7c, 0x13, 0x4e,
+        0x2a, 0x82, 0x8d, 0x32, 0x6a, 0xb5, 0x03, 0xc8, 0xfe, 0x83, 0xeb, 0xfe, 0x34, 0xf7, 0x7c,
+        0xf7, 0x02, 0x7e, 0xef, 0x15, 0x7d, 0xef, 0x84, 0x7e, 0xef, 0x7d, 0xf7, 0x58, 0xf7, 0xee,
+        0xfe, 0x03, 0xa8, 0xfe, 0x0a, 0xc8, 0xfe, 0x20, 0xc7, 0xfe, 0x82, 0x49, 0xb5, 0x8d, 0x32,
+        0x12, 0x4e, 0x2a, 0x82, 0xed, 0x4a, 0x28, 0xde, 0x02, 0xc8, 0xfe, 0x82, 0xed, 0xfe, 0x58,
+        0xf7, 0x02, 0x7e, 0xef, 0x19, 0x7d, 0xef, 0x84, 0x7e, 0xef, 0x7c, 0xf7, 0x11, 0xf7, 0xa9,
+        0xfe, 0x02, 0xa8, 0xfe, 0x08, 0xc8, 0xfe, 0x21, 0xc7, 0xfe, 0x82, 0x27, 0xde, 0xed, 0x4a,
+        0x12, 0x4e, 0x2a, 0x86, 0xcc, 0x6b, 0x88, 0xf6, 0xc8, 0xfe, 0x0f, 0xff, 0x7b, 0xf7, 0x7e,
+        0xef, 0x1c, 0x7d, 0xef, 0x86, 0x7e, 0xef, 0x7d, 0xf7, 0x34, 0xf7, 0xa9, 0xfe, 0xa7, 0xfe,
+        0xa8, 0xfe, 0x07, 0xc8, 0xfe, 0x21, 0xc7, 0xfe, 0x82, 0x87, 0xf6, 0xcb, 0x6b, 0x12, 0x4e,
+        0x2a, 0x85, 0xca, 0x9c, 0xc8, 0xfe, 0x10, 0xf7, 0x7c, 0xf7, 0x7e, 0xef, 0x1e, 0x7d, 0xef,
+        0x87, 0x7e, 0xef, 0x7d, 0xf7, 0x35, 0xf7, 0xa9, 0xfe, 0xa7, 0xfe, 0xa8, 0xfe, 0xc8, 0xfe,
+        0x03, 0xc7, 0xfe, 0x81, 0xc8, 0xfe, 0x23, 0xc7, 0xfe, 0x81, 0xca, 0x9c, 0x11, 0x4e, 0x2a,
+        0x85, 0x8d, 0x32, 0x69, 0xbd, 0x0f, 0xff, 0x7c, 0xf7, 0x7e, 0xef, 0x20, 0x7d, 0xef, 0x84,
+        0x7e, 0xef, 0x7d, 0xef, 0x35, 0xf7, 0xa9, 0xfe, 0x04, 0xa7, 0xfe, 0x81, 0xc8, 0xfe, 0x24,
+        0xc7, 0xfe, 0x82, 0x68, 0xbd, 0x8d, 0x32, 0x10, 0x4e, 0x2a, 0x84, 0xcd, 0x42, 0x4e, 0xd6,
+        0x7b, 0xf7, 0x7e, 0xef, 0x22, 0x7d, 0xef, 0x84, 0x7e, 0xef, 0x7d, 0xef, 0x13, 0xf7, 0xa8,
+        0xfe, 0x04, 0xa7, 0xfe, 0x23, 0xc7, 0xfe, 0x83, 0xc6, 0xfe, 0x08, 0xd6, 0xcd, 0x42, 0x10,
+        0x4e, 0x2a, 0x83, 0x4f, 0x53, 0x19, 0xe7, 0x7e, 0xef, 0x24, 0x7d, 0xef, 0x84, 0x7e, 0xef,
+        0x7c, 0xf7, 0xef, 0xf6, 0x87, 0xfe, 0x04, 0xa7, 0xfe, 0x22, 0xc7, 0xfe, 0x83, 0xc6, 0xfe,
+        0x67, 0xee, 0x0c, 0x4b, 0x10, 0x4e, 0x2a, 0x81, 0xf5, 0x8c, 0x27, 0x7d, 0xef, 0x84, 0x7e,
+        0xef, 0x5a, 0xf7, 0xcb, 0xfe, 0x87, 0xfe, 0x04, 0xa7, 0xfe, 0x21, 0xc7, 0xfe, 0x83, 0xc6,
+        0xfe, 0x86, 0xf6, 0xab, 0x6b, 0x0f, 0x4e, 0x2a, 0x82, 0x91, 0x5b, 0xfb, 0xd6, 0x28, 0x7d,
+        0xef, 0x84, 0x7e, 0xef, 0x35, 0xf7, 0x88, 0xfe, 0x87, 0xfe, 0x03, 0xa7, 0xfe, 0x20, 0xc7,
+        0xfe, 0x03, 0xc6, 0xfe, 0x81, 0x2a, 0x84, 0x0e, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0xd8, 0xad,
+        0x29, 0x7d, 0xef, 0x83, 0x7e, 0xef, 0x7c, 0xf7, 0xce, 0xf6, 0x02, 0x87, 0xfe, 0x03, 0xa7,
+        0xfe, 0x1f, 0xc7, 0xfe, 0x03, 0xc6, 0xfe, 0x81, 0x8a, 0x94, 0x0e, 0x4e, 0x2a, 0x82, 0xb2,
+        0x5b, 0x1c, 0xdf, 0x2a, 0x7d, 0xef, 0x84, 0x7e, 0xef, 0x36, 0xf7, 0x88, 0xfe, 0x87, 0xfe,
+        0x04, 0xa7, 0xfe, 0x1d, 0xc7, 0xfe, 0x04, 0xc6, 0xfe, 0x81, 0xe9, 0xa4, 0x0d, 0x4e, 0x2a,
+        0x82, 0x6e, 0x2a, 0x97, 0xa5, 0x2b, 0x7d, 0xef, 0x83, 0x7e, 0xef, 0x7c, 0xf7, 0xcd, 0xfe,
+        0x02, 0x87, 0xfe, 0x03, 0xa7, 0xfe, 0x81, 0xc7, 0xfe, 0x02, 0xa7, 0xfe, 0x1a, 0xc7, 0xfe,
+        0x04, 0xc6, 0xfe, 0x81, 0x09, 0xad, 0x0d, 0x4e, 0x2a, 0x82, 0x30, 0x4b, 0xfb, 0xd6, 0x2c,
+        0x7d, 0xef, 0x82, 0x7e, 0xef, 0x34, 0xf7, 0x03, 0xaa, 0xfe, 0x04, 0xca, 0xfe, 0x82, 0xc9,
+        0xfe, 0xc8, 0xfe, 0x02, 0xa7, 0xfe, 0x81, 0xc7, 0xfe, 0x05, 0xa7, 0xfe, 0x11, 0xc7, 0xfe,
+        0x04, 0xc6, 0xfe, 0x81, 0x28, 0xb5, 0x0d, 0x4e, 0x2a, 0x81, 0x74, 0x7c, 0x2e, 0x7d, 0xef,
+        0x81, 0x7d, 0xf7, 0x07, 0x7b, 0xf7, 0x85, 0x59, 0xf7, 0x56, 0xf7, 0x12, 0xf7, 0xed, 0xfe,
+        0xc8, 0xfe, 0x07, 0xa7, 0xfe, 0x0e, 0xc7, 0xfe, 0x05, 0xc6, 0xfe, 0x81, 0x08, 0xb5, 0x0c,
+        0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0xf8, 0xb5, 0x2f, 0x7d, 0xef, 0x08, 0x7e, 0xef, 0x86, 0x9e,
+        0xef, 0x7e, 0xef, 0x7c, 0xf7, 0x58, 0xf7, 0x10, 0xf7, 0xa9, 0xfe, 0x06, 0xa7, 0xfe, 0x0d,
+        0xc7, 0xfe, 0x05, 0xc6, 0xfe, 0x81, 0xe9, 0xac, 0x0c, 0x4e, 0x2a, 0x82, 0x10, 0x43, 0x9a,
+        0xce, 0x39, 0x7d, 0xef, 0x02, 0x7e, 0xef, 0x85, 0x7d, 0xf7, 0x58, 0xf7, 0xee, 0xfe, 0xa7,
+        0xfe, 0xa6, 0xfe, 0x05, 0xa7, 0xfe, 0x0a, 0xc7, 0xfe, 0x06, 0xc6, 0xfe, 0x81, 0xe9, 0xa4,
+        0x0c, 0x4e, 0x2a, 0x82, 0xd2, 0x63, 0x3c, 0xe7, 0x3c, 0x7d, 0xef, 0x85, 0x7e, 0xef, 0x7c,
+        0xf7, 0x13, 0xf7, 0xa8, 0xfe, 0x86, 0xfe, 0x05, 0xa7, 0xfe, 0x09, 0xc7, 0xfe, 0x06, 0xc6,
+        0xfe, 0x81, 0x8a, 0x94, 0x0c, 0x4e, 0x2a, 0x81, 0x54, 0x74, 0x3e, 0x7d, 0xef, 0x86, 0x7e,
+        0xef, 0x7d, 0xef, 0x35, 0xf7, 0xa9, 0xfe, 0x86, 0xfe, 0x87, 0xfe, 0x04, 0xa7, 0xfe, 0x07,
+        0xc7, 0xfe, 0x07, 0xc6, 0xfe, 0x81, 0x2a, 0x84, 0x0c, 0x4e, 0x2a, 0x81, 0xd5, 0x8c, 0x41,
+        0x7d, 0xef, 0x84, 0x35, 0xf7, 0x88, 0xfe, 0x86, 0xfe, 0x87, 0xfe, 0x04, 0xa7, 0xfe, 0x06,
+        0xc7, 0xfe, 0x06, 0xc6, 0xfe, 0x82, 0x86, 0xf6, 0x8b, 0x6b, 0x0c, 0x4e, 0x2a, 0x81, 0x77,
+        0xa5, 0x42, 0x7d, 0xef, 0x82, 0xf2, 0xf6, 0x67, 0xfe, 0x02, 0x87, 0xfe, 0x83, 0xa7, 0xfe,
+        0xa6, 0xfe, 0xa7, 0xfe, 0x05, 0xc7, 0xfe, 0x07, 0xc6, 0xfe, 0x82, 0x46, 0xee, 0x0c, 0x4b,
+        0x0b, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0xd8, 0xb5, 0x42, 0x7d, 0xef, 0x85, 0x7c, 0xef, 0xae,
+        0xf6, 0x66, 0xfe, 0x87, 0xfe, 0xa7, 0xfe, 0x02, 0xa6, 0xfe, 0x81, 0xa7, 0xfe, 0x03, 0xc7,
+        0xfe, 0x08, 0xc6, 0xfe, 0x82, 0xe7, 0xd5, 0xcd, 0x42, 0x0b, 0x4e, 0x2a, 0x82, 0x6e, 0x2a,
+        0xd8, 0xb5, 0x42, 0x7d, 0xef, 0x86, 0x7e, 0xef, 0x38, 0xf7, 0x49, 0xf6, 0x66, 0xfe, 0x87,
+        0xfe, 0xa7, 0xfe, 0x02, 0xa6, 0xfe, 0x03, 0xc7, 0xfe, 0x08, 0xc6, 0xfe, 0x82, 0x68, 0xbd,
+        0x6d, 0x32, 0x0b, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x77, 0xa5, 0x44, 0x7d, 0xef, 0x84, 0xaf,
+        0xf6, 0x26, 0xf6, 0x86, 0xfe, 0xa7, 0xfe, 0x03, 0xa6, 0xfe, 0x81, 0xc7, 0xfe, 0x09, 0xc6,
+        0xfe, 0x81, 0x89, 0x94, 0x0d, 0x4e, 0x2a, 0x81, 0x36, 0x95, 0x43, 0x7d, 0xef, 0x85, 0x7e,
+        0xef, 0x37, 0xf7, 0x27, 0xf6, 0x26, 0xf6, 0x86, 0xfe, 0x03, 0xa6, 0xfe, 0x81, 0xc7, 0xfe,
+        0x08, 0xc6, 0xfe, 0x82, 0x66, 0xf6, 0xab, 0x6b, 0x09, 0x4e, 0x2a, 0x04, 0x2e, 0x2a, 0x81,
+        0x95, 0x84, 0x44, 0x7d, 0xef, 0x85, 0x5c, 0xef, 0x6c, 0xf6, 0x06, 0xf6, 0x46, 0xf6, 0x86,
+        0xfe, 0x03, 0xa6, 0xfe, 0x08, 0xc6, 0xfe, 0x82, 0x07, 0xde, 0xcc, 0x4a, 0x0d, 0x2e, 0x2a,
+        0x81, 0x13, 0x74, 0x45, 0x7d, 0xef, 0x85, 0xd1, 0xf6, 0x06, 0xf6, 0x26, 0xf6, 0x46, 0xf6,
+        0x86, 0xfe, 0x03, 0xa6, 0xfe, 0x07, 0xc6, 0xfe, 0x82, 0x28, 0xb5, 0x6d, 0x32, 0x0d, 0x2e,
+        0x2a, 0x82, 0x71, 0x5b, 0x1c, 0xdf, 0x43, 0x7d, 0xef, 0x86, 0x7e, 0xef, 0x15, 0xf7, 0x27,
+        0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x66, 0xfe, 0x03, 0xa6, 0xfe, 0x06, 0xc6, 0xfe, 0x82, 0x66,
+        0xf6, 0xea, 0x7b, 0x0a, 0x2e, 0x2a, 0x04, 0x2d, 0x2a, 0x82, 0x8e, 0x3a, 0x7a, 0xc6, 0x43,
+        0x7d, 0xef, 0x87, 0x7e, 0xef, 0x38, 0xef, 0x28, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x46, 0xfe,
+        0x66, 0xfe, 0x02, 0xa6, 0xfe, 0x06, 0xc6, 0xfe, 0x82, 0x06, 0xde, 0xcb, 0x4a, 0x0f, 0x2d,
+        0x2a, 0x81, 0x77, 0xa5, 0x44, 0x7d, 0xef, 0x85, 0x5a, 0xef, 0x48, 0xf6, 0x26, 0xf6, 0x46,
+        0xf6, 0x46, 0xfe, 0x02, 0x66, 0xfe, 0x81, 0xa6, 0xfe, 0x06, 0xc6, 0xfe, 0x82, 0xe8, 0xac,
+        0x2c, 0x2a, 0x0f, 0x2d, 0x2a, 0x81, 0xf2, 0x6b, 0x44, 0x7d, 0xef, 0x83, 0x5b, 0xef, 0x48,
+        0xf6, 0x26, 0xf6, 0x02, 0x46, 0xf6, 0x03, 0x66, 0xfe, 0x81, 0xa6, 0xfe, 0x04, 0xc6, 0xfe,
+        0x82, 0x66, 0xf6, 0x6a, 0x6b, 0x10, 0x2d, 0x2a, 0x82, 0xce, 0x42, 0x9a, 0xce, 0x43, 0x7d,
+        0xef, 0x83, 0x5a, 0xef, 0x48, 0xf6, 0x26, 0xf6, 0x02, 0x46, 0xf6, 0x03, 0x66, 0xfe, 0x82,
+        0x86, 0xfe, 0xa6, 0xfe, 0x03, 0xc6, 0xfe, 0x82, 0x47, 0xbd, 0x6c, 0x32, 0x0b, 0x2d, 0x2a,
+        0x06, 0x2d, 0x22, 0x81, 0xd4, 0x8c, 0x42, 0x7d, 0xef, 0x84, 0x7e, 0xef, 0x39, 0xef, 0x48,
+        0xf6, 0x26, 0xf6, 0x02, 0x46, 0xf6, 0x02, 0x66, 0xfe, 0x03, 0x86, 0xfe, 0x84, 0xa6, 0xfe,
+        0xc6, 0xfe, 0x66, 0xf6, 0x8a, 0x6b, 0x12, 0x2d, 0x22, 0x82, 0x0f, 0x43, 0x9b, 0xce, 0x41,
+        0x7d, 0xef, 0x85, 0x7e, 0xef, 0xf6, 0xee, 0x27, 0xf6, 0x26, 0xf6, 0x46, 0xf6, 0x03, 0x66,
+        0xfe, 0x04, 0x86, 0xfe, 0x83, 0xa6, 0xfe, 0x67, 0xc5, 0x6c, 0x2a, 0x13, 0x2d, 0x22, 0x81,
+        0xd4, 0x8c, 0x41, 0x7d, 0xef, 0x83, 0x7e, 0xef, 0xb2, 0xee, 0x26, 0xf6, 0x02, 0x46, 0xf6,
+        0x03, 0x66, 0xfe, 0x04, 0x86, 0xfe, 0x82, 0x26, 0xee, 0x6a, 0x63, 0x14, 0x2d, 0x22, 0x82,
+        0xae, 0x3a, 0x59, 0xc6, 0x40, 0x7d, 0xef, 0x83, 0x5c, 0xef, 0x6d, 0xf6, 0x26, 0xf6, 0x02,
+        0x46, 0xf6, 0x03, 0x66, 0xfe, 0x04, 0x86, 0xfe, 0x82, 0xa8, 0xa4, 0x2c, 0x22, 0x15, 0x2d,
+        0x22, 0x82, 0xd2, 0x63, 0x1c, 0xdf, 0x3e, 0x7d, 0xef, 0x84, 0x7e, 0xef, 0x39, 0xef, 0x48,
+        0xf6, 0x26, 0xf6, 0x02, 0x46, 0xf6, 0x02, 0x66, 0xfe, 0x04, 0x86, 0xfe, 0x82, 0xc6, 0xdd,
+        0xeb, 0x42, 0x16, 0x2d, 0x22, 0x82, 0x4d, 0x22, 0xd4, 0x84, 0x3f, 0x7d, 0xef, 0x81, 0xb1,
+        0xee, 0x02, 0x26, 0xf6, 0x82, 0x46, 0xf6, 0x46, 0xfe, 0x02, 0x66, 0xfe, 0x03, 0x86, 0xfe,
+        0x82, 0x46, 0xf6, 0xe9, 0x7b, 0x18, 0x2d, 0x22, 0x82, 0x8e, 0x32, 0x97, 0xad, 0x3c, 0x7d,
+        0xef, 0x83, 0x7e, 0xef, 0x19, 0xef, 0x29, 0xf6, 0x02, 0x26, 0xf6, 0x81, 0x46, 0xf6, 0x02,
+        0x66, 0xfe, 0x04, 0x86, 0xfe, 0x82, 0xa8, 0xa4, 0x4c, 0x2a, 0x19, 0x2d, 0x22, 0x82, 0xae,
+        0x32, 0xb7, 0xad, 0x3b, 0x7d, 0xef, 0x82, 0x5d, 0xef, 0x90, 0xee, 0x02, 0x26, 0xf6, 0x02,
+        0x46, 0xf6, 0x02, 0x66, 0xfe, 0x03, 0x86, 0xfe, 0x82, 0x67, 0xcd, 0xcb, 0x42, 0x1b, 0x2d,
+        0x22, 0x82, 0xce, 0x3a, 0xb7, 0xad, 0x3a, 0x7d, 0xef, 0x82, 0xd5, 0xee, 0x27, 0xf6, 0x02,
+        0x26, 0xf6, 0x83, 0x46, 0xf6, 0x46, 0xfe, 0x66, 0xfe, 0x03, 0x86, 0xfe, 0x82, 0xc6, 0xdd,
+        0x4b, 0x5b, 0x1d, 0x2d, 0x22, 0x83, 0xae, 0x3a, 0x36, 0x9d, 0x1c, 0xe7, 0x37, 0x7d, 0xef,
+        0x82, 0xf8, 0xee, 0x2a, 0xf6, 0x02, 0x26, 0xf6, 0x82, 0x46, 0xf6, 0x46, 0xfe, 0x02, 0x66,
+        0xfe, 0x02, 0x86, 0xfe, 0x82, 0xe6, 0xe5, 0x8a, 0x63, 0x1f, 0x2d, 0x22, 0x83, 0x6d, 0x2a,
+        0x53, 0x7c, 0xdb, 0xd6, 0x35, 0x7d, 0xef, 0x82, 0xf8, 0xee, 0x2a, 0xee, 0x03, 0x26, 0xf6,
+        0x81, 0x46, 0xf6, 0x02, 0x66, 0xfe, 0x02, 0x86, 0xfe, 0x82, 0x06, 0xee, 0xca, 0x73, 0x22,
+        0x2d, 0x22, 0x83, 0x50, 0x53, 0xb7, 0xad, 0x1c, 0xe7, 0x31, 0x7d, 0xef, 0x83, 0x5d, 0xef,
+        0xd6, 0xee, 0x2a, 0xf6, 0x03, 0x26, 0xf6, 0x82, 0x46, 0xf6, 0x46, 0xfe, 0x02, 0x66, 0xfe,
+        0x84, 0x86, 0xfe, 0x06, 0xee, 0xe9, 0x7b, 0x2c, 0x22, 0x23, 0x2d, 0x22, 0x84, 0x4d, 0x2a,
+        0xd1, 0x6b, 0xd8, 0xb5, 0x1c, 0xe7, 0x2e, 0x7d, 0xef, 0x83, 0x3b, 0xef, 0x92, 0xee, 0x28,
+        0xf6, 0x03, 0x26, 0xf6, 0x82, 0x46, 0xf6, 0x46, 0xfe, 0x02, 0x66, 0xfe, 0x84, 0x86, 0xfe,
+        0xe6, 0xe5, 0xca, 0x73, 0x2c, 0x22, 0x26, 0x2d, 0x22, 0x85, 0x6d, 0x32, 0xb1, 0x5b, 0x56,
+        0x9d, 0x9a, 0xce, 0x5d, 0xef, 0x02, 0x7d, 0xef, 0x81, 0x7e, 0xef, 0x23, 0x7d, 0xef, 0x02,
+        0x7e, 0xef, 0x84, 0x5d, 0xef, 0x3b, 0xef, 0xb4, 0xee, 0x2b, 0xee, 0x04, 0x26, 0xf6, 0x82,
+        0x46, 0xf6, 0x46, 0xfe, 0x03, 0x66, 0xfe, 0x82, 0xc6, 0xdd, 0x8a, 0x63, 0x2b, 0x2d, 0x22,
+        0x86, 0xce, 0x3a, 0xd1, 0x6b, 0xf5, 0x94, 0x37, 0xc6, 0x19, 0xef, 0x3b, 0xef, 0x02, 0x5c,
+        0xef, 0x1e, 0x5d, 0xef, 0x87, 0x5c, 0xef, 0x3b, 0xef, 0x19, 0xef, 0xd6, 0xe6, 0x70, 0xee,
+        0x2a, 0xee, 0x06, 0xf6, 0x03, 0x26, 0xf6, 0x02, 0x46, 0xf6, 0x81, 0x46, 0xfe, 0x03, 0x66,
+        0xfe, 0x82, 0x47, 0xc5, 0x4b, 0x5b, 0x2f, 0x2d, 0x22, 0x84, 0xcc, 0x3a, 0x8b, 0x9c, 0xeb,
+        0xe5, 0x2c, 0xee, 0x16, 0x2d, 0xee, 0x0a, 0x4d, 0xee, 0x83, 0x2b, 0xee, 0x29, 0xf6, 0x07,
+        0xf6, 0x03, 0x26, 0xf6, 0x03, 0x46, 0xf6, 0x81, 0x46, 0xfe, 0x03, 0x66, 0xfe, 0x83, 0x26,
+        0xf6, 0xa8, 0xa4, 0xcb, 0x42, 0x31, 0x2d, 0x22, 0x83, 0x4c, 0x2a, 0xc9, 0x7b, 0x66, 0xd5,
+        0x08, 0x06, 0xf6, 0x16, 0x26, 0xf6, 0x03, 0x46, 0xf6, 0x02, 0x46, 0xfe, 0x02, 0x46, 0xf6,
+        0x03, 0x46, 0xfe, 0x04, 0x66, 0xfe, 0x83, 0xa6, 0xdd, 0xe9, 0x7b, 0x6c, 0x2a, 0x34, 0x2d,
+        0x22, 0x83, 0xcb, 0x42, 0x88, 0xa4, 0xc6, 0xe5, 0x05, 0x26, 0xf6, 0x15, 0x46, 0xf6, 0x03,
+        0x66, 0xf6, 0x04, 0x46, 0xfe, 0x07, 0x66, 0xfe, 0x83, 0x06, 0xee, 0xa8, 0xa4, 0xeb, 0x42,
+        0x1b, 0x2d, 0x22, 0x1c, 0x0d, 0x22, 0x85, 0x2c, 0x22, 0x4a, 0x63, 0x07, 0xbd, 0xe6, 0xed,
+        0x26, 0xf6, 0x0d, 0x46, 0xf6, 0x81, 0x66, 0xf6, 0x15, 0x66, 0xfe, 0x84, 0x26, 0xf6, 0x27,
+        0xbd, 0x4a, 0x63, 0x2c, 0x22, 0x3a, 0x0d, 0x22, 0x85, 0x4c, 0x2a, 0x6a, 0x63, 0xe7, 0xb4,
+        0x06, 0xee, 0x46, 0xf6, 0x11, 0x66, 0xfe, 0x0e, 0x86, 0xfe, 0x84, 0x26, 0xf6, 0x07, 0xb5,
+        0x6a, 0x63, 0x4c, 0x2a, 0x3e, 0x0d, 0x22, 0x85, 0x4c, 0x2a, 0x4a, 0x63, 0x88, 0xa4, 0x86,
+        0xd5, 0x46, 0xf6, 0x0c, 0x66, 0xfe, 0x0e, 0x86, 0xfe, 0x85, 0x66, 0xfe, 0xc6, 0xdd, 0xa8,
+        0xa4, 0x4a, 0x63, 0x4c, 0x2a, 0x42, 0x0d, 0x22, 0x87, 0x0c, 0x22, 0xab, 0x42, 0xc9, 0x7b,
+        0xc8, 0xac, 0xa6, 0xd5, 0x26, 0xf6, 0x66, 0xfe, 0x13, 0x86, 0xfe, 0x86, 0x26, 0xf6, 0xc6,
+        0xdd, 0xe8, 0xb4, 0xc9, 0x7b, 0xab, 0x42, 0x0c, 0x22, 0x47, 0x0d, 0x22, 0x88, 0x4c, 0x2a,
+        0xab, 0x42, 0x6a, 0x63, 0x49, 0x94, 0x07, 0xb5, 0x87, 0xd5, 0x06, 0xee, 0x26, 0xf6, 0x02,
+        0x66, 0xfe, 0x07, 0x86, 0xfe, 0x89, 0x66, 0xfe, 0x26, 0xf6, 0x06, 0xee, 0xa7, 0xd5, 0x07,
+        0xbd, 0x69, 0x94, 0x6a, 0x6b, 0xab, 0x42, 0x4c, 0x2a, 0x4e, 0x0d, 0x22, 0x88, 0x4c, 0x2a,
+        0x8c, 0x3a, 0xcb, 0x42, 0x4a, 0x63, 0xc9, 0x7b, 0x29, 0x8c, 0x88, 0x9c, 0xa8, 0xa4, 0x02,
+        0xc8, 0xac, 0x88, 0xa8, 0xa4, 0x88, 0x9c, 0x49, 0x8c, 0xc9, 0x7b, 0x4a, 0x63, 0xcb, 0x42,
+        0x8c, 0x3a, 0x4c, 0x2a, 0x7f, 0x0d, 0x22, 0x72, 0x0d, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c,
+        0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x5c, 0x0c, 0x22,
+
+};
+
+const lv_image_dsc_t image_partly_cloudy_opaque = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
+    .header.w = 100,
+    .header.h = 100,
+    .header.stride = 200,
+    .header.reserved_2 = 0,
+    .data_size = sizeof(image_partly_cloudy_opaque_map),
+    .data = image_partly_cloudy_opaque_map,
+    .reserved = NULL,
+};
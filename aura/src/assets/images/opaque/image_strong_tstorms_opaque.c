@@ -0,0 +1,260 @@
+// Generated by tools/flatten_images.py from image_strong_tstorms.c: pre-blended onto the
+// main screen gradient at y = 4. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_STRONG_TSTORMS_OPAQUE
+  #define LV_ATTRIBUTE_IMAGE_STRONG_TSTORMS_OPAQUE
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_STRONG_TSTORMS_OPAQUE uint8_t
+    image_strong_tstorms_opaque_map[] = {
+
+        0x01, 0x00, 0x00, 0x00, 0x8f, 0x0c, 0x00, 0x00, 0x20, 0x4e, 0x00, 0x00, 0x7f, 0x90, 0x2a,
+        0x7f, 0x90, 0x2a, 0x51, 0x90, 0x2a, 0x05, 0xb0, 0x2a, 0x3c, 0x90, 0x2a, 0x1e, 0x8f, 0x2a,
+        0x8f, 0xaf, 0x2a, 0x71, 0x4b, 0x33, 0x6c, 0x74, 0x74, 0x36, 0x95, 0x98, 0xa5, 0x19, 0xb6,
+        0x59, 0xbe, 0x39, 0xbe, 0xd8, 0xad, 0x36, 0x95, 0x95, 0x7c, 0x33, 0x6c, 0x71, 0x4b, 0xcf,
+        0x32, 0x52, 0x8f, 0x2a, 0x85, 0xcf, 0x32, 0xd2, 0x5b, 0x16, 0x8d, 0x39, 0xbe, 0xbb, 0xd6,
+        0x0b, 0x5d, 0xef, 0x85, 0xdb, 0xd6, 0x39, 0xbe, 0x16, 0x8d, 0xd2, 0x5b, 0xcf, 0x32, 0x4d,
+        0x8f, 0x2a, 0x84, 0x10, 0x43, 0xb5, 0x7c, 0x39, 0xbe, 0xfc, 0xde, 0x11, 0x5d, 0xef, 0x84,
+        0x1c, 0xe7, 0x19, 0xbe, 0x74, 0x74, 0x10, 0x43, 0x49, 0x8f, 0x2a, 0x83, 0xf0, 0x3a, 0x95,
+        0x7c, 0x5a, 0xc6, 0x17, 0x5d, 0xef, 0x83, 0x5a, 0xc6, 0xb5, 0x7c, 0xf0, 0x3a, 0x46, 0x8f,
+        0x2a, 0x82, 0xd2, 0x5b, 0x19, 0xbe, 0x1b, 0x5d, 0xef, 0x82, 0x19, 0xbe, 0xd2, 0x5b, 0x43,
+        0x8f, 0x2a, 0x83, 0xcf, 0x32, 0xf6, 0x8c, 0xfc, 0xde, 0x1d, 0x5d, 0xef, 0x83, 0xfc, 0xde,
+        0xf6, 0x8c, 0xcf, 0x32, 0x2d, 0x8f, 0x2a, 0x13, 0x6f, 0x2a, 0x82, 0x10, 0x43, 0xb8, 0xa5,
+        0x21, 0x5d, 0xef, 0x82, 0x98, 0xa5, 0x10, 0x43, 0x3e, 0x6f, 0x2a, 0x82, 0x51, 0x4b, 0x19,
+        0xbe, 0x23, 0x5d, 0xef, 0x82, 0x19, 0xbe, 0x51, 0x4b, 0x3c, 0x6f, 0x2a, 0x82, 0x31, 0x43,
+        0x39, 0xbe, 0x25, 0x5d, 0xef, 0x82, 0x39, 0xbe, 0x31, 0x43, 0x3a, 0x6f, 0x2a, 0x82, 0x10,
+        0x43, 0xf9, 0xb5, 0x27, 0x5d, 0xef, 0x82, 0xf9, 0xb5, 0x10, 0x43, 0x38, 0x6f, 0x2a, 0x82,
+        0xaf, 0x32, 0x97, 0xa5, 0x29, 0x5d, 0xef, 0x82, 0x77, 0xa5, 0x8f, 0x2a, 0x37, 0x6f, 0x2a,
+        0x82, 0x95, 0x7c, 0x1c, 0xe7, 0x29, 0x5d, 0xef, 0x82, 0x1c, 0xe7, 0x95, 0x7c, 0x36, 0x6f,
+        0x2a, 0x82, 0x72, 0x53, 0xdb, 0xd6, 0x2b, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x72, 0x53, 0x34,
+        0x6f, 0x2a, 0x82, 0xaf, 0x32, 0xb8, 0xad, 0x2d, 0x5d, 0xef, 0x82, 0xb8, 0xad, 0xaf, 0x32,
+        0x33, 0x6f, 0x2a, 0x82, 0x13, 0x6c, 0x1c, 0xe7, 0x2d, 0x5d, 0xef, 0x82, 0x1c, 0xe7, 0x13,
+        0x6c, 0x32, 0x6f, 0x2a, 0x82, 0xaf, 0x32, 0xf9, 0xb5, 0x2f, 0x5d, 0xef, 0x82, 0xf9, 0xb5,
+        0xaf, 0x32, 0x31, 0x6f, 0x2a, 0x82, 0x13, 0x6c, 0x1c, 0xe7, 0x2f, 0x5d, 0xef, 0x82, 0xfc,
+        0xde, 0x95, 0x7c, 0x09, 0x72, 0x53, 0x83, 0x31, 0x43, 0xd0, 0x3a, 0x8f, 0x2a, 0x24, 0x6f,
+        0x2a, 0x82, 0x8f, 0x2a, 0x77, 0xa5, 0x31, 0x5d, 0xef, 0x09, 0x1c, 0xe7, 0x87, 0xfc, 0xde,
+        0xbb, 0xd6, 0x39, 0xbe, 0xb8, 0xad, 0xd6, 0x8c, 0x92, 0x5b, 0xaf, 0x32, 0x21, 0x6f, 0x2a,
+        0x82, 0x31, 0x43, 0xbb, 0xd6, 0x3f, 0x5d, 0xef, 0x84, 0xfc, 0xde, 0x19, 0xbe, 0xb5, 0x84,
+        0xf0, 0x42, 0x1f, 0x6f, 0x2a, 0x82, 0x54, 0x74, 0x1c, 0xe7, 0x42, 0x5d, 0xef, 0x83, 0x5a,
+        0xc6, 0x54, 0x74, 0xaf, 0x32, 0x1d, 0x6f, 0x2a, 0x81, 0x57, 0x9d, 0x44, 0x5d, 0xef, 0x83,
+        0x1c, 0xe7, 0x98, 0xa5, 0x31, 0x43, 0x1b, 0x6f, 0x2a, 0x82, 0xd0, 0x3a, 0x5a, 0xc6, 0x46,
+        0x5d, 0xef, 0x82, 0x5a, 0xc6, 0x92, 0x5b, 0x1a, 0x6f, 0x2a, 0x82, 0x31, 0x43, 0xfc, 0xde,
+        0x47, 0x5d, 0xef, 0x82, 0x7a, 0xce, 0x92, 0x5b, 0x19, 0x6f, 0x2a, 0x82, 0x92, 0x5b, 0xfc,
+        0xde, 0x48, 0x5d, 0xef, 0x82, 0x7a, 0xce, 0x72, 0x53, 0x18, 0x6f, 0x2a, 0x82, 0x34, 0x74,
+        0x1c, 0xe7, 0x49, 0x5d, 0xef, 0x82, 0x19, 0xbe, 0xd0, 0x3a, 0x17, 0x6f, 0x2a, 0x81, 0xb5,
+        0x84, 0x19, 0x5d, 0xef, 0x82, 0x3b, 0xef, 0xd9, 0xee, 0x04, 0x3c, 0xe7, 0x2c, 0x5d, 0xef,
+        0x81, 0xd6, 0x8c, 0x17, 0x6f, 0x2a, 0x81, 0xf6, 0x8c, 0x18, 0x5d, 0xef, 0x84, 0x5d, 0xe7,
+        0x95, 0xf6, 0x53, 0xee, 0x1c, 0xe7, 0x04, 0x3c, 0xe7, 0x2b, 0x5d, 0xef, 0x82, 0xdb, 0xd6,
+        0x72, 0x53, 0x16, 0x6f, 0x2a, 0x81, 0x16, 0x95, 0x17, 0x5d, 0xef, 0x84, 0x5d, 0xe7, 0xfa,
+        0xee, 0xcd, 0xfd, 0x32, 0xee, 0x02, 0xfb, 0xde, 0x81, 0x1c, 0xe7, 0x03, 0x3c, 0xe7, 0x2b,
+        0x5d, 0xef, 0x82, 0x77, 0xa5, 0x8f, 0x2a, 0x15, 0x6f, 0x2a, 0x81, 0xd6, 0x8c, 0x17, 0x5d,
+        0xef, 0x84, 0x3c, 0xe7, 0x52, 0xf6, 0x89, 0xfd, 0x32, 0xee, 0x02, 0xdb, 0xde, 0x82, 0xfb,
+        0xde, 0x1c, 0xe7, 0x03, 0x3c, 0xe7, 0x2a, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x51, 0x4b, 0x15,
+        0x6f, 0x2a, 0x81, 0x95, 0x7c, 0x16, 0x5d, 0xef, 0x85, 0x3d, 0xe7, 0xb7, 0xee, 0xab, 0xfd,
+        0x69, 0xfd, 0x32, 0xee, 0x03, 0xdb, 0xde, 0x81, 0xfb, 0xde, 0x03, 0x3c, 0xe7, 0x2b, 0x5d,
+        0xef, 0x81, 0xb5, 0x84, 0x0b, 0x6f, 0x2a, 0x0a, 0x6e, 0x2a, 0x82, 0xf2, 0x63, 0x1c, 0xe7,
+        0x14, 0x5d, 0xef, 0x86, 0x5d, 0xe7, 0x1b, 0xef, 0xee, 0xfd, 0x89, 0xfd, 0x69, 0xfd, 0x32,
+        0xee, 0x03, 0xdb, 0xde, 0x82, 0xfb, 0xde, 0x1c, 0xe7, 0x02, 0x3c, 0xe7, 0x2b, 0x5d, 0xef,
+        0x82, 0xf8, 0xb5, 0xae, 0x32, 0x0a, 0x6e, 0x2a, 0x0a, 0x4e, 0x2a, 0x82, 0x51, 0x53, 0xfc,
+        0xde, 0x14, 0x5d, 0xef, 0x87, 0x3c, 0xe7, 0x74, 0xf6, 0x8a, 0xfd, 0x89, 0xfd, 0x69, 0xfd,
+        0x32, 0xee, 0xdb, 0xd6, 0x02, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x82, 0x1c, 0xe7, 0x3c, 0xe7,
+        0x2b, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x10, 0x43, 0x14, 0x4e, 0x2a, 0x82, 0xcf, 0x3a, 0xbb,
+        0xd6, 0x13, 0x5d, 0xef, 0x83, 0x5d, 0xe7, 0xd9, 0xee, 0xcc, 0xfd, 0x02, 0x89, 0xfd, 0x83,
+        0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0x02, 0xdb, 0xde, 0x81, 0xfb, 0xde, 0x02, 0x1c, 0xe7,
+        0x81, 0x3c, 0xe7, 0x2b, 0x5d, 0xef, 0x82, 0xfc, 0xde, 0x71, 0x53, 0x14, 0x4e, 0x2a, 0x82,
+        0x6e, 0x2a, 0xb8, 0xad, 0x12, 0x5d, 0xef, 0x83, 0x5d, 0xe7, 0x1b, 0xe7, 0x10, 0xf6, 0x03,
+        0x89, 0xfd, 0x83, 0x69, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0x02, 0xdb, 0xde, 0x81, 0xfb, 0xde,
+        0x03, 0x1c, 0xe7, 0x81, 0x3c, 0xe7, 0x2a, 0x5d, 0xef, 0x82, 0x1c, 0xe7, 0x54, 0x74, 0x15,
+        0x4e, 0x2a, 0x81, 0xd5, 0x8c, 0x12, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0x95, 0xee, 0x8a, 0xfd,
+        0x03, 0x89, 0xfd, 0x85, 0x68, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x03,
+        0x1c, 0xe7, 0x83, 0x3c, 0xe7, 0x1c, 0xe7, 0x3c, 0xe7, 0x2a, 0x5d, 0xef, 0x81, 0xf5, 0x8c,
+        0x15, 0x4e, 0x2a, 0x82, 0x91, 0x5b, 0xfc, 0xde, 0x10, 0x5d, 0xef, 0x84, 0x3d, 0xe7, 0xfa,
+        0xee, 0xcd, 0xfd, 0x69, 0xfd, 0x03, 0x89, 0xfd, 0x85, 0x68, 0xfd, 0x12, 0xee, 0xdb, 0xd6,
+        0xdb, 0xde, 0xfb, 0xde, 0x06, 0x1c, 0xe7, 0x81, 0x3c, 0xe7, 0x29, 0x5d, 0xef, 0x81, 0x16,
+        0x95, 0x15, 0x4e, 0x2a, 0x82, 0x8e, 0x32, 0x19, 0xbe, 0x0f, 0x5d, 0xef, 0x83, 0x3d, 0xe7,
+        0x3c, 0xe7, 0x52, 0xf6, 0x05, 0x89, 0xfd, 0x85, 0x68, 0xfd, 0x11, 0xee, 0xbb, 0xd6, 0xdb,
+        0xde, 0xfb, 0xde, 0x06, 0x1c, 0xe7, 0x02, 0x3c, 0xe7, 0x28, 0x5d, 0xef, 0x81, 0xf5, 0x8c,
+        0x16, 0x4e, 0x2a, 0x81, 0x95, 0x84, 0x0f, 0x5d, 0xef, 0x83, 0x3d, 0xe7, 0xb7, 0xee, 0xab,
+        0xfd, 0x05, 0x89, 0xfd, 0x85, 0x68, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde,
+        0x05, 0x1c, 0xe7, 0x04, 0x3c, 0xe7, 0x26, 0x5d, 0xef, 0x82, 0x1c, 0xe7, 0x74, 0x7c, 0x16,
+        0x4e, 0x2a, 0x82, 0x10, 0x43, 0x9a, 0xce, 0x0d, 0x5d, 0xef, 0x84, 0x3d, 0xe7, 0x1b, 0xef,
+        0xee, 0xfd, 0x69, 0xfd, 0x05, 0x89, 0xfd, 0x85, 0x68, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb,
+        0xde, 0xfb, 0xde, 0x04, 0x1c, 0xe7, 0x06, 0x3c, 0xe7, 0x25, 0x5d, 0xef, 0x82, 0xfc, 0xde,
+        0x91, 0x5b, 0x17, 0x4e, 0x2a, 0x81, 0xd5, 0x8c, 0x0c, 0x5d, 0xef, 0x02, 0x3c, 0xe7, 0x81,
+        0x74, 0xf6, 0x07, 0x89, 0xfd, 0x85, 0x68, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb,
+        0xde, 0x03, 0x1c, 0xe7, 0x08, 0x3c, 0xe7, 0x24, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x10, 0x43,
+        0x17, 0x4e, 0x2a, 0x82, 0x10, 0x43, 0x59, 0xc6, 0x0b, 0x5d, 0xef, 0x83, 0x3d, 0xe7, 0xf9,
+        0xee, 0xcc, 0xfd, 0x07, 0x89, 0xfd, 0x85, 0x68, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde,
+        0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x09, 0x3c, 0xe7, 0x23, 0x5d, 0xef, 0x82, 0xf8, 0xb5, 0x8e,
+        0x32, 0x18, 0x4e, 0x2a, 0x82, 0x54, 0x7c, 0x1c, 0xe7, 0x09, 0x5d, 0xef, 0x83, 0x3d, 0xe7,
+        0x1b, 0xe7, 0x10, 0xf6, 0x07, 0x89, 0xfd, 0x86, 0x69, 0xfd, 0x68, 0xfd, 0x12, 0xee, 0xdb,
+        0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x0a, 0x3c, 0xe7, 0x22, 0x5d, 0xef, 0x81,
+        0xd5, 0x8c, 0x19, 0x4e, 0x2a, 0x82, 0x8e, 0x32, 0x97, 0xa5, 0x08, 0x5d, 0xef, 0x02, 0x3c,
+        0xe7, 0x82, 0x95, 0xee, 0x8a, 0xfd, 0x05, 0x89, 0xfd, 0x03, 0x69, 0xfd, 0x85, 0x68, 0xfd,
+        0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x0b, 0x3c, 0xe7, 0x20,
+        0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x51, 0x53, 0x1a, 0x4e, 0x2a, 0x82, 0x10, 0x4b, 0x59, 0xc6,
+        0x07, 0x5d, 0xef, 0x84, 0x3d, 0xe7, 0xfa, 0xee, 0xcd, 0xfd, 0x69, 0xfd, 0x02, 0x89, 0xfd,
+        0x06, 0x69, 0xfd, 0x85, 0x68, 0xfd, 0x12, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x06,
+        0x1c, 0xe7, 0x09, 0x3c, 0xe7, 0x1f, 0x5d, 0xef, 0x82, 0x97, 0xa5, 0x6e, 0x2a, 0x1b, 0x4e,
+        0x2a, 0x82, 0xb2, 0x63, 0xba, 0xce, 0x05, 0x5d, 0xef, 0x02, 0x3c, 0xe7, 0x82, 0x52, 0xf6,
+        0x89, 0xfd, 0x09, 0x69, 0xfd, 0x85, 0x68, 0xfd, 0x11, 0xee, 0xdb, 0xd6, 0xdb, 0xde, 0xfb,
+        0xde, 0x06, 0x1c, 0xe7, 0x0a, 0x3c, 0xe7, 0x1d, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x91, 0x5b,
+        0x1d, 0x4e, 0x2a, 0x82, 0x33, 0x74, 0xdb, 0xd6, 0x03, 0x5d, 0xef, 0x02, 0x3c, 0xe7, 0x82,
+        0xb7, 0xee, 0xab, 0xfd, 0x0a, 0x69, 0xfd, 0x82, 0x68, 0xfd, 0x11, 0xee, 0x02, 0xb9, 0xde,
+        0x82, 0xd9, 0xe6, 0xda, 0xe6, 0x08, 0xfa, 0xe6, 0x04, 0x1c, 0xe7, 0x04, 0x3c, 0xe7, 0x1b,
+        0x5d, 0xef, 0x83, 0x3c, 0xe7, 0x16, 0x95, 0x6e, 0x2a, 0x1e, 0x4e, 0x2a, 0x82, 0x33, 0x74,
+        0xdb, 0xd6, 0x02, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0x1b, 0xef, 0xee, 0xf5, 0x0c, 0x69, 0xfd,
+        0x81, 0x8a, 0xfd, 0x0b, 0xab, 0xfd, 0x82, 0x32, 0xf6, 0x1b, 0xe7, 0x04, 0x1c, 0xe7, 0x04,
+        0x3c, 0xe7, 0x1a, 0x5d, 0xef, 0x82, 0x39, 0xbe, 0xcf, 0x3a, 0x20, 0x4e, 0x2a, 0x82, 0x33,
+        0x6c, 0xba, 0xce, 0x02, 0x3c, 0xe7, 0x82, 0x73, 0xf6, 0x89, 0xfd, 0x0d, 0x69, 0xfd, 0x0a,
+        0x68, 0xfd, 0x83, 0x8b, 0xfd, 0x97, 0xe6, 0xfc, 0xde, 0x05, 0x1c, 0xe7, 0x04, 0x3c, 0xe7,
+        0x18, 0x5d, 0xef, 0x82, 0xba, 0xce, 0x91, 0x5b, 0x22, 0x4e, 0x2a, 0x84, 0x91, 0x5b, 0x19,
+        0xbe, 0xd8, 0xee, 0xab, 0xfd, 0x11, 0x69, 0xfd, 0x06, 0x68, 0xfd, 0x83, 0x69, 0xfd, 0x32,
+        0xee, 0xdb, 0xde, 0x03, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x05, 0x3c, 0xe7, 0x16, 0x5d, 0xef,
+        0x82, 0xdb, 0xd6, 0xd2, 0x63, 0x24, 0x4e, 0x2a, 0x82, 0x10, 0x4b, 0x4e, 0xd5, 0x10, 0x69,
+        0xfd, 0x08, 0x68, 0xfd, 0x82, 0xad, 0xf5, 0xb9, 0xde, 0x02, 0xdb, 0xde, 0x02, 0xfb, 0xde,
+        0x04, 0x1c, 0xe7, 0x05, 0x3c, 0xe7, 0x13, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0x7a, 0xce, 0xd2,
+        0x63, 0x25, 0x4e, 0x2a, 0x82, 0x2c, 0x6b, 0x29, 0xed, 0x0e, 0x69, 0xfd, 0x09, 0x68, 0xfd,
+        0x83, 0x8a, 0xfd, 0x55, 0xe6, 0xba, 0xd6, 0x03, 0xdb, 0xde, 0x81, 0xfb, 0xde, 0x03, 0x1c,
+        0xe7, 0x07, 0x3c, 0xe7, 0x11, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0xd8, 0xb5, 0x71, 0x53, 0x25,
+        0x4e, 0x2a, 0x82, 0x8d, 0x3a, 0xca, 0xcc, 0x0d, 0x69, 0xfd, 0x0b, 0x68, 0xfd, 0x81, 0xf1,
+        0xed, 0x03, 0xba, 0xd6, 0x81, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x08, 0x3c,
+        0xe7, 0x0e, 0x5d, 0xef, 0x84, 0x3c, 0xe7, 0x9a, 0xce, 0xb4, 0x84, 0xaf, 0x3a, 0x26, 0x4e,
+        0x2a, 0x81, 0xeb, 0x93, 0x0b, 0x69, 0xfd, 0x0d, 0x68, 0xfd, 0x82, 0xac, 0xfd, 0x98, 0xde,
+        0x02, 0xba, 0xd6, 0x02, 0xdb, 0xde, 0x81, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x0a, 0x3c, 0xe7,
+        0x0a, 0x5d, 0xef, 0x02, 0x3c, 0xe7, 0x83, 0x59, 0xc6, 0xf5, 0x94, 0x50, 0x4b, 0x27, 0x4e,
+        0x2a, 0x82, 0xec, 0x52, 0x09, 0xe5, 0x06, 0x69, 0xfd, 0x11, 0x68, 0xfd, 0x82, 0x69, 0xfd,
+        0x13, 0xe6, 0x03, 0x9a, 0xd6, 0x81, 0xba, 0xd6, 0x02, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x0c,
+        0x1c, 0xe7, 0x06, 0x3c, 0xe7, 0x86, 0xdb, 0xd6, 0x59, 0xc6, 0xf8, 0xb5, 0x36, 0x9d, 0xf2,
+        0x6b, 0xcf, 0x3a, 0x28, 0x4e, 0x2a, 0x82, 0x6d, 0x32, 0x6a, 0xb4, 0x18, 0x68, 0xfd, 0x82,
+        0x4b, 0xb4, 0x91, 0x63, 0x04, 0xb1, 0x5b, 0x03, 0xb1, 0x63, 0x13, 0xd2, 0x63, 0x83, 0x71,
+        0x53, 0xf0, 0x42, 0x8e, 0x32, 0x2b, 0x4e, 0x2a, 0x82, 0x8b, 0x7b, 0x49, 0xf5, 0x17, 0x68,
+        0xfd, 0x82, 0xc8, 0xd4, 0xad, 0x42, 0x48, 0x4e, 0x2a, 0x82, 0xcd, 0x4a, 0xe9, 0xd4, 0x17,
+        0x68, 0xfd, 0x82, 0x48, 0xf5, 0x6b, 0x7b, 0x38, 0x4e, 0x2a, 0x10, 0x2e, 0x2a, 0x82, 0x2d,
+        0x2a, 0x0a, 0xac, 0x18, 0x68, 0xfd, 0x82, 0x49, 0xb4, 0x4d, 0x32, 0x07, 0x2e, 0x2a, 0x02,
+        0x4e, 0x2a, 0x11, 0x2e, 0x2a, 0x81, 0x4e, 0x2a, 0x2d, 0x2e, 0x2a, 0x82, 0x6d, 0x3a, 0x6b,
+        0x83, 0x0b, 0xab, 0x93, 0x81, 0x08, 0xe5, 0x0b, 0x68, 0xfd, 0x82, 0xe8, 0xdc, 0xcc, 0x52,
+        0x07, 0x2e, 0x2a, 0x84, 0x8f, 0x2a, 0xd7, 0x1c, 0x38, 0x1d, 0xd0, 0x2a, 0x0f, 0x2e, 0x2a,
+        0x84, 0xf0, 0x2a, 0x58, 0x1d, 0xb6, 0x24, 0x6f, 0x2a, 0x37, 0x2e, 0x2a, 0x82, 0x2d, 0x2a,
+        0xa9, 0xcc, 0x0b, 0x68, 0xfd, 0x81, 0xab, 0x93, 0x07, 0x2e, 0x2a, 0x82, 0xf0, 0x2a, 0x99,
+        0x15, 0x02, 0x3f, 0x0f, 0x82, 0xfa, 0x15, 0x31, 0x23, 0x0d, 0x2e, 0x2a, 0x82, 0x72, 0x23,
+        0x3b, 0x16, 0x02, 0x3f, 0x07, 0x82, 0x58, 0x1d, 0xd0, 0x2a, 0x1a, 0x2e, 0x2a, 0x1c, 0x2d,
+        0x2a, 0x82, 0x2c, 0x2a, 0xa9, 0xcc, 0x0a, 0x68, 0xfd, 0x82, 0x69, 0xc4, 0x6c, 0x3a, 0x06,
+        0x2d, 0x2a, 0x82, 0x10, 0x23, 0xfa, 0x15, 0x04, 0x3f, 0x07, 0x82, 0x5c, 0x16, 0x71, 0x23,
+        0x0b, 0x2d, 0x2a, 0x82, 0xb2, 0x23, 0x9c, 0x0e, 0x04, 0x3f, 0x07, 0x82, 0xb9, 0x15, 0xef,
+        0x22, 0x35, 0x2d, 0x2a, 0x82, 0x2c, 0x2a, 0xa9, 0xcc, 0x09, 0x68, 0xfd, 0x82, 0x08, 0xed,
+        0x0b, 0x63, 0x06, 0x2d, 0x2a, 0x82, 0xcf, 0x22, 0xb9, 0x15, 0x06, 0x3f, 0x07, 0x82, 0x3b,
+        0x0e, 0x10, 0x23, 0x09, 0x2d, 0x2a, 0x82, 0x30, 0x23, 0x9c, 0x0e, 0x06, 0x3f, 0x07, 0x82,
+        0x99, 0x15, 0x8e, 0x22, 0x34, 0x2d, 0x2a, 0x82, 0x2c, 0x2a, 0xa9, 0xcc, 0x09, 0x68, 0xfd,
+        0x82, 0xea, 0xa3, 0x2c, 0x2a, 0x05, 0x2d, 0x2a, 0x82, 0x4d, 0x2a, 0x17, 0x1d, 0x08, 0x3f,
+        0x07, 0x82, 0x99, 0x15, 0x6e, 0x2a, 0x07, 0x2d, 0x2a, 0x82, 0x8e, 0x22, 0xfa, 0x15, 0x08,
+        0x3f, 0x07, 0x81, 0xb6, 0x1c, 0x34, 0x2d, 0x2a, 0x82, 0x2c, 0x2a, 0xa9, 0xcc, 0x08, 0x68,
+        0xfd, 0x82, 0xc8, 0xd4, 0x8c, 0x42, 0x06, 0x2d, 0x2a, 0x82, 0x71, 0x23, 0xdd, 0x0e, 0x08,
+        0x3f, 0x07, 0x82, 0xfe, 0x06, 0x13, 0x1c, 0x07, 0x2d, 0x2a, 0x81, 0x54, 0x1c, 0x09, 0x3f,
+        0x07, 0x82, 0xbd, 0x06, 0x30, 0x23, 0x17, 0x2d, 0x2a, 0x1c, 0x2d, 0x22, 0x82, 0x2c, 0x22,
+        0xa9, 0xcc, 0x07, 0x68, 0xfd, 0x82, 0x28, 0xf5, 0x4a, 0x73, 0x07, 0x2d, 0x22, 0x82, 0x17,
+        0x15, 0x1f, 0x07, 0x09, 0x3f, 0x07, 0x82, 0xb9, 0x0d, 0x6e, 0x22, 0x05, 0x2d, 0x22, 0x82,
+        0x8e, 0x1a, 0x1b, 0x0e, 0x0a, 0x3f, 0x07, 0x81, 0xd6, 0x14, 0x33, 0x2d, 0x22, 0x82, 0x2c,
+        0x22, 0xa9, 0xcc, 0x07, 0x68, 0xfd, 0x82, 0x29, 0xb4, 0x4c, 0x2a, 0x06, 0x2d, 0x22, 0x83,
+        0xcf, 0x1a, 0x3b, 0x06, 0x1f, 0x07, 0x09, 0x3f, 0x07, 0x82, 0xbd, 0x06, 0x30, 0x1b, 0x05,
+        0x2d, 0x22, 0x82, 0x71, 0x1b, 0xdd, 0x06, 0x0a, 0x3f, 0x07, 0x82, 0x1b, 0x06, 0x8e, 0x1a,
+        0x32, 0x2d, 0x22, 0x82, 0x2c, 0x22, 0xa9, 0xcc, 0x06, 0x68, 0xfd, 0x82, 0xe8, 0xdc, 0xcb,
+        0x4a, 0x07, 0x2d, 0x22, 0x83, 0x10, 0x1b, 0xbd, 0x06, 0x1f, 0x07, 0x0a, 0x3f, 0x07, 0x81,
+        0xb2, 0x13, 0x05, 0x2d, 0x22, 0x81, 0x34, 0x14, 0x0b, 0x3f, 0x07, 0x82, 0xbd, 0x06, 0xef,
+        0x1a, 0x32, 0x2d, 0x22, 0x82, 0x2c, 0x22, 0xa9, 0xcc, 0x06, 0x68, 0xfd, 0x81, 0x8a, 0x83,
+        0x08, 0x2d, 0x22, 0x82, 0x10, 0x1b, 0x9d, 0x06, 0x0a, 0x3f, 0x07, 0x82, 0xfe, 0x06, 0x72,
+        0x13, 0x05, 0x2d, 0x22, 0x82, 0xf3, 0x13, 0xfe, 0x06, 0x0a, 0x3f, 0x07, 0x82, 0x9c, 0x06,
+        0xaf, 0x1a, 0x32, 0x2d, 0x22, 0x82, 0x2c, 0x22, 0xa9, 0xcc, 0x05, 0x68, 0xfd, 0x82, 0x69,
+        0xc4, 0x6c, 0x32, 0x08, 0x2d, 0x22, 0x82, 0x6e, 0x1a, 0xda, 0x0d, 0x0a, 0x3f, 0x07, 0x82,
+        0x5c, 0x06, 0xaf, 0x1a, 0x05, 0x2d, 0x22, 0x82, 0x10, 0x1b, 0xbd, 0x06, 0x0a, 0x3f, 0x07,
+        0x82, 0x79, 0x0d, 0x4d, 0x1a, 0x32, 0x2d, 0x22, 0x82, 0x2c, 0x22, 0xa9, 0xcc, 0x04, 0x68,
+        0xfd, 0x82, 0x08, 0xed, 0x0b, 0x63, 0x0a, 0x2d, 0x22, 0x81, 0x75, 0x14, 0x0a, 0x3f, 0x07,
+        0x82, 0x17, 0x0d, 0x4d, 0x1a, 0x05, 0x2d, 0x22, 0x82, 0x4d, 0x1a, 0x58, 0x0d, 0x09, 0x3f,
+        0x07, 0x82, 0xfe, 0x06, 0x14, 0x14, 0x33, 0x2d, 0x22, 0x82, 0x2c, 0x22, 0xa9, 0xcc, 0x04,
+        0x68, 0xfd, 0x82, 0xea, 0xa3, 0x2c, 0x22, 0x0a, 0x2d, 0x22, 0x82, 0x8e, 0x1a, 0xda, 0x0d,
+        0x08, 0x3f, 0x07, 0x82, 0x3c, 0x06, 0xf0, 0x1a, 0x07, 0x2d, 0x22, 0x82, 0x30, 0x1b, 0x7c,
+        0x06, 0x08, 0x3f, 0x07, 0x82, 0x79, 0x0d, 0x6e, 0x1a, 0x33, 0x2d, 0x22, 0x82, 0x2c, 0x22,
+        0xa9, 0xcc, 0x03, 0x68, 0xfd, 0x82, 0xc8, 0xd4, 0x8c, 0x42, 0x0c, 0x2d, 0x22, 0x83, 0xf0,
+        0x1a, 0xda, 0x0d, 0x1f, 0x07, 0x04, 0x3f, 0x07, 0x83, 0x1f, 0x07, 0x1b, 0x06, 0x51, 0x1b,
+        0x09, 0x2d, 0x22, 0x82, 0x92, 0x13, 0x3c, 0x06, 0x05, 0x3f, 0x07, 0x83, 0xde, 0x06, 0x79,
+        0x0d, 0xcf, 0x1a, 0x34, 0x2d, 0x22, 0x82, 0x2c, 0x22, 0xa9, 0xcc, 0x02, 0x68, 0xfd, 0x82,
+        0x28, 0xf5, 0x4b, 0x73, 0x0e, 0x2d, 0x22, 0x88, 0x8e, 0x1a, 0x34, 0x14, 0x99, 0x0d, 0x5c,
+        0x06, 0x7d, 0x06, 0xba, 0x0d, 0x76, 0x14, 0xaf, 0x1a, 0x0b, 0x2d, 0x22, 0x88, 0xcf, 0x1a,
+        0x96, 0x0c, 0xba, 0x0d, 0x7d, 0x06, 0x5c, 0x06, 0x79, 0x0d, 0x14, 0x14, 0x6e, 0x1a, 0x35,
+        0x2d, 0x22, 0x82, 0x2c, 0x22, 0xa9, 0xcc, 0x02, 0x68, 0xfd, 0x82, 0x29, 0xb4, 0x4c, 0x2a,
+        0x10, 0x2d, 0x22, 0x84, 0x6e, 0x1a, 0xaf, 0x1a, 0xcf, 0x1a, 0x6e, 0x1a, 0x0f, 0x2d, 0x22,
+        0x84, 0x6e, 0x1a, 0xcf, 0x1a, 0xaf, 0x1a, 0x4d, 0x1a, 0x37, 0x2d, 0x22, 0x85, 0x2c, 0x22,
+        0xa9, 0xcc, 0x68, 0xfd, 0xe8, 0xe4, 0xcb, 0x4a, 0x5f, 0x2d, 0x22, 0x84, 0x2c, 0x22, 0xa9,
+        0xcc, 0x68, 0xfd, 0xaa, 0x8b, 0x60, 0x2d, 0x22, 0x84, 0x2c, 0x22, 0xa9, 0xcc, 0x89, 0xcc,
+        0x6c, 0x32, 0x13, 0x2d, 0x22, 0x82, 0x6e, 0x22, 0x8e, 0x22, 0x11, 0x2d, 0x22, 0x82, 0xcf,
+        0x22, 0x6e, 0x22, 0x38, 0x2d, 0x22, 0x83, 0x2c, 0x22, 0x49, 0xbc, 0x0b, 0x63, 0x13, 0x2d,
+        0x22, 0x84, 0x10, 0x23, 0xb9, 0x15, 0x1b, 0x16, 0x71, 0x23, 0x0f, 0x2d, 0x22, 0x84, 0xb2,
+        0x23, 0x3b, 0x16, 0x99, 0x15, 0xef, 0x22, 0x37, 0x2d, 0x22, 0x83, 0x2c, 0x22, 0x4b, 0x73,
+        0x2c, 0x22, 0x12, 0x2d, 0x22, 0x82, 0x92, 0x23, 0x3b, 0x16, 0x02, 0x3f, 0x07, 0x83, 0x9c,
+        0x0e, 0x13, 0x1c, 0x4d, 0x22, 0x0b, 0x2d, 0x22, 0x83, 0x4d, 0x22, 0x34, 0x1c, 0xbd, 0x0e,
+        0x02, 0x3f, 0x07, 0x82, 0x1b, 0x16, 0x30, 0x23, 0x37, 0x2d, 0x22, 0x81, 0x2c, 0x22, 0x12,
+        0x2d, 0x22, 0x82, 0xb2, 0x1b, 0x9c, 0x0e, 0x04, 0x3f, 0x07, 0x82, 0xdd, 0x0e, 0x34, 0x1c,
+        0x0a, 0x2d, 0x22, 0x83, 0x4d, 0x22, 0x95, 0x1c, 0xdd, 0x0e, 0x04, 0x3f, 0x07, 0x82, 0x5c,
+        0x0e, 0x71, 0x23, 0x48, 0x2d, 0x22, 0x82, 0x30, 0x1b, 0x5c, 0x0e, 0x06, 0x3f, 0x07, 0x82,
+        0xbd, 0x0e, 0xb2, 0x1b, 0x09, 0x2d, 0x22, 0x82, 0xd3, 0x1b, 0xdd, 0x06, 0x06, 0x3f, 0x07,
+        0x82, 0x3b, 0x0e, 0xef, 0x22, 0x46, 0x2d, 0x22, 0x82, 0x6e, 0x22, 0x99, 0x0d, 0x08, 0x3f,
+        0x07, 0x82, 0x3b, 0x0e, 0xcf, 0x22, 0x07, 0x2d, 0x22, 0x82, 0xef, 0x1a, 0x5c, 0x0e, 0x08,
+        0x3f, 0x07, 0x82, 0x58, 0x15, 0x4d, 0x22, 0x17, 0x2d, 0x22, 0x2e, 0x0d, 0x22, 0x82, 0xd3,
+        0x1b, 0xfe, 0x06, 0x09, 0x3f, 0x07, 0x81, 0x75, 0x1c, 0x07, 0x0d, 0x22, 0x81, 0xb6, 0x14,
+        0x09, 0x3f, 0x07, 0x82, 0xdd, 0x06, 0x72, 0x1b, 0x44, 0x0d, 0x22, 0x82, 0x2d, 0x22, 0x99,
+        0x0d, 0x0a, 0x3f, 0x07, 0x82, 0x1b, 0x0e, 0x6e, 0x1a, 0x05, 0x0d, 0x22, 0x82, 0xaf, 0x1a,
+        0x5c, 0x06, 0x0a, 0x3f, 0x07, 0x81, 0x17, 0x15, 0x44, 0x0d, 0x22, 0x82, 0xcf, 0x1a, 0x5c,
+        0x06, 0x0a, 0x3f, 0x07, 0x82, 0xdd, 0x06, 0x51, 0x1b, 0x05, 0x0d, 0x22, 0x82, 0x92, 0x1b,
+        0xfe, 0x06, 0x0a, 0x3f, 0x07, 0x82, 0x3b, 0x06, 0x6e, 0x1a, 0x43, 0x0d, 0x22, 0x82, 0x10,
+        0x1b, 0xdd, 0x06, 0x0b, 0x3f, 0x07, 0x81, 0xd3, 0x13, 0x05, 0x0d, 0x22, 0x81, 0x14, 0x14,
+        0x0b, 0x3f, 0x07, 0x82, 0xbd, 0x06, 0xcf, 0x1a, 0x43, 0x0d, 0x22, 0x82, 0xcf, 0x1a, 0x7c,
+        0x06, 0x0a, 0x3f, 0x07, 0x82, 0xdd, 0x06, 0x51, 0x1b, 0x05, 0x0d, 0x22, 0x82, 0x92, 0x13,
+        0xfe, 0x06, 0x0a, 0x3f, 0x07, 0x82, 0x5c, 0x06, 0xaf, 0x1a, 0x43, 0x0d, 0x22, 0x82, 0x2d,
+        0x1a, 0x99, 0x0d, 0x0a, 0x3f, 0x07, 0x82, 0x3b, 0x06, 0x6e, 0x1a, 0x05, 0x0d, 0x22, 0x82,
+        0x8f, 0x1a, 0x7c, 0x06, 0x0a, 0x3f, 0x07, 0x82, 0x38, 0x0d, 0x2d, 0x1a, 0x44, 0x0d, 0x22,
+        0x82, 0xd3, 0x13, 0xde, 0x06, 0x09, 0x3f, 0x07, 0x81, 0x96, 0x14, 0x06, 0x0d, 0x22, 0x82,
+        0x2d, 0x1a, 0xd7, 0x0c, 0x09, 0x3f, 0x07, 0x82, 0xbd, 0x06, 0x92, 0x13, 0x45, 0x0d, 0x22,
+        0x82, 0x4e, 0x1a, 0x18, 0x0d, 0x08, 0x3f, 0x07, 0x82, 0x99, 0x0d, 0x6e, 0x1a, 0x07, 0x0d,
+        0x22, 0x82, 0x8f, 0x1a, 0xfb, 0x05, 0x07, 0x3f, 0x07, 0x83, 0x1f, 0x07, 0xb7, 0x0c, 0x2d,
+        0x1a, 0x17, 0x0d, 0x22, 0x2f, 0x0c, 0x22, 0x84, 0x6d, 0x1a, 0xb6, 0x0c, 0xbd, 0x06, 0x1f,
+        0x07, 0x03, 0x3f, 0x07, 0x83, 0xde, 0x06, 0x38, 0x0d, 0x8e, 0x1a, 0x09, 0x0c, 0x22, 0x83,
+        0xae, 0x1a, 0x59, 0x0d, 0xde, 0x06, 0x03, 0x3f, 0x07, 0x84, 0x1f, 0x07, 0x9d, 0x06, 0x96,
+        0x0c, 0x4d, 0x1a, 0x48, 0x0c, 0x22, 0x88, 0x2c, 0x1a, 0x30, 0x1b, 0x75, 0x14, 0x99, 0x0d,
+        0xba, 0x0d, 0xb6, 0x0c, 0x51, 0x13, 0x2c, 0x1a, 0x0b, 0x0c, 0x22, 0x87, 0x4d, 0x1a, 0x71,
+        0x13, 0xb6, 0x0c, 0xba, 0x0d, 0x99, 0x0d, 0x75, 0x14, 0x10, 0x1b, 0x4d, 0x0c, 0x22, 0x02,
+        0x2c, 0x1a, 0x11, 0x0c, 0x22, 0x02, 0x2c, 0x1a, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x4a,
+        0x0c, 0x22,
+
+};
+
+const lv_image_dsc_t image_strong_tstorms_opaque = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
+    .header.w = 100,
+    .header.h = 100,
+    .header.stride = 200,
+    .header.reserved_2 = 0,
+    .data_size = sizeof(image_strong_tstorms_opaque_map),
+    .data = image_strong_tstorms_opaque_map,
+    .reserved = NULL,
+};
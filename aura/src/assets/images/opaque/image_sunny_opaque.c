@@ -0,0 +1,179 @@
+// Generated by tools/flatten_images.py from image_sunny.c: pre-blended onto the
+// main screen gradient at y = 4. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_SUNNY_OPAQUE
+  #define LV_ATTRIBUTE_IMAGE_SUNNY_OPAQUE
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_SUNNY_OPAQUE uint8_t
+    image_sunny_opaque_map[] = {
+
+        0x01, 0x00, 0x00, 0x00, 0xd9, 0x07, 0x00, 0x00, 0x20, 0x4e, 0x00, 0x00, 0x7f, 0x90, 0x2a,
+        0x7f, 0x90, 0x2a, 0x7f, 0x90, 0x2a, 0x13, 0x90, 0x2a, 0x7f, 0x8f, 0x2a, 0x7f, 0x8f, 0x2a,
+        0x7f, 0x8f, 0x2a, 0x3c, 0x8f, 0x2a, 0x88, 0xce, 0x32, 0x0e, 0x43, 0x4e, 0x4b, 0xcd, 0x6b,
+        0x6c, 0x84, 0xcb, 0x94, 0x0b, 0xa5, 0x2b, 0xad, 0x02, 0x4b, 0xb5, 0x88, 0x2b, 0xad, 0x0b,
+        0xa5, 0xcb, 0x94, 0x4c, 0x84, 0xcd, 0x6b, 0x4e, 0x4b, 0x0e, 0x43, 0xce, 0x32, 0x4e, 0x8f,
+        0x2a, 0x89, 0xce, 0x32, 0x2e, 0x4b, 0x0c, 0x6c, 0xeb, 0x9c, 0xaa, 0xbd, 0x29, 0xd6, 0x89,
+        0xee, 0xa9, 0xf6, 0xe8, 0xfe, 0x09, 0xc8, 0xfe, 0x88, 0x88, 0xf6, 0x68, 0xee, 0x09, 0xd6,
+        0xaa, 0xbd, 0xeb, 0x9c, 0xec, 0x6b, 0x2e, 0x4b, 0xce, 0x32, 0x25, 0x8f, 0x2a, 0x22, 0x6f,
+        0x2a, 0x86, 0x8e, 0x2a, 0x0e, 0x4b, 0x4c, 0x84, 0x6a, 0xb5, 0x69, 0xe6, 0xa9, 0xf6, 0x14,
+        0xc8, 0xfe, 0x86, 0x88, 0xf6, 0x48, 0xe6, 0x6a, 0xb5, 0x2c, 0x7c, 0x0e, 0x4b, 0x8e, 0x2a,
+        0x42, 0x6f, 0x2a, 0x85, 0xae, 0x32, 0xcd, 0x6b, 0x2b, 0xad, 0x49, 0xde, 0xe9, 0xfe, 0x16,
+        0xc8, 0xfe, 0x03, 0xc7, 0xfe, 0x86, 0xc8, 0xfe, 0x88, 0xf6, 0x28, 0xde, 0x2b, 0xad, 0xcd,
+        0x6b, 0xae, 0x32, 0x3e, 0x6f, 0x2a, 0x84, 0xae, 0x32, 0xec, 0x6b, 0x8a, 0xbd, 0xa9, 0xf6,
+        0x1a, 0xc8, 0xfe, 0x05, 0xc7, 0xfe, 0x85, 0xc8, 0xfe, 0x88, 0xf6, 0x8a, 0xbd, 0xec, 0x6b,
+        0xae, 0x32, 0x3a, 0x6f, 0x2a, 0x84, 0x8e, 0x2a, 0xcd, 0x6b, 0x8a, 0xbd, 0xa9, 0xf6, 0x1c,
+        0xc8, 0xfe, 0x08, 0xc7, 0xfe, 0x84, 0x88, 0xf6, 0xca, 0xc5, 0xcd, 0x6b, 0x8e, 0x2a, 0x37,
+        0x6f, 0x2a, 0x83, 0x2d, 0x4b, 0x2b, 0xad, 0x89, 0xee, 0x1e, 0xc8, 0xfe, 0x0a, 0xc7, 0xfe,
+        0x83, 0x68, 0xee, 0x2b, 0xad, 0x2d, 0x4b, 0x34, 0x6f, 0x2a, 0x85, 0xae, 0x32, 0x4c, 0x84,
+        0x49, 0xde, 0xe9, 0xfe, 0xe8, 0xfe, 0x1e, 0xc8, 0xfe, 0x0c, 0xc7, 0xfe, 0x83, 0x28, 0xde,
+        0x4c, 0x84, 0xae, 0x32, 0x31, 0x6f, 0x2a, 0x84, 0xee, 0x42, 0x2b, 0xad, 0xa9, 0xf6, 0xe9,
+        0xfe, 0x03, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x0d, 0xc7, 0xfe, 0x83, 0x88, 0xf6, 0x2b, 0xad,
+        0xee, 0x42, 0x2f, 0x6f, 0x2a, 0x82, 0xad, 0x63, 0xea, 0xcd, 0x03, 0xe9, 0xfe, 0x03, 0xe8,
+        0xfe, 0x1d, 0xc8, 0xfe, 0x0f, 0xc7, 0xfe, 0x82, 0xc9, 0xcd, 0x8d, 0x63, 0x2d, 0x6f, 0x2a,
+        0x82, 0xec, 0x6b, 0x49, 0xde, 0x04, 0xe9, 0xfe, 0x04, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe, 0x10,
+        0xc7, 0xfe, 0x82, 0x28, 0xde, 0xec, 0x6b, 0x2a, 0x6f, 0x2a, 0x83, 0x8e, 0x2a, 0x2c, 0x7c,
+        0x69, 0xe6, 0x06, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe, 0x11, 0xc7, 0xfe, 0x83,
+        0x48, 0xe6, 0x2c, 0x7c, 0x8e, 0x2a, 0x27, 0x6f, 0x2a, 0x83, 0x8e, 0x2a, 0x4c, 0x84, 0x89,
+        0xee, 0x07, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe, 0x12, 0xc7, 0xfe, 0x83, 0x68,
+        0xee, 0x4b, 0x84, 0x8e, 0x2a, 0x26, 0x6f, 0x2a, 0x82, 0x2c, 0x7c, 0x89, 0xee, 0x08, 0xe9,
+        0xfe, 0x03, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe, 0x13, 0xc7, 0xfe, 0x82, 0x67, 0xee, 0x2c, 0x7c,
+        0x25, 0x6f, 0x2a, 0x82, 0xec, 0x6b, 0x69, 0xe6, 0x09, 0xe9, 0xfe, 0x03, 0xe8, 0xfe, 0x1c,
+        0xc8, 0xfe, 0x14, 0xc7, 0xfe, 0x82, 0x47, 0xe6, 0xec, 0x6b, 0x23, 0x6f, 0x2a, 0x82, 0xad,
+        0x63, 0x49, 0xde, 0x09, 0xe9, 0xfe, 0x04, 0xe8, 0xfe, 0x1c, 0xc8, 0xfe, 0x15, 0xc7, 0xfe,
+        0x82, 0x28, 0xde, 0x8d, 0x63, 0x21, 0x6f, 0x2a, 0x82, 0xee, 0x42, 0xea, 0xcd, 0x0a, 0xe9,
+        0xfe, 0x03, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x16, 0xc7, 0xfe, 0x82, 0xc9, 0xcd, 0xee, 0x42,
+        0x1f, 0x6f, 0x2a, 0x82, 0xae, 0x32, 0x2b, 0xad, 0x0a, 0xe9, 0xfe, 0x04, 0xe8, 0xfe, 0x1d,
+        0xc8, 0xfe, 0x17, 0xc7, 0xfe, 0x82, 0x0a, 0xad, 0xae, 0x32, 0x1e, 0x6f, 0x2a, 0x82, 0x4c,
+        0x84, 0xa9, 0xf6, 0x0a, 0xe9, 0xfe, 0x04, 0xe8, 0xfe, 0x1d, 0xc8, 0xfe, 0x17, 0xc7, 0xfe,
+        0x82, 0x87, 0xf6, 0x4b, 0x84, 0x1d, 0x6f, 0x2a, 0x82, 0x2d, 0x4b, 0x49, 0xde, 0x09, 0xe9,
+        0xfe, 0x05, 0xe8, 0xfe, 0x1e, 0xc8, 0xfe, 0x18, 0xc7, 0xfe, 0x82, 0x28, 0xde, 0x2d, 0x4b,
+        0x1b, 0x6f, 0x2a, 0x82, 0x8e, 0x2a, 0x2b, 0xad, 0x03, 0xe8, 0xfe, 0x06, 0xe9, 0xfe, 0x05,
+        0xe8, 0xfe, 0x1f, 0xc8, 0xfe, 0x19, 0xc7, 0xfe, 0x82, 0x0a, 0xad, 0x8e, 0x2a, 0x1a, 0x6f,
+        0x2a, 0x82, 0xcd, 0x6b, 0x89, 0xee, 0x0d, 0xe8, 0xfe, 0x20, 0xc8, 0xfe, 0x19, 0xc7, 0xfe,
+        0x82, 0x67, 0xee, 0xac, 0x6b, 0x19, 0x6f, 0x2a, 0x83, 0xae, 0x32, 0xca, 0xc5, 0xc8, 0xfe,
+        0x0c, 0xe8, 0xfe, 0x20, 0xc8, 0xfe, 0x1b, 0xc7, 0xfe, 0x82, 0x89, 0xbd, 0xae, 0x32, 0x18,
+        0x6f, 0x2a, 0x82, 0xec, 0x6b, 0x88, 0xf6, 0x03, 0xc8, 0xfe, 0x07, 0xe8, 0xfe, 0x23, 0xc8,
+        0xfe, 0x1b, 0xc7, 0xfe, 0x82, 0x87, 0xf6, 0xec, 0x6b, 0x17, 0x6f, 0x2a, 0x82, 0xae, 0x32,
+        0x8a, 0xbd, 0x2e, 0xc8, 0xfe, 0x1c, 0xc7, 0xfe, 0x82, 0x89, 0xbd, 0xae, 0x32, 0x16, 0x6f,
+        0x2a, 0x82, 0xcd, 0x6b, 0xa9, 0xf6, 0x2e, 0xc8, 0xfe, 0x1c, 0xc7, 0xfe, 0x82, 0x67, 0xee,
+        0xac, 0x6b, 0x0b, 0x6f, 0x2a, 0x0a, 0x6e, 0x2a, 0x82, 0x8d, 0x2a, 0x2a, 0xad, 0x2e, 0xc8,
+        0xfe, 0x1e, 0xc7, 0xfe, 0x82, 0x09, 0xad, 0x8d, 0x2a, 0x0a, 0x6e, 0x2a, 0x0a, 0x4e, 0x2a,
+        0x82, 0xed, 0x4a, 0x28, 0xde, 0x2e, 0xc8, 0xfe, 0x1e, 0xc7, 0xfe, 0x82, 0x27, 0xde, 0xed,
+        0x4a, 0x14, 0x4e, 0x2a, 0x81, 0x4b, 0x84, 0x2f, 0xc8, 0xfe, 0x1e, 0xc7, 0xfe, 0x82, 0x87,
+        0xf6, 0x0b, 0x7c, 0x13, 0x4e, 0x2a, 0x82, 0x8d, 0x32, 0x4a, 0xb5, 0x2e, 0xc8, 0xfe, 0x20,
+        0xc7, 0xfe, 0x82, 0x49, 0xb5, 0x8d, 0x32, 0x12, 0x4e, 0x2a, 0x82, 0xed, 0x4a, 0x28, 0xde,
+        0x2e, 0xc8, 0xfe, 0x20, 0xc7, 0xfe, 0x82, 0x27, 0xde, 0xec, 0x4a, 0x12, 0x4e, 0x2a, 0x82,
+        0xcb, 0x6b, 0x88, 0xf6, 0x2d, 0xc8, 0xfe, 0x21, 0xc7, 0xfe, 0x82, 0x87, 0xf6, 0xac, 0x6b,
+        0x12, 0x4e, 0x2a, 0x81, 0xcb, 0x9c, 0x2e, 0xc8, 0xfe, 0x22, 0xc7, 0xfe, 0x81, 0xaa, 0x94,
+        0x11, 0x4e, 0x2a, 0x82, 0x8d, 0x32, 0x69, 0xbd, 0x2d, 0xc8, 0xfe, 0x23, 0xc7, 0xfe, 0x82,
+        0x68, 0xbd, 0x8d, 0x32, 0x10, 0x4e, 0x2a, 0x82, 0xcd, 0x42, 0x28, 0xd6, 0x2c, 0xc8, 0xfe,
+        0x23, 0xc7, 0xfe, 0x83, 0xc6, 0xfe, 0x08, 0xd6, 0xcd, 0x42, 0x10, 0x4e, 0x2a, 0x82, 0x0c,
+        0x4b, 0x68, 0xee, 0x2c, 0xc8, 0xfe, 0x23, 0xc7, 0xfe, 0x83, 0xc6, 0xfe, 0x67, 0xee, 0x0c,
+        0x4b, 0x10, 0x4e, 0x2a, 0x82, 0xac, 0x6b, 0x88, 0xf6, 0x2b, 0xc8, 0xfe, 0x24, 0xc7, 0xfe,
+        0x83, 0xc6, 0xfe, 0x86, 0xf6, 0x8b, 0x6b, 0x10, 0x4e, 0x2a, 0x81, 0x2b, 0x84, 0x2b, 0xc8,
+        0xfe, 0x24, 0xc7, 0xfe, 0x02, 0xc6, 0xfe, 0x82, 0xc7, 0xfe, 0x2b, 0x84, 0x10, 0x4e, 0x2a,
+        0x81, 0xaa, 0x94, 0x2a, 0xc8, 0xfe, 0x25, 0xc7, 0xfe, 0x02, 0xc6, 0xfe, 0x82, 0xc7, 0xfe,
+        0xaa, 0x94, 0x10, 0x4e, 0x2a, 0x81, 0xe9, 0xa4, 0x2a, 0xc8, 0xfe, 0x24, 0xc7, 0xfe, 0x04,
+        0xc6, 0xfe, 0x81, 0xe9, 0xa4, 0x10, 0x4e, 0x2a, 0x81, 0x0a, 0xad, 0x29, 0xc8, 0xfe, 0x25,
+        0xc7, 0xfe, 0x04, 0xc6, 0xfe, 0x81, 0x09, 0xad, 0x10, 0x4e, 0x2a, 0x81, 0x2a, 0xb5, 0x28,
+        0xc8, 0xfe, 0x26, 0xc7, 0xfe, 0x04, 0xc6, 0xfe, 0x81, 0x29, 0xb5, 0x10, 0x4e, 0x2a, 0x81,
+        0x2a, 0xb5, 0x27, 0xc8, 0xfe, 0x26, 0xc7, 0xfe, 0x05, 0xc6, 0xfe, 0x81, 0x29, 0xb5, 0x10,
+        0x4e, 0x2a, 0x81, 0x0a, 0xad, 0x26, 0xc8, 0xfe, 0x27, 0xc7, 0xfe, 0x05, 0xc6, 0xfe, 0x81,
+        0x09, 0xad, 0x10, 0x4e, 0x2a, 0x81, 0xe9, 0xa4, 0x24, 0xc8, 0xfe, 0x28, 0xc7, 0xfe, 0x06,
+        0xc6, 0xfe, 0x81, 0xe9, 0xa4, 0x10, 0x4e, 0x2a, 0x81, 0xaa, 0x94, 0x23, 0xc8, 0xfe, 0x29,
+        0xc7, 0xfe, 0x06, 0xc6, 0xfe, 0x81, 0x6a, 0x94, 0x10, 0x4e, 0x2a, 0x81, 0x2b, 0x84, 0x22,
+        0xc8, 0xfe, 0x29, 0xc7, 0xfe, 0x07, 0xc6, 0xfe, 0x81, 0x0a, 0x84, 0x10, 0x4e, 0x2a, 0x82,
+        0xac, 0x6b, 0x88, 0xf6, 0x1f, 0xc8, 0xfe, 0x2b, 0xc7, 0xfe, 0x06, 0xc6, 0xfe, 0x82, 0x86,
+        0xf6, 0x8b, 0x6b, 0x10, 0x4e, 0x2a, 0x82, 0x0c, 0x4b, 0x68, 0xee, 0x1d, 0xc8, 0xfe, 0x2c,
+        0xc7, 0xfe, 0x07, 0xc6, 0xfe, 0x82, 0x46, 0xee, 0x0c, 0x4b, 0x10, 0x4e, 0x2a, 0x82, 0xcd,
+        0x42, 0x08, 0xd6, 0x1b, 0xc8, 0xfe, 0x2e, 0xc7, 0xfe, 0x07, 0xc6, 0xfe, 0x82, 0xe7, 0xd5,
+        0xcd, 0x42, 0x10, 0x4e, 0x2a, 0x82, 0x8d, 0x32, 0x68, 0xbd, 0x19, 0xc8, 0xfe, 0x2f, 0xc7,
+        0xfe, 0x08, 0xc6, 0xfe, 0x82, 0x68, 0xbd, 0x8d, 0x32, 0x11, 0x4e, 0x2a, 0x82, 0xaa, 0x9c,
+        0xc7, 0xfe, 0x14, 0xc8, 0xfe, 0x32, 0xc7, 0xfe, 0x08, 0xc6, 0xfe, 0x82, 0xa6, 0xfe, 0xa9,
+        0x9c, 0x12, 0x4e, 0x2a, 0x82, 0xcb, 0x6b, 0x87, 0xf6, 0x05, 0xc7, 0xfe, 0x09, 0xc8, 0xfe,
+        0x38, 0xc7, 0xfe, 0x08, 0xc6, 0xfe, 0x82, 0x86, 0xf6, 0xab, 0x6b, 0x09, 0x4e, 0x2a, 0x09,
+        0x2e, 0x2a, 0x82, 0xcc, 0x4a, 0x27, 0xde, 0x45, 0xc7, 0xfe, 0x09, 0xc6, 0xfe, 0x82, 0x07,
+        0xde, 0xcc, 0x4a, 0x12, 0x2e, 0x2a, 0x82, 0x6d, 0x32, 0x49, 0xb5, 0x44, 0xc7, 0xfe, 0x0a,
+        0xc6, 0xfe, 0x82, 0x28, 0xb5, 0x6d, 0x32, 0x13, 0x2e, 0x2a, 0x82, 0x0b, 0x7c, 0x87, 0xf6,
+        0x43, 0xc7, 0xfe, 0x09, 0xc6, 0xfe, 0x82, 0x66, 0xf6, 0xea, 0x7b, 0x0a, 0x2e, 0x2a, 0x0a,
+        0x2d, 0x2a, 0x82, 0xcc, 0x4a, 0x27, 0xde, 0x42, 0xc7, 0xfe, 0x0a, 0xc6, 0xfe, 0x82, 0x06,
+        0xde, 0xcc, 0x4a, 0x14, 0x2d, 0x2a, 0x82, 0x2c, 0x2a, 0xe9, 0xac, 0x41, 0xc7, 0xfe, 0x0b,
+        0xc6, 0xfe, 0x82, 0xe8, 0xac, 0x2c, 0x2a, 0x15, 0x2d, 0x2a, 0x82, 0x8b, 0x6b, 0x87, 0xf6,
+        0x3f, 0xc7, 0xfe, 0x0b, 0xc6, 0xfe, 0x82, 0x46, 0xee, 0x6a, 0x6b, 0x16, 0x2d, 0x2a, 0x82,
+        0x6c, 0x32, 0x48, 0xbd, 0x3e, 0xc7, 0xfe, 0x0c, 0xc6, 0xfe, 0x82, 0x47, 0xbd, 0x6c, 0x32,
+        0x0b, 0x2d, 0x2a, 0x0c, 0x2d, 0x22, 0x82, 0xaa, 0x6b, 0x87, 0xf6, 0x3c, 0xc7, 0xfe, 0x0c,
+        0xc6, 0xfe, 0x82, 0x66, 0xf6, 0xaa, 0x6b, 0x18, 0x2d, 0x22, 0x82, 0x6c, 0x2a, 0x88, 0xc5,
+        0x3c, 0xc7, 0xfe, 0x0c, 0xc6, 0xfe, 0x82, 0x87, 0xc5, 0x6c, 0x2a, 0x19, 0x2d, 0x22, 0x82,
+        0x6b, 0x63, 0x67, 0xee, 0x3a, 0xc7, 0xfe, 0x0c, 0xc6, 0xfe, 0x82, 0x46, 0xee, 0x6a, 0x63,
+        0x1a, 0x2d, 0x22, 0x82, 0x4c, 0x22, 0xe9, 0xa4, 0x39, 0xc7, 0xfe, 0x0c, 0xc6, 0xfe, 0x83,
+        0xa6, 0xfe, 0xc8, 0xa4, 0x4c, 0x22, 0x1b, 0x2d, 0x22, 0x82, 0xeb, 0x4a, 0xe7, 0xd5, 0x37,
+        0xc7, 0xfe, 0x0d, 0xc6, 0xfe, 0x82, 0x06, 0xde, 0xeb, 0x4a, 0x1d, 0x2d, 0x22, 0x82, 0x0a,
+        0x7c, 0x87, 0xf6, 0x35, 0xc7, 0xfe, 0x0d, 0xc6, 0xfe, 0x82, 0x66, 0xf6, 0x09, 0x7c, 0x1e,
+        0x2d, 0x22, 0x82, 0x6c, 0x2a, 0xc9, 0xa4, 0x33, 0xc7, 0xfe, 0x0e, 0xc6, 0xfe, 0x83, 0xa6,
+        0xfe, 0xc8, 0xa4, 0x6c, 0x2a, 0x1f, 0x2d, 0x22, 0x82, 0xac, 0x3a, 0xa8, 0xcd, 0x31, 0xc7,
+        0xfe, 0x0f, 0xc6, 0xfe, 0x82, 0x87, 0xcd, 0xac, 0x3a, 0x21, 0x2d, 0x22, 0x82, 0x2b, 0x53,
+        0x07, 0xde, 0x2f, 0xc7, 0xfe, 0x0f, 0xc6, 0xfe, 0x82, 0x06, 0xde, 0x2b, 0x53, 0x23, 0x2d,
+        0x22, 0x82, 0x8a, 0x6b, 0x27, 0xe6, 0x2d, 0xc7, 0xfe, 0x0f, 0xc6, 0xfe, 0x82, 0x26, 0xe6,
+        0x8a, 0x6b, 0x25, 0x2d, 0x22, 0x82, 0xea, 0x73, 0x47, 0xee, 0x2b, 0xc7, 0xfe, 0x0f, 0xc6,
+        0xfe, 0x82, 0x46, 0xee, 0xea, 0x73, 0x26, 0x2d, 0x22, 0x83, 0x4c, 0x22, 0x09, 0x7c, 0x47,
+        0xee, 0x28, 0xc7, 0xfe, 0x10, 0xc6, 0xfe, 0x83, 0x46, 0xee, 0xe9, 0x7b, 0x4c, 0x22, 0x27,
+        0x2d, 0x22, 0x83, 0x2c, 0x22, 0xea, 0x73, 0x27, 0xe6, 0x26, 0xc7, 0xfe, 0x10, 0xc6, 0xfe,
+        0x83, 0x26, 0xe6, 0xea, 0x73, 0x4c, 0x22, 0x2a, 0x2d, 0x22, 0x82, 0x8a, 0x6b, 0x07, 0xde,
+        0x23, 0xc7, 0xfe, 0x10, 0xc6, 0xfe, 0x83, 0xa6, 0xfe, 0xe6, 0xdd, 0x8a, 0x6b, 0x2d, 0x2d,
+        0x22, 0x83, 0x2b, 0x53, 0x87, 0xcd, 0xa7, 0xfe, 0x20, 0xc7, 0xfe, 0x10, 0xc6, 0xfe, 0x83,
+        0xa6, 0xfe, 0x87, 0xcd, 0x2b, 0x53, 0x2f, 0x2d, 0x22, 0x83, 0xac, 0x3a, 0xc8, 0xa4, 0x67,
+        0xf6, 0x1d, 0xc7, 0xfe, 0x11, 0xc6, 0xfe, 0x83, 0x66, 0xf6, 0xc8, 0xa4, 0xac, 0x3a, 0x31,
+        0x2d, 0x22, 0x83, 0x6c, 0x2a, 0xe9, 0x7b, 0xe6, 0xdd, 0x1a, 0xc7, 0xfe, 0x11, 0xc6, 0xfe,
+        0x84, 0xa6, 0xfe, 0xe6, 0xdd, 0xe9, 0x7b, 0x6c, 0x2a, 0x34, 0x2d, 0x22, 0x83, 0xeb, 0x4a,
+        0xc8, 0xa4, 0x47, 0xee, 0x16, 0xc7, 0xfe, 0x11, 0xc6, 0xfe, 0x84, 0xa6, 0xfe, 0x46, 0xee,
+        0xc8, 0xa4, 0xeb, 0x4a, 0x1b, 0x2d, 0x22, 0x1c, 0x0d, 0x22, 0x84, 0x2c, 0x22, 0x4a, 0x63,
+        0x67, 0xc5, 0x66, 0xf6, 0x12, 0xc7, 0xfe, 0x11, 0xc6, 0xfe, 0x85, 0xa6, 0xfe, 0x66, 0xf6,
+        0x67, 0xc5, 0x4a, 0x63, 0x2c, 0x22, 0x3a, 0x0d, 0x22, 0x84, 0x4c, 0x2a, 0x8a, 0x6b, 0x27,
+        0xbd, 0x66, 0xf6, 0x0e, 0xc7, 0xfe, 0x11, 0xc6, 0xfe, 0x85, 0xa6, 0xfe, 0x66, 0xf6, 0x27,
+        0xbd, 0x8a, 0x6b, 0x4c, 0x2a, 0x3e, 0x0d, 0x22, 0x85, 0x4c, 0x2a, 0x4a, 0x63, 0xc8, 0xa4,
+        0xe6, 0xdd, 0x66, 0xf6, 0x08, 0xc7, 0xfe, 0x11, 0xc6, 0xfe, 0x86, 0xa6, 0xfe, 0x66, 0xf6,
+        0xe6, 0xdd, 0xc8, 0xa4, 0x4a, 0x63, 0x4c, 0x2a, 0x42, 0x0d, 0x22, 0x87, 0x2c, 0x22, 0xab,
+        0x42, 0xca, 0x73, 0x08, 0xb5, 0xe6, 0xdd, 0x66, 0xf6, 0xa6, 0xfe, 0x11, 0xc6, 0xfe, 0x02,
+        0xa6, 0xfe, 0x86, 0x66, 0xf6, 0xe6, 0xdd, 0x08, 0xb5, 0xca, 0x73, 0xab, 0x42, 0x2c, 0x22,
+        0x47, 0x0d, 0x22, 0x88, 0x4c, 0x2a, 0xab, 0x42, 0x8a, 0x6b, 0x69, 0x9c, 0x27, 0xbd, 0xc7,
+        0xd5, 0x26, 0xee, 0x66, 0xf6, 0x0a, 0xa6, 0xfe, 0x88, 0x66, 0xf6, 0x26, 0xee, 0xc7, 0xd5,
+        0x27, 0xbd, 0x69, 0x9c, 0x8a, 0x6b, 0xab, 0x42, 0x4c, 0x2a, 0x4e, 0x0d, 0x22, 0x88, 0x4c,
+        0x2a, 0x8c, 0x3a, 0xcb, 0x4a, 0x6b, 0x63, 0xe9, 0x7b, 0x49, 0x94, 0x88, 0xa4, 0xc8, 0xa4,
+        0x02, 0xe8, 0xac, 0x88, 0xc8, 0xa4, 0x88, 0xa4, 0x29, 0x8c, 0xe9, 0x7b, 0x6b, 0x63, 0xcb,
+        0x4a, 0x8c, 0x3a, 0x4c, 0x2a, 0x7f, 0x0d, 0x22, 0x72, 0x0d, 0x22, 0x7f, 0x0c, 0x22, 0x7f,
+        0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x5c, 0x0c, 0x22,
+
+};
+
+const lv_image_dsc_t image_sunny_opaque = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
+    .header.w = 100,
+    .header.h = 100,
+    .header.stride = 200,
+    .header.reserved_2 = 0,
+    .data_size = sizeof(image_sunny_opaque_map),
+    .data = image_sunny_opaque_map,
+    .reserved = NULL,
+};
@@ -0,0 +1,104 @@
+// Generated by tools/flatten_images.py from image_tornado.c: pre-blended onto the
+// main screen gradient at y = 4. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_TORNADO_OPAQUE
+  #define LV_ATTRIBUTE_IMAGE_TORNADO_OPAQUE
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_TORNADO_OPAQUE uint8_t
+    image_tornado_opaque_map[] = {
+
+        0x01, 0x00, 0x00, 0x00, 0x6d, 0x03, 0x00, 0x00, 0x20, 0x4e, 0x00, 0x00, 0x7f, 0x90, 0x2a,
+        0x7f, 0x90, 0x2a, 0x7f, 0x90, 0x2a, 0x13, 0x90, 0x2a, 0x7f, 0x8f, 0x2a, 0x7f, 0x8f, 0x2a,
+        0x7f, 0x8f, 0x2a, 0x7f, 0x8f, 0x2a, 0x5c, 0x8f, 0x2a, 0x7f, 0x6f, 0x2a, 0x53, 0x6f, 0x2a,
+        0x81, 0x71, 0x53, 0x4b, 0x54, 0x7c, 0x82, 0x12, 0x6c, 0xaf, 0x32, 0x16, 0x6f, 0x2a, 0x81,
+        0x94, 0x84, 0x0d, 0x38, 0xc6, 0x3d, 0x18, 0xc6, 0x82, 0xd6, 0xb5, 0xd2, 0x63, 0x17, 0x6f,
+        0x2a, 0x81, 0x74, 0x7c, 0x32, 0x18, 0xc6, 0x17, 0xf7, 0xbd, 0x82, 0x96, 0xad, 0xb1, 0x5b,
+        0x18, 0x6f, 0x2a, 0x81, 0x74, 0x7c, 0x32, 0x18, 0xc6, 0x16, 0xf7, 0xbd, 0x82, 0x96, 0xad,
+        0xb1, 0x5b, 0x19, 0x6f, 0x2a, 0x81, 0x74, 0x7c, 0x32, 0x18, 0xc6, 0x15, 0xf7, 0xbd, 0x82,
+        0x96, 0xad, 0xb1, 0x5b, 0x1a, 0x6f, 0x2a, 0x81, 0x74, 0x7c, 0x32, 0x18, 0xc6, 0x14, 0xf7,
+        0xbd, 0x82, 0x96, 0xad, 0xb1, 0x5b, 0x1b, 0x6f, 0x2a, 0x81, 0x74, 0x7c, 0x32, 0x18, 0xc6,
+        0x13, 0xf7, 0xbd, 0x82, 0x96, 0xad, 0xb1, 0x5b, 0x1c, 0x6f, 0x2a, 0x81, 0x94, 0x84, 0x32,
+        0x18, 0xc6, 0x12, 0xf7, 0xbd, 0x82, 0x96, 0xad, 0xb1, 0x5b, 0x1d, 0x6f, 0x2a, 0x81, 0xf2,
+        0x6b, 0x22, 0x15, 0x9d, 0x22, 0xf4, 0x94, 0x81, 0xb1, 0x5b, 0x7f, 0x6f, 0x2a, 0x7f, 0x6f,
+        0x2a, 0x7f, 0x6f, 0x2a, 0x7f, 0x6f, 0x2a, 0x7f, 0x6f, 0x2a, 0x64, 0x6f, 0x2a, 0x40, 0x8f,
+        0x2a, 0x23, 0x6f, 0x2a, 0x81, 0x94, 0x84, 0x0f, 0x76, 0xa5, 0x31, 0x56, 0x9d, 0x81, 0x92,
+        0x5b, 0x22, 0x6f, 0x2a, 0x81, 0xf2, 0x63, 0x2b, 0x18, 0xc6, 0x15, 0xf7, 0xbd, 0x82, 0x35,
+        0x9d, 0xf0, 0x3a, 0x21, 0x6f, 0x2a, 0x82, 0xaf, 0x32, 0x36, 0x9d, 0x2a, 0x18, 0xc6, 0x16,
+        0xf7, 0xbd, 0x81, 0x53, 0x7c, 0x22, 0x6f, 0x2a, 0x82, 0xb2, 0x5b, 0xf7, 0xbd, 0x28, 0x18,
+        0xc6, 0x17, 0xf7, 0xbd, 0x82, 0x96, 0xad, 0x10, 0x43, 0x21, 0x6f, 0x2a, 0x82, 0x8f, 0x32,
+        0xf4, 0x8c, 0x28, 0x18, 0xc6, 0x18, 0xf7, 0xbd, 0x81, 0x53, 0x7c, 0x12, 0x6f, 0x2a, 0x10,
+        0x6e, 0x2a, 0x82, 0x50, 0x53, 0xb6, 0xad, 0x26, 0x18, 0xc6, 0x19, 0xf7, 0xbd, 0x82, 0x55,
+        0xa5, 0xcf, 0x3a, 0x11, 0x6e, 0x2a, 0x11, 0x4e, 0x2a, 0x81, 0x33, 0x7c, 0x26, 0x18, 0xc6,
+        0x1a, 0xf7, 0xbd, 0x81, 0x71, 0x5b, 0x22, 0x4e, 0x2a, 0x82, 0xaf, 0x3a, 0xf4, 0x94, 0x03,
+        0x18, 0xc6, 0x3c, 0xf7, 0xbd, 0x81, 0x33, 0x7c, 0x23, 0x4e, 0x2a, 0x82, 0xef, 0x42, 0x12,
+        0x74, 0x3e, 0xf2, 0x6b, 0x81, 0x71, 0x5b, 0x7f, 0x4e, 0x2a, 0x7f, 0x4e, 0x2a, 0x7f, 0x4e,
+        0x2a, 0x7f, 0x4e, 0x2a, 0x7f, 0x4e, 0x2a, 0x6d, 0x4e, 0x2a, 0x81, 0xcf, 0x3a, 0x36, 0x30,
+        0x4b, 0x81, 0xef, 0x42, 0x2c, 0x4e, 0x2a, 0x82, 0x91, 0x5b, 0xb7, 0xb5, 0x14, 0x17, 0xbe,
+        0x21, 0xf7, 0xbd, 0x81, 0x94, 0x84, 0x2d, 0x4e, 0x2a, 0x82, 0xb1, 0x63, 0xb6, 0xad, 0x11,
+        0x18, 0xc6, 0x23, 0xf7, 0xbd, 0x81, 0x91, 0x5b, 0x2e, 0x4e, 0x2a, 0x82, 0xb1, 0x63, 0xb6,
+        0xad, 0x10, 0x18, 0xc6, 0x22, 0xf7, 0xbd, 0x82, 0x96, 0xad, 0xef, 0x42, 0x2f, 0x4e, 0x2a,
+        0x82, 0xb1, 0x63, 0xb6, 0xad, 0x0e, 0x18, 0xc6, 0x23, 0xf7, 0xbd, 0x81, 0xb3, 0x84, 0x31,
+        0x4e, 0x2a, 0x82, 0xb1, 0x63, 0xb6, 0xad, 0x0c, 0x18, 0xc6, 0x23, 0xf7, 0xbd, 0x82, 0xd6,
+        0xb5, 0x50, 0x53, 0x32, 0x4e, 0x2a, 0x82, 0xb1, 0x63, 0xb6, 0xad, 0x0a, 0x18, 0xc6, 0x24,
+        0xf7, 0xbd, 0x81, 0xb4, 0x8c, 0x34, 0x4e, 0x2a, 0x82, 0xb1, 0x63, 0xb6, 0xad, 0x08, 0x18,
+        0xc6, 0x24, 0xf7, 0xbd, 0x82, 0x96, 0xad, 0x10, 0x4b, 0x35, 0x4e, 0x2a, 0x82, 0xb1, 0x63,
+        0x76, 0xad, 0x2b, 0xb6, 0xb5, 0x81, 0x12, 0x74, 0x37, 0x4e, 0x2a, 0x81, 0xcf, 0x42, 0x2b,
+        0xef, 0x42, 0x81, 0x6e, 0x32, 0x7f, 0x4e, 0x2a, 0x7f, 0x4e, 0x2a, 0x7f, 0x4e, 0x2a, 0x7f,
+        0x4e, 0x2a, 0x70, 0x4e, 0x2a, 0x7f, 0x2e, 0x2a, 0x0c, 0x2e, 0x2a, 0x81, 0x10, 0x4b, 0x21,
+        0x33, 0x7c, 0x82, 0x33, 0x74, 0x10, 0x4b, 0x40, 0x2e, 0x2a, 0x81, 0xd2, 0x6b, 0x20, 0x18,
+        0xc6, 0x83, 0xf7, 0xbd, 0xd4, 0x94, 0xaf, 0x3a, 0x19, 0x2e, 0x2a, 0x27, 0x2d, 0x2a, 0x81,
+        0xd1, 0x63, 0x20, 0xf7, 0xbd, 0x82, 0xb4, 0x8c, 0xae, 0x3a, 0x41, 0x2d, 0x2a, 0x81, 0xd1,
+        0x63, 0x1f, 0xf7, 0xbd, 0x82, 0xd4, 0x94, 0xae, 0x3a, 0x42, 0x2d, 0x2a, 0x81, 0xd1, 0x63,
+        0x1e, 0xf7, 0xbd, 0x82, 0xd4, 0x94, 0xae, 0x3a, 0x43, 0x2d, 0x2a, 0x81, 0xd1, 0x63, 0x1d,
+        0xf7, 0xbd, 0x82, 0xd4, 0x94, 0xae, 0x3a, 0x1d, 0x2d, 0x2a, 0x27, 0x2d, 0x22, 0x81, 0xd1,
+        0x63, 0x1c, 0xf7, 0xbd, 0x82, 0xd4, 0x94, 0xae, 0x32, 0x45, 0x2d, 0x22, 0x81, 0xd1, 0x63,
+        0x1b, 0xf7, 0xbd, 0x82, 0xd4, 0x94, 0xae, 0x32, 0x46, 0x2d, 0x22, 0x81, 0x50, 0x53, 0x1a,
+        0xd4, 0x94, 0x82, 0x72, 0x7c, 0xae, 0x32, 0x7f, 0x2d, 0x22, 0x7f, 0x2d, 0x22, 0x7f, 0x2d,
+        0x22, 0x7f, 0x2d, 0x22, 0x7f, 0x2d, 0x22, 0x7f, 0x2d, 0x22, 0x05, 0x2d, 0x22, 0x12, 0x4d,
+        0x22, 0x52, 0x2d, 0x22, 0x81, 0xf1, 0x63, 0x10, 0x55, 0x9d, 0x82, 0x14, 0x95, 0xae, 0x32,
+        0x51, 0x2d, 0x22, 0x81, 0xb1, 0x63, 0x10, 0xf7, 0xbd, 0x81, 0x93, 0x84, 0x52, 0x2d, 0x22,
+        0x82, 0x0f, 0x43, 0xb6, 0xad, 0x0e, 0xf7, 0xbd, 0x82, 0xb6, 0xad, 0x0f, 0x43, 0x52, 0x2d,
+        0x22, 0x82, 0x8e, 0x32, 0x55, 0xa5, 0x0e, 0xf7, 0xbd, 0x82, 0xf4, 0x94, 0x4d, 0x2a, 0x53,
+        0x2d, 0x22, 0x81, 0x12, 0x74, 0x0e, 0xf7, 0xbd, 0x81, 0x12, 0x74, 0x54, 0x2d, 0x22, 0x82,
+        0xae, 0x32, 0x55, 0xa5, 0x0c, 0xf7, 0xbd, 0x82, 0xd6, 0xb5, 0x50, 0x4b, 0x55, 0x2d, 0x22,
+        0x82, 0x70, 0x53, 0x96, 0xad, 0x0b, 0xf7, 0xbd, 0x82, 0xb6, 0xad, 0xce, 0x3a, 0x30, 0x2d,
+        0x22, 0x26, 0x0d, 0x22, 0x82, 0x70, 0x5b, 0x76, 0xad, 0x0a, 0xf7, 0xbd, 0x82, 0xb6, 0xad,
+        0x8e, 0x32, 0x57, 0x0d, 0x22, 0x81, 0x0f, 0x4b, 0x0a, 0xd1, 0x6b, 0x82, 0xb1, 0x63, 0x2d,
+        0x2a, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d, 0x22, 0x7f, 0x0d,
+        0x22, 0x0d, 0x0d, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x7f, 0x0c,
+        0x22, 0x5c, 0x0c, 0x22,
+
+};
+
+const lv_image_dsc_t image_tornado_opaque = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
+    .header.w = 100,
+    .header.h = 100,
+    .header.stride = 200,
+    .header.reserved_2 = 0,
+    .data_size = sizeof(image_tornado_opaque_map),
+    .data = image_tornado_opaque_map,
+    .reserved = NULL,
+};
@@ -0,0 +1,222 @@
+// Generated by tools/flatten_images.py from image_wintry_mix_rain_snow.c: pre-blended onto the
+// main screen gradient at y = 4. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMAGE_WINTRY_MIX_RAIN_SNOW_OPAQUE
+  #define LV_ATTRIBUTE_IMAGE_WINTRY_MIX_RAIN_SNOW_OPAQUE
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMAGE_WINTRY_MIX_RAIN_SNOW_OPAQUE uint8_t
+    image_wintry_mix_rain_snow_opaque_map[] = {
+
+        0x01, 0x00, 0x00, 0x00, 0x5c, 0x0a, 0x00, 0x00, 0x20, 0x4e, 0x00, 0x00, 0x7f, 0x90, 0x2a,
+        0x7f, 0x90, 0x2a, 0x50, 0x90, 0x2a, 0x07, 0xb0, 0x2a, 0x3b, 0x90, 0x2a, 0x1e, 0x8f, 0x2a,
+        0x87, 0xcf, 0x32, 0xb2, 0x5b, 0x33, 0x6c, 0xd5, 0x84, 0x98, 0xa5, 0x19, 0xbe, 0x39, 0xbe,
+        0x02, 0x59, 0xbe, 0x86, 0x39, 0xbe, 0xf9, 0xb5, 0x16, 0x8d, 0x54, 0x74, 0xd2, 0x5b, 0xf0,
+        0x3a, 0x52, 0x8f, 0x2a, 0x85, 0xf0, 0x3a, 0x13, 0x64, 0x77, 0x9d, 0x59, 0xbe, 0xfc, 0xde,
+        0x0b, 0x5d, 0xef, 0x85, 0x1c, 0xe7, 0x5a, 0xc6, 0x98, 0xa5, 0x33, 0x6c, 0xf0, 0x3a, 0x4d,
+        0x8f, 0x2a, 0x84, 0x51, 0x43, 0xf6, 0x8c, 0x7a, 0xc6, 0x1c, 0xe7, 0x12, 0x5d, 0xef, 0x83,
+        0x5a, 0xc6, 0xf6, 0x8c, 0x31, 0x43, 0x49, 0x8f, 0x2a, 0x83, 0x10, 0x43, 0xf6, 0x8c, 0x9a,
+        0xce, 0x17, 0x5d, 0xef, 0x83, 0xbb, 0xd6, 0x16, 0x8d, 0x10, 0x43, 0x45, 0x8f, 0x2a, 0x83,
+        0xaf, 0x2a, 0x33, 0x6c, 0x39, 0xbe, 0x1b, 0x5d, 0xef, 0x83, 0x5a, 0xc6, 0x54, 0x74, 0xaf,
+        0x2a, 0x42, 0x8f, 0x2a, 0x83, 0xf0, 0x3a, 0x36, 0x95, 0x1c, 0xe7, 0x1d, 0x5d, 0xef, 0x83,
+        0x1c, 0xe7, 0x36, 0x95, 0x10, 0x3b, 0x2d, 0x8f, 0x2a, 0x13, 0x6f, 0x2a, 0x82, 0x51, 0x4b,
+        0xf9, 0xb5, 0x21, 0x5d, 0xef, 0x82, 0x19, 0xbe, 0x51, 0x4b, 0x3e, 0x6f, 0x2a, 0x82, 0x72,
+        0x53, 0x5a, 0xc6, 0x23, 0x5d, 0xef, 0x82, 0x5a, 0xc6, 0x72, 0x53, 0x3c, 0x6f, 0x2a, 0x82,
+        0x51, 0x4b, 0x5a, 0xc6, 0x25, 0x5d, 0xef, 0x82, 0x7a, 0xce, 0x72, 0x53, 0x3a, 0x6f, 0x2a,
+        0x82, 0x31, 0x43, 0x39, 0xbe, 0x27, 0x5d, 0xef, 0x82, 0x5a, 0xc6, 0x51, 0x4b, 0x38, 0x6f,
+        0x2a, 0x82, 0xaf, 0x32, 0xb8, 0xad, 0x29, 0x5d, 0xef, 0x82, 0xf9, 0xb5, 0xd0, 0x3a, 0x36,
+        0x6f, 0x2a, 0x82, 0x8f, 0x2a, 0xf6, 0x8c, 0x2b, 0x5d, 0xef, 0x82, 0xf6, 0x8c, 0x8f, 0x2a,
+        0x35, 0x6f, 0x2a, 0x82, 0xb2, 0x5b, 0xfc, 0xde, 0x2b, 0x5d, 0xef, 0x82, 0xfc, 0xde, 0xb2,
+        0x5b, 0x34, 0x6f, 0x2a, 0x82, 0xaf, 0x32, 0xf9, 0xb5, 0x2d, 0x5d, 0xef, 0x82, 0x19, 0xbe,
+        0xd0, 0x3a, 0x33, 0x6f, 0x2a, 0x82, 0x54, 0x74, 0x1c, 0xe7, 0x2e, 0x5d, 0xef, 0x81, 0x95,
+        0x7c, 0x32, 0x6f, 0x2a, 0x82, 0xd0, 0x3a, 0x39, 0xbe, 0x2f, 0x5d, 0xef, 0x82, 0x5a, 0xc6,
+        0xd0, 0x3a, 0x31, 0x6f, 0x2a, 0x82, 0x34, 0x74, 0x1c, 0xe7, 0x2f, 0x5d, 0xef, 0x82, 0x1c,
+        0xe7, 0xd6, 0x8c, 0x02, 0x71, 0x53, 0x07, 0x72, 0x53, 0x83, 0x31, 0x43, 0xd0, 0x3a, 0x8f,
+        0x2a, 0x24, 0x6f, 0x2a, 0x82, 0x8f, 0x2a, 0xb8, 0xad, 0x31, 0x5d, 0xef, 0x81, 0x3c, 0xe7,
+        0x02, 0xdb, 0xde, 0x02, 0xfb, 0xde, 0x04, 0x1c, 0xe7, 0x87, 0xfc, 0xde, 0xbb, 0xd6, 0x39,
+        0xbe, 0xd8, 0xad, 0xd6, 0x8c, 0xb2, 0x5b, 0xaf, 0x32, 0x21, 0x6f, 0x2a, 0x82, 0x51, 0x4b,
+        0xdb, 0xd6, 0x32, 0x5d, 0xef, 0x83, 0x1c, 0xe7, 0xfb, 0xde, 0x1c, 0xe7, 0x02, 0x3c, 0xe7,
+        0x08, 0x5d, 0xef, 0x84, 0xfc, 0xde, 0x19, 0xbe, 0xb5, 0x84, 0xf0, 0x42, 0x1f, 0x6f, 0x2a,
+        0x81, 0xb5, 0x84, 0x33, 0x5d, 0xef, 0x83, 0x1c, 0xe7, 0xfb, 0xde, 0x1c, 0xe7, 0x02, 0x3c,
+        0xe7, 0x0b, 0x5d, 0xef, 0x83, 0x5a, 0xc6, 0x54, 0x74, 0xaf, 0x32, 0x1c, 0x6f, 0x2a, 0x82,
+        0x8f, 0x2a, 0x77, 0xa5, 0x33, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0xfb, 0xde, 0x1c, 0xe7, 0x02,
+        0x3c, 0xe7, 0x0c, 0x5d, 0xef, 0x83, 0x1c, 0xe7, 0x98, 0xa5, 0x31, 0x43, 0x1b, 0x6f, 0x2a,
+        0x82, 0xf0, 0x42, 0x7a, 0xce, 0x33, 0x5d, 0xef, 0x81, 0x3c, 0xe7, 0x02, 0xfb, 0xde, 0x82,
+        0x1c, 0xe7, 0x3c, 0xe7, 0x0e, 0x5d, 0xef, 0x82, 0x5a, 0xc6, 0x92, 0x5b, 0x1a, 0x6f, 0x2a,
+        0x82, 0x51, 0x4b, 0xfc, 0xde, 0x34, 0x5d, 0xef, 0x03, 0xfb, 0xde, 0x02, 0x3c, 0xe7, 0x0e,
+        0x5d, 0xef, 0x82, 0x7a, 0xce, 0x92, 0x5b, 0x19, 0x6f, 0x2a, 0x82, 0xf3, 0x63, 0x1c, 0xe7,
+        0x34, 0x5d, 0xef, 0x85, 0x1c, 0xe7, 0xdb, 0xde, 0xfb, 0xde, 0x1c, 0xe7, 0x3c, 0xe7, 0x0f,
+        0x5d, 0xef, 0x82, 0x7a, 0xce, 0x72, 0x53, 0x18, 0x6f, 0x2a, 0x81, 0xb5, 0x84, 0x35, 0x5d,
+        0xef, 0x83, 0x1c, 0xe7, 0xdb, 0xde, 0xfb, 0xde, 0x02, 0x1c, 0xe7, 0x81, 0x3c, 0xe7, 0x0f,
+        0x5d, 0xef, 0x82, 0x19, 0xbe, 0xd0, 0x3a, 0x17, 0x6f, 0x2a, 0x81, 0xf6, 0x8c, 0x35, 0x5d,
+        0xef, 0x83, 0x1c, 0xe7, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x81, 0x3c, 0xe7, 0x0f,
+        0x5d, 0xef, 0x81, 0xf6, 0x8c, 0x17, 0x6f, 0x2a, 0x81, 0x16, 0x95, 0x35, 0x5d, 0xef, 0x83,
+        0x1c, 0xe7, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x02, 0x3c, 0xe7, 0x0e, 0x5d, 0xef,
+        0x82, 0xdb, 0xd6, 0x72, 0x53, 0x16, 0x6f, 0x2a, 0x81, 0x16, 0x95, 0x35, 0x5d, 0xef, 0x83,
+        0x1c, 0xe7, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x03, 0x3c, 0xe7, 0x0e, 0x5d, 0xef,
+        0x82, 0x77, 0xa5, 0x8f, 0x2a, 0x15, 0x6f, 0x2a, 0x81, 0x16, 0x95, 0x35, 0x5d, 0xef, 0x83,
+        0x1c, 0xe7, 0xdb, 0xde, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x04, 0x3c, 0xe7, 0x0d, 0x5d, 0xef,
+        0x82, 0xba, 0xce, 0x51, 0x4b, 0x15, 0x6f, 0x2a, 0x81, 0xf6, 0x8c, 0x35, 0x5d, 0xef, 0x81,
+        0x1c, 0xe7, 0x02, 0xfb, 0xde, 0x02, 0x1c, 0xe7, 0x05, 0x3c, 0xe7, 0x0e, 0x5d, 0xef, 0x81,
+        0xb5, 0x84, 0x0b, 0x6f, 0x2a, 0x0a, 0x6e, 0x2a, 0x82, 0x53, 0x74, 0x1c, 0xe7, 0x34, 0x5d,
+        0xef, 0x82, 0x1c, 0xe7, 0xfb, 0xde, 0x03, 0x1c, 0xe7, 0x07, 0x3c, 0xe7, 0x0c, 0x5d, 0xef,
+        0x82, 0xf8, 0xb5, 0xae, 0x32, 0x0a, 0x6e, 0x2a, 0x0a, 0x4e, 0x2a, 0x82, 0x71, 0x53, 0xfc,
+        0xde, 0x34, 0x5d, 0xef, 0x02, 0xfb, 0xde, 0x02, 0x1c, 0xe7, 0x09, 0x3c, 0xe7, 0x0b, 0x5d,
+        0xef, 0x82, 0xdb, 0xd6, 0x10, 0x43, 0x14, 0x4e, 0x2a, 0x82, 0x10, 0x43, 0xdb, 0xd6, 0x34,
+        0x5d, 0xef, 0x02, 0xfb, 0xde, 0x02, 0x1c, 0xe7, 0x0a, 0x3c, 0xe7, 0x0a, 0x5d, 0xef, 0x82,
+        0xfc, 0xde, 0x71, 0x53, 0x14, 0x4e, 0x2a, 0x82, 0x8e, 0x32, 0x19, 0xbe, 0x33, 0x5d, 0xef,
+        0x82, 0x3c, 0xe7, 0xfb, 0xde, 0x02, 0x1c, 0xe7, 0x0c, 0x3c, 0xe7, 0x09, 0x5d, 0xef, 0x82,
+        0x1c, 0xe7, 0x54, 0x74, 0x15, 0x4e, 0x2a, 0x81, 0x16, 0x95, 0x33, 0x5d, 0xef, 0x82, 0x1c,
+        0xe7, 0xfb, 0xde, 0x02, 0x1c, 0xe7, 0x0d, 0x3c, 0xe7, 0x09, 0x5d, 0xef, 0x81, 0xf5, 0x8c,
+        0x15, 0x4e, 0x2a, 0x82, 0xd2, 0x63, 0x1c, 0xe7, 0x32, 0x5d, 0xef, 0x82, 0x1c, 0xe7, 0xfb,
+        0xde, 0x02, 0x1c, 0xe7, 0x0e, 0x3c, 0xe7, 0x08, 0x5d, 0xef, 0x81, 0x16, 0x95, 0x15, 0x4e,
+        0x2a, 0x82, 0xaf, 0x3a, 0x39, 0xbe, 0x31, 0x5d, 0xef, 0x81, 0x3c, 0xe7, 0x03, 0x1c, 0xe7,
+        0x10, 0x3c, 0xe7, 0x07, 0x5d, 0xef, 0x81, 0xf5, 0x8c, 0x16, 0x4e, 0x2a, 0x81, 0xd5, 0x8c,
+        0x31, 0x5d, 0xef, 0x81, 0x3c, 0xe7, 0x02, 0x1c, 0xe7, 0x12, 0x3c, 0xe7, 0x05, 0x5d, 0xef,
+        0x82, 0x1c, 0xe7, 0x74, 0x7c, 0x16, 0x4e, 0x2a, 0x82, 0x51, 0x53, 0xdb, 0xd6, 0x30, 0x5d,
+        0xef, 0x02, 0x1c, 0xe7, 0x14, 0x3c, 0xe7, 0x04, 0x5d, 0xef, 0x82, 0xfc, 0xde, 0x91, 0x5b,
+        0x16, 0x4e, 0x2a, 0x82, 0x6e, 0x2a, 0x36, 0x95, 0x2f, 0x5d, 0xef, 0x82, 0x3c, 0xe7, 0x1c,
+        0xe7, 0x03, 0x3c, 0xe7, 0x05, 0x5d, 0xef, 0x0d, 0x3c, 0xe7, 0x04, 0x5d, 0xef, 0x82, 0xba,
+        0xce, 0x10, 0x43, 0x17, 0x4e, 0x2a, 0x82, 0x10, 0x4b, 0x9a, 0xce, 0x2e, 0x5d, 0xef, 0x04,
+        0x3c, 0xe7, 0x06, 0x5d, 0xef, 0x0e, 0x3c, 0xe7, 0x03, 0x5d, 0xef, 0x82, 0xf8, 0xb5, 0x8e,
+        0x32, 0x18, 0x4e, 0x2a, 0x81, 0xb5, 0x84, 0x2d, 0x5d, 0xef, 0x04, 0x3c, 0xe7, 0x18, 0x5d,
+        0xef, 0x81, 0xd5, 0x8c, 0x19, 0x4e, 0x2a, 0x82, 0xaf, 0x3a, 0xf8, 0xb5, 0x2c, 0x5d, 0xef,
+        0x03, 0x3c, 0xe7, 0x18, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x51, 0x53, 0x1a, 0x4e, 0x2a, 0x82,
+        0x51, 0x53, 0x9a, 0xce, 0x2a, 0x5d, 0xef, 0x03, 0x3c, 0xe7, 0x19, 0x5d, 0xef, 0x82, 0x97,
+        0xa5, 0x6e, 0x2a, 0x1b, 0x4e, 0x2a, 0x82, 0x33, 0x74, 0xdb, 0xd6, 0x28, 0x5d, 0xef, 0x04,
+        0x3c, 0xe7, 0x18, 0x5d, 0xef, 0x82, 0xdb, 0xd6, 0x91, 0x5b, 0x1c, 0x4e, 0x2a, 0x83, 0x6e,
+        0x2a, 0xb5, 0x84, 0xfb, 0xde, 0x26, 0x5d, 0xef, 0x04, 0x3c, 0xe7, 0x18, 0x5d, 0xef, 0x83,
+        0x3c, 0xe7, 0x16, 0x95, 0x6e, 0x2a, 0x1d, 0x4e, 0x2a, 0x83, 0x6e, 0x2a, 0xd5, 0x8c, 0xfb,
+        0xde, 0x24, 0x5d, 0xef, 0x04, 0x3c, 0xe7, 0x19, 0x5d, 0xef, 0x82, 0x39, 0xbe, 0xf0, 0x42,
+        0x1f, 0x4e, 0x2a, 0x83, 0x6e, 0x2a, 0x74, 0x7c, 0xdb, 0xd6, 0x22, 0x5d, 0xef, 0x04, 0x3c,
+        0xe7, 0x19, 0x5d, 0xef, 0x82, 0xba, 0xce, 0x91, 0x5b, 0x21, 0x4e, 0x2a, 0x83, 0x6e, 0x2a,
+        0xf2, 0x63, 0x59, 0xc6, 0x20, 0x5d, 0xef, 0x04, 0x3c, 0xe7, 0x19, 0x5d, 0xef, 0x82, 0xdb,
+        0xd6, 0xd2, 0x63, 0x24, 0x4e, 0x2a, 0x83, 0x30, 0x4b, 0xb8, 0xad, 0xfb, 0xde, 0x1d, 0x5d,
+        0xef, 0x04, 0x3c, 0xe7, 0x18, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0x7a, 0xce, 0xd2, 0x63, 0x26,
+        0x4e, 0x2a, 0x84, 0x8e, 0x32, 0x54, 0x7c, 0x59, 0xc6, 0x3c, 0xe7, 0x1a, 0x5d, 0xef, 0x03,
+        0x3c, 0xe7, 0x19, 0x5d, 0xef, 0x83, 0x3c, 0xe7, 0xf8, 0xb5, 0x71, 0x53, 0x29, 0x4e, 0x2a,
+        0x84, 0xf0, 0x42, 0x94, 0x84, 0x59, 0xc6, 0x3c, 0xe7, 0x32, 0x5d, 0xef, 0x84, 0x3c, 0xe7,
+        0x9a, 0xce, 0xb4, 0x84, 0xcf, 0x3a, 0x2c, 0x4e, 0x2a, 0x84, 0xcf, 0x3a, 0x33, 0x6c, 0xb8,
+        0xad, 0x9a, 0xce, 0x02, 0x3c, 0xe7, 0x2b, 0x5d, 0xef, 0x02, 0x3c, 0xe7, 0x83, 0x59, 0xc6,
+        0xd5, 0x8c, 0x30, 0x4b, 0x30, 0x4e, 0x2a, 0x88, 0x6e, 0x2a, 0x30, 0x4b, 0xf2, 0x6b, 0x36,
+        0x9d, 0xf8, 0xb5, 0x59, 0xc6, 0xdb, 0xd6, 0xfb, 0xde, 0x24, 0x3c, 0xe7, 0x86, 0xdb, 0xd6,
+        0x59, 0xc6, 0xf8, 0xb5, 0x36, 0x95, 0xf2, 0x6b, 0xf0, 0x42, 0x36, 0x4e, 0x2a, 0x84, 0x6e,
+        0x2a, 0xcf, 0x3a, 0x71, 0x53, 0xb2, 0x5b, 0x24, 0xd2, 0x63, 0x83, 0x71, 0x53, 0xf0, 0x42,
+        0x8e, 0x32, 0x7f, 0x4e, 0x2a, 0x62, 0x4e, 0x2a, 0x44, 0x2e, 0x2a, 0x81, 0x4e, 0x2a, 0x62,
+        0x2e, 0x2a, 0x84, 0x31, 0x23, 0x79, 0x1d, 0x95, 0x24, 0x4e, 0x2a, 0x5f, 0x2e, 0x2a, 0x86,
+        0x92, 0x23, 0x5c, 0x16, 0x3f, 0x07, 0xfe, 0x0e, 0xf7, 0x1c, 0x8f, 0x2a, 0x1c, 0x2e, 0x2a,
+        0x25, 0x2d, 0x2a, 0x81, 0x0f, 0x4b, 0x03, 0xf2, 0x6b, 0x81, 0x50, 0x53, 0x17, 0x2d, 0x2a,
+        0x82, 0x13, 0x24, 0xbd, 0x0e, 0x04, 0x3f, 0x07, 0x82, 0x99, 0x15, 0xcf, 0x2a, 0x40, 0x2d,
+        0x2a, 0x81, 0x12, 0x74, 0x03, 0x18, 0xc6, 0x81, 0xb4, 0x8c, 0x16, 0x2d, 0x2a, 0x82, 0x92,
+        0x23, 0xbd, 0x0e, 0x06, 0x3f, 0x07, 0x82, 0x58, 0x1d, 0x6e, 0x22, 0x3f, 0x2d, 0x2a, 0x81,
+        0x12, 0x74, 0x03, 0xf7, 0xbd, 0x81, 0x93, 0x84, 0x15, 0x2d, 0x2a, 0x82, 0xcf, 0x22, 0x1b,
+        0x0e, 0x07, 0x3f, 0x07, 0x82, 0xfe, 0x06, 0x54, 0x24, 0x3f, 0x2d, 0x2a, 0x81, 0x12, 0x74,
+        0x03, 0xf7, 0xbd, 0x81, 0x93, 0x84, 0x15, 0x2d, 0x2a, 0x81, 0xb6, 0x1c, 0x09, 0x3f, 0x07,
+        0x82, 0x5c, 0x0e, 0xef, 0x22, 0x19, 0x2d, 0x2a, 0x25, 0x2d, 0x22, 0x81, 0x12, 0x6c, 0x03,
+        0xf7, 0xbd, 0x81, 0x93, 0x84, 0x14, 0x2d, 0x22, 0x82, 0xcf, 0x1a, 0x5c, 0x0e, 0x0a, 0x3f,
+        0x07, 0x81, 0x75, 0x14, 0x3e, 0x2d, 0x22, 0x81, 0x12, 0x6c, 0x03, 0xf7, 0xbd, 0x81, 0x93,
+        0x84, 0x14, 0x2d, 0x22, 0x82, 0xb2, 0x13, 0xfe, 0x06, 0x0a, 0x3f, 0x07, 0x82, 0x99, 0x0d,
+        0x6e, 0x1a, 0x33, 0x2d, 0x22, 0x83, 0x2f, 0x4b, 0x52, 0x74, 0xce, 0x3a, 0x07, 0x2d, 0x22,
+        0x81, 0x12, 0x6c, 0x03, 0xf7, 0xbd, 0x81, 0x93, 0x84, 0x07, 0x2d, 0x22, 0x83, 0x8e, 0x2a,
+        0x12, 0x6c, 0x90, 0x53, 0x0a, 0x2d, 0x22, 0x81, 0x75, 0x14, 0x0b, 0x3f, 0x07, 0x82, 0x7c,
+        0x06, 0x8e, 0x1a, 0x32, 0x2d, 0x22, 0x86, 0x6d, 0x2a, 0xd4, 0x8c, 0x18, 0xc6, 0x96, 0xa5,
+        0xf2, 0x6b, 0x8e, 0x2a, 0x05, 0x2d, 0x22, 0x81, 0x12, 0x6c, 0x03, 0xf7, 0xbd, 0x81, 0x93,
+        0x84, 0x05, 0x2d, 0x22, 0x86, 0x4d, 0x22, 0x91, 0x5b, 0x55, 0x9d, 0x18, 0xc6, 0x35, 0x9d,
+        0xae, 0x32, 0x09, 0x2d, 0x22, 0x81, 0x54, 0x14, 0x0b, 0x3f, 0x07, 0x82, 0x3b, 0x06, 0x8e,
+        0x1a, 0x32, 0x2d, 0x22, 0x81, 0xb1, 0x5b, 0x03, 0xf7, 0xbd, 0x84, 0x18, 0xc6, 0x15, 0x9d,
+        0x70, 0x53, 0x4d, 0x22, 0x03, 0x2d, 0x22, 0x81, 0x12, 0x6c, 0x03, 0xf7, 0xbd, 0x81, 0x93,
+        0x84, 0x03, 0x2d, 0x22, 0x83, 0x4d, 0x22, 0x30, 0x4b, 0xf4, 0x8c, 0x04, 0xf7, 0xbd, 0x81,
+        0x12, 0x74, 0x09, 0x2d, 0x22, 0x82, 0x51, 0x1b, 0xdd, 0x06, 0x0a, 0x3f, 0x07, 0x82, 0x38,
+        0x0d, 0x4d, 0x1a, 0x32, 0x2d, 0x22, 0x81, 0x93, 0x84, 0x05, 0xf7, 0xbd, 0x83, 0xd7, 0xb5,
+        0xb3, 0x84, 0x0f, 0x43, 0x02, 0x2d, 0x22, 0x81, 0x12, 0x6c, 0x03, 0xf7, 0xbd, 0x81, 0x93,
+        0x84, 0x02, 0x2d, 0x22, 0x83, 0xce, 0x3a, 0x73, 0x7c, 0xb6, 0xb5, 0x05, 0xf7, 0xbd, 0x82,
+        0xd4, 0x94, 0x6d, 0x2a, 0x08, 0x2d, 0x22, 0x82, 0x6e, 0x1a, 0xb9, 0x0d, 0x09, 0x3f, 0x07,
+        0x82, 0xde, 0x06, 0xd3, 0x13, 0x33, 0x2d, 0x22, 0x83, 0x8e, 0x32, 0xf1, 0x6b, 0x76, 0xad,
+        0x05, 0xf7, 0xbd, 0x84, 0x96, 0xad, 0x32, 0x74, 0x8e, 0x2a, 0x12, 0x6c, 0x03, 0xf7, 0xbd,
+        0x84, 0x93, 0x84, 0x8e, 0x2a, 0xf1, 0x63, 0x76, 0xa5, 0x05, 0xf7, 0xbd, 0x83, 0x96, 0xad,
+        0x32, 0x74, 0xce, 0x3a, 0x0a, 0x2d, 0x22, 0x82, 0x72, 0x13, 0x9d, 0x06, 0x08, 0x3f, 0x07,
+        0x82, 0x58, 0x0d, 0x6e, 0x1a, 0x35, 0x2d, 0x22, 0x83, 0xee, 0x3a, 0x52, 0x7c, 0x96, 0xad,
+        0x05, 0xf7, 0xbd, 0x02, 0x35, 0x9d, 0x03, 0xf7, 0xbd, 0x82, 0x76, 0xa5, 0x35, 0x9d, 0x05,
+        0xf7, 0xbd, 0x83, 0xb6, 0xb5, 0x93, 0x8c, 0x0f, 0x4b, 0x0d, 0x2d, 0x22, 0x82, 0xd3, 0x13,
+        0x7c, 0x06, 0x05, 0x3f, 0x07, 0x83, 0xde, 0x06, 0x58, 0x0d, 0xaf, 0x1a, 0x38, 0x2d, 0x22,
+        0x83, 0x2f, 0x4b, 0xb4, 0x8c, 0xb6, 0xb5, 0x0e, 0xf7, 0xbd, 0x83, 0xf4, 0x94, 0x70, 0x53,
+        0x4d, 0x2a, 0x0f, 0x2d, 0x22, 0x88, 0xf0, 0x1a, 0xb6, 0x0c, 0xfb, 0x05, 0x7d, 0x06, 0x7c,
+        0x06, 0x38, 0x0d, 0xd3, 0x13, 0x6e, 0x1a, 0x3a, 0x2d, 0x22, 0x83, 0x4d, 0x2a, 0xb0, 0x5b,
+        0x15, 0x9d, 0x0b, 0xf7, 0xbd, 0x83, 0x55, 0xa5, 0xf1, 0x6b, 0x8e, 0x32, 0x13, 0x2d, 0x22,
+        0x84, 0x8e, 0x1a, 0xcf, 0x1a, 0xaf, 0x1a, 0x4d, 0x1a, 0x3e, 0x2d, 0x22, 0x83, 0x8e, 0x32,
+        0x12, 0x74, 0x96, 0xad, 0x07, 0xf7, 0xbd, 0x83, 0xb6, 0xad, 0x52, 0x7c, 0xce, 0x3a, 0x58,
+        0x2d, 0x22, 0x82, 0x70, 0x53, 0x76, 0xa5, 0x07, 0xf7, 0xbd, 0x83, 0x96, 0xad, 0xb1, 0x5b,
+        0x4d, 0x22, 0x56, 0x2d, 0x22, 0x83, 0xef, 0x3a, 0xb3, 0x84, 0xd7, 0xb5, 0x0a, 0xf7, 0xbd,
+        0x82, 0xd4, 0x8c, 0x30, 0x4b, 0x53, 0x2d, 0x22, 0x83, 0xae, 0x32, 0x32, 0x74, 0x96, 0xad,
+        0x0d, 0xf7, 0xbd, 0x83, 0xb6, 0xb5, 0x73, 0x7c, 0xce, 0x3a, 0x13, 0x2d, 0x22, 0x02, 0x4d,
+        0x22, 0x3a, 0x2d, 0x22, 0x84, 0x6d, 0x2a, 0xb1, 0x5b, 0x55, 0xa5, 0x18, 0xc6, 0x04, 0xf7,
+        0xbd, 0x82, 0x96, 0xad, 0x76, 0xad, 0x03, 0xf7, 0xbd, 0x82, 0x96, 0xad, 0x76, 0xad, 0x05,
+        0xf7, 0xbd, 0x83, 0x76, 0xa5, 0x12, 0x6c, 0x8e, 0x2a, 0x10, 0x2d, 0x22, 0x04, 0x4d, 0x22,
+        0x37, 0x2d, 0x22, 0x83, 0x4d, 0x22, 0x50, 0x4b, 0xd4, 0x8c, 0x06, 0xf7, 0xbd, 0x83, 0xd4,
+        0x94, 0x2f, 0x4b, 0x12, 0x74, 0x03, 0xf7, 0xbd, 0x84, 0x93, 0x84, 0x0f, 0x43, 0x93, 0x84,
+        0xb6, 0xb5, 0x05, 0xf7, 0xbd, 0x83, 0x35, 0x9d, 0x90, 0x53, 0x4d, 0x22, 0x0c, 0x2d, 0x22,
+        0x83, 0x4d, 0x22, 0xf1, 0x63, 0x93, 0x84, 0x03, 0x73, 0x7c, 0x81, 0xef, 0x3a, 0x35, 0x2d,
+        0x22, 0x83, 0x4d, 0x22, 0x52, 0x74, 0xd7, 0xb5, 0x05, 0xf7, 0xbd, 0x85, 0x35, 0xa5, 0xb0,
+        0x5b, 0x6d, 0x2a, 0x2d, 0x22, 0x12, 0x6c, 0x03, 0xf7, 0xbd, 0x86, 0x93, 0x84, 0x2d, 0x22,
+        0x4d, 0x2a, 0x70, 0x53, 0xf4, 0x94, 0xd7, 0xbd, 0x05, 0xf7, 0xbd, 0x82, 0x93, 0x84, 0x8e,
+        0x2a, 0x0a, 0x2d, 0x22, 0x82, 0x4d, 0x22, 0x32, 0x74, 0x05, 0xf7, 0xbd, 0x82, 0x35, 0x9d,
+        0x0f, 0x43, 0x35, 0x2d, 0x22, 0x81, 0xf2, 0x6b, 0x04, 0xf7, 0xbd, 0x83, 0x76, 0xad, 0x12,
+        0x74, 0xae, 0x32, 0x03, 0x2d, 0x22, 0x81, 0x12, 0x6c, 0x03, 0xf7, 0xbd, 0x81, 0x93, 0x84,
+        0x03, 0x2d, 0x22, 0x83, 0x8e, 0x32, 0xd1, 0x63, 0x55, 0xa5, 0x04, 0xf7, 0xbd, 0x81, 0x73,
+        0x7c, 0x0a, 0x2d, 0x22, 0x82, 0x4d, 0x22, 0x32, 0x74, 0x07, 0xf7, 0xbd, 0x82, 0x35, 0x9d,
+        0x0f, 0x43, 0x1a, 0x2d, 0x22, 0x1a, 0x0d, 0x22, 0x86, 0x6e, 0x32, 0x15, 0x9d, 0xf7, 0xbd,
+        0xb6, 0xb5, 0x73, 0x84, 0xef, 0x42, 0x05, 0x0d, 0x22, 0x81, 0xf2, 0x6b, 0x03, 0xf7, 0xbd,
+        0x81, 0x93, 0x84, 0x05, 0x0d, 0x22, 0x86, 0xae, 0x3a, 0x32, 0x74, 0x96, 0xad, 0xf7, 0xbd,
+        0x55, 0xa5, 0xae, 0x3a, 0x0a, 0x0d, 0x22, 0x81, 0x70, 0x53, 0x09, 0xf7, 0xbd, 0x82, 0xf4,
+        0x94, 0x4d, 0x2a, 0x34, 0x0d, 0x22, 0x83, 0x50, 0x53, 0xb3, 0x8c, 0x50, 0x53, 0x07, 0x0d,
+        0x22, 0x81, 0xf2, 0x6b, 0x03, 0xf7, 0xbd, 0x81, 0x93, 0x84, 0x07, 0x0d, 0x22, 0x83, 0x0f,
+        0x4b, 0x93, 0x84, 0xd1, 0x6b, 0x0a, 0x0d, 0x22, 0x82, 0x2d, 0x22, 0xf2, 0x6b, 0x09, 0xf7,
+        0xbd, 0x83, 0x55, 0xa5, 0x8e, 0x32, 0x2d, 0x22, 0x34, 0x0d, 0x22, 0x81, 0x2d, 0x2a, 0x08,
+        0x0d, 0x22, 0x81, 0xf2, 0x6b, 0x03, 0xf7, 0xbd, 0x81, 0x93, 0x84, 0x08, 0x0d, 0x22, 0x02,
+        0x2d, 0x2a, 0x0b, 0x0d, 0x22, 0x81, 0xb1, 0x63, 0x09, 0xf7, 0xbd, 0x82, 0x35, 0x9d, 0x4d,
+        0x2a, 0x3e, 0x0d, 0x22, 0x81, 0xf2, 0x6b, 0x03, 0xf7, 0xbd, 0x81, 0x93, 0x84, 0x15, 0x0d,
+        0x22, 0x81, 0xb1, 0x63, 0x09, 0xf7, 0xbd, 0x82, 0x55, 0xa5, 0x4d, 0x2a, 0x3e, 0x0d, 0x22,
+        0x81, 0xf2, 0x6b, 0x03, 0xf7, 0xbd, 0x81, 0x93, 0x84, 0x15, 0x0d, 0x22, 0x82, 0x50, 0x53,
+        0xb6, 0xb5, 0x08, 0xf7, 0xbd, 0x82, 0xd4, 0x94, 0x2d, 0x22, 0x3e, 0x0d, 0x22, 0x81, 0xf2,
+        0x6b, 0x03, 0xf7, 0xbd, 0x81, 0x93, 0x84, 0x15, 0x0d, 0x22, 0x83, 0x2d, 0x2a, 0x12, 0x74,
+        0xb6, 0xb5, 0x06, 0xf7, 0xbd, 0x82, 0x35, 0xa5, 0xef, 0x42, 0x3f, 0x0d, 0x22, 0x81, 0xf2,
+        0x6b, 0x03, 0xf7, 0xbd, 0x81, 0x93, 0x84, 0x16, 0x0d, 0x22, 0x83, 0x2d, 0x2a, 0x12, 0x74,
+        0xb6, 0xb5, 0x04, 0xf7, 0xbd, 0x82, 0x35, 0xa5, 0xef, 0x42, 0x40, 0x0d, 0x22, 0x85, 0x50,
+        0x53, 0xb3, 0x8c, 0x93, 0x84, 0xb3, 0x8c, 0xb1, 0x63, 0x17, 0x0d, 0x22, 0x83, 0x2d, 0x2a,
+        0xd1, 0x6b, 0x93, 0x8c, 0x02, 0xb3, 0x8c, 0x82, 0x72, 0x7c, 0xef, 0x42, 0x1c, 0x0d, 0x22,
+        0x43, 0x0c, 0x22, 0x04, 0x0b, 0x22, 0x61, 0x0c, 0x22, 0x81, 0xeb, 0x21, 0x7f, 0x0c, 0x22,
+        0x7f, 0x0c, 0x22, 0x7f, 0x0c, 0x22, 0x32, 0x0c, 0x22,
+
+};
+
+const lv_image_dsc_t image_wintry_mix_rain_snow_opaque = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.flags = 0 | LV_IMAGE_FLAGS_COMPRESSED,
+    .header.w = 100,
+    .header.h = 100,
+    .header.stride = 200,
+    .header.reserved_2 = 0,
+    .data_size = sizeof(image_wintry_mix_rain_snow_opaque_map),
+    .data = image_wintry_mix_rain_snow_opaque_map,
+    .reserved = NULL,
+};
@@ -5,12 +5,11 @@
 Display* Display::instance = nullptr;
 
 // Static buffer definitions - placed in fast internal SRAM
-lv_color_t Display::draw_buf_1[Display::BUFFER_SIZE] DMA_ATTR;
-lv_color_t Display::draw_buf_2[Display::BUFFER_SIZE] DMA_ATTR;
+alignas(LV_DRAW_BUF_ALIGN) uint8_t Display::draw_buf_1[Display::BUFFER_BYTES] DMA_ATTR;
+alignas(LV_DRAW_BUF_ALIGN) uint8_t Display::draw_buf_2[Display::BUFFER_BYTES] DMA_ATTR;
 
-Display::Display() : 
-    touchscreenSPI(VSPI),
-    touchscreen(XPT2046_CS, XPT2046_IRQ),
+Display::Display(DisplayBackend& backend) :
+    backend(backend),
     display(nullptr),
     indev(nullptr) {
     instance = this;
@@ -24,15 +23,12 @@ bool Display::init() {
     LOG_FUNCTION_ENTRY(TAG_DISPLAY);
     LOG_DISPLAY_I("Starting display initialization...");
     
-    // Initialize TFT display
-    tft.init();
-    tft.setRotation(0);
-    tft.fillScreen(TFT_BLACK);
-    LOG_DISPLAY_I("TFT display initialized successfully");
-    
-    // Setup touchscreen
-    setupTouchscreen();
-    LOG_DISPLAY_I("Touchscreen setup completed");
+    // Bring up the panel and touch controller
+    if (!backend.begin()) {
+        LOG_DISPLAY_E("Display backend %s failed to start", backend.name());
+        return false;
+    }
+    LOG_DISPLAY_I("Display backend: %s", backend.name());
     
     // Setup LVGL
     setupLVGL();
@@ -47,12 +43,6 @@ bool Display::init() {
     return true;
 }
 
-void Display::setupTouchscreen() {
-    touchscreenSPI.begin(XPT2046_CLK, XPT2046_MISO, XPT2046_MOSI, XPT2046_CS);
-    touchscreen.begin(touchscreenSPI);
-    touchscreen.setRotation(0);
-}
-
 void Display::setupLVGL() {
     LOG_FUNCTION_ENTRY(TAG_DISPLAY);
     
@@ -69,14 +59,20 @@ void Display::setupLVGL() {
     LOG_DISPLAY_I("LVGL display created: %dx%d", SCREEN_WIDTH, SCREEN_HEIGHT);
     
     // Setup optimized display buffers using double buffering for better performance
-    // Buffer size in pixels (LVGL will handle color depth internally)
-    size_t buffer_size_pixels = BUFFER_SIZE;
-    lv_display_set_buffers(display, draw_buf_1, draw_buf_2, buffer_size_pixels, LV_DISPLAY_RENDER_MODE_PARTIAL);
-    LOG_DISPLAY_I("LVGL buffers configured: %d pixels per buffer (double buffered)", buffer_size_pixels);
+    // Buffer size in bytes, so each band is BUFFER_LINES lines of RGB565
+    lv_display_set_buffers(display, draw_buf_1, draw_buf_2, BUFFER_BYTES, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    LOG_DISPLAY_I("LVGL buffers configured: %u bytes, %d lines per buffer (double buffered)",
+                  (unsigned) BUFFER_BYTES, BUFFER_LINES);
     
     // Set display flush callback
     lv_display_set_flush_cb(display, disp_flush_cb);
+    // Called when LVGL needs a buffer back that the backend is still sending
+    lv_display_set_flush_wait_cb(display, flush_wait_cb);
     LOG_DISPLAY_D("LVGL flush callback registered");
+
+    // Let the backend time each refresh from start to finish
+    lv_display_add_event_cb(display, refresh_event_cb, LV_EVENT_REFR_START, nullptr);
+    lv_display_add_event_cb(display, refresh_event_cb, LV_EVENT_REFR_READY, nullptr);
     
     // Setup input device (touchscreen) using new API
     indev = lv_indev_create();
@@ -98,9 +94,6 @@ void Display::flush(const lv_area_t *area, uint8_t *color_p) {
         return;
     }
     
-    uint32_t w = (area->x2 - area->x1 + 1);
-    uint32_t h = (area->y2 - area->y1 + 1);
-    
     // Validate area bounds
     if (area->x1 < 0 || area->y1 < 0 || area->x2 >= SCREEN_WIDTH || area->y2 >= SCREEN_HEIGHT) {
         LOG_DISPLAY_W("Invalid display area: (%d,%d) to (%d,%d)", 
@@ -109,19 +102,19 @@ void Display::flush(const lv_area_t *area, uint8_t *color_p) {
         return;
     }
     
-    // LVGL flush callback - optimized drawing to TFT
-    tft.startWrite();
-    tft.setAddrWindow(area->x1, area->y1, w, h);
-    
-    // LVGL 9.x with 16-bit color depth sends RGB565 data
-    // Cast uint8_t* to uint16_t* for RGB565 format
-    uint16_t* pixel_data = (uint16_t*)color_p;
-    tft.pushColors(pixel_data, w * h, true);
-    
-    tft.endWrite();
-    
-    // Signal to LVGL that flushing is complete
-    lv_display_flush_ready(display);
+    // LVGL 9.x with 16-bit color depth sends little-endian RGB565. LVGL
+    // 9.2 cannot render big-endian itself, so a backend that wants panel
+    // byte order gets the band swapped here, two pixels per word, while it
+    // is still in cache.
+    if (backend.panelByteOrder()) {
+        lv_draw_sw_rgb565_swap(color_p, lv_area_get_size(area));
+    }
+
+    // A backend that is still sending the band is waited for in
+    // flush_wait_cb instead
+    if (backend.flush(*area, (const uint16_t*)color_p)) {
+        lv_display_flush_ready(display);
+    }
 }
 
 void Display::touchRead(lv_indev_data_t *data) {
@@ -130,32 +123,16 @@ void Display::touchRead(lv_indev_data_t *data) {
         return;
     }
     
-    if (touchscreen.touched()) {
-        TS_Point p = touchscreen.getPoint();
-        
-        // Map touch coordinates to screen coordinates with bounds checking
-        int x = map(p.x, 200, 3700, 0, SCREEN_WIDTH - 1);
-        int y = map(p.y, 240, 3800, 0, SCREEN_HEIGHT - 1);
-        
-        // Clamp values to screen bounds
-        x = constrain(x, 0, SCREEN_WIDTH - 1);
-        y = constrain(y, 0, SCREEN_HEIGHT - 1);
-        
-        data->state = LV_INDEV_STATE_PR;
-        data->point.x = x;
-        data->point.y = y;
-        
-        // DEBUG: Log every touch detection
-        LOG_DISPLAY_I("TOUCH DETECTED: Raw(%d,%d) -> Screen(%d,%d)", p.x, p.y, x, y);
-    } else {
-        data->state = LV_INDEV_STATE_REL;
-        data->point.x = 0;
-        data->point.y = 0;
-    }
+    // Only drains queued events; the backend samples the panel on its own
+    TouchEvent event;
+    data->continue_reading = backend.readTouch(event);
+    data->state = event.pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+    data->point.x = event.x;
+    data->point.y = event.y;
 }
 
 void Display::setBacklight(uint8_t brightness) {
-    analogWrite(LCD_BACKLIGHT_PIN, brightness);
+    backend.setBacklight(brightness);
 }
 
 void Display::task() {
@@ -174,7 +151,15 @@ void Display::disp_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *
     }
 }
 
+void Display::flush_wait_cb(lv_display_t *disp) {
+    if (instance) {
+        instance->backend.waitFlush();
+    }
+    lv_display_flush_ready(disp);
+}
+
 void Display::touch_read_cb(lv_indev_t *indev, lv_indev_data_t *data) {
+    LV_UNUSED(indev);
     if (instance) {
         instance->touchRead(data);
     } else {
@@ -186,4 +171,15 @@ void Display::touch_read_cb(lv_indev_t *indev, lv_indev_data_t *data) {
             data->point.y = 0;
         }
     }
-} 
\ No newline at end of file
+} 
+
+void Display::refresh_event_cb(lv_event_t *e) {
+    if (!instance) {
+        return;
+    }
+    if (lv_event_get_code(e) == LV_EVENT_REFR_START) {
+        instance->backend.frameStarted();
+    } else {
+        instance->backend.frameFinished();
+    }
+}
\ No newline at end of file
@@ -2,60 +2,58 @@
 #define DISPLAY_H
 
 #include "../../config.h"
-#include <TFT_eSPI.h>
-#include <XPT2046_Touchscreen.h>
+#include "display_backend.h"
 #include <lvgl.h>
 
 class Display {
 public:
-    Display();
+    explicit Display(DisplayBackend& backend);
     ~Display();
-    
+
     // Initialization
     bool init();
-    void setupTouchscreen();
     void setupLVGL();
-    
+
     // Display management
     void flush(const lv_area_t *area, uint8_t *color_p);
     void touchRead(lv_indev_data_t *data);
     void setBacklight(uint8_t brightness);
-    
+
     // Task handling
     void task();
-    
+
     // Getters
-    TFT_eSPI& getTFT() { return tft; }
-    XPT2046_Touchscreen& getTouchscreen() { return touchscreen; }
+    DisplayBackend& getBackend() { return backend; }
     lv_display_t* getDisplay() { return display; }
-    
+
 private:
-    TFT_eSPI tft;
-    SPIClass touchscreenSPI;
-    XPT2046_Touchscreen touchscreen;
-    
-    // Optimized buffer configuration for ESP32 performance
-    // Use smaller buffers in fast internal SRAM (30 lines worth)
-    static constexpr int BUFFER_LINES = 30;
-    static constexpr int BUFFER_SIZE = SCREEN_WIDTH * BUFFER_LINES;
-    
+    DisplayBackend& backend;
+
+    // Two bands of DISPLAY_BUFFER_LINES lines of RGB565 in fast internal
+    // SRAM. LVGL 9 takes the size in bytes, and lv_color_t is 3 bytes, so
+    // they are plain bytes rather than lv_color_t.
+    static constexpr int BUFFER_LINES = DISPLAY_BUFFER_LINES;
+    static constexpr uint32_t BUFFER_BYTES = SCREEN_WIDTH * BUFFER_LINES * sizeof(uint16_t);
+
     // Define DMA_ATTR if not already defined
     #ifndef DMA_ATTR
     #define DMA_ATTR DRAM_ATTR
     #endif
-    
-    static lv_color_t draw_buf_1[BUFFER_SIZE] DMA_ATTR;
-    static lv_color_t draw_buf_2[BUFFER_SIZE] DMA_ATTR;  // Double buffer for better performance
-    
+
+    alignas(LV_DRAW_BUF_ALIGN) static uint8_t draw_buf_1[BUFFER_BYTES] DMA_ATTR;
+    alignas(LV_DRAW_BUF_ALIGN) static uint8_t draw_buf_2[BUFFER_BYTES] DMA_ATTR;
+
     lv_display_t* display;
     lv_indev_t* indev;
-    
+
     // Static callback functions for LVGL
     static void disp_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *color_p);
+    static void flush_wait_cb(lv_display_t *disp);
     static void touch_read_cb(lv_indev_t *indev, lv_indev_data_t *data);
-    
+    static void refresh_event_cb(lv_event_t *e);
+
     // Static instance pointer for callbacks
     static Display* instance;
 };
 
-#endif // DISPLAY_H 
\ No newline at end of file
+#endif // DISPLAY_H
\ No newline at end of file
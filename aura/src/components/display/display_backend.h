@@ -0,0 +1,47 @@
+#ifndef DISPLAY_BACKEND_H
+#define DISPLAY_BACKEND_H
+
+#include "../../config.h"
+#include "touch_input.h"
+#include <lvgl.h>
+
+// Where Display sends the pixels LVGL renders and reads touches from. The
+// firmware uses TftBackend; FramebufferBackend keeps the screen in memory so
+// the UI can run headless on Linux.
+class DisplayBackend {
+public:
+    virtual ~DisplayBackend() {}
+
+    virtual const char* name() const = 0;
+
+    // Brings up the panel and touch controller, before LVGL starts
+    virtual bool begin() = 0;
+
+    // LVGL is about to redraw / has finished redrawing the dirty areas of
+    // one frame. Called for every refresh, even when nothing was drawn.
+    virtual void frameStarted() {}
+    virtual void frameFinished() {}
+
+    // True if flush() takes big-endian RGB565, the order the panel reads off
+    // the SPI bus; Display then swaps each band once, in place, before
+    // handing it over
+    virtual bool panelByteOrder() const { return false; }
+
+    // One rendered area of RGB565 pixels, row by row; the area is inside the
+    // screen. Returns true once the pixels are no longer needed, or false if
+    // they are still being sent, in which case waitFlush() must be called
+    // before the buffer is drawn into again.
+    virtual bool flush(const lv_area_t& area, const uint16_t* pixels) = 0;
+    virtual void waitFlush() {}
+
+    // The touch state for one LVGL pointer read, in screen coordinates.
+    // Returns true if more events are queued and should be read at once.
+    virtual bool readTouch(TouchEvent& event) = 0;
+
+    virtual void setBacklight(uint8_t brightness) = 0;
+
+    // Flush counters to the log, for the display_stats serial command
+    virtual void logStats() const {}
+};
+
+#endif // DISPLAY_BACKEND_H
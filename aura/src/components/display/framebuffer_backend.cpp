@@ -0,0 +1,246 @@
+#include "framebuffer_backend.h"
+#include "../logging/logging.h"
+#include <stdio.h>
+
+static const size_t FRAMEBUFFER_PIXELS = (size_t) SCREEN_WIDTH * SCREEN_HEIGHT;
+static const size_t RGB_ROW_BYTES = SCREEN_WIDTH * 3;
+
+// Deflate stored blocks hold at most this many bytes each
+static const size_t PNG_STORED_BLOCK = 65535;
+
+// Bitwise CRC-32 as used by PNG chunks; a table is not worth the flash here
+static uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t length) {
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+// Writes a PNG chunk's body piece by piece while keeping its CRC
+struct PngChunk {
+    FILE* file;
+    uint32_t crc;
+    bool ok;
+
+    void write(const uint8_t* data, size_t length) {
+        crc = crc32Update(crc, data, length);
+        ok = ok && fwrite(data, 1, length, file) == length;
+    }
+    void writeU32(uint32_t value) {
+        uint8_t bytes[4] = {(uint8_t) (value >> 24), (uint8_t) (value >> 16),
+                            (uint8_t) (value >> 8), (uint8_t) value};
+        write(bytes, sizeof(bytes));
+    }
+};
+
+static void writeU32(FILE* file, uint32_t value) {
+    uint8_t bytes[4] = {(uint8_t) (value >> 24), (uint8_t) (value >> 16), (uint8_t) (value >> 8),
+                        (uint8_t) value};
+    fwrite(bytes, 1, sizeof(bytes), file);
+}
+
+static PngChunk beginChunk(FILE* file, const char* type, uint32_t length) {
+    writeU32(file, length);
+    PngChunk chunk = {file, 0, true};
+    chunk.write((const uint8_t*) type, 4);
+    return chunk;
+}
+
+static bool endChunk(PngChunk& chunk) {
+    writeU32(chunk.file, chunk.crc);
+    return chunk.ok;
+}
+
+FramebufferBackend::FramebufferBackend() :
+    pixels_(nullptr),
+    stats_(),
+    frame_started_us_(0),
+    frame_pixels_(0),
+    touch_(),
+    panel_byte_order_(false),
+    backlight_(0) {
+}
+
+FramebufferBackend::~FramebufferBackend() {
+    free(pixels_);
+}
+
+bool FramebufferBackend::begin() {
+    if (!pixels_) {
+        pixels_ = (uint16_t*) malloc(FRAMEBUFFER_PIXELS * sizeof(uint16_t));
+        if (!pixels_) {
+            LOG_DISPLAY_E("Failed to allocate %u byte framebuffer",
+                          (unsigned) (FRAMEBUFFER_PIXELS * sizeof(uint16_t)));
+            return false;
+        }
+    }
+    // Black, as the TFT is cleared to before LVGL draws
+    memset(pixels_, 0, FRAMEBUFFER_PIXELS * sizeof(uint16_t));
+    resetStats();
+    LOG_DISPLAY_I("Framebuffer backend ready: %dx%d RGB565", SCREEN_WIDTH, SCREEN_HEIGHT);
+    return true;
+}
+
+void FramebufferBackend::resetStats() {
+    stats_ = {};
+    frame_pixels_ = 0;
+}
+
+void FramebufferBackend::frameStarted() {
+    frame_started_us_ = micros();
+    frame_pixels_ = 0;
+}
+
+void FramebufferBackend::frameFinished() {
+    if (frame_pixels_ == 0) {
+        return;
+    }
+    uint32_t elapsed = micros() - frame_started_us_;
+    stats_.frames++;
+    stats_.pixels += frame_pixels_;
+    stats_.total_us += elapsed;
+    stats_.last_frame_pixels = frame_pixels_;
+    stats_.last_frame_us = elapsed;
+    stats_.max_frame_pixels = max(stats_.max_frame_pixels, frame_pixels_);
+    stats_.max_frame_us = max(stats_.max_frame_us, elapsed);
+    frame_pixels_ = 0;
+}
+
+bool FramebufferBackend::flush(const lv_area_t& area, const uint16_t* pixels) {
+    if (!pixels_) {
+        return true;
+    }
+    int w = area.x2 - area.x1 + 1;
+    for (int y = area.y1; y <= area.y2; y++) {
+        memcpy(&pixels_[y * SCREEN_WIDTH + area.x1], pixels, w * sizeof(uint16_t));
+        pixels += w;
+    }
+    stats_.flushes++;
+    frame_pixels_ += w * (area.y2 - area.y1 + 1);
+    return true;
+}
+
+void FramebufferBackend::logStats() const {
+    LOG_DISPLAY_I("Framebuffer: %u frames, %u flushes, %lu pixels/frame, %lu us/frame",
+                  stats_.frames, stats_.flushes,
+                  (unsigned long) (stats_.frames ? stats_.pixels / stats_.frames : 0),
+                  (unsigned long) (stats_.frames ? stats_.total_us / stats_.frames : 0));
+}
+
+bool FramebufferBackend::readTouch(TouchEvent& event) {
+    return touches_.read(event);
+}
+
+void FramebufferBackend::press(int16_t x, int16_t y) {
+    touch_.x = constrain(x, 0, SCREEN_WIDTH - 1);
+    touch_.y = constrain(y, 0, SCREEN_HEIGHT - 1);
+    touch_.pressed = true;
+    touches_.push(touch_);
+}
+
+void FramebufferBackend::release() {
+    if (touch_.pressed) {
+        touch_.pressed = false;
+        touches_.push(touch_);
+    }
+}
+
+void FramebufferBackend::rowToRgb(int y, uint8_t* rgb) const {
+    for (int x = 0; x < SCREEN_WIDTH; x++) {
+        uint16_t c = pixel(x, y);
+        uint8_t r = (c >> 11) & 0x1F;
+        uint8_t g = (c >> 5) & 0x3F;
+        uint8_t b = c & 0x1F;
+        *rgb++ = (r << 3) | (r >> 2);
+        *rgb++ = (g << 2) | (g >> 4);
+        *rgb++ = (b << 3) | (b >> 2);
+    }
+}
+
+bool FramebufferBackend::savePpm(const char* path) const {
+    if (!pixels_) {
+        return false;
+    }
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        LOG_DISPLAY_E("Cannot write %s", path);
+        return false;
+    }
+    bool ok = fprintf(file, "P6\n%d %d\n255\n", SCREEN_WIDTH, SCREEN_HEIGHT) > 0;
+    uint8_t rgb[RGB_ROW_BYTES];
+    for (int y = 0; ok && y < SCREEN_HEIGHT; y++) {
+        rowToRgb(y, rgb);
+        ok = fwrite(rgb, 1, sizeof(rgb), file) == sizeof(rgb);
+    }
+    ok = fclose(file) == 0 && ok;
+    return ok;
+}
+
+bool FramebufferBackend::savePng(const char* path) const {
+    if (!pixels_) {
+        return false;
+    }
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        LOG_DISPLAY_E("Cannot write %s", path);
+        return false;
+    }
+    static const uint8_t SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    bool ok = fwrite(SIGNATURE, 1, sizeof(SIGNATURE), file) == sizeof(SIGNATURE);
+
+    // 8-bit truecolour, no interlacing
+    PngChunk header = beginChunk(file, "IHDR", 13);
+    header.writeU32(SCREEN_WIDTH);
+    header.writeU32(SCREEN_HEIGHT);
+    static const uint8_t FORMAT[5] = {8, 2, 0, 0, 0};
+    header.write(FORMAT, sizeof(FORMAT));
+    ok = endChunk(header) && ok;
+
+    // Each row is a filter type byte (0, none) and its pixels. The zlib
+    // stream is its header, the rows split into stored blocks and an Adler-32.
+    const size_t raw_size = (1 + RGB_ROW_BYTES) * SCREEN_HEIGHT;
+    const size_t blocks = (raw_size + PNG_STORED_BLOCK - 1) / PNG_STORED_BLOCK;
+    PngChunk data = beginChunk(file, "IDAT", 2 + blocks * 5 + raw_size + 4);
+    static const uint8_t ZLIB_HEADER[2] = {0x78, 0x01};
+    data.write(ZLIB_HEADER, sizeof(ZLIB_HEADER));
+
+    uint8_t row[1 + RGB_ROW_BYTES];
+    size_t row_used = sizeof(row);  // Nothing buffered yet
+    int y = 0;
+    uint32_t adler_a = 1;
+    uint32_t adler_b = 0;
+    for (size_t remaining = raw_size; remaining > 0;) {
+        size_t block = min(remaining, PNG_STORED_BLOCK);
+        remaining -= block;
+        uint8_t block_header[5] = {(uint8_t) (remaining == 0 ? 1 : 0), (uint8_t) block,
+                                   (uint8_t) (block >> 8), (uint8_t) ~block,
+                                   (uint8_t) (~block >> 8)};
+        data.write(block_header, sizeof(block_header));
+        while (block > 0) {
+            if (row_used == sizeof(row)) {
+                row[0] = 0;
+                rowToRgb(y++, row + 1);
+                row_used = 0;
+            }
+            size_t piece = min(block, sizeof(row) - row_used);
+            for (size_t i = 0; i < piece; i++) {
+                adler_a = (adler_a + row[row_used + i]) % 65521;
+                adler_b = (adler_b + adler_a) % 65521;
+            }
+            data.write(row + row_used, piece);
+            row_used += piece;
+            block -= piece;
+        }
+    }
+    data.writeU32((adler_b << 16) | adler_a);
+    ok = endChunk(data) && ok;
+
+    PngChunk end = beginChunk(file, "IEND", 0);
+    ok = endChunk(end) && ok;
+    ok = fclose(file) == 0 && ok;
+    return ok;
+}
@@ -0,0 +1,82 @@
+#ifndef FRAMEBUFFER_BACKEND_H
+#define FRAMEBUFFER_BACKEND_H
+
+#include "display_backend.h"
+#include <Arduino.h>
+
+// Counters since begin() or the last resetStats(). A frame is one LVGL
+// refresh that flushed at least one pixel; empty refreshes are not counted.
+struct FramebufferStats {
+    uint32_t frames;
+    uint32_t flushes;
+    uint64_t pixels;
+    uint64_t total_us;            // frameStarted() to frameFinished(), over all frames
+    uint32_t last_frame_pixels;
+    uint32_t last_frame_us;
+    uint32_t max_frame_pixels;
+    uint32_t max_frame_us;
+};
+
+// Keeps the whole screen as RGB565 in memory instead of driving a panel, so
+// the real UI code can render headless (see `make bench/ui`). Touches are
+// scripted with press()/release() and frames can be saved as PPM or PNG
+// golden images.
+class FramebufferBackend : public DisplayBackend {
+public:
+    FramebufferBackend();
+    ~FramebufferBackend();
+
+    const char* name() const override { return "framebuffer"; }
+    bool begin() override;
+    bool panelByteOrder() const override { return panel_byte_order_; }
+    void frameStarted() override;
+    void frameFinished() override;
+    bool flush(const lv_area_t& area, const uint16_t* pixels) override;
+    bool readTouch(TouchEvent& event) override;
+    void setBacklight(uint8_t brightness) override { backlight_ = brightness; }
+    void logStats() const override;
+
+    // Take pixels big-endian, as TftBackend does. They are stored as
+    // received, so pixels() holds the bytes the panel would have been sent;
+    // pixel() and the image files decode either order.
+    void setPanelByteOrder(bool panel) { panel_byte_order_ = panel; }
+
+    // Queues a touch at (x, y), held until release(). Queued like the TFT's
+    // samples, so a press and release between two reads still register.
+    void press(int16_t x, int16_t y);
+    void release();
+
+    const FramebufferStats& stats() const { return stats_; }
+    void resetStats();
+
+    // SCREEN_WIDTH * SCREEN_HEIGHT pixels as flushed, row by row; null before
+    // begin(). The framebuffer is only cleared by begin(), so after a byte
+    // order change the screen should be redrawn in full.
+    const uint16_t* pixels() const { return pixels_; }
+    // Native RGB565 whatever the byte order
+    uint16_t pixel(int x, int y) const {
+        uint16_t c = pixels_[y * SCREEN_WIDTH + x];
+        return panel_byte_order_ ? (uint16_t) (c << 8 | c >> 8) : c;
+    }
+    uint8_t backlight() const { return backlight_; }
+
+    // 8-bit RGB, each channel scaled up from RGB565. PNGs are written with
+    // stored (uncompressed) deflate blocks, so no zlib is needed.
+    bool savePpm(const char* path) const;
+    bool savePng(const char* path) const;
+
+private:
+    uint16_t* pixels_;
+    FramebufferStats stats_;
+    uint32_t frame_started_us_;
+    uint32_t frame_pixels_;
+    uint32_t frame_flushes_;
+    TouchQueue<TOUCH_QUEUE_LENGTH> touches_;
+    TouchEvent touch_;
+    bool panel_byte_order_;
+    uint8_t backlight_;
+
+    void rowToRgb(int y, uint8_t* rgb) const;
+};
+
+#endif // FRAMEBUFFER_BACKEND_H
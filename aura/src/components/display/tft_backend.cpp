@@ -0,0 +1,177 @@
+#include "tft_backend.h"
+#include "../logging/logging.h"
+
+TftBackend::TftBackend() :
+    touchscreenSPI(VSPI),
+    // No IRQ pin for the library: the pen interrupt is handled here instead
+    touchscreen(XPT2046_CS),
+    stats_(),
+    dma_(false),
+    in_flight_(false),
+    touch_filter_(TOUCH_IIR_WEIGHT),
+    touch_task_(nullptr) {
+}
+
+bool TftBackend::begin() {
+    // Initialize TFT display
+    tft.init();
+    tft.setRotation(0);
+    tft.fillScreen(TFT_BLACK);
+    LOG_DISPLAY_I("TFT display initialized successfully");
+
+#if DISPLAY_DMA
+    // pushPixelsDMA() has no swap argument, so a swap it has to do is set here
+    tft.setSwapBytes(!DISPLAY_PANEL_BYTE_ORDER);
+    dma_ = tft.initDMA();
+    LOG_DISPLAY_I("SPI DMA %s", dma_ ? "enabled" : "unavailable, using blocking writes");
+#endif
+
+    // Setup touchscreen
+    touchscreenSPI.begin(XPT2046_CLK, XPT2046_MISO, XPT2046_MOSI, XPT2046_CS);
+    touchscreen.begin(touchscreenSPI);
+    touchscreen.setRotation(0);
+
+    BaseType_t created = xTaskCreatePinnedToCore(touchTaskEntry, "touch", TOUCH_TASK_STACK_SIZE,
+                                                 this, TOUCH_TASK_PRIORITY, &touch_task_,
+                                                 TOUCH_TASK_CORE);
+    if (created != pdPASS) {
+        LOG_DISPLAY_E("Failed to create touch task");
+        touch_task_ = nullptr;
+        return false;
+    }
+    // PENIRQ idles high and is pulled low while the panel is pressed
+    pinMode(XPT2046_IRQ, INPUT);
+    attachInterruptArg(digitalPinToInterrupt(XPT2046_IRQ), penInterrupt, this, FALLING);
+    if (digitalRead(XPT2046_IRQ) == LOW) {
+        xTaskNotifyGive(touch_task_);
+    }
+    LOG_DISPLAY_I("Touchscreen setup completed (pen interrupt on GPIO %d)", XPT2046_IRQ);
+    return true;
+}
+
+bool TftBackend::flush(const lv_area_t& area, const uint16_t* pixels) {
+    uint32_t w = (area.x2 - area.x1 + 1);
+    uint32_t h = (area.y2 - area.y1 + 1);
+    stats_.flushes++;
+    stats_.pixels += w * h;
+
+    // Both paths swap to the panel's byte order unless Display already has
+    // (see panelByteOrder())
+    tft.startWrite();
+    tft.setAddrWindow(area.x1, area.y1, w, h);
+    if (dma_) {
+        // The bus stays claimed until waitFlush(); LVGL has already waited
+        // for the previous band before handing over this one
+        tft.pushPixelsDMA(const_cast<uint16_t*>(pixels), w * h);
+        in_flight_ = true;
+        return false;
+    }
+    tft.pushColors(const_cast<uint16_t*>(pixels), w * h, !DISPLAY_PANEL_BYTE_ORDER);
+    tft.endWrite();
+    return true;
+}
+
+void TftBackend::waitFlush() {
+    if (!in_flight_) {
+        return;
+    }
+    if (tft.dmaBusy()) {
+        uint32_t started = micros();
+        tft.dmaWait();
+        stats_.dma_waits++;
+        stats_.dma_wait_us += micros() - started;
+    }
+    tft.endWrite();
+    in_flight_ = false;
+}
+
+bool TftBackend::readTouch(TouchEvent& event) {
+    return touch_queue_.read(event);
+}
+
+void IRAM_ATTR TftBackend::penInterrupt(void* arg) {
+    TftBackend* backend = static_cast<TftBackend*>(arg);
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(backend->touch_task_, &woken);
+    if (woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+void TftBackend::touchTaskEntry(void* arg) {
+    static_cast<TftBackend*>(arg)->touchLoop();
+}
+
+void TftBackend::touchLoop() {
+    for (;;) {
+        // Pen up: no SPI traffic until PENIRQ falls
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        TouchEvent event = {0, 0, false};
+        touch_filter_.reset();
+        while (sampleTouch(event)) {
+            if (touch_queue_.push(event)) {
+                stats_.touch_events++;
+            }
+            vTaskDelay(pdMS_TO_TICKS(TOUCH_SAMPLE_INTERVAL_MS));
+        }
+
+        // A lost release would leave LVGL pressed, so it waits for room
+        if (event.pressed) {
+            event.pressed = false;
+            while (!touch_queue_.push(event)) {
+                vTaskDelay(pdMS_TO_TICKS(TOUCH_SAMPLE_INTERVAL_MS));
+            }
+            stats_.touch_events++;
+            LOG_DISPLAY_D("Touch up at (%d,%d)", event.x, event.y);
+        }
+
+        // Conversions toggle PENIRQ too, so the edges they caused are
+        // dropped; a pen already back down is picked up from the pin
+        ulTaskNotifyTake(pdTRUE, 0);
+        if (digitalRead(XPT2046_IRQ) == LOW) {
+            xTaskNotifyGive(touch_task_);
+        }
+    }
+}
+
+// One SPI reading. False once the pressure shows the pen has lifted (or the
+// interrupt was spurious, as GPIO 36 can be while WiFi is busy).
+bool TftBackend::sampleTouch(TouchEvent& event) {
+    TS_Point p = touchscreen.getPoint();
+    stats_.touch_reads++;
+    if (p.z < TOUCH_PRESSURE_MIN) {
+        return false;
+    }
+
+    int16_t raw_x, raw_y;
+    touch_filter_.add(p.x, p.y, raw_x, raw_y);
+
+    // Map touch coordinates to screen coordinates with bounds checking
+    int x = map(raw_x, 200, 3700, 0, SCREEN_WIDTH - 1);
+    int y = map(raw_y, 240, 3800, 0, SCREEN_HEIGHT - 1);
+    x = constrain(x, 0, SCREEN_WIDTH - 1);
+    y = constrain(y, 0, SCREEN_HEIGHT - 1);
+
+    if (!event.pressed) {
+        LOG_DISPLAY_D("Touch down: Raw(%d,%d) -> Screen(%d,%d)", p.x, p.y, x, y);
+    }
+    event.x = x;
+    event.y = y;
+    event.pressed = true;
+    return true;
+}
+
+void TftBackend::setBacklight(uint8_t brightness) {
+    analogWrite(LCD_BACKLIGHT_PIN, brightness);
+}
+
+void TftBackend::logStats() const {
+    LOG_DISPLAY_I("TFT flush: %u bands of up to %d lines, %lu pixels, DMA %s; "
+                  "waited on DMA %u times, %lu ms in total",
+                  stats_.flushes, DISPLAY_BUFFER_LINES, (unsigned long) stats_.pixels,
+                  dma_ ? "on" : "off", stats_.dma_waits,
+                  (unsigned long) (stats_.dma_wait_us / 1000));
+    LOG_DISPLAY_I("Touch: %u SPI reads, %u events queued, %u dropped", stats_.touch_reads,
+                  stats_.touch_events, touch_queue_.dropped());
+}
@@ -0,0 +1,63 @@
+#ifndef TFT_BACKEND_H
+#define TFT_BACKEND_H
+
+#include "display_backend.h"
+#include <TFT_eSPI.h>
+#include <XPT2046_Touchscreen.h>
+
+// Since begin(); DMA waits only count the times the transfer was still running
+struct TftBackendStats {
+    uint32_t flushes;
+    uint32_t dma_waits;
+    uint64_t pixels;
+    uint64_t dma_wait_us;
+    uint32_t touch_reads;   // XPT2046 SPI transactions
+    uint32_t touch_events;  // Queued for LVGL
+};
+
+// The CYD's ILI9341 panel through TFT_eSPI, with the XPT2046 resistive touch
+// controller on its own SPI bus. With DISPLAY_DMA, flush() starts an SPI DMA
+// transfer and returns at once, so LVGL renders the next band into its other
+// buffer while this one is sent; waitFlush() blocks only if LVGL catches up.
+//
+// Touch is driven by the XPT2046's pen interrupt: it wakes a task that reads
+// the controller every TOUCH_SAMPLE_INTERVAL_MS until the pen lifts, filters
+// the samples and queues them. LVGL's input read only drains the queue, so
+// idle frames cause no touch SPI traffic at all.
+class TftBackend : public DisplayBackend {
+public:
+    TftBackend();
+
+    const char* name() const override { return "TFT_eSPI"; }
+    bool begin() override;
+    bool panelByteOrder() const override { return DISPLAY_PANEL_BYTE_ORDER; }
+    bool flush(const lv_area_t& area, const uint16_t* pixels) override;
+    void waitFlush() override;
+    bool readTouch(TouchEvent& event) override;
+    void setBacklight(uint8_t brightness) override;
+    void logStats() const override;
+
+    const TftBackendStats& stats() const { return stats_; }
+
+    TFT_eSPI& getTFT() { return tft; }
+    XPT2046_Touchscreen& getTouchscreen() { return touchscreen; }
+
+private:
+    TFT_eSPI tft;
+    SPIClass touchscreenSPI;
+    XPT2046_Touchscreen touchscreen;
+    TftBackendStats stats_;
+    bool dma_;
+    bool in_flight_;
+
+    TouchFilter touch_filter_;
+    TouchQueue<TOUCH_QUEUE_LENGTH> touch_queue_;
+    TaskHandle_t touch_task_;
+
+    static void IRAM_ATTR penInterrupt(void* arg);
+    static void touchTaskEntry(void* arg);
+    void touchLoop();
+    bool sampleTouch(TouchEvent& event);
+};
+
+#endif // TFT_BACKEND_H
@@ -0,0 +1,44 @@
+#include "touch_input.h"
+
+static int16_t median3(int16_t a, int16_t b, int16_t c) {
+    if (a > b) {
+        int16_t t = a;
+        a = b;
+        b = t;
+    }
+    // a <= b now; the median is b unless c is below it
+    if (c < b) {
+        return c > a ? c : a;
+    }
+    return b;
+}
+
+TouchFilter::TouchFilter(uint16_t weight) : weight_(weight), samples_(0), x_(), y_() {}
+
+void TouchFilter::add(int16_t rawX, int16_t rawY, int16_t& x, int16_t& y) {
+    x = filterAxis(x_, rawX);
+    y = filterAxis(y_, rawY);
+    if (samples_ < 3) {
+        samples_++;
+    }
+}
+
+int16_t TouchFilter::filterAxis(Axis& axis, int16_t raw) {
+    // The first sample of a stroke fills the history and the IIR state, so
+    // the output starts where the pen landed
+    if (samples_ == 0) {
+        axis.history[0] = axis.history[1] = axis.history[2] = raw;
+        axis.smoothed = (int32_t) raw * 16;
+        return raw;
+    }
+    axis.history[0] = axis.history[1];
+    axis.history[1] = axis.history[2];
+    axis.history[2] = raw;
+    int32_t median = (int32_t) median3(axis.history[0], axis.history[1], axis.history[2]) * 16;
+    int32_t step = (median - axis.smoothed) * weight_ / 256;
+    // Once the remaining gap is too small to move, land on the median
+    axis.smoothed = step != 0 ? axis.smoothed + step : median;
+    // Round half away from zero, back to whole units
+    int32_t rounded = axis.smoothed >= 0 ? (axis.smoothed + 8) / 16 : (axis.smoothed - 8) / 16;
+    return (int16_t) rounded;
+}
@@ -0,0 +1,98 @@
+#ifndef TOUCH_INPUT_H
+#define TOUCH_INPUT_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// No Arduino or LVGL dependencies, so `make test/touch` builds this on Linux
+
+// One filtered touch sample in screen coordinates; a release carries the
+// last pressed point
+struct TouchEvent {
+    int16_t x;
+    int16_t y;
+    bool pressed;
+};
+
+// Smooths raw touch controller readings while the pen is down: a median of
+// the last three samples drops single-sample spikes, then a first-order IIR
+// takes out jitter. Both axes are filtered independently, in 1/16 units so
+// a steady input comes out exact.
+class TouchFilter {
+public:
+    // weight: share of each new sample in the output, out of 256
+    explicit TouchFilter(uint16_t weight);
+
+    // Call on pen up; the next sample starts a new stroke without lag
+    void reset() { samples_ = 0; }
+    void add(int16_t rawX, int16_t rawY, int16_t& x, int16_t& y);
+
+private:
+    struct Axis {
+        int16_t history[3];
+        int32_t smoothed;
+    };
+
+    uint16_t weight_;
+    uint8_t samples_;
+    Axis x_;
+    Axis y_;
+
+    int16_t filterAxis(Axis& axis, int16_t raw);
+};
+
+// Lock-free single-producer/single-consumer ring of touch events: the touch
+// task pushes, LVGL's input read drains. CAPACITY must be a power of two.
+template <size_t CAPACITY>
+class TouchQueue {
+    static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0,
+                  "TouchQueue capacity must be a power of two");
+
+public:
+    TouchQueue() : head_(0), tail_(0), dropped_(0), last_() {}
+
+    // Producer only. False if the queue is full; the event is not queued
+    // and is counted in dropped().
+    bool push(const TouchEvent& event) {
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) == CAPACITY) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        events_[head & (CAPACITY - 1)] = event;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only
+    bool pop(TouchEvent& event) {
+        uint32_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        event = events_[tail & (CAPACITY - 1)];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only, once per pointer read: the oldest queued event, or the
+    // last one again when none is waiting. Returns true while more are
+    // queued, so a press and release landing between two reads are both seen.
+    bool read(TouchEvent& state) {
+        pop(last_);
+        state = last_;
+        return tail_.load(std::memory_order_relaxed) != head_.load(std::memory_order_acquire);
+    }
+
+    uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    TouchEvent events_[CAPACITY];
+    std::atomic<uint32_t> head_;  // Written by the producer only
+    std::atomic<uint32_t> tail_;  // Written by the consumer only
+    std::atomic<uint32_t> dropped_;
+    TouchEvent last_;
+};
+
+#endif // TOUCH_INPUT_H
@@ -0,0 +1,179 @@
+#include "background_cache.h"
+#include "../logging/logging.h"
+#include <Arduino.h>
+#include <string.h>
+
+BackgroundCache::BackgroundCache(size_t budget) :
+    budget_(budget),
+    used_(0),
+    clock_(0),
+    shown_(nullptr),
+    next_(nullptr),
+    stats_() {
+    memset(entries_, 0, sizeof(entries_));
+}
+
+BackgroundCache::~BackgroundCache() {
+    clear();
+}
+
+const lv_image_dsc_t* BackgroundCache::show(const lv_image_dsc_t* src) {
+    // Images stored uncompressed are drawn straight from flash
+    if (!src || !(src->header.flags & LV_IMAGE_FLAGS_COMPRESSED)) {
+        return src;
+    }
+
+    // The image shown until now may go once it is off screen, which the
+    // caller sees to straight away
+    shown_ = src;
+    if (next_ == src) {
+        next_ = nullptr;
+    }
+    Entry* entry = find(src);
+    if (entry) {
+        stats_.hits++;
+    } else {
+        stats_.misses++;
+        entry = load(src);
+        if (!entry) {
+            return src;
+        }
+    }
+    entry->last_used = ++clock_;
+    return &entry->image;
+}
+
+void BackgroundCache::prefetch(const lv_image_dsc_t* src) {
+    if (!src || !(src->header.flags & LV_IMAGE_FLAGS_COMPRESSED)) {
+        return;
+    }
+    next_ = src;
+    Entry* entry = find(src);
+    if (!entry) {
+        entry = load(src);
+        if (!entry) {
+            return;
+        }
+        stats_.prefetches++;
+    }
+    entry->last_used = ++clock_;
+}
+
+void BackgroundCache::clear() {
+    for (Entry& entry : entries_) {
+        if (entry.src) {
+            release(entry);
+        }
+    }
+    shown_ = nullptr;
+    next_ = nullptr;
+}
+
+void BackgroundCache::resetStats() {
+    memset(&stats_, 0, sizeof(stats_));
+}
+
+void BackgroundCache::logStats() const {
+    uint32_t lookups = stats_.hits + stats_.misses;
+    uint32_t decodes = stats_.misses + stats_.prefetches;
+    LOG_UI_I("Backgrounds: %u shown, %u%% from cache, %u prefetched, %u evicted, %u failed; "
+             "%u of %u KB decoded; decode avg %lu us, max %lu us",
+             lookups, lookups ? stats_.hits * 100 / lookups : 0, stats_.prefetches,
+             stats_.evictions, stats_.failures, (unsigned) (used_ / 1024),
+             (unsigned) (budget_ / 1024),
+             (unsigned long) (decodes ? stats_.decode_us / decodes : 0),
+             (unsigned long) stats_.max_decode_us);
+}
+
+BackgroundCache::Entry* BackgroundCache::find(const lv_image_dsc_t* src) {
+    for (Entry& entry : entries_) {
+        if (entry.src == src) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+BackgroundCache::Entry* BackgroundCache::load(const lv_image_dsc_t* src) {
+    size_t size = decodedSize(src);
+    if (!makeRoom(size)) {
+        stats_.failures++;
+        LOG_UI_W("Background of %u bytes does not fit the %u byte cache", (unsigned) size,
+                 (unsigned) budget_);
+        return nullptr;
+    }
+    Entry* entry = find(nullptr);
+
+    // The decoder's output is ours until it is closed, as no_cache keeps it
+    // out of LVGL's image cache
+    lv_image_decoder_args_t args;
+    memset(&args, 0, sizeof(args));
+    args.no_cache = true;
+    uint32_t started = micros();
+    lv_result_t result = lv_image_decoder_open(&entry->decoder, src, &args);
+    uint32_t elapsed = micros() - started;
+    if (result != LV_RESULT_OK || !entry->decoder.decoded) {
+        if (result == LV_RESULT_OK) {
+            lv_image_decoder_close(&entry->decoder);
+        }
+        stats_.failures++;
+        LOG_UI_W("Background decode failed");
+        return nullptr;
+    }
+    stats_.decode_us += elapsed;
+    if (elapsed > stats_.max_decode_us) {
+        stats_.max_decode_us = elapsed;
+    }
+
+    const lv_draw_buf_t* decoded = entry->decoder.decoded;
+    memset(&entry->image, 0, sizeof(entry->image));
+    entry->image.header = decoded->header;
+    entry->image.header.flags = 0;
+    entry->image.data_size = decoded->data_size;
+    entry->image.data = decoded->data;
+    entry->src = src;
+    used_ += decoded->data_size;
+    LOG_UI_D("Background decoded in %lu us, %u of %u bytes cached", (unsigned long) elapsed,
+             (unsigned) used_, (unsigned) budget_);
+    return entry;
+}
+
+// Frees a slot and size bytes of the budget, least recently used first,
+// never touching the shown or next image
+bool BackgroundCache::makeRoom(size_t size) {
+    if (size == 0 || size > budget_) {
+        return false;
+    }
+    while (used_ + size > budget_ || !find(nullptr)) {
+        Entry* oldest = nullptr;
+        for (Entry& entry : entries_) {
+            if (entry.src && entry.src != shown_ && entry.src != next_ &&
+                (!oldest || entry.last_used < oldest->last_used)) {
+                oldest = &entry;
+            }
+        }
+        if (!oldest) {
+            return false;
+        }
+        release(*oldest);
+        stats_.evictions++;
+    }
+    return true;
+}
+
+void BackgroundCache::release(Entry& entry) {
+    lv_image_decoder_close(&entry.decoder);
+    used_ -= entry.image.data_size;
+    entry.src = nullptr;
+}
+
+// Decompressed size from the header LVGL's compressed images start with:
+// method, compressed size, decompressed size
+size_t BackgroundCache::decodedSize(const lv_image_dsc_t* src) {
+    uint32_t header[3];
+    if (src->data_size < sizeof(header)) {
+        return 0;
+    }
+    memcpy(header, src->data, sizeof(header));
+    return header[2];
+}
@@ -0,0 +1,73 @@
+#ifndef BACKGROUND_CACHE_H
+#define BACKGROUND_CACHE_H
+
+#include <lvgl.h>
+#include <stddef.h>
+#include <stdint.h>
+
+struct BackgroundCacheStats {
+    uint32_t hits;
+    uint32_t misses;      // Decoded while the screen waited
+    uint32_t prefetches;  // Decoded ahead of being shown
+    uint32_t evictions;
+    uint32_t failures;    // Decode failed or did not fit; shown from flash
+    uint64_t decode_us;
+    uint32_t max_decode_us;
+};
+
+// Decoded weather backgrounds, within a byte budget.
+//
+// The background assets are stored compressed and unpacked by LVGL's image
+// decoder. LVGL's own image cache stays off (it fails a decode when full
+// rather than evicting), so decoded images are kept here instead, the least
+// recently used going first. The background on screen and the one
+// prefetched as the most likely next are never evicted.
+class BackgroundCache {
+public:
+    explicit BackgroundCache(size_t budget);
+    ~BackgroundCache();
+
+    // The decoded image for src, decoding it on a miss, to hand to
+    // lv_image_set_src(). It stays valid until another image is shown. If
+    // src cannot be decoded into the budget, src itself is returned and
+    // LVGL decodes it on every draw.
+    const lv_image_dsc_t* show(const lv_image_dsc_t* src);
+
+    // Decodes src ahead of time, evicting anything but the shown image
+    void prefetch(const lv_image_dsc_t* src);
+
+    // Frees every decoded image; the shown one must no longer be on screen
+    void clear();
+
+    size_t budget() const { return budget_; }
+    size_t used() const { return used_; }
+    const BackgroundCacheStats& stats() const { return stats_; }
+    void resetStats();
+    void logStats() const;
+
+private:
+    static const int MAX_ENTRIES = 4;
+
+    struct Entry {
+        const lv_image_dsc_t* src;  // nullptr when the slot is free
+        lv_image_decoder_dsc_t decoder;
+        lv_image_dsc_t image;
+        uint32_t last_used;
+    };
+
+    Entry entries_[MAX_ENTRIES];
+    size_t budget_;
+    size_t used_;
+    uint32_t clock_;
+    const lv_image_dsc_t* shown_;
+    const lv_image_dsc_t* next_;
+    BackgroundCacheStats stats_;
+
+    Entry* find(const lv_image_dsc_t* src);
+    Entry* load(const lv_image_dsc_t* src);
+    bool makeRoom(size_t size);
+    void release(Entry& entry);
+    static size_t decodedSize(const lv_image_dsc_t* src);
+};
+
+#endif // BACKGROUND_CACHE_H
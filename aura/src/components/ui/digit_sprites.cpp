@@ -0,0 +1,208 @@
+#include "digit_sprites.h"
+#include "../logging/logging.h"
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+
+// Sprites start on LVGL's draw buffer alignment, as images drawn in place must
+static size_t alignSize(size_t size) {
+    return (size + LV_DRAW_BUF_ALIGN - 1) & ~((size_t) LV_DRAW_BUF_ALIGN - 1);
+}
+
+DigitSprites::DigitSprites() :
+    sprite_count_(0),
+    atlas_(nullptr),
+    atlas_size_(0),
+    build_us_(0),
+    font_(nullptr),
+    placed_count_(0) {
+    memset(sprites_, 0, sizeof(sprites_));
+    text_[0] = '\0';
+}
+
+DigitSprites::~DigitSprites() {
+    clear();
+}
+
+bool DigitSprites::build(const lv_font_t* font, const char* chars) {
+    clear();
+    uint32_t started = micros();
+
+    // The glyphs first, to size the atlas
+    lv_font_glyph_dsc_t glyphs[MAX_SPRITES];
+    size_t size = 0;
+    uint32_t i = 0;
+    while (chars[i] && sprite_count_ < MAX_SPRITES) {
+        uint32_t letter = lv_text_encoded_next(chars, &i);
+        lv_font_glyph_dsc_t& glyph = glyphs[sprite_count_];
+        if (!lv_font_get_glyph_dsc(font, &glyph, letter, 0)) {
+            LOG_UI_W("Sprite font has no glyph for U+%04lX", (unsigned long) letter);
+            continue;
+        }
+        Sprite& sprite = sprites_[sprite_count_++];
+        sprite.letter = letter;
+        sprite.ofs_x = glyph.ofs_x;
+        sprite.ofs_y = glyph.ofs_y;
+        size += alignSize((size_t) glyph.box_w * glyph.box_h);
+    }
+
+    atlas_ = (uint8_t*) lv_malloc(size > 0 ? size : 1);
+    if (!atlas_) {
+        LOG_UI_W("No room for a %u byte sprite atlas", (unsigned) size);
+        sprite_count_ = 0;
+        return false;
+    }
+    atlas_size_ = size;
+    font_ = font;
+
+    // Each bitmap glyph expanded to A8 as LVGL does when drawing a letter,
+    // then packed without row padding
+    size_t offset = 0;
+    for (int n = 0; n < sprite_count_; n++) {
+        lv_font_glyph_dsc_t& glyph = glyphs[n];
+        lv_image_dsc_t& image = sprites_[n].image;
+        memset(&image, 0, sizeof(image));
+        image.header.magic = LV_IMAGE_HEADER_MAGIC;
+        image.header.cf = LV_COLOR_FORMAT_A8;
+        if (glyph.box_w == 0 || glyph.box_h == 0 || glyph.format <= LV_FONT_GLYPH_FORMAT_NONE ||
+            glyph.format >= LV_FONT_GLYPH_FORMAT_IMAGE) {
+            continue;
+        }
+
+        lv_draw_buf_t* scratch = lv_draw_buf_create(glyph.box_w, glyph.box_h, LV_COLOR_FORMAT_A8,
+                                                    LV_STRIDE_AUTO);
+        const lv_draw_buf_t* bitmap =
+            scratch ? (const lv_draw_buf_t*) lv_font_get_glyph_bitmap(&glyph, scratch) : nullptr;
+        if (bitmap) {
+            uint8_t* data = atlas_ + offset;
+            for (uint32_t y = 0; y < glyph.box_h; y++) {
+                memcpy(data + y * glyph.box_w, bitmap->data + y * bitmap->header.stride,
+                       glyph.box_w);
+            }
+            image.header.w = glyph.box_w;
+            image.header.h = glyph.box_h;
+            image.header.stride = glyph.box_w;
+            image.data_size = (uint32_t) glyph.box_w * glyph.box_h;
+            image.data = data;
+            offset += alignSize(image.data_size);
+        } else {
+            LOG_UI_W("Could not render U+%04lX into the sprite atlas",
+                     (unsigned long) sprites_[n].letter);
+        }
+        lv_font_glyph_release_draw_data(&glyph);
+        if (scratch) {
+            lv_draw_buf_destroy(scratch);
+        }
+    }
+
+    build_us_ = micros() - started;
+    LOG_UI_I("Sprite atlas: %d glyphs in %u bytes, built in %lu us", sprite_count_,
+             (unsigned) atlas_size_, (unsigned long) build_us_);
+    return true;
+}
+
+void DigitSprites::clear() {
+    if (atlas_) {
+        lv_free(atlas_);
+        atlas_ = nullptr;
+    }
+    atlas_size_ = 0;
+    sprite_count_ = 0;
+    placed_count_ = 0;
+    text_[0] = '\0';
+    font_ = nullptr;
+}
+
+lv_obj_t* DigitSprites::create(lv_obj_t* parent) {
+    lv_obj_t* obj = lv_obj_create(parent);
+    if (!obj) {
+        return nullptr;
+    }
+
+    // No background, border or padding, and clicks go through to the
+    // screen, as with a label
+    lv_obj_remove_style_all(obj);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(obj, drawEvent, LV_EVENT_DRAW_MAIN, this);
+    lv_obj_set_size(obj, 0, font_ ? font_->line_height : 0);
+    text_[0] = '\0';
+    placed_count_ = 0;
+    return obj;
+}
+
+void DigitSprites::setText(lv_obj_t* obj, const char* text) {
+    // Weather updates mostly leave the temperature as it was
+    if (!obj || !font_ || strcmp(text, text_) == 0) {
+        return;
+    }
+    snprintf(text_, sizeof(text_), "%s", text);
+
+    // Pen positions as lv_draw_label() advances them, glyph boxes placed
+    // from the baseline
+    int32_t baseline = font_->line_height - font_->base_line;
+    int32_t x = 0;
+    placed_count_ = 0;
+    uint32_t i = 0;
+    uint32_t letter = lv_text_encoded_next(text_, &i);
+    while (letter && placed_count_ < MAX_TEXT) {
+        uint32_t next = lv_text_encoded_next(text_, &i);
+        const Sprite* sprite = find(letter);
+        if (sprite) {
+            Placed& placed = placed_[placed_count_++];
+            placed.sprite = sprite;
+            placed.x = x + sprite->ofs_x;
+            placed.y = baseline - (int32_t) sprite->image.header.h - sprite->ofs_y;
+            x += lv_font_get_glyph_width(font_, letter, next);
+        } else {
+            LOG_UI_W("No sprite for U+%04lX in \"%s\"", (unsigned long) letter, text_);
+        }
+        letter = next;
+    }
+
+    lv_obj_invalidate(obj);
+    lv_obj_set_size(obj, x, font_->line_height);
+}
+
+const DigitSprites::Sprite* DigitSprites::find(uint32_t letter) const {
+    for (int n = 0; n < sprite_count_; n++) {
+        if (sprites_[n].letter == letter) {
+            return &sprites_[n];
+        }
+    }
+    return nullptr;
+}
+
+// Each sprite is an A8 image, which LVGL blends as a mask filled with the
+// recolour: the same blend it uses for the glyphs of a label
+void DigitSprites::drawEvent(lv_event_t* e) {
+    DigitSprites* self = (DigitSprites*) lv_event_get_user_data(e);
+    lv_obj_t* obj = (lv_obj_t*) lv_event_get_current_target(e);
+    lv_layer_t* layer = lv_event_get_layer(e);
+
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    lv_obj_init_draw_image_dsc(obj, LV_PART_MAIN, &dsc);
+    dsc.opa = LV_OPA_MIX2(dsc.opa, lv_obj_get_style_text_opa(obj, LV_PART_MAIN));
+    if (dsc.opa <= LV_OPA_MIN) {
+        return;
+    }
+    dsc.recolor = lv_obj_get_style_text_color_filtered(obj, LV_PART_MAIN);
+    dsc.recolor_opa = LV_OPA_COVER;
+
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+    for (int n = 0; n < self->placed_count_; n++) {
+        const Placed& placed = self->placed_[n];
+        const lv_image_dsc_t& image = placed.sprite->image;
+        if (image.header.w == 0) {
+            continue;
+        }
+        lv_area_t area;
+        area.x1 = coords.x1 + placed.x;
+        area.y1 = coords.y1 + placed.y;
+        area.x2 = area.x1 + image.header.w - 1;
+        area.y2 = area.y1 + image.header.h - 1;
+        dsc.src = &image;
+        lv_draw_image(layer, &dsc, &area);
+    }
+}
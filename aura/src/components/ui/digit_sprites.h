@@ -0,0 +1,74 @@
+#ifndef DIGIT_SPRITES_H
+#define DIGIT_SPRITES_H
+
+#include <lvgl.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// A few glyphs of one font, rendered once into an A8 atlas, and a widget
+// that shows text composed from them.
+//
+// A label rasterizes every glyph it draws: LVGL looks the glyph up in the
+// font and expands its 4-bit bitmap into an A8 buffer, on every redraw of
+// any area the label overlaps. The large temperature readout uses only a
+// handful of glyphs, so they are expanded once at boot and each redraw
+// blends the stored A8 sprites straight onto the screen, in the text
+// colour, exactly where the label would have put them.
+class DigitSprites {
+public:
+    DigitSprites();
+    ~DigitSprites();
+
+    // Renders each character of chars (UTF-8) in font into the atlas,
+    // dropping any that came before. Fails if the atlas cannot be
+    // allocated; the caller then keeps using a label.
+    bool build(const lv_font_t* font, const char* chars);
+    void clear();
+    bool ready() const { return atlas_ != nullptr; }
+
+    // The widget, sized like a label of the font with the same text. Styled
+    // with the text colour and opacity; it shows the sprites of this
+    // instance, so create one at a time.
+    lv_obj_t* create(lv_obj_t* parent);
+
+    // Lays text out as a label would, kerning included, and redraws the
+    // widget if it changed. Characters without a sprite are left out.
+    void setText(lv_obj_t* obj, const char* text);
+
+    // Heap taken by the atlas, and how long building it took
+    size_t atlasBytes() const { return atlas_size_; }
+    uint32_t buildUs() const { return build_us_; }
+
+private:
+    static const int MAX_SPRITES = 16;
+    static const int MAX_TEXT = 8;  // Characters; "-40°F" needs 5
+
+    struct Sprite {
+        uint32_t letter;
+        int16_t ofs_x;
+        int16_t ofs_y;
+        lv_image_dsc_t image;  // A8, data in atlas_; 0x0 for blank glyphs
+    };
+
+    // A sprite and its top-left corner within the widget
+    struct Placed {
+        const Sprite* sprite;
+        int32_t x;
+        int32_t y;
+    };
+
+    Sprite sprites_[MAX_SPRITES];
+    int sprite_count_;
+    uint8_t* atlas_;
+    size_t atlas_size_;
+    uint32_t build_us_;
+    const lv_font_t* font_;
+    char text_[MAX_TEXT * 4 + 1];
+    Placed placed_[MAX_TEXT];
+    int placed_count_;
+
+    const Sprite* find(uint32_t letter) const;
+    static void drawEvent(lv_event_t* e);
+};
+
+#endif // DIGIT_SPRITES_H
@@ -133,7 +133,9 @@ static const LocalizedStrings fr_strings = {
   .weekdays = {"Dim", "Lun", "Mar", "Mer", "Jeu", "Ven", "Sam"}
 };
 
-UI::UI() : display_ref(nullptr), main_screen(nullptr), settings_win(nullptr), location_win(nullptr), current_language_(LANG_EN) {
+UI::UI() : display_ref(nullptr), main_screen(nullptr), settings_win(nullptr), location_win(nullptr), current_language_(LANG_EN),
+           weather_data_(nullptr), hourly_window_(-1), hourly_now_(-1),
+           backgrounds_(BACKGROUND_CACHE_BYTES) {
     instance = this;
     
     // Initialize all UI element pointers to nullptr for safety
@@ -173,6 +175,14 @@ bool UI::init(Display* display) {
     }
     
     display_ref = display;
+    
+#if TEMPERATURE_SPRITES
+    // The large temperature is composed from glyphs rendered once here;
+    // without room for them it stays a label
+    if (!temperature_sprites_.build(getFont42(), TEMPERATURE_SPRITE_CHARS)) {
+        LOG_UI_W("Temperature readout falls back to a label");
+    }
+#endif
     LOG_UI_I("UI initialization completed successfully");
     LOG_FUNCTION_EXIT(TAG_UI);
     return true;
@@ -195,6 +205,11 @@ void UI::cleanupMainScreen() {
     box_daily = nullptr;
     box_hourly = nullptr;
     lbl_clock = nullptr;
+    hourly_window_ = -1;
+    hourly_now_ = -1;
+    
+    // Nothing shows the decoded backgrounds any more
+    backgrounds_.clear();
     
     for (int i = 0; i < 7; i++) {
         lbl_daily_day[i] = nullptr;
@@ -221,8 +236,9 @@ void UI::createMainScreen() {
     LOG_UI_I("Main screen created successfully");
     
     // Set background to dark gradient (like original design)
-    lv_obj_set_style_bg_color(main_screen, lv_color_hex(0x2c5282), LV_PART_MAIN);
-    lv_obj_set_style_bg_grad_color(main_screen, lv_color_hex(0x1a202c), LV_PART_MAIN);
+    lv_obj_set_style_bg_color(main_screen, lv_color_hex(MAIN_SCREEN_GRADIENT_TOP), LV_PART_MAIN);
+    lv_obj_set_style_bg_grad_color(main_screen, lv_color_hex(MAIN_SCREEN_GRADIENT_BOTTOM),
+                                   LV_PART_MAIN);
     lv_obj_set_style_bg_grad_dir(main_screen, LV_GRAD_DIR_VER, LV_PART_MAIN);
     LOG_UI_D("Main screen background gradient applied");
     
@@ -255,8 +271,9 @@ void UI::createMainScreen() {
 }
 
 bool UI::createTemperatureDisplay() {
-    // Temperature label (large) - original v1.0.1 position
-    lbl_today_temp = lv_label_create(main_screen);
+    // Temperature (large) - original v1.0.1 position, drawn from the sprites
+    lbl_today_temp = temperature_sprites_.ready() ? temperature_sprites_.create(main_screen)
+                                                  : lv_label_create(main_screen);
     if (!lbl_today_temp) {
         LOG_UI_E("Failed to create temperature label");
         return false;
@@ -264,7 +281,7 @@ bool UI::createTemperatureDisplay() {
     
     lv_obj_set_style_text_font(lbl_today_temp, getFont42(), LV_PART_MAIN);
     lv_obj_set_style_text_color(lbl_today_temp, lv_color_white(), LV_PART_MAIN);
-    lv_label_set_text(lbl_today_temp, getStrings()->temp_placeholder);
+    setTemperatureText(getStrings()->temp_placeholder);
     lv_obj_align(lbl_today_temp, LV_ALIGN_TOP_MID, 45, 25); // Original v1.0.1 position
     
     // Feels like label - original v1.0.1 position  
@@ -301,18 +318,18 @@ bool UI::createClockDisplay() {
 }
 
 bool UI::createWeatherIcon() {
-    // Today's weather icon - positioned left of temperature display
+    // Today's large weather image - top left, beside the temperature
     img_today_icon = lv_image_create(main_screen);
     if (!img_today_icon) {
         LOG_UI_E("Failed to create weather icon");
         return false;
     }
     
-    // Position to the left of temperature (temperature is at CENTER+45, so icon at CENTER-30)
-    lv_obj_align(img_today_icon, LV_ALIGN_TOP_MID, -30, 25); // Left of temperature
+    // Original v1.0.1 position; the opaque images are blended for this row
+    lv_obj_align(img_today_icon, LV_ALIGN_TOP_MID, -64, TODAY_IMAGE_Y);
     
-    // Set default icon
-    lv_image_set_src(img_today_icon, &icon_partly_cloudy);
+    // Set default image
+    lv_image_set_src(img_today_icon, backgrounds_.show(&image_partly_cloudy_opaque));
     
     LOG_UI_I("Weather icon created successfully");
     return true;
@@ -420,7 +437,7 @@ void UI::createDailyForecastBox() {
     // Apply original v1.0.1 styling
     lv_obj_set_size(box_daily, 220, 180); // Original v1.0.1 size
     lv_obj_align(box_daily, LV_ALIGN_TOP_LEFT, 10, 135); // Original v1.0.1 position
-    lv_obj_set_style_bg_color(box_daily, lv_color_hex(0x5e9bc8), LV_PART_MAIN);
+    lv_obj_set_style_bg_color(box_daily, lv_color_hex(FORECAST_BOX_COLOR), LV_PART_MAIN);
     lv_obj_set_style_bg_opa(box_daily, LV_OPA_COVER, LV_PART_MAIN);
     lv_obj_set_style_radius(box_daily, 4, LV_PART_MAIN);
     lv_obj_set_style_border_width(box_daily, 0, LV_PART_MAIN);
@@ -496,7 +513,7 @@ void UI::createHourlyForecastBox() {
     // Apply same styling as daily box
     lv_obj_set_size(box_hourly, 220, 180); // Same size as daily
     lv_obj_align(box_hourly, LV_ALIGN_TOP_LEFT, 10, 135); // Same position as daily
-    lv_obj_set_style_bg_color(box_hourly, lv_color_hex(0x5e9bc8), LV_PART_MAIN);
+    lv_obj_set_style_bg_color(box_hourly, lv_color_hex(FORECAST_BOX_COLOR), LV_PART_MAIN);
     lv_obj_set_style_bg_opa(box_hourly, LV_OPA_COVER, LV_PART_MAIN);
     lv_obj_set_style_radius(box_hourly, 4, LV_PART_MAIN);
     lv_obj_set_style_border_width(box_hourly, 0, LV_PART_MAIN);
@@ -577,10 +594,23 @@ void UI::createLocationWindow() {
     LOG_UI_W("Location window creation not yet implemented");
 }
 
-void UI::updateWeatherData(const JsonDocument& weatherData) {
-    // Implementation for updating weather data
-    // This would parse the JSON and update all UI elements
-    LOG_UI_W("Weather data update not yet implemented");
+void UI::updateWeatherData(const WeatherData& weatherData) {
+    // Runs in loop() with a snapshot the weather task has finished with
+    updateTemperature(weatherTempToFloat(weatherData.current_temp),
+                      weatherTempToFloat(weatherData.feels_like));
+    updateBackground(weatherData.weather_code, weatherData.is_day);
+    updateForecast(weatherData);
+    
+    // Data restored from flash at boot is dimmed until the first fresh fetch
+    lv_opa_t opacity = weatherData.stale ? LV_OPA_60 : LV_OPA_COVER;
+    lv_obj_t* weather_objects[] = {lbl_today_temp, lbl_today_feels_like, img_today_icon,
+                                   box_daily, box_hourly};
+    for (lv_obj_t* obj : weather_objects) {
+        if (obj) {
+            lv_obj_set_style_opa(obj, opacity, LV_PART_MAIN);
+        }
+    }
+    LOG_UI_I("Weather display updated%s", weatherData.stale ? " (stale)" : "");
 }
 
 void UI::updateClock() {
@@ -600,11 +630,14 @@ void UI::updateClock() {
         
         lv_label_set_text(lbl_clock, timeStr);
     }
+    
+    // No-op unless the hour changed
+    updateHourlyWindow();
 }
 
 void UI::updateTemperature(float temp, float feelsLike) {
     if (lbl_today_temp) {
-        lv_label_set_text(lbl_today_temp, formatTemperature(temp).c_str());
+        setTemperatureText(formatTemperature(temp).c_str());
     }
     
     if (lbl_today_feels_like) {
@@ -613,10 +646,87 @@ void UI::updateTemperature(float temp, float feelsLike) {
     }
 }
 
-void UI::updateForecast(const JsonArray& daily, const JsonArray& hourly) {
-    // Implementation for updating forecast data
-    // This would iterate through the arrays and update the forecast elements
-    LOG_UI_W("Forecast update not yet implemented");
+void UI::updateForecast(const WeatherData& weatherData) {
+    const LocalizedStrings* strings = getStrings();
+    
+    for (int i = 0; i < 7; i++) {
+        // The first row is always today
+        if (lbl_daily_day[i]) {
+            uint8_t weekday = weatherWeekday(weatherData.daily_times[i], weatherData.utc_offset);
+            lv_label_set_text(lbl_daily_day[i], i == 0 ? strings->today : strings->weekdays[weekday]);
+        }
+        if (lbl_daily_high[i]) {
+            lv_label_set_text(lbl_daily_high[i], formatDegrees(weatherData.daily_high[i]).c_str());
+        }
+        if (lbl_daily_low[i]) {
+            lv_label_set_text(lbl_daily_low[i], formatDegrees(weatherData.daily_low[i]).c_str());
+        }
+        if (img_daily[i]) {
+            lv_image_set_src(img_daily[i], chooseIcon(weatherData.daily_codes[i], 1));
+        }
+    }
+    
+    weather_data_ = &weatherData;
+    hourly_window_ = -1;
+    updateHourlyWindow();
+}
+
+void UI::updateHourlyWindow() {
+    if (!weather_data_ || weather_data_->hourly_count == 0) {
+        return;
+    }
+    const WeatherData& weatherData = *weather_data_;
+    
+    // Before SNTP sets the clock, the fetch time is the best guess for "now"
+    time_t now = time(nullptr);
+    if (now < MIN_VALID_EPOCH) {
+        now = weatherData.fetched_at ? weatherData.fetched_at : weatherData.hourly_start;
+    }
+    int current = weatherHourlyIndex(weatherData, now);
+    int first = weatherHourlyWindow(weatherData, now, 7);
+    if (first == hourly_window_ && current == hourly_now_) {
+        return;
+    }
+    hourly_window_ = first;
+    hourly_now_ = current;
+    
+    // The next hour's forecast is the likeliest next background
+    int next = current + 1;
+    if (img_today_icon && next >= 0 && next < weatherData.hourly_count) {
+        backgrounds_.prefetch(chooseImage(weatherData.hourly_codes[next], weatherData.is_day));
+    }
+    
+    const LocalizedStrings* strings = getStrings();
+    for (int row = 0; row < 7; row++) {
+        int i = first + row;
+        bool valid = i < weatherData.hourly_count;
+        if (lbl_hourly[row]) {
+            uint8_t hour = weatherHour(weatherHourlyTime(weatherData, i), weatherData.utc_offset);
+            String label = i == current ? String(strings->now) : formatTime(hour);
+            lv_label_set_text(lbl_hourly[row], valid ? label.c_str() : "");
+        }
+        if (lbl_hourly_temp[row]) {
+            String temp = valid ? formatDegrees(weatherData.hourly_temps[i]) : String("");
+            lv_label_set_text(lbl_hourly_temp[row], temp.c_str());
+        }
+        if (lbl_precipitation_probability[row]) {
+            char precip_str[8] = "";
+            if (valid) {
+                uint8_t precipitation = weatherData.hourly_precipitation[i];
+                snprintf(precip_str, sizeof(precip_str), "%d%%", precipitation);
+            }
+            lv_label_set_text(lbl_precipitation_probability[row], precip_str);
+        }
+        if (img_hourly[row]) {
+            if (valid) {
+                lv_image_set_src(img_hourly[row], chooseIcon(weatherData.hourly_codes[i], 1));
+                lv_obj_clear_flag(img_hourly[row], LV_OBJ_FLAG_HIDDEN);
+            } else {
+                lv_obj_add_flag(img_hourly[row], LV_OBJ_FLAG_HIDDEN);
+            }
+        }
+    }
+    LOG_UI_D("Hourly view starts at entry %d of %u", first, weatherData.hourly_count);
 }
 
 void UI::updateLocation(const String& locationName) {
@@ -625,16 +735,17 @@ void UI::updateLocation(const String& locationName) {
 }
 
 void UI::updateBackground(int wmo_code, int is_day) {
-    // Update the weather icon instead of background image
+    // Decoded from the compressed asset, unless it is cached already
     if (img_today_icon) {
-        const lv_image_dsc_t* weather_icon = chooseIcon(wmo_code, is_day);
-        if (weather_icon) {
-            lv_image_set_src(img_today_icon, weather_icon);
-            LOG_UI_I("Weather icon updated for code %d, day=%d", wmo_code, is_day);
-        }
+        lv_image_set_src(img_today_icon, backgrounds_.show(chooseImage(wmo_code, is_day)));
+        LOG_UI_I("Weather image updated for code %d, day=%d", wmo_code, is_day);
     }
 }
 
+void UI::logStats() const {
+    backgrounds_.logStats();
+}
+
 String UI::formatTime(int hour) {
     const LocalizedStrings* strings = getStrings();
     
@@ -654,6 +765,21 @@ String UI::formatTemperature(float temp) {
     return String(displayTemp) + unit;
 }
 
+void UI::setTemperatureText(const char* text) {
+    if (temperature_sprites_.ready()) {
+        temperature_sprites_.setText(lbl_today_temp, text);
+    } else {
+        lv_label_set_text(lbl_today_temp, text);
+    }
+}
+
+String UI::formatDegrees(int16_t temp) {
+    // Forecast rows have no room for the unit; temp is in tenths of a degree C
+    int displayTemp = use_fahrenheit ? (temp * 9 / 5 + 320) / WEATHER_TEMP_SCALE
+                                     : temp / WEATHER_TEMP_SCALE;
+    return String(displayTemp) + "°";
+}
+
 // Static event handlers
 void UI::settingsEventHandler(lv_event_t* e) {
     if (!instance) {
@@ -737,23 +863,23 @@ const LocalizedStrings* UI::getLanguageStrings(Language language) const {
 // ============================================================================
 
 const lv_font_t* UI::getFont12() const {
-    return &lv_font_montserrat_latin_12;
+    return &UI_FONT(12);
 }
 
 const lv_font_t* UI::getFont14() const {
-    return &lv_font_montserrat_latin_14;
+    return &UI_FONT(14);
 }
 
 const lv_font_t* UI::getFont16() const {
-    return &lv_font_montserrat_latin_16;
+    return &UI_FONT(16);
 }
 
 const lv_font_t* UI::getFont20() const {
-    return &lv_font_montserrat_latin_20;
+    return &UI_FONT(20);
 }
 
 const lv_font_t* UI::getFont42() const {
-    return &lv_font_montserrat_latin_42;
+    return &UI_FONT(42);
 }
 
 // ============================================================================
@@ -764,72 +890,74 @@ const lv_image_dsc_t* UI::chooseImage(int wmo_code, int is_day) const {
     switch (wmo_code) {
         // Clear sky
         case 0:
-            return is_day ? &image_sunny : &image_clear_night;
+            return is_day ? &image_sunny_opaque : &image_clear_night_opaque;
         // Mainly clear
         case 1:
-            return is_day ? &image_mostly_sunny : &image_mostly_clear_night;
+            return is_day ? &image_mostly_sunny_opaque : &image_mostly_clear_night_opaque;
         // Partly cloudy
         case 2:
-            return is_day ? &image_partly_cloudy : &image_partly_cloudy_night;
+            return is_day ? &image_partly_cloudy_opaque : &image_partly_cloudy_night_opaque;
         // Overcast
         case 3:
-            return &image_cloudy;
+            return &image_cloudy_opaque;
         // Fog / mist
         case 45:
         case 48:
-            return &image_haze_fog_dust_smoke;
+            return &image_haze_fog_dust_smoke_opaque;
         // Drizzle (light → dense)
         case 51:
         case 53:
         case 55:
-            return &image_drizzle;
+            return &image_drizzle_opaque;
         // Freezing drizzle
         case 56:
         case 57:
-            return &image_sleet_hail;
+            return &image_sleet_hail_opaque;
         // Rain: slight showers
         case 61:
-            return is_day ? &image_scattered_showers_day : &image_scattered_showers_night;
+            return is_day ? &image_scattered_showers_day_opaque
+                          : &image_scattered_showers_night_opaque;
         // Rain: moderate
         case 63:
-            return &image_showers_rain;
+            return &image_showers_rain_opaque;
         // Rain: heavy
         case 65:
-            return &image_heavy_rain;
+            return &image_heavy_rain_opaque;
         // Freezing rain
         case 66:
         case 67:
-            return &image_wintry_mix_rain_snow;
+            return &image_wintry_mix_rain_snow_opaque;
         // Snow fall (light, moderate, heavy) & snow showers (light)
         case 71:
         case 73:
         case 75:
         case 85:
-            return &image_snow_showers_snow;
+            return &image_snow_showers_snow_opaque;
         // Snow grains
         case 77:
-            return &image_flurries;
+            return &image_flurries_opaque;
         // Rain showers (slight → moderate)
         case 80:
         case 81:
-            return is_day ? &image_scattered_showers_day : &image_scattered_showers_night;
+            return is_day ? &image_scattered_showers_day_opaque
+                          : &image_scattered_showers_night_opaque;
         // Rain showers: violent
         case 82:
-            return &image_heavy_rain;
+            return &image_heavy_rain_opaque;
         // Heavy snow showers
         case 86:
-            return &image_heavy_snow;
+            return &image_heavy_snow_opaque;
         // Thunderstorm (light)
         case 95:
-            return is_day ? &image_isolated_scattered_tstorms_day
-                          : &image_isolated_scattered_tstorms_night;
+            return is_day ? &image_isolated_scattered_tstorms_day_opaque
+                          : &image_isolated_scattered_tstorms_night_opaque;
         // Thunderstorm with hail
         case 96:
         case 99:
-            return &image_strong_tstorms;
+            return &image_strong_tstorms_opaque;
         // Fallback for any other code
         default:
-            return is_day ? &image_mostly_cloudy_day : &image_mostly_cloudy_night;
+            return is_day ? &image_mostly_cloudy_day_opaque : &image_mostly_cloudy_night_opaque;
     }
 }
 
@@ -837,70 +965,73 @@ const lv_image_dsc_t* UI::chooseIcon(int wmo_code, int is_day) const {
     switch (wmo_code) {
         // Clear sky
         case 0:
-            return is_day ? &icon_sunny : &icon_clear_night;
+            return is_day ? &icon_sunny_atlas : &icon_clear_night_atlas;
         // Mainly clear
         case 1:
-            return is_day ? &icon_mostly_sunny : &icon_mostly_clear_night;
+            return is_day ? &icon_mostly_sunny_atlas : &icon_mostly_clear_night_atlas;
         // Partly cloudy
         case 2:
-            return is_day ? &icon_partly_cloudy : &icon_partly_cloudy_night;
+            return is_day ? &icon_partly_cloudy_atlas : &icon_partly_cloudy_night_atlas;
         // Overcast
         case 3:
-            return &icon_cloudy;
+            return &icon_cloudy_atlas;
         // Fog / mist
         case 45:
         case 48:
-            return &icon_haze_fog_dust_smoke;
+            return &icon_haze_fog_dust_smoke_atlas;
         // Drizzle (light → dense)
         case 51:
         case 53:
         case 55:
-            return &icon_drizzle;
+            return &icon_drizzle_atlas;
         // Freezing drizzle
         case 56:
         case 57:
-            return &icon_sleet_hail;
+            return &icon_sleet_hail_atlas;
         // Rain: slight showers
         case 61:
-            return is_day ? &icon_scattered_showers_day : &icon_scattered_showers_night;
+            return is_day ? &icon_scattered_showers_day_atlas
+                          : &icon_scattered_showers_night_atlas;
         // Rain: moderate
         case 63:
-            return &icon_showers_rain;
+            return &icon_showers_rain_atlas;
         // Rain: heavy
         case 65:
-            return &icon_heavy_rain;
+            return &icon_heavy_rain_atlas;
         // Freezing rain
         case 66:
         case 67:
-            return &icon_wintry_mix_rain_snow;
+            return &icon_wintry_mix_rain_snow_atlas;
         // Snow fall (light, moderate, heavy) & snow showers (light)
         case 71:
         case 73:
         case 75:
         case 85:
-            return &icon_snow_showers_snow;
+            return &icon_snow_showers_snow_atlas;
         // Snow grains
         case 77:
-            return &icon_flurries;
+            return &icon_flurries_atlas;
         // Rain showers (slight → moderate)
         case 80:
         case 81:
-            return is_day ? &icon_scattered_showers_day : &icon_scattered_showers_night;
+            return is_day ? &icon_scattered_showers_day_atlas
+                          : &icon_scattered_showers_night_atlas;
         // Rain showers: violent
         case 82:
-            return &icon_heavy_rain;
+            return &icon_heavy_rain_atlas;
         // Heavy snow showers
         case 86:
-            return &icon_heavy_snow;
+            return &icon_heavy_snow_atlas;
         // Thunderstorm (light)
         case 95:
-            return is_day ? &icon_isolated_scattered_tstorms_day : &icon_isolated_scattered_tstorms_night;
+            return is_day ? &icon_isolated_scattered_tstorms_day_atlas
+                          : &icon_isolated_scattered_tstorms_night_atlas;
         // Thunderstorm with hail
         case 96:
         case 99:
-            return &icon_strong_tstorms;
+            return &icon_strong_tstorms_atlas;
         // Fallback for any other code
         default:
-            return is_day ? &icon_mostly_cloudy_day : &icon_mostly_cloudy_night;
+            return is_day ? &icon_mostly_cloudy_day_atlas : &icon_mostly_cloudy_night_atlas;
     }
 }
\ No newline at end of file
@@ -3,6 +3,9 @@
 
 #include "../../config.h"
 #include "../display/display.h"
+#include "../weather/weather_data.h"
+#include "background_cache.h"
+#include "digit_sprites.h"
 #include <ArduinoJson.h>
 #include <lvgl.h>
 
@@ -22,14 +25,20 @@ public:
     void createLocationWindow();
     void cleanupMainScreen();
     
-    // UI updates
-    void updateWeatherData(const JsonDocument& weatherData);
+    // UI updates. weatherData is kept for the hourly view and must stay valid
+    // until the next call, as WeatherTask::takeUpdate() snapshots do.
+    void updateWeatherData(const WeatherData& weatherData);
+    // Once a second or so: redraws the clock and slides the hourly view to the current hour
     void updateClock();
     void updateTemperature(float temp, float feelsLike);
-    void updateForecast(const JsonArray& daily, const JsonArray& hourly);
+    void updateForecast(const WeatherData& weatherData);
     void updateLocation(const String& locationName);
     void updateBackground(int wmo_code, int is_day);
     
+    // Background cache counters, for the display_stats command
+    void logStats() const;
+    BackgroundCache& getBackgrounds() { return backgrounds_; }
+    
     // Event handlers
     static void settingsEventHandler(lv_event_t* e);
     static void screenEventHandler(lv_event_t* e);
@@ -47,7 +56,10 @@ public:
     const lv_font_t* getFont20() const;
     const lv_font_t* getFont42() const;
     
-    // Weather image/icon selection functions (moved from main)
+    // Weather image/icon selection functions (moved from main). The images
+    // are the opaque copies, pre-blended onto the main screen's gradient at
+    // TODAY_IMAGE_Y; over any other backdrop use the RGB565A8 image_* originals.
+    // The icons are 16-colour slices of the icon atlas.
     const lv_image_dsc_t* chooseImage(int wmo_code, int is_day) const;
     const lv_image_dsc_t* chooseIcon(int wmo_code, int is_day) const;
     
@@ -78,6 +90,17 @@ private:
     lv_obj_t* img_hourly[7];
     lv_obj_t* lbl_clock;
     
+    // Last weather snapshot and the hourly entries currently shown
+    const WeatherData* weather_data_;
+    int hourly_window_;
+    int hourly_now_;
+    
+    // Decoded weather images: the one shown and the next hour's stay hot
+    BackgroundCache backgrounds_;
+    
+    // The temperature readout's glyphs, rendered once by init()
+    DigitSprites temperature_sprites_;
+    
     // Settings window elements
     lv_obj_t* settings_win;
     lv_obj_t* unit_switch;
@@ -96,8 +119,11 @@ private:
     // Helper methods
     void createDailyForecastBox();
     void createHourlyForecastBox();
+    void updateHourlyWindow();
     String formatTime(int hour);
     String formatTemperature(float temp);
+    String formatDegrees(int16_t temp);
+    void setTemperatureText(const char* text);
     
     // UI creation helper methods
     bool createTemperatureDisplay();
@@ -0,0 +1,106 @@
+#include "city_index.h"
+#include <ctype.h>
+#include <string.h>
+
+// Lets the host benchmark build against a generated table of its own
+#ifndef CITY_INDEX_DATA_HEADER
+#define CITY_INDEX_DATA_HEADER "city_index_data.h"
+#endif
+#include CITY_INDEX_DATA_HEADER
+
+// Orders a stored name against prefix as if both were lowercase: 0 when
+// name starts with prefix, else the sign of the first difference
+static int compareFolded(const uint8_t* name, size_t length, const char* prefix) {
+    for (size_t i = 0; prefix[i]; i++) {
+        if (i == length) {
+            return -1;
+        }
+        int difference = tolower(name[i]) - tolower((uint8_t) prefix[i]);
+        if (difference != 0) {
+            return difference;
+        }
+    }
+    return 0;
+}
+
+CityIndex::CityIndex(const CityIndexData& data) : data_(data) {}
+
+const CityIndex& CityIndex::builtin() {
+    static const CityIndex index(CITY_INDEX_DATA);
+    return index;
+}
+
+size_t CityIndex::footprint() const {
+    size_t bytes = data_.names_size + data_.block_count * sizeof(uint32_t) +
+                   data_.count * sizeof(CityRecord) + data_.country_count * sizeof(char*);
+    for (uint16_t i = 0; i < data_.country_count; i++) {
+        bytes += strlen(data_.countries[i]) + 1;
+    }
+    return bytes;
+}
+
+uint16_t CityIndex::firstCandidateBlock(const char* prefix) const {
+    // Last block whose head sorts before prefix; matches may run on from
+    // the middle of it
+    uint16_t low = 0;
+    uint16_t high = data_.block_count;
+    while (high - low > 1) {
+        uint16_t middle = low + (high - low) / 2;
+        const uint8_t* head = data_.names + data_.blocks[middle];
+        if (compareFolded(head + 2, head[1], prefix) < 0) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+size_t CityIndex::search(const char* prefix, CityMatch* matches, size_t capacity) const {
+    if (!prefix[0] || capacity == 0 || data_.count == 0) {
+        return 0;
+    }
+
+    size_t found = 0;
+    uint32_t entry = (uint32_t) firstCandidateBlock(prefix) * CITY_INDEX_BLOCK_SIZE;
+    const uint8_t* cursor = data_.names + data_.blocks[entry / CITY_INDEX_BLOCK_SIZE];
+    uint8_t name[CITY_INDEX_NAME_SIZE];
+    for (; entry < data_.count; entry++) {
+        uint8_t shared = cursor[0];
+        uint8_t suffix = cursor[1];
+        memcpy(name + shared, cursor + 2, suffix);
+        cursor += 2 + suffix;
+        size_t length = shared + suffix;
+
+        int order = compareFolded(name, length, prefix);
+        if (order > 0) {
+            break;
+        }
+        if (order < 0) {
+            continue;
+        }
+
+        // Keep the biggest places; equal ranks stay in name order
+        const CityRecord& record = data_.records[entry];
+        size_t slot = found;
+        while (slot > 0 && matches[slot - 1].rank < record.rank) {
+            slot--;
+        }
+        if (slot == capacity) {
+            continue;
+        }
+        if (found < capacity) {
+            found++;
+        }
+        memmove(&matches[slot + 1], &matches[slot], (found - 1 - slot) * sizeof(CityMatch));
+
+        CityMatch& match = matches[slot];
+        memcpy(match.name, name, length);
+        match.name[length] = '\0';
+        match.country = data_.countries[record.country];
+        match.latitude = (float) record.latitude / CITY_INDEX_COORD_SCALE;
+        match.longitude = (float) record.longitude / CITY_INDEX_COORD_SCALE;
+        match.rank = record.rank;
+    }
+    return found;
+}
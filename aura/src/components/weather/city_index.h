@@ -0,0 +1,67 @@
+#ifndef CITY_INDEX_H
+#define CITY_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Layout shared with tools/make_city_index.py
+#define CITY_INDEX_BLOCK_SIZE 16
+#define CITY_INDEX_NAME_SIZE 40
+#define CITY_INDEX_COORD_SCALE 100
+
+// Per city, in name order; coordinates in hundredths of a degree and
+// population as a log rank (25 per decade)
+struct CityRecord {
+    int16_t latitude;
+    int16_t longitude;
+    uint8_t country;
+    uint8_t rank;
+};
+
+// Names are front-coded: each entry is <shared bytes> <suffix length>
+// <suffix>, and every CITY_INDEX_BLOCK_SIZE entries a block starts again
+// with a full name at the offset in blocks[]
+struct CityIndexData {
+    const uint8_t* names;
+    uint32_t names_size;
+    const uint32_t* blocks;
+    uint16_t block_count;
+    const CityRecord* records;
+    uint16_t count;
+    const char* const* countries;
+    uint16_t country_count;
+};
+
+struct CityMatch {
+    char name[CITY_INDEX_NAME_SIZE];
+    const char* country;
+    float latitude;
+    float longitude;
+    uint8_t rank;
+};
+
+// Prefix search over a city table kept in flash, so common places resolve
+// without the network. Builds nothing at runtime and takes no RAM beyond
+// the caller's matches.
+class CityIndex {
+public:
+    explicit CityIndex(const CityIndexData& data);
+
+    // The table generated into city_index_data.h
+    static const CityIndex& builtin();
+
+    // Cities whose name starts with prefix, ignoring ASCII case, most
+    // populous first. Returns how many were written to matches.
+    size_t search(const char* prefix, CityMatch* matches, size_t capacity) const;
+
+    size_t size() const { return data_.count; }
+    // Bytes of flash the table takes
+    size_t footprint() const;
+
+private:
+    const CityIndexData& data_;
+
+    uint16_t firstCandidateBlock(const char* prefix) const;
+};
+
+#endif // CITY_INDEX_H
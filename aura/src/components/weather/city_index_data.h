@@ -0,0 +1,271 @@
+// Generated by tools/make_city_index.py from cities.csv - do not edit
+// 207 cities in 13 blocks: names 1646 bytes front-coded (1762 plain), 4067 bytes in all
+#ifndef CITY_INDEX_DATA_H
+#define CITY_INDEX_DATA_H
+
+#include "city_index.h"
+
+static const uint8_t CITY_INDEX_NAMES[] = {
+    0x00, 0x07, 0x41, 0x62, 0x69, 0x64, 0x6a, 0x61, 0x6e, 0x02, 0x07, 0x75, 0x20, 0x44, 0x68, 0x61,
+    0x62, 0x69, 0x01, 0x04, 0x63, 0x63, 0x72, 0x61, 0x01, 0x0a, 0x64, 0x64, 0x69, 0x73, 0x20, 0x41,
+    0x62, 0x61, 0x62, 0x61, 0x02, 0x06, 0x65, 0x6c, 0x61, 0x69, 0x64, 0x65, 0x01, 0x08, 0x68, 0x6d,
+    0x65, 0x64, 0x61, 0x62, 0x61, 0x64, 0x01, 0x09, 0x6c, 0x65, 0x78, 0x61, 0x6e, 0x64, 0x72, 0x69,
+    0x61, 0x02, 0x05, 0x67, 0x69, 0x65, 0x72, 0x73, 0x02, 0x04, 0x6d, 0x61, 0x74, 0x79, 0x01, 0x08,
+    0x6d, 0x73, 0x74, 0x65, 0x72, 0x64, 0x61, 0x6d, 0x01, 0x08, 0x6e, 0x63, 0x68, 0x6f, 0x72, 0x61,
+    0x67, 0x65, 0x02, 0x04, 0x6b, 0x61, 0x72, 0x61, 0x01, 0x05, 0x74, 0x68, 0x65, 0x6e, 0x73, 0x02,
+    0x05, 0x6c, 0x61, 0x6e, 0x74, 0x61, 0x01, 0x07, 0x75, 0x63, 0x6b, 0x6c, 0x61, 0x6e, 0x64, 0x02,
+    0x04, 0x73, 0x74, 0x69, 0x6e, 0x00, 0x07, 0x42, 0x61, 0x67, 0x68, 0x64, 0x61, 0x64, 0x02, 0x07,
+    0x6e, 0x67, 0x61, 0x6c, 0x6f, 0x72, 0x65, 0x04, 0x03, 0x6b, 0x6f, 0x6b, 0x02, 0x07, 0x72, 0x63,
+    0x65, 0x6c, 0x6f, 0x6e, 0x61, 0x01, 0x06, 0x65, 0x69, 0x6a, 0x69, 0x6e, 0x67, 0x02, 0x05, 0x6c,
+    0x66, 0x61, 0x73, 0x74, 0x03, 0x05, 0x67, 0x72, 0x61, 0x64, 0x65, 0x03, 0x0b, 0x6f, 0x20, 0x48,
+    0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x65, 0x02, 0x04, 0x72, 0x6c, 0x69, 0x6e, 0x01, 0x09,
+    0x69, 0x72, 0x6d, 0x69, 0x6e, 0x67, 0x68, 0x61, 0x6d, 0x0a, 0x00, 0x01, 0x05, 0x6f, 0x67, 0x6f,
+    0x74, 0x61, 0x02, 0x04, 0x73, 0x74, 0x6f, 0x6e, 0x01, 0x07, 0x72, 0x61, 0x73, 0x69, 0x6c, 0x69,
+    0x61, 0x02, 0x06, 0x69, 0x73, 0x62, 0x61, 0x6e, 0x65, 0x04, 0x03, 0x74, 0x6f, 0x6c, 0x00, 0x08,
+    0x42, 0x72, 0x75, 0x73, 0x73, 0x65, 0x6c, 0x73, 0x01, 0x08, 0x75, 0x63, 0x68, 0x61, 0x72, 0x65,
+    0x73, 0x74, 0x02, 0x06, 0x64, 0x61, 0x70, 0x65, 0x73, 0x74, 0x02, 0x0a, 0x65, 0x6e, 0x6f, 0x73,
+    0x20, 0x41, 0x69, 0x72, 0x65, 0x73, 0x02, 0x03, 0x73, 0x61, 0x6e, 0x00, 0x05, 0x43, 0x61, 0x69,
+    0x72, 0x6f, 0x02, 0x05, 0x6c, 0x67, 0x61, 0x72, 0x79, 0x02, 0x07, 0x70, 0x65, 0x20, 0x54, 0x6f,
+    0x77, 0x6e, 0x02, 0x05, 0x72, 0x61, 0x63, 0x61, 0x73, 0x03, 0x04, 0x64, 0x69, 0x66, 0x66, 0x02,
+    0x08, 0x73, 0x61, 0x62, 0x6c, 0x61, 0x6e, 0x63, 0x61, 0x01, 0x06, 0x68, 0x65, 0x6e, 0x67, 0x64,
+    0x75, 0x04, 0x03, 0x6e, 0x61, 0x69, 0x02, 0x05, 0x69, 0x63, 0x61, 0x67, 0x6f, 0x03, 0x07, 0x74,
+    0x74, 0x61, 0x67, 0x6f, 0x6e, 0x67, 0x02, 0x07, 0x6f, 0x6e, 0x67, 0x71, 0x69, 0x6e, 0x67, 0x00,
+    0x07, 0x43, 0x6f, 0x6c, 0x6f, 0x67, 0x6e, 0x65, 0x04, 0x03, 0x6d, 0x62, 0x6f, 0x02, 0x08, 0x70,
+    0x65, 0x6e, 0x68, 0x61, 0x67, 0x65, 0x6e, 0x00, 0x05, 0x44, 0x61, 0x6b, 0x61, 0x72, 0x02, 0x04,
+    0x6c, 0x69, 0x61, 0x6e, 0x03, 0x03, 0x6c, 0x61, 0x73, 0x02, 0x0b, 0x72, 0x20, 0x65, 0x73, 0x20,
+    0x53, 0x61, 0x6c, 0x61, 0x61, 0x6d, 0x01, 0x04, 0x65, 0x6c, 0x68, 0x69, 0x02, 0x04, 0x6e, 0x76,
+    0x65, 0x72, 0x02, 0x05, 0x74, 0x72, 0x6f, 0x69, 0x74, 0x01, 0x04, 0x68, 0x61, 0x6b, 0x61, 0x01,
+    0x03, 0x6f, 0x68, 0x61, 0x02, 0x06, 0x6e, 0x67, 0x67, 0x75, 0x61, 0x6e, 0x01, 0x04, 0x75, 0x62,
+    0x61, 0x69, 0x03, 0x03, 0x6c, 0x69, 0x6e, 0x02, 0x08, 0x73, 0x73, 0x65, 0x6c, 0x64, 0x6f, 0x72,
+    0x66, 0x00, 0x09, 0x45, 0x64, 0x69, 0x6e, 0x62, 0x75, 0x72, 0x67, 0x68, 0x00, 0x09, 0x46, 0x6f,
+    0x72, 0x74, 0x61, 0x6c, 0x65, 0x7a, 0x61, 0x02, 0x04, 0x73, 0x68, 0x61, 0x6e, 0x01, 0x10, 0x72,
+    0x61, 0x6e, 0x6b, 0x66, 0x75, 0x72, 0x74, 0x20, 0x61, 0x6d, 0x20, 0x4d, 0x61, 0x69, 0x6e, 0x01,
+    0x06, 0x75, 0x6b, 0x75, 0x6f, 0x6b, 0x61, 0x00, 0x06, 0x47, 0x65, 0x6e, 0x65, 0x76, 0x61, 0x01,
+    0x06, 0x6c, 0x61, 0x73, 0x67, 0x6f, 0x77, 0x01, 0x0a, 0x75, 0x61, 0x64, 0x61, 0x6c, 0x61, 0x6a,
+    0x61, 0x72, 0x61, 0x03, 0x06, 0x6e, 0x67, 0x7a, 0x68, 0x6f, 0x75, 0x00, 0x07, 0x48, 0x61, 0x6d,
+    0x62, 0x75, 0x72, 0x67, 0x02, 0x06, 0x6e, 0x67, 0x7a, 0x68, 0x6f, 0x75, 0x03, 0x02, 0x6f, 0x69,
+    0x02, 0x04, 0x72, 0x62, 0x69, 0x6e, 0x02, 0x04, 0x76, 0x61, 0x6e, 0x61, 0x01, 0x07, 0x65, 0x6c,
+    0x73, 0x69, 0x6e, 0x6b, 0x69, 0x01, 0x0f, 0x6f, 0x20, 0x43, 0x68, 0x69, 0x20, 0x4d, 0x69, 0x6e,
+    0x68, 0x20, 0x43, 0x69, 0x74, 0x79, 0x00, 0x09, 0x48, 0x6f, 0x6e, 0x67, 0x20, 0x4b, 0x6f, 0x6e,
+    0x67, 0x03, 0x05, 0x6f, 0x6c, 0x75, 0x6c, 0x75, 0x02, 0x05, 0x75, 0x73, 0x74, 0x6f, 0x6e, 0x01,
+    0x08, 0x79, 0x64, 0x65, 0x72, 0x61, 0x62, 0x61, 0x64, 0x00, 0x07, 0x49, 0x6e, 0x63, 0x68, 0x65,
+    0x6f, 0x6e, 0x01, 0x07, 0x73, 0x74, 0x61, 0x6e, 0x62, 0x75, 0x6c, 0x00, 0x07, 0x4a, 0x61, 0x6b,
+    0x61, 0x72, 0x74, 0x61, 0x01, 0x05, 0x65, 0x64, 0x64, 0x61, 0x68, 0x02, 0x07, 0x72, 0x75, 0x73,
+    0x61, 0x6c, 0x65, 0x6d, 0x01, 0x04, 0x69, 0x6e, 0x61, 0x6e, 0x01, 0x0b, 0x6f, 0x68, 0x61, 0x6e,
+    0x6e, 0x65, 0x73, 0x62, 0x75, 0x72, 0x67, 0x00, 0x05, 0x4b, 0x61, 0x62, 0x75, 0x6c, 0x02, 0x02,
+    0x6e, 0x6f, 0x02, 0x05, 0x72, 0x61, 0x63, 0x68, 0x69, 0x02, 0x07, 0x74, 0x68, 0x6d, 0x61, 0x6e,
+    0x64, 0x75, 0x01, 0x07, 0x68, 0x61, 0x72, 0x74, 0x6f, 0x75, 0x6d, 0x00, 0x08, 0x4b, 0x69, 0x6e,
+    0x73, 0x68, 0x61, 0x73, 0x61, 0x01, 0x06, 0x6f, 0x6c, 0x6b, 0x61, 0x74, 0x61, 0x01, 0x05, 0x72,
+    0x61, 0x6b, 0x6f, 0x77, 0x01, 0x0b, 0x75, 0x61, 0x6c, 0x61, 0x20, 0x4c, 0x75, 0x6d, 0x70, 0x75,
+    0x72, 0x01, 0x03, 0x79, 0x69, 0x76, 0x02, 0x03, 0x6f, 0x74, 0x6f, 0x00, 0x06, 0x4c, 0x61, 0x20,
+    0x50, 0x61, 0x7a, 0x02, 0x03, 0x67, 0x6f, 0x73, 0x02, 0x04, 0x68, 0x6f, 0x72, 0x65, 0x02, 0x07,
+    0x73, 0x20, 0x56, 0x65, 0x67, 0x61, 0x73, 0x01, 0x04, 0x65, 0x65, 0x64, 0x73, 0x01, 0x03, 0x69,
+    0x6d, 0x61, 0x02, 0x04, 0x73, 0x62, 0x6f, 0x6e, 0x02, 0x07, 0x76, 0x65, 0x72, 0x70, 0x6f, 0x6f,
+    0x6c, 0x01, 0x05, 0x6f, 0x6e, 0x64, 0x6f, 0x6e, 0x06, 0x00, 0x00, 0x0b, 0x4c, 0x6f, 0x73, 0x20,
+    0x41, 0x6e, 0x67, 0x65, 0x6c, 0x65, 0x73, 0x01, 0x05, 0x75, 0x61, 0x6e, 0x64, 0x61, 0x01, 0x03,
+    0x79, 0x6f, 0x6e, 0x00, 0x06, 0x4d, 0x61, 0x64, 0x72, 0x69, 0x64, 0x02, 0x08, 0x6e, 0x63, 0x68,
+    0x65, 0x73, 0x74, 0x65, 0x72, 0x03, 0x03, 0x69, 0x6c, 0x61, 0x02, 0x07, 0x72, 0x73, 0x65, 0x69,
+    0x6c, 0x6c, 0x65, 0x01, 0x07, 0x65, 0x64, 0x65, 0x6c, 0x6c, 0x69, 0x6e, 0x02, 0x07, 0x6c, 0x62,
+    0x6f, 0x75, 0x72, 0x6e, 0x65, 0x02, 0x09, 0x78, 0x69, 0x63, 0x6f, 0x20, 0x43, 0x69, 0x74, 0x79,
+    0x01, 0x04, 0x69, 0x61, 0x6d, 0x69, 0x02, 0x03, 0x6c, 0x61, 0x6e, 0x02, 0x09, 0x6e, 0x6e, 0x65,
+    0x61, 0x70, 0x6f, 0x6c, 0x69, 0x73, 0x03, 0x02, 0x73, 0x6b, 0x01, 0x08, 0x6f, 0x6e, 0x74, 0x65,
+    0x72, 0x72, 0x65, 0x79, 0x05, 0x05, 0x76, 0x69, 0x64, 0x65, 0x6f, 0x00, 0x08, 0x4d, 0x6f, 0x6e,
+    0x74, 0x72, 0x65, 0x61, 0x6c, 0x02, 0x04, 0x73, 0x63, 0x6f, 0x77, 0x01, 0x05, 0x75, 0x6d, 0x62,
+    0x61, 0x69, 0x02, 0x04, 0x6e, 0x69, 0x63, 0x68, 0x00, 0x06, 0x4e, 0x61, 0x67, 0x6f, 0x79, 0x61,
+    0x02, 0x05, 0x69, 0x72, 0x6f, 0x62, 0x69, 0x02, 0x05, 0x6e, 0x6a, 0x69, 0x6e, 0x67, 0x02, 0x04,
+    0x70, 0x6c, 0x65, 0x73, 0x01, 0x0a, 0x65, 0x77, 0x20, 0x4f, 0x72, 0x6c, 0x65, 0x61, 0x6e, 0x73,
+    0x04, 0x09, 0x59, 0x6f, 0x72, 0x6b, 0x20, 0x43, 0x69, 0x74, 0x79, 0x01, 0x03, 0x69, 0x63, 0x65,
+    0x00, 0x05, 0x4f, 0x73, 0x61, 0x6b, 0x61, 0x02, 0x02, 0x6c, 0x6f, 0x01, 0x05, 0x74, 0x74, 0x61,
+    0x77, 0x61, 0x00, 0x05, 0x50, 0x61, 0x72, 0x69, 0x73, 0x01, 0x04, 0x65, 0x72, 0x74, 0x68, 0x00,
+    0x0c, 0x50, 0x68, 0x69, 0x6c, 0x61, 0x64, 0x65, 0x6c, 0x70, 0x68, 0x69, 0x61, 0x02, 0x05, 0x6f,
+    0x65, 0x6e, 0x69, 0x78, 0x01, 0x07, 0x6f, 0x72, 0x74, 0x6c, 0x61, 0x6e, 0x64, 0x04, 0x01, 0x6f,
+    0x01, 0x05, 0x72, 0x61, 0x67, 0x75, 0x65, 0x01, 0x03, 0x75, 0x6e, 0x65, 0x00, 0x07, 0x51, 0x69,
+    0x6e, 0x67, 0x64, 0x61, 0x6f, 0x01, 0x04, 0x75, 0x69, 0x74, 0x6f, 0x00, 0x06, 0x52, 0x65, 0x63,
+    0x69, 0x66, 0x65, 0x02, 0x07, 0x79, 0x6b, 0x6a, 0x61, 0x76, 0x69, 0x6b, 0x01, 0x03, 0x69, 0x67,
+    0x61, 0x02, 0x0c, 0x6f, 0x20, 0x64, 0x65, 0x20, 0x4a, 0x61, 0x6e, 0x65, 0x69, 0x72, 0x6f, 0x02,
+    0x04, 0x79, 0x61, 0x64, 0x68, 0x01, 0x03, 0x6f, 0x6d, 0x65, 0x02, 0x07, 0x74, 0x74, 0x65, 0x72,
+    0x64, 0x61, 0x6d, 0x00, 0x10, 0x53, 0x61, 0x69, 0x6e, 0x74, 0x20, 0x50, 0x65, 0x74, 0x65, 0x72,
+    0x73, 0x62, 0x75, 0x72, 0x67, 0x00, 0x08, 0x53, 0x61, 0x6c, 0x76, 0x61, 0x64, 0x6f, 0x72, 0x02,
+    0x09, 0x6e, 0x20, 0x41, 0x6e, 0x74, 0x6f, 0x6e, 0x69, 0x6f, 0x04, 0x05, 0x44, 0x69, 0x65, 0x67,
+    0x6f, 0x04, 0x09, 0x46, 0x72, 0x61, 0x6e, 0x63, 0x69, 0x73, 0x63, 0x6f, 0x04, 0x04, 0x4a, 0x6f,
+    0x73, 0x65, 0x03, 0x05, 0x74, 0x69, 0x61, 0x67, 0x6f, 0x04, 0x09, 0x6f, 0x20, 0x44, 0x6f, 0x6d,
+    0x69, 0x6e, 0x67, 0x6f, 0x02, 0x07, 0x6f, 0x20, 0x50, 0x61, 0x75, 0x6c, 0x6f, 0x02, 0x05, 0x70,
+    0x70, 0x6f, 0x72, 0x6f, 0x01, 0x06, 0x65, 0x61, 0x74, 0x74, 0x6c, 0x65, 0x02, 0x03, 0x6f, 0x75,
+    0x6c, 0x02, 0x05, 0x76, 0x69, 0x6c, 0x6c, 0x65, 0x01, 0x07, 0x68, 0x61, 0x6e, 0x67, 0x68, 0x61,
+    0x69, 0x02, 0x06, 0x65, 0x6e, 0x79, 0x61, 0x6e, 0x67, 0x04, 0x04, 0x7a, 0x68, 0x65, 0x6e, 0x01,
+    0x08, 0x69, 0x6e, 0x67, 0x61, 0x70, 0x6f, 0x72, 0x65, 0x00, 0x05, 0x53, 0x6f, 0x66, 0x69, 0x61,
+    0x01, 0x08, 0x74, 0x6f, 0x63, 0x6b, 0x68, 0x6f, 0x6c, 0x6d, 0x02, 0x07, 0x75, 0x74, 0x74, 0x67,
+    0x61, 0x72, 0x74, 0x01, 0x04, 0x75, 0x72, 0x61, 0x74, 0x02, 0x04, 0x7a, 0x68, 0x6f, 0x75, 0x01,
+    0x05, 0x79, 0x64, 0x6e, 0x65, 0x79, 0x00, 0x06, 0x54, 0x61, 0x69, 0x70, 0x65, 0x69, 0x02, 0x05,
+    0x6c, 0x6c, 0x69, 0x6e, 0x6e, 0x02, 0x06, 0x73, 0x68, 0x6b, 0x65, 0x6e, 0x74, 0x01, 0x05, 0x65,
+    0x68, 0x72, 0x61, 0x6e, 0x02, 0x06, 0x6c, 0x20, 0x41, 0x76, 0x69, 0x76, 0x01, 0x06, 0x69, 0x61,
+    0x6e, 0x6a, 0x69, 0x6e, 0x01, 0x04, 0x6f, 0x6b, 0x79, 0x6f, 0x02, 0x05, 0x72, 0x6f, 0x6e, 0x74,
+    0x6f, 0x02, 0x06, 0x75, 0x6c, 0x6f, 0x75, 0x73, 0x65, 0x01, 0x04, 0x75, 0x6e, 0x69, 0x73, 0x00,
+    0x05, 0x54, 0x75, 0x72, 0x69, 0x6e, 0x00, 0x0b, 0x55, 0x6c, 0x61, 0x61, 0x6e, 0x62, 0x61, 0x61,
+    0x74, 0x61, 0x72, 0x00, 0x08, 0x56, 0x61, 0x6c, 0x65, 0x6e, 0x63, 0x69, 0x61, 0x02, 0x07, 0x6e,
+    0x63, 0x6f, 0x75, 0x76, 0x65, 0x72, 0x01, 0x05, 0x69, 0x65, 0x6e, 0x6e, 0x61, 0x02, 0x05, 0x6c,
+    0x6e, 0x69, 0x75, 0x73, 0x00, 0x06, 0x57, 0x61, 0x72, 0x73, 0x61, 0x77, 0x02, 0x08, 0x73, 0x68,
+    0x69, 0x6e, 0x67, 0x74, 0x6f, 0x6e, 0x01, 0x09, 0x65, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x74, 0x6f,
+    0x6e, 0x01, 0x04, 0x75, 0x68, 0x61, 0x6e, 0x00, 0x05, 0x58, 0x69, 0x27, 0x61, 0x6e, 0x00, 0x06,
+    0x59, 0x61, 0x6e, 0x67, 0x6f, 0x6e, 0x01, 0x07, 0x6f, 0x6b, 0x6f, 0x68, 0x61, 0x6d, 0x61, 0x00,
+    0x06, 0x5a, 0x61, 0x67, 0x72, 0x65, 0x62, 0x01, 0x05, 0x75, 0x72, 0x69, 0x63, 0x68,
+};
+
+static const uint32_t CITY_INDEX_BLOCKS[] = {
+    0, 133, 254, 383, 497, 646, 779, 890,
+    1019, 1135, 1269, 1401, 1519,
+};
+
+static const CityRecord CITY_INDEX_RECORDS[] = {
+    {535, -400, 41, 164}, {2445, 5440, 82, 145}, {556, -20, 29, 157}, {902, 3875, 25, 161},
+    {-3493, 13860, 4, 152}, {2303, 7259, 34, 164}, {3120, 2992, 23, 165}, {3674, 309, 1, 157},
+    {4325, 7695, 43, 158}, {5237, 489, 53, 147}, {6122, -14990, 84, 137}, {3992, 3285, 80, 164},
+    {3798, 2373, 30, 146}, {3375, -8439, 84, 142}, {-3685, 17476, 54, 141}, {3027, -9774, 84, 149},
+    {3334, 4440, 37, 171}, {1297, 7759, 34, 168}, {1375, 10050, 78, 168}, {4139, 216, 71, 155},
+    {3991, 11640, 14, 182}, {5460, -593, 83, 136}, {4480, 2047, 67, 153}, {-1992, -4394, 10, 159},
+    {5252, 1341, 28, 163}, {5248, -190, 83, 150}, {3352, -8680, 84, 133}, {461, -7408, 15, 172},
+    {4236, -7106, 84, 146}, {-1578, -4793, 10, 159}, {-2747, 15303, 4, 159}, {5146, -260, 83, 145},
+    {5085, 435, 8, 150}, {4443, 2611, 63, 157}, {4750, 1904, 32, 156}, {-3461, -5838, 3, 178},
+    {3510, 12904, 70, 164}, {3006, 3125, 23, 172}, {5105, -11409, 12, 150}, {-3393, 1842, 69, 163},
+    {1049, -6688, 87, 162}, {5148, -318, 83, 141}, {3359, -762, 50, 162}, {3067, 10407, 14, 172},
+    {1309, 8028, 34, 166}, {4185, -8765, 84, 161}, {2234, 9184, 6, 165}, {2956, 10655, 14, 172},
+    {5093, 695, 28, 150}, {693, 7985, 72, 145}, {5568, 1257, 20, 152}, {1469, -1744, 66, 160},
+    {3891, 12160, 14, 165}, {3278, -9681, 84, 153}, {-682, 3927, 77, 166}, {2865, 7723, 34, 176},
+    {3974, -10498, 84, 146}, {4233, -8305, 84, 146}, {2371, 9041, 6, 175}, {2529, 5153, 62, 138},
+    {2302, 11375, 14, 173}, {2508, 5531, 82, 164}, {5333, -625, 38, 150}, {5122, 678, 28, 144},
+    {5595, -320, 83, 142}, {-372, -3854, 10, 160}, {2303, 11313, 14, 171}, {5012, 868, 28, 145},
+    {3361, 13042, 42, 154}, {4620, 615, 75, 132}, {5587, -426, 83, 144}, {2067, -10339, 48, 154},
+    {2312, 11325, 14, 176}, {5355, 1000, 28, 156}, {3029, 12016, 14, 170}, {2102, 10584, 88, 173},
+    {4575, 12665, 14, 169}, {2313, -8238, 17, 158}, {6017, 2494, 26, 144}, {1082, 10663, 88, 163},
+    {2228, 11417, 31, 171}, {2131, -15786, 84, 139}, {2976, -9536, 84, 159}, {1738, 7846, 34, 164},
+    {3746, 12671, 70, 160}, {4101, 2895, 80, 179}, {-621, 10685, 35, 173}, {2149, 3919, 65, 161},
+    {3177, 3522, 39, 148}, {3667, 11699, 14, 158}, {-2620, 2804, 69, 158}, {3453, 6917, 0, 162},
+    {1200, 852, 55, 164}, {2486, 6701, 57, 177}, {2770, 8532, 52, 154}, {1555, 3253, 73, 157},
+    {-433, 1531, 19, 172}, {2257, 8836, 34, 167}, {5006, 1994, 60, 147}, {314, 10169, 47, 154},
+    {5045, 3052, 81, 161}, {3502, 13575, 42, 154}, {-1650, -6815, 9, 148}, {645, 339, 55, 174},
+    {3155, 7434, 57, 170}, {3617, -11514, 84, 145}, {5380, -155, 83, 141}, {-1204, -7703, 58, 172},
+    {3872, -913, 61, 143}, {5341, -298, 83, 148}, {5151, -13, 83, 174}, {4298, -8123, 12, 139},
+    {3405, -11824, 84, 165}, {-884, 1323, 2, 161}, {4575, 485, 27, 142}, {4042, -370, 71, 163},
+    {5348, -224, 83, 140}, {1460, 12098, 59, 155}, {4330, 538, 27, 148}, {625, -7556, 15, 158},
+    {-3781, 14496, 4, 167}, {1943, -9913, 48, 177}, {2577, -8019, 84, 141}, {4546, 919, 40, 152},
+    {4498, -9326, 84, 140}, {5390, 2757, 7, 156}, {2567, -10032, 48, 151}, {-3490, -5619, 85, 153},
+    {4551, -7359, 12, 156}, {5575, 3762, 64, 175}, {1907, 7288, 34, 178}, {4814, 1158, 28, 153},
+    {3518, 13691, 42, 159}, {-128, 3682, 44, 161}, {3206, 11878, 14, 171}, {4085, 1427, 40, 150},
+    {2995, -9008, 84, 140}, {4071, -7401, 84, 174}, {4370, 727, 27, 138}, {3469, 13550, 42, 160},
+    {5991, 1075, 56, 144}, {4541, -7570, 12, 148}, {4885, 235, 27, 158}, {-3195, 11586, 4, 157},
+    {3995, -7516, 84, 155}, {3345, -11207, 84, 156}, {4552, -12268, 84, 145}, {4115, -861, 61, 135},
+    {5009, 1442, 18, 152}, {1852, 7386, 34, 162}, {3607, 12037, 14, 164}, {-23, -7852, 22, 154},
+    {-805, -3488, 10, 154}, {6414, -2190, 33, 127}, {5695, 2411, 45, 147}, {-2291, -4318, 10, 171},
+    {2469, 4672, 65, 166}, {4189, 1251, 40, 159}, {5192, 448, 53, 144}, {5994, 3031, 64, 168},
+    {-1297, -3851, 10, 161}, {2942, -9849, 84, 154}, {3272, -11716, 84, 154}, {3777, -12242, 84, 149},
+    {3734, -12189, 84, 150}, {-3346, -7065, 13, 167}, {1847, -6989, 21, 159}, {-2355, -4664, 10, 175},
+    {4306, 14135, 42, 157}, {4761, -12233, 84, 147}, {3757, 12698, 70, 175}, {3738, -597, 71, 146},
+    {3122, 12146, 14, 184}, {4179, 12343, 14, 170}, {2255, 11407, 14, 175}, {129, 10385, 68, 164},
+    {4270, 2332, 11, 152}, {5933, 1807, 74, 150}, {4878, 918, 28, 144}, {2120, 7283, 34, 162},
+    {3130, 12060, 14, 166}, {-3387, 15121, 4, 168}, {2505, 12153, 76, 172}, {5944, 2475, 24, 140},
+    {4126, 6922, 86, 157}, {3569, 5142, 36, 171}, {3208, 3478, 39, 141}, {3914, 11718, 14, 176},
+    {3569, 13969, 42, 173}, {4370, -7942, 12, 160}, {4360, 144, 27, 141}, {3682, 1017, 79, 146},
+    {4507, 769, 40, 148}, {4791, 10688, 49, 148}, {3947, -38, 71, 148}, {4925, -12312, 12, 144},
+    {4821, 1637, 5, 156}, {5469, 2528, 46, 143}, {5223, 2101, 60, 156}, {3890, -7704, 84, 146},
+    {-4129, 17478, 54, 140}, {3058, 11427, 14, 173}, {3426, 10893, 14, 170}, {1681, 9616, 51, 166},
+    {3544, 13964, 42, 164}, {4581, 1598, 16, 146}, {4737, 855, 75, 138},
+};
+
+static const char* const CITY_INDEX_COUNTRIES[] = {
+    "Afghanistan",
+    "Algeria",
+    "Angola",
+    "Argentina",
+    "Australia",
+    "Austria",
+    "Bangladesh",
+    "Belarus",
+    "Belgium",
+    "Bolivia",
+    "Brazil",
+    "Bulgaria",
+    "Canada",
+    "Chile",
+    "China",
+    "Colombia",
+    "Croatia",
+    "Cuba",
+    "Czechia",
+    "DR Congo",
+    "Denmark",
+    "Dominican Republic",
+    "Ecuador",
+    "Egypt",
+    "Estonia",
+    "Ethiopia",
+    "Finland",
+    "France",
+    "Germany",
+    "Ghana",
+    "Greece",
+    "Hong Kong",
+    "Hungary",
+    "Iceland",
+    "India",
+    "Indonesia",
+    "Iran",
+    "Iraq",
+    "Ireland",
+    "Israel",
+    "Italy",
+    "Ivory Coast",
+    "Japan",
+    "Kazakhstan",
+    "Kenya",
+    "Latvia",
+    "Lithuania",
+    "Malaysia",
+    "Mexico",
+    "Mongolia",
+    "Morocco",
+    "Myanmar",
+    "Nepal",
+    "Netherlands",
+    "New Zealand",
+    "Nigeria",
+    "Norway",
+    "Pakistan",
+    "Peru",
+    "Philippines",
+    "Poland",
+    "Portugal",
+    "Qatar",
+    "Romania",
+    "Russia",
+    "Saudi Arabia",
+    "Senegal",
+    "Serbia",
+    "Singapore",
+    "South Africa",
+    "South Korea",
+    "Spain",
+    "Sri Lanka",
+    "Sudan",
+    "Sweden",
+    "Switzerland",
+    "Taiwan",
+    "Tanzania",
+    "Thailand",
+    "Tunisia",
+    "Turkey",
+    "Ukraine",
+    "United Arab Emirates",
+    "United Kingdom",
+    "United States",
+    "Uruguay",
+    "Uzbekistan",
+    "Venezuela",
+    "Vietnam",
+};
+
+static const CityIndexData CITY_INDEX_DATA = {
+    CITY_INDEX_NAMES, sizeof(CITY_INDEX_NAMES), CITY_INDEX_BLOCKS, 13,
+    CITY_INDEX_RECORDS, 207, CITY_INDEX_COUNTRIES, 89,
+};
+
+#endif // CITY_INDEX_DATA_H
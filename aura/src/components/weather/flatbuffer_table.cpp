@@ -0,0 +1,108 @@
+#include "flatbuffer_table.h"
+
+static constexpr size_t OFFSET_SIZE = sizeof(uint32_t);
+static constexpr size_t VTABLE_HEADER_SIZE = 2 * sizeof(uint16_t);
+
+FlatTable::FlatTable(const uint8_t* data, size_t size, size_t position)
+    : data_(nullptr), size_(size), position_(position), vtable_(0), vtable_size_(0),
+      table_size_(0) {
+    if (!data || position > size || size - position < OFFSET_SIZE) {
+        return;
+    }
+
+    // The table starts with a signed offset back (or forward) to its vtable
+    int32_t vtable_offset;
+    memcpy(&vtable_offset, data + position, sizeof(vtable_offset));
+    int64_t vtable = (int64_t) position - vtable_offset;
+    if (vtable < 0 || (uint64_t) vtable + VTABLE_HEADER_SIZE > size) {
+        return;
+    }
+
+    uint16_t vtable_size, table_size;
+    memcpy(&vtable_size, data + vtable, sizeof(vtable_size));
+    memcpy(&table_size, data + vtable + sizeof(uint16_t), sizeof(table_size));
+    if (vtable_size < VTABLE_HEADER_SIZE || (size_t) vtable + vtable_size > size ||
+        table_size < OFFSET_SIZE || table_size > size - position) {
+        return;
+    }
+
+    data_ = data;
+    vtable_ = (size_t) vtable;
+    vtable_size_ = vtable_size;
+    table_size_ = table_size;
+}
+
+FlatTable FlatTable::root(const uint8_t* data, size_t size) {
+    if (!data || size < OFFSET_SIZE) {
+        return FlatTable();
+    }
+    uint32_t offset;
+    memcpy(&offset, data, sizeof(offset));
+    return FlatTable(data, size, offset);
+}
+
+size_t FlatTable::fieldPosition(uint16_t field, size_t width) const {
+    if (!data_) {
+        return 0;
+    }
+    size_t entry = VTABLE_HEADER_SIZE + field * sizeof(uint16_t);
+    if (entry + sizeof(uint16_t) > vtable_size_) {
+        return 0;  // Field newer than the writer's schema
+    }
+
+    uint16_t offset;
+    memcpy(&offset, data_ + vtable_ + entry, sizeof(offset));
+    if (offset == 0 || offset + width > table_size_) {
+        return 0;  // Absent (default value) or truncated
+    }
+    return position_ + offset;
+}
+
+size_t FlatTable::followOffset(size_t position) const {
+    uint32_t offset;
+    memcpy(&offset, data_ + position, sizeof(offset));
+    if (offset > size_ - position) {
+        return 0;
+    }
+    return position + offset;
+}
+
+FlatTable FlatTable::table(uint16_t field) const {
+    size_t position = fieldPosition(field, OFFSET_SIZE);
+    if (!position) {
+        return FlatTable();
+    }
+    size_t target = followOffset(position);
+    return target ? FlatTable(data_, size_, target) : FlatTable();
+}
+
+FlatVector FlatTable::vector(uint16_t field, size_t element_size) const {
+    FlatVector empty = {0, 0};
+    size_t position = fieldPosition(field, OFFSET_SIZE);
+    if (!position) {
+        return empty;
+    }
+
+    size_t target = followOffset(position);
+    if (!target || size_ - target < OFFSET_SIZE) {
+        return empty;
+    }
+
+    uint32_t length;
+    memcpy(&length, data_ + target, sizeof(length));
+    size_t elements = target + OFFSET_SIZE;
+    if (length > (size_ - elements) / element_size) {
+        return empty;
+    }
+
+    FlatVector result = {elements, length};
+    return result;
+}
+
+FlatTable FlatTable::tableAt(const FlatVector& vector, size_t index) const {
+    if (!data_ || index >= vector.length) {
+        return FlatTable();
+    }
+    size_t target = followOffset(vector.position + index * OFFSET_SIZE);
+    return target ? FlatTable(data_, size_, target) : FlatTable();
+}
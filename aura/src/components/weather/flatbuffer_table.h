@@ -0,0 +1,67 @@
+#ifndef FLATBUFFER_TABLE_H
+#define FLATBUFFER_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Span of vector elements inside a FlatBuffer (position of element 0 and count)
+struct FlatVector {
+    size_t position;
+    size_t length;
+};
+
+// Minimal read-only view of a FlatBuffers table.
+//
+// Open-Meteo's FlatBuffers responses are read in place from the receive buffer,
+// so this only implements the handful of lookups the forecast schema needs.
+// Every offset is bounds-checked against the buffer because the bytes come
+// straight off the network; a bad offset yields an invalid table, an empty
+// vector or the fallback value instead of an out-of-range read. The ESP32 is
+// little-endian like the wire format, so scalars are copied as-is.
+class FlatTable {
+public:
+    FlatTable() : data_(nullptr), size_(0), position_(0), vtable_(0), vtable_size_(0), table_size_(0) {}
+    FlatTable(const uint8_t* data, size_t size, size_t position);
+
+    // Table referenced by the root offset at the start of the buffer
+    static FlatTable root(const uint8_t* data, size_t size);
+
+    bool isValid() const { return data_ != nullptr; }
+    bool hasField(uint16_t field) const { return fieldPosition(field, 1) != 0; }
+
+    template <typename T>
+    T scalar(uint16_t field, T fallback) const {
+        size_t position = fieldPosition(field, sizeof(T));
+        return position ? read<T>(position) : fallback;
+    }
+
+    FlatTable table(uint16_t field) const;
+    FlatVector vector(uint16_t field, size_t element_size) const;
+
+    // Element access for vectors returned by vector()
+    FlatTable tableAt(const FlatVector& vector, size_t index) const;
+    float floatAt(const FlatVector& vector, size_t index) const {
+        return read<float>(vector.position + index * sizeof(float));
+    }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t position_;
+    size_t vtable_;
+    uint16_t vtable_size_;
+    uint16_t table_size_;
+
+    size_t fieldPosition(uint16_t field, size_t width) const;
+    size_t followOffset(size_t position) const;
+
+    template <typename T>
+    T read(size_t position) const {
+        T value;
+        memcpy(&value, data_ + position, sizeof(T));
+        return value;
+    }
+};
+
+#endif // FLATBUFFER_TABLE_H
@@ -0,0 +1,123 @@
+#include "hedged_fetch.h"
+#include <math.h>
+#include <string.h>
+
+LatencyHistogram::LatencyHistogram() : counts_(), total_(0), samples_(0) {}
+
+uint32_t LatencyHistogram::bucketLimit(size_t bucket) {
+    return (uint32_t) lroundf(16.0f * exp2f(bucket / 4.0f));
+}
+
+void LatencyHistogram::record(uint32_t ms) {
+    size_t bucket = 0;
+    if (ms > 16) {
+        bucket = (size_t) ceilf(4.0f * log2f(ms / 16.0f));
+        if (bucket >= BUCKETS) {
+            bucket = BUCKETS - 1;
+        }
+    }
+    counts_[bucket]++;
+    total_++;
+    samples_++;
+
+    if (total_ >= DECAY_AT) {
+        total_ = 0;
+        for (uint16_t& count : counts_) {
+            count /= 2;
+            total_ += count;
+        }
+    }
+}
+
+uint32_t LatencyHistogram::percentile(float fraction) const {
+    if (total_ == 0) {
+        return 0;
+    }
+    uint32_t wanted = (uint32_t) ceilf(fraction * total_);
+    uint32_t seen = 0;
+    for (size_t bucket = 0; bucket < BUCKETS; bucket++) {
+        seen += counts_[bucket];
+        if (seen >= wanted && seen > 0) {
+            return bucketLimit(bucket);
+        }
+    }
+    return bucketLimit(BUCKETS - 1);
+}
+
+HedgedFetch::HedgedFetch(const HedgePolicy& policy, Clock clock, Sleep sleep)
+    : policy_(policy), clock_(clock), sleep_(sleep) {}
+
+uint32_t HedgedFetch::hedgeDelayMs(const LatencyHistogram& primary) const {
+    if (primary.count() < policy_.min_samples) {
+        return policy_.default_delay_ms;
+    }
+    uint32_t delay = primary.percentile(policy_.percentile);
+    if (delay < policy_.min_delay_ms) {
+        return policy_.min_delay_ms;
+    }
+    return delay > policy_.max_delay_ms ? policy_.max_delay_ms : delay;
+}
+
+HedgedOutcome HedgedFetch::race(HedgedRequest& primary, HedgedRequest* secondary,
+                                uint32_t timeoutMs) {
+    HedgedRequest* requests[2] = {&primary, secondary};
+    bool started[2] = {false, false};
+    bool failed[2] = {false, secondary == nullptr};
+    uint32_t started_ms[2] = {0, 0};
+
+    // start() blocks while it connects, so the clocks start once the request
+    // is out: a cold TLS handshake is not taken for a late response
+    HedgedOutcome outcome = {-1, false, hedgeDelayMs(primary.latency()), 0};
+    failed[0] = !primary.start();
+    uint32_t begin = clock_();
+    started[0] = true;
+    started_ms[0] = begin;
+
+    for (;;) {
+        uint32_t now = clock_();
+        for (int i = 0; i < 2; i++) {
+            if (!started[i] || failed[i]) {
+                continue;
+            }
+            HedgedPoll state = requests[i]->poll();
+            if (state == HEDGE_FAILED) {
+                failed[i] = true;
+                continue;
+            }
+            if (state != HEDGE_READY) {
+                continue;
+            }
+
+            now = clock_();
+            outcome.winner = i;
+            outcome.first_byte_ms = now - started_ms[i];
+            requests[i]->latency().record(outcome.first_byte_ms);
+            int other = 1 - i;
+            if (started[other] && !failed[other]) {
+                requests[other]->cancel();
+                requests[other]->latency().record(now - started_ms[other]);
+            }
+            return outcome;
+        }
+
+        // Ask the secondary once the primary is late or has given up
+        if (secondary && !started[1] && (failed[0] || now - begin >= outcome.hedge_delay_ms)) {
+            outcome.hedged = true;
+            started[1] = true;
+            failed[1] = !secondary->start();
+            started_ms[1] = clock_();
+            continue;
+        }
+
+        if ((failed[0] && failed[1]) || now - begin >= timeoutMs) {
+            for (int i = 0; i < 2; i++) {
+                if (started[i] && !failed[i]) {
+                    requests[i]->cancel();
+                    requests[i]->latency().record(now - started_ms[i]);
+                }
+            }
+            return outcome;
+        }
+        sleep_(POLL_MS);
+    }
+}
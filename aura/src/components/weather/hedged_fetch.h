@@ -0,0 +1,93 @@
+#ifndef HEDGED_FETCH_H
+#define HEDGED_FETCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Time-to-first-byte histogram for one provider. Buckets grow by a quarter
+// octave from 16 ms to about 16 s. Counts are halved once they add up to
+// DECAY_AT, so the percentiles follow recent behaviour.
+class LatencyHistogram {
+public:
+    static constexpr size_t BUCKETS = 41;
+    static constexpr uint32_t DECAY_AT = 256;
+
+    LatencyHistogram();
+
+    void record(uint32_t ms);
+    // Upper bound of the bucket holding the given fraction of samples
+    uint32_t percentile(float fraction) const;
+    uint32_t count() const { return total_; }
+    uint32_t samples() const { return samples_; }
+
+    static uint32_t bucketLimit(size_t bucket);
+
+private:
+    uint16_t counts_[BUCKETS];
+    uint32_t total_;
+    uint32_t samples_;  // Ever recorded, for logging
+};
+
+enum HedgedPoll : int8_t { HEDGE_FAILED = -1, HEDGE_WAITING = 0, HEDGE_READY = 1 };
+
+// One provider's side of a race. start() connects and sends the request,
+// blocking until it is out; poll() then reports HEDGE_READY once a usable
+// response has started. The winner is left open for the caller to read.
+class HedgedRequest {
+public:
+    virtual ~HedgedRequest() {}
+    virtual bool start() = 0;
+    virtual HedgedPoll poll() = 0;
+    virtual void cancel() = 0;
+    virtual LatencyHistogram& latency() = 0;
+};
+
+struct HedgePolicy {
+    uint32_t min_delay_ms;
+    uint32_t max_delay_ms;
+    uint32_t default_delay_ms;  // Until min_samples responses have been timed
+    uint32_t min_samples;
+    float percentile;
+};
+
+struct HedgedOutcome {
+    int8_t winner;             // 0 primary, 1 secondary, -1 neither answered
+    bool hedged;               // The secondary was asked
+    uint32_t hedge_delay_ms;
+    uint32_t first_byte_ms;    // The winner's, from its own start
+};
+
+// Hedged requests for tail latency: the secondary is only asked when the
+// primary has not started answering by its usual worst case (a percentile
+// of its own history), or has failed outright. Whichever answers first
+// wins and the other is cancelled. A cancelled request is recorded at the
+// time it was abandoned, a lower bound, so a slowing primary still pushes
+// its threshold up.
+//
+// Times run from the end of start(), so the threshold and the histograms
+// cover time to first byte only. Connecting is not raced: nothing is polled
+// while either start() blocks, and a primary that cannot connect at all is
+// only hedged once its own connect has timed out.
+//
+// Clock and sleep are passed in so the same code runs on the device and in
+// tools/hedged_fetch_sim.cpp against local stand-in servers.
+class HedgedFetch {
+public:
+    typedef uint32_t (*Clock)();
+    typedef void (*Sleep)(uint32_t ms);
+
+    HedgedFetch(const HedgePolicy& policy, Clock clock, Sleep sleep);
+
+    uint32_t hedgeDelayMs(const LatencyHistogram& primary) const;
+    // secondary may be nullptr to run the primary alone
+    HedgedOutcome race(HedgedRequest& primary, HedgedRequest* secondary, uint32_t timeoutMs);
+
+private:
+    static constexpr uint32_t POLL_MS = 5;
+
+    HedgePolicy policy_;
+    Clock clock_;
+    Sleep sleep_;
+};
+
+#endif // HEDGED_FETCH_H
@@ -0,0 +1,167 @@
+#include "http_timing.h"
+#include "../logging/logging.h"
+
+// Fills stats from up to HTTP_TIMING_RING_SIZE values, sorting them in place
+static void phaseStats(uint32_t* values, size_t count, HttpPhaseStats& stats) {
+    stats = {};
+    if (count == 0) {
+        return;
+    }
+    uint64_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t value = values[i];
+        size_t j = i;
+        while (j > 0 && values[j - 1] > value) {
+            values[j] = values[j - 1];
+            j--;
+        }
+        values[j] = value;
+        total += value;
+    }
+    // Nearest rank
+    size_t rank = (count * 95 + 99) / 100;
+    stats.count = count;
+    stats.min_ms = values[0];
+    stats.avg_ms = (uint32_t) (total / count);
+    stats.p95_ms = values[rank - 1];
+}
+
+HttpTimingRing::HttpTimingRing() : entries_(), next_(0), count_(0) {
+    portMUX_INITIALIZE(&lock_);
+}
+
+HttpTimingRing& HttpTimingRing::shared() {
+    static HttpTimingRing ring;
+    return ring;
+}
+
+void HttpTimingRing::record(const HttpTiming& timing) {
+    portENTER_CRITICAL(&lock_);
+    entries_[next_] = timing;
+    next_ = (next_ + 1) % HTTP_TIMING_RING_SIZE;
+    if (count_ < HTTP_TIMING_RING_SIZE) {
+        count_++;
+    }
+    portEXIT_CRITICAL(&lock_);
+}
+
+size_t HttpTimingRing::copy(HttpTiming* out, size_t capacity) const {
+    portENTER_CRITICAL(&lock_);
+    size_t count = min(count_, capacity);
+    size_t first = (next_ + HTTP_TIMING_RING_SIZE - count) % HTTP_TIMING_RING_SIZE;
+    for (size_t i = 0; i < count; i++) {
+        out[i] = entries_[(first + i) % HTTP_TIMING_RING_SIZE];
+    }
+    portEXIT_CRITICAL(&lock_);
+    return count;
+}
+
+bool HttpTimingRing::summarise(const char* host, HttpTimingSummary& summary) const {
+    HttpTiming entries[HTTP_TIMING_RING_SIZE];
+    size_t count = copy(entries, HTTP_TIMING_RING_SIZE);
+    return summariseEntries(entries, count, host, summary);
+}
+
+bool HttpTimingRing::summariseEntries(const HttpTiming* entries, size_t count, const char* host,
+                                      HttpTimingSummary& summary) {
+    summary = {};
+    uint32_t dns[HTTP_TIMING_RING_SIZE];
+    uint32_t handshake[HTTP_TIMING_RING_SIZE];
+    uint32_t first_byte[HTTP_TIMING_RING_SIZE];
+    uint32_t body[HTTP_TIMING_RING_SIZE];
+    size_t connections = 0;
+    size_t responses = 0;
+    size_t completed = 0;
+    uint64_t bytes = 0;
+
+    // A phase only counts for requests that got through it
+    for (size_t i = 0; i < count; i++) {
+        const HttpTiming& timing = entries[i];
+        if (strcmp(timing.host, host) != 0) {
+            continue;
+        }
+        summary.requests++;
+        if (timing.result != HTTP_TIMING_OK || timing.status >= 400) {
+            summary.failures++;
+        }
+        if (!timing.reused && timing.result != HTTP_TIMING_DNS_FAILED &&
+            timing.result != HTTP_TIMING_CONNECT_FAILED) {
+            dns[connections] = timing.dns_ms;
+            handshake[connections++] = timing.handshake_ms;
+        }
+        if (timing.status != 0) {
+            first_byte[responses++] = timing.first_byte_ms;
+        }
+        if (timing.result == HTTP_TIMING_OK) {
+            body[completed++] = timing.body_ms;
+            bytes += timing.bytes;
+        }
+    }
+
+    phaseStats(dns, connections, summary.dns);
+    phaseStats(handshake, connections, summary.handshake);
+    phaseStats(first_byte, responses, summary.first_byte);
+    phaseStats(body, completed, summary.body);
+    summary.avg_bytes = completed ? (uint32_t) (bytes / completed) : 0;
+    return summary.requests > 0;
+}
+
+void HttpTimingRing::log(bool recent) const {
+    HttpTiming entries[HTTP_TIMING_RING_SIZE];
+    size_t count = copy(entries, HTTP_TIMING_RING_SIZE);
+    if (count == 0) {
+        LOG_WEATHER_I("HTTP timing: no requests yet");
+        return;
+    }
+
+    // Hosts in the order they first appear; clients hold their host strings
+    // for their lifetime, so the pointers can be compared
+    const char* hosts[HTTP_TIMING_RING_SIZE];
+    size_t host_count = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t h = 0;
+        while (h < host_count && hosts[h] != entries[i].host) {
+            h++;
+        }
+        if (h == host_count) {
+            hosts[host_count++] = entries[i].host;
+        }
+    }
+
+    for (size_t h = 0; h < host_count; h++) {
+        HttpTimingSummary s;
+        summariseEntries(entries, count, hosts[h], s);
+        LOG_WEATHER_I("HTTP %s: %u requests, %u failed, %u new connections; min/avg/p95 ms: "
+                      "DNS %u/%u/%u, connect+TLS %u/%u/%u, first byte %u/%u/%u, "
+                      "body %u/%u/%u; avg %u bytes", hosts[h], s.requests, s.failures,
+                      s.dns.count, s.dns.min_ms, s.dns.avg_ms, s.dns.p95_ms,
+                      s.handshake.min_ms, s.handshake.avg_ms, s.handshake.p95_ms,
+                      s.first_byte.min_ms, s.first_byte.avg_ms, s.first_byte.p95_ms,
+                      s.body.min_ms, s.body.avg_ms, s.body.p95_ms, s.avg_bytes);
+    }
+
+    if (!recent) {
+        return;
+    }
+    uint32_t now = millis();
+    for (size_t i = 0; i < count; i++) {
+        const HttpTiming& t = entries[i];
+        LOG_WEATHER_I("  %6lu s ago %s: %s, HTTP %d, DNS %u, connect+TLS %u, first byte %u, "
+                      "body %u ms, %u bytes%s", (unsigned long) ((now - t.started_ms) / 1000),
+                      t.host, resultName(t.result), t.status, t.dns_ms, t.handshake_ms,
+                      t.first_byte_ms, t.body_ms, t.bytes, t.reused ? " (reused)" : "");
+    }
+}
+
+const char* HttpTimingRing::resultName(HttpTimingResult result) {
+    switch (result) {
+        case HTTP_TIMING_OK: return "ok";
+        case HTTP_TIMING_DNS_FAILED: return "DNS failed";
+        case HTTP_TIMING_CONNECT_FAILED: return "connect failed";
+        case HTTP_TIMING_SEND_FAILED: return "send failed";
+        case HTTP_TIMING_NO_RESPONSE: return "no response";
+        case HTTP_TIMING_BODY_FAILED: return "body failed";
+        case HTTP_TIMING_CANCELLED: return "cancelled";
+    }
+    return "?";
+}
@@ -0,0 +1,80 @@
+#ifndef HTTP_TIMING_H
+#define HTTP_TIMING_H
+
+#include "../../config.h"
+#include <Arduino.h>
+
+// How a request ended, beside its HTTP status
+enum HttpTimingResult : int8_t {
+    HTTP_TIMING_OK = 0,
+    HTTP_TIMING_DNS_FAILED,
+    HTTP_TIMING_CONNECT_FAILED,
+    HTTP_TIMING_SEND_FAILED,
+    HTTP_TIMING_NO_RESPONSE,
+    HTTP_TIMING_BODY_FAILED,
+    HTTP_TIMING_CANCELLED,  // Dropped by the caller, e.g. the loser of a hedged fetch
+};
+
+// Phases of one request, in ms. The TCP connect and the TLS handshake run
+// inside one WiFiClientSecure::connect() call, so they are timed together.
+struct HttpTiming {
+    const char* host;
+    uint32_t started_ms;
+    uint32_t dns_ms;         // Both 0 when a kept-alive connection was reused
+    uint32_t handshake_ms;
+    uint32_t first_byte_ms;  // Request written to status line read
+    uint32_t body_ms;        // Status line to the end of the body
+    uint32_t bytes;          // Body bytes on the wire, before decoding
+    int16_t status;          // 0 if no response arrived
+    HttpTimingResult result;
+    bool reused;
+};
+
+struct HttpPhaseStats {
+    uint16_t count;  // Requests that went through this phase
+    uint32_t min_ms;
+    uint32_t avg_ms;
+    uint32_t p95_ms;
+};
+
+struct HttpTimingSummary {
+    uint16_t requests;
+    uint16_t failures;
+    HttpPhaseStats dns;
+    HttpPhaseStats handshake;
+    HttpPhaseStats first_byte;
+    HttpPhaseStats body;
+    uint32_t avg_bytes;
+};
+
+// The last HTTP_TIMING_RING_SIZE requests from every HttpsClient, oldest
+// overwritten first. Clients record from the weather and search tasks; the
+// summary is read from the loop, so entries are copied under a spinlock.
+class HttpTimingRing {
+public:
+    HttpTimingRing();
+
+    static HttpTimingRing& shared();
+
+    void record(const HttpTiming& timing);
+    // Oldest first; returns how many were copied
+    size_t copy(HttpTiming* out, size_t capacity) const;
+    // Per-phase min/avg/p95 over the recorded requests to one host
+    bool summarise(const char* host, HttpTimingSummary& summary) const;
+
+    // One line per host, and with recent set every entry as well
+    void log(bool recent) const;
+
+    static const char* resultName(HttpTimingResult result);
+
+private:
+    HttpTiming entries_[HTTP_TIMING_RING_SIZE];
+    size_t next_;
+    size_t count_;
+    mutable portMUX_TYPE lock_;
+
+    static bool summariseEntries(const HttpTiming* entries, size_t count, const char* host,
+                                 HttpTimingSummary& summary);
+};
+
+#endif // HTTP_TIMING_H
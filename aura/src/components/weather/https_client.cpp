@@ -0,0 +1,452 @@
+#include "https_client.h"
+#include "../logging/logging.h"
+
+HttpsClient::HttpsClient(const char* host, uint16_t port)
+    : host_(host), port_(port), body_(*this), connected_(false), last_used_(0),
+      idle_timeout_ms_(HTTPS_IDLE_TIMEOUT_MS), response_open_(false), status_code_(0),
+      keep_alive_(false), chunked_(false), body_remaining_(0), chunk_remaining_(0),
+      chunk_started_(false), body_complete_(true), body_failed_(false), body_bytes_(0),
+      receive_position_(0), receive_length_(0), reusing_(false), timing_(), timing_open_(false),
+      sent_ms_(0), head_ms_(0) {
+    memset(&stats_, 0, sizeof(stats_));
+    // Certificates are not pinned, matching the previous HTTPClient behaviour
+    client_.setInsecure();
+    client_.setHandshakeTimeout(HTTPS_IO_TIMEOUT_MS / 1000);
+}
+
+HttpsClient::~HttpsClient() {
+    stop();
+}
+
+bool HttpsClient::get(const String& path) {
+    return send(path) && receive();
+}
+
+bool HttpsClient::send(const String& path) {
+    if (response_open_) {
+        end();
+    }
+    finishTiming(HTTP_TIMING_CANCELLED);
+    stats_.requests++;
+
+    reusing_ = connected_ && !idleExpired() && client_.connected();
+    if (connected_ && !reusing_) {
+        disconnect();
+    }
+    pending_path_ = path;
+    timing_ = {};
+    timing_.host = host_;
+    timing_.started_ms = millis();
+    timing_.reused = reusing_;
+    timing_open_ = true;
+
+    if (!connected_ && !connect()) {
+        return false;
+    }
+    if (sendRequest(path)) {
+        return true;
+    }
+    disconnect();
+    if (reusing_) {
+        return resend();
+    }
+    LOG_WEATHER_E("%s: could not send GET", host_);
+    finishTiming(HTTP_TIMING_SEND_FAILED);
+    return false;
+}
+
+int HttpsClient::responseState() {
+    if (receive_position_ < receive_length_ || client_.available() > 0) {
+        return 1;
+    }
+    if (client_.connected()) {
+        return 0;
+    }
+    // A kept-alive connection the server had already closed gets one retry
+    if (reusing_ && resend()) {
+        return 0;
+    }
+    finishTiming(HTTP_TIMING_NO_RESPONSE);
+    return -1;
+}
+
+bool HttpsClient::receive() {
+    for (;;) {
+        if (readResponseHead()) {
+            if (reusing_) {
+                stats_.reused++;
+                LOG_WEATHER_D("%s: reused kept-alive connection", host_);
+            }
+            return true;
+        }
+
+        disconnect();
+        if (!reusing_) {
+            LOG_WEATHER_E("%s: no valid response to GET", host_);
+            finishTiming(HTTP_TIMING_NO_RESPONSE);
+            return false;
+        }
+        if (!resend()) {
+            return false;
+        }
+    }
+}
+
+bool HttpsClient::resend() {
+    // The server dropped the idle connection since the last request
+    stats_.idle_reconnects++;
+    LOG_WEATHER_D("%s: kept-alive connection was closed, reconnecting", host_);
+    reusing_ = false;
+    disconnect();
+    if (connect() && sendRequest(pending_path_)) {
+        return true;
+    }
+    disconnect();
+    finishTiming(HTTP_TIMING_SEND_FAILED);
+    return false;
+}
+
+void HttpsClient::end() {
+    if (!response_open_) {
+        return;
+    }
+
+    // Parsers stop at the end of the document; consume whatever framing or
+    // trailing bytes remain so the next response starts at a clean boundary
+    uint8_t scratch[64];
+    size_t drained = 0;
+    while (!body_complete_ && !body_failed_ && drained < MAX_DRAIN_BYTES) {
+        size_t count = readBody(scratch, sizeof(scratch));
+        if (count == 0) {
+            break;
+        }
+        drained += count;
+    }
+
+    response_open_ = false;
+    last_used_ = millis();
+    timing_.body_ms = last_used_ - head_ms_;
+    timing_.bytes = body_bytes_;
+    if (body_failed_) {
+        finishTiming(HTTP_TIMING_BODY_FAILED);
+    } else {
+        // A parser that stopped early leaves the rest unread
+        finishTiming(body_complete_ ? HTTP_TIMING_OK : HTTP_TIMING_CANCELLED);
+    }
+    if (!keep_alive_ || !body_complete_ || body_failed_) {
+        disconnect();
+    }
+}
+
+void HttpsClient::stop() {
+    finishTiming(HTTP_TIMING_CANCELLED);
+    disconnect();
+}
+
+void HttpsClient::disconnect() {
+    if (connected_) {
+        client_.stop();
+    }
+    connected_ = false;
+    response_open_ = false;
+    receive_position_ = 0;
+    receive_length_ = 0;
+}
+
+void HttpsClient::closeIfIdle() {
+    if (connected_ && !response_open_ && idleExpired()) {
+        LOG_WEATHER_D("%s: closing idle connection", host_);
+        disconnect();
+    }
+}
+
+void HttpsClient::logStats() const {
+    uint32_t handshakes = stats_.handshakes ? stats_.handshakes : 1;
+    LOG_WEATHER_I("%s: %u requests, %u reused, %u full handshakes (avg %u ms, max %u ms), "
+                  "%u idle reconnects, DNS avg %u ms",
+                  host_, stats_.requests, stats_.reused, stats_.handshakes,
+                  stats_.handshake_ms_total / handshakes, stats_.handshake_ms_max,
+                  stats_.idle_reconnects, stats_.dns_ms_total / handshakes);
+}
+
+bool HttpsClient::connect() {
+    // Resolved once here and connected to by address, so the timed lookup is
+    // the only one; lwIP's table answers repeats until the record's TTL ends
+    unsigned long dnsStart = millis();
+    IPAddress address;
+    if (!WiFi.hostByName(host_, address)) {
+        LOG_WEATHER_E("%s: DNS lookup failed", host_);
+        finishTiming(HTTP_TIMING_DNS_FAILED);
+        return false;
+    }
+    uint32_t dnsMs = millis() - dnsStart;
+    timing_.dns_ms += dnsMs;
+
+    // The host name still goes to the server for SNI; setInsecure() leaves
+    // no certificates to pass
+    unsigned long handshakeStart = millis();
+    if (!client_.connect(address, port_, host_, nullptr, nullptr, nullptr)) {
+        LOG_WEATHER_E("%s: TLS connection to %s failed", host_, address.toString().c_str());
+        client_.stop();
+        finishTiming(HTTP_TIMING_CONNECT_FAILED);
+        return false;
+    }
+    uint32_t handshakeMs = millis() - handshakeStart;
+    timing_.handshake_ms += handshakeMs;
+    timing_.reused = false;
+
+    connected_ = true;
+    receive_position_ = 0;
+    receive_length_ = 0;
+    stats_.handshakes++;
+    stats_.dns_ms_total += dnsMs;
+    stats_.handshake_ms_total += handshakeMs;
+    if (handshakeMs > stats_.handshake_ms_max) {
+        stats_.handshake_ms_max = handshakeMs;
+    }
+    LOG_WEATHER_D("%s: full TLS handshake in %u ms (DNS %u ms, %s)", host_, handshakeMs, dnsMs,
+                  address.toString().c_str());
+    return true;
+}
+
+bool HttpsClient::sendRequest(const String& path) {
+    String request;
+    request.reserve(path.length() + 200);
+    request = "GET ";
+    request += path;
+    request += " HTTP/1.1\r\nHost: ";
+    request += host_;
+    // MET Norway turns away requests that don't say who is asking
+    request += "\r\nUser-Agent: Aura Weather Display (github.com/biokraft/Aura)"
+               "\r\nAccept-Encoding: gzip, deflate"
+               "\r\nConnection: keep-alive\r\n\r\n";
+    if (client_.write((const uint8_t*) request.c_str(), request.length()) != request.length()) {
+        return false;
+    }
+    sent_ms_ = millis();
+    return true;
+}
+
+bool HttpsClient::readResponseHead() {
+    String line;
+    if (!readLine(line)) {
+        return false;
+    }
+    if (!line.startsWith("HTTP/1.") || line.length() < 12) {
+        LOG_WEATHER_E("%s: malformed status line", host_);
+        return false;
+    }
+
+    status_code_ = line.substring(9, 12).toInt();
+    timing_.first_byte_ms = millis() - sent_ms_;
+    timing_.status = status_code_;
+    content_encoding_ = "";
+    keep_alive_ = line.charAt(7) == '1';  // HTTP/1.1 defaults to persistent
+    chunked_ = false;
+    body_remaining_ = -1;
+    chunk_remaining_ = 0;
+    chunk_started_ = false;
+    body_complete_ = false;
+    body_failed_ = false;
+    body_bytes_ = 0;
+    idle_timeout_ms_ = HTTPS_IDLE_TIMEOUT_MS;
+
+    for (;;) {
+        if (!readLine(line)) {
+            return false;
+        }
+        if (line.length() == 0) {
+            break;
+        }
+        parseHeader(line);
+    }
+
+    if (status_code_ == 204 || status_code_ == 304 || (!chunked_ && body_remaining_ == 0)) {
+        body_complete_ = true;
+    }
+    if (!chunked_ && body_remaining_ < 0) {
+        keep_alive_ = false;  // Body is delimited by the server closing
+    }
+    response_open_ = true;
+    head_ms_ = millis();
+    return true;
+}
+
+void HttpsClient::finishTiming(HttpTimingResult result) {
+    // Each request is recorded once, however it ends
+    if (!timing_open_) {
+        return;
+    }
+    timing_open_ = false;
+    timing_.result = result;
+    HttpTimingRing::shared().record(timing_);
+}
+
+void HttpsClient::parseHeader(const String& line) {
+    int colon = line.indexOf(':');
+    if (colon <= 0) {
+        return;
+    }
+    String name = line.substring(0, colon);
+    String value = line.substring(colon + 1);
+    value.trim();
+
+    if (name.equalsIgnoreCase("Content-Length")) {
+        body_remaining_ = value.toInt();
+    } else if (name.equalsIgnoreCase("Transfer-Encoding")) {
+        value.toLowerCase();
+        chunked_ = value.indexOf("chunked") >= 0;
+    } else if (name.equalsIgnoreCase("Content-Encoding")) {
+        content_encoding_ = value;
+    } else if (name.equalsIgnoreCase("Connection")) {
+        value.toLowerCase();
+        if (value.indexOf("close") >= 0) {
+            keep_alive_ = false;
+        } else if (value.indexOf("keep-alive") >= 0) {
+            keep_alive_ = true;
+        }
+    } else if (name.equalsIgnoreCase("Keep-Alive")) {
+        // Reconnect a second before the server's idle timeout to avoid racing it
+        int timeout = value.indexOf("timeout=");
+        if (timeout >= 0) {
+            long seconds = value.substring(timeout + 8).toInt();
+            uint32_t limit = seconds > 1 ? (seconds - 1) * 1000 : 0;
+            idle_timeout_ms_ = min(limit, (uint32_t) HTTPS_IDLE_TIMEOUT_MS);
+        }
+    }
+}
+
+bool HttpsClient::idleExpired() const {
+    return millis() - last_used_ >= idle_timeout_ms_;
+}
+
+bool HttpsClient::fillReceiveBuffer() {
+    unsigned long start = millis();
+    for (;;) {
+        int received = client_.read(receive_buffer_, sizeof(receive_buffer_));
+        if (received > 0) {
+            receive_position_ = 0;
+            receive_length_ = received;
+            return true;
+        }
+        if (!client_.connected() || millis() - start >= HTTPS_IO_TIMEOUT_MS) {
+            return false;
+        }
+        delay(1);
+    }
+}
+
+int HttpsClient::readByte() {
+    if (receive_position_ == receive_length_ && !fillReceiveBuffer()) {
+        return -1;
+    }
+    return receive_buffer_[receive_position_++];
+}
+
+bool HttpsClient::readLine(String& line) {
+    line = "";
+    for (;;) {
+        int c = readByte();
+        if (c < 0) {
+            return false;
+        }
+        if (c == '\n') {
+            return true;
+        }
+        if (c != '\r') {
+            if (line.length() >= MAX_LINE_LENGTH) {
+                return false;
+            }
+            line += (char) c;
+        }
+    }
+}
+
+bool HttpsClient::nextChunk() {
+    String line;
+    // Each chunk's data is followed by CRLF before the next size line
+    if (chunk_started_ && (!readLine(line) || line.length() != 0)) {
+        body_failed_ = true;
+        return false;
+    }
+    chunk_started_ = true;
+
+    if (!readLine(line) || line.length() == 0 || !isxdigit(line.charAt(0))) {
+        body_failed_ = true;
+        return false;
+    }
+    chunk_remaining_ = strtoul(line.c_str(), nullptr, 16);
+    if (chunk_remaining_ > 0) {
+        return true;
+    }
+
+    // Last chunk: skip any trailer fields up to the closing blank line
+    while (readLine(line)) {
+        if (line.length() == 0) {
+            body_complete_ = true;
+            return false;
+        }
+    }
+    body_failed_ = true;
+    return false;
+}
+
+bool HttpsClient::bodyReady() {
+    if (!response_open_ || body_complete_ || body_failed_) {
+        return false;
+    }
+    if (chunked_ && chunk_remaining_ == 0 && !nextChunk()) {
+        return false;
+    }
+    if (!chunked_ && body_remaining_ == 0) {
+        body_complete_ = true;
+        return false;
+    }
+    if (receive_position_ == receive_length_ && !fillReceiveBuffer()) {
+        if (!chunked_ && body_remaining_ < 0) {
+            body_complete_ = true;
+        } else {
+            LOG_WEATHER_E("%s: response body truncated", host_);
+            body_failed_ = true;
+        }
+        return false;
+    }
+    return true;
+}
+
+int HttpsClient::bodyAvailable() {
+    if (!response_open_ || body_complete_ || body_failed_) {
+        return 0;
+    }
+    size_t buffered = receive_length_ - receive_position_;
+    if (buffered == 0) {
+        return client_.available() > 0;
+    }
+    if (chunked_) {
+        return chunk_remaining_ ? min(buffered, (size_t) chunk_remaining_) : 1;
+    }
+    return body_remaining_ >= 0 ? min(buffered, (size_t) body_remaining_) : buffered;
+}
+
+int HttpsClient::peekBody() {
+    return bodyReady() ? receive_buffer_[receive_position_] : -1;
+}
+
+size_t HttpsClient::readBody(uint8_t* buffer, size_t length) {
+    size_t copied = 0;
+    while (copied < length && bodyReady()) {
+        size_t count = min(length - copied, receive_length_ - receive_position_);
+        if (chunked_) {
+            count = min(count, (size_t) chunk_remaining_);
+            chunk_remaining_ -= count;
+        } else if (body_remaining_ >= 0) {
+            count = min(count, (size_t) body_remaining_);
+            body_remaining_ -= count;
+        }
+        memcpy(buffer + copied, receive_buffer_ + receive_position_, count);
+        receive_position_ += count;
+        copied += count;
+    }
+    body_bytes_ += copied;
+    return copied;
+}
@@ -0,0 +1,153 @@
+#ifndef HTTPS_CLIENT_H
+#define HTTPS_CLIENT_H
+
+#include "../../config.h"
+#include "http_timing.h"
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+
+// Connection counters for one host
+struct HttpsClientStats {
+    uint32_t requests;
+    uint32_t reused;             // Served on an already open connection
+    uint32_t handshakes;         // Full TCP + TLS connection setups
+    uint32_t idle_reconnects;    // Reused connection found closed by the server
+    uint32_t handshake_ms_total;
+    uint32_t handshake_ms_max;
+    uint32_t dns_ms_total;
+};
+
+// Long-lived HTTP/1.1 client for a single HTTPS host.
+//
+// The TLS connection is kept open between the requests of one burst (the
+// further requests of a forecast fetch, type-ahead searches), so they skip
+// DNS, the TCP handshake and the TLS handshake, which together dominate a
+// request on the ESP32 and briefly need tens of KB of heap. Nothing is kept
+// across bursts: scheduled refreshes are minutes apart, past
+// HTTPS_IDLE_TIMEOUT_MS and the servers' keep-alive timeouts, so each opens
+// a new connection with a full handshake, as the core offers no TLS session
+// resumption. Each new connection resolves the host once and connects to
+// that address; DNS caching is lwIP's, which keeps answers for their TTL.
+// If the server has dropped the connection while idle, the request is
+// retried once on a fresh connection.
+// Response bodies are exposed as a Stream that removes chunked framing and
+// stops at the end of the body, so parsers can read it directly. Every
+// request's phase timings go to HttpTimingRing::shared().
+class HttpsClient {
+public:
+    // Response body view handed to parsers
+    class Body : public Stream {
+    public:
+        explicit Body(HttpsClient& client) : client_(client) { setTimeout(0); }
+
+        int available() override { return client_.bodyAvailable(); }
+        int read() override {
+            uint8_t c;
+            return client_.readBody(&c, 1) ? c : -1;
+        }
+        int peek() override { return client_.peekBody(); }
+        size_t readBytes(char* buffer, size_t length) {
+            return client_.readBody((uint8_t*) buffer, length);
+        }
+        size_t write(uint8_t) override { return 0; }
+
+    private:
+        HttpsClient& client_;
+    };
+
+    explicit HttpsClient(const char* host, uint16_t port = 443);
+    ~HttpsClient();
+
+    // Sends a GET and reads the response head. On success the body can be
+    // read from body(); call end() once done with it.
+    bool get(const String& path);
+    void end();
+
+    // get() in steps, so a request can be raced against another host:
+    // send() writes the request, responseState() is 1 once the response
+    // starts arriving (0 while waiting, -1 if the connection is gone), and
+    // receive() then reads the response head. stop() abandons it.
+    bool send(const String& path);
+    int responseState();
+    bool receive();
+
+    // Drops the connection, e.g. to give its TLS buffers back to the heap.
+    // A request still in progress is recorded as cancelled.
+    void stop();
+    void closeIfIdle();
+
+    int statusCode() const { return status_code_; }
+    const String& contentEncoding() const { return content_encoding_; }
+    // Body bytes read from the socket for the current response, after
+    // de-chunking but before any content decoding
+    size_t bodyBytes() const { return body_bytes_; }
+    Stream& body() { return body_; }
+
+    const char* host() const { return host_; }
+    const HttpsClientStats& stats() const { return stats_; }
+    void logStats() const;
+
+private:
+    static constexpr size_t RECEIVE_BUFFER_SIZE = 512;
+    static constexpr size_t MAX_LINE_LENGTH = 512;
+    static constexpr size_t MAX_DRAIN_BYTES = 4096;
+
+    const char* host_;
+    uint16_t port_;
+    WiFiClientSecure client_;
+    Body body_;
+    bool connected_;
+    unsigned long last_used_;
+    uint32_t idle_timeout_ms_;
+
+    // Current response
+    bool response_open_;
+    int status_code_;
+    String content_encoding_;
+    bool keep_alive_;
+    bool chunked_;
+    int32_t body_remaining_;     // Content-Length left, -1 when read until close
+    uint32_t chunk_remaining_;
+    bool chunk_started_;
+    bool body_complete_;
+    bool body_failed_;
+    size_t body_bytes_;
+
+    uint8_t receive_buffer_[RECEIVE_BUFFER_SIZE];
+    size_t receive_position_;
+    size_t receive_length_;
+
+    // The request in flight, resent once if a reused connection turns out
+    // to have been closed by the server
+    String pending_path_;
+    bool reusing_;
+
+    // Phase timings of the request in flight, recorded once it ends
+    HttpTiming timing_;
+    bool timing_open_;
+    unsigned long sent_ms_;
+    unsigned long head_ms_;
+
+    HttpsClientStats stats_;
+
+    bool connect();
+    void disconnect();
+    bool resend();
+    void finishTiming(HttpTimingResult result);
+    bool sendRequest(const String& path);
+    bool readResponseHead();
+    void parseHeader(const String& line);
+    bool idleExpired() const;
+
+    bool fillReceiveBuffer();
+    int readByte();
+    bool readLine(String& line);
+    bool nextChunk();
+    bool bodyReady();
+    int bodyAvailable();
+    int peekBody();
+    size_t readBody(uint8_t* buffer, size_t length);
+};
+
+#endif // HTTPS_CLIENT_H
@@ -0,0 +1,237 @@
+#include "inflate_stream.h"
+#include "../logging/logging.h"
+#include "esp32/rom/crc.h"
+
+// gzip member header flags (RFC 1952)
+static constexpr uint8_t GZIP_FLAG_HCRC = 0x02;
+static constexpr uint8_t GZIP_FLAG_EXTRA = 0x04;
+static constexpr uint8_t GZIP_FLAG_NAME = 0x08;
+static constexpr uint8_t GZIP_FLAG_COMMENT = 0x10;
+
+InflateStream::Encoding InflateStream::encodingFromHeader(const String& contentEncoding) {
+    if (contentEncoding.equalsIgnoreCase("gzip") || contentEncoding.equalsIgnoreCase("x-gzip")) {
+        return ENCODING_GZIP;
+    }
+    if (contentEncoding.equalsIgnoreCase("deflate")) {
+        return ENCODING_DEFLATE;
+    }
+    return ENCODING_IDENTITY;
+}
+
+InflateStream::InflateStream(Stream& source, Encoding encoding)
+    : source_(source), encoding_(encoding), decompressor_(nullptr), window_(nullptr),
+      window_position_(0), output_position_(0), output_end_(0), input_position_(0),
+      input_length_(0), source_exhausted_(false), finished_(false), error_(false), crc_(0),
+      compressed_bytes_(0), decompressed_bytes_(0) {}
+
+InflateStream::~InflateStream() {
+    free(decompressor_);
+    free(window_);
+}
+
+bool InflateStream::begin() {
+    if (encoding_ == ENCODING_IDENTITY) {
+        return true;
+    }
+
+    decompressor_ = static_cast<tinfl_decompressor*>(malloc(sizeof(tinfl_decompressor)));
+    window_ = static_cast<uint8_t*>(malloc(WINDOW_SIZE));
+    if (!decompressor_ || !window_) {
+        LOG_WEATHER_E("Failed to allocate %u byte inflate window", WINDOW_SIZE + sizeof(tinfl_decompressor));
+        error_ = true;
+        return false;
+    }
+    tinfl_init(decompressor_);
+
+    if (encoding_ == ENCODING_GZIP && !skipGzipHeader()) {
+        LOG_WEATHER_E("Invalid gzip header in response");
+        error_ = true;
+        return false;
+    }
+    return true;
+}
+
+int InflateStream::available() {
+    if (encoding_ == ENCODING_IDENTITY) {
+        return source_.available();
+    }
+    if (output_position_ < output_end_) {
+        return output_end_ - output_position_;
+    }
+    return finished_ || error_ ? 0 : source_.available() > 0;
+}
+
+int InflateStream::read() {
+    if (encoding_ == ENCODING_IDENTITY) {
+        // Blocking single-byte read, as a parser reading the socket would do
+        char c;
+        return source_.readBytes(&c, 1) ? (uint8_t) c : -1;
+    }
+    if (output_position_ == output_end_ && !fillOutput()) {
+        return -1;
+    }
+    return window_[output_position_++];
+}
+
+int InflateStream::peek() {
+    if (encoding_ == ENCODING_IDENTITY) {
+        return source_.peek();
+    }
+    if (output_position_ == output_end_ && !fillOutput()) {
+        return -1;
+    }
+    return window_[output_position_];
+}
+
+size_t InflateStream::readBytes(char* buffer, size_t length) {
+    if (encoding_ == ENCODING_IDENTITY) {
+        return source_.readBytes(buffer, length);
+    }
+
+    size_t copied = 0;
+    while (copied < length) {
+        if (output_position_ == output_end_ && !fillOutput()) {
+            break;
+        }
+        size_t count = min(length - copied, output_end_ - output_position_);
+        memcpy(buffer + copied, window_ + output_position_, count);
+        output_position_ += count;
+        copied += count;
+    }
+    return copied;
+}
+
+bool InflateStream::fillOutput() {
+    // Only called once the reader has drained the previous output, so the
+    // decompressor is free to write over everything but the dictionary
+    while (output_position_ == output_end_) {
+        if (finished_ || error_) {
+            return false;
+        }
+        if (input_position_ == input_length_) {
+            fillInput();
+        }
+
+        mz_uint32 flags = encoding_ == ENCODING_DEFLATE ? TINFL_FLAG_PARSE_ZLIB_HEADER : 0;
+        if (!source_exhausted_) {
+            flags |= TINFL_FLAG_HAS_MORE_INPUT;
+        }
+
+        size_t inputBytes = input_length_ - input_position_;
+        size_t outputBytes = WINDOW_SIZE - window_position_;
+        tinfl_status status =
+            tinfl_decompress(decompressor_, input_ + input_position_, &inputBytes, window_,
+                             window_ + window_position_, &outputBytes, flags);
+        input_position_ += inputBytes;
+
+        output_position_ = window_position_;
+        output_end_ = window_position_ + outputBytes;
+        window_position_ = (window_position_ + outputBytes) & (WINDOW_SIZE - 1);
+        decompressed_bytes_ += outputBytes;
+        if (encoding_ == ENCODING_GZIP) {
+            crc_ = crc32_le(crc_, window_ + output_position_, outputBytes);
+        }
+
+        if (status == TINFL_STATUS_DONE) {
+            finished_ = true;
+            if (encoding_ == ENCODING_GZIP && !checkGzipTrailer()) {
+                LOG_WEATHER_E("gzip trailer mismatch after %u bytes", decompressed_bytes_);
+                error_ = true;
+            }
+        } else if (status < 0) {
+            LOG_WEATHER_E("Inflate failed with status %d after %u bytes", status,
+                          decompressed_bytes_);
+            error_ = true;
+        } else if (status == TINFL_STATUS_NEEDS_MORE_INPUT && source_exhausted_) {
+            LOG_WEATHER_E("Compressed response truncated after %u bytes", compressed_bytes_);
+            error_ = true;
+        }
+    }
+    return true;
+}
+
+bool InflateStream::fillInput() {
+    if (source_exhausted_) {
+        return false;
+    }
+
+    // Take what has already arrived rather than waiting for a full buffer
+    int ready = source_.available();
+    size_t wanted = ready > 0 ? min((size_t) ready, INPUT_SIZE) : 1;
+    size_t received = source_.readBytes((char*) input_, wanted);
+    if (received == 0) {
+        source_exhausted_ = true;
+        return false;
+    }
+
+    input_position_ = 0;
+    input_length_ = received;
+    compressed_bytes_ += received;
+    return true;
+}
+
+int InflateStream::readSourceByte() {
+    if (input_position_ == input_length_ && !fillInput()) {
+        return -1;
+    }
+    return input_[input_position_++];
+}
+
+bool InflateStream::skipGzipHeader() {
+    uint8_t header[10];
+    for (size_t i = 0; i < sizeof(header); i++) {
+        int value = readSourceByte();
+        if (value < 0) {
+            return false;
+        }
+        header[i] = value;
+    }
+    if (header[0] != 0x1f || header[1] != 0x8b || header[2] != 8) {
+        return false;
+    }
+
+    uint8_t flags = header[3];
+    if (flags & GZIP_FLAG_EXTRA) {
+        int low = readSourceByte();
+        int high = readSourceByte();
+        if (low < 0 || high < 0) {
+            return false;
+        }
+        for (int remaining = low | (high << 8); remaining > 0; remaining--) {
+            if (readSourceByte() < 0) {
+                return false;
+            }
+        }
+    }
+    for (uint8_t field : {GZIP_FLAG_NAME, GZIP_FLAG_COMMENT}) {
+        if (flags & field) {
+            int value;
+            while ((value = readSourceByte()) > 0) {
+            }
+            if (value < 0) {
+                return false;
+            }
+        }
+    }
+    if (flags & GZIP_FLAG_HCRC) {
+        if (readSourceByte() < 0 || readSourceByte() < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool InflateStream::checkGzipTrailer() {
+    uint8_t trailer[8];
+    for (size_t i = 0; i < sizeof(trailer); i++) {
+        int value = readSourceByte();
+        if (value < 0) {
+            return false;
+        }
+        trailer[i] = value;
+    }
+
+    uint32_t crc = trailer[0] | (trailer[1] << 8) | (trailer[2] << 16) | ((uint32_t) trailer[3] << 24);
+    uint32_t size = trailer[4] | (trailer[5] << 8) | (trailer[6] << 16) | ((uint32_t) trailer[7] << 24);
+    return crc == crc_ && size == (uint32_t) decompressed_bytes_;
+}
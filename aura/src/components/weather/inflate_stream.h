@@ -0,0 +1,68 @@
+#ifndef INFLATE_STREAM_H
+#define INFLATE_STREAM_H
+
+#include <Arduino.h>
+#include "esp32/rom/miniz.h"
+
+// Read-only Stream that decodes a gzip or deflate HTTP body on the fly.
+//
+// Decompressed bytes are produced into the 32 KB circular deflate window and
+// handed to the reader straight from there, so a parser can consume the
+// response as it arrives without the full body ever being held in RAM. The
+// window and decompressor state live on the heap only while a compressed
+// body is being read; identity bodies pass through untouched.
+class InflateStream : public Stream {
+public:
+    enum Encoding { ENCODING_IDENTITY, ENCODING_GZIP, ENCODING_DEFLATE };
+
+    // Maps a Content-Encoding header value; unknown codings are passed through
+    static Encoding encodingFromHeader(const String& contentEncoding);
+
+    InflateStream(Stream& source, Encoding encoding);
+    ~InflateStream();
+
+    // Allocates the window and consumes the gzip header. Call before reading.
+    bool begin();
+
+    // Stream
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t readBytes(char* buffer, size_t length);
+    size_t write(uint8_t) override { return 0; }
+
+    // Statistics for logging and tests
+    Encoding encoding() const { return encoding_; }
+    size_t compressedBytes() const { return compressed_bytes_; }
+    size_t decompressedBytes() const { return decompressed_bytes_; }
+    bool hasError() const { return error_; }
+
+private:
+    static constexpr size_t WINDOW_SIZE = TINFL_LZ_DICT_SIZE;
+    static constexpr size_t INPUT_SIZE = 512;
+
+    Stream& source_;
+    Encoding encoding_;
+    tinfl_decompressor* decompressor_;
+    uint8_t* window_;
+    size_t window_position_;          // Where the next decompressed byte goes
+    size_t output_position_;          // Next byte handed to the reader
+    size_t output_end_;
+    uint8_t input_[INPUT_SIZE];
+    size_t input_position_;
+    size_t input_length_;
+    bool source_exhausted_;
+    bool finished_;
+    bool error_;
+    uint32_t crc_;
+    size_t compressed_bytes_;
+    size_t decompressed_bytes_;
+
+    bool fillOutput();
+    bool fillInput();
+    int readSourceByte();
+    bool skipGzipHeader();
+    bool checkGzipTrailer();
+};
+
+#endif // INFLATE_STREAM_H
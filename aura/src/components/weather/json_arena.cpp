@@ -0,0 +1,90 @@
+#include "json_arena.h"
+#include <string.h>
+
+static constexpr size_t NO_BLOCK = static_cast<size_t>(-1);
+
+JsonArena::JsonArena(uint8_t* buffer, size_t capacity)
+    : buffer_(buffer), capacity_(capacity), top_(0), last_block_(NO_BLOCK), peak_(0),
+      allocation_count_(0), overflowed_(false) {
+}
+
+void JsonArena::reset() {
+    top_ = 0;
+    last_block_ = NO_BLOCK;
+    peak_ = 0;
+    allocation_count_ = 0;
+    overflowed_ = false;
+}
+
+void* JsonArena::allocate(size_t size) {
+    size_t block = top_;
+    size_t end = block + HEADER_SIZE + alignUp(size);
+    if (end > capacity_) {
+        // ArduinoJson reports this as DeserializationError::NoMemory
+        overflowed_ = true;
+        return nullptr;
+    }
+
+    BlockHeader* header = reinterpret_cast<BlockHeader*>(buffer_ + block);
+    header->size = size;
+    header->previous = last_block_;
+
+    last_block_ = block;
+    top_ = end;
+    if (top_ > peak_) {
+        peak_ = top_;
+    }
+    allocation_count_++;
+    return buffer_ + block + HEADER_SIZE;
+}
+
+void JsonArena::deallocate(void* pointer) {
+    if (!pointer || !isLastBlock(pointer)) {
+        // Blocks below the top are reclaimed by the next reset()
+        return;
+    }
+    top_ = last_block_;
+    last_block_ = headerOf(pointer)->previous;
+}
+
+void* JsonArena::reallocate(void* pointer, size_t new_size) {
+    if (!pointer) {
+        return allocate(new_size);
+    }
+
+    BlockHeader* header = headerOf(pointer);
+    if (isLastBlock(pointer)) {
+        // Grow or shrink the top block in place
+        size_t end = last_block_ + HEADER_SIZE + alignUp(new_size);
+        if (end > capacity_) {
+            overflowed_ = true;
+            return nullptr;
+        }
+        header->size = new_size;
+        top_ = end;
+        if (top_ > peak_) {
+            peak_ = top_;
+        }
+        return pointer;
+    }
+
+    if (new_size <= header->size) {
+        header->size = new_size;
+        return pointer;
+    }
+
+    void* moved = allocate(new_size);
+    if (moved) {
+        memcpy(moved, pointer, header->size);
+    }
+    return moved;
+}
+
+JsonArena::BlockHeader* JsonArena::headerOf(void* pointer) const {
+    return reinterpret_cast<BlockHeader*>(static_cast<uint8_t*>(pointer) - HEADER_SIZE);
+}
+
+bool JsonArena::isLastBlock(void* pointer) const {
+    return last_block_ != NO_BLOCK &&
+           static_cast<uint8_t*>(pointer) == buffer_ + last_block_ + HEADER_SIZE;
+}
@@ -0,0 +1,57 @@
+#ifndef JSON_ARENA_H
+#define JSON_ARENA_H
+
+#include <ArduinoJson.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Bump allocator over a caller-provided buffer for ArduinoJson documents.
+//
+// Weather responses are parsed into a JsonDocument that lives only for the
+// duration of a single parse, so every block can come from one statically
+// reserved region instead of the shared heap. The arena is reset before each
+// parse; blocks freed in LIFO order (which is what ArduinoJson does when it
+// grows and shrinks its string and slot pools) are returned immediately.
+class JsonArena : public ArduinoJson::Allocator {
+public:
+    JsonArena(uint8_t* buffer, size_t capacity);
+
+    // ArduinoJson::Allocator
+    void* allocate(size_t size) override;
+    void deallocate(void* pointer) override;
+    void* reallocate(void* pointer, size_t new_size) override;
+
+    // Discard every block. Only call when no document uses the arena.
+    void reset();
+
+    // Statistics for logging and benchmarks
+    size_t capacity() const { return capacity_; }
+    size_t used() const { return top_; }
+    size_t peak() const { return peak_; }
+    uint32_t allocationCount() const { return allocation_count_; }
+    bool hasOverflowed() const { return overflowed_; }
+
+private:
+    struct BlockHeader {
+        size_t size;
+        size_t previous;  // Offset of the block header allocated before this one
+    };
+
+    static constexpr size_t ALIGNMENT = 8;
+    static constexpr size_t HEADER_SIZE =
+        (sizeof(BlockHeader) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+    uint8_t* buffer_;
+    size_t capacity_;
+    size_t top_;
+    size_t last_block_;  // Offset of the most recent block header
+    size_t peak_;
+    uint32_t allocation_count_;
+    bool overflowed_;
+
+    static size_t alignUp(size_t value) { return (value + ALIGNMENT - 1) & ~(ALIGNMENT - 1); }
+    BlockHeader* headerOf(void* pointer) const;
+    bool isLastBlock(void* pointer) const;
+};
+
+#endif // JSON_ARENA_H
@@ -0,0 +1,280 @@
+#include "lan_share.h"
+#include <math.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include "esp32/rom/crc.h"
+#include <lwip/inet.h>
+#include <lwip/sockets.h>
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(LanShareHeader) == 32, "LanShareHeader is a wire format");
+
+LanShare::LanShare()
+    : socket_(-1), node_(0), group_address_(0), port_(0), started_ms_(0), last_heartbeat_ms_(0),
+      heartbeat_sent_(false), latitude_(0), longitude_(0), radius_km_(0), peers_(),
+      sequence_(0), shared_tier_(0), shared_length_(0), accepted_node_(0),
+      accepted_sequence_(0), received_tier_(0), received_length_(0), stats_() {}
+
+LanShare::~LanShare() {
+    end();
+}
+
+bool LanShare::begin(uint32_t node, const char* group, uint16_t port, uint32_t nowMs,
+                     const char* interfaceAddress) {
+    end();
+    int fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (fd < 0) {
+        return false;
+    }
+
+    // Several units (or simulated nodes) may listen on one host and port
+    int yes = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+#ifdef SO_REUSEPORT
+    setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &yes, sizeof(yes));
+#endif
+
+    sockaddr_in local = {};
+    local.sin_family = AF_INET;
+    local.sin_port = htons(port);
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+
+    in_addr interface = {};
+    interface.s_addr = interfaceAddress ? inet_addr(interfaceAddress) : htonl(INADDR_ANY);
+    ip_mreq membership = {};
+    membership.imr_multiaddr.s_addr = inet_addr(group);
+    membership.imr_interface = interface;
+
+    // One hop only; our own packets come back and are skipped by node id
+    uint8_t ttl = 1;
+    uint8_t loop = 1;
+    if (bind(fd, (sockaddr*) &local, sizeof(local)) < 0 ||
+        setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership)) < 0 ||
+        setsockopt(fd, IPPROTO_IP, IP_MULTICAST_IF, &interface, sizeof(interface)) < 0 ||
+        setsockopt(fd, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl)) < 0 ||
+        setsockopt(fd, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop)) < 0 ||
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK) < 0) {
+        close(fd);
+        return false;
+    }
+
+    socket_ = fd;
+    node_ = node;
+    group_address_ = membership.imr_multiaddr.s_addr;
+    port_ = port;
+    started_ms_ = nowMs;
+    heartbeat_sent_ = false;
+    memset(peers_, 0, sizeof(peers_));
+    accepted_node_ = 0;
+    received_length_ = 0;
+    return true;
+}
+
+void LanShare::end() {
+    if (socket_ >= 0) {
+        close(socket_);
+        socket_ = -1;
+    }
+}
+
+void LanShare::setPosition(float latitude, float longitude) {
+    latitude_ = latitude;
+    longitude_ = longitude;
+}
+
+bool LanShare::poll(uint32_t nowMs) {
+    if (socket_ < 0) {
+        return false;
+    }
+    if (!heartbeat_sent_ || nowMs - last_heartbeat_ms_ >= LAN_SHARE_HEARTBEAT_MS) {
+        heartbeat_sent_ = true;
+        last_heartbeat_ms_ = nowMs;
+        send(LAN_SHARE_HEARTBEAT, 0, sequence_, nullptr, 0);
+    }
+
+    bool accepted = false;
+    for (;;) {
+        ssize_t length = recvfrom(socket_, packet_, sizeof(packet_), 0, nullptr, nullptr);
+        if (length <= 0) {
+            break;
+        }
+        accepted = handlePacket(length, nowMs) || accepted;
+    }
+    return accepted;
+}
+
+bool LanShare::isFresh(const Peer& peer, uint32_t nowMs) const {
+    return peer.node != 0 && nowMs - peer.last_heard_ms < LAN_SHARE_LEADER_TIMEOUT_MS;
+}
+
+uint32_t LanShare::leader(uint32_t nowMs) const {
+    uint32_t lowest = node_;
+    for (const Peer& peer : peers_) {
+        if (isFresh(peer, nowMs) && peer.node < lowest) {
+            lowest = peer.node;
+        }
+    }
+    return lowest;
+}
+
+bool LanShare::isLeader(uint32_t nowMs) const {
+    // Until one timeout has passed we may simply not have heard the leader yet
+    return socket_ >= 0 && nowMs - started_ms_ >= LAN_SHARE_LEADER_TIMEOUT_MS &&
+           leader(nowMs) == node_;
+}
+
+bool LanShare::share(uint8_t tier, const uint8_t* payload, size_t length) {
+    if (length > LAN_SHARE_MAX_PAYLOAD) {
+        return false;
+    }
+    // Kept to hand to peers that join later
+    memcpy(shared_, payload, length);
+    shared_length_ = length;
+    shared_tier_ = tier;
+    return send(LAN_SHARE_FORECAST, tier, ++sequence_, shared_, shared_length_);
+}
+
+const uint8_t* LanShare::forecast(size_t& length, uint8_t& tier) const {
+    length = received_length_;
+    tier = received_tier_;
+    return received_length_ ? received_ : nullptr;
+}
+
+bool LanShare::send(uint8_t type, uint8_t tier, uint32_t sequence, const uint8_t* payload,
+                    size_t length) {
+    if (socket_ < 0) {
+        return false;
+    }
+    LanShareHeader header = {};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.type = type;
+    header.tier = tier;
+    header.node = node_;
+    header.sequence = sequence;
+    header.latitude = (int32_t) lroundf(latitude_ * 100000.0f);
+    header.longitude = (int32_t) lroundf(longitude_ * 100000.0f);
+    header.length = length;
+    memcpy(packet_, &header, sizeof(header));
+    if (length) {
+        memcpy(packet_ + sizeof(header), payload, length);
+    }
+    header.crc = crc32(0, packet_, sizeof(header) + length);
+    memcpy(packet_ + offsetof(LanShareHeader, crc), &header.crc, sizeof(header.crc));
+
+    sockaddr_in destination = {};
+    destination.sin_family = AF_INET;
+    destination.sin_port = htons(port_);
+    destination.sin_addr.s_addr = group_address_;
+    ssize_t sent = sendto(socket_, packet_, sizeof(header) + length, 0,
+                          (sockaddr*) &destination, sizeof(destination));
+    if (sent != (ssize_t) (sizeof(header) + length)) {
+        return false;
+    }
+    stats_.sent++;
+    return true;
+}
+
+bool LanShare::handlePacket(size_t length, uint32_t nowMs) {
+    LanShareHeader header;
+    if (length < sizeof(header)) {
+        stats_.rejected++;
+        return false;
+    }
+    memcpy(&header, packet_, sizeof(header));
+    uint32_t crc = header.crc;
+    memset(packet_ + offsetof(LanShareHeader, crc), 0, sizeof(header.crc));
+    if (header.magic != MAGIC || header.version != VERSION ||
+        header.length != length - sizeof(header) || crc32(0, packet_, length) != crc) {
+        stats_.rejected++;
+        return false;
+    }
+    if (header.node == node_) {
+        return false;
+    }
+    stats_.received++;
+
+    // Units showing somewhere else belong to another group
+    if (distanceKm(latitude_, longitude_, header.latitude / 100000.0f,
+                   header.longitude / 100000.0f) > radius_km_) {
+        return false;
+    }
+    if (rememberPeer(header.node, nowMs) && isLeader(nowMs) && shared_length_) {
+        send(LAN_SHARE_FORECAST, shared_tier_, sequence_, shared_, shared_length_);
+    }
+
+    if (header.type != LAN_SHARE_FORECAST || isLeader(nowMs) || header.node != leader(nowMs) ||
+        (header.node == accepted_node_ && header.sequence == accepted_sequence_)) {
+        return false;
+    }
+    accepted_node_ = header.node;
+    accepted_sequence_ = header.sequence;
+    received_tier_ = header.tier;
+    received_length_ = header.length;
+    memcpy(received_, packet_ + sizeof(header), header.length);
+    stats_.accepted++;
+    return true;
+}
+
+bool LanShare::rememberPeer(uint32_t node, uint32_t nowMs) {
+    Peer* slot = nullptr;
+    for (Peer& peer : peers_) {
+        if (peer.node == node) {
+            bool rejoined = !isFresh(peer, nowMs);
+            peer.last_heard_ms = nowMs;
+            return rejoined;
+        }
+        if (!slot || (isFresh(*slot, nowMs) && !isFresh(peer, nowMs))) {
+            slot = &peer;
+        }
+    }
+    // A full table of live peers keeps its lowest ids, the ones that matter
+    if (isFresh(*slot, nowMs)) {
+        for (Peer& peer : peers_) {
+            if (peer.node > slot->node) {
+                slot = &peer;
+            }
+        }
+        if (node > slot->node) {
+            return false;
+        }
+    }
+    slot->node = node;
+    slot->last_heard_ms = nowMs;
+    return true;
+}
+
+uint32_t LanShare::crc32(uint32_t crc, const uint8_t* data, size_t length) {
+#ifdef ARDUINO
+    return crc32_le(crc, data, length);
+#else
+    // Bitwise zlib CRC-32, as the ROM routine computes it
+    crc = ~crc;
+    while (length--) {
+        crc ^= *data++;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xedb88320u & -(crc & 1));
+        }
+    }
+    return ~crc;
+#endif
+}
+
+float LanShare::distanceKm(float lat1, float lon1, float lat2, float lon2) {
+    // Equirectangular; plenty for a radius of a few kilometres
+    const float radians = 0.01745329f;
+    float dlon = fabsf(lon2 - lon1);
+    if (dlon > 180.0f) {
+        dlon = 360.0f - dlon;
+    }
+    float x = dlon * radians * cosf((lat1 + lat2) * 0.5f * radians);
+    float y = (lat2 - lat1) * radians;
+    return 6371.0f * sqrtf(x * x + y * y);
+}
@@ -0,0 +1,136 @@
+#ifndef LAN_SHARE_H
+#define LAN_SHARE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Protocol timing; every unit on the network must agree. Overridable so the
+// host simulation can run in seconds.
+#ifndef LAN_SHARE_HEARTBEAT_MS
+#define LAN_SHARE_HEARTBEAT_MS 5000UL
+#endif
+#ifndef LAN_SHARE_LEADER_TIMEOUT_MS
+#define LAN_SHARE_LEADER_TIMEOUT_MS (3 * LAN_SHARE_HEARTBEAT_MS)
+#endif
+#define LAN_SHARE_MAX_PEERS 16
+#define LAN_SHARE_MAX_PAYLOAD 1024
+
+enum LanSharePacketType : uint8_t { LAN_SHARE_HEARTBEAT = 1, LAN_SHARE_FORECAST = 2 };
+
+// Datagram header, little-endian as on both ESP32 and x86. The CRC-32
+// covers the header (with crc zeroed) and the payload.
+struct LanShareHeader {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t type;
+    uint8_t tier;        // WeatherTier of the fetch a forecast came from
+    uint8_t reserved;
+    uint32_t node;
+    uint32_t sequence;   // Per sender; repeats of a forecast are dropped
+    int32_t latitude;    // Of the location the sender shows, in 1e-5 degrees
+    int32_t longitude;
+    uint16_t length;     // Payload bytes
+    uint16_t reserved2;
+    uint32_t crc;
+};
+
+struct LanShareStats {
+    uint32_t sent;
+    uint32_t received;
+    uint32_t accepted;   // Forecasts taken from the leader
+    uint32_t rejected;   // Bad magic, version, length or CRC
+};
+
+// Lets the units on one network share a single forecast fetch over UDP
+// multicast.
+//
+// Every unit multicasts a heartbeat with its id and the coordinates it
+// shows. Units within the radius of each other form a group, led by the
+// lowest id heard from in the last LAN_SHARE_LEADER_TIMEOUT_MS. The leader
+// fetches as usual and multicasts each result (a WeatherSnapshot blob);
+// the others take it instead of fetching while the leader is alive and
+// fetch for themselves once it goes silent. A unit that has just started
+// listens for one timeout before it may lead, so units powered up together
+// don't all fetch at once, and the leader resends its last forecast when a
+// new peer appears.
+//
+// Plain BSD sockets, so the same code runs on lwIP and on Linux for
+// tools/lan_share_sim.cpp. Times are passed in; not thread-safe.
+class LanShare {
+public:
+    static constexpr uint32_t MAGIC = 0x534c5541;  // "AULS"
+    static constexpr uint8_t VERSION = 1;
+
+    LanShare();
+    ~LanShare();
+
+    // interfaceAddress picks the multicast interface; nullptr for the default
+    bool begin(uint32_t node, const char* group, uint16_t port, uint32_t nowMs,
+               const char* interfaceAddress = nullptr);
+    void end();
+    bool isOpen() const { return socket_ >= 0; }
+
+    // The location this unit shows and how far away a peer may be
+    void setPosition(float latitude, float longitude);
+    void setRadius(float km) { radius_km_ = km; }
+
+    // Sends the heartbeat when due and reads everything waiting. Returns
+    // true when a new forecast from the leader arrived; see forecast().
+    bool poll(uint32_t nowMs);
+
+    bool isLeader(uint32_t nowMs) const;
+    // Lowest id in the group, this unit included
+    uint32_t leader(uint32_t nowMs) const;
+    // Leader side: multicasts a forecast to the group
+    bool share(uint8_t tier, const uint8_t* payload, size_t length);
+    // Follower side: the last forecast accepted by poll()
+    const uint8_t* forecast(size_t& length, uint8_t& tier) const;
+
+    const LanShareStats& stats() const { return stats_; }
+    uint32_t node() const { return node_; }
+
+    static uint32_t crc32(uint32_t crc, const uint8_t* data, size_t length);
+    static float distanceKm(float lat1, float lon1, float lat2, float lon2);
+
+private:
+    struct Peer {
+        uint32_t node;
+        uint32_t last_heard_ms;
+    };
+
+    int socket_;
+    uint32_t node_;
+    uint32_t group_address_;  // Network byte order
+    uint16_t port_;
+    uint32_t started_ms_;
+    uint32_t last_heartbeat_ms_;
+    bool heartbeat_sent_;
+
+    float latitude_;
+    float longitude_;
+    float radius_km_;
+    Peer peers_[LAN_SHARE_MAX_PEERS];
+
+    uint32_t sequence_;
+    uint8_t shared_tier_;
+    uint16_t shared_length_;
+    uint8_t shared_[LAN_SHARE_MAX_PAYLOAD];
+
+    uint32_t accepted_node_;
+    uint32_t accepted_sequence_;
+    uint8_t received_tier_;
+    uint16_t received_length_;
+    uint8_t received_[LAN_SHARE_MAX_PAYLOAD];
+
+    uint8_t packet_[sizeof(LanShareHeader) + LAN_SHARE_MAX_PAYLOAD];
+    LanShareStats stats_;
+
+    bool send(uint8_t type, uint8_t tier, uint32_t sequence, const uint8_t* payload,
+              size_t length);
+    bool handlePacket(size_t length, uint32_t nowMs);
+    // True if the peer was not in the group before
+    bool rememberPeer(uint32_t node, uint32_t nowMs);
+    bool isFresh(const Peer& peer, uint32_t nowMs) const;
+};
+
+#endif // LAN_SHARE_H
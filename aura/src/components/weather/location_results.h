@@ -0,0 +1,40 @@
+#ifndef LOCATION_RESULTS_H
+#define LOCATION_RESULTS_H
+
+#include "../../config.h"
+#include <Arduino.h>
+#include <atomic>
+
+// Longest search text kept, including the terminator
+#define LOCATION_QUERY_SIZE 32
+
+// One geocoding match, sized for the dropdown
+struct LocationResult {
+    char name[40];
+    char admin1[32];   // Region or state
+    char country[32];
+    float latitude;
+    float longitude;
+};
+
+// Matches for one query, owned by the caller. complete is false for an
+// early answer narrowed down from a cached shorter query.
+struct LocationResults {
+    char query[LOCATION_QUERY_SIZE];
+    uint8_t count;
+    bool complete;
+    LocationResult items[LOCATION_SEARCH_MAX_RESULTS];
+};
+
+// Lets another task abandon a search in flight: the search gives up once
+// the counter has moved on from the value it started with
+struct LocationSearchToken {
+    const std::atomic<uint32_t>* generation;
+    uint32_t started;
+
+    bool cancelled() const {
+        return generation && generation->load(std::memory_order_acquire) != started;
+    }
+};
+
+#endif // LOCATION_RESULTS_H
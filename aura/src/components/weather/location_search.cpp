@@ -0,0 +1,201 @@
+#include "location_search.h"
+#include "city_index.h"
+#include "../logging/logging.h"
+
+// Case-insensitive "name starts with prefix"; prefix is already lowercase
+static bool startsWithFolded(const char* name, const char* prefix) {
+    for (; *prefix; name++, prefix++) {
+        if (tolower((uint8_t) *name) != (uint8_t) *prefix) {
+            return false;
+        }
+    }
+    return true;
+}
+
+LocationSearch::LocationSearch(Weather& weather)
+    : weather_(weather), handle_(nullptr), lock_(xSemaphoreCreateMutex()), generation_(0),
+      cache_(), cache_clock_(0), answer_(), answer_ready_(false), scratch_() {
+    query_[0] = '\0';
+}
+
+LocationSearch::~LocationSearch() {
+    if (handle_) {
+        vTaskDelete(handle_);
+    }
+    vSemaphoreDelete(lock_);
+}
+
+void LocationSearch::normalizeQuery(const char* query, char* key, size_t size) {
+    while (isspace((uint8_t) *query)) {
+        query++;
+    }
+    size_t length = 0;
+    for (; query[length] && length + 1 < size; length++) {
+        key[length] = tolower((uint8_t) query[length]);
+    }
+    while (length > 0 && isspace((uint8_t) key[length - 1])) {
+        length--;
+    }
+    key[length] = '\0';
+}
+
+bool LocationSearch::setQuery(const char* query, LocationResults& results) {
+    char key[LOCATION_QUERY_SIZE];
+    normalizeQuery(query, key, sizeof(key));
+
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    if (strcmp(key, query_) == 0) {
+        xSemaphoreGive(lock_);
+        return false;
+    }
+    // Moving the generation on cancels whatever the task is doing
+    strlcpy(query_, key, sizeof(query_));
+    generation_.fetch_add(1, std::memory_order_release);
+    answer_ready_ = false;
+    bool exact = answerFromIndex(key, results);
+    bool answered = exact || answerFromCache(key, results, exact);
+    xSemaphoreGive(lock_);
+
+    if (!exact && strlen(key) >= LOCATION_SEARCH_MIN_QUERY && start()) {
+        xTaskNotifyGive(handle_);
+    }
+    return answered;
+}
+
+bool LocationSearch::takeResults(LocationResults& results) {
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    bool ready = answer_ready_;
+    if (ready) {
+        results = answer_;
+        answer_ready_ = false;
+    }
+    xSemaphoreGive(lock_);
+    return ready;
+}
+
+bool LocationSearch::start() {
+    // Created on first use, so a device that never searches keeps the RAM
+    if (handle_) {
+        return true;
+    }
+    BaseType_t created = xTaskCreatePinnedToCore(taskEntry, "location_search",
+                                                 LOCATION_SEARCH_TASK_STACK_SIZE, this,
+                                                 WEATHER_TASK_PRIORITY, &handle_,
+                                                 WEATHER_TASK_CORE);
+    if (created != pdPASS) {
+        LOG_WEATHER_E("Failed to create location search task");
+        handle_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void LocationSearch::taskEntry(void* parameter) {
+    static_cast<LocationSearch*>(parameter)->run();
+}
+
+void LocationSearch::run() {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        // Debounce: keystrokes that keep coming restart the wait
+        while (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LOCATION_SEARCH_DEBOUNCE_MS)) > 0) {
+        }
+
+        char query[LOCATION_QUERY_SIZE];
+        xSemaphoreTake(lock_, portMAX_DELAY);
+        strlcpy(query, query_, sizeof(query));
+        LocationSearchToken token = {&generation_, generation_.load(std::memory_order_acquire)};
+        xSemaphoreGive(lock_);
+
+        unsigned long start = millis();
+        if (!weather_.searchLocations(query, scratch_, &token)) {
+            continue;
+        }
+
+        // Cached even when superseded; the user may well type it again
+        xSemaphoreTake(lock_, portMAX_DELAY);
+        storeInCache(scratch_);
+        if (!token.cancelled()) {
+            answer_ = scratch_;
+            answer_ready_ = true;
+        }
+        xSemaphoreGive(lock_);
+        LOG_WEATHER_I("Search for \"%s\": %u results in %lu ms", query, scratch_.count,
+                      millis() - start);
+    }
+}
+
+bool LocationSearch::answerFromIndex(const char* key, LocationResults& results) {
+    // Single letters would match too much of the index to be useful
+    if (strlen(key) < LOCATION_SEARCH_MIN_QUERY) {
+        return false;
+    }
+    CityMatch matches[LOCATION_SEARCH_MAX_RESULTS];
+    size_t found = CityIndex::builtin().search(key, matches, LOCATION_SEARCH_MAX_RESULTS);
+    if (found == 0) {
+        return false;
+    }
+
+    strlcpy(results.query, key, sizeof(results.query));
+    results.complete = true;
+    results.count = found;
+    for (size_t i = 0; i < found; i++) {
+        LocationResult& item = results.items[i];
+        strlcpy(item.name, matches[i].name, sizeof(item.name));
+        item.admin1[0] = '\0';
+        strlcpy(item.country, matches[i].country, sizeof(item.country));
+        item.latitude = matches[i].latitude;
+        item.longitude = matches[i].longitude;
+    }
+    return true;
+}
+
+bool LocationSearch::answerFromCache(const char* key, LocationResults& results, bool& exact) {
+    // Exact match, else the longest cached query that key extends
+    CacheEntry* best = nullptr;
+    size_t best_length = 0;
+    for (CacheEntry& entry : cache_) {
+        size_t length = strlen(entry.results.query);
+        if (entry.last_used && length >= best_length &&
+            strncmp(entry.results.query, key, length) == 0) {
+            best = &entry;
+            best_length = length;
+        }
+    }
+    if (!best) {
+        return false;
+    }
+
+    best->last_used = ++cache_clock_;
+    exact = best_length == strlen(key);
+    if (exact) {
+        results = best->results;
+        return true;
+    }
+
+    strlcpy(results.query, key, sizeof(results.query));
+    results.complete = false;
+    results.count = 0;
+    for (uint8_t i = 0; i < best->results.count; i++) {
+        if (startsWithFolded(best->results.items[i].name, key)) {
+            results.items[results.count++] = best->results.items[i];
+        }
+    }
+    return true;
+}
+
+void LocationSearch::storeInCache(const LocationResults& results) {
+    // Replaces the same query, else the least recently used entry
+    CacheEntry* slot = &cache_[0];
+    for (CacheEntry& entry : cache_) {
+        if (entry.last_used && strcmp(entry.results.query, results.query) == 0) {
+            slot = &entry;
+            break;
+        }
+        if (entry.last_used < slot->last_used) {
+            slot = &entry;
+        }
+    }
+    slot->results = results;
+    slot->last_used = ++cache_clock_;
+}
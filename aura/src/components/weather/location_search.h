@@ -0,0 +1,66 @@
+#ifndef LOCATION_SEARCH_H
+#define LOCATION_SEARCH_H
+
+#include "../../config.h"
+#include "location_results.h"
+#include "weather.h"
+#include <Arduino.h>
+#include <atomic>
+
+// Type-ahead location search for the location dialog.
+//
+// The UI calls setQuery() on every keystroke. Places in the offline city
+// index are answered from flash and never reach the network. Anything else
+// is answered at once from an LRU cache of recent queries: an exact hit is
+// final and sends nothing, and the cached results of a shorter query ("lon"
+// while typing "lond") are narrowed down to names with the new prefix as a
+// first answer. The search task only
+// asks the geocoding API once typing pauses for LOCATION_SEARCH_DEBOUNCE_MS,
+// and a newer query cancels the search in flight. The refined answer is
+// picked up with takeResults().
+class LocationSearch {
+public:
+    explicit LocationSearch(Weather& weather);
+    ~LocationSearch();
+
+    // UI side; neither blocks on the network. setQuery() returns true and
+    // fills results if the cache can answer straight away.
+    bool setQuery(const char* query, LocationResults& results);
+    // The network answer for the latest query, once it has arrived
+    bool takeResults(LocationResults& results);
+
+    // Lowercased and trimmed, as used for cache keys and requests
+    static void normalizeQuery(const char* query, char* key, size_t size);
+
+private:
+    friend void test_location_search();
+
+    struct CacheEntry {
+        uint32_t last_used;  // 0 = empty
+        LocationResults results;
+    };
+
+    Weather& weather_;
+    TaskHandle_t handle_;
+
+    // Guards everything below except scratch_, which only the task touches
+    SemaphoreHandle_t lock_;
+    char query_[LOCATION_QUERY_SIZE];
+    std::atomic<uint32_t> generation_;
+    CacheEntry cache_[LOCATION_SEARCH_CACHE_SIZE];
+    uint32_t cache_clock_;
+    LocationResults answer_;
+    bool answer_ready_;
+
+    LocationResults scratch_;
+
+    bool start();
+    static void taskEntry(void* parameter);
+    void run();
+
+    static bool answerFromIndex(const char* key, LocationResults& results);
+    bool answerFromCache(const char* key, LocationResults& results, bool& exact);
+    void storeInCache(const LocationResults& results);
+};
+
+#endif // LOCATION_SEARCH_H
@@ -0,0 +1,126 @@
+#include "refresh_scheduler.h"
+#include "../logging/logging.h"
+
+// True once nowMs has reached dueMs, across millis() wraparound
+static bool reached(uint32_t nowMs, uint32_t dueMs) {
+    return (int32_t) (nowMs - dueMs) >= 0;
+}
+
+RefreshScheduler::RefreshScheduler() {
+    memset(stats_, 0, sizeof(stats_));
+    memset(next_due_ms_, 0, sizeof(next_due_ms_));
+    configs_[WEATHER_TIER_CURRENT] = {WEATHER_CURRENT_INTERVAL, 0, WEATHER_RETRY_MIN,
+                                      WEATHER_RETRY_MAX};
+    configs_[WEATHER_TIER_FORECAST] = {WEATHER_FORECAST_INTERVAL, WEATHER_FORECAST_OFFSET,
+                                       WEATHER_RETRY_MIN, WEATHER_RETRY_MAX};
+}
+
+void RefreshScheduler::configure(WeatherTier tier, const WeatherTierConfig& config) {
+    configs_[tier] = config;
+}
+
+bool RefreshScheduler::nextDue(uint32_t nowMs, WeatherTier& tier) const {
+    if (reached(nowMs, next_due_ms_[WEATHER_TIER_FORECAST])) {
+        tier = WEATHER_TIER_FORECAST;
+        return true;
+    }
+    if (reached(nowMs, next_due_ms_[WEATHER_TIER_CURRENT])) {
+        tier = WEATHER_TIER_CURRENT;
+        return true;
+    }
+    return false;
+}
+
+uint32_t RefreshScheduler::msUntilNextDue(uint32_t nowMs) const {
+    uint32_t wait = UINT32_MAX;
+    for (int tier = 0; tier < WEATHER_TIER_COUNT; tier++) {
+        if (reached(nowMs, next_due_ms_[tier])) {
+            return 0;
+        }
+        wait = min(wait, next_due_ms_[tier] - nowMs);
+    }
+    return wait;
+}
+
+void RefreshScheduler::requestAll(uint32_t nowMs) {
+    for (int tier = 0; tier < WEATHER_TIER_COUNT; tier++) {
+        next_due_ms_[tier] = nowMs;
+    }
+}
+
+void RefreshScheduler::markSuccess(WeatherTier tier, uint32_t nowMs, time_t wallClock,
+                                   uint32_t bytes) {
+    WeatherTierStats& stats = stats_[tier];
+    stats.successes++;
+    stats.consecutive_failures = 0;
+    stats.last_success_ms = nowMs;
+    stats.last_success_time = wallClock > MIN_VALID_EPOCH ? wallClock : 0;
+    stats.last_bytes = bytes;
+    stats.total_bytes += bytes;
+    scheduleAfterSuccess(tier, nowMs, wallClock);
+
+    // The full forecast carries current conditions too
+    if (tier == WEATHER_TIER_FORECAST) {
+        stats_[WEATHER_TIER_CURRENT].consecutive_failures = 0;
+        scheduleAfterSuccess(WEATHER_TIER_CURRENT, nowMs, wallClock);
+    }
+}
+
+void RefreshScheduler::markFailure(WeatherTier tier, uint32_t nowMs, uint32_t bytes) {
+    WeatherTierStats& stats = stats_[tier];
+    stats.failures++;
+    stats.consecutive_failures++;
+    stats.total_bytes += bytes;
+    uint32_t delay = backoffMs(tier);
+    next_due_ms_[tier] = nowMs + delay;
+
+    // Don't let the cheap tier hammer the server while the expensive one backs off
+    if (tier == WEATHER_TIER_FORECAST &&
+        reached(next_due_ms_[WEATHER_TIER_FORECAST], next_due_ms_[WEATHER_TIER_CURRENT])) {
+        next_due_ms_[WEATHER_TIER_CURRENT] = next_due_ms_[WEATHER_TIER_FORECAST];
+    }
+    LOG_WEATHER_W("%s fetch failed %u times in a row, retrying in %u s", tierName(tier),
+                  stats.consecutive_failures, delay / 1000);
+}
+
+void RefreshScheduler::scheduleAfterSuccess(WeatherTier tier, uint32_t nowMs, time_t wallClock) {
+    const WeatherTierConfig& config = configs_[tier];
+    uint32_t delay = config.interval_ms;
+
+    uint32_t intervalS = config.interval_ms / 1000;
+    if (config.align_offset_s && intervalS && wallClock > MIN_VALID_EPOCH) {
+        // Next slot at the offset past an interval boundary, at least half an
+        // interval away so a fetch just before a slot doesn't repeat right after
+        time_t slot = (wallClock - config.align_offset_s) / intervalS * intervalS +
+                      config.align_offset_s;
+        while (slot - wallClock < (time_t) intervalS / 2) {
+            slot += intervalS;
+        }
+        delay = (uint32_t) (slot - wallClock) * 1000;
+    }
+    next_due_ms_[tier] = nowMs + delay;
+}
+
+uint32_t RefreshScheduler::backoffMs(WeatherTier tier) const {
+    const WeatherTierConfig& config = configs_[tier];
+    uint32_t shift = min(stats_[tier].consecutive_failures - 1, (uint32_t) 16);
+    uint64_t delay = (uint64_t) config.retry_min_ms << shift;
+    uint32_t capped = (uint32_t) min(delay, (uint64_t) config.retry_max_ms);
+    return capped / 2 + esp_random() % (capped / 2 + 1);
+}
+
+void RefreshScheduler::logStats(WeatherTier tier) const {
+    const WeatherTierStats& stats = stats_[tier];
+    uint32_t now = millis();
+    uint32_t next = reached(now, next_due_ms_[tier]) ? 0 : next_due_ms_[tier] - now;
+    LOG_WEATHER_I("%s tier: %u ok, %u failed, last %u bytes (%u total), last success %lu s ago, "
+                  "next in %u s",
+                  tierName(tier), stats.successes, stats.failures, stats.last_bytes,
+                  stats.total_bytes,
+                  stats.successes ? (unsigned long) ((now - stats.last_success_ms) / 1000) : 0UL,
+                  next / 1000);
+}
+
+const char* RefreshScheduler::tierName(WeatherTier tier) {
+    return tier == WEATHER_TIER_FORECAST ? "Forecast" : "Current";
+}
@@ -0,0 +1,68 @@
+#ifndef REFRESH_SCHEDULER_H
+#define REFRESH_SCHEDULER_H
+
+#include "../../config.h"
+#include <Arduino.h>
+#include <time.h>
+
+// What a fetch downloads: current conditions only, or the full forecast
+// (which includes current conditions)
+enum WeatherTier { WEATHER_TIER_CURRENT = 0, WEATHER_TIER_FORECAST = 1, WEATHER_TIER_COUNT = 2 };
+
+struct WeatherTierConfig {
+    uint32_t interval_ms;
+    uint32_t align_offset_s;   // Wall-clock alignment within the interval; 0 = none
+    uint32_t retry_min_ms;
+    uint32_t retry_max_ms;
+};
+
+struct WeatherTierStats {
+    uint32_t successes;
+    uint32_t failures;
+    uint32_t consecutive_failures;
+    time_t last_success_time;  // Wall clock, 0 if unknown
+    uint32_t last_success_ms;  // millis() at the last success
+    uint32_t last_bytes;       // Response body bytes on the wire
+    uint32_t total_bytes;
+};
+
+// Decides which tier to fetch next and when.
+//
+// Each tier has its own due time. After a success the tier is due again
+// one interval later, or at the next aligned wall-clock slot once the clock
+// is set. A forecast fetch also refreshes current conditions. After a
+// failure the tier retries with exponential backoff and "equal jitter": half
+// the delay is fixed and half is random, so devices that failed together
+// don't all retry together.
+class RefreshScheduler {
+public:
+    RefreshScheduler();
+
+    void configure(WeatherTier tier, const WeatherTierConfig& config);
+    const WeatherTierConfig& config(WeatherTier tier) const { return configs_[tier]; }
+
+    // The most urgent due tier; the forecast wins when both are due
+    bool nextDue(uint32_t nowMs, WeatherTier& tier) const;
+    uint32_t msUntilNextDue(uint32_t nowMs) const;
+
+    // Makes every tier due now, e.g. after a location change
+    void requestAll(uint32_t nowMs);
+
+    void markSuccess(WeatherTier tier, uint32_t nowMs, time_t wallClock, uint32_t bytes);
+    void markFailure(WeatherTier tier, uint32_t nowMs, uint32_t bytes);
+
+    const WeatherTierStats& stats(WeatherTier tier) const { return stats_[tier]; }
+    void logStats(WeatherTier tier) const;
+
+    static const char* tierName(WeatherTier tier);
+
+private:
+    WeatherTierConfig configs_[WEATHER_TIER_COUNT];
+    WeatherTierStats stats_[WEATHER_TIER_COUNT];
+    uint32_t next_due_ms_[WEATHER_TIER_COUNT];
+
+    void scheduleAfterSuccess(WeatherTier tier, uint32_t nowMs, time_t wallClock);
+    uint32_t backoffMs(WeatherTier tier) const;
+};
+
+#endif // REFRESH_SCHEDULER_H
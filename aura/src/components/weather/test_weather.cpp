@@ -0,0 +1,1041 @@
+/*
+ * Test file for the Aura Weather Module
+ * Benchmarks the forecast parse paths against recorded-shape responses
+ * Include this test in the main application temporarily for verification
+ */
+
+#include "weather.h"
+#include "weather_snapshot.h"
+#include "location_search.h"
+#include "city_index.h"
+#include "lan_share.h"
+#include "hedged_fetch.h"
+#include "http_timing.h"
+#include "test_weather_fixtures.h"
+#include "../logging/logging.h"
+#include <memory>
+#include <vector>
+
+// Read-only Stream over an in-memory response, standing in for the socket
+class FixtureStream : public Stream {
+public:
+    FixtureStream(const char* data, size_t length) : data_(data), length_(length), position_(0) {}
+
+    int available() override { return length_ - position_; }
+    int read() override { return position_ < length_ ? (uint8_t) data_[position_++] : -1; }
+    int peek() override { return position_ < length_ ? (uint8_t) data_[position_] : -1; }
+    size_t readBytes(char* buffer, size_t length) {
+        size_t count = min(length, length_ - position_);
+        memcpy(buffer, data_ + position_, count);
+        position_ += count;
+        return count;
+    }
+    size_t write(uint8_t) override { return 0; }
+
+private:
+    const char* data_;
+    size_t length_;
+    size_t position_;
+};
+
+// Heap allocator that records the high-water mark of a JsonDocument
+class CountingAllocator : public ArduinoJson::Allocator {
+public:
+    size_t current = 0;
+    size_t peak = 0;
+    uint32_t allocations = 0;
+
+    void* allocate(size_t size) override {
+        size_t* block = static_cast<size_t*>(malloc(size + sizeof(size_t)));
+        if (!block) {
+            return nullptr;
+        }
+        *block = size;
+        track(size);
+        return block + 1;
+    }
+
+    void deallocate(void* pointer) override {
+        if (pointer) {
+            size_t* block = static_cast<size_t*>(pointer) - 1;
+            current -= *block;
+            free(block);
+        }
+    }
+
+    void* reallocate(void* pointer, size_t new_size) override {
+        if (!pointer) {
+            return allocate(new_size);
+        }
+        size_t* block = static_cast<size_t*>(pointer) - 1;
+        size_t old_size = *block;
+        size_t* moved = static_cast<size_t*>(realloc(block, new_size + sizeof(size_t)));
+        if (!moved) {
+            return nullptr;
+        }
+        *moved = new_size;
+        current -= old_size;
+        track(new_size);
+        return moved + 1;
+    }
+
+private:
+    void track(size_t size) {
+        current += size;
+        allocations++;
+        if (current > peak) {
+            peak = current;
+        }
+    }
+};
+
+// Fixture timeline: 2025-07-20 00:00 in a UTC+1 zone
+static const int32_t FIXTURE_UTC_OFFSET = 3600;
+static const int64_t FIXTURE_START = 1752969600 - FIXTURE_UTC_OFFSET;
+
+// Builds a response with the same layout and volume as a 7-day Open-Meteo
+// forecast requested with timeformat=unixtime: metadata and units blocks,
+// 7 daily rows and 168 hourly rows
+static void build_forecast_fixture(String& out) {
+    out = "";
+    out.reserve(12 * 1024);
+    out += "{\"latitude\":51.5,\"longitude\":-0.12000012,\"generationtime_ms\":0.0680685,"
+           "\"utc_offset_seconds\":3600,\"timezone\":\"Europe/London\","
+           "\"timezone_abbreviation\":\"GMT+1\",\"elevation\":23.0,";
+    out += "\"current_units\":{\"time\":\"unixtime\",\"interval\":\"seconds\","
+           "\"temperature_2m\":\"°C\",\"apparent_temperature\":\"°C\",\"is_day\":\"\","
+           "\"weather_code\":\"wmo code\"},";
+    out += "\"current\":{\"time\":";
+    out += String((long) (FIXTURE_START + 14 * 3600));
+    out += ",\"interval\":900,\"temperature_2m\":21.4,"
+           "\"apparent_temperature\":20.9,\"is_day\":1,\"weather_code\":3},";
+
+    out += "\"hourly_units\":{\"time\":\"unixtime\",\"temperature_2m\":\"°C\","
+           "\"weather_code\":\"wmo code\",\"precipitation_probability\":\"%\"},";
+    out += "\"hourly\":{\"time\":[";
+    for (int i = 0; i < 168; i++) {
+        out += (i ? "," : "");
+        out += String((long) (FIXTURE_START + i * 3600));
+    }
+    out += "],\"temperature_2m\":[";
+    for (int i = 0; i < 168; i++) {
+        char entry[12];
+        snprintf(entry, sizeof(entry), "%s%.1f", i ? "," : "", 14.0f + (i % 24) * 0.4f);
+        out += entry;
+    }
+    out += "],\"weather_code\":[";
+    for (int i = 0; i < 168; i++) {
+        out += (i ? "," : "");
+        out += String((i * 7) % 4 == 0 ? 61 : 3);
+    }
+    out += "],\"precipitation_probability\":[";
+    for (int i = 0; i < 168; i++) {
+        out += (i ? "," : "");
+        out += String((i * 13) % 100);
+    }
+    out += "]},";
+
+    out += "\"daily_units\":{\"time\":\"unixtime\",\"temperature_2m_max\":\"°C\","
+           "\"temperature_2m_min\":\"°C\",\"weather_code\":\"wmo code\"},";
+    out += "\"daily\":{\"time\":[";
+    for (int i = 0; i < 7; i++) {
+        out += (i ? "," : "");
+        out += String((long) (FIXTURE_START + i * 86400));
+    }
+    out += "],\"temperature_2m_max\":[23.1,24.6,22.0,19.8,21.3,25.7,26.2],"
+           "\"temperature_2m_min\":[14.2,15.0,13.9,12.1,12.8,15.5,16.4],"
+           "\"weather_code\":[3,61,80,63,2,1,0]}}";
+}
+
+static float fixture_hourly_temp(int hour) {
+    // Same value the JSON fixture prints with one decimal
+    char text[12];
+    snprintf(text, sizeof(text), "%.1f", 14.0f + (hour % 24) * 0.4f);
+    return strtof(text, nullptr);
+}
+
+// Writes a size-prefixed FlatBuffer front to back, so a parent table can be
+// patched to point at children appended after it. Inline fields are only
+// 4-byte aligned, which the reader's memcpy access tolerates.
+class FixtureFlatBuilder {
+public:
+    std::vector<uint8_t> bytes;
+
+    FixtureFlatBuilder() : bytes(8, 0) {}  // Size prefix and root offset
+
+    // Appends a table whose fields have the given inline widths (0 = absent)
+    size_t table(const uint8_t* widths, uint16_t count) {
+        uint16_t offsets[16];
+        uint16_t table_size = 4;
+        for (uint16_t i = 0; i < count; i++) {
+            offsets[i] = 0;
+            if (widths[i]) {
+                uint16_t align = widths[i] > 4 ? 4 : widths[i];
+                table_size = (table_size + align - 1) & ~(align - 1);
+                offsets[i] = table_size;
+                table_size += widths[i];
+            }
+        }
+
+        pad();
+        size_t vtable = bytes.size();
+        append<uint16_t>(4 + 2 * count);
+        append<uint16_t>(table_size);
+        for (uint16_t i = 0; i < count; i++) {
+            append<uint16_t>(offsets[i]);
+        }
+
+        pad();
+        size_t table = bytes.size();
+        bytes.resize(table + table_size, 0);
+        put<int32_t>(table, (int32_t) (table - vtable));
+        return table;
+    }
+
+    template <typename T>
+    void scalar(size_t table, uint16_t field, T value) {
+        put<T>(field_position(table, field), value);
+    }
+
+    void link(size_t table, uint16_t field, size_t target) {
+        size_t position = field_position(table, field);
+        put<uint32_t>(position, (uint32_t) (target - position));
+    }
+
+    size_t string(const char* text) {
+        pad();
+        size_t position = bytes.size();
+        append<uint32_t>(strlen(text));
+        bytes.insert(bytes.end(), text, text + strlen(text) + 1);
+        return position;
+    }
+
+    size_t floats(const float* values, size_t count) {
+        pad();
+        size_t position = bytes.size();
+        append<uint32_t>(count);
+        for (size_t i = 0; i < count; i++) {
+            append<float>(values[i]);
+        }
+        return position;
+    }
+
+    // Vector of table offsets, filled in with link_element()
+    size_t tables(size_t count) {
+        pad();
+        size_t position = bytes.size();
+        append<uint32_t>(count);
+        bytes.resize(bytes.size() + count * 4, 0);
+        return position;
+    }
+
+    void link_element(size_t vector, size_t index, size_t target) {
+        size_t position = vector + 4 + index * 4;
+        put<uint32_t>(position, (uint32_t) (target - position));
+    }
+
+    void finish(size_t root) {
+        put<uint32_t>(4, (uint32_t) (root - 4));
+        put<uint32_t>(0, (uint32_t) (bytes.size() - 4));
+    }
+
+private:
+    void pad() {
+        while (bytes.size() % 4) {
+            bytes.push_back(0);
+        }
+    }
+
+    template <typename T>
+    void append(T value) {
+        size_t position = bytes.size();
+        bytes.resize(position + sizeof(T));
+        put<T>(position, value);
+    }
+
+    template <typename T>
+    void put(size_t position, T value) {
+        memcpy(&bytes[position], &value, sizeof(T));
+    }
+
+    size_t field_position(size_t table, uint16_t field) {
+        int32_t vtable_offset;
+        uint16_t offset;
+        memcpy(&vtable_offset, &bytes[table], sizeof(vtable_offset));
+        memcpy(&offset, &bytes[table - vtable_offset + 4 + 2 * field], sizeof(offset));
+        return table + offset;
+    }
+};
+
+// VariableWithValues: variable, unit, value, values, values_int64, altitude, aggregation
+static const uint8_t FIXTURE_CURRENT_VARIABLE[] = {1, 1, 4, 0, 0, 2, 0};
+static const uint8_t FIXTURE_SERIES_VARIABLE[] = {1, 1, 0, 4, 0, 2, 1};
+// VariablesWithTime: time, time_end, interval, variables
+static const uint8_t FIXTURE_BLOCK[] = {8, 8, 4, 4};
+// WeatherApiResponse: latitude ... hourly
+static const uint8_t FIXTURE_RESPONSE[] = {4, 4, 4, 4, 8, 1, 4, 4, 4, 4, 4, 4};
+
+static size_t add_fixture_block(FixtureFlatBuilder& fb, size_t response, uint16_t field,
+                                int64_t start, int32_t interval, size_t steps, size_t count) {
+    size_t block = fb.table(FIXTURE_BLOCK, 4);
+    fb.link(response, field, block);
+    fb.scalar<int64_t>(block, 0, start);
+    fb.scalar<int64_t>(block, 1, start + (int64_t) steps * interval);
+    fb.scalar<int32_t>(block, 2, interval);
+    size_t variables = fb.tables(count);
+    fb.link(block, 3, variables);
+    return variables;
+}
+
+static size_t add_fixture_series(FixtureFlatBuilder& fb, size_t variables, size_t index,
+                                 uint8_t variable, uint8_t aggregation, int16_t altitude,
+                                 const float* values, size_t count) {
+    size_t table = fb.table(FIXTURE_SERIES_VARIABLE, 7);
+    fb.link_element(variables, index, table);
+    fb.scalar<uint8_t>(table, 0, variable);
+    fb.scalar<int16_t>(table, 5, altitude);
+    fb.scalar<uint8_t>(table, 6, aggregation);
+    fb.link(table, 3, fb.floats(values, count));
+    return table;
+}
+
+// Same forecast as build_forecast_fixture(), laid out as Open-Meteo's
+// size-prefixed FlatBuffers response (openmeteo_sdk weather_api.fbs)
+static void build_forecast_flatbuffer_fixture(std::vector<uint8_t>& out) {
+    FixtureFlatBuilder fb;
+    size_t response = fb.table(FIXTURE_RESPONSE, 12);
+    fb.scalar<float>(response, 0, 51.5f);
+    fb.scalar<float>(response, 1, -0.12000012f);
+    fb.scalar<float>(response, 2, 23.0f);
+    fb.scalar<float>(response, 3, 0.0680685f);
+    fb.scalar<int32_t>(response, 6, FIXTURE_UTC_OFFSET);
+    fb.link(response, 7, fb.string("Europe/London"));
+    fb.link(response, 8, fb.string("GMT+1"));
+
+    // current: temperature (2 m), apparent_temperature, is_day, weather_code
+    const uint8_t current_variables[] = {47, 1, 19, 56};
+    const float current_values[] = {21.4f, 20.9f, 1.0f, 3.0f};
+    size_t current = add_fixture_block(fb, response, 9, FIXTURE_START + 14 * 3600, 900, 1, 4);
+    for (size_t i = 0; i < 4; i++) {
+        size_t table = fb.table(FIXTURE_CURRENT_VARIABLE, 7);
+        fb.link_element(current, i, table);
+        fb.scalar<uint8_t>(table, 0, current_variables[i]);
+        fb.scalar<float>(table, 2, current_values[i]);
+        if (i < 2) {
+            fb.scalar<int16_t>(table, 5, 2);
+        }
+    }
+
+    // daily: temperature max and min (2 m), weather_code
+    const float daily_max[] = {23.1f, 24.6f, 22.0f, 19.8f, 21.3f, 25.7f, 26.2f};
+    const float daily_min[] = {14.2f, 15.0f, 13.9f, 12.1f, 12.8f, 15.5f, 16.4f};
+    const float daily_codes[] = {3, 61, 80, 63, 2, 1, 0};
+    size_t daily = add_fixture_block(fb, response, 10, FIXTURE_START, 86400, 7, 3);
+    add_fixture_series(fb, daily, 0, 47, 2, 2, daily_max, 7);
+    add_fixture_series(fb, daily, 1, 47, 1, 2, daily_min, 7);
+    add_fixture_series(fb, daily, 2, 56, 0, 0, daily_codes, 7);
+
+    // hourly: temperature (2 m), weather_code, precipitation_probability
+    static float hourly_values[3][168];
+    for (int i = 0; i < 168; i++) {
+        hourly_values[0][i] = fixture_hourly_temp(i);
+        hourly_values[1][i] = (i * 7) % 4 == 0 ? 61 : 3;
+        hourly_values[2][i] = (i * 13) % 100;
+    }
+    size_t hourly = add_fixture_block(fb, response, 11, FIXTURE_START, 3600, 168, 3);
+    add_fixture_series(fb, hourly, 0, 47, 0, 2, hourly_values[0], 168);
+    add_fixture_series(fb, hourly, 1, 56, 0, 0, hourly_values[1], 168);
+    add_fixture_series(fb, hourly, 2, 26, 0, 0, hourly_values[2], 168);
+
+    fb.finish(response);
+    out.swap(fb.bytes);
+}
+
+// Weather keeps a forecast per favourite and its own parse arena, too much
+// for the loop task stack
+static std::unique_ptr<Weather> make_test_weather() {
+    return std::unique_ptr<Weather>(new Weather());
+}
+
+// Compares every WeatherData field the UI reads, logging each difference
+static int count_weather_mismatches(const WeatherData& expected, const WeatherData& actual) {
+    int mismatches = 0;
+    if (expected.current_temp != actual.current_temp || expected.feels_like != actual.feels_like ||
+        expected.weather_code != actual.weather_code || expected.is_day != actual.is_day ||
+        expected.utc_offset != actual.utc_offset) {
+        LOG_WEATHER_E("Current conditions differ");
+        mismatches++;
+    }
+    for (int i = 0; i < 7; i++) {
+        if (expected.daily_high[i] != actual.daily_high[i] ||
+            expected.daily_low[i] != actual.daily_low[i] ||
+            expected.daily_codes[i] != actual.daily_codes[i] ||
+            expected.daily_times[i] != actual.daily_times[i]) {
+            LOG_WEATHER_E("Day %d differs: %u vs %u", i, expected.daily_times[i],
+                          actual.daily_times[i]);
+            mismatches++;
+        }
+    }
+    if (expected.hourly_start != actual.hourly_start ||
+        expected.hourly_count != actual.hourly_count) {
+        LOG_WEATHER_E("Hourly series differs: %u x %u vs %u x %u", expected.hourly_start,
+                      expected.hourly_count, actual.hourly_start, actual.hourly_count);
+        mismatches++;
+    }
+    for (int i = 0; i < expected.hourly_count; i++) {
+        if (expected.hourly_temps[i] != actual.hourly_temps[i] ||
+            expected.hourly_codes[i] != actual.hourly_codes[i] ||
+            expected.hourly_precipitation[i] != actual.hourly_precipitation[i]) {
+            LOG_WEATHER_E("Hour %d differs", i);
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+void test_weather_flatbuffers_match_json() {
+    LOG_WEATHER_I("=== Testing FlatBuffers Decode Against JSON ===");
+
+    std::unique_ptr<Weather> weather = make_test_weather();
+    String json;
+    build_forecast_fixture(json);
+    FixtureStream json_stream(json.c_str(), json.length());
+    WeatherData expected = {};
+    bool json_ok = weather->parseWeatherStream(json_stream, expected);
+
+    std::vector<uint8_t> flatbuffer;
+    build_forecast_flatbuffer_fixture(flatbuffer);
+    FixtureStream fb_stream((const char*) flatbuffer.data(), flatbuffer.size());
+    WeatherData actual = {};
+    bool fb_ok = weather->parseWeatherFlatBufferStream(fb_stream, actual);
+    int mismatches = count_weather_mismatches(expected, actual);
+
+    bool passed = json_ok && fb_ok && mismatches == 0;
+    LOG_WEATHER_I("FlatBuffers decode %s (%d mismatches)", passed ? "PASSED" : "FAILED",
+                  mismatches);
+}
+
+// Inflates a fixture and checks it byte for byte against the plain body
+static bool inflate_matches(const uint8_t* compressed, size_t length,
+                            InflateStream::Encoding encoding, const String& plain) {
+    FixtureStream source((const char*) compressed, length);
+    InflateStream body(source, encoding);
+    if (!body.begin()) {
+        return false;
+    }
+
+    char chunk[256];
+    size_t offset = 0;
+    size_t count;
+    while ((count = body.readBytes(chunk, sizeof(chunk))) > 0) {
+        if (offset + count > plain.length() || memcmp(chunk, plain.c_str() + offset, count) != 0) {
+            LOG_WEATHER_E("Inflated body differs near byte %u", offset);
+            return false;
+        }
+        offset += count;
+    }
+    return !body.hasError() && offset == plain.length();
+}
+
+void test_weather_compressed_responses() {
+    LOG_WEATHER_I("=== Testing Compressed Responses ===");
+
+    std::unique_ptr<Weather> weather = make_test_weather();
+    String json;
+    build_forecast_fixture(json);
+    FixtureStream json_stream(json.c_str(), json.length());
+    WeatherData expected = {};
+    bool passed = weather->parseWeatherStream(json_stream, expected);
+
+    // Forecast: both codings inflate to the plain body and parse identically
+    struct {
+        const char* name;
+        const uint8_t* data;
+        size_t length;
+        InflateStream::Encoding encoding;
+    } forecasts[] = {
+        {"gzip", FORECAST_JSON_GZIP, sizeof(FORECAST_JSON_GZIP), InflateStream::ENCODING_GZIP},
+        {"deflate", FORECAST_JSON_DEFLATE, sizeof(FORECAST_JSON_DEFLATE),
+         InflateStream::ENCODING_DEFLATE},
+    };
+    for (const auto& forecast : forecasts) {
+        bool identical = inflate_matches(forecast.data, forecast.length, forecast.encoding, json);
+
+        FixtureStream source((const char*) forecast.data, forecast.length);
+        InflateStream body(source, forecast.encoding);
+        WeatherData actual = {};
+        bool parsed = body.begin() && weather->parseWeatherStream(body, actual) && !body.hasError();
+        int mismatches = count_weather_mismatches(expected, actual);
+
+        LOG_WEATHER_I("Forecast %s: body %s, parse %s, %u -> %u bytes (%u saved)",
+                      forecast.name, identical ? "identical" : "DIFFERS",
+                      parsed && mismatches == 0 ? "identical" : "DIFFERS",
+                      body.compressedBytes(), body.decompressedBytes(),
+                      body.decompressedBytes() - body.compressedBytes());
+        passed = passed && identical && parsed && mismatches == 0;
+    }
+
+    // Geocoding: same results from the plain and gzip bodies
+    LocationResults expected_results = {};
+    FixtureStream plain_stream(GEOCODING_JSON, strlen(GEOCODING_JSON));
+    bool plain_ok = weather->parseLocationStream(plain_stream, expected_results);
+
+    LocationResults actual_results = {};
+    FixtureStream gzip_stream((const char*) GEOCODING_JSON_GZIP, sizeof(GEOCODING_JSON_GZIP));
+    InflateStream body(gzip_stream, InflateStream::ENCODING_GZIP);
+    bool gzip_ok = body.begin() && weather->parseLocationStream(body, actual_results) &&
+                   !body.hasError();
+
+    bool geocoding_identical = plain_ok && gzip_ok && expected_results.count > 0 &&
+                               memcmp(&expected_results, &actual_results,
+                                      sizeof(LocationResults)) == 0;
+    LOG_WEATHER_I("Geocoding gzip: %u results %s, %u -> %u bytes (%u saved)",
+                  actual_results.count, geocoding_identical ? "identical" : "DIFFER",
+                  body.compressedBytes(), body.decompressedBytes(),
+                  body.decompressedBytes() - body.compressedBytes());
+    passed = passed && geocoding_identical;
+
+    LOG_WEATHER_I("Compressed responses %s", passed ? "PASSED" : "FAILED");
+    LOG_MEMORY_INFO(TAG_WEATHER);
+}
+
+void test_weather_local_times() {
+    LOG_WEATHER_I("=== Testing Forecast Local Times ===");
+
+    std::unique_ptr<Weather> weather = make_test_weather();
+    String json;
+    build_forecast_fixture(json);
+    FixtureStream json_stream(json.c_str(), json.length());
+    WeatherData data = {};
+    bool passed = weather->parseWeatherStream(json_stream, data);
+
+    // The fixture starts on Sunday 2025-07-20 at local midnight
+    for (int day = 0; day < 7; day++) {
+        passed = passed && weatherWeekday(data.daily_times[day], data.utc_offset) == day;
+    }
+    passed = passed && data.hourly_count == WEATHER_HOURLY_CAPACITY;
+    for (int hour = 0; hour < data.hourly_count; hour++) {
+        uint8_t local_hour = weatherHour(weatherHourlyTime(data, hour), data.utc_offset);
+        passed = passed && local_hour == hour % 24 &&
+                 data.hourly_temps[hour] == weatherTempFromFloat(fixture_hourly_temp(hour));
+    }
+
+    // The hourly window follows the clock and stays inside the series
+    const uint32_t afternoon = FIXTURE_START + 14 * 3600 + 1800;
+    const uint32_t last_hour = FIXTURE_START + (WEATHER_HOURLY_CAPACITY - 1) * 3600;
+    passed = passed && weatherHourlyIndex(data, afternoon) == 14 &&
+             weatherHourlyIndex(data, afternoon + 3 * 86400) == 3 * 24 + 14 &&
+             weatherHourlyIndex(data, FIXTURE_START - 1) == -1 &&
+             weatherHourlyWindow(data, afternoon, 7) == 14 &&
+             weatherHourlyWindow(data, FIXTURE_START - 3600, 7) == 0 &&
+             weatherHourlyWindow(data, last_hour, 7) == WEATHER_HOURLY_CAPACITY - 7 &&
+             weatherHourlyWindow(data, last_hour + 86400, 7) == WEATHER_HOURLY_CAPACITY - 7;
+    passed = passed && data.current_temp == 214 && data.daily_low[3] == 121;
+
+    LOG_WEATHER_I("Local times and fixed-point temperatures %s", passed ? "PASSED" : "FAILED");
+}
+
+void test_weather_snapshot() {
+    LOG_WEATHER_I("=== Testing Forecast Snapshot Format ===");
+
+    std::unique_ptr<Weather> weather = make_test_weather();
+    String json;
+    build_forecast_fixture(json);
+    FixtureStream json_stream(json.c_str(), json.length());
+    WeatherData expected = {};
+    bool passed = weather->parseWeatherStream(json_stream, expected);
+    strlcpy(expected.location_name, "London", sizeof(expected.location_name));
+    expected.fetched_at = 1753020000;
+
+    // Round trip restores every field and flags the copy as stale
+    uint8_t blob[WeatherSnapshot::MAX_SIZE];
+    size_t length = WeatherSnapshot::encode(expected, blob, sizeof(blob));
+    WeatherData restored = {};
+    bool round_trip = length > 0 && WeatherSnapshot::decode(blob, length, restored) &&
+                      count_weather_mismatches(expected, restored) == 0 &&
+                      strcmp(restored.location_name, expected.location_name) == 0 &&
+                      restored.fetched_at == expected.fetched_at && restored.stale;
+    LOG_WEATHER_I("Round trip (%u bytes): %s", length, round_trip ? "PASSED" : "FAILED");
+    passed = passed && round_trip;
+
+    // Every damaged blob is rejected and leaves the output untouched
+    struct {
+        const char* name;
+        size_t offset;    // Byte to flip, or SIZE_MAX for none
+        size_t length;
+    } damaged[] = {
+        {"payload bit flip", WeatherSnapshot::HEADER_SIZE + 40, length},
+        {"bad magic", 0, length},
+        {"old version", 4, length},
+        {"truncated", SIZE_MAX, length - 1},
+        {"header only", SIZE_MAX, WeatherSnapshot::HEADER_SIZE},
+        {"empty", SIZE_MAX, 0},
+    };
+    for (const auto& test : damaged) {
+        uint8_t copy[WeatherSnapshot::MAX_SIZE];
+        memcpy(copy, blob, length);
+        if (test.offset != SIZE_MAX) {
+            copy[test.offset] ^= 0x01;
+        }
+        WeatherData untouched = {};
+        untouched.current_temp = -990;
+        bool rejected = !WeatherSnapshot::decode(copy, test.length, untouched) &&
+                        untouched.current_temp == -990 && !untouched.stale;
+        LOG_WEATHER_I("Reject %s: %s", test.name, rejected ? "PASSED" : "FAILED");
+        passed = passed && rejected;
+    }
+
+    // A buffer too small for the snapshot is reported, not overrun
+    bool too_small = WeatherSnapshot::encode(expected, blob, length - 1) == 0;
+    LOG_WEATHER_I("Undersized buffer: %s", too_small ? "PASSED" : "FAILED");
+    passed = passed && too_small;
+
+    LOG_WEATHER_I("Forecast snapshot %s", passed ? "PASSED" : "FAILED");
+}
+
+void test_weather_favourites() {
+    LOG_WEATHER_I("=== Testing Batched Favourites ===");
+
+    // Weather::init() is never called, so nothing is written to preferences
+    std::unique_ptr<Weather> weather = make_test_weather();
+    weather->addFavourite("51.5074", "-0.1278", "London");
+    weather->addFavourite("48.8566", "2.3522", "Paris");
+    weather->addFavourite("52.5200", "13.4050", "Berlin");
+
+    String json;
+    build_forecast_fixture(json);
+    WeatherData expected = {};
+    FixtureStream single_stream(json.c_str(), json.length());
+    bool passed = weather->parseWeatherStream(single_stream, expected);
+
+    // Open-Meteo answers a multi-location request with a JSON array
+    String batch = "[" + json + ",\n" + json + ", " + json + "]";
+    FixtureStream batch_stream(batch.c_str(), batch.length());
+    bool json_ok = weather->parseWeatherBatchStream(batch_stream, WEATHER_TIER_FORECAST) &&
+                   weather->hasAllFavouriteData();
+    for (uint8_t i = 0; i < weather->getFavouriteCount(); i++) {
+        const WeatherData& data = weather->getFavouriteData(i);
+        json_ok = json_ok && count_weather_mismatches(expected, data) == 0 &&
+                  strcmp(data.location_name, weather->getFavourite(i).name) == 0;
+    }
+    LOG_WEATHER_I("JSON array of 3 forecasts: %s", json_ok ? "PASSED" : "FAILED");
+
+    // ...and FlatBuffers with back-to-back size-prefixed messages
+    std::vector<uint8_t> flatbuffer;
+    build_forecast_flatbuffer_fixture(flatbuffer);
+    std::vector<uint8_t> fb_batch;
+    for (int i = 0; i < 3; i++) {
+        fb_batch.insert(fb_batch.end(), flatbuffer.begin(), flatbuffer.end());
+    }
+    FixtureStream fb_stream((const char*) fb_batch.data(), fb_batch.size());
+    bool fb_ok = weather->parseWeatherFlatBufferBatchStream(fb_stream, WEATHER_TIER_FORECAST) &&
+                 count_weather_mismatches(expected, weather->getFavouriteData(2)) == 0;
+    LOG_WEATHER_I("FlatBuffers batch of 3 forecasts: %s", fb_ok ? "PASSED" : "FAILED");
+
+    // A short response commits the complete forecasts and leaves the rest alone
+    weather->removeFavourite(0);
+    weather->addFavourite("40.4168", "-3.7038", "Madrid");
+    String short_batch = "[" + json + "," + json + "]";
+    FixtureStream short_stream(short_batch.c_str(), short_batch.length());
+    FixtureStream object_stream(json.c_str(), json.length());
+    bool partial_ok = !weather->parseWeatherBatchStream(short_stream, WEATHER_TIER_FORECAST) &&
+                      !weather->parseWeatherBatchStream(object_stream, WEATHER_TIER_FORECAST) &&
+                      weather->hasFavouriteData(0) && weather->hasFavouriteData(1) &&
+                      !weather->hasFavouriteData(2) && !weather->hasAllFavouriteData();
+    LOG_WEATHER_I("Truncated batch: %s", partial_ok ? "PASSED" : "FAILED");
+
+    // Removing keeps locations and forecasts in step and the selection valid
+    bool list_ok = weather->getFavouriteCount() == 3 && weather->getActiveFavourite() == 2 &&
+                   strcmp(weather->getFavourite(0).name, "Paris") == 0 &&
+                   strcmp(weather->getFavouriteData(1).location_name, "Berlin") == 0 &&
+                   weather->removeFavourite(2) && weather->getActiveFavourite() == 1 &&
+                   weather->selectFavourite(0) && weather->removeFavourite(0) &&
+                   weather->getActiveFavourite() == 0 && weather->getLocationName() == "Berlin" &&
+                   !weather->removeFavourite(0) && !weather->selectFavourite(1);
+    LOG_WEATHER_I("Favourite list edits: %s", list_ok ? "PASSED" : "FAILED");
+
+    passed = passed && json_ok && fb_ok && partial_ok && list_ok;
+    LOG_WEATHER_I("Batched favourites %s", passed ? "PASSED" : "FAILED");
+}
+
+void test_city_index() {
+    LOG_WEATHER_I("=== Testing Offline City Index ===");
+
+    // Every name starts with a letter, so the letters together must decode
+    // each entry exactly once, across all the block boundaries
+    const CityIndex& index = CityIndex::builtin();
+    std::vector<CityMatch> all(index.size());
+    size_t decoded = 0;
+    for (char letter = 'a'; letter <= 'z'; letter++) {
+        char prefix[2] = {letter, '\0'};
+        decoded += index.search(prefix, all.data(), all.size());
+    }
+    bool passed = decoded == index.size();
+    LOG_WEATHER_I("Decoded %u of %u cities (%u bytes of flash): %s", decoded, index.size(),
+                  index.footprint(), passed ? "PASSED" : "FAILED");
+
+    // Case is ignored and the bigger place comes first
+    CityMatch matches[LOCATION_SEARCH_MAX_RESULTS];
+    unsigned long start = micros();
+    size_t found = index.search("LONDON", matches, LOCATION_SEARCH_MAX_RESULTS);
+    unsigned long elapsed = micros() - start;
+    bool ranked = found == 2 && strcmp(matches[0].name, "London") == 0 &&
+                  strcmp(matches[0].country, "United Kingdom") == 0 &&
+                  fabsf(matches[0].latitude - 51.51f) < 0.001f &&
+                  strcmp(matches[1].country, "Canada") == 0 && matches[0].rank > matches[1].rank;
+    bool capped = index.search("b", matches, 3) == 3 && matches[0].rank >= matches[1].rank &&
+                  matches[1].rank >= matches[2].rank;
+    bool miss = index.search("zzz", matches, LOCATION_SEARCH_MAX_RESULTS) == 0 &&
+                index.search("", matches, LOCATION_SEARCH_MAX_RESULTS) == 0;
+    LOG_WEATHER_I("Ranked %s (%lu us), capped %s, miss %s", ranked ? "PASSED" : "FAILED",
+                  elapsed, capped ? "PASSED" : "FAILED", miss ? "PASSED" : "FAILED");
+
+    passed = passed && ranked && capped && miss;
+    LOG_WEATHER_I("City index %s", passed ? "PASSED" : "FAILED");
+}
+
+static void add_test_result(LocationResults& results, const char* name, const char* country) {
+    LocationResult& result = results.items[results.count++];
+    strlcpy(result.name, name, sizeof(result.name));
+    strlcpy(result.admin1, "", sizeof(result.admin1));
+    strlcpy(result.country, country, sizeof(result.country));
+    result.latitude = 0;
+    result.longitude = 0;
+}
+
+void test_location_search() {
+    LOG_WEATHER_I("=== Testing Location Search Cache ===");
+
+    // Results come back as plain structs, owned by the caller
+    std::unique_ptr<Weather> weather = make_test_weather();
+    LocationResults parsed = {};
+    FixtureStream stream(GEOCODING_JSON, strlen(GEOCODING_JSON));
+    bool passed = weather->parseLocationStream(stream, parsed) &&
+                  parsed.count == 5 &&
+                  strcmp(parsed.items[0].name, "London") == 0 &&
+                  strcmp(parsed.items[0].country, "United Kingdom") == 0 &&
+                  fabsf(parsed.items[0].latitude - 51.50853f) < 0.0001f;
+
+    char key[LOCATION_QUERY_SIZE];
+    LocationSearch::normalizeQuery("  New York  ", key, sizeof(key));
+    passed = passed && strcmp(key, "new york") == 0;
+
+    // Places in the offline index never need the network
+    LocationResults offline = {};
+    bool indexed = LocationSearch::answerFromIndex("edinb", offline) && offline.complete &&
+                   offline.count == 1 && strcmp(offline.items[0].name, "Edinburgh") == 0 &&
+                   !LocationSearch::answerFromIndex("longbeach", offline);
+    LOG_WEATHER_I("Offline index answer %s", indexed ? "PASSED" : "FAILED");
+    passed = passed && indexed;
+
+    // Cache behaviour only; nothing here reaches the search task
+    std::unique_ptr<LocationSearch> search(new LocationSearch(*weather));
+    LocationResults lon = {};
+    strlcpy(lon.query, "lon", sizeof(lon.query));
+    lon.complete = true;
+    add_test_result(lon, "London", "United Kingdom");
+    add_test_result(lon, "Long Beach", "United States");
+    add_test_result(lon, "Londrina", "Brazil");
+    search->storeInCache(lon);
+
+    LocationResults results = {};
+    bool exact = false;
+    bool narrowed = search->answerFromCache("lond", results, exact) && !exact &&
+                    !results.complete && results.count == 2 &&
+                    strcmp(results.items[1].name, "Londrina") == 0 &&
+                    strcmp(results.query, "lond") == 0;
+    bool hit = search->answerFromCache("lon", results, exact) && exact && results.complete &&
+               results.count == 3;
+    bool miss = !search->answerFromCache("par", results, exact);
+    LOG_WEATHER_I("Prefix narrowing %s, exact hit %s, miss %s", narrowed ? "PASSED" : "FAILED",
+                  hit ? "PASSED" : "FAILED", miss ? "PASSED" : "FAILED");
+
+    // Once full, the least recently used query makes room: "query 0", since
+    // "lon" was looked up after it was stored
+    for (int i = 0; i < LOCATION_SEARCH_CACHE_SIZE; i++) {
+        LocationResults filler = {};
+        snprintf(filler.query, sizeof(filler.query), "query %d", i);
+        search->storeInCache(filler);
+        if (i == 0) {
+            search->answerFromCache("lon", results, exact);
+        }
+    }
+    bool evicted = search->answerFromCache("lon", results, exact) && exact &&
+                   !search->answerFromCache("query 0", results, exact) &&
+                   search->answerFromCache("query 1", results, exact);
+    LOG_WEATHER_I("LRU eviction %s", evicted ? "PASSED" : "FAILED");
+
+    passed = passed && narrowed && hit && miss && evicted;
+    LOG_WEATHER_I("Location search %s", passed ? "PASSED" : "FAILED");
+}
+
+void test_lan_share() {
+    LOG_WEATHER_I("=== Testing LAN Sharing ===");
+
+    // The check value every CRC-32 implementation agrees on
+    const char* digits = "123456789";
+    bool crc_ok = LanShare::crc32(0, (const uint8_t*) digits, 9) == 0xcbf43926;
+
+    // London to Paris is about 344 km; across the date line stays short
+    float paris = LanShare::distanceKm(51.5074f, -0.1278f, 48.8566f, 2.3522f);
+    float dateline = LanShare::distanceKm(0.0f, 179.99f, 0.0f, -179.99f);
+    bool distance_ok = fabsf(paris - 344.0f) < 5.0f && dateline < 3.0f;
+
+    // Closed, it neither leads nor sends; the election runs in
+    // tools/lan_share_sim.cpp over loopback multicast
+    LanShare lan;
+    uint8_t payload[4] = {};
+    bool closed_ok = !lan.isOpen() && !lan.isLeader(100000) && !lan.poll(0) &&
+                     !lan.share(1, payload, sizeof(payload));
+
+    bool passed = crc_ok && distance_ok && closed_ok;
+    LOG_WEATHER_I("CRC %s, distance %.1f km %s, closed %s", crc_ok ? "PASSED" : "FAILED", paris,
+                  distance_ok ? "PASSED" : "FAILED", closed_ok ? "PASSED" : "FAILED");
+    LOG_WEATHER_I("LAN sharing %s", passed ? "PASSED" : "FAILED");
+}
+
+void test_weather_providers() {
+    LOG_WEATHER_I("=== Testing Forecast Providers ===");
+
+    // The threshold is the default until enough requests have been timed,
+    // then the primary's p95 within the policy's bounds
+    const HedgePolicy policy = {300, 4000, 1500, 8, 0.95f};
+    HedgedFetch hedge(policy, nullptr, nullptr);
+    LatencyHistogram latency;
+    bool threshold_ok = hedge.hedgeDelayMs(latency) == 1500;
+    for (int i = 0; i < 19; i++) {
+        latency.record(400 + i * 10);
+    }
+    latency.record(9000);
+    uint32_t p95 = latency.percentile(0.95f);
+    threshold_ok = threshold_ok && p95 >= 580 && p95 < 700 && hedge.hedgeDelayMs(latency) == p95 &&
+                   latency.percentile(1.0f) >= 9000;
+    LatencyHistogram fast;
+    for (int i = 0; i < 8; i++) {
+        fast.record(20);
+    }
+    threshold_ok = threshold_ok && hedge.hedgeDelayMs(fast) == 300;
+    LOG_WEATHER_I("Hedge threshold from p95 (%u ms): %s", p95,
+                  threshold_ok ? "PASSED" : "FAILED");
+
+    // MET Norway's hourly-then-six-hourly series becomes the same hourly
+    // and daily layout Open-Meteo gives
+    std::unique_ptr<Weather> weather = make_test_weather();
+    weather->addFavourite("51.5074", "-0.1278", "London");
+    FixtureStream stream(MET_NORWAY_JSON, strlen(MET_NORWAY_JSON));
+    bool parsed = weather->parseMetNorwayStream(stream, 0, WEATHER_TIER_FORECAST);
+    const WeatherData& data = weather->getFavouriteData(0);
+    bool current_ok = parsed && data.current_temp == 200 && abs(data.feels_like - 184) <= 1 &&
+                      data.weather_code == 61 && data.is_day && data.utc_offset == 0;
+    bool hourly_ok = data.hourly_start == 1753012800 && data.hourly_count == 19 &&
+                     data.hourly_codes[2] == 2 && data.hourly_temps[4] == 190 &&
+                     data.hourly_codes[4] == 2 && data.hourly_precipitation[4] == 0 &&
+                     data.hourly_codes[7] == 81 && data.hourly_temps[7] == 150 &&
+                     data.hourly_precipitation[7] == 100 && data.hourly_codes[18] == 75 &&
+                     data.hourly_temps[18] == 120;
+    bool daily_ok = data.daily_times[0] == 1752969600 && data.daily_high[0] == 220 &&
+                    data.daily_low[0] == 110 && data.daily_codes[0] == 81 &&
+                    data.daily_high[1] == 120 && data.daily_low[1] == 100 &&
+                    data.daily_codes[1] == 75 && weather->hasAllFavouriteData();
+    LOG_WEATHER_I("MET Norway current %s, hourly %s, daily %s", current_ok ? "PASSED" : "FAILED",
+                  hourly_ok ? "PASSED" : "FAILED", daily_ok ? "PASSED" : "FAILED");
+
+    // Both providers ask for the same places
+    String open_meteo = weather->getPrimaryProvider().path(*weather, 0, WEATHER_TIER_FORECAST);
+    String met = weather->getSecondaryProvider().path(*weather, 0, WEATHER_TIER_FORECAST);
+    bool paths_ok = open_meteo.indexOf("latitude=51.5074&longitude=-0.1278") > 0 &&
+                    met.endsWith("compact?lat=51.5074&lon=-0.1278");
+
+    bool passed = threshold_ok && current_ok && hourly_ok && daily_ok && paths_ok;
+    LOG_WEATHER_I("Forecast providers %s", passed ? "PASSED" : "FAILED");
+}
+
+static HttpTiming make_test_timing(const char* host, uint32_t firstByte, uint32_t body) {
+    HttpTiming timing = {};
+    timing.host = host;
+    timing.first_byte_ms = firstByte;
+    timing.body_ms = body;
+    timing.bytes = 4000;
+    timing.status = 200;
+    timing.result = HTTP_TIMING_OK;
+    timing.reused = true;
+    return timing;
+}
+
+void test_http_timing() {
+    LOG_WEATHER_I("=== Testing HTTP Phase Timing ===");
+
+    // One new connection, nine reused ones and a request that never got an
+    // answer; only requests that reached a phase count towards it
+    std::unique_ptr<HttpTimingRing> ring(new HttpTimingRing());
+    HttpTiming first = make_test_timing("a.example", 300, 100);
+    first.reused = false;
+    first.dns_ms = 20;
+    first.handshake_ms = 800;
+    ring->record(first);
+    for (int i = 0; i < 9; i++) {
+        ring->record(make_test_timing("a.example", 100 + i * 10, 50));
+    }
+    HttpTiming lost = make_test_timing("a.example", 0, 0);
+    lost.status = 0;
+    lost.result = HTTP_TIMING_NO_RESPONSE;
+    ring->record(lost);
+    ring->record(make_test_timing("b.example", 40, 10));
+
+    HttpTimingSummary summary;
+    bool phases_ok = ring->summarise("a.example", summary) && summary.requests == 11 &&
+                     summary.failures == 1 && summary.dns.count == 1 &&
+                     summary.handshake.p95_ms == 800 && summary.first_byte.count == 10 &&
+                     summary.first_byte.min_ms == 100 && summary.first_byte.avg_ms == 156 &&
+                     summary.first_byte.p95_ms == 300 && summary.body.count == 10 &&
+                     summary.body.avg_ms == 55 && summary.avg_bytes == 4000;
+    bool hosts_ok = ring->summarise("b.example", summary) && summary.requests == 1 &&
+                    summary.dns.count == 0 && !ring->summarise("c.example", summary);
+
+    // Once full, the oldest entries make way
+    for (uint32_t i = 0; i < HTTP_TIMING_RING_SIZE + 8; i++) {
+        HttpTiming timing = make_test_timing("c.example", 50, 5);
+        timing.started_ms = i;
+        ring->record(timing);
+    }
+    HttpTiming entries[HTTP_TIMING_RING_SIZE];
+    size_t count = ring->copy(entries, HTTP_TIMING_RING_SIZE);
+    bool ring_ok = count == HTTP_TIMING_RING_SIZE && entries[0].started_ms == 8 &&
+                   entries[count - 1].started_ms == HTTP_TIMING_RING_SIZE + 7 &&
+                   !ring->summarise("a.example", summary);
+
+    bool passed = phases_ok && hosts_ok && ring_ok;
+    LOG_WEATHER_I("Phase stats %s, per host %s, ring %s", phases_ok ? "PASSED" : "FAILED",
+                  hosts_ok ? "PASSED" : "FAILED", ring_ok ? "PASSED" : "FAILED");
+    LOG_WEATHER_I("HTTP phase timing %s", passed ? "PASSED" : "FAILED");
+}
+
+void test_weather_refresh_scheduler() {
+    LOG_WEATHER_I("=== Testing Refresh Scheduler ===");
+
+    RefreshScheduler scheduler;
+    WeatherTier tier = WEATHER_TIER_CURRENT;
+    bool passed = scheduler.nextDue(0, tier) && tier == WEATHER_TIER_FORECAST;
+
+    // A forecast at 10:10 is next due at 11:15; current conditions one interval on
+    const time_t ten_past_ten = 1752969600 + 10 * 3600 + 600;
+    scheduler.markSuccess(WEATHER_TIER_FORECAST, 1000, ten_past_ten, 4096);
+    uint32_t forecast_wait = 3900 * 1000;
+    passed = passed && !scheduler.nextDue(1000, tier) &&
+             scheduler.msUntilNextDue(1000) == WEATHER_CURRENT_INTERVAL &&
+             scheduler.nextDue(1000 + WEATHER_CURRENT_INTERVAL, tier) &&
+             tier == WEATHER_TIER_CURRENT &&
+             scheduler.nextDue(1000 + forecast_wait, tier) && tier == WEATHER_TIER_FORECAST;
+    LOG_WEATHER_I("Aligned schedule: %s", passed ? "PASSED" : "FAILED");
+
+    // Backoff doubles within its jitter window and stops at the cap
+    bool backoff_ok = true;
+    uint32_t expected = WEATHER_RETRY_MIN;
+    for (int attempt = 0; attempt < 12; attempt++) {
+        scheduler.markFailure(WEATHER_TIER_FORECAST, 0, 0);
+        uint32_t wait = scheduler.msUntilNextDue(0);
+        backoff_ok = backoff_ok && wait >= expected / 2 && wait <= expected;
+        expected = min(expected * 2, (uint32_t) WEATHER_RETRY_MAX);
+    }
+    LOG_WEATHER_I("Backoff with jitter: %s", backoff_ok ? "PASSED" : "FAILED");
+
+    const WeatherTierStats& stats = scheduler.stats(WEATHER_TIER_FORECAST);
+    bool stats_ok = stats.successes == 1 && stats.failures == 12 && stats.last_bytes == 4096 &&
+                    stats.last_success_time == ten_past_ten;
+    passed = passed && backoff_ok && stats_ok;
+
+    // A location change makes everything due at once
+    scheduler.requestAll(5000);
+    passed = passed && scheduler.nextDue(5000, tier) && tier == WEATHER_TIER_FORECAST;
+
+    LOG_WEATHER_I("Refresh scheduler %s", passed ? "PASSED" : "FAILED");
+}
+
+void benchmark_weather_parse() {
+    LOG_WEATHER_I("=== Benchmarking Weather Parse Paths ===");
+
+    std::unique_ptr<Weather> weather = make_test_weather();
+    WeatherData data = {};
+    String fixture;
+    build_forecast_fixture(fixture);
+    LOG_WEATHER_I("Fixture response: %u bytes", fixture.length());
+
+    // Before: whole body copied into a String, then into an unfiltered heap document
+    {
+        CountingAllocator counter;
+        unsigned long start = micros();
+        String body = fixture;
+        JsonDocument doc(&counter);
+        DeserializationError error = deserializeJson(doc, body);
+        bool parsed = !error && weather->parseWeatherDocument(doc, data);
+        unsigned long elapsed = micros() - start;
+        LOG_WEATHER_I("String + heap document: %s, %lu us, peak %u bytes "
+                      "(%u body copy + %u document, %u allocations)",
+                      parsed ? "OK" : "FAILED", elapsed, body.length() + counter.peak,
+                      body.length(), counter.peak, counter.allocations);
+    }
+
+    // After: filtered parse straight off the stream into the static arena
+    {
+        FixtureStream stream(fixture.c_str(), fixture.length());
+        unsigned long start = micros();
+        bool parsed = weather->parseWeatherStream(stream, data);
+        unsigned long elapsed = micros() - start;
+        const JsonArena& arena = weather->getJsonArena();
+        LOG_WEATHER_I("Filtered stream + arena: %s, %lu us, peak %u bytes of %u arena "
+                      "(%u allocations, 0 heap)",
+                      parsed ? "OK" : "FAILED", elapsed, arena.peak(), arena.capacity(),
+                      arena.allocationCount());
+    }
+
+    // FlatBuffers: body read into the arena and decoded in place, no DOM
+    {
+        std::vector<uint8_t> flatbuffer;
+        build_forecast_flatbuffer_fixture(flatbuffer);
+        LOG_WEATHER_I("Fixture bytes on the wire: JSON %u, FlatBuffers %u",
+                      fixture.length(), flatbuffer.size());
+
+        FixtureStream stream((const char*) flatbuffer.data(), flatbuffer.size());
+        unsigned long start = micros();
+        bool parsed = weather->parseWeatherFlatBufferStream(stream, data);
+        unsigned long elapsed = micros() - start;
+        const JsonArena& arena = weather->getJsonArena();
+        LOG_WEATHER_I("FlatBuffers in place: %s, %lu us, peak %u bytes of %u arena "
+                      "(%u allocations, 0 heap)",
+                      parsed ? "OK" : "FAILED", elapsed, arena.peak(), arena.capacity(),
+                      arena.allocationCount());
+    }
+
+    LOG_WEATHER_I("Parsed: %.1f°C (feels %.1f°C), code %d, day high %.1f, hour 0 at %u "
+                  "(weekday %u, %02u:00 local)",
+                  weatherTempToFloat(data.current_temp), weatherTempToFloat(data.feels_like),
+                  data.weather_code, weatherTempToFloat(data.daily_high[0]),
+                  data.hourly_start, weatherWeekday(data.hourly_start, data.utc_offset),
+                  weatherHour(data.hourly_start, data.utc_offset));
+    LOG_WEATHER_I("WeatherData: %u bytes, no heap allocations", sizeof(WeatherData));
+    LOG_MEMORY_INFO(TAG_WEATHER);
+}
+
+// Complete test suite
+void run_weather_tests() {
+    LOG_WEATHER_I("============================================");
+    LOG_WEATHER_I("       AURA WEATHER MODULE TEST SUITE      ");
+    LOG_WEATHER_I("============================================");
+
+    test_weather_flatbuffers_match_json();
+    test_weather_compressed_responses();
+    test_weather_local_times();
+    test_weather_snapshot();
+    test_weather_favourites();
+    test_city_index();
+    test_location_search();
+    test_weather_refresh_scheduler();
+    test_lan_share();
+    test_weather_providers();
+    test_http_timing();
+    benchmark_weather_parse();
+
+    LOG_WEATHER_I("============================================");
+    LOG_WEATHER_I("       WEATHER TEST SUITE COMPLETED        ");
+    LOG_WEATHER_I("============================================");
+}
@@ -0,0 +1,248 @@
+// Generated by tools/make_weather_fixtures.py - do not edit
+#ifndef TEST_WEATHER_FIXTURES_H
+#define TEST_WEATHER_FIXTURES_H
+
+#include <stdint.h>
+
+// Forecast body: 4558 bytes plain, 1159 gzip, 1147 deflate
+static const uint8_t FORECAST_JSON_GZIP[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0xd7, 0xcd, 0x6e, 0x1b, 0x37,
+    0x10, 0x07, 0xf0, 0x57, 0x29, 0x04, 0xf4, 0xd4, 0xa9, 0xca, 0x19, 0xce, 0xf0, 0x23, 0xd7, 0xa2,
+    0xe8, 0xa5, 0xbd, 0xf5, 0x66, 0x18, 0x82, 0x6c, 0x6f, 0x12, 0x01, 0xfa, 0x82, 0x2c, 0x39, 0x49,
+    0x03, 0xbf, 0x53, 0x9f, 0xa1, 0x4f, 0xd6, 0x21, 0xa3, 0xfd, 0xaf, 0xe0, 0xc4, 0x29, 0x7a, 0xe9,
+    0x21, 0xb0, 0x6d, 0x2c, 0xc6, 0x1a, 0x0d, 0xc9, 0xfd, 0x91, 0xa2, 0x96, 0x1f, 0x67, 0xeb, 0xe5,
+    0x71, 0x75, 0x3c, 0xdd, 0x0d, 0xb3, 0x57, 0xc6, 0x73, 0xa3, 0xd9, 0x7a, 0xb7, 0x7d, 0x73, 0x7e,
+    0xe1, 0xc7, 0x30, 0x67, 0x09, 0xfe, 0xc3, 0x42, 0xb3, 0x37, 0xc3, 0x76, 0x38, 0xf8, 0x7b, 0x77,
+    0xdb, 0xe3, 0x6a, 0x33, 0x2c, 0x36, 0xf7, 0xb3, 0x57, 0x61, 0x1e, 0x52, 0xf1, 0x3f, 0xaf, 0x3a,
+    0x1d, 0x6f, 0x17, 0xbb, 0xd7, 0xaf, 0xef, 0x87, 0xe3, 0xe2, 0x7e, 0xb8, 0xdd, 0x6d, 0xef, 0x3c,
+    0x1d, 0x53, 0x08, 0x34, 0x6b, 0xef, 0xfe, 0x73, 0xb7, 0xf5, 0xe6, 0x66, 0xbf, 0x9c, 0x0e, 0xbb,
+    0xfd, 0xf0, 0xd3, 0x6f, 0x9e, 0xde, 0x6d, 0x67, 0x53, 0x6a, 0xb1, 0xbc, 0xb9, 0x39, 0x0c, 0x0f,
+    0xab, 0xde, 0xba, 0xbf, 0xef, 0xd7, 0xdf, 0xff, 0xf8, 0x81, 0x3d, 0x3f, 0xac, 0x87, 0x87, 0xf3,
+    0x6b, 0x12, 0xe7, 0xde, 0xd6, 0xed, 0xe9, 0x70, 0x18, 0xb6, 0xc7, 0xc5, 0x69, 0xbb, 0x3a, 0x7a,
+    0x07, 0x1f, 0x7b, 0x0b, 0x5e, 0xe0, 0xff, 0xbf, 0xef, 0x21, 0xcd, 0x56, 0xdb, 0xe3, 0x70, 0x78,
+    0x58, 0xae, 0xfd, 0xd5, 0x71, 0x20, 0xde, 0xd1, 0xb0, 0xd9, 0xb7, 0xc1, 0x9f, 0x0e, 0xc3, 0x42,
+    0x36, 0x9e, 0xfa, 0xfb, 0xaf, 0x9f, 0xfd, 0xe5, 0xe5, 0x7e, 0xbf, 0xec, 0xed, 0x5d, 0xe4, 0x91,
+    0x5c, 0xdd, 0x2f, 0xee, 0x96, 0x1f, 0xfc, 0x5f, 0x8f, 0xdf, 0x0d, 0xcb, 0xe3, 0xdb, 0xe1, 0xb0,
+    0xb8, 0xdd, 0x35, 0x96, 0xd9, 0xbb, 0xcd, 0xee, 0xbb, 0x1e, 0x3e, 0x62, 0x48, 0xd3, 0x60, 0x38,
+    0x5b, 0x0c, 0x9c, 0xb4, 0xdd, 0xfb, 0x34, 0x98, 0xda, 0x29, 0x9e, 0x0c, 0x43, 0x78, 0xae, 0xcf,
+    0x8d, 0x42, 0xc2, 0xbc, 0x4e, 0x83, 0xe0, 0xa7, 0x63, 0x88, 0xde, 0xf5, 0xdb, 0xdd, 0xe9, 0xb0,
+    0xfe, 0xf0, 0x35, 0x8c, 0x67, 0xee, 0xfb, 0xb9, 0xdb, 0xa1, 0xd9, 0xfe, 0x30, 0xdc, 0xae, 0xf6,
+    0xab, 0x63, 0x57, 0x5f, 0xec, 0x0f, 0xbb, 0x9b, 0xe5, 0xcd, 0x6a, 0xbd, 0x3a, 0x36, 0x87, 0xef,
+    0x67, 0xe8, 0x73, 0xea, 0xed, 0xca, 0x6f, 0x57, 0x6a, 0xf2, 0x99, 0x0e, 0xf4, 0x29, 0xac, 0x69,
+    0x0c, 0x73, 0x14, 0x84, 0xbe, 0x4e, 0xce, 0x61, 0x09, 0x8a, 0x50, 0x51, 0x56, 0x32, 0xca, 0x2a,
+    0xa3, 0xac, 0x2a, 0xca, 0xfa, 0x9b, 0xa9, 0xe3, 0x06, 0x09, 0x08, 0x2d, 0x21, 0xac, 0x32, 0x86,
+    0x2c, 0x05, 0x61, 0x42, 0x59, 0x5f, 0xc9, 0xe7, 0x30, 0xa2, 0x4c, 0x32, 0xca, 0x62, 0x40, 0x59,
+    0x54, 0x94, 0xc5, 0x82, 0x32, 0x65, 0x94, 0xa9, 0xa1, 0x4c, 0x0b, 0xca, 0x4c, 0x50, 0x66, 0x09,
+    0x65, 0x56, 0x51, 0x96, 0x22, 0xca, 0x52, 0x42, 0x59, 0x0e, 0x28, 0xcb, 0x8a, 0xb2, 0x9c, 0x51,
+    0x56, 0x18, 0x65, 0x45, 0x51, 0x56, 0x26, 0x92, 0x3a, 0x91, 0xd4, 0x89, 0xa4, 0x82, 0x84, 0x03,
+    0x48, 0x38, 0x80, 0x84, 0x19, 0x24, 0xcc, 0x20, 0x61, 0x06, 0x89, 0x77, 0x8b, 0x32, 0x01, 0x49,
+    0xe7, 0x3d, 0x87, 0x11, 0x24, 0x1c, 0x41, 0xc2, 0x11, 0x24, 0xac, 0x20, 0x61, 0x05, 0x09, 0x2b,
+    0x48, 0xd8, 0x40, 0xc2, 0x06, 0x12, 0x6f, 0x15, 0x65, 0x09, 0x24, 0x9c, 0x40, 0xc2, 0x19, 0x24,
+    0x9c, 0x41, 0xc2, 0x19, 0x24, 0x5c, 0x40, 0xc2, 0x05, 0x24, 0x5c, 0x26, 0x92, 0x3a, 0x91, 0x54,
+    0x90, 0xf4, 0x45, 0x32, 0x86, 0x20, 0x91, 0x00, 0x12, 0x61, 0x90, 0x08, 0x83, 0x44, 0x18, 0x24,
+    0x22, 0x20, 0x11, 0x01, 0x89, 0x08, 0x48, 0x24, 0x82, 0xa4, 0xaf, 0xc3, 0x31, 0x04, 0x89, 0x28,
+    0x48, 0x44, 0x41, 0x22, 0x06, 0x12, 0x31, 0x90, 0x88, 0x81, 0x44, 0x12, 0x48, 0x24, 0x81, 0x44,
+    0x12, 0x48, 0xfa, 0x52, 0x1f, 0x43, 0x90, 0x48, 0x06, 0x89, 0x14, 0x90, 0x48, 0x99, 0x48, 0xea,
+    0x44, 0x52, 0x27, 0x92, 0x0a, 0x12, 0xff, 0xec, 0x15, 0x84, 0x20, 0xe9, 0x9f, 0xa6, 0x73, 0xc8,
+    0x20, 0xf1, 0x49, 0x46, 0x19, 0x83, 0xc4, 0x79, 0x50, 0x26, 0x20, 0xf1, 0x3e, 0x50, 0x16, 0x41,
+    0x12, 0x23, 0x48, 0xa2, 0x82, 0xa4, 0x7f, 0x60, 0xc7, 0x10, 0x24, 0xd1, 0x40, 0x12, 0x0d, 0x24,
+    0xd1, 0x40, 0x12, 0x13, 0x48, 0x62, 0x02, 0x49, 0x4c, 0x20, 0x89, 0x19, 0x24, 0x31, 0x83, 0xa4,
+    0xef, 0x09, 0x63, 0x08, 0x92, 0x58, 0x26, 0x92, 0x3a, 0x91, 0xd4, 0x89, 0xa4, 0x82, 0x44, 0x03,
+    0x48, 0x34, 0x80, 0x44, 0x03, 0x48, 0x94, 0x41, 0xd2, 0xb7, 0x9d, 0x31, 0x04, 0x89, 0x0a, 0x48,
+    0x54, 0x40, 0xa2, 0x11, 0x24, 0x1a, 0x41, 0xa2, 0x11, 0x24, 0xaa, 0x20, 0x51, 0x05, 0x89, 0x47,
+    0x28, 0x33, 0x90, 0xa8, 0x81, 0x44, 0x0d, 0x24, 0x9a, 0x40, 0xa2, 0x09, 0x24, 0x9a, 0x41, 0xa2,
+    0x19, 0x24, 0x9a, 0x41, 0xe2, 0x7d, 0xa1, 0xac, 0x80, 0xa4, 0x6f, 0x9e, 0xe7, 0xb0, 0x4e, 0x24,
+    0x75, 0x22, 0xa9, 0x20, 0xb1, 0x00, 0x12, 0x0b, 0x20, 0xb1, 0x00, 0x12, 0x63, 0x90, 0x18, 0x83,
+    0xc4, 0x9b, 0x42, 0x99, 0x80, 0xc4, 0x04, 0x24, 0x7d, 0x9f, 0x1b, 0x43, 0x90, 0x58, 0x04, 0x89,
+    0x29, 0x48, 0x4c, 0x41, 0x62, 0x0a, 0x12, 0x33, 0x90, 0x38, 0x19, 0xca, 0x12, 0x48, 0x2c, 0x81,
+    0xc4, 0x52, 0x23, 0xb9, 0xfe, 0xfc, 0xcb, 0xf9, 0x8a, 0xd5, 0x9f, 0x71, 0xfc, 0xa2, 0xed, 0x52,
+    0x88, 0x6d, 0x2e, 0xed, 0x92, 0x88, 0x53, 0x4b, 0xa4, 0x96, 0x48, 0x2d, 0x91, 0x5b, 0x22, 0xb7,
+    0x44, 0x69, 0x89, 0xd2, 0x12, 0xa5, 0x25, 0x6a, 0x4b, 0x54, 0x4f, 0xf8, 0xd3, 0x43, 0x68, 0x17,
+    0x6d, 0x97, 0x42, 0xfe, 0xa0, 0x21, 0xed, 0xe2, 0x09, 0x69, 0x09, 0x69, 0x09, 0x69, 0x89, 0xd8,
+    0x2a, 0x5e, 0xfa, 0x7d, 0xe9, 0xf7, 0xdb, 0xe9, 0xf7, 0xfa, 0xe9, 0x03, 0xee, 0x55, 0x62, 0x8a,
+    0xfd, 0xf7, 0x25, 0xf8, 0x7f, 0x83, 0xeb, 0xaf, 0x9e, 0x28, 0xae, 0x7c, 0xae, 0x23, 0x49, 0xa2,
+    0x58, 0xc9, 0x84, 0x92, 0x51, 0x2e, 0x54, 0x99, 0x7c, 0xf6, 0x33, 0xc5, 0x40, 0x1a, 0xc9, 0x12,
+    0xa5, 0x4a, 0x45, 0xa8, 0x1a, 0xb5, 0x69, 0xa7, 0xa8, 0xa4, 0x99, 0x52, 0xa0, 0x1c, 0xa9, 0x24,
+    0xaa, 0x95, 0xfc, 0x6c, 0x2a, 0x46, 0xb1, 0x90, 0x31, 0x25, 0xa5, 0x9c, 0xa9, 0x06, 0xef, 0x9b,
+    0x7d, 0x6d, 0x54, 0x52, 0x21, 0x33, 0x4a, 0x85, 0x0a, 0x53, 0xf5, 0xa4, 0x2f, 0x1f, 0x8a, 0x91,
+    0x34, 0x91, 0x55, 0xca, 0x42, 0x7e, 0x74, 0xad, 0xbe, 0xce, 0x98, 0x44, 0x29, 0x66, 0xb2, 0x40,
+    0x29, 0x52, 0x4e, 0x54, 0x2a, 0xb5, 0xb5, 0x4a, 0x52, 0x48, 0x99, 0x4c, 0x29, 0x65, 0x2a, 0x81,
+    0xaa, 0xdf, 0x9a, 0x2f, 0x48, 0x8a, 0x42, 0x6a, 0x64, 0x85, 0x32, 0x53, 0x51, 0xaa, 0x99, 0xd8,
+    0x57, 0xa1, 0xdf, 0x70, 0x22, 0xad, 0x94, 0x84, 0xb2, 0x0f, 0xd7, 0xdb, 0xf5, 0x85, 0x4f, 0x92,
+    0x49, 0x03, 0x99, 0x57, 0x26, 0xca, 0x95, 0xaa, 0x8f, 0xc8, 0x57, 0x37, 0x45, 0xbf, 0x4f, 0x25,
+    0xcb, 0x94, 0x03, 0x95, 0x48, 0xd5, 0xef, 0xc5, 0x97, 0x30, 0x45, 0x23, 0x2d, 0xcd, 0x2f, 0x2b,
+    0x95, 0x4c, 0xdf, 0x82, 0xd0, 0xb5, 0x1f, 0x1b, 0xef, 0x96, 0xab, 0xff, 0x72, 0x52, 0x5d, 0x6c,
+    0x96, 0xef, 0x71, 0x5a, 0x7d, 0x9a, 0x5a, 0x6d, 0xff, 0xf5, 0x20, 0x3b, 0xf6, 0xf8, 0xec, 0x39,
+    0xf5, 0xf2, 0xa8, 0x76, 0x71, 0x5a, 0xb9, 0x78, 0x60, 0xbf, 0x7c, 0x66, 0xbd, 0x78, 0x6c, 0xeb,
+    0x4f, 0x2e, 0xd7, 0x5f, 0x1e, 0xef, 0x95, 0xef, 0x3e, 0xcd, 0x69, 0xdc, 0x96, 0x7c, 0xe7, 0xea,
+    0x5b, 0x95, 0xcf, 0xa0, 0xcd, 0x1d, 0x36, 0xf5, 0xbd, 0xe9, 0x4b, 0xb7, 0xd3, 0xbe, 0xfa, 0xfb,
+    0xde, 0xd8, 0xe6, 0x7b, 0xde, 0x66, 0xcc, 0x1b, 0x62, 0xf9, 0xb4, 0x69, 0x5a, 0xdf, 0x2a, 0x3f,
+    0xdf, 0xd5, 0xfa, 0xc7, 0xac, 0xf4, 0xf9, 0xf0, 0x5a, 0x0a, 0xd7, 0x8f, 0x8f, 0xff, 0x00, 0x76,
+    0xd8, 0x2e, 0xf2, 0xce, 0x11, 0x00, 0x00,
+};
+
+static const uint8_t FORECAST_JSON_DEFLATE[] = {
+    0x78, 0xda, 0xed, 0xd7, 0xcd, 0x6e, 0x1b, 0x37, 0x10, 0x07, 0xf0, 0x57, 0x29, 0x04, 0xf4, 0xd4,
+    0xa9, 0xca, 0x19, 0xce, 0xf0, 0x23, 0xd7, 0xa2, 0xe8, 0xa5, 0xbd, 0xf5, 0x66, 0x18, 0x82, 0x6c,
+    0x6f, 0x12, 0x01, 0xfa, 0x82, 0x2c, 0x39, 0x49, 0x03, 0xbf, 0x53, 0x9f, 0xa1, 0x4f, 0xd6, 0x21,
+    0xa3, 0xfd, 0xaf, 0xe0, 0xc4, 0x29, 0x7a, 0xe9, 0x21, 0xb0, 0x6d, 0x2c, 0xc6, 0x1a, 0x0d, 0xc9,
+    0xfd, 0x91, 0xa2, 0x96, 0x1f, 0x67, 0xeb, 0xe5, 0x71, 0x75, 0x3c, 0xdd, 0x0d, 0xb3, 0x57, 0xc6,
+    0x73, 0xa3, 0xd9, 0x7a, 0xb7, 0x7d, 0x73, 0x7e, 0xe1, 0xc7, 0x30, 0x67, 0x09, 0xfe, 0xc3, 0x42,
+    0xb3, 0x37, 0xc3, 0x76, 0x38, 0xf8, 0x7b, 0x77, 0xdb, 0xe3, 0x6a, 0x33, 0x2c, 0x36, 0xf7, 0xb3,
+    0x57, 0x61, 0x1e, 0x52, 0xf1, 0x3f, 0xaf, 0x3a, 0x1d, 0x6f, 0x17, 0xbb, 0xd7, 0xaf, 0xef, 0x87,
+    0xe3, 0xe2, 0x7e, 0xb8, 0xdd, 0x6d, 0xef, 0x3c, 0x1d, 0x53, 0x08, 0x34, 0x6b, 0xef, 0xfe, 0x73,
+    0xb7, 0xf5, 0xe6, 0x66, 0xbf, 0x9c, 0x0e, 0xbb, 0xfd, 0xf0, 0xd3, 0x6f, 0x9e, 0xde, 0x6d, 0x67,
+    0x53, 0x6a, 0xb1, 0xbc, 0xb9, 0x39, 0x0c, 0x0f, 0xab, 0xde, 0xba, 0xbf, 0xef, 0xd7, 0xdf, 0xff,
+    0xf8, 0x81, 0x3d, 0x3f, 0xac, 0x87, 0x87, 0xf3, 0x6b, 0x12, 0xe7, 0xde, 0xd6, 0xed, 0xe9, 0x70,
+    0x18, 0xb6, 0xc7, 0xc5, 0x69, 0xbb, 0x3a, 0x7a, 0x07, 0x1f, 0x7b, 0x0b, 0x5e, 0xe0, 0xff, 0xbf,
+    0xef, 0x21, 0xcd, 0x56, 0xdb, 0xe3, 0x70, 0x78, 0x58, 0xae, 0xfd, 0xd5, 0x71, 0x20, 0xde, 0xd1,
+    0xb0, 0xd9, 0xb7, 0xc1, 0x9f, 0x0e, 0xc3, 0x42, 0x36, 0x9e, 0xfa, 0xfb, 0xaf, 0x9f, 0xfd, 0xe5,
+    0xe5, 0x7e, 0xbf, 0xec, 0xed, 0x5d, 0xe4, 0x91, 0x5c, 0xdd, 0x2f, 0xee, 0x96, 0x1f, 0xfc, 0x5f,
+    0x8f, 0xdf, 0x0d, 0xcb, 0xe3, 0xdb, 0xe1, 0xb0, 0xb8, 0xdd, 0x35, 0x96, 0xd9, 0xbb, 0xcd, 0xee,
+    0xbb, 0x1e, 0x3e, 0x62, 0x48, 0xd3, 0x60, 0x38, 0x5b, 0x0c, 0x9c, 0xb4, 0xdd, 0xfb, 0x34, 0x98,
+    0xda, 0x29, 0x9e, 0x0c, 0x43, 0x78, 0xae, 0xcf, 0x8d, 0x42, 0xc2, 0xbc, 0x4e, 0x83, 0xe0, 0xa7,
+    0x63, 0x88, 0xde, 0xf5, 0xdb, 0xdd, 0xe9, 0xb0, 0xfe, 0xf0, 0x35, 0x8c, 0x67, 0xee, 0xfb, 0xb9,
+    0xdb, 0xa1, 0xd9, 0xfe, 0x30, 0xdc, 0xae, 0xf6, 0xab, 0x63, 0x57, 0x5f, 0xec, 0x0f, 0xbb, 0x9b,
+    0xe5, 0xcd, 0x6a, 0xbd, 0x3a, 0x36, 0x87, 0xef, 0x67, 0xe8, 0x73, 0xea, 0xed, 0xca, 0x6f, 0x57,
+    0x6a, 0xf2, 0x99, 0x0e, 0xf4, 0x29, 0xac, 0x69, 0x0c, 0x73, 0x14, 0x84, 0xbe, 0x4e, 0xce, 0x61,
+    0x09, 0x8a, 0x50, 0x51, 0x56, 0x32, 0xca, 0x2a, 0xa3, 0xac, 0x2a, 0xca, 0xfa, 0x9b, 0xa9, 0xe3,
+    0x06, 0x09, 0x08, 0x2d, 0x21, 0xac, 0x32, 0x86, 0x2c, 0x05, 0x61, 0x42, 0x59, 0x5f, 0xc9, 0xe7,
+    0x30, 0xa2, 0x4c, 0x32, 0xca, 0x62, 0x40, 0x59, 0x54, 0x94, 0xc5, 0x82, 0x32, 0x65, 0x94, 0xa9,
+    0xa1, 0x4c, 0x0b, 0xca, 0x4c, 0x50, 0x66, 0x09, 0x65, 0x56, 0x51, 0x96, 0x22, 0xca, 0x52, 0x42,
+    0x59, 0x0e, 0x28, 0xcb, 0x8a, 0xb2, 0x9c, 0x51, 0x56, 0x18, 0x65, 0x45, 0x51, 0x56, 0x26, 0x92,
+    0x3a, 0x91, 0xd4, 0x89, 0xa4, 0x82, 0x84, 0x03, 0x48, 0x38, 0x80, 0x84, 0x19, 0x24, 0xcc, 0x20,
+    0x61, 0x06, 0x89, 0x77, 0x8b, 0x32, 0x01, 0x49, 0xe7, 0x3d, 0x87, 0x11, 0x24, 0x1c, 0x41, 0xc2,
+    0x11, 0x24, 0xac, 0x20, 0x61, 0x05, 0x09, 0x2b, 0x48, 0xd8, 0x40, 0xc2, 0x06, 0x12, 0x6f, 0x15,
+    0x65, 0x09, 0x24, 0x9c, 0x40, 0xc2, 0x19, 0x24, 0x9c, 0x41, 0xc2, 0x19, 0x24, 0x5c, 0x40, 0xc2,
+    0x05, 0x24, 0x5c, 0x26, 0x92, 0x3a, 0x91, 0x54, 0x90, 0xf4, 0x45, 0x32, 0x86, 0x20, 0x91, 0x00,
+    0x12, 0x61, 0x90, 0x08, 0x83, 0x44, 0x18, 0x24, 0x22, 0x20, 0x11, 0x01, 0x89, 0x08, 0x48, 0x24,
+    0x82, 0xa4, 0xaf, 0xc3, 0x31, 0x04, 0x89, 0x28, 0x48, 0x44, 0x41, 0x22, 0x06, 0x12, 0x31, 0x90,
+    0x88, 0x81, 0x44, 0x12, 0x48, 0x24, 0x81, 0x44, 0x12, 0x48, 0xfa, 0x52, 0x1f, 0x43, 0x90, 0x48,
+    0x06, 0x89, 0x14, 0x90, 0x48, 0x99, 0x48, 0xea, 0x44, 0x52, 0x27, 0x92, 0x0a, 0x12, 0xff, 0xec,
+    0x15, 0x84, 0x20, 0xe9, 0x9f, 0xa6, 0x73, 0xc8, 0x20, 0xf1, 0x49, 0x46, 0x19, 0x83, 0xc4, 0x79,
+    0x50, 0x26, 0x20, 0xf1, 0x3e, 0x50, 0x16, 0x41, 0x12, 0x23, 0x48, 0xa2, 0x82, 0xa4, 0x7f, 0x60,
+    0xc7, 0x10, 0x24, 0xd1, 0x40, 0x12, 0x0d, 0x24, 0xd1, 0x40, 0x12, 0x13, 0x48, 0x62, 0x02, 0x49,
+    0x4c, 0x20, 0x89, 0x19, 0x24, 0x31, 0x83, 0xa4, 0xef, 0x09, 0x63, 0x08, 0x92, 0x58, 0x26, 0x92,
+    0x3a, 0x91, 0xd4, 0x89, 0xa4, 0x82, 0x44, 0x03, 0x48, 0x34, 0x80, 0x44, 0x03, 0x48, 0x94, 0x41,
+    0xd2, 0xb7, 0x9d, 0x31, 0x04, 0x89, 0x0a, 0x48, 0x54, 0x40, 0xa2, 0x11, 0x24, 0x1a, 0x41, 0xa2,
+    0x11, 0x24, 0xaa, 0x20, 0x51, 0x05, 0x89, 0x47, 0x28, 0x33, 0x90, 0xa8, 0x81, 0x44, 0x0d, 0x24,
+    0x9a, 0x40, 0xa2, 0x09, 0x24, 0x9a, 0x41, 0xa2, 0x19, 0x24, 0x9a, 0x41, 0xe2, 0x7d, 0xa1, 0xac,
+    0x80, 0xa4, 0x6f, 0x9e, 0xe7, 0xb0, 0x4e, 0x24, 0x75, 0x22, 0xa9, 0x20, 0xb1, 0x00, 0x12, 0x0b,
+    0x20, 0xb1, 0x00, 0x12, 0x63, 0x90, 0x18, 0x83, 0xc4, 0x9b, 0x42, 0x99, 0x80, 0xc4, 0x04, 0x24,
+    0x7d, 0x9f, 0x1b, 0x43, 0x90, 0x58, 0x04, 0x89, 0x29, 0x48, 0x4c, 0x41, 0x62, 0x0a, 0x12, 0x33,
+    0x90, 0x38, 0x19, 0xca, 0x12, 0x48, 0x2c, 0x81, 0xc4, 0x52, 0x23, 0xb9, 0xfe, 0xfc, 0xcb, 0xf9,
+    0x8a, 0xd5, 0x9f, 0x71, 0xfc, 0xa2, 0xed, 0x52, 0x88, 0x6d, 0x2e, 0xed, 0x92, 0x88, 0x53, 0x4b,
+    0xa4, 0x96, 0x48, 0x2d, 0x91, 0x5b, 0x22, 0xb7, 0x44, 0x69, 0x89, 0xd2, 0x12, 0xa5, 0x25, 0x6a,
+    0x4b, 0x54, 0x4f, 0xf8, 0xd3, 0x43, 0x68, 0x17, 0x6d, 0x97, 0x42, 0xfe, 0xa0, 0x21, 0xed, 0xe2,
+    0x09, 0x69, 0x09, 0x69, 0x09, 0x69, 0x89, 0xd8, 0x2a, 0x5e, 0xfa, 0x7d, 0xe9, 0xf7, 0xdb, 0xe9,
+    0xf7, 0xfa, 0xe9, 0x03, 0xee, 0x55, 0x62, 0x8a, 0xfd, 0xf7, 0x25, 0xf8, 0x7f, 0x83, 0xeb, 0xaf,
+    0x9e, 0x28, 0xae, 0x7c, 0xae, 0x23, 0x49, 0xa2, 0x58, 0xc9, 0x84, 0x92, 0x51, 0x2e, 0x54, 0x99,
+    0x7c, 0xf6, 0x33, 0xc5, 0x40, 0x1a, 0xc9, 0x12, 0xa5, 0x4a, 0x45, 0xa8, 0x1a, 0xb5, 0x69, 0xa7,
+    0xa8, 0xa4, 0x99, 0x52, 0xa0, 0x1c, 0xa9, 0x24, 0xaa, 0x95, 0xfc, 0x6c, 0x2a, 0x46, 0xb1, 0x90,
+    0x31, 0x25, 0xa5, 0x9c, 0xa9, 0x06, 0xef, 0x9b, 0x7d, 0x6d, 0x54, 0x52, 0x21, 0x33, 0x4a, 0x85,
+    0x0a, 0x53, 0xf5, 0xa4, 0x2f, 0x1f, 0x8a, 0x91, 0x34, 0x91, 0x55, 0xca, 0x42, 0x7e, 0x74, 0xad,
+    0xbe, 0xce, 0x98, 0x44, 0x29, 0x66, 0xb2, 0x40, 0x29, 0x52, 0x4e, 0x54, 0x2a, 0xb5, 0xb5, 0x4a,
+    0x52, 0x48, 0x99, 0x4c, 0x29, 0x65, 0x2a, 0x81, 0xaa, 0xdf, 0x9a, 0x2f, 0x48, 0x8a, 0x42, 0x6a,
+    0x64, 0x85, 0x32, 0x53, 0x51, 0xaa, 0x99, 0xd8, 0x57, 0xa1, 0xdf, 0x70, 0x22, 0xad, 0x94, 0x84,
+    0xb2, 0x0f, 0xd7, 0xdb, 0xf5, 0x85, 0x4f, 0x92, 0x49, 0x03, 0x99, 0x57, 0x26, 0xca, 0x95, 0xaa,
+    0x8f, 0xc8, 0x57, 0x37, 0x45, 0xbf, 0x4f, 0x25, 0xcb, 0x94, 0x03, 0x95, 0x48, 0xd5, 0xef, 0xc5,
+    0x97, 0x30, 0x45, 0x23, 0x2d, 0xcd, 0x2f, 0x2b, 0x95, 0x4c, 0xdf, 0x82, 0xd0, 0xb5, 0x1f, 0x1b,
+    0xef, 0x96, 0xab, 0xff, 0x72, 0x52, 0x5d, 0x6c, 0x96, 0xef, 0x71, 0x5a, 0x7d, 0x9a, 0x5a, 0x6d,
+    0xff, 0xf5, 0x20, 0x3b, 0xf6, 0xf8, 0xec, 0x39, 0xf5, 0xf2, 0xa8, 0x76, 0x71, 0x5a, 0xb9, 0x78,
+    0x60, 0xbf, 0x7c, 0x66, 0xbd, 0x78, 0x6c, 0xeb, 0x4f, 0x2e, 0xd7, 0x5f, 0x1e, 0xef, 0x95, 0xef,
+    0x3e, 0xcd, 0x69, 0xdc, 0x96, 0x7c, 0xe7, 0xea, 0x5b, 0x95, 0xcf, 0xa0, 0xcd, 0x1d, 0x36, 0xf5,
+    0xbd, 0xe9, 0x4b, 0xb7, 0xd3, 0xbe, 0xfa, 0xfb, 0xde, 0xd8, 0xe6, 0x7b, 0xde, 0x66, 0xcc, 0x1b,
+    0x62, 0xf9, 0xb4, 0x69, 0x5a, 0xdf, 0x2a, 0x3f, 0xdf, 0xd5, 0xfa, 0xc7, 0xac, 0xf4, 0xf9, 0xf0,
+    0x5a, 0x0a, 0xd7, 0x8f, 0x8f, 0xff, 0x00, 0x14, 0x2a, 0xf5, 0x64,
+};
+
+// Geocoding body: 1625 bytes plain, 579 gzip
+static const char GEOCODING_JSON[] =
+    "{\"results\":[{\"id\":2643743,\"name\":\"London\",\"latitude\":51.50853,\"longitude\":-0.12574,"
+    "\"elevation\":25.0,\"feature_code\":\"PPLC\",\"country_code\":\"GB\",\"admin1_id\":6269131,\"adm"
+    "in2_id\":2648110,\"timezone\":\"Europe/London\",\"population\":7556900,\"country_id\":2635167,\""
+    "country\":\"United Kingdom\",\"admin1\":\"England\",\"admin2\":\"Greater London\"},{\"id\":60585"
+    "60,\"name\":\"London\",\"latitude\":42.98339,\"longitude\":-81.23304,\"elevation\":252.0,\"featu"
+    "re_code\":\"PPL\",\"country_code\":\"CA\",\"admin1_id\":6093943,\"timezone\":\"America/Toronto\""
+    ",\"population\":346765,\"country_id\":6251999,\"country\":\"Canada\",\"admin1\":\"Ontario\"},{\""
+    "id\":4517009,\"name\":\"London\",\"latitude\":39.88645,\"longitude\":-83.44825,\"elevation\":321"
+    ".0,\"feature_code\":\"PPLA2\",\"country_code\":\"US\",\"admin1_id\":5165418,\"admin2_id\":451736"
+    "5,\"timezone\":\"America/New_York\",\"population\":10060,\"postcodes\":[\"43140\"],\"country_id"
+    "\":6252001,\"country\":\"United States\",\"admin1\":\"Ohio\",\"admin2\":\"Madison\"},{\"id\":429"
+    "8960,\"name\":\"London\",\"latitude\":37.12898,\"longitude\":-84.08326,\"elevation\":378.0,\"fea"
+    "ture_code\":\"PPLA2\",\"country_code\":\"US\",\"admin1_id\":6254925,\"admin2_id\":4297376,\"time"
+    "zone\":\"America/New_York\",\"population\":8126,\"postcodes\":[\"40741\",\"40742\",\"40743\",\"4"
+    "0744\",\"40745\"],\"country_id\":6252001,\"country\":\"United States\",\"admin1\":\"Kentucky\","
+    "\"admin2\":\"Laurel\"},{\"id\":4707414,\"name\":\"London\",\"latitude\":30.67685,\"longitude\":-"
+    "99.57645,\"elevation\":520.0,\"feature_code\":\"PPL\",\"country_code\":\"US\",\"admin1_id\":4736"
+    "286,\"admin2_id\":4707007,\"timezone\":\"America/Chicago\",\"population\":180,\"postcodes\":[\"7"
+    "6854\"],\"country_id\":6252001,\"country\":\"United States\",\"admin1\":\"Texas\",\"admin2\":\"K"
+    "imble\"}],\"generationtime_ms\":0.8749962}";
+
+static const uint8_t GEOCODING_JSON_GZIP[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0xd3, 0x5b, 0x6f, 0xd3, 0x30,
+    0x14, 0x00, 0xe0, 0xbf, 0x32, 0xf9, 0xb9, 0x78, 0xbe, 0x5f, 0xfa, 0x56, 0x2a, 0xc4, 0x43, 0x0b,
+    0x4c, 0xda, 0xf6, 0x80, 0x10, 0xaa, 0x4c, 0x63, 0xba, 0x68, 0x89, 0x5d, 0x39, 0x0e, 0x30, 0xa6,
+    0xfe, 0x77, 0xec, 0x2d, 0xeb, 0x92, 0xb4, 0xaa, 0x36, 0xf6, 0x12, 0x4b, 0x47, 0xce, 0x39, 0xc7,
+    0x9f, 0x8f, 0xef, 0x41, 0xb0, 0x4d, 0x5b, 0xc5, 0x06, 0x4c, 0xbf, 0xdd, 0x83, 0xb2, 0x00, 0x53,
+    0x22, 0x18, 0x95, 0x8c, 0x4e, 0x80, 0x33, 0xb5, 0x05, 0x53, 0xb0, 0xf4, 0xae, 0xf0, 0x0e, 0x4c,
+    0x40, 0x65, 0x62, 0x19, 0xdb, 0x22, 0xc5, 0x38, 0x86, 0x1c, 0x29, 0x9e, 0xf6, 0x54, 0xde, 0x6d,
+    0xba, 0xe0, 0x3b, 0x04, 0x31, 0xe1, 0x92, 0x4d, 0x80, 0xad, 0xec, 0xaf, 0xb4, 0x37, 0xfd, 0x34,
+    0x25, 0x1c, 0xa2, 0x09, 0xf8, 0x69, 0x4d, 0x6c, 0x83, 0x5d, 0xad, 0x7d, 0xde, 0x08, 0x2e, 0x2e,
+    0x96, 0xf3, 0x94, 0x6f, 0xed, 0x5b, 0x17, 0xc3, 0xdd, 0x53, 0xf4, 0xe3, 0xfb, 0x14, 0x33, 0x45,
+    0x5d, 0x3a, 0xbc, 0xca, 0x7d, 0x08, 0x22, 0x34, 0xa6, 0xb8, 0x8b, 0x91, 0x55, 0xd7, 0x9b, 0xc2,
+    0x38, 0x65, 0x8c, 0x65, 0x6d, 0xff, 0x7a, 0x97, 0xff, 0xfb, 0xd0, 0x06, 0xbf, 0xb5, 0xe7, 0xfb,
+    0x36, 0xb7, 0x7e, 0xdb, 0x56, 0x5d, 0x79, 0xc9, 0xb9, 0xd0, 0x08, 0x3d, 0xd7, 0x7a, 0x4c, 0x42,
+    0x39, 0x16, 0x72, 0x1f, 0x4c, 0x39, 0xae, 0x5d, 0x19, 0x6d, 0x71, 0xb6, 0x28, 0xdd, 0xa6, 0xf0,
+    0xf5, 0xbe, 0x8f, 0x9c, 0xdd, 0x6d, 0x2a, 0xe3, 0x8a, 0xa7, 0x10, 0xc9, 0x8d, 0x86, 0x74, 0x1c,
+    0x1b, 0xce, 0xba, 0x8a, 0xbb, 0xc9, 0xa3, 0x9b, 0x40, 0x5c, 0x71, 0x81, 0x4e, 0xb9, 0x31, 0x02,
+    0xb5, 0xa2, 0x54, 0x0f, 0xdd, 0x14, 0x86, 0x84, 0x52, 0x34, 0x86, 0x23, 0xc7, 0xe5, 0x0e, 0xe1,
+    0xe6, 0xb3, 0x11, 0x1c, 0xd2, 0x54, 0xe7, 0x0b, 0xec, 0x21, 0xcd, 0x6a, 0x1b, 0xca, 0xb5, 0x39,
+    0xbf, 0xf2, 0xc1, 0xbb, 0xe8, 0x47, 0x4c, 0x94, 0x09, 0x29, 0xf8, 0x50, 0x49, 0x10, 0x8e, 0xb5,
+    0xd6, 0x7d, 0xa5, 0xb9, 0x71, 0xa6, 0x30, 0x7d, 0x9d, 0x2f, 0x2e, 0x9a, 0x50, 0xfa, 0xbd, 0x01,
+    0xe3, 0x58, 0x22, 0xa4, 0x4f, 0x19, 0x50, 0x0d, 0x95, 0x12, 0x8c, 0x8f, 0x0c, 0x28, 0x64, 0x4c,
+    0x11, 0x3e, 0x30, 0xa0, 0x04, 0x1f, 0x37, 0x98, 0x91, 0x43, 0x85, 0xeb, 0xcb, 0xa1, 0x42, 0xba,
+    0x62, 0xce, 0xb0, 0x1a, 0x8c, 0x4f, 0x6e, 0x8f, 0xe6, 0x83, 0x1e, 0x91, 0xf9, 0x6c, 0x7f, 0xaf,
+    0xbe, 0xfa, 0x70, 0x3b, 0xa2, 0xc1, 0x08, 0xe5, 0x3b, 0xdd, 0xfa, 0x26, 0xe6, 0x42, 0xf9, 0x99,
+    0x00, 0x46, 0x31, 0x43, 0xe0, 0xfb, 0x81, 0x17, 0x41, 0x08, 0x1f, 0x99, 0xaa, 0xcb, 0x98, 0xc6,
+    0xa5, 0x19, 0xb0, 0xdd, 0x94, 0xbe, 0x3f, 0x51, 0x9f, 0x4c, 0x51, 0x36, 0xbd, 0x51, 0x62, 0x44,
+    0x2b, 0x7d, 0x7a, 0x94, 0xa8, 0x4c, 0xaf, 0x4d, 0x69, 0x35, 0x62, 0x64, 0x10, 0x29, 0x4a, 0xc4,
+    0x90, 0x51, 0xaa, 0xff, 0x67, 0x4c, 0xc7, 0x62, 0x3a, 0xdf, 0x4b, 0x9f, 0x91, 0x68, 0x49, 0xa5,
+    0x78, 0x0d, 0xa3, 0xc2, 0xb9, 0xa9, 0xa1, 0x22, 0x92, 0x0c, 0xa7, 0x6d, 0x79, 0x25, 0xdd, 0x4a,
+    0xbb, 0x95, 0x75, 0x2b, 0x7f, 0x8b, 0xf2, 0xc2, 0xba, 0xd8, 0xae, 0x6f, 0xef, 0xfa, 0xd2, 0x4b,
+    0x93, 0x08, 0xaa, 0x67, 0x68, 0x99, 0x9b, 0x60, 0x27, 0xa1, 0x11, 0x4c, 0x8f, 0x43, 0x8d, 0xe6,
+    0x55, 0x6b, 0xc8, 0xe5, 0xc3, 0x14, 0xf7, 0xa0, 0x53, 0x6b, 0x2f, 0x7d, 0xb3, 0x63, 0x66, 0x96,
+    0xe6, 0x92, 0x28, 0x31, 0x64, 0x4e, 0xcd, 0x21, 0x24, 0x8f, 0x32, 0xcf, 0x6f, 0xd2, 0x77, 0x33,
+    0x7e, 0xc7, 0x58, 0x8d, 0x47, 0x35, 0x77, 0xce, 0xde, 0x82, 0x78, 0x65, 0xff, 0x98, 0xa6, 0x2f,
+    0xb8, 0x28, 0xeb, 0x1f, 0x95, 0x05, 0xbb, 0x94, 0x73, 0x63, 0x9d, 0x0d, 0x0f, 0xa5, 0x73, 0x87,
+    0xab, 0x3a, 0x55, 0x44, 0x50, 0x49, 0xa6, 0xb5, 0x20, 0xbb, 0x7f, 0xf6, 0x25, 0x4a, 0xe6, 0x59,
+    0x06, 0x00, 0x00,
+};
+
+// MET Norway locationforecast compact body: 1888 bytes plain
+static const char MET_NORWAY_JSON[] =
+    "{\"type\":\"Feature\",\"geometry\":{\"type\":\"Point\",\"coordinates\":[-0.1278,51.5074,11]},\"p"
+    "roperties\":{\"meta\":{\"updated_at\":\"2025-07-20T11:31:17Z\",\"units\":{\"air_temperature\":\""
+    "celsius\",\"precipitation_amount\":\"mm\",\"relative_humidity\":\"%\",\"wind_speed\":\"m/s\"}},"
+    "\"timeseries\":[{\"time\":\"2025-07-20T12:00:00Z\",\"data\":{\"instant\":{\"details\":{\"air_pre"
+    "ssure_at_sea_level\":1016.2,\"air_temperature\":20.0,\"cloud_area_fraction\":71.1,\"relative_hum"
+    "idity\":50.0,\"wind_from_direction\":240.3,\"wind_speed\":2.0}},\"next_12_hours\":{\"summary\":{"
+    "\"symbol_code\":\"cloudy\"},\"details\":{}},\"next_1_hours\":{\"summary\":{\"symbol_code\":\"lig"
+    "htrain_day\"},\"details\":{\"precipitation_amount\":0.2}},\"next_6_hours\":{\"summary\":{\"symbo"
+    "l_code\":\"rain\"},\"details\":{\"precipitation_amount\":2.1}}}},{\"time\":\"2025-07-20T13:00:00"
+    "Z\",\"data\":{\"instant\":{\"details\":{\"air_temperature\":21.0,\"relative_humidity\":48.0,\"wi"
+    "nd_speed\":2.4}},\"next_1_hours\":{\"summary\":{\"symbol_code\":\"clearsky_day\"},\"details\":{"
+    "\"precipitation_amount\":0.0}}}},{\"time\":\"2025-07-20T14:00:00Z\",\"data\":{\"instant\":{\"det"
+    "ails\":{\"air_temperature\":22.0,\"relative_humidity\":45.0,\"wind_speed\":2.9}},\"next_1_hours"
+    "\":{\"summary\":{\"symbol_code\":\"partlycloudy_day\"},\"details\":{\"precipitation_amount\":0.0"
+    "}},\"next_6_hours\":{\"summary\":{\"symbol_code\":\"rainshowers_day\"},\"details\":{\"precipitat"
+    "ion_amount\":1.5}}}},{\"time\":\"2025-07-20T18:00:00Z\",\"data\":{\"instant\":{\"details\":{\"ai"
+    "r_temperature\":16.0,\"relative_humidity\":70.0,\"wind_speed\":1.1}},\"next_6_hours\":{\"summary"
+    "\":{\"symbol_code\":\"rainshowers_night\"},\"details\":{\"precipitation_amount\":1.5}}}},{\"time"
+    "\":\"2025-07-21T00:00:00Z\",\"data\":{\"instant\":{\"details\":{\"air_temperature\":10.0,\"relat"
+    "ive_humidity\":88.0,\"wind_speed\":0.6}},\"next_6_hours\":{\"summary\":{\"symbol_code\":\"heavys"
+    "now_night\"},\"details\":{\"precipitation_amount\":0.0}}}},{\"time\":\"2025-07-21T06:00:00Z\",\""
+    "data\":{\"instant\":{\"details\":{\"air_temperature\":12.0,\"relative_humidity\":80.0,\"wind_spe"
+    "ed\":1.0}}}}]}}";
+
+#endif // TEST_WEATHER_FIXTURES_H
@@ -1,13 +1,197 @@
 #include "weather.h"
 #include "../logging/logging.h"
 
-Weather::Weather() : dataValid(false), lastUpdateTime(0) {
-    // Initialize weather data
-    memset(&currentWeather, 0, sizeof(WeatherData));
+// Field indices and enum values from the Open-Meteo FlatBuffers schema
+// (openmeteo_sdk weather_api.fbs)
+static constexpr uint16_t OM_RESPONSE_UTC_OFFSET_SECONDS = 6;
+static constexpr uint16_t OM_RESPONSE_CURRENT = 9;
+static constexpr uint16_t OM_RESPONSE_DAILY = 10;
+static constexpr uint16_t OM_RESPONSE_HOURLY = 11;
+
+static constexpr uint16_t OM_BLOCK_TIME = 0;
+static constexpr uint16_t OM_BLOCK_INTERVAL = 2;
+static constexpr uint16_t OM_BLOCK_VARIABLES = 3;
+
+static constexpr uint16_t OM_VARIABLE_VARIABLE = 0;
+static constexpr uint16_t OM_VARIABLE_VALUE = 2;
+static constexpr uint16_t OM_VARIABLE_VALUES = 3;
+static constexpr uint16_t OM_VARIABLE_AGGREGATION = 6;
+
+static constexpr uint8_t OM_APPARENT_TEMPERATURE = 1;
+static constexpr uint8_t OM_IS_DAY = 19;
+static constexpr uint8_t OM_PRECIPITATION_PROBABILITY = 26;
+static constexpr uint8_t OM_TEMPERATURE = 47;
+static constexpr uint8_t OM_WEATHER_CODE = 56;
+
+static constexpr uint8_t OM_AGGREGATION_MINIMUM = 1;
+static constexpr uint8_t OM_AGGREGATION_MAXIMUM = 2;
+
+// Converts "2025-07-20T13:00:00Z", the only form MET Norway sends, to Unix
+// seconds; 0 if it doesn't parse
+static uint32_t parseIsoTime(const char* text) {
+    int year, month, day, hour, minute, second;
+    if (!text || sscanf(text, "%4d-%2d-%2dT%2d:%2d:%2d", &year, &month, &day, &hour, &minute,
+                        &second) != 6) {
+        return 0;
+    }
+    // Days since 1970-01-01 in the proleptic Gregorian calendar
+    year -= month <= 2;
+    int era = year / 400;
+    int yoe = year - era * 400;
+    int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    int64_t days = (int64_t) era * 146097 + doe - 719468;
+    return (uint32_t) (days * 86400 + hour * 3600 + minute * 60 + second);
+}
+
+// MET Norway symbol code (e.g. "lightrainshowers_day") to the WMO code the
+// UI already draws from Open-Meteo
+static uint8_t metSymbolToWmo(const char* symbol) {
+    if (strstr(symbol, "thunder")) {
+        return 95;
+    }
+    int intensity = 1;
+    if (strncmp(symbol, "light", 5) == 0) {
+        intensity = 0;
+    } else if (strncmp(symbol, "heavy", 5) == 0) {
+        intensity = 2;
+    }
+    bool showers = strstr(symbol, "showers") != nullptr;
+    if (strstr(symbol, "sleet")) {
+        return intensity == 2 ? 67 : 66;
+    }
+    if (strstr(symbol, "snow")) {
+        return showers ? (intensity == 2 ? 86 : 85) : 71 + 2 * intensity;
+    }
+    if (strstr(symbol, "rain")) {
+        return showers ? 80 + intensity : 61 + 2 * intensity;
+    }
+    if (strncmp(symbol, "clearsky", 8) == 0) {
+        return 0;
+    }
+    if (strncmp(symbol, "fair", 4) == 0) {
+        return 1;
+    }
+    if (strncmp(symbol, "partlycloudy", 12) == 0) {
+        return 2;
+    }
+    return strncmp(symbol, "fog", 3) == 0 ? 45 : 3;
+}
+
+// Steadman's apparent temperature (shade), the formula Open-Meteo uses for
+// apparent_temperature; MET Norway only sends its inputs
+static float apparentTemperature(float celsius, float humidity, float windSpeed) {
+    float vapourPressure =
+        humidity / 100.0f * 6.105f * expf(17.27f * celsius / (237.7f + celsius));
+    return celsius + 0.33f * vapourPressure - 0.70f * windSpeed - 4.00f;
+}
+
+// Percent-encodes a query parameter; the request line is written verbatim
+static String urlEncode(const String& value) {
+    static const char hex[] = "0123456789ABCDEF";
+    String encoded;
+    encoded.reserve(value.length() * 3);
+    for (size_t i = 0; i < value.length(); i++) {
+        uint8_t c = value[i];
+        if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
+            encoded += (char) c;
+        } else {
+            encoded += '%';
+            encoded += hex[c >> 4];
+            encoded += hex[c & 0x0f];
+        }
+    }
+    return encoded;
+}
+
+// Ends the body early once a search is cancelled, so the parser stops
+class CancellableStream : public Stream {
+public:
+    CancellableStream(Stream& input, const LocationSearchToken* cancel)
+        : input_(input), cancel_(cancel) {
+        setTimeout(0);  // The wrapped stream does the waiting
+    }
+
+    int available() override { return cancelled() ? 0 : input_.available(); }
+    int read() override { return cancelled() ? -1 : input_.read(); }
+    int peek() override { return cancelled() ? -1 : input_.peek(); }
+    size_t write(uint8_t) override { return 0; }
+
+private:
+    Stream& input_;
+    const LocationSearchToken* cancel_;
+
+    bool cancelled() const { return cancel_ && cancel_->cancelled(); }
+};
+
+// One provider's side of a hedged fetch: its first request, ready once a
+// 200 response head has been read
+class ProviderRequest : public HedgedRequest {
+public:
+    ProviderRequest(Weather& weather, WeatherProvider& provider, WeatherTier tier)
+        : weather_(weather), provider_(provider), tier_(tier) {}
+
+    bool start() override {
+        String path = provider_.path(weather_, 0, tier_);
+        LOG_WEATHER_D("Requesting https://%s%s", provider_.client().host(), path.c_str());
+        return provider_.client().send(path);
+    }
+
+    HedgedPoll poll() override {
+        HttpsClient& client = provider_.client();
+        int state = client.responseState();
+        if (state <= 0) {
+            return state < 0 ? HEDGE_FAILED : HEDGE_WAITING;
+        }
+        if (!client.receive()) {
+            return HEDGE_FAILED;
+        }
+        if (client.statusCode() != 200) {
+            LOG_WEATHER_W("%s answered with HTTP %d", provider_.name(), client.statusCode());
+            client.end();
+            return HEDGE_FAILED;
+        }
+        return HEDGE_READY;
+    }
+
+    // The losing connection is dropped rather than drained; a forecast body
+    // is far bigger than what end() is willing to skip
+    void cancel() override { provider_.client().stop(); }
+
+    LatencyHistogram& latency() override { return provider_.latency(); }
+
+private:
+    Weather& weather_;
+    WeatherProvider& provider_;
+    WeatherTier tier_;
+};
+
+static const HedgePolicy WEATHER_HEDGE_POLICY = {
+    WEATHER_HEDGE_MIN_MS, WEATHER_HEDGE_MAX_MS, WEATHER_HEDGE_DEFAULT_MS,
+    WEATHER_HEDGE_MIN_SAMPLES, WEATHER_HEDGE_PERCENTILE,
+};
+
+static uint32_t hedgeClock() {
+    return millis();
+}
+
+static void hedgeSleep(uint32_t ms) {
+    delay(ms);
+}
+
+Weather::Weather()
+    : dataValid(false), lastUpdateTime(0), lastTransferBytes(0),
+      jsonArena(jsonArenaBuffer, sizeof(jsonArenaBuffer)),
+      hedge(WEATHER_HEDGE_POLICY, hedgeClock, hedgeSleep), geocodingClient(GEOCODING_API_HOST),
+      requestMutex(xSemaphoreCreateMutex()), favourites(), favourite_data(), favourite_valid(),
+      favourite_count(0), active_favourite(0), wire_format(WIRE_FORMAT_JSON),
+      lan_sharing(false), lan_radius_km(LAN_SHARE_RADIUS_KM), hedged_fetch(false) {
+    buildWeatherFilter();
 }
 
 Weather::~Weather() {
     prefs.end();
+    vSemaphoreDelete(requestMutex);
 }
 
 bool Weather::init() {
@@ -29,107 +213,323 @@ bool Weather::init() {
     return true;
 }
 
-bool Weather::fetchWeatherData() {
+bool Weather::fetchWeatherData(WeatherTier tier) {
     LOG_FUNCTION_ENTRY(TAG_WEATHER);
-    LOG_WEATHER_I("Fetching weather data...");
+    LOG_WEATHER_I("Fetching %s weather data for %u location(s)...",
+                  tier == WEATHER_TIER_FORECAST ? "full forecast" : "current", favourite_count);
+    lastTransferBytes = 0;
     
     if (!isWiFiConnected()) {
         LOG_WEATHER_W("WiFi not connected, skipping weather update");
         return false;
     }
-    
-    // Build API URL
-    String apiUrl = buildWeatherApiUrl();
-    LOG_WEATHER_D("API URL: %s", apiUrl.c_str());
-    
-    // Make HTTP request
-    String response = makeHttpRequest(apiUrl);
-    if (response.length() == 0) {
-        LOG_WEATHER_E("Failed to fetch weather data - empty response");
+    if (favourite_count == 0) {
+        LOG_WEATHER_E("No locations configured, call init() first");
         return false;
     }
-    LOG_WEATHER_V("Raw weather response: %s", response.c_str());
     
-    // Parse response
-    bool success = parseWeatherResponse(response);
+    // FlatBuffers is opt-in; JSON from Open-Meteo alone is always there to
+    // fall back on
+    xSemaphoreTake(requestMutex, portMAX_DELAY);
+    openMeteo.setFormat(wire_format);
+    bool success = raceForecast(tier);
+    if (!success && wire_format == WIRE_FORMAT_FLATBUFFERS) {
+        LOG_WEATHER_W("FlatBuffers forecast failed, falling back to JSON");
+        openMeteo.setFormat(WIRE_FORMAT_JSON);
+        success = requestForecast(openMeteo, tier);
+    }
+    xSemaphoreGive(requestMutex);
+    
     if (success) {
         lastUpdateTime = millis();
         dataValid = true;
         LOG_WEATHER_I("Weather data updated successfully");
     } else {
-        LOG_WEATHER_E("Failed to parse weather response");
+        LOG_WEATHER_E("Failed to update weather data");
     }
     
     LOG_FUNCTION_EXIT(TAG_WEATHER);
     return success;
 }
 
-bool Weather::updateLocation(const String& lat, const String& lon, const String& locationName) {
-    // Update location variables
-    strncpy(latitude, lat.c_str(), sizeof(latitude) - 1);
-    strncpy(longitude, lon.c_str(), sizeof(longitude) - 1);
-    location = locationName;
+bool Weather::raceForecast(WeatherTier tier) {
+    // Geocoding is only used from settings; don't hold its TLS buffers
+    // while two forecast connections may be open
+    geocodingClient.closeIfIdle();
+    ProviderRequest primary(*this, openMeteo, tier);
+    ProviderRequest secondary(*this, metNorway, tier);
+    // Without hedging Open-Meteo runs alone, but is still timed, so the
+    // threshold has real samples by the time hedging is turned on
+    HedgedOutcome outcome =
+        hedge.race(primary, hedged_fetch ? &secondary : nullptr, HTTPS_IO_TIMEOUT_MS);
+    
+    LOG_WEATHER_D("Time to first byte: %s p50 %u ms, p95 %u ms; %s p50 %u ms, p95 %u ms",
+                  openMeteo.name(), openMeteo.latency().percentile(0.5f),
+                  openMeteo.latency().percentile(0.95f), metNorway.name(),
+                  metNorway.latency().percentile(0.5f), metNorway.latency().percentile(0.95f));
+    if (outcome.winner < 0) {
+        LOG_WEATHER_E("No forecast provider answered within %lu ms", HTTPS_IO_TIMEOUT_MS);
+        return false;
+    }
+    
+    WeatherProvider* providers[] = {&openMeteo, &metNorway};
+    WeatherProvider& winner = *providers[outcome.winner];
+    if (outcome.hedged) {
+        LOG_WEATHER_I("%s slower than %u ms, asked %s too; %s answered first", openMeteo.name(),
+                      outcome.hedge_delay_ms, metNorway.name(), winner.name());
+    }
+    return readForecast(winner, 0, tier) && requestForecast(winner, tier, 1);
+}
+
+bool Weather::requestForecast(WeatherProvider& provider, WeatherTier tier, uint8_t first) {
+    geocodingClient.closeIfIdle();
+    for (uint8_t i = first; i < provider.requestCount(*this); i++) {
+        if (!beginRequest(provider.client(), provider.path(*this, i, tier)) ||
+            !readForecast(provider, i, tier)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Weather::readForecast(WeatherProvider& provider, uint8_t request, WeatherTier tier) {
+    // Decompress on the fly so neither the compressed nor the plain body is
+    // ever held in full
+    HttpsClient& client = provider.client();
+    InflateStream body(client.body(), InflateStream::encodingFromHeader(client.contentEncoding()));
+    bool success = body.begin() && provider.parse(*this, body, request, tier) && !body.hasError();
+    logTransferSize(provider.name(), body);
+    client.end();
+    lastTransferBytes += client.bodyBytes();
+    client.logStats();
     
-    // Save to preferences
-    prefs.putString("latitude", lat);
-    prefs.putString("longitude", lon);
-    prefs.putString("location", locationName);
+    if (!success) {
+        LOG_WEATHER_E("Failed to parse %s weather response", provider.name());
+    }
+    return success;
+}
+
+bool Weather::hasAllFavouriteData() const {
+    for (uint8_t i = 0; i < favourite_count; i++) {
+        if (!favourite_valid[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Weather::commitFavourite(uint8_t index, const WeatherData& data, WeatherTier tier) {
+    WeatherData& favourite = favourite_data[index];
+    favourite = data;
+    strlcpy(favourite.location_name, favourites[index].name, sizeof(favourite.location_name));
+    time_t now = time(nullptr);
+    favourite.fetched_at = now > MIN_VALID_EPOCH ? (uint32_t) now : 0;
+    favourite.stale = false;
     
-    // Invalidate current data to force refresh
+    // Current conditions alone are not a forecast worth showing
+    favourite_valid[index] = favourite_valid[index] || tier == WEATHER_TIER_FORECAST;
+}
+
+void Weather::commitSharedForecast(const WeatherData& data, WeatherTier tier) {
+    commitFavourite(active_favourite, data, tier);
+    dataValid = hasAllFavouriteData();
+}
+
+bool Weather::updateLocation(const String& lat, const String& lon, const String& locationName) {
+    // Replaces the active favourite; its old forecast no longer applies
+    setFavourite(active_favourite, lat, lon, locationName);
+    saveFavourites();
+    dataValid = hasAllFavouriteData();
+    return true;
+}
+
+bool Weather::addFavourite(const String& lat, const String& lon, const String& locationName) {
+    for (uint8_t i = 0; i < favourite_count; i++) {
+        if (lat == favourites[i].latitude && lon == favourites[i].longitude) {
+            return selectFavourite(i);
+        }
+    }
+    if (favourite_count >= WEATHER_MAX_FAVOURITES) {
+        LOG_WEATHER_W("Favourites full (%d), not adding %s", WEATHER_MAX_FAVOURITES,
+                      locationName.c_str());
+        return false;
+    }
+    
+    active_favourite = favourite_count++;
+    setFavourite(active_favourite, lat, lon, locationName);
+    saveFavourites();
     dataValid = false;
+    return true;
+}
+
+bool Weather::removeFavourite(uint8_t index) {
+    // The last location can only be replaced, never removed
+    if (index >= favourite_count || favourite_count == 1) {
+        return false;
+    }
     
+    // Locations and their forecasts stay in step
+    size_t following = favourite_count - index - 1;
+    memmove(&favourites[index], &favourites[index + 1], following * sizeof(favourites[0]));
+    memmove(&favourite_data[index], &favourite_data[index + 1],
+            following * sizeof(favourite_data[0]));
+    memmove(&favourite_valid[index], &favourite_valid[index + 1],
+            following * sizeof(favourite_valid[0]));
+    favourite_count--;
+    favourite_valid[favourite_count] = false;
+    
+    if (active_favourite > index || active_favourite == favourite_count) {
+        active_favourite--;
+    }
+    saveFavourites();
     return true;
 }
 
-bool Weather::searchLocations(const String& query, JsonArray& results) {
+bool Weather::selectFavourite(uint8_t index) {
+    if (index >= favourite_count) {
+        return false;
+    }
+    active_favourite = index;
+    saveFavourites();
+    return true;
+}
+
+void Weather::setFavourite(uint8_t index, const String& lat, const String& lon,
+                           const String& locationName) {
+    WeatherLocation& favourite = favourites[index];
+    strlcpy(favourite.latitude, lat.c_str(), sizeof(favourite.latitude));
+    strlcpy(favourite.longitude, lon.c_str(), sizeof(favourite.longitude));
+    strlcpy(favourite.name, locationName.c_str(), sizeof(favourite.name));
+    favourite_valid[index] = false;
+    LOG_WEATHER_I("Favourite %u is now %s (%s, %s)", index, favourite.name, favourite.latitude,
+                  favourite.longitude);
+}
+
+void Weather::saveFavourites() {
+    prefs.putBytes("favourites", favourites, favourite_count * sizeof(WeatherLocation));
+    prefs.putUChar("favourite", active_favourite);
+    
+    // The single-location keys still describe the active favourite
+    const WeatherLocation& active = favourites[active_favourite];
+    prefs.putString("latitude", active.latitude);
+    prefs.putString("longitude", active.longitude);
+    prefs.putString("location", active.name);
+}
+
+bool Weather::searchLocations(const String& query, LocationResults& results,
+                              const LocationSearchToken* cancel) {
     LOG_FUNCTION_ENTRY(TAG_WEATHER);
     LOG_WEATHER_I("Searching for locations: %s", query.c_str());
+    results.count = 0;
     
     if (!isWiFiConnected()) {
         LOG_WEATHER_W("WiFi not connected, cannot search locations");
         return false;
     }
     
-    String geoUrl = buildGeocodingUrl(query);
-    LOG_WEATHER_D("Geocoding URL: %s", geoUrl.c_str());
-    String response = makeHttpRequest(geoUrl);
+    String geoPath = buildGeocodingPath(query);
+    LOG_WEATHER_D("Geocoding path: %s", geoPath.c_str());
     
-    if (response.length() == 0) {
-        LOG_WEATHER_E("Failed to fetch geocoding data - empty response");
+    // A forecast fetch can hold the lock for seconds; the query may be out
+    // of date by the time it is released
+    xSemaphoreTake(requestMutex, portMAX_DELAY);
+    if (cancel && cancel->cancelled()) {
+        xSemaphoreGive(requestMutex);
+        LOG_WEATHER_D("Search for %s superseded before sending", query.c_str());
+        return false;
+    }
+    openMeteo.client().closeIfIdle();
+    metNorway.client().closeIfIdle();
+    if (!beginRequest(geocodingClient, geoPath)) {
+        xSemaphoreGive(requestMutex);
+        LOG_WEATHER_E("Failed to fetch geocoding data");
         return false;
     }
     
-    // Parse geocoding response
-    DynamicJsonDocument doc(8192);
-    DeserializationError error = deserializeJson(doc, response);
+    // A cancelled search stops parsing; end() drains the few KB left so the
+    // connection stays usable for the next query
+    InflateStream body(geocodingClient.body(),
+                       InflateStream::encodingFromHeader(geocodingClient.contentEncoding()));
+    CancellableStream input(body, cancel);
+    bool success = body.begin() && parseLocationStream(input, results) && !body.hasError();
+    logTransferSize("Geocoding", body);
+    geocodingClient.end();
+    geocodingClient.logStats();
+    xSemaphoreGive(requestMutex);
+    
+    if (cancel && cancel->cancelled()) {
+        LOG_WEATHER_D("Search for %s superseded while reading", query.c_str());
+        success = false;
+    }
+    if (success) {
+        strlcpy(results.query, query.c_str(), sizeof(results.query));
+        results.complete = true;
+    }
+    
+    LOG_FUNCTION_EXIT(TAG_WEATHER);
+    return success;
+}
+
+bool Weather::parseLocationStream(Stream& input, LocationResults& results) {
+    // Shares the forecast arena; both run under requestMutex
+    results.count = 0;
+    jsonArena.reset();
+    JsonDocument doc(&jsonArena);
+    DeserializationError error =
+        deserializeJson(doc, input, DeserializationOption::Filter(locationFilter));
     
     if (error) {
         LOG_WEATHER_E("Failed to parse geocoding JSON: %s", error.c_str());
         return false;
     }
     
-    if (doc["results"].is<JsonArray>()) {
-        results = doc["results"].as<JsonArray>();
-        LOG_WEATHER_I("Found %d location results", results.size());
-        return true;
+    if (!doc["results"].is<JsonArray>()) {
+        LOG_WEATHER_W("No location results found in response");
+        return false;
     }
     
-    LOG_WEATHER_W("No location results found in response");
-    return false;
+    for (JsonObject match : doc["results"].as<JsonArray>()) {
+        if (results.count >= LOCATION_SEARCH_MAX_RESULTS) {
+            break;
+        }
+        LocationResult& result = results.items[results.count++];
+        strlcpy(result.name, match["name"] | "", sizeof(result.name));
+        strlcpy(result.admin1, match["admin1"] | "", sizeof(result.admin1));
+        strlcpy(result.country, match["country"] | "", sizeof(result.country));
+        result.latitude = match["latitude"];
+        result.longitude = match["longitude"];
+    }
+    LOG_WEATHER_I("Found %d location results", results.count);
+    return true;
 }
 
 void Weather::loadSettings() {
     LOG_FUNCTION_ENTRY(TAG_WEATHER);
     LOG_WEATHER_D("Loading weather settings from preferences");
     
-    // Load location settings
-    String savedLat = prefs.getString("latitude", LATITUDE_DEFAULT);
-    String savedLon = prefs.getString("longitude", LONGITUDE_DEFAULT);
-    String savedLocation = prefs.getString("location", LOCATION_DEFAULT);
-    
-    strncpy(latitude, savedLat.c_str(), sizeof(latitude) - 1);
-    strncpy(longitude, savedLon.c_str(), sizeof(longitude) - 1);
-    location = savedLocation;
+    // Load favourites; settings from before favourites hold a single location
+    size_t stored = prefs.getBytesLength("favourites");
+    favourite_count = 0;
+    if (stored % sizeof(WeatherLocation) == 0 && stored <= sizeof(favourites)) {
+        stored = prefs.getBytes("favourites", favourites, stored);
+        favourite_count = stored / sizeof(WeatherLocation);
+    }
+    for (uint8_t i = 0; i < favourite_count; i++) {
+        favourites[i].latitude[sizeof(favourites[i].latitude) - 1] = '\0';
+        favourites[i].longitude[sizeof(favourites[i].longitude) - 1] = '\0';
+        favourites[i].name[sizeof(favourites[i].name) - 1] = '\0';
+    }
+    if (favourite_count == 0) {
+        setFavourite(0, prefs.getString("latitude", LATITUDE_DEFAULT),
+                     prefs.getString("longitude", LONGITUDE_DEFAULT),
+                     prefs.getString("location", LOCATION_DEFAULT));
+        favourite_count = 1;
+    }
+    active_favourite = prefs.getUChar("favourite", 0);
+    if (active_favourite >= favourite_count) {
+        active_favourite = 0;
+    }
+    const WeatherLocation& active = favourites[active_favourite];
     
     // Load unit preferences
     use_fahrenheit = prefs.getBool("use_fahrenheit", false);
@@ -137,44 +537,150 @@ void Weather::loadSettings() {
     
     // Load language preference
     current_language = (Language)prefs.getInt("language", LANG_EN);
+    wire_format = (WeatherWireFormat)prefs.getInt("wire_format", WIRE_FORMAT_JSON);
+    lan_sharing = prefs.getBool("lan_share", false);
+    lan_radius_km = prefs.getFloat("lan_radius", LAN_SHARE_RADIUS_KM);
+    hedged_fetch = prefs.getBool("hedged_fetch", false);
     
-    LOG_WEATHER_I("Settings loaded - Location: %s (%s, %s), Units: %s, Time: %s",
-                  location.c_str(), latitude, longitude,
-                  use_fahrenheit ? "°F" : "°C",
-                  use_24_hour ? "24h" : "12h");
+    LOG_WEATHER_I("Settings loaded - Location: %s (%s, %s) of %u, Units: %s, Time: %s, "
+                  "Format: %s, LAN sharing: %s, Hedged fetch: %s", active.name, active.latitude,
+                  active.longitude, favourite_count, use_fahrenheit ? "°F" : "°C",
+                  use_24_hour ? "24h" : "12h",
+                  wire_format == WIRE_FORMAT_FLATBUFFERS ? "FlatBuffers" : "JSON",
+                  lan_sharing ? "on" : "off", hedged_fetch ? "on" : "off");
     LOG_FUNCTION_EXIT(TAG_WEATHER);
 }
 
 void Weather::saveSettings() {
-    prefs.putString("latitude", String(latitude));
-    prefs.putString("longitude", String(longitude));
-    prefs.putString("location", location);
+    saveFavourites();
     prefs.putBool("use_fahrenheit", use_fahrenheit);
     prefs.putBool("use_24_hour", use_24_hour);
     prefs.putInt("language", (int)current_language);
+    prefs.putInt("wire_format", (int)wire_format);
+    prefs.putBool("lan_share", lan_sharing);
+    prefs.putFloat("lan_radius", lan_radius_km);
+    prefs.putBool("hedged_fetch", hedged_fetch);
+}
+
+void Weather::buildWeatherFilter() {
+    // Only these fields are kept in the arena; units, timezone metadata and
+    // anything else the API adds are skipped while reading the stream
+    weatherFilter["utc_offset_seconds"] = true;
+    
+    JsonObject current = weatherFilter["current"].to<JsonObject>();
+    current["temperature_2m"] = true;
+    current["apparent_temperature"] = true;
+    current["weather_code"] = true;
+    current["is_day"] = true;
+    
+    JsonObject daily = weatherFilter["daily"].to<JsonObject>();
+    daily["time"] = true;
+    daily["temperature_2m_max"] = true;
+    daily["temperature_2m_min"] = true;
+    daily["weather_code"] = true;
+    
+    JsonObject hourly = weatherFilter["hourly"].to<JsonObject>();
+    hourly["time"] = true;
+    hourly["temperature_2m"] = true;
+    hourly["weather_code"] = true;
+    hourly["precipitation_probability"] = true;
+    
+    // One MET Norway timeseries entry; the array is read an entry at a time
+    metNorwayFilter["time"] = true;
+    JsonObject instant = metNorwayFilter["data"]["instant"]["details"].to<JsonObject>();
+    instant["air_temperature"] = true;
+    instant["relative_humidity"] = true;
+    instant["wind_speed"] = true;
+    for (const char* period : {"next_1_hours", "next_6_hours"}) {
+        metNorwayFilter["data"][period]["summary"]["symbol_code"] = true;
+        metNorwayFilter["data"][period]["details"]["precipitation_amount"] = true;
+    }
+    
+    JsonObject match = locationFilter["results"][0].to<JsonObject>();
+    match["name"] = true;
+    match["admin1"] = true;
+    match["country"] = true;
+    match["latitude"] = true;
+    match["longitude"] = true;
 }
 
-bool Weather::parseWeatherResponse(const String& response) {
+bool Weather::parseWeatherBatchStream(Stream& input, WeatherTier tier) {
+    // One location comes back as a bare object, several as an array of them.
+    // The array is read an element at a time, so the arena only ever holds
+    // one location's forecast.
+    while (isspace(input.peek())) {
+        input.read();
+    }
+    bool batched = input.peek() == '[';
+    if (batched) {
+        input.read();
+    } else if (favourite_count != 1) {
+        LOG_WEATHER_E("Expected %u forecasts, got a single one", favourite_count);
+        return false;
+    }
+    
+    for (uint8_t i = 0; i < favourite_count; i++) {
+        if (batched && i > 0 && !input.find(",")) {
+            LOG_WEATHER_E("Weather response ended after %u of %u forecasts", i, favourite_count);
+            return false;
+        }
+        parse_scratch = favourite_data[i];
+        if (!parseWeatherStream(input, parse_scratch)) {
+            return false;
+        }
+        commitFavourite(i, parse_scratch, tier);
+    }
+    return true;
+}
+
+bool Weather::parseWeatherFlatBufferBatchStream(Stream& input, WeatherTier tier) {
+    // Each location is its own size-prefixed message, back to back
+    for (uint8_t i = 0; i < favourite_count; i++) {
+        parse_scratch = favourite_data[i];
+        if (!parseWeatherFlatBufferStream(input, parse_scratch)) {
+            return false;
+        }
+        commitFavourite(i, parse_scratch, tier);
+    }
+    return true;
+}
+
+bool Weather::parseWeatherStream(Stream& input, WeatherData& data) {
     LOG_FUNCTION_ENTRY(TAG_WEATHER);
-    LOG_WEATHER_D("Parsing weather response (%d bytes)", response.length());
     
-    DynamicJsonDocument doc(16384);
-    DeserializationError error = deserializeJson(doc, response);
+    // No document outlives a parse, so the whole arena can be recycled
+    jsonArena.reset();
+    JsonDocument doc(&jsonArena);
+    
+    unsigned long parseStart = micros();
+    DeserializationError error =
+        deserializeJson(doc, input, DeserializationOption::Filter(weatherFilter));
+    unsigned long parseMicros = micros() - parseStart;
     
     if (error) {
-        LOG_WEATHER_E("Failed to parse weather JSON: %s", error.c_str());
+        LOG_WEATHER_E("Failed to parse weather JSON: %s (arena %u/%u bytes)", error.c_str(),
+                      jsonArena.peak(), jsonArena.capacity());
         return false;
     }
-    LOG_WEATHER_D("Weather JSON parsed successfully");
+    LOG_WEATHER_D("Weather JSON parsed in %lu us, arena peak %u/%u bytes in %u blocks",
+                  parseMicros, jsonArena.peak(), jsonArena.capacity(),
+                  jsonArena.allocationCount());
     
+    bool success = parseWeatherDocument(doc, data);
+    LOG_FUNCTION_EXIT(TAG_WEATHER);
+    return success;
+}
+
+bool Weather::parseWeatherDocument(JsonDocument& doc, WeatherData& data) {
     // Parse current weather
     if (doc["current"].is<JsonObject>()) {
         JsonObject current = doc["current"];
-        currentWeather.current_temp = current["temperature_2m"];
-        currentWeather.feels_like = current["apparent_temperature"];
-        currentWeather.weather_code = current["weather_code"];
-        currentWeather.is_day = current["is_day"];
+        data.current_temp = weatherTempFromFloat(current["temperature_2m"].as<float>());
+        data.feels_like = weatherTempFromFloat(current["apparent_temperature"].as<float>());
+        data.weather_code = current["weather_code"];
+        data.is_day = current["is_day"];
     }
+    data.utc_offset = doc["utc_offset_seconds"];
     
     // Parse daily forecast
     if (doc["daily"].is<JsonObject>()) {
@@ -184,15 +690,11 @@ bool Weather::parseWeatherResponse(const String& response) {
         JsonArray codes = daily["weather_code"];
         JsonArray times = daily["time"];
         
-        for (int i = 0; i < 7 && i < temps_high.size(); i++) {
-            currentWeather.daily_high[i] = temps_high[i];
-            currentWeather.daily_low[i] = temps_low[i];
-            currentWeather.daily_codes[i] = codes[i];
-            
-            // Parse and format day names
-            String timeStr = times[i];
-            // Convert ISO date to day name
-            currentWeather.daily_days[i] = timeStr; // Simplified - would need proper date parsing
+        for (size_t i = 0; i < 7 && i < temps_high.size(); i++) {
+            data.daily_high[i] = weatherTempFromFloat(temps_high[i].as<float>());
+            data.daily_low[i] = weatherTempFromFloat(temps_low[i].as<float>());
+            data.daily_codes[i] = codes[i];
+            data.daily_times[i] = times[i];
         }
     }
     
@@ -204,63 +706,344 @@ bool Weather::parseWeatherResponse(const String& response) {
         JsonArray precipitation = hourly["precipitation_probability"];
         JsonArray times = hourly["time"];
         
-        for (int i = 0; i < 24 && i < temps.size(); i++) {
-            currentWeather.hourly_temps[i] = temps[i];
-            currentWeather.hourly_codes[i] = codes[i];
-            currentWeather.hourly_precipitation[i] = precipitation[i];
-            currentWeather.hourly_times[i] = times[i].as<String>();
+        // Entries are one hour apart, so only the first time is kept
+        data.hourly_start = times[0];
+        data.hourly_count = 0;
+        for (size_t i = 0; i < WEATHER_HOURLY_CAPACITY && i < temps.size(); i++) {
+            data.hourly_temps[i] = weatherTempFromFloat(temps[i].as<float>());
+            data.hourly_codes[i] = codes[i];
+            data.hourly_precipitation[i] = precipitation[i];
+            data.hourly_count++;
         }
     }
     
-    currentWeather.location_name = location;
+    return true;
+}
+
+bool Weather::parseWeatherFlatBufferStream(Stream& input, WeatherData& data) {
+    LOG_FUNCTION_ENTRY(TAG_WEATHER);
+    
+    // The body is a size-prefixed FlatBuffer; read it whole into the parse
+    // arena and decode in place
+    uint32_t length = 0;
+    if (input.readBytes((char*) &length, sizeof(length)) != sizeof(length)) {
+        LOG_WEATHER_E("FlatBuffers response truncated before size prefix");
+        return false;
+    }
+    
+    jsonArena.reset();
+    uint8_t* buffer = static_cast<uint8_t*>(jsonArena.allocate(length));
+    if (!buffer) {
+        LOG_WEATHER_E("FlatBuffers response of %u bytes exceeds %u byte arena", length,
+                      jsonArena.capacity());
+        return false;
+    }
+    
+    unsigned long readStart = micros();
+    size_t received = input.readBytes((char*) buffer, length);
+    if (received != length) {
+        LOG_WEATHER_E("FlatBuffers response truncated: %u of %u bytes", received, length);
+        return false;
+    }
+    LOG_WEATHER_D("FlatBuffers response: %u bytes received in %lu us", length,
+                  micros() - readStart);
+    
+    bool success = parseWeatherFlatBuffer(buffer, length, data);
+    LOG_FUNCTION_EXIT(TAG_WEATHER);
+    return success;
+}
+
+bool Weather::parseWeatherFlatBuffer(const uint8_t* buffer, size_t length, WeatherData& data) {
+    FlatTable response = FlatTable::root(buffer, length);
+    if (!response.isValid()) {
+        LOG_WEATHER_E("Invalid FlatBuffers weather response");
+        return false;
+    }
+    
+    // Current-conditions polls carry no daily or hourly block
+    FlatTable current = response.table(OM_RESPONSE_CURRENT);
+    FlatTable daily = response.table(OM_RESPONSE_DAILY);
+    FlatTable hourly = response.table(OM_RESPONSE_HOURLY);
+    if (!current.isValid()) {
+        LOG_WEATHER_E("FlatBuffers weather response is missing current conditions");
+        return false;
+    }
+    
+    data.utc_offset = response.scalar<int32_t>(OM_RESPONSE_UTC_OFFSET_SECONDS, 0);
+    parseFlatBufferCurrent(current, data);
+    if (daily.isValid()) {
+        parseFlatBufferDaily(daily, data);
+    }
+    if (hourly.isValid()) {
+        parseFlatBufferHourly(hourly, data);
+    }
     
     return true;
 }
 
-String Weather::buildWeatherApiUrl() {
-    String url = "https://api.open-meteo.com/v1/forecast";
-    url += "?latitude=" + String(latitude);
-    url += "&longitude=" + String(longitude);
-    url += "&current=temperature_2m,apparent_temperature,is_day,weather_code";
-    url += "&daily=temperature_2m_max,temperature_2m_min,weather_code";
-    url += "&hourly=temperature_2m,weather_code,precipitation_probability";
-    url += "&timezone=auto";
-    url += "&forecast_days=7";
+void Weather::parseFlatBufferCurrent(const FlatTable& current, WeatherData& data) {
+    FlatVector variables = current.vector(OM_BLOCK_VARIABLES, sizeof(uint32_t));
+    for (size_t i = 0; i < variables.length; i++) {
+        FlatTable variable = current.tableAt(variables, i);
+        float value = variable.scalar<float>(OM_VARIABLE_VALUE, 0.0f);
+        
+        switch (variable.scalar<uint8_t>(OM_VARIABLE_VARIABLE, 0)) {
+            case OM_TEMPERATURE: data.current_temp = weatherTempFromFloat(value); break;
+            case OM_APPARENT_TEMPERATURE: data.feels_like = weatherTempFromFloat(value); break;
+            case OM_WEATHER_CODE: data.weather_code = (uint8_t) value; break;
+            case OM_IS_DAY: data.is_day = value != 0.0f; break;
+        }
+    }
+}
+
+void Weather::parseFlatBufferDaily(const FlatTable& daily, WeatherData& data) {
+    int64_t start = daily.scalar<int64_t>(OM_BLOCK_TIME, 0);
+    int32_t interval = daily.scalar<int32_t>(OM_BLOCK_INTERVAL, 86400);
     
-    return url;
+    FlatVector variables = daily.vector(OM_BLOCK_VARIABLES, sizeof(uint32_t));
+    for (size_t i = 0; i < variables.length; i++) {
+        FlatTable variable = daily.tableAt(variables, i);
+        FlatVector values = variable.vector(OM_VARIABLE_VALUES, sizeof(float));
+        uint8_t aggregation = variable.scalar<uint8_t>(OM_VARIABLE_AGGREGATION, 0);
+        
+        int16_t* target = nullptr;
+        bool codes = false;
+        switch (variable.scalar<uint8_t>(OM_VARIABLE_VARIABLE, 0)) {
+            case OM_TEMPERATURE:
+                if (aggregation == OM_AGGREGATION_MAXIMUM) {
+                    target = data.daily_high;
+                } else if (aggregation == OM_AGGREGATION_MINIMUM) {
+                    target = data.daily_low;
+                }
+                break;
+            case OM_WEATHER_CODE:
+                codes = true;
+                break;
+        }
+        
+        for (size_t day = 0; day < 7 && day < values.length; day++) {
+            float value = variable.floatAt(values, day);
+            if (target) {
+                target[day] = weatherTempFromFloat(value);
+            } else if (codes) {
+                data.daily_codes[day] = (uint8_t) value;
+            }
+        }
+    }
+    
+    for (int day = 0; day < 7; day++) {
+        data.daily_times[day] = (uint32_t) (start + (int64_t) day * interval);
+    }
+}
+
+void Weather::parseFlatBufferHourly(const FlatTable& hourly, WeatherData& data) {
+    int64_t start = hourly.scalar<int64_t>(OM_BLOCK_TIME, 0);
+    int32_t interval = hourly.scalar<int32_t>(OM_BLOCK_INTERVAL, WEATHER_HOURLY_STEP);
+    data.hourly_start = (uint32_t) start;
+    data.hourly_count = 0;
+    if (interval != WEATHER_HOURLY_STEP) {
+        LOG_WEATHER_W("Unexpected hourly interval %d s, ignoring hourly forecast", interval);
+        return;
+    }
+    
+    size_t count = WEATHER_HOURLY_CAPACITY;
+    FlatVector variables = hourly.vector(OM_BLOCK_VARIABLES, sizeof(uint32_t));
+    for (size_t i = 0; i < variables.length; i++) {
+        FlatTable variable = hourly.tableAt(variables, i);
+        FlatVector values = variable.vector(OM_VARIABLE_VALUES, sizeof(float));
+        uint8_t kind = variable.scalar<uint8_t>(OM_VARIABLE_VARIABLE, 0);
+        count = min(count, (size_t) values.length);
+        
+        for (size_t hour = 0; hour < count; hour++) {
+            float value = variable.floatAt(values, hour);
+            switch (kind) {
+                case OM_TEMPERATURE: data.hourly_temps[hour] = weatherTempFromFloat(value); break;
+                case OM_WEATHER_CODE: data.hourly_codes[hour] = (uint8_t) value; break;
+                case OM_PRECIPITATION_PROBABILITY:
+                    data.hourly_precipitation[hour] = (uint8_t) value;
+                    break;
+            }
+        }
+    }
+    data.hourly_count = variables.length ? count : 0;
 }
 
-String Weather::buildGeocodingUrl(const String& query) {
-    String url = "https://geocoding-api.open-meteo.com/v1/search";
-    url += "?name=" + query;
-    url += "&count=10";
+bool Weather::parseMetNorwayStream(Stream& input, uint8_t favourite, WeatherTier tier) {
+    if (favourite >= favourite_count) {
+        return false;
+    }
+    // MET Norway sends no UTC offset. The last one Open-Meteo reported for
+    // this place sets the local days; before there is one, the longitude
+    // gives a rough zone.
+    parse_scratch = favourite_data[favourite];
+    if (!favourite_valid[favourite]) {
+        float zone = roundf(atof(favourites[favourite].longitude) / 15.0f);
+        parse_scratch.utc_offset = (int32_t) zone * 3600;
+    }
+    if (!parseMetNorwaySeries(input, parse_scratch, tier)) {
+        return false;
+    }
+    commitFavourite(favourite, parse_scratch, tier);
+    return true;
+}
+
+bool Weather::parseMetNorwaySeries(Stream& input, WeatherData& data, WeatherTier tier) {
+    // Hourly entries for the first two or three days, then six-hourly. Each
+    // is parsed on its own, and the gaps are filled by interpolating the
+    // temperature and repeating the period's symbol. Compact forecasts have
+    // no precipitation probability, so an hour counts as 100% when its
+    // period expects at least 0.1 mm and 0% otherwise.
+    if (!input.find("\"timeseries\":[")) {
+        LOG_WEATHER_E("MET Norway response has no timeseries");
+        return false;
+    }
+    
+    int previous = -1;
+    float previous_temp = 0;
+    uint8_t code = 3;
+    uint8_t precipitation = 0;
+    for (uint16_t entry = 0;; entry++) {
+        jsonArena.reset();
+        JsonDocument doc(&jsonArena);
+        DeserializationError error =
+            deserializeJson(doc, input, DeserializationOption::Filter(metNorwayFilter));
+        if (error) {
+            LOG_WEATHER_E("Failed to parse MET Norway entry %u: %s", entry, error.c_str());
+            return false;
+        }
+        uint32_t time = parseIsoTime(doc["time"]);
+        if (!time || (entry > 0 && time <= data.hourly_start)) {
+            LOG_WEATHER_E("MET Norway entry %u has no usable time", entry);
+            return false;
+        }
+        
+        JsonObject details = doc["data"]["instant"]["details"];
+        float temp = details["air_temperature"];
+        JsonObject period = doc["data"]["next_1_hours"];
+        if (period.isNull()) {
+            period = doc["data"]["next_6_hours"];
+        }
+        const char* symbol = period["summary"]["symbol_code"];
+        uint8_t entry_code = code;
+        uint8_t entry_precipitation = precipitation;
+        if (symbol) {
+            entry_code = metSymbolToWmo(symbol);
+            float amount = period["details"]["precipitation_amount"];
+            entry_precipitation = amount >= 0.1f ? 100 : 0;
+        }
+        
+        if (entry == 0) {
+            data.current_temp = weatherTempFromFloat(temp);
+            data.feels_like = weatherTempFromFloat(apparentTemperature(
+                temp, details["relative_humidity"], details["wind_speed"]));
+            data.weather_code = entry_code;
+            data.is_day = !symbol || !strstr(symbol, "_night");
+            if (tier == WEATHER_TIER_CURRENT) {
+                return true;
+            }
+            data.hourly_start = time;
+            data.hourly_count = 0;
+        }
+        
+        // Hours between entries belong to the earlier entry's period
+        int index = weatherHourlyIndex(data, time);
+        for (int hour = previous + 1; hour < index && hour < WEATHER_HOURLY_CAPACITY; hour++) {
+            float share = (float) (hour - previous) / (index - previous);
+            data.hourly_temps[hour] =
+                weatherTempFromFloat(previous_temp + (temp - previous_temp) * share);
+            data.hourly_codes[hour] = code;
+            data.hourly_precipitation[hour] = precipitation;
+            data.hourly_count = hour + 1;
+        }
+        if (index >= WEATHER_HOURLY_CAPACITY) {
+            break;
+        }
+        data.hourly_temps[index] = weatherTempFromFloat(temp);
+        data.hourly_codes[index] = entry_code;
+        data.hourly_precipitation[index] = entry_precipitation;
+        data.hourly_count = index + 1;
+        previous = index;
+        previous_temp = temp;
+        code = entry_code;
+        precipitation = entry_precipitation;
+        
+        while (isspace(input.peek())) {
+            input.read();
+        }
+        int next = input.read();
+        if (next == ']') {
+            break;
+        }
+        if (next != ',') {
+            LOG_WEATHER_E("MET Norway timeseries ended after %u entries", entry + 1);
+            return false;
+        }
+    }
+    
+    summariseDays(data);
+    return true;
+}
+
+void Weather::summariseDays(WeatherData& data) {
+    // Daily highs, lows and the worst weather from the hourly series, by
+    // local day starting today
+    int64_t first_day = ((int64_t) data.hourly_start + data.utc_offset) / 86400;
+    bool seen[7] = {};
+    for (int hour = 0; hour < data.hourly_count; hour++) {
+        int64_t day = ((int64_t) weatherHourlyTime(data, hour) + data.utc_offset) / 86400 -
+                      first_day;
+        if (day >= 7) {
+            break;
+        }
+        int16_t temp = data.hourly_temps[hour];
+        if (!seen[day]) {
+            seen[day] = true;
+            data.daily_high[day] = temp;
+            data.daily_low[day] = temp;
+            data.daily_codes[day] = data.hourly_codes[hour];
+        }
+        data.daily_high[day] = max(data.daily_high[day], temp);
+        data.daily_low[day] = min(data.daily_low[day], temp);
+        data.daily_codes[day] = max(data.daily_codes[day], data.hourly_codes[hour]);
+    }
+    for (int day = 0; day < 7; day++) {
+        data.daily_times[day] = (uint32_t) ((first_day + day) * 86400 - data.utc_offset);
+    }
+}
+
+String Weather::buildGeocodingPath(const String& query) {
+    String url = "/v1/search";
+    url += "?name=" + urlEncode(query);
+    url += "&count=" + String(LOCATION_SEARCH_MAX_RESULTS);
     url += "&language=en";
     url += "&format=json";
     
     return url;
 }
 
-String Weather::makeHttpRequest(const String& url) {
-    LOG_FUNCTION_ENTRY(TAG_WEATHER);
-    LOG_WEATHER_D("Making HTTP request to: %s", url.c_str());
-    
-    HTTPClient http;
-    http.begin(url);
-    http.addHeader("User-Agent", "Aura Weather Display");
+bool Weather::beginRequest(HttpsClient& client, const String& path) {
+    LOG_WEATHER_D("Requesting https://%s%s", client.host(), path.c_str());
     
-    int httpCode = http.GET();
-    String response = "";
-    
-    if (httpCode == HTTP_CODE_OK) {
-        response = http.getString();
-        LOG_WEATHER_D("HTTP request successful, response size: %d bytes", response.length());
-    } else {
-        LOG_WEATHER_E("HTTP request failed with code: %d", httpCode);
+    if (!client.get(path)) {
+        return false;
     }
-    
-    http.end();
-    LOG_FUNCTION_EXIT(TAG_WEATHER);
-    return response;
+    if (client.statusCode() != 200) {
+        LOG_WEATHER_E("HTTP request failed with code: %d", client.statusCode());
+        client.end();
+        return false;
+    }
+    return true;
+}
+
+void Weather::logTransferSize(const char* request, const InflateStream& body) {
+    if (body.encoding() == InflateStream::ENCODING_IDENTITY) {
+        LOG_WEATHER_D("%s response received uncompressed", request);
+        return;
+    }
+    size_t saved = body.decompressedBytes() > body.compressedBytes()
+        ? body.decompressedBytes() - body.compressedBytes() : 0;
+    LOG_WEATHER_D("%s response: %u bytes compressed, %u inflated (%u saved)", request,
+                  body.compressedBytes(), body.decompressedBytes(), saved);
 }
 
 bool Weather::isWiFiConnected() {
@@ -2,28 +2,24 @@
 #define WEATHER_H
 
 #include "../../config.h"
+#include "weather_data.h"
+#include "json_arena.h"
+#include "flatbuffer_table.h"
+#include "inflate_stream.h"
+#include "refresh_scheduler.h"
+#include "location_results.h"
+#include "weather_provider.h"
+#include "hedged_fetch.h"
 #include <ArduinoJson.h>
+#include "https_client.h"
 #include <WiFi.h>
-#include <HTTPClient.h>
 #include <Preferences.h>
 
-struct WeatherData {
-    float current_temp;
-    float feels_like;
-    int weather_code;
-    bool is_day;
-    String location_name;
-    String description;
-    
-    // Arrays for forecast data
-    float daily_high[7];
-    float daily_low[7];
-    int daily_codes[7];
-    float hourly_temps[24];
-    int hourly_codes[24];
-    int hourly_precipitation[24];
-    String hourly_times[24];
-    String daily_days[7];
+// A saved place; stored in preferences as raw bytes
+struct WeatherLocation {
+    char latitude[16];
+    char longitude[16];
+    char name[64];
 };
 
 class Weather {
@@ -34,15 +30,37 @@ public:
     // Initialization
     bool init();
     
-    // Weather data management
-    bool fetchWeatherData();
+    // Weather data management; fetching blocks on the network, so it runs on
+    // the WeatherTask rather than the UI loop. One request refreshes every
+    // favourite; a WEATHER_TIER_CURRENT fetch only updates current conditions.
+    // With hedging on, MET Norway is asked too when Open-Meteo is slow to
+    // start answering, and whichever answers first is used.
+    bool fetchWeatherData(WeatherTier tier = WEATHER_TIER_FORECAST);
+    const WeatherData& getFavouriteData(uint8_t index) const { return favourite_data[index]; }
+    bool hasFavouriteData(uint8_t index) const { return favourite_valid[index]; }
+    bool hasAllFavouriteData() const;
+    // A forecast for the active location fetched by another unit on the LAN
+    void commitSharedForecast(const WeatherData& data, WeatherTier tier);
+    // Blocks on the network; LocationSearch calls it from its own task.
+    // Returns false without results if cancel fires first.
+    bool searchLocations(const String& query, LocationResults& results,
+                         const LocationSearchToken* cancel = nullptr);
+    
+    // Favourite locations. The active one is what the UI shows; switching to
+    // another only changes the index, its data is already here. Once the
+    // WeatherTask runs, only it may call these.
     bool updateLocation(const String& lat, const String& lon, const String& locationName);
-    bool searchLocations(const String& query, JsonArray& results);
+    bool addFavourite(const String& lat, const String& lon, const String& locationName);
+    bool removeFavourite(uint8_t index);
+    bool selectFavourite(uint8_t index);
+    uint8_t getFavouriteCount() const { return favourite_count; }
+    uint8_t getActiveFavourite() const { return active_favourite; }
+    const WeatherLocation& getFavourite(uint8_t index) const { return favourites[index]; }
     
     // Data access
-    const WeatherData& getCurrentWeather() const { return currentWeather; }
     bool isDataValid() const { return dataValid; }
     unsigned long getLastUpdateTime() const { return lastUpdateTime; }
+    uint32_t getLastTransferBytes() const { return lastTransferBytes; }
     
     // Settings management
     void loadSettings();
@@ -50,37 +68,104 @@ public:
     void setTemperatureUnit(bool fahrenheit) { use_fahrenheit = fahrenheit; }
     void setTimeFormat(bool hour24) { use_24_hour = hour24; }
     void setLanguage(Language lang) { current_language = lang; }
+    void setWireFormat(WeatherWireFormat format) { wire_format = format; }
+    WeatherWireFormat getWireFormat() const { return wire_format; }
+    void setLanSharing(bool enabled, float radiusKm) {
+        lan_sharing = enabled;
+        lan_radius_km = radiusKm;
+    }
+    bool getLanSharing() const { return lan_sharing; }
+    float getLanRadius() const { return lan_radius_km; }
+    void setHedgedFetch(bool enabled) { hedged_fetch = enabled; }
+    bool getHedgedFetch() const { return hedged_fetch; }
+    const OpenMeteoProvider& getPrimaryProvider() const { return openMeteo; }
+    const MetNorwayProvider& getSecondaryProvider() const { return metNorway; }
     
-    // Location management
-    String getLatitude() const { return String(latitude); }
-    String getLongitude() const { return String(longitude); }
-    String getLocationName() const { return location; }
+    // Active location
+    String getLatitude() const { return String(favourites[active_favourite].latitude); }
+    String getLongitude() const { return String(favourites[active_favourite].longitude); }
+    String getLocationName() const { return String(favourites[active_favourite].name); }
+    
+    // Parsing (public so benchmarks can feed recorded responses). The batch
+    // parsers read one forecast per favourite and commit each as it completes.
+    bool parseWeatherBatchStream(Stream& input, WeatherTier tier);
+    bool parseWeatherFlatBufferBatchStream(Stream& input, WeatherTier tier);
+    bool parseWeatherStream(Stream& input, WeatherData& data);
+    bool parseWeatherDocument(JsonDocument& doc, WeatherData& data);
+    bool parseWeatherFlatBufferStream(Stream& input, WeatherData& data);
+    bool parseWeatherFlatBuffer(const uint8_t* buffer, size_t length, WeatherData& data);
+    bool parseMetNorwayStream(Stream& input, uint8_t favourite, WeatherTier tier);
+    bool parseLocationStream(Stream& input, LocationResults& results);
+    const JsonArena& getJsonArena() const { return jsonArena; }
     
 private:
-    WeatherData currentWeather;
     bool dataValid;
     unsigned long lastUpdateTime;
+    uint32_t lastTransferBytes;
+    
+    // Parse arena (also holds FlatBuffers bodies and geocoding results) and
+    // the filters that keep only the JSON fields we copy out. Reused for
+    // every parse instead of a per-fetch heap document; each instance has its
+    // own, so the on-device tests never touch the live one.
+    alignas(8) uint8_t jsonArenaBuffer[WEATHER_JSON_ARENA_SIZE];
+    JsonArena jsonArena;
+    JsonDocument weatherFilter;
+    JsonDocument metNorwayFilter;
+    JsonDocument locationFilter;
+    
+    // Forecast providers and the geocoding API, each on its own persistent
+    // connection, serialised so a location search from the UI never
+    // interleaves with a fetch
+    OpenMeteoProvider openMeteo;
+    MetNorwayProvider metNorway;
+    HedgedFetch hedge;
+    HttpsClient geocodingClient;
+    SemaphoreHandle_t requestMutex;
     
     // Settings storage
     Preferences prefs;
     
-    // Location and settings
-    char latitude[16];
-    char longitude[16];
-    String location;
+    // Favourites and the last good forecast for each, in the same order
+    WeatherLocation favourites[WEATHER_MAX_FAVOURITES];
+    WeatherData favourite_data[WEATHER_MAX_FAVOURITES];
+    bool favourite_valid[WEATHER_MAX_FAVOURITES];
+    uint8_t favourite_count;
+    uint8_t active_favourite;
+    
+    // Each location is parsed here first, so a failed parse never leaves a
+    // half-updated favourite behind
+    WeatherData parse_scratch;
+    
+    // Settings
     bool use_fahrenheit;
     bool use_24_hour;
     Language current_language;
+    WeatherWireFormat wire_format;
+    bool lan_sharing;
+    float lan_radius_km;
+    bool hedged_fetch;
     
     // Helper methods
-    bool parseWeatherResponse(const String& response);
-    String buildWeatherApiUrl();
-    String buildGeocodingUrl(const String& query);
+    bool raceForecast(WeatherTier tier);
+    bool requestForecast(WeatherProvider& provider, WeatherTier tier, uint8_t first = 0);
+    bool readForecast(WeatherProvider& provider, uint8_t request, WeatherTier tier);
+    void commitFavourite(uint8_t index, const WeatherData& data, WeatherTier tier);
+    void setFavourite(uint8_t index, const String& lat, const String& lon,
+                      const String& locationName);
+    void saveFavourites();
+    void buildWeatherFilter();
+    void parseFlatBufferCurrent(const FlatTable& current, WeatherData& data);
+    void parseFlatBufferDaily(const FlatTable& daily, WeatherData& data);
+    void parseFlatBufferHourly(const FlatTable& hourly, WeatherData& data);
+    bool parseMetNorwaySeries(Stream& input, WeatherData& data, WeatherTier tier);
+    void summariseDays(WeatherData& data);
+    String buildGeocodingPath(const String& query);
     void updateTimeAndLocation();
     int mapWeatherCode(int openMeteoCode);
     
     // Network helpers
-    String makeHttpRequest(const String& url);
+    bool beginRequest(HttpsClient& client, const String& path);
+    void logTransferSize(const char* request, const InflateStream& body);
     bool isWiFiConnected();
 };
 
@@ -0,0 +1,87 @@
+#ifndef WEATHER_DATA_H
+#define WEATHER_DATA_H
+
+#include <Arduino.h>
+#include <type_traits>
+
+// Temperatures are stored as tenths of a degree Celsius
+#define WEATHER_TEMP_SCALE 10
+
+// Hourly entries kept: the 7 days the API returns
+#define WEATHER_HOURLY_CAPACITY 168
+#define WEATHER_HOURLY_STEP 3600
+
+// One forecast snapshot, as parsed by Weather and rendered by UI. Fixed
+// layout with no heap members, so a refresh reuses the same storage and a
+// snapshot can be copied or persisted with memcpy.
+struct WeatherData {
+    int16_t current_temp;
+    int16_t feels_like;
+    uint8_t weather_code;
+    bool is_day;
+    char location_name[64];
+
+    // Times are Unix seconds; add utc_offset for the location's local time
+    int32_t utc_offset;
+    uint32_t daily_times[7];
+    int16_t daily_high[7];
+    int16_t daily_low[7];
+    uint8_t daily_codes[7];
+
+    // One entry per hour from hourly_start; the UI picks the window from
+    // the clock, so it keeps advancing between fetches
+    uint32_t hourly_start;
+    uint16_t hourly_count;
+    int16_t hourly_temps[WEATHER_HOURLY_CAPACITY];
+    uint8_t hourly_codes[WEATHER_HOURLY_CAPACITY];
+    uint8_t hourly_precipitation[WEATHER_HOURLY_CAPACITY];
+
+    // Unix time of the fetch (0 if the clock was not set yet), and whether
+    // this copy was restored from flash rather than freshly fetched
+    uint32_t fetched_at;
+    bool stale;
+};
+
+static_assert(std::is_trivially_copyable<WeatherData>::value,
+              "WeatherData is copied and persisted as raw bytes");
+
+inline int16_t weatherTempFromFloat(float celsius) {
+    float scaled = celsius * WEATHER_TEMP_SCALE;
+    return (int16_t) (scaled < 0 ? scaled - 0.5f : scaled + 0.5f);
+}
+
+inline float weatherTempToFloat(int16_t temp) {
+    return (float) temp / WEATHER_TEMP_SCALE;
+}
+
+// Local day of week (0 = Sunday) and hour for a forecast time
+inline uint8_t weatherWeekday(uint32_t time, int32_t utcOffset) {
+    int64_t days = ((int64_t) time + utcOffset) / 86400;
+    return (uint8_t) ((days + 4) % 7);  // 1970-01-01 was a Thursday
+}
+
+inline uint8_t weatherHour(uint32_t time, int32_t utcOffset) {
+    return (uint8_t) ((((int64_t) time + utcOffset) % 86400) / 3600);
+}
+
+inline uint32_t weatherHourlyTime(const WeatherData& data, int index) {
+    return data.hourly_start + (uint32_t) index * WEATHER_HOURLY_STEP;
+}
+
+// Index of the hourly entry covering time: -1 before the series, hourly_count
+// or more after it
+inline int weatherHourlyIndex(const WeatherData& data, uint32_t time) {
+    if (time < data.hourly_start) {
+        return -1;
+    }
+    return (int) ((time - data.hourly_start) / WEATHER_HOURLY_STEP);
+}
+
+// First of `rows` entries to show at time: the hour covering it, held inside
+// the series so the window never runs off either end
+inline int weatherHourlyWindow(const WeatherData& data, uint32_t time, int rows) {
+    int index = min(weatherHourlyIndex(data, time), (int) data.hourly_count - rows);
+    return index < 0 ? 0 : index;
+}
+
+#endif // WEATHER_DATA_H
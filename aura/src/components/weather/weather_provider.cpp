@@ -0,0 +1,60 @@
+#include "weather_provider.h"
+#include "weather.h"
+
+OpenMeteoProvider::OpenMeteoProvider()
+    : WeatherProvider("Open-Meteo", WEATHER_API_HOST), format_(WIRE_FORMAT_JSON) {}
+
+String OpenMeteoProvider::path(const Weather& weather, uint8_t, WeatherTier tier) const {
+    String url = "/v1/forecast";
+
+    // Every favourite in one request; the response lists them in this order
+    url += "?latitude=";
+    for (uint8_t i = 0; i < weather.getFavouriteCount(); i++) {
+        url += i ? "," : "";
+        url += weather.getFavourite(i).latitude;
+    }
+    url += "&longitude=";
+    for (uint8_t i = 0; i < weather.getFavouriteCount(); i++) {
+        url += i ? "," : "";
+        url += weather.getFavourite(i).longitude;
+    }
+    url += "&current=temperature_2m,apparent_temperature,is_day,weather_code";
+    if (tier == WEATHER_TIER_FORECAST) {
+        url += "&daily=temperature_2m_max,temperature_2m_min,weather_code";
+        url += "&hourly=temperature_2m,weather_code,precipitation_probability";
+        url += "&forecast_days=7";
+    }
+    url += "&timezone=auto";
+    url += "&timeformat=unixtime";
+    if (format_ == WIRE_FORMAT_FLATBUFFERS) {
+        url += "&format=flatbuffers";
+    }
+
+    return url;
+}
+
+bool OpenMeteoProvider::parse(Weather& weather, Stream& body, uint8_t, WeatherTier tier) {
+    if (format_ == WIRE_FORMAT_FLATBUFFERS) {
+        return weather.parseWeatherFlatBufferBatchStream(body, tier);
+    }
+    return weather.parseWeatherBatchStream(body, tier);
+}
+
+MetNorwayProvider::MetNorwayProvider() : WeatherProvider("MET Norway", MET_NORWAY_API_HOST) {}
+
+uint8_t MetNorwayProvider::requestCount(const Weather& weather) const {
+    return weather.getFavouriteCount();
+}
+
+String MetNorwayProvider::path(const Weather& weather, uint8_t request, WeatherTier) const {
+    // There is no current-only variant; a current poll reads the first entry
+    const WeatherLocation& location = weather.getFavourite(request);
+    char url[96];
+    snprintf(url, sizeof(url), "/weatherapi/locationforecast/2.0/compact?lat=%.4f&lon=%.4f",
+             atof(location.latitude), atof(location.longitude));
+    return String(url);
+}
+
+bool MetNorwayProvider::parse(Weather& weather, Stream& body, uint8_t request, WeatherTier tier) {
+    return weather.parseMetNorwayStream(body, request, tier);
+}
@@ -0,0 +1,67 @@
+#ifndef WEATHER_PROVIDER_H
+#define WEATHER_PROVIDER_H
+
+#include "../../config.h"
+#include "hedged_fetch.h"
+#include "https_client.h"
+#include "refresh_scheduler.h"
+
+class Weather;
+
+// Forecast encodings Open-Meteo can return
+enum WeatherWireFormat { WIRE_FORMAT_JSON = 0, WIRE_FORMAT_FLATBUFFERS = 1 };
+
+// A forecast service Weather can fetch from. A fetch is one or more GETs on
+// the provider's own kept-alive connection; Weather sends them, checks the
+// status and inflates the body, and the provider only says what to ask for
+// and which parser reads the answer. Each provider keeps its own time to
+// first byte, which sets the hedging threshold when it is the primary.
+class WeatherProvider {
+public:
+    WeatherProvider(const char* name, const char* host) : name_(name), client_(host) {}
+    virtual ~WeatherProvider() {}
+
+    virtual uint8_t requestCount(const Weather& weather) const = 0;
+    virtual String path(const Weather& weather, uint8_t request, WeatherTier tier) const = 0;
+    // Parses one response and commits the favourites it covers
+    virtual bool parse(Weather& weather, Stream& body, uint8_t request, WeatherTier tier) = 0;
+
+    const char* name() const { return name_; }
+    HttpsClient& client() { return client_; }
+    LatencyHistogram& latency() { return latency_; }
+
+private:
+    const char* name_;
+    HttpsClient client_;
+    LatencyHistogram latency_;
+};
+
+// Open-Meteo: every favourite in one request, as JSON or FlatBuffers
+class OpenMeteoProvider : public WeatherProvider {
+public:
+    OpenMeteoProvider();
+
+    void setFormat(WeatherWireFormat format) { format_ = format; }
+    WeatherWireFormat format() const { return format_; }
+
+    uint8_t requestCount(const Weather&) const override { return 1; }
+    String path(const Weather& weather, uint8_t request, WeatherTier tier) const override;
+    bool parse(Weather& weather, Stream& body, uint8_t request, WeatherTier tier) override;
+
+private:
+    WeatherWireFormat format_;
+};
+
+// MET Norway locationforecast (compact). It answers for a single point, so
+// each favourite is its own request on the same connection. Its terms ask
+// for coordinates of at most four decimals and an identifying User-Agent.
+class MetNorwayProvider : public WeatherProvider {
+public:
+    MetNorwayProvider();
+
+    uint8_t requestCount(const Weather& weather) const override;
+    String path(const Weather& weather, uint8_t request, WeatherTier tier) const override;
+    bool parse(Weather& weather, Stream& body, uint8_t request, WeatherTier tier) override;
+};
+
+#endif // WEATHER_PROVIDER_H
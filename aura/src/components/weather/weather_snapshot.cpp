@@ -0,0 +1,103 @@
+#include "weather_snapshot.h"
+#include "../logging/logging.h"
+#include "esp32/rom/crc.h"
+
+static const char* SNAPSHOT_NAMESPACE = "aura_cache";
+static const char* SNAPSHOT_KEY = "forecast";
+
+struct SnapshotHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t length;
+    uint32_t crc;
+};
+static_assert(sizeof(SnapshotHeader) == WeatherSnapshot::HEADER_SIZE, "Snapshot header is packed");
+
+size_t WeatherSnapshot::encode(const WeatherData& data, uint8_t* buffer, size_t capacity) {
+    if (capacity < MAX_SIZE) {
+        return 0;
+    }
+
+    SnapshotHeader header;
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.length = sizeof(WeatherData);
+    header.crc = crc32_le(0, (const uint8_t*) &data, sizeof(WeatherData));
+    memcpy(buffer, &header, HEADER_SIZE);
+    memcpy(buffer + HEADER_SIZE, &data, sizeof(WeatherData));
+    return MAX_SIZE;
+}
+
+bool WeatherSnapshot::decode(const uint8_t* buffer, size_t length, WeatherData& data) {
+    if (length < HEADER_SIZE) {
+        LOG_WEATHER_W("Forecast snapshot truncated to %u bytes", length);
+        return false;
+    }
+    SnapshotHeader header;
+    memcpy(&header, buffer, HEADER_SIZE);
+    if (header.magic != MAGIC) {
+        LOG_WEATHER_W("Forecast snapshot has no valid header");
+        return false;
+    }
+    if (header.version != VERSION) {
+        LOG_WEATHER_W("Forecast snapshot is version %u, expected %u", header.version, VERSION);
+        return false;
+    }
+    if (header.length != sizeof(WeatherData) || length != MAX_SIZE ||
+        crc32_le(0, buffer + HEADER_SIZE, header.length) != header.crc) {
+        LOG_WEATHER_W("Forecast snapshot failed its length or CRC check");
+        return false;
+    }
+
+    memcpy(&data, buffer + HEADER_SIZE, sizeof(WeatherData));
+    data.stale = true;
+    return true;
+}
+
+WeatherSnapshot::WeatherSnapshot() : opened_(false) {}
+
+WeatherSnapshot::~WeatherSnapshot() {
+    if (opened_) {
+        prefs_.end();
+    }
+}
+
+bool WeatherSnapshot::open() {
+    if (!opened_) {
+        opened_ = prefs_.begin(SNAPSHOT_NAMESPACE, false);
+        if (!opened_) {
+            LOG_WEATHER_E("Failed to open forecast snapshot storage");
+        }
+    }
+    return opened_;
+}
+
+bool WeatherSnapshot::save(const WeatherData& data) {
+    uint8_t buffer[MAX_SIZE];
+    size_t length = encode(data, buffer, sizeof(buffer));
+    if (!open() || prefs_.putBytes(SNAPSHOT_KEY, buffer, length) != length) {
+        LOG_WEATHER_E("Failed to write forecast snapshot");
+        return false;
+    }
+    LOG_WEATHER_D("Forecast snapshot saved (%u bytes)", length);
+    return true;
+}
+
+bool WeatherSnapshot::load(WeatherData& data) {
+    if (!open()) {
+        return false;
+    }
+    size_t length = prefs_.getBytesLength(SNAPSHOT_KEY);
+    if (length == 0 || length > MAX_SIZE) {
+        LOG_WEATHER_I("No forecast snapshot stored");
+        return false;
+    }
+
+    uint8_t buffer[MAX_SIZE];
+    if (prefs_.getBytes(SNAPSHOT_KEY, buffer, length) != length || !decode(buffer, length, data)) {
+        return false;
+    }
+    LOG_WEATHER_I("Restored forecast snapshot for %s (%u bytes)", data.location_name,
+                  length);
+    return true;
+}
@@ -0,0 +1,43 @@
+#ifndef WEATHER_SNAPSHOT_H
+#define WEATHER_SNAPSHOT_H
+
+#include "../../config.h"
+#include "weather_data.h"
+#include <Arduino.h>
+#include <Preferences.h>
+
+// Last good forecast kept in NVS so the main screen can show real (stale)
+// data straight after boot, before WiFi and the first fetch.
+//
+// Blob layout, all little-endian:
+//   magic u32 | version u16 | payload length u16 | crc32 u32 | payload
+// The payload is the WeatherData struct exactly as it sits in memory, so any
+// change to WeatherData must bump VERSION. The CRC covers the payload. A blob
+// with another magic, version, length or CRC is rejected rather than
+// partially restored.
+class WeatherSnapshot {
+public:
+    static constexpr uint32_t MAGIC = 0x53575541;  // "AUWS"
+    static constexpr uint16_t VERSION = 3;
+    static constexpr size_t HEADER_SIZE = 12;
+    static constexpr size_t MAX_SIZE = HEADER_SIZE + sizeof(WeatherData);
+
+    // Serialises data into buffer; returns the blob size, or 0 if it does not fit
+    static size_t encode(const WeatherData& data, uint8_t* buffer, size_t capacity);
+    // Restores data from a blob; marks it stale. Leaves data untouched on failure.
+    static bool decode(const uint8_t* buffer, size_t length, WeatherData& data);
+
+    WeatherSnapshot();
+    ~WeatherSnapshot();
+
+    bool save(const WeatherData& data);
+    bool load(WeatherData& data);
+
+private:
+    Preferences prefs_;
+    bool opened_;
+
+    bool open();
+};
+
+#endif // WEATHER_SNAPSHOT_H
@@ -0,0 +1,307 @@
+#include "weather_task.h"
+#include "../logging/logging.h"
+
+WeatherTask::WeatherTask(Weather& weather)
+    : weather_(weather), handle_(nullptr), buffers_(), back_(0), front_(1), middle_(2),
+      sequence_(0),
+      location_queue_(xQueueCreate(LOCATION_QUEUE_LENGTH, sizeof(LocationCommand))),
+      lan_leader_(0), lan_waiting_(false), lan_wait_start_(0), manual_pending_(false),
+      lan_buffer_() {}
+
+bool WeatherTask::restoreSnapshot() {
+    if (handle_ || !snapshot_.load(buffers_[back_])) {
+        return false;
+    }
+    publish();
+    return true;
+}
+
+bool WeatherTask::start() {
+    if (handle_) {
+        return true;
+    }
+
+    BaseType_t created = xTaskCreatePinnedToCore(taskEntry, "weather", WEATHER_TASK_STACK_SIZE,
+                                                 this, WEATHER_TASK_PRIORITY, &handle_,
+                                                 WEATHER_TASK_CORE);
+    if (created != pdPASS) {
+        LOG_WEATHER_E("Failed to create weather task");
+        handle_ = nullptr;
+        return false;
+    }
+
+    LOG_WEATHER_I("Weather task started on core %d (%u byte stack)", WEATHER_TASK_CORE,
+                  WEATHER_TASK_STACK_SIZE);
+    return true;
+}
+
+void WeatherTask::requestRefresh() {
+    notify(WEATHER_REFRESH_MANUAL);
+}
+
+void WeatherTask::requestLocation(const String& lat, const String& lon, const String& locationName) {
+    queueLocationCommand(LOCATION_REPLACE, 0, lat, lon, locationName);
+}
+
+void WeatherTask::requestAddFavourite(const String& lat, const String& lon,
+                                      const String& locationName) {
+    queueLocationCommand(LOCATION_ADD, 0, lat, lon, locationName);
+}
+
+void WeatherTask::requestRemoveFavourite(uint8_t index) {
+    queueLocationCommand(LOCATION_REMOVE, index);
+}
+
+void WeatherTask::requestFavourite(uint8_t index) {
+    queueLocationCommand(LOCATION_SELECT, index);
+}
+
+void WeatherTask::queueLocationCommand(LocationAction action, uint8_t index, const String& lat,
+                                       const String& lon, const String& locationName) {
+    LocationCommand command = {};
+    command.action = action;
+    command.index = index;
+    strlcpy(command.location.latitude, lat.c_str(), sizeof(command.location.latitude));
+    strlcpy(command.location.longitude, lon.c_str(), sizeof(command.location.longitude));
+    strlcpy(command.location.name, locationName.c_str(), sizeof(command.location.name));
+    if (xQueueSend(location_queue_, &command, 0) != pdTRUE) {
+        LOG_WEATHER_W("Too many location changes pending, dropping one");
+        return;
+    }
+    notify(WEATHER_REFRESH_LOCATION);
+}
+
+const WeatherData* WeatherTask::takeUpdate() {
+    if (!(middle_.load(std::memory_order_acquire) & BUFFER_FRESH)) {
+        return nullptr;
+    }
+    front_ = middle_.exchange(front_, std::memory_order_acq_rel) & BUFFER_INDEX_MASK;
+    return &buffers_[front_];
+}
+
+void WeatherTask::taskEntry(void* parameter) {
+    static_cast<WeatherTask*>(parameter)->run();
+}
+
+void WeatherTask::run() {
+    // Both tiers start out due, so the first pass pulls the full forecast;
+    // changes queued before start() are picked up here too
+    applyLocationCommands();
+    for (;;) {
+        uint32_t reasons = 0;
+        uint32_t wait_ms = scheduler_.msUntilNextDue(millis());
+        if (weather_.getLanSharing()) {
+            // The LAN is polled between fetches, and more often than a due
+            // fetch that is waiting for the leader would otherwise allow
+            wait_ms = lan_waiting_ ? LAN_SHARE_POLL_MS : min(wait_ms, (uint32_t) LAN_SHARE_POLL_MS);
+        }
+        if (xTaskNotifyWait(0, ULONG_MAX, &reasons, pdMS_TO_TICKS(wait_ms)) == pdTRUE) {
+            handleRequests(reasons);
+        }
+        pollLan();
+
+        WeatherTier tier;
+        if (!scheduler_.nextDue(millis(), tier) || waitForLeader()) {
+            continue;
+        }
+        manual_pending_ = false;
+        LOG_WEATHER_D("%s refresh (reasons 0x%x)", RefreshScheduler::tierName(tier), reasons);
+
+        // Current conditions are merged into each favourite's last forecast,
+        // so a favourite without one needs the full request
+        if (!weather_.hasAllFavouriteData()) {
+            tier = WEATHER_TIER_FORECAST;
+        }
+
+        unsigned long start = millis();
+        bool success = weather_.fetchWeatherData(tier);
+        uint32_t bytes = weather_.getLastTransferBytes();
+
+        if (success) {
+            scheduler_.markSuccess(tier, millis(), time(nullptr), bytes);
+            publishActive(tier == WEATHER_TIER_FORECAST);
+            shareForecast(tier);
+            LOG_WEATHER_I("Weather snapshot %u published after %lu ms", getPublishedCount(),
+                          millis() - start);
+        } else {
+            scheduler_.markFailure(tier, millis(), bytes);
+        }
+        scheduler_.logStats(tier);
+
+        // Scheduled or manual triggers that arrived meanwhile were served by
+        // the fetch that just finished; location changes still apply
+        uint32_t late = 0;
+        if (xTaskNotifyWait(0, ULONG_MAX, &late, 0) == pdTRUE) {
+            handleRequests(late & ~WEATHER_REFRESH_MANUAL);
+        }
+    }
+}
+
+void WeatherTask::handleRequests(uint32_t reasons) {
+    if (reasons & WEATHER_REFRESH_LOCATION) {
+        applyLocationCommands();
+    }
+    if (reasons & WEATHER_REFRESH_MANUAL) {
+        scheduler_.requestAll(millis());
+        manual_pending_ = true;
+    }
+}
+
+void WeatherTask::applyLocationCommands() {
+    // Weather writes preferences to flash here, so this never runs in the UI task
+    LocationCommand command;
+    bool changed = false;
+    while (xQueueReceive(location_queue_, &command, 0) == pdTRUE) {
+        const WeatherLocation& location = command.location;
+        switch (command.action) {
+            case LOCATION_REPLACE:
+                weather_.updateLocation(location.latitude, location.longitude, location.name);
+                break;
+            case LOCATION_ADD:
+                weather_.addFavourite(location.latitude, location.longitude, location.name);
+                break;
+            case LOCATION_REMOVE:
+                weather_.removeFavourite(command.index);
+                break;
+            case LOCATION_SELECT:
+                weather_.selectFavourite(command.index);
+                break;
+        }
+        changed = true;
+    }
+    if (!changed) {
+        return;
+    }
+    updateLanPosition();
+
+    // A favourite that already has a forecast shows at once; new ones are
+    // fetched, together with all the others
+    if (weather_.hasFavouriteData(weather_.getActiveFavourite())) {
+        publishActive(false);
+        LOG_WEATHER_I("Showing favourite %u of %u without a fetch",
+                      weather_.getActiveFavourite() + 1, weather_.getFavouriteCount());
+    }
+    if (!weather_.hasAllFavouriteData()) {
+        scheduler_.requestAll(millis());
+    }
+}
+
+void WeatherTask::publishActive(bool persist) {
+    uint32_t published = back_;
+    buffers_[back_] = weather_.getFavouriteData(weather_.getActiveFavourite());
+    publish();
+    if (!persist) {
+        return;
+    }
+
+    // Saved after publishing so the flash write never delays the UI;
+    // until the next publish both sides only read this buffer
+    snapshot_.save(buffers_[published]);
+}
+
+void WeatherTask::startLanSharing() {
+    // The NIC-specific bytes of the MAC tell units apart; the lowest leads
+    uint32_t node = (uint32_t) (ESP.getEfuseMac() >> 16);
+    if (!lan_.begin(node, LAN_SHARE_GROUP, LAN_SHARE_PORT, millis())) {
+        LOG_WEATHER_E("LAN sharing could not join %s:%u", LAN_SHARE_GROUP, LAN_SHARE_PORT);
+        return;
+    }
+    lan_.setRadius(weather_.getLanRadius());
+    updateLanPosition();
+    LOG_WEATHER_I("LAN sharing on as %08x within %.1f km", node, weather_.getLanRadius());
+}
+
+void WeatherTask::updateLanPosition() {
+    const WeatherLocation& location = weather_.getFavourite(weather_.getActiveFavourite());
+    lan_.setPosition(atof(location.latitude), atof(location.longitude));
+}
+
+void WeatherTask::pollLan() {
+    if (!weather_.getLanSharing()) {
+        return;
+    }
+    // Multicast membership needs the interface up
+    if (!lan_.isOpen()) {
+        if (!WiFi.isConnected()) {
+            return;
+        }
+        startLanSharing();
+    }
+
+    uint32_t now = millis();
+    bool received = lan_.poll(now);
+    uint32_t leader = lan_.leader(now);
+    if (leader != lan_leader_) {
+        lan_leader_ = leader;
+        if (leader == lan_.node()) {
+            LOG_WEATHER_I("No lower LAN peer heard, fetching for the group");
+        } else {
+            LOG_WEATHER_I("Following LAN leader %08x", leader);
+        }
+    }
+    if (!received) {
+        return;
+    }
+
+    // The back buffer is free between fetches, so it doubles as scratch
+    size_t length;
+    uint8_t tier;
+    const uint8_t* blob = lan_.forecast(length, tier);
+    if (tier >= WEATHER_TIER_COUNT || !WeatherSnapshot::decode(blob, length, buffers_[back_])) {
+        LOG_WEATHER_W("Ignoring a forecast from LAN leader %08x that does not decode", leader);
+        return;
+    }
+    weather_.commitSharedForecast(buffers_[back_], (WeatherTier) tier);
+    scheduler_.markSuccess((WeatherTier) tier, now, time(nullptr), length);
+    lan_waiting_ = false;
+    publishActive(tier == WEATHER_TIER_FORECAST);
+    LOG_WEATHER_I("%s from LAN leader %08x published",
+                  RefreshScheduler::tierName((WeatherTier) tier), leader);
+}
+
+bool WeatherTask::waitForLeader() {
+    // A follower leaves due fetches to the leader, but only for so long
+    uint32_t now = millis();
+    if (!lan_.isOpen() || lan_.isLeader(now) || manual_pending_) {
+        lan_waiting_ = false;
+        return false;
+    }
+    if (!lan_waiting_) {
+        lan_waiting_ = true;
+        lan_wait_start_ = now;
+    }
+    if (now - lan_wait_start_ < LAN_SHARE_FALLBACK_MS) {
+        return true;
+    }
+    LOG_WEATHER_W("Nothing from LAN leader %08x in %lu s, fetching ourselves", lan_.leader(now),
+                  LAN_SHARE_FALLBACK_MS / 1000);
+    lan_waiting_ = false;
+    return false;
+}
+
+void WeatherTask::shareForecast(WeatherTier tier) {
+    if (!lan_.isOpen() || !lan_.isLeader(millis())) {
+        return;
+    }
+    const WeatherData& data = weather_.getFavouriteData(weather_.getActiveFavourite());
+    size_t length = WeatherSnapshot::encode(data, lan_buffer_, sizeof(lan_buffer_));
+    if (!length || !lan_.share(tier, lan_buffer_, length)) {
+        LOG_WEATHER_W("Sharing the forecast on the LAN failed");
+    }
+}
+
+void WeatherTask::publish() {
+    uint32_t previous = middle_.exchange(back_ | BUFFER_FRESH, std::memory_order_acq_rel);
+    back_ = previous & BUFFER_INDEX_MASK;
+    sequence_.fetch_add(1, std::memory_order_release);
+}
+
+void WeatherTask::notify(WeatherRefreshReason reason) {
+    // Nothing is lost before start(): the first pass applies queued
+    // location changes and fetches every tier anyway
+    if (!handle_) {
+        LOG_WEATHER_D("Weather task not started yet, its first fetch covers this request");
+        return;
+    }
+    xTaskNotify(handle_, reason, eSetBits);
+}
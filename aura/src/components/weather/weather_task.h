@@ -0,0 +1,125 @@
+#ifndef WEATHER_TASK_H
+#define WEATHER_TASK_H
+
+#include "../../config.h"
+#include "weather.h"
+#include "weather_data.h"
+#include "weather_snapshot.h"
+#include "refresh_scheduler.h"
+#include "lan_share.h"
+#include <Arduino.h>
+#include <atomic>
+
+// Why a fetch was requested outside the schedule; bits of the task
+// notification value, so triggers that arrive while one is pending collapse
+// into a single fetch
+enum WeatherRefreshReason : uint32_t {
+    WEATHER_REFRESH_LOCATION = 1 << 0,
+    WEATHER_REFRESH_MANUAL = 1 << 1,
+};
+
+// Runs Weather::fetchWeatherData on its own FreeRTOS task so DNS, TLS and
+// parsing never stall lv_timer_handler in loop(). A RefreshScheduler picks
+// between cheap current-conditions polls and full forecast pulls; each fetch
+// refreshes every favourite and publishes the active one. Location changes
+// from the UI are queued and applied by the task between fetches, so Weather
+// is only ever touched from here.
+//
+// Snapshots are handed to the UI through three WeatherData buffers: the task
+// parses into its back buffer, then publishes it by atomically swapping it
+// with the shared middle slot. The UI swaps the middle slot for its front
+// buffer when it sees the fresh flag. Neither side ever waits for the other,
+// and the UI always reads a complete snapshot, never a half-parsed one.
+//
+// With the "lan_share" setting on, units showing the same place elect a
+// leader over UDP multicast (see LanShare). Only the leader fetches; it
+// multicasts each result as a snapshot blob and the others publish that
+// instead. A follower whose fetch falls due waits LAN_SHARE_FALLBACK_MS for
+// the leader before fetching itself, and stops following once the leader
+// goes silent. A manual refresh always fetches.
+class WeatherTask {
+public:
+    explicit WeatherTask(Weather& weather);
+
+    // Publishes the forecast saved by the last good fetch, marked stale, so
+    // the UI has real data before WiFi is up. Call before start().
+    bool restoreSnapshot();
+    bool start();
+
+    // Safe to call from the UI task; all return immediately
+    void requestRefresh();
+    // Replaces the active favourite
+    void requestLocation(const String& lat, const String& lon, const String& locationName);
+    void requestAddFavourite(const String& lat, const String& lon, const String& locationName);
+    void requestRemoveFavourite(uint8_t index);
+    // Shows another favourite from its last forecast, without a fetch
+    void requestFavourite(uint8_t index);
+
+    // UI side: the newest snapshot if one was published since the last call,
+    // otherwise nullptr. The pointer stays valid until the next call.
+    const WeatherData* takeUpdate();
+
+    uint32_t getPublishedCount() const { return sequence_.load(std::memory_order_acquire); }
+    // Tier intervals can be changed before start(); stats are for logging
+    RefreshScheduler& getScheduler() { return scheduler_; }
+    bool isRunning() const { return handle_ != nullptr; }
+
+private:
+    static constexpr uint32_t BUFFER_INDEX_MASK = 0x3;
+    static constexpr uint32_t BUFFER_FRESH = 0x4;
+    static constexpr UBaseType_t LOCATION_QUEUE_LENGTH = 4;
+
+    enum LocationAction : uint8_t {
+        LOCATION_REPLACE,
+        LOCATION_ADD,
+        LOCATION_REMOVE,
+        LOCATION_SELECT,
+    };
+    struct LocationCommand {
+        LocationAction action;
+        uint8_t index;
+        WeatherLocation location;
+    };
+
+    Weather& weather_;
+    TaskHandle_t handle_;
+
+    // Triple buffer: back_ belongs to the task, front_ to the UI
+    WeatherData buffers_[3];
+    uint32_t back_;
+    uint32_t front_;
+    std::atomic<uint32_t> middle_;
+    std::atomic<uint32_t> sequence_;
+    WeatherSnapshot snapshot_;
+    RefreshScheduler scheduler_;
+
+    // Location changes from the UI, in order
+    QueueHandle_t location_queue_;
+
+    // LAN sharing; the buffer holds the snapshot blob being shared
+    LanShare lan_;
+    uint32_t lan_leader_;
+    bool lan_waiting_;
+    uint32_t lan_wait_start_;
+    bool manual_pending_;
+    uint8_t lan_buffer_[WeatherSnapshot::MAX_SIZE];
+
+    static void taskEntry(void* parameter);
+    void run();
+    void handleRequests(uint32_t reasons);
+    void applyLocationCommands();
+    void queueLocationCommand(LocationAction action, uint8_t index, const String& lat = "",
+                              const String& lon = "", const String& locationName = "");
+    // Hands the active favourite to the UI; persist also writes it to the
+    // NVS snapshot, which is only worth the flash wear for a new forecast
+    void publishActive(bool persist);
+    void startLanSharing();
+    void updateLanPosition();
+    void pollLan();
+    bool waitForLeader();
+    void shareForecast(WeatherTier tier);
+    void publish();
+    void notify(WeatherRefreshReason reason);
+};
+
+#endif // WEATHER_TASK_H
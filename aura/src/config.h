@@ -19,6 +19,49 @@
 #define SCREEN_HEIGHT 320
 #define DRAW_BUF_SIZE (SCREEN_WIDTH * SCREEN_HEIGHT / 10 * (LV_COLOR_DEPTH / 8))
 
+// LVGL renders bands of this many lines into each of two buffers. With DMA
+// on, one band goes out over SPI while the next is rendered; taller bands
+// mean fewer transfers but more internal RAM (2 * 480 bytes per line). DMA
+// stays off until it has been measured on the device (docs/BENCHMARKS.md).
+#define DISPLAY_BUFFER_LINES 30
+#define DISPLAY_DMA 0
+// Swap each band to the panel's big-endian RGB565 once, word-wise, as it
+// leaves LVGL, instead of TFT_eSPI swapping pixel by pixel as it sends. Off
+// until measured, like DMA.
+#define DISPLAY_PANEL_BYTE_ORDER 0
+
+// Touch: the XPT2046 pen interrupt wakes a task that samples over SPI only
+// while the pen is down, filters and queues events for LVGL's input read
+#define TOUCH_TASK_STACK_SIZE (3 * 1024)
+#define TOUCH_TASK_PRIORITY 2 // Above loop(), so strokes are sampled evenly
+#define TOUCH_TASK_CORE 1
+#define TOUCH_SAMPLE_INTERVAL_MS 10
+#define TOUCH_PRESSURE_MIN 400 // XPT2046 Z below this is pen up
+#define TOUCH_IIR_WEIGHT 128 // Share of each new sample, out of 256
+#define TOUCH_QUEUE_LENGTH 32 // Power of two; about 3 LVGL reads of samples
+
+// Weather backgrounds are stored RLE-compressed and decoded on demand into
+// a cache of this many bytes; each 100x100 opaque image is 20000 decoded
+#define BACKGROUND_CACHE_BYTES (60 * 1024)
+
+// Main screen backdrop, a vertical gradient. The weather images are
+// pre-blended onto it with their top row at TODAY_IMAGE_Y, so rerun
+// `make generate/images` after changing any of these.
+#define MAIN_SCREEN_GRADIENT_TOP 0x2c5282
+#define MAIN_SCREEN_GRADIENT_BOTTOM 0x1a202c
+#define TODAY_IMAGE_Y 4
+
+// Daily and hourly forecast boxes. The icon atlas palettes are judged by
+// how the icons look over it (`make generate/icons`).
+#define FORECAST_BOX_COLOR 0x5e9bc8
+
+// Characters of the large temperature readout, pre-rendered at boot from
+// the 42 px font into an A8 sprite atlas (roughly 8 KB of heap; `make
+// bench/ui` reports the exact size). Off, so the readout stays a label,
+// until bench/ui shows the sprites drawing faster than it.
+#define TEMPERATURE_SPRITES 0
+#define TEMPERATURE_SPRITE_CHARS "0123456789-°CF"
+
 // Default Configuration Values
 #define LATITUDE_DEFAULT "51.5074"
 #define LONGITUDE_DEFAULT "-0.1278"
@@ -26,6 +69,63 @@
 #define DEFAULT_CAPTIVE_SSID "Aura"
 #define DEVICE_HOSTNAME "AuraSmartDevice"
 #define UPDATE_INTERVAL 600000UL // 10 minutes
+#define MIN_VALID_EPOCH 1577836800L // Earlier means SNTP has not set the clock
+
+// Weather parsing: statically reserved arena for the filtered forecast document
+#define WEATHER_JSON_ARENA_SIZE (24 * 1024)
+
+// API hosts, each served over its own kept-alive HTTPS connection
+#define WEATHER_API_HOST "api.open-meteo.com"
+#define GEOCODING_API_HOST "geocoding-api.open-meteo.com"
+#define HTTPS_IDLE_TIMEOUT_MS 60000UL // Reuse within a burst; refreshes are further apart
+#define HTTPS_IO_TIMEOUT_MS 10000UL
+#define HTTP_TIMING_RING_SIZE 32 // Recent requests kept for the http_timing command
+
+// Hedged forecast fetch ("hedged_fetch" setting): MET Norway is asked as
+// well once Open-Meteo has gone this percentile of its own recent time to
+// first byte without answering, and the first to answer is used. Both TLS
+// connections can be open at once while the race lasts. Off by default, as
+// WEATHER_HEDGE_DEFAULT_MS is a guess; Open-Meteo is timed either way.
+#define MET_NORWAY_API_HOST "api.met.no"
+#define WEATHER_HEDGE_PERCENTILE 0.95f
+#define WEATHER_HEDGE_MIN_MS 300
+#define WEATHER_HEDGE_MAX_MS 4000
+#define WEATHER_HEDGE_DEFAULT_MS 1500 // Until MIN_SAMPLES requests have been timed
+#define WEATHER_HEDGE_MIN_SAMPLES 8
+
+// Background fetch task, pinned to the WiFi/protocol core so LVGL keeps core 1
+#define WEATHER_TASK_STACK_SIZE (12 * 1024)
+#define WEATHER_TASK_PRIORITY 1
+#define WEATHER_TASK_CORE 0
+
+// Refresh tiers: current conditions are polled on UPDATE_INTERVAL with a small
+// request; the full daily/hourly forecast is pulled at WEATHER_FORECAST_OFFSET
+// seconds past each WEATHER_FORECAST_INTERVAL boundary, after model updates land
+#define WEATHER_CURRENT_INTERVAL UPDATE_INTERVAL
+#define WEATHER_FORECAST_INTERVAL 3600000UL // 1 hour
+#define WEATHER_FORECAST_OFFSET 900UL
+#define WEATHER_RETRY_MIN 30000UL  // First retry after a failure, doubling
+#define WEATHER_RETRY_MAX 1800000UL // Backoff cap
+
+// Favourite locations, all refreshed by one batched forecast request
+#define WEATHER_MAX_FAVOURITES 4
+
+// Type-ahead location search: results kept per query, recent queries cached,
+// typing pause before a request is sent, and the task's stack (TLS runs on it)
+#define LOCATION_SEARCH_MAX_RESULTS 8
+#define LOCATION_SEARCH_CACHE_SIZE 6
+#define LOCATION_SEARCH_DEBOUNCE_MS 300
+#define LOCATION_SEARCH_MIN_QUERY 2 // The geocoding API ignores shorter names
+#define LOCATION_SEARCH_TASK_STACK_SIZE (10 * 1024)
+
+// LAN forecast sharing, off unless the "lan_share" setting is on: units
+// within the "lan_radius" setting (km) of each other take the elected
+// leader's forecasts over UDP multicast instead of fetching their own
+#define LAN_SHARE_GROUP "239.255.42.99"
+#define LAN_SHARE_PORT 42990
+#define LAN_SHARE_RADIUS_KM 5.0f
+#define LAN_SHARE_POLL_MS 250
+#define LAN_SHARE_FALLBACK_MS 60000UL // How long a due fetch waits for the leader
 
 // Language Support
 enum Language { LANG_EN = 0, LANG_ES = 1, LANG_DE = 2, LANG_FR = 3 };
@@ -69,6 +169,15 @@ LV_FONT_DECLARE(lv_font_montserrat_latin_16);
 LV_FONT_DECLARE(lv_font_montserrat_latin_20);
 LV_FONT_DECLARE(lv_font_montserrat_latin_42);
 
+// UI_FONT(size) is the font the UI draws at that size: the subset that
+// `make generate/fonts` cuts from the fonts above, holding only the glyphs
+// ui.cpp can show, or the full fonts in a tree where it has not run
+#if __has_include("assets/fonts/subset/font_subset.h")
+#include "assets/fonts/subset/font_subset.h"
+#else
+#define UI_FONT(size) lv_font_montserrat_latin_##size
+#endif
+
 // Weather Icon Declarations
 LV_IMG_DECLARE(icon_blizzard);
 LV_IMG_DECLARE(icon_blowing_snow);
@@ -97,6 +206,34 @@ LV_IMG_DECLARE(icon_sunny);
 LV_IMG_DECLARE(icon_tornado);
 LV_IMG_DECLARE(icon_wintry_mix_rain_snow);
 
+// The same icons as 4-bit indexed slices of one atlas (tools/pack_icons.py)
+LV_IMG_DECLARE(icon_blizzard_atlas);
+LV_IMG_DECLARE(icon_blowing_snow_atlas);
+LV_IMG_DECLARE(icon_clear_night_atlas);
+LV_IMG_DECLARE(icon_cloudy_atlas);
+LV_IMG_DECLARE(icon_drizzle_atlas);
+LV_IMG_DECLARE(icon_flurries_atlas);
+LV_IMG_DECLARE(icon_haze_fog_dust_smoke_atlas);
+LV_IMG_DECLARE(icon_heavy_rain_atlas);
+LV_IMG_DECLARE(icon_heavy_snow_atlas);
+LV_IMG_DECLARE(icon_isolated_scattered_tstorms_day_atlas);
+LV_IMG_DECLARE(icon_isolated_scattered_tstorms_night_atlas);
+LV_IMG_DECLARE(icon_mostly_clear_night_atlas);
+LV_IMG_DECLARE(icon_mostly_cloudy_day_atlas);
+LV_IMG_DECLARE(icon_mostly_cloudy_night_atlas);
+LV_IMG_DECLARE(icon_mostly_sunny_atlas);
+LV_IMG_DECLARE(icon_partly_cloudy_atlas);
+LV_IMG_DECLARE(icon_partly_cloudy_night_atlas);
+LV_IMG_DECLARE(icon_scattered_showers_day_atlas);
+LV_IMG_DECLARE(icon_scattered_showers_night_atlas);
+LV_IMG_DECLARE(icon_showers_rain_atlas);
+LV_IMG_DECLARE(icon_sleet_hail_atlas);
+LV_IMG_DECLARE(icon_snow_showers_snow_atlas);
+LV_IMG_DECLARE(icon_strong_tstorms_atlas);
+LV_IMG_DECLARE(icon_sunny_atlas);
+LV_IMG_DECLARE(icon_tornado_atlas);
+LV_IMG_DECLARE(icon_wintry_mix_rain_snow_atlas);
+
 // Weather Background Image Declarations
 LV_IMG_DECLARE(image_blizzard);
 LV_IMG_DECLARE(image_blowing_snow);
@@ -125,6 +262,34 @@ LV_IMG_DECLARE(image_sunny);
 LV_IMG_DECLARE(image_tornado);
 LV_IMG_DECLARE(image_wintry_mix_rain_snow);
 
+// The same images pre-blended onto the main screen behind the today image
+LV_IMG_DECLARE(image_blizzard_opaque);
+LV_IMG_DECLARE(image_blowing_snow_opaque);
+LV_IMG_DECLARE(image_clear_night_opaque);
+LV_IMG_DECLARE(image_cloudy_opaque);
+LV_IMG_DECLARE(image_drizzle_opaque);
+LV_IMG_DECLARE(image_flurries_opaque);
+LV_IMG_DECLARE(image_haze_fog_dust_smoke_opaque);
+LV_IMG_DECLARE(image_heavy_rain_opaque);
+LV_IMG_DECLARE(image_heavy_snow_opaque);
+LV_IMG_DECLARE(image_isolated_scattered_tstorms_day_opaque);
+LV_IMG_DECLARE(image_isolated_scattered_tstorms_night_opaque);
+LV_IMG_DECLARE(image_mostly_clear_night_opaque);
+LV_IMG_DECLARE(image_mostly_cloudy_day_opaque);
+LV_IMG_DECLARE(image_mostly_cloudy_night_opaque);
+LV_IMG_DECLARE(image_mostly_sunny_opaque);
+LV_IMG_DECLARE(image_partly_cloudy_opaque);
+LV_IMG_DECLARE(image_partly_cloudy_night_opaque);
+LV_IMG_DECLARE(image_scattered_showers_day_opaque);
+LV_IMG_DECLARE(image_scattered_showers_night_opaque);
+LV_IMG_DECLARE(image_showers_rain_opaque);
+LV_IMG_DECLARE(image_sleet_hail_opaque);
+LV_IMG_DECLARE(image_snow_showers_snow_opaque);
+LV_IMG_DECLARE(image_strong_tstorms_opaque);
+LV_IMG_DECLARE(image_sunny_opaque);
+LV_IMG_DECLARE(image_tornado_opaque);
+LV_IMG_DECLARE(image_wintry_mix_rain_snow_opaque);
+
 // Global Variables (declared as extern for use in other modules)
 extern Language current_language;
 extern bool use_fahrenheit;
@@ -0,0 +1,61 @@
+// Host-side benchmark for the offline city index: lookup latency over every
+// one- and two-letter prefix and the longer prefixes of the names those
+// find, and the flash the table takes. `make bench/city-index` builds it
+// against a synthetic 20k-city table from tools/make_city_index.py, passed
+// in with -DCITY_INDEX_DATA_HEADER.
+//
+// The ESP32 runs this loop roughly 20-40x slower than a desktop core, so the
+// worst case here should stay well under 250 us for a 10 ms budget there.
+
+#include "city_index.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+int main() {
+    const CityIndex& index = CityIndex::builtin();
+
+    std::vector<std::string> prefixes;
+    for (char first = 'a'; first <= 'z'; first++) {
+        prefixes.push_back(std::string(1, first));
+        for (char second = 'a'; second <= 'z'; second++) {
+            prefixes.push_back(std::string{first, second});
+        }
+    }
+    CityMatch matches[8];
+    size_t short_prefixes = prefixes.size();
+    for (size_t i = 0; i < short_prefixes; i++) {
+        size_t found = index.search(prefixes[i].c_str(), matches, 8);
+        for (size_t m = 0; m < found; m++) {
+            std::string name = matches[m].name;
+            for (size_t length = 3; length <= name.size(); length++) {
+                prefixes.push_back(name.substr(0, length));
+            }
+        }
+    }
+
+    std::vector<double> times;
+    size_t hits = 0;
+    for (const std::string& prefix : prefixes) {
+        auto start = std::chrono::steady_clock::now();
+        size_t found = index.search(prefix.c_str(), matches, 8);
+        auto stop = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double, std::micro>(stop - start).count());
+        hits += found > 0;
+    }
+    std::sort(times.begin(), times.end());
+    double total = 0;
+    for (double time : times) {
+        total += time;
+    }
+
+    std::printf("%zu cities, %zu bytes of flash (%.1f per city)\n", index.size(),
+                index.footprint(), (double) index.footprint() / index.size());
+    std::printf("%zu lookups, %zu with matches: mean %.2f us, p50 %.2f us, p99 %.2f us, "
+                "max %.2f us\n",
+                times.size(), hits, total / times.size(), times[times.size() / 2],
+                times[times.size() * 99 / 100], times.back());
+    return 0;
+}
@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+"""
+Compress LVGL C-array images in place so LVGL's image decoder unpacks them
+on demand instead of the firmware carrying raw pixels.
+
+Each file keeps its lv_image_dsc_t; the pixel array is replaced by LVGL's
+compressed layout: a 12-byte header (method, compressed size, decompressed
+size, little-endian u32s) followed by the compressed data, and the header
+flags gain LV_IMAGE_FLAGS_COMPRESSED. Files that are already compressed are
+unpacked first, so the method can be switched by running the tool again.
+
+RLE is LVGL's own run-length format (lv_rle.c, LV_USE_RLE): a control byte
+with the top bit set copies that many literal pixels, otherwise it repeats
+the one pixel that follows. It needs nothing beyond Python. LZ4 (LV_USE_LZ4)
+packs tighter but needs `pip install lz4`.
+
+Usage: python3 tools/compress_images.py [--method rle|lz4|none] [--check] [file.c ...]
+"""
+
+import argparse
+import re
+import struct
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+DEFAULT_DIR = ROOT / "aura/src/assets/images/backgrounds"
+
+# lv_image_compress_t
+METHODS = {"none": 0, "rle": 1, "lz4": 2}
+COMPRESSED_HEADER = struct.Struct("<III")
+RLE_MAX_RUN = 127
+BYTES_PER_LINE = 15
+
+# Bytes per RLE block: one pixel of the main plane (lv_bin_decoder.c uses
+# 2 for RGB565A8, covering the alpha plane two pixels at a time)
+PIXEL_BYTES = {
+    "LV_COLOR_FORMAT_RGB565": 2,
+    "LV_COLOR_FORMAT_RGB565A8": 2,
+    "LV_COLOR_FORMAT_RGB888": 3,
+    "LV_COLOR_FORMAT_ARGB8888": 4,
+    "LV_COLOR_FORMAT_XRGB8888": 4,
+    "LV_COLOR_FORMAT_A8": 1,
+    "LV_COLOR_FORMAT_L8": 1,
+}
+
+ARRAY_RE = re.compile(r"(\w+_map\[\]\s*=\s*\{)(.*?)(\};)", re.S)
+FLAGS_RE = re.compile(r"(\.header\.flags\s*=\s*)([^,]*)(,)")
+CF_RE = re.compile(r"\.header\.cf\s*=\s*(\w+)")
+
+
+def repeat_count(data, start, block):
+    pixel = data[start:start + block]
+    count = 1
+    while (count < RLE_MAX_RUN and start + (count + 1) * block <= len(data)
+           and data[start + count * block:start + (count + 1) * block] == pixel):
+        count += 1
+    return count
+
+
+def rle_compress(data, block):
+    # Any run of two or more pixels is cheaper as a repeat (1 + block bytes
+    # against 2 * block), so literals only hold pixels that differ
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        count = repeat_count(data, i, block)
+        if count >= 2:
+            out.append(count)
+            out += data[i:i + block]
+            i += count * block
+            continue
+        end = i
+        literals = 0
+        while end < len(data) and literals < RLE_MAX_RUN and repeat_count(data, end, block) < 2:
+            end += block
+            literals += 1
+        out.append(0x80 | literals)
+        out += data[i:end]
+        i = end
+    return bytes(out)
+
+
+def rle_decompress(data, block):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        control = data[i]
+        i += 1
+        if control & 0x80:
+            size = (control & 0x7F) * block
+            out += data[i:i + size]
+            i += size
+        else:
+            out += data[i:i + block] * control
+            i += block
+    return bytes(out)
+
+
+def lz4_module():
+    try:
+        import lz4.block
+    except ImportError:
+        sys.exit("error: --method lz4 needs the lz4 package (pip install lz4)")
+    return lz4.block
+
+
+def compress(method, raw, block):
+    if method == "rle":
+        packed = rle_compress(raw, block)
+    elif method == "lz4":
+        # Raw block, as LVGL decodes with LZ4_decompress_safe()
+        packed = lz4_module().compress(raw, mode="high_compression", compression=12,
+                                       store_size=False)
+    else:
+        return raw
+    return COMPRESSED_HEADER.pack(METHODS[method], len(packed), len(raw)) + packed
+
+
+def decompress(data, block):
+    method, size, raw_size = COMPRESSED_HEADER.unpack_from(data)
+    packed = data[COMPRESSED_HEADER.size:COMPRESSED_HEADER.size + size]
+    if method == METHODS["rle"]:
+        raw = rle_decompress(packed, block)
+    elif method == METHODS["lz4"]:
+        raw = lz4_module().decompress(packed, uncompressed_size=raw_size)
+    else:
+        sys.exit(f"error: unknown compression method {method}")
+    if len(raw) != raw_size:
+        sys.exit(f"error: decompressed {len(raw)} bytes, header says {raw_size}")
+    return raw
+
+
+def format_array(data):
+    lines = ["", ""]
+    for start in range(0, len(data), BYTES_PER_LINE):
+        chunk = data[start:start + BYTES_PER_LINE]
+        lines.append("        " + " ".join(f"0x{byte:02x}," for byte in chunk))
+    lines.append("")
+    return "\n".join(lines) + "\n"
+
+
+def convert(path, method, check):
+    text = path.read_text()
+    array = ARRAY_RE.search(text)
+    flags = FLAGS_RE.search(text)
+    cf = CF_RE.search(text)
+    if not (array and flags and cf):
+        sys.exit(f"error: {path} is not an LVGL C-array image")
+    block = PIXEL_BYTES.get(cf.group(1))
+    if block is None:
+        sys.exit(f"error: {path}: no RLE block size for {cf.group(1)}")
+
+    data = bytes(int(value, 16) for value in re.findall(r"0x([0-9a-fA-F]{2})", array.group(2)))
+    compressed = "LV_IMAGE_FLAGS_COMPRESSED" in flags.group(2)
+    raw = decompress(data, block) if compressed else data
+    packed = compress(method, raw, block)
+    if method != "none" and decompress(packed, block) != raw:
+        sys.exit(f"error: {path}: {method} round trip failed")
+    if not check:
+        new_flags = re.sub(r"\s*\|\s*LV_IMAGE_FLAGS_COMPRESSED", "", flags.group(2))
+        if method != "none":
+            new_flags += " | LV_IMAGE_FLAGS_COMPRESSED"
+        text = (text[:array.start(2)] + format_array(packed) + text[array.end(2):flags.start(2)]
+                + new_flags + text[flags.end(2):])
+        path.write_text(text)
+    return len(data), len(raw), len(packed)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--method", choices=METHODS, default="rle")
+    parser.add_argument("--check", action="store_true",
+                        help="report sizes without rewriting anything")
+    parser.add_argument("files", nargs="*", type=Path)
+    args = parser.parse_args()
+
+    files = args.files or sorted(DEFAULT_DIR.glob("*.c"))
+    totals = [0, 0, 0]
+    for path in files:
+        sizes = convert(path, args.method, args.check)
+        totals = [total + size for total, size in zip(totals, sizes)]
+        print(f"{path.name:48} {sizes[1]:7} -> {sizes[2]:7} bytes")
+    before, raw, after = totals
+    print(f"{len(files)} images: {raw} bytes raw, {after} bytes {args.method} "
+          f"({100 - 100 * after // max(raw, 1)}% saved; {before} bytes before this run)")
+
+
+if __name__ == "__main__":
+    main()
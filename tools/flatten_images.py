@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+"""
+Pre-blend the weather backgrounds onto the main screen's backdrop, so LVGL
+copies opaque RGB565 pixels instead of alpha-blending an RGB565A8 image on
+every redraw of the today image.
+
+The backdrop behind the image never changes: the main screen's vertical
+gradient between MAIN_SCREEN_GRADIENT_TOP and MAIN_SCREEN_GRADIENT_BOTTOM,
+with the image's top row at TODAY_IMAGE_Y. Those are read from config.h.
+The gradient rows and the blend follow LVGL 9.2's software renderer
+(lv_gradient_color_calculate() and lv_color_16_16_mix()), so the result
+matches what LVGL drew from the RGB565A8 original; `make test/ui` checks it.
+
+Each aura/src/assets/images/backgrounds/image_NAME.c (RGB565A8, optionally
+compressed by tools/compress_images.py) becomes
+aura/src/assets/images/opaque/image_NAME_opaque.c, RLE-compressed. The
+originals stay as they are, for drawing over anything but that backdrop.
+
+Usage: python3 tools/flatten_images.py [--method rle|lz4|none]
+"""
+
+import argparse
+import re
+import struct
+import sys
+from pathlib import Path
+
+# Shares the array parsing and compression with compress_images.py
+sys.dont_write_bytecode = True
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+import compress_images  # noqa: E402
+
+ROOT = Path(__file__).resolve().parent.parent
+CONFIG = ROOT / "aura/src/config.h"
+SOURCE_DIR = ROOT / "aura/src/assets/images/backgrounds"
+OUTPUT_DIR = ROOT / "aura/src/assets/images/opaque"
+
+TEMPLATE = """\
+// Generated by tools/flatten_images.py from {source}: pre-blended onto the
+// main screen gradient at y = {top}. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef {attribute}
+  #define {attribute}
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST {attribute} uint8_t
+    {name}_map[] = {{{data}}};
+
+const lv_image_dsc_t {name} = {{
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RGB565,
+    .header.flags = {flags},
+    .header.w = {width},
+    .header.h = {height},
+    .header.stride = {stride},
+    .header.reserved_2 = 0,
+    .data_size = sizeof({name}_map),
+    .data = {name}_map,
+    .reserved = NULL,
+}};
+"""
+
+
+def config_value(text, name):
+    match = re.search(rf"#define\s+{name}\s+(\w+)", text)
+    if not match:
+        sys.exit(f"error: {name} is not defined in {CONFIG}")
+    return int(match.group(1), 0)
+
+
+def rgb(hex_color):
+    return (hex_color >> 16) & 0xFF, (hex_color >> 8) & 0xFF, hex_color & 0xFF
+
+
+def gradient_row(top, bottom, height, y):
+    """The RGB565 colour LVGL fills row y of a vertical gradient with."""
+    # lv_gradient_color_calculate() with the default stops at 0 and 255
+    end = (255 * height) >> 8
+    if y <= 0:
+        color = top
+    elif y >= end:
+        color = bottom
+    else:
+        mix = y * 255 // end
+        color = tuple(((b * mix + a * (255 - mix)) * 0x8081) >> 23 for a, b in zip(top, bottom))
+    red, green, blue = color
+    return ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3)
+
+
+def mix565(foreground, background, alpha):
+    """lv_color_16_16_mix(): alpha in 1/32 steps on all three channels at once."""
+    if alpha == 255:
+        return foreground
+    if alpha == 0 or foreground == background:
+        return background
+    alpha = (alpha + 4) >> 3
+    fg = (foreground | foreground << 16) & 0x7E0F81F
+    bg = (background | background << 16) & 0x7E0F81F
+    result = ((((fg - bg) * alpha) >> 5) + bg) & 0x7E0F81F
+    return (result >> 16 | result) & 0xFFFF
+
+
+def flatten(path, backdrop, top, method):
+    text = path.read_text()
+    if "LV_COLOR_FORMAT_RGB565A8" not in text:
+        sys.exit(f"error: {path} is not RGB565A8")
+    width = int(re.search(r"\.header\.w\s*=\s*(\d+)", text).group(1))
+    height = int(re.search(r"\.header\.h\s*=\s*(\d+)", text).group(1))
+    stride = int(re.search(r"\.header\.stride\s*=\s*(\d+)", text).group(1))
+    array = compress_images.ARRAY_RE.search(text).group(2)
+    data = bytes(int(value, 16) for value in re.findall(r"0x([0-9a-fA-F]{2})", array))
+    if "LV_IMAGE_FLAGS_COMPRESSED" in text:
+        data = compress_images.decompress(data, 2)
+
+    # RGB565A8: the colour plane, then one alpha byte per pixel
+    alpha_plane = data[stride * height:]
+    pixels = bytearray()
+    for y in range(height):
+        row = backdrop[top + y]
+        for x in range(width):
+            (color,) = struct.unpack_from("<H", data, y * stride + x * 2)
+            pixels += struct.pack("<H", mix565(color, row, alpha_plane[y * width + x]))
+
+    packed = compress_images.compress(method, bytes(pixels), 2)
+    name = path.stem + "_opaque"
+    output = OUTPUT_DIR / (name + ".c")
+    output.write_text(TEMPLATE.format(
+        source=path.name, top=top, attribute="LV_ATTRIBUTE_" + name.upper(), name=name,
+        data=compress_images.format_array(packed),
+        flags="0 | LV_IMAGE_FLAGS_COMPRESSED" if method != "none" else "0",
+        width=width, height=height, stride=width * 2))
+    return len(data), len(packed)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--method", choices=compress_images.METHODS, default="rle")
+    args = parser.parse_args()
+
+    config = CONFIG.read_text()
+    top_color = rgb(config_value(config, "MAIN_SCREEN_GRADIENT_TOP"))
+    bottom_color = rgb(config_value(config, "MAIN_SCREEN_GRADIENT_BOTTOM"))
+    screen_height = config_value(config, "SCREEN_HEIGHT")
+    top = config_value(config, "TODAY_IMAGE_Y")
+    backdrop = [gradient_row(top_color, bottom_color, screen_height, y)
+                for y in range(screen_height)]
+
+    OUTPUT_DIR.mkdir(exist_ok=True)
+    sources = sorted(SOURCE_DIR.glob("image_*.c"))
+    before = after = 0
+    for path in sources:
+        source_size, size = flatten(path, backdrop, top, args.method)
+        before += source_size
+        after += size
+        print(f"{path.stem + '_opaque.c':48} {source_size:7} -> {size:7} bytes")
+    print(f"{len(sources)} images: {before} bytes RGB565A8 raw, {after} bytes opaque "
+          f"RGB565 {args.method}")
+
+
+if __name__ == "__main__":
+    main()
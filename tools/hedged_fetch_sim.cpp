@@ -0,0 +1,297 @@
+// Exercises HedgedFetch against local stand-in HTTP servers with injected
+// delays and failures, on Linux. Built and run by `make test/hedged-fetch`.
+//
+// Each stand-in accepts on 127.0.0.1, waits its configured delay, and
+// answers 200 (or 503 when told to fail). The requests are plain sockets,
+// standing in for HttpsClient: ready once a 200 status line has arrived.
+// A request can be told to block in start() first, as a TLS handshake does.
+
+#include "hedged_fetch.h"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <errno.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+static uint32_t now_ms() {
+    static auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+static void sleep_ms(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+class StandInServer {
+public:
+    std::atomic<uint32_t> delay_ms{0};
+    std::atomic<bool> fail{false};
+    std::atomic<uint32_t> served{0};
+    std::atomic<uint32_t> abandoned{0};
+
+    bool start() {
+        listener_ = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+        if (bind(listener_, (sockaddr*) &address, sizeof(address)) < 0 ||
+            listen(listener_, 16) < 0 ||
+            getsockname(listener_, (sockaddr*) &address, &length) < 0) {
+            return false;
+        }
+        port_ = ntohs(address.sin_port);
+        std::thread([this] { acceptLoop(); }).detach();
+        return true;
+    }
+
+    uint16_t port() const { return port_; }
+
+private:
+    int listener_ = -1;
+    uint16_t port_ = 0;
+
+    void acceptLoop() {
+        for (;;) {
+            int connection = accept(listener_, nullptr, nullptr);
+            if (connection < 0) {
+                return;
+            }
+            std::thread([this, connection] { serve(connection); }).detach();
+        }
+    }
+
+    void serve(int connection) {
+        char request[512];
+        size_t length = 0;
+        while (length < sizeof(request) - 1) {
+            ssize_t received = recv(connection, request + length, sizeof(request) - 1 - length, 0);
+            if (received <= 0) {
+                close(connection);
+                return;
+            }
+            length += received;
+            request[length] = '\0';
+            if (strstr(request, "\r\n\r\n")) {
+                break;
+            }
+        }
+
+        // Sleep in slices so a cancelled client is noticed
+        uint32_t until = now_ms() + delay_ms.load();
+        while (now_ms() < until) {
+            char probe;
+            if (recv(connection, &probe, 1, MSG_PEEK | MSG_DONTWAIT) == 0) {
+                abandoned++;
+                close(connection);
+                return;
+            }
+            sleep_ms(2);
+        }
+        const char* response = fail ? "HTTP/1.1 503 Service Unavailable\r\n"
+                                      "Content-Length: 0\r\n\r\n"
+                                    : "HTTP/1.1 200 OK\r\nContent-Length: 8\r\n\r\nforecast";
+        send(connection, response, strlen(response), MSG_NOSIGNAL);
+        served++;
+        close(connection);
+    }
+};
+
+class SocketRequest : public HedgedRequest {
+public:
+    SocketRequest(uint16_t port, LatencyHistogram& latency, uint32_t connectMs)
+        : port_(port), latency_(latency), connect_ms_(connectMs) {}
+    ~SocketRequest() override { cancel(); }
+
+    bool start() override {
+        socket_ = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port_);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        const char* request = "GET /forecast HTTP/1.1\r\nHost: localhost\r\n\r\n";
+        sleep_ms(connect_ms_);
+        return connect(socket_, (sockaddr*) &address, sizeof(address)) == 0 &&
+               send(socket_, request, strlen(request), MSG_NOSIGNAL) > 0;
+    }
+
+    HedgedPoll poll() override {
+        char head[16];
+        ssize_t received = recv(socket_, head, sizeof(head) - 1, MSG_PEEK | MSG_DONTWAIT);
+        if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return HEDGE_WAITING;
+        }
+        if (received < 12) {
+            return received <= 0 ? HEDGE_FAILED : HEDGE_WAITING;
+        }
+        head[received] = '\0';
+        return strncmp(head + 9, "200", 3) == 0 ? HEDGE_READY : HEDGE_FAILED;
+    }
+
+    void cancel() override {
+        if (socket_ >= 0) {
+            close(socket_);
+            socket_ = -1;
+        }
+    }
+
+    LatencyHistogram& latency() override { return latency_; }
+
+private:
+    uint16_t port_;
+    LatencyHistogram& latency_;
+    uint32_t connect_ms_;
+    int socket_ = -1;
+};
+
+struct Providers {
+    StandInServer primary;
+    StandInServer secondary;
+    LatencyHistogram primary_latency;
+    LatencyHistogram secondary_latency;
+    uint32_t primary_connect_ms = 0;
+};
+
+static const HedgePolicy POLICY = {100, 2000, 500, 10, 0.95f};
+
+struct Timed {
+    HedgedOutcome outcome;
+    uint32_t elapsed_ms;
+};
+
+static Timed fetch(HedgedFetch& hedge, Providers& providers, bool hedged, uint32_t timeout,
+                   LatencyHistogram* primaryLatency = nullptr) {
+    SocketRequest primary(providers.primary.port(),
+                          primaryLatency ? *primaryLatency : providers.primary_latency,
+                          providers.primary_connect_ms);
+    SocketRequest secondary(providers.secondary.port(), providers.secondary_latency, 0);
+    uint32_t start = now_ms();
+    Timed timed;
+    timed.outcome = hedge.race(primary, hedged ? &secondary : nullptr, timeout);
+    timed.elapsed_ms = now_ms() - start;
+    return timed;
+}
+
+static bool check(const char* name, bool passed) {
+    printf("%-52s %s\n", name, passed ? "PASSED" : "FAILED");
+    return passed;
+}
+
+static uint32_t percentile(std::vector<uint32_t> values, float fraction) {
+    std::sort(values.begin(), values.end());
+    size_t index = std::min(values.size() - 1, (size_t) (fraction * values.size()));
+    return values[index];
+}
+
+int main() {
+    Providers providers;
+    if (!providers.primary.start() || !providers.secondary.start()) {
+        perror("stand-in server");
+        return 1;
+    }
+    HedgedFetch hedge(POLICY, now_ms, sleep_ms);
+    bool passed = true;
+
+    // A healthy primary is never hedged, and its history pulls the
+    // threshold down from the default to the floor
+    providers.primary.delay_ms = 30;
+    providers.secondary.delay_ms = 40;
+    uint32_t hedges = 0;
+    uint32_t primary_wins = 0;
+    for (int i = 0; i < 20; i++) {
+        Timed timed = fetch(hedge, providers, true, 2000);
+        hedges += timed.outcome.hedged;
+        primary_wins += timed.outcome.winner == 0;
+    }
+    passed &= check("Fast primary: no hedging", hedges == 0 && primary_wins == 20);
+    passed &= check("Threshold learned from primary p95",
+                    hedge.hedgeDelayMs(providers.primary_latency) == POLICY.min_delay_ms);
+
+    // A cold connect well past the threshold is not lateness: the response
+    // itself comes quickly, so there is nothing to hedge
+    providers.primary_connect_ms = 400;
+    Timed cold = fetch(hedge, providers, true, 2000);
+    providers.primary_connect_ms = 0;
+    passed &= check("Slow connect: not hedged, not counted",
+                    !cold.outcome.hedged && cold.outcome.winner == 0 && cold.elapsed_ms >= 400 &&
+                        cold.outcome.first_byte_ms < POLICY.min_delay_ms);
+
+    // A stalled primary: the secondary is asked at the threshold and wins;
+    // the primary's connection is dropped
+    providers.primary.delay_ms = 1500;
+    uint32_t abandoned = providers.primary.abandoned;
+    Timed slow = fetch(hedge, providers, true, 3000);
+    sleep_ms(50);
+    passed &= check("Slow primary: secondary wins after the threshold",
+                    slow.outcome.hedged && slow.outcome.winner == 1 &&
+                        slow.elapsed_ms >= slow.outcome.hedge_delay_ms &&
+                        slow.elapsed_ms < slow.outcome.hedge_delay_ms + 150);
+    passed &= check("Slow primary: losing request cancelled",
+                    providers.primary.abandoned == abandoned + 1);
+
+    // A failing primary hands over at once rather than at the threshold
+    providers.primary.delay_ms = 0;
+    providers.primary.fail = true;
+    Timed failing = fetch(hedge, providers, true, 3000);
+    passed &= check("Failing primary: secondary asked immediately",
+                    failing.outcome.hedged && failing.outcome.winner == 1 &&
+                        failing.elapsed_ms < failing.outcome.hedge_delay_ms);
+    providers.primary.fail = false;
+
+    // Neither answers in time
+    providers.primary.delay_ms = 1000;
+    providers.secondary.delay_ms = 1000;
+    Timed timeout = fetch(hedge, providers, true, 400);
+    passed &= check("Both slow: gives up at the timeout",
+                    timeout.outcome.winner == -1 && timeout.elapsed_ms >= 400 &&
+                        timeout.elapsed_ms < 500);
+
+    // The threshold follows a primary that has become slower
+    providers.primary.delay_ms = 300;
+    for (int i = 0; i < 25; i++) {
+        fetch(hedge, providers, false, 2000);
+    }
+    uint32_t adapted = hedge.hedgeDelayMs(providers.primary_latency);
+    passed &= check("Threshold follows a slower primary", adapted >= 300 && adapted <= 400);
+
+    // Tail latency when one primary request in 20 stalls, which is beyond
+    // its p95, with and without hedging. The unhedged baseline keeps its own
+    // history so its stalls do not move the hedged threshold.
+    providers.primary_latency = LatencyHistogram();
+    providers.primary.delay_ms = 40;
+    providers.secondary.delay_ms = 60;
+    for (uint32_t i = 0; i < 2 * POLICY.min_samples; i++) {
+        fetch(hedge, providers, true, 3000);
+    }
+    LatencyHistogram baseline;
+    std::vector<uint32_t> plain;
+    std::vector<uint32_t> hedged;
+    for (int i = 0; i < 60; i++) {
+        providers.primary.delay_ms = i % 20 == 7 ? 1200 : 40;
+        plain.push_back(fetch(hedge, providers, false, 3000, &baseline).elapsed_ms);
+        hedged.push_back(fetch(hedge, providers, true, 3000).elapsed_ms);
+    }
+    printf("Unhedged: p50 %u ms, p95 %u ms, max %u ms\n", percentile(plain, 0.5f),
+           percentile(plain, 0.95f), percentile(plain, 1.0f));
+    printf("Hedged:   p50 %u ms, p95 %u ms, max %u ms\n", percentile(hedged, 0.5f),
+           percentile(hedged, 0.95f), percentile(hedged, 1.0f));
+    passed &= check("Hedging cuts the tail",
+                    percentile(plain, 1.0f) >= 1200 && percentile(hedged, 1.0f) < 500);
+
+    printf("Primary p50 %u ms, p95 %u ms over %u requests; secondary p95 %u ms over %u\n",
+           providers.primary_latency.percentile(0.5f),
+           providers.primary_latency.percentile(0.95f), providers.primary_latency.samples(),
+           providers.secondary_latency.percentile(0.95f),
+           providers.secondary_latency.samples());
+    printf("Hedged fetch simulation %s\n", passed ? "PASSED" : "FAILED");
+    return passed ? 0 : 1;
+}
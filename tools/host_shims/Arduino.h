@@ -0,0 +1,344 @@
+// Just enough of the Arduino-ESP32 core for the weather, display and UI
+// components to build and run on Linux. Used by `make bench/refresh` and
+// `make bench/ui`; never part of the firmware.
+//
+// Timing, logging and FreeRTOS locking map onto the C++ standard library;
+// String and Stream follow the core's semantics where the component relies
+// on them (timed reads, case-insensitive compares, null assignment).
+
+#ifndef HOST_SHIM_ARDUINO_H
+#define HOST_SHIM_ARDUINO_H
+
+#include <algorithm>
+#include <ctype.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <time.h>
+
+using std::max;
+using std::min;
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void yield();
+uint32_t esp_random();
+void configTime(long gmtOffset, int daylightOffset, const char* server1,
+                const char* server2 = nullptr, const char* server3 = nullptr);
+
+// Heap figures for LOG_MEMORY_INFO; the host has no fixed heap, so both are 0
+uint32_t esp_get_free_heap_size();
+uint32_t esp_get_minimum_free_heap_size();
+
+// The firmware's placement attributes mean nothing here
+#define DRAM_ATTR
+#define DMA_ATTR
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+#if !defined(__GLIBC__) || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38)
+size_t strlcpy(char* destination, const char* source, size_t size);
+#endif
+
+// ESP-IDF logging, printed to stdout. The level is set by the benchmark.
+typedef enum {
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE,
+} esp_log_level_t;
+
+void hostLogSetLevel(esp_log_level_t level);
+void hostLog(esp_log_level_t level, const char* tag, const char* format, ...)
+    __attribute__((format(printf, 3, 4)));
+
+#define ESP_LOGE(tag, format, ...) hostLog(ESP_LOG_ERROR, tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) hostLog(ESP_LOG_WARN, tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) hostLog(ESP_LOG_INFO, tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) hostLog(ESP_LOG_DEBUG, tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) hostLog(ESP_LOG_VERBOSE, tag, format, ##__VA_ARGS__)
+
+// FreeRTOS: mutexes and critical sections both become std::mutex
+typedef void* SemaphoreHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+#define portMAX_DELAY ((TickType_t) 0xffffffffUL)
+#define pdTRUE 1
+#define pdFALSE 0
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+void vSemaphoreDelete(SemaphoreHandle_t semaphore);
+
+struct portMUX_TYPE {
+    SemaphoreHandle_t mutex;
+};
+#define portMUX_INITIALIZE(mux) ((mux)->mutex = xSemaphoreCreateMutex())
+#define portENTER_CRITICAL(mux) xSemaphoreTake((mux)->mutex, portMAX_DELAY)
+#define portEXIT_CRITICAL(mux) xSemaphoreGive((mux)->mutex)
+
+class String {
+public:
+    String() {}
+    String(const char* text) { assign(text); }
+    String(const String& other) = default;
+    String(String&& other) = default;
+    explicit String(char c) : value_(1, c) {}
+    explicit String(int value) : value_(std::to_string(value)) {}
+    explicit String(unsigned int value) : value_(std::to_string(value)) {}
+    explicit String(long value) : value_(std::to_string(value)) {}
+    explicit String(unsigned long value) : value_(std::to_string(value)) {}
+    explicit String(float value, unsigned int decimals = 2) { format(value, decimals); }
+    explicit String(double value, unsigned int decimals = 2) { format(value, decimals); }
+
+    String& operator=(const String& other) = default;
+    String& operator=(String&& other) = default;
+    String& operator=(const char* text) {
+        assign(text);
+        return *this;
+    }
+
+    bool reserve(unsigned int size) {
+        value_.reserve(size);
+        return true;
+    }
+    unsigned int length() const { return value_.length(); }
+    bool isEmpty() const { return value_.empty(); }
+    const char* c_str() const { return value_.c_str(); }
+
+    bool concat(const String& other) {
+        value_ += other.value_;
+        return true;
+    }
+    bool concat(const char* text) {
+        if (text) {
+            value_ += text;
+        }
+        return text != nullptr;
+    }
+    bool concat(const char* text, unsigned int length) {
+        if (text) {
+            value_.append(text, length);
+        }
+        return text != nullptr;
+    }
+    bool concat(char c) {
+        value_ += c;
+        return true;
+    }
+    String& operator+=(const String& other) {
+        concat(other);
+        return *this;
+    }
+    String& operator+=(const char* text) {
+        concat(text);
+        return *this;
+    }
+    String& operator+=(char c) {
+        concat(c);
+        return *this;
+    }
+    String& operator+=(int value) { return *this += String(value); }
+    String& operator+=(unsigned int value) { return *this += String(value); }
+    String& operator+=(long value) { return *this += String(value); }
+    String& operator+=(unsigned long value) { return *this += String(value); }
+
+    bool equals(const String& other) const { return value_ == other.value_; }
+    bool equalsIgnoreCase(const String& other) const {
+        return value_.size() == other.value_.size() &&
+               strcasecmp(value_.c_str(), other.value_.c_str()) == 0;
+    }
+    bool operator==(const String& other) const { return equals(other); }
+    bool operator==(const char* text) const { return value_ == (text ? text : ""); }
+    bool operator!=(const String& other) const { return !equals(other); }
+    bool operator!=(const char* text) const { return !(*this == text); }
+    bool startsWith(const String& prefix) const {
+        return value_.compare(0, prefix.value_.size(), prefix.value_) == 0;
+    }
+    bool endsWith(const String& suffix) const {
+        return value_.size() >= suffix.value_.size() &&
+               value_.compare(value_.size() - suffix.value_.size(), suffix.value_.size(),
+                              suffix.value_) == 0;
+    }
+
+    char charAt(unsigned int index) const { return index < value_.size() ? value_[index] : 0; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char& operator[](unsigned int index) { return value_[index]; }
+    int indexOf(char c, unsigned int from = 0) const { return position(value_.find(c, from)); }
+    int indexOf(const String& text, unsigned int from = 0) const {
+        return position(value_.find(text.value_, from));
+    }
+    int lastIndexOf(char c) const { return position(value_.rfind(c)); }
+    String substring(unsigned int from) const { return substring(from, value_.size()); }
+    String substring(unsigned int from, unsigned int to) const {
+        if (from > to) {
+            std::swap(from, to);
+        }
+        if (from >= value_.size()) {
+            return String();
+        }
+        return String(value_.substr(from, min<size_t>(to, value_.size()) - from));
+    }
+
+    void trim() {
+        size_t first = 0;
+        while (first < value_.size() && isspace((unsigned char) value_[first])) {
+            first++;
+        }
+        size_t last = value_.size();
+        while (last > first && isspace((unsigned char) value_[last - 1])) {
+            last--;
+        }
+        value_ = value_.substr(first, last - first);
+    }
+    void toLowerCase() {
+        for (char& c : value_) {
+            c = tolower((unsigned char) c);
+        }
+    }
+    void toUpperCase() {
+        for (char& c : value_) {
+            c = toupper((unsigned char) c);
+        }
+    }
+    long toInt() const { return atol(value_.c_str()); }
+    float toFloat() const { return atof(value_.c_str()); }
+    double toDouble() const { return atof(value_.c_str()); }
+
+    friend String operator+(const String& left, const String& right) {
+        String sum(left);
+        sum += right;
+        return sum;
+    }
+    friend String operator+(const String& left, const char* right) {
+        String sum(left);
+        sum += right;
+        return sum;
+    }
+    friend String operator+(const char* left, const String& right) {
+        String sum(left);
+        sum += right;
+        return sum;
+    }
+    friend String operator+(const String& left, char right) {
+        String sum(left);
+        sum += right;
+        return sum;
+    }
+
+private:
+    std::string value_;
+
+    explicit String(std::string&& value) : value_(std::move(value)) {}
+
+    // The core treats a null pointer as an empty, invalidated string
+    void assign(const char* text) {
+        if (text) {
+            value_ = text;
+        } else {
+            value_.clear();
+        }
+    }
+    void format(double value, unsigned int decimals) {
+        char text[48];
+        snprintf(text, sizeof(text), "%.*f", (int) decimals, value);
+        value_ = text;
+    }
+    static int position(size_t found) { return found == std::string::npos ? -1 : (int) found; }
+};
+
+// ArduinoJson names it when adapting Arduino strings
+class StringSumHelper : public String {
+public:
+    StringSumHelper(const String& text) : String(text) {}
+};
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size) {
+        size_t written = 0;
+        while (written < size && write(buffer[written])) {
+            written++;
+        }
+        return written;
+    }
+    size_t write(const char* text) { return write((const uint8_t*) text, strlen(text)); }
+    size_t print(const char* text) { return write(text); }
+    size_t print(const String& text) { return write(text.c_str()); }
+};
+
+class Stream : public Print {
+public:
+    Stream() : timeout_(1000) {}
+
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    void setTimeout(unsigned long timeout) { timeout_ = timeout; }
+    unsigned long getTimeout() const { return timeout_; }
+
+    bool find(const char* target) {
+        size_t length = strlen(target);
+        size_t matched = 0;
+        if (length == 0) {
+            return true;
+        }
+        for (;;) {
+            int c = timedRead();
+            if (c < 0) {
+                return false;
+            }
+            if (c == target[matched]) {
+                if (++matched == length) {
+                    return true;
+                }
+            } else {
+                matched = c == target[0] ? 1 : 0;
+            }
+        }
+    }
+
+    virtual size_t readBytes(char* buffer, size_t length) {
+        size_t count = 0;
+        while (count < length) {
+            int c = timedRead();
+            if (c < 0) {
+                break;
+            }
+            buffer[count++] = (char) c;
+        }
+        return count;
+    }
+    size_t readBytes(uint8_t* buffer, size_t length) { return readBytes((char*) buffer, length); }
+
+protected:
+    unsigned long timeout_;
+
+    // Waits up to the timeout for a byte; a zero timeout makes one attempt
+    int timedRead() {
+        unsigned long start = millis();
+        do {
+            int c = read();
+            if (c >= 0) {
+                return c;
+            }
+        } while (millis() - start < timeout_);
+        return -1;
+    }
+};
+
+#endif // HOST_SHIM_ARDUINO_H
@@ -0,0 +1,43 @@
+// Host stand-in for the ESP32 Preferences library, kept in memory for the
+// life of the process. Only for `make bench/refresh`.
+
+#ifndef HOST_SHIM_PREFERENCES_H
+#define HOST_SHIM_PREFERENCES_H
+
+#include <Arduino.h>
+
+class Preferences {
+public:
+    Preferences() : namespace_(nullptr) {}
+
+    bool begin(const char* name, bool readOnly = false);
+    void end() { namespace_ = nullptr; }
+
+    size_t getBytesLength(const char* key);
+    size_t getBytes(const char* key, void* buffer, size_t length);
+    size_t putBytes(const char* key, const void* value, size_t length);
+
+    String getString(const char* key, const String& fallback = String());
+    size_t putString(const char* key, const char* value);
+    size_t putString(const char* key, const String& value) { return putString(key, value.c_str()); }
+
+    bool getBool(const char* key, bool fallback = false) { return get(key, fallback); }
+    uint8_t getUChar(const char* key, uint8_t fallback = 0) { return get(key, fallback); }
+    int32_t getInt(const char* key, int32_t fallback = 0) { return get(key, fallback); }
+    float getFloat(const char* key, float fallback = NAN) { return get(key, fallback); }
+    size_t putBool(const char* key, bool value) { return putBytes(key, &value, sizeof(value)); }
+    size_t putUChar(const char* key, uint8_t value) { return putBytes(key, &value, sizeof(value)); }
+    size_t putInt(const char* key, int32_t value) { return putBytes(key, &value, sizeof(value)); }
+    size_t putFloat(const char* key, float value) { return putBytes(key, &value, sizeof(value)); }
+
+private:
+    void* namespace_;
+
+    template <typename T> T get(const char* key, T fallback) {
+        T value;
+        return getBytesLength(key) == sizeof(T) && getBytes(key, &value, sizeof(T)) ? value
+                                                                                     : fallback;
+    }
+};
+
+#endif // HOST_SHIM_PREFERENCES_H
@@ -0,0 +1,41 @@
+// Host stand-in for the ESP32 WiFi library: always connected, with host
+// names answered from a routing table so every API host can be pointed at
+// a local server. Only for `make bench/refresh`.
+
+#ifndef HOST_SHIM_WIFI_H
+#define HOST_SHIM_WIFI_H
+
+#include <Arduino.h>
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_CONNECTED = 3,
+    WL_DISCONNECTED = 6,
+} wl_status_t;
+
+class IPAddress {
+public:
+    IPAddress() : bytes_() {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : bytes_{a, b, c, d} {}
+
+    uint8_t operator[](int index) const { return bytes_[index]; }
+    String toString() const;
+
+private:
+    uint8_t bytes_[4];
+};
+
+class WiFiClass {
+public:
+    wl_status_t status() const { return WL_CONNECTED; }
+    int hostByName(const char* host, IPAddress& address);
+};
+
+extern WiFiClass WiFi;
+
+// Sends connections for host to address:port instead of resolving it; a
+// null host routes every name without an entry of its own
+void hostShimRoute(const char* host, const char* address, uint16_t port);
+bool hostShimResolve(const char* host, uint16_t port, IPAddress& address, uint16_t& routedPort);
+
+#endif // HOST_SHIM_WIFI_H
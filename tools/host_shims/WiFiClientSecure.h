@@ -0,0 +1,33 @@
+// Host stand-in for WiFiClientSecure: a plain non-blocking TCP socket to
+// wherever hostShimRoute() sends the host. There is no TLS, so the
+// connect+TLS phase measures only the TCP connect. Only for
+// `make bench/refresh`.
+
+#ifndef HOST_SHIM_WIFI_CLIENT_SECURE_H
+#define HOST_SHIM_WIFI_CLIENT_SECURE_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+class WiFiClientSecure {
+public:
+    WiFiClientSecure() : socket_(-1) {}
+    ~WiFiClientSecure() { stop(); }
+
+    void setInsecure() {}
+    void setHandshakeTimeout(unsigned long) {}
+
+    int connect(const char* host, uint16_t port);
+    int connect(IPAddress address, uint16_t port, const char* host, const char* rootCA,
+                const char* certificate, const char* key);
+    uint8_t connected();
+    int available();
+    int read(uint8_t* buffer, size_t size);
+    size_t write(const uint8_t* buffer, size_t size);
+    void stop();
+
+private:
+    int socket_;
+};
+
+#endif // HOST_SHIM_WIFI_CLIENT_SECURE_H
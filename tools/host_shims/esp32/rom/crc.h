@@ -0,0 +1,13 @@
+// The ROM's little-endian CRC-32 is the same one zlib computes
+
+#ifndef HOST_SHIM_ROM_CRC_H
+#define HOST_SHIM_ROM_CRC_H
+
+#include <stdint.h>
+#include <zlib.h>
+
+static inline uint32_t crc32_le(uint32_t crc, const uint8_t* buffer, uint32_t length) {
+    return crc32(crc, buffer, length);
+}
+
+#endif // HOST_SHIM_ROM_CRC_H
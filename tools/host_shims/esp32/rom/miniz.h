@@ -0,0 +1,46 @@
+// The ROM's tinfl decompressor, implemented over zlib on the host. The
+// caller's output window is written exactly as tinfl would write it; zlib
+// keeps its own history, and allocates that outside the heap the refresh
+// benchmark counts, where the device keeps it inside tinfl_decompressor.
+
+#ifndef HOST_SHIM_ROM_MINIZ_H
+#define HOST_SHIM_ROM_MINIZ_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zlib.h>
+
+typedef uint8_t mz_uint8;
+typedef uint32_t mz_uint32;
+
+#define TINFL_LZ_DICT_SIZE 32768
+
+enum {
+    TINFL_FLAG_PARSE_ZLIB_HEADER = 1,
+    TINFL_FLAG_HAS_MORE_INPUT = 2,
+    TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF = 4,
+    TINFL_FLAG_COMPUTE_ADLER32 = 8,
+};
+
+typedef enum {
+    TINFL_STATUS_FAILED_CANNOT_MAKE_PROGRESS = -4,
+    TINFL_STATUS_BAD_PARAM = -3,
+    TINFL_STATUS_ADLER32_MISMATCH = -2,
+    TINFL_STATUS_FAILED = -1,
+    TINFL_STATUS_DONE = 0,
+    TINFL_STATUS_NEEDS_MORE_INPUT = 1,
+    TINFL_STATUS_HAS_MORE_OUTPUT = 2,
+} tinfl_status;
+
+struct tinfl_decompressor {
+    z_stream stream;
+    bool started;
+};
+
+#define tinfl_init(r) ((r)->started = false)
+
+tinfl_status tinfl_decompress(tinfl_decompressor* r, const mz_uint8* in, size_t* inSize,
+                              mz_uint8* outStart, mz_uint8* outNext, size_t* outSize,
+                              mz_uint32 flags);
+
+#endif // HOST_SHIM_ROM_MINIZ_H
@@ -0,0 +1,389 @@
+// Implementations behind the host shim headers. Only for `make bench/refresh`
+// and `make bench/ui`.
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+#include "esp32/rom/miniz.h"
+
+#include <arpa/inet.h>
+#include <chrono>
+#include <errno.h>
+#include <map>
+#include <mutex>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <random>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// glibc's own allocator, so zlib's state stays out of the benchmark's counts
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void __libc_free(void* pointer);
+
+static const auto START = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now() - START)
+        .count();
+}
+
+unsigned long micros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - START)
+        .count();
+}
+
+void delay(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void yield() {
+    std::this_thread::yield();
+}
+
+uint32_t esp_random() {
+    static std::mt19937 generator(42);
+    return generator();
+}
+
+void configTime(long, int, const char*, const char*, const char*) {}
+
+uint32_t esp_get_free_heap_size() {
+    return 0;
+}
+
+uint32_t esp_get_minimum_free_heap_size() {
+    return 0;
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+#if !defined(__GLIBC__) || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38)
+size_t strlcpy(char* destination, const char* source, size_t size) {
+    size_t length = strlen(source);
+    if (size > 0) {
+        size_t copied = min(length, size - 1);
+        memcpy(destination, source, copied);
+        destination[copied] = '\0';
+    }
+    return length;
+}
+#endif
+
+// Logging
+
+static esp_log_level_t log_level = ESP_LOG_WARN;
+
+void hostLogSetLevel(esp_log_level_t level) {
+    log_level = level;
+}
+
+void hostLog(esp_log_level_t level, const char* tag, const char* format, ...) {
+    static const char LETTERS[] = "NEWIDV";
+    if (level > log_level) {
+        return;
+    }
+    printf("%c (%lu) %s: ", LETTERS[level], millis(), tag);
+    va_list arguments;
+    va_start(arguments, format);
+    vprintf(format, arguments);
+    va_end(arguments);
+    putchar('\n');
+}
+
+extern "C" void logging_get_timestamp(char* buffer, size_t size) {
+    snprintf(buffer, size, "%lu", millis());
+}
+
+// FreeRTOS
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return new std::recursive_mutex();
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t) {
+    static_cast<std::recursive_mutex*>(semaphore)->lock();
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    static_cast<std::recursive_mutex*>(semaphore)->unlock();
+    return pdTRUE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) {
+    delete static_cast<std::recursive_mutex*>(semaphore);
+}
+
+// WiFi
+
+WiFiClass WiFi;
+
+struct Route {
+    in_addr address;
+    uint16_t port;
+};
+
+static std::mutex route_lock;
+static std::map<std::string, Route> routes;
+
+void hostShimRoute(const char* host, const char* address, uint16_t port) {
+    Route route;
+    inet_pton(AF_INET, address, &route.address);
+    route.port = port;
+    std::lock_guard<std::mutex> guard(route_lock);
+    routes[host ? host : ""] = route;
+}
+
+static bool lookupRoute(const char* host, Route& route) {
+    std::lock_guard<std::mutex> guard(route_lock);
+    auto entry = routes.find(host);
+    if (entry == routes.end()) {
+        entry = routes.find("");
+    }
+    if (entry == routes.end()) {
+        return false;
+    }
+    route = entry->second;
+    return true;
+}
+
+bool hostShimResolve(const char* host, uint16_t port, IPAddress& address, uint16_t& routedPort) {
+    Route route;
+    if (lookupRoute(host, route)) {
+        routedPort = route.port;
+    } else {
+        addrinfo hints = {};
+        hints.ai_family = AF_INET;
+        addrinfo* results = nullptr;
+        if (getaddrinfo(host, nullptr, &hints, &results) != 0 || !results) {
+            return false;
+        }
+        route.address = ((sockaddr_in*) results->ai_addr)->sin_addr;
+        routedPort = port;
+        freeaddrinfo(results);
+    }
+    const uint8_t* bytes = (const uint8_t*) &route.address.s_addr;
+    address = IPAddress(bytes[0], bytes[1], bytes[2], bytes[3]);
+    return true;
+}
+
+String IPAddress::toString() const {
+    char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", bytes_[0], bytes_[1], bytes_[2], bytes_[3]);
+    return String(text);
+}
+
+int WiFiClass::hostByName(const char* host, IPAddress& address) {
+    uint16_t port;
+    return hostShimResolve(host, 0, address, port) ? 1 : 0;
+}
+
+int WiFiClientSecure::connect(const char* host, uint16_t port) {
+    IPAddress address;
+    uint16_t routedPort;
+    if (!hostShimResolve(host, port, address, routedPort)) {
+        return 0;
+    }
+    return connect(address, port, host, nullptr, nullptr, nullptr);
+}
+
+// The address is used as given; host only picks the routed port
+int WiFiClientSecure::connect(IPAddress address, uint16_t port, const char* host, const char*,
+                              const char*, const char*) {
+    stop();
+    IPAddress routed;
+    uint16_t routedPort;
+    if (!hostShimResolve(host, port, routed, routedPort)) {
+        routedPort = port;
+    }
+    sockaddr_in target = {};
+    target.sin_family = AF_INET;
+    target.sin_port = htons(routedPort);
+    target.sin_addr.s_addr = htonl((uint32_t) address[0] << 24 | (uint32_t) address[1] << 16 |
+                                   (uint32_t) address[2] << 8 | address[3]);
+    socket_ = socket(AF_INET, SOCK_STREAM, 0);
+    if (socket_ < 0 || ::connect(socket_, (sockaddr*) &target, sizeof(target)) < 0) {
+        stop();
+        return 0;
+    }
+    int noDelay = 1;
+    setsockopt(socket_, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    return 1;
+}
+
+uint8_t WiFiClientSecure::connected() {
+    if (socket_ < 0) {
+        return 0;
+    }
+    // Like the core, a closed connection with unread data still counts
+    char probe;
+    ssize_t received = recv(socket_, &probe, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (received > 0 || (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))) {
+        return 1;
+    }
+    return 0;
+}
+
+int WiFiClientSecure::available() {
+    int pending = 0;
+    if (socket_ < 0 || ioctl(socket_, FIONREAD, &pending) < 0) {
+        return 0;
+    }
+    return pending;
+}
+
+int WiFiClientSecure::read(uint8_t* buffer, size_t size) {
+    if (socket_ < 0) {
+        return -1;
+    }
+    ssize_t received = recv(socket_, buffer, size, MSG_DONTWAIT);
+    return received < 0 ? -1 : (int) received;
+}
+
+size_t WiFiClientSecure::write(const uint8_t* buffer, size_t size) {
+    size_t written = 0;
+    while (socket_ >= 0 && written < size) {
+        ssize_t sent = send(socket_, buffer + written, size - written, MSG_NOSIGNAL);
+        if (sent <= 0) {
+            break;
+        }
+        written += sent;
+    }
+    return written;
+}
+
+void WiFiClientSecure::stop() {
+    if (socket_ >= 0) {
+        close(socket_);
+        socket_ = -1;
+    }
+}
+
+// Preferences: one map per namespace, shared by every instance
+
+typedef std::map<std::string, std::vector<uint8_t>> PreferenceSpace;
+
+static std::mutex preference_lock;
+static std::map<std::string, PreferenceSpace> preference_spaces;
+
+bool Preferences::begin(const char* name, bool) {
+    std::lock_guard<std::mutex> guard(preference_lock);
+    namespace_ = &preference_spaces[name];
+    return true;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    std::lock_guard<std::mutex> guard(preference_lock);
+    if (!namespace_) {
+        return 0;
+    }
+    PreferenceSpace& space = *static_cast<PreferenceSpace*>(namespace_);
+    auto entry = space.find(key);
+    return entry == space.end() ? 0 : entry->second.size();
+}
+
+size_t Preferences::getBytes(const char* key, void* buffer, size_t length) {
+    std::lock_guard<std::mutex> guard(preference_lock);
+    if (!namespace_) {
+        return 0;
+    }
+    PreferenceSpace& space = *static_cast<PreferenceSpace*>(namespace_);
+    auto entry = space.find(key);
+    if (entry == space.end() || entry->second.size() > length) {
+        return 0;
+    }
+    memcpy(buffer, entry->second.data(), entry->second.size());
+    return entry->second.size();
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t length) {
+    std::lock_guard<std::mutex> guard(preference_lock);
+    if (!namespace_) {
+        return 0;
+    }
+    const uint8_t* bytes = static_cast<const uint8_t*>(value);
+    (*static_cast<PreferenceSpace*>(namespace_))[key].assign(bytes, bytes + length);
+    return length;
+}
+
+String Preferences::getString(const char* key, const String& fallback) {
+    // Stored with the terminator, as the NVS string type is
+    size_t length = getBytesLength(key);
+    if (length == 0) {
+        return fallback;
+    }
+    std::vector<char> text(length);
+    getBytes(key, text.data(), length);
+    text[length - 1] = '\0';
+    return String(text.data());
+}
+
+size_t Preferences::putString(const char* key, const char* value) {
+    return putBytes(key, value, strlen(value) + 1);
+}
+
+// tinfl over zlib
+
+static voidpf inflateAlloc(voidpf, uInt count, uInt size) {
+    return __libc_calloc(count, size);
+}
+
+static void inflateFree(voidpf, voidpf pointer) {
+    __libc_free(pointer);
+}
+
+tinfl_status tinfl_decompress(tinfl_decompressor* r, const mz_uint8* in, size_t* inSize,
+                              mz_uint8*, mz_uint8* outNext, size_t* outSize, mz_uint32 flags) {
+    z_stream& stream = r->stream;
+    if (!r->started) {
+        memset(&stream, 0, sizeof(stream));
+        stream.zalloc = inflateAlloc;
+        stream.zfree = inflateFree;
+        // Raw deflate unless the zlib header is to be parsed
+        int windowBits = flags & TINFL_FLAG_PARSE_ZLIB_HEADER ? 15 : -15;
+        if (inflateInit2(&stream, windowBits) != Z_OK) {
+            return TINFL_STATUS_FAILED;
+        }
+        r->started = true;
+    }
+
+    stream.next_in = const_cast<Bytef*>(in);
+    stream.avail_in = *inSize;
+    stream.next_out = outNext;
+    stream.avail_out = *outSize;
+    int result = inflate(&stream, Z_NO_FLUSH);
+    *inSize -= stream.avail_in;
+    *outSize -= stream.avail_out;
+
+    // zlib's state is released once the stream ends either way; a body
+    // abandoned part way keeps it until the process exits
+    if (result == Z_STREAM_END) {
+        inflateEnd(&stream);
+        r->started = false;
+        return TINFL_STATUS_DONE;
+    }
+    if (result != Z_OK && result != Z_BUF_ERROR) {
+        inflateEnd(&stream);
+        r->started = false;
+        return TINFL_STATUS_FAILED;
+    }
+    if (stream.avail_out == 0) {
+        return TINFL_STATUS_HAS_MORE_OUTPUT;
+    }
+    if (!(flags & TINFL_FLAG_HAS_MORE_INPUT) && *inSize == 0 && *outSize == 0) {
+        inflateEnd(&stream);
+        r->started = false;
+        return TINFL_STATUS_FAILED_CANNOT_MAKE_PROGRESS;
+    }
+    return TINFL_STATUS_NEEDS_MORE_INPUT;
+}
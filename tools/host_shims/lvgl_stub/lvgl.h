@@ -0,0 +1,16 @@
+// config.h declares the firmware's fonts and images; the weather component
+// never touches them, so on the host they stay opaque declarations. Only for
+// `make bench/refresh`; `make bench/ui` builds against the real LVGL.
+
+#ifndef HOST_SHIM_LVGL_H
+#define HOST_SHIM_LVGL_H
+
+#define LV_COLOR_DEPTH 16
+
+typedef struct _lv_font_t lv_font_t;
+typedef struct _lv_image_dsc_t lv_image_dsc_t;
+
+#define LV_FONT_DECLARE(name) extern const lv_font_t name
+#define LV_IMG_DECLARE(name) extern const lv_image_dsc_t name
+
+#endif // HOST_SHIM_LVGL_H
@@ -0,0 +1,181 @@
+// Simulates a floor of units sharing forecasts with LanShare over loopback
+// multicast on Linux. Built and run by `make test/lan-share` with short
+// protocol timings (-DLAN_SHARE_HEARTBEAT_MS=100).
+//
+// Four units show London and one shows Paris. Each "fetches" on a fixed
+// interval unless it is following a leader, and the leader shares what it
+// fetched. The run checks that:
+//   - only the lowest London id and the lone Paris unit fetch once settled,
+//   - the London followers take every forecast the leader shares,
+//   - the next lowest id takes over once the leader goes silent,
+//   - corrupted packets are rejected.
+
+#include "lan_share.h"
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+static const char* GROUP = "239.255.42.99";
+static const uint16_t PORT = 42990;
+static const uint32_t FETCH_INTERVAL_MS = 300;
+
+struct SimNode {
+    SimNode(uint32_t id, float latitude, float longitude)
+        : id(id), latitude(latitude), longitude(longitude), running(false), last_fetch_ms(0),
+          fetches(0), forecasts(0), shown() {}
+
+    uint32_t id;
+    float latitude;
+    float longitude;
+    LanShare lan;
+    bool running;
+    uint32_t last_fetch_ms;
+    uint32_t fetches;
+    uint32_t forecasts;
+    char shown[32];
+};
+
+static uint32_t now_ms() {
+    static auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+static void step(SimNode* nodes, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        SimNode& node = nodes[i];
+        if (!node.running) {
+            continue;
+        }
+        uint32_t now = now_ms();
+        if (node.lan.poll(now)) {
+            size_t length;
+            uint8_t tier;
+            const uint8_t* payload = node.lan.forecast(length, tier);
+            snprintf(node.shown, sizeof(node.shown), "%.*s", (int) length, payload);
+            node.forecasts++;
+            node.last_fetch_ms = now;
+        }
+        if (now - node.last_fetch_ms >= FETCH_INTERVAL_MS && node.lan.isLeader(now)) {
+            node.last_fetch_ms = now;
+            node.fetches++;
+            char payload[32];
+            int length = snprintf(payload, sizeof(payload), "forecast %u/%u", node.id,
+                                  node.fetches);
+            snprintf(node.shown, sizeof(node.shown), "%s", payload);
+            node.lan.share(1, (const uint8_t*) payload, length);
+        }
+    }
+}
+
+static void run_for(SimNode* nodes, size_t count, uint32_t ms) {
+    uint32_t until = now_ms() + ms;
+    while (now_ms() < until) {
+        step(nodes, count);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+}
+
+static void reset_counts(SimNode* nodes, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        nodes[i].fetches = 0;
+        nodes[i].forecasts = 0;
+    }
+}
+
+static bool check(const char* name, bool passed) {
+    printf("%-48s %s\n", name, passed ? "PASSED" : "FAILED");
+    return passed;
+}
+
+int main() {
+    static SimNode nodes[] = {
+        {30, 51.507f, -0.128f}, {10, 51.510f, -0.130f}, {40, 51.500f, -0.120f},
+        {20, 51.515f, -0.140f}, {5, 48.857f, 2.352f},
+    };
+    const size_t count = sizeof(nodes) / sizeof(nodes[0]);
+    for (SimNode& node : nodes) {
+        if (!node.lan.begin(node.id, GROUP, PORT, now_ms(), "127.0.0.1")) {
+            perror("LanShare::begin");
+            return 1;
+        }
+        node.lan.setPosition(node.latitude, node.longitude);
+        node.lan.setRadius(5.0f);
+        node.running = true;
+    }
+
+    // Settle, then count a steady stretch
+    run_for(nodes, count, LAN_SHARE_LEADER_TIMEOUT_MS + 500);
+    reset_counts(nodes, count);
+    run_for(nodes, count, 10 * FETCH_INTERVAL_MS);
+
+    bool passed = true;
+    passed &= check("London leader is the lowest id", nodes[0].lan.leader(now_ms()) == 10);
+    passed &= check("Leader and the Paris unit fetch",
+                    nodes[1].fetches >= 8 && nodes[4].fetches >= 8);
+    passed &= check("Followers never fetch",
+                    nodes[0].fetches == 0 && nodes[2].fetches == 0 && nodes[3].fetches == 0);
+    passed &= check("Followers take every shared forecast",
+                    nodes[0].forecasts >= nodes[1].fetches - 1 &&
+                        nodes[2].forecasts == nodes[0].forecasts &&
+                        strcmp(nodes[3].shown, nodes[1].shown) == 0);
+    passed &= check("Paris ignores the London group", nodes[4].forecasts == 0);
+
+    // The leader goes silent; 20 should take over after one timeout
+    nodes[1].lan.end();
+    nodes[1].running = false;
+    run_for(nodes, count, LAN_SHARE_LEADER_TIMEOUT_MS + 500);
+    reset_counts(nodes, count);
+    run_for(nodes, count, 10 * FETCH_INTERVAL_MS);
+    passed &= check("Next lowest id takes over", nodes[3].lan.isLeader(now_ms()) &&
+                                                     nodes[3].fetches >= 8 &&
+                                                     nodes[0].fetches == 0 &&
+                                                     nodes[2].fetches == 0);
+    passed &= check("Remaining followers switch leader",
+                    nodes[0].forecasts >= nodes[3].fetches - 1 &&
+                        strncmp(nodes[2].shown, "forecast 20/", 12) == 0);
+
+    // Flip a payload byte in an otherwise valid packet
+    uint32_t rejected = nodes[0].lan.stats().rejected;
+    int raw = socket(AF_INET, SOCK_DGRAM, 0);
+    in_addr interface = {};
+    interface.s_addr = inet_addr("127.0.0.1");
+    setsockopt(raw, IPPROTO_IP, IP_MULTICAST_IF, &interface, sizeof(interface));
+    uint8_t packet[sizeof(LanShareHeader) + 4] = {};
+    LanShareHeader header = {};
+    header.magic = LanShare::MAGIC;
+    header.version = LanShare::VERSION;
+    header.type = LAN_SHARE_FORECAST;
+    header.node = 1;
+    header.latitude = 5150700;
+    header.longitude = -12800;
+    header.length = 4;
+    memcpy(packet, &header, sizeof(header));
+    memcpy(packet + sizeof(header), "bad!", 4);
+    header.crc = LanShare::crc32(0, packet, sizeof(packet));
+    memcpy(packet, &header, sizeof(header));
+    packet[sizeof(header)] ^= 0x01;
+    sockaddr_in destination = {};
+    destination.sin_family = AF_INET;
+    destination.sin_port = htons(PORT);
+    destination.sin_addr.s_addr = inet_addr(GROUP);
+    sendto(raw, packet, sizeof(packet), 0, (sockaddr*) &destination, sizeof(destination));
+    close(raw);
+    run_for(nodes, count, 100);
+    passed &= check("Corrupted packet rejected", nodes[0].lan.stats().rejected == rejected + 1 &&
+                                                     nodes[0].lan.leader(now_ms()) == 20);
+
+    for (const SimNode& node : nodes) {
+        const LanShareStats& stats = node.lan.stats();
+        printf("node %2u: sent %u, received %u, accepted %u, rejected %u\n", node.id, stats.sent,
+               stats.received, stats.accepted, stats.rejected);
+    }
+    printf("LAN share simulation %s\n", passed ? "PASSED" : "FAILED");
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,223 @@
+#!/usr/bin/env python3
+"""
+Build the offline city index that the location search consults before it
+asks the geocoding API.
+
+Cities are sorted by lowercase name and the names front-coded in blocks of
+CITY_INDEX_BLOCK_SIZE: every entry stores how many leading bytes it shares
+with the previous name plus the rest, and each block starts over with a
+full name so the device can binary-search the block heads. Coordinates are
+kept to 0.01 degrees and population as a one-byte log rank for ordering.
+
+The input is a CSV with the columns name,country,latitude,longitude,population
+(tools/data/cities.csv is a small hand-made seed), or with --geonames the
+GeoNames cities15000.txt dump, where --countries countryInfo.txt turns the
+country codes into names. --synthetic N writes N made-up cities instead,
+for measuring lookups at full size without the download.
+
+Usage: python3 tools/make_city_index.py [--limit N] [--geonames [--countries FILE]]
+                                        [--synthetic N] [input] [output.h]
+"""
+
+import argparse
+import csv
+import math
+import random
+import sys
+import unicodedata
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+DEFAULT_INPUT = ROOT / "tools/data/cities.csv"
+DEFAULT_OUTPUT = ROOT / "aura/src/components/weather/city_index_data.h"
+
+# Must match city_index.h
+BLOCK_SIZE = 16
+NAME_SIZE = 40
+COORD_SCALE = 100
+RECORD_BYTES = 6
+
+
+def ascii_name(name):
+    """Drop accents and anything else outside ASCII, as the search folds case only."""
+    folded = unicodedata.normalize("NFKD", name).encode("ascii", "ignore").decode("ascii")
+    return " ".join(folded.split())[:NAME_SIZE - 1]
+
+
+def population_rank(population):
+    # 25 steps per decade: 10 people -> 25, 10 million -> 175
+    if population < 1:
+        return 0
+    return min(255, int(round(math.log10(population) * 25)))
+
+
+def read_csv(path):
+    with open(path, newline="", encoding="utf-8") as handle:
+        for row in csv.DictReader(handle):
+            yield (row["name"], row["country"], float(row["latitude"]),
+                   float(row["longitude"]), int(row["population"] or 0))
+
+
+def read_country_names(path):
+    names = {}
+    with open(path, encoding="utf-8") as handle:
+        for line in handle:
+            if line.startswith("#") or not line.strip():
+                continue
+            fields = line.rstrip("\n").split("\t")
+            names[fields[0]] = fields[4]
+    return names
+
+
+def read_geonames(path, countries):
+    with open(path, encoding="utf-8") as handle:
+        for line in handle:
+            fields = line.rstrip("\n").split("\t")
+            code = fields[8]
+            yield (fields[2] or fields[1], countries.get(code, code), float(fields[4]),
+                   float(fields[5]), int(fields[14] or 0))
+
+
+def synthetic_cities(count, seed=1):
+    rng = random.Random(seed)
+    onsets = ["b", "br", "c", "ch", "d", "f", "g", "h", "k", "l", "m", "n", "p", "r", "s",
+              "st", "t", "v", "w", "z", ""]
+    vowels = ["a", "e", "i", "o", "u", "ai", "ou"]
+    codas = ["", "", "n", "r", "s", "l", "m", "rg", "nd", "ck"]
+    countries = ["Country %d" % index for index in range(120)]
+    for _ in range(count):
+        syllables = rng.choice([1, 2, 2, 3, 3, 4])
+        name = "".join(rng.choice(onsets) + rng.choice(vowels) + rng.choice(codas)
+                       for _ in range(syllables))
+        if rng.random() < 0.1:
+            name += " " + rng.choice(["City", "North", "Beach", "Springs", "Heights"])
+        yield (name.capitalize(), rng.choice(countries), rng.uniform(-60, 70),
+               rng.uniform(-180, 180), int(15000 * rng.paretovariate(1.1)))
+
+
+def build(cities, limit):
+    entries = []
+    for name, country, latitude, longitude, population in cities:
+        name = ascii_name(name)
+        if name:
+            entries.append((name, country, latitude, longitude, population))
+
+    # Keep the most populous, then order for the prefix search; ties on the
+    # name stay biggest first
+    entries.sort(key=lambda entry: -entry[4])
+    entries = entries[:limit]
+    entries.sort(key=lambda entry: (entry[0].lower(), -entry[4]))
+    if len(entries) > 0xffff:
+        sys.exit("At most 65535 cities fit the index")
+
+    countries = sorted({entry[1] for entry in entries})
+    if len(countries) > 256:
+        sys.exit("At most 256 countries fit the index")
+    country_index = {country: index for index, country in enumerate(countries)}
+
+    names = bytearray()
+    blocks = []
+    records = []
+    previous = b""
+    for position, (name, country, latitude, longitude, population) in enumerate(entries):
+        encoded = name.encode("ascii")
+        shared = 0
+        if position % BLOCK_SIZE == 0:
+            blocks.append(len(names))
+        else:
+            limit_shared = min(len(encoded), len(previous))
+            while shared < limit_shared and encoded[shared] == previous[shared]:
+                shared += 1
+        names += bytes([shared, len(encoded) - shared]) + encoded[shared:]
+        previous = encoded
+        records.append((int(round(latitude * COORD_SCALE)), int(round(longitude * COORD_SCALE)),
+                        country_index[country], population_rank(population)))
+    return entries, countries, names, blocks, records
+
+
+def c_string(text):
+    return '"%s"' % text.replace("\\", "\\\\").replace('"', '\\"')
+
+
+def render(source, entries, countries, names, blocks, records):
+    raw_names = sum(len(entry[0]) + 1 for entry in entries)
+    country_bytes = sum(len(country) + 1 for country in countries) + 4 * len(countries)
+    total = len(names) + 4 * len(blocks) + RECORD_BYTES * len(records) + country_bytes
+
+    lines = [
+        "// Generated by tools/make_city_index.py from %s - do not edit" % source,
+        "// %d cities in %d blocks: names %d bytes front-coded (%d plain), %d bytes in all"
+        % (len(entries), len(blocks), len(names), raw_names, total),
+        "#ifndef CITY_INDEX_DATA_H",
+        "#define CITY_INDEX_DATA_H",
+        "",
+        '#include "city_index.h"',
+        "",
+        "static const uint8_t CITY_INDEX_NAMES[] = {",
+    ]
+    for offset in range(0, len(names), 16):
+        lines.append("    %s," % ", ".join("0x%02x" % byte for byte in names[offset:offset + 16]))
+    lines.append("};")
+    lines.append("")
+    lines.append("static const uint32_t CITY_INDEX_BLOCKS[] = {")
+    for offset in range(0, len(blocks), 8):
+        lines.append("    %s," % ", ".join("%d" % block for block in blocks[offset:offset + 8]))
+    lines.append("};")
+    lines.append("")
+    lines.append("static const CityRecord CITY_INDEX_RECORDS[] = {")
+    for offset in range(0, len(records), 4):
+        lines.append("    %s," % ", ".join("{%d, %d, %d, %d}" % record
+                                             for record in records[offset:offset + 4]))
+    lines.append("};")
+    lines.append("")
+    lines.append("static const char* const CITY_INDEX_COUNTRIES[] = {")
+    for country in countries:
+        lines.append("    %s," % c_string(country))
+    lines.append("};")
+    lines += [
+        "",
+        "static const CityIndexData CITY_INDEX_DATA = {",
+        "    CITY_INDEX_NAMES, sizeof(CITY_INDEX_NAMES), CITY_INDEX_BLOCKS, %d," % len(blocks),
+        "    CITY_INDEX_RECORDS, %d, CITY_INDEX_COUNTRIES, %d," % (len(records), len(countries)),
+        "};",
+        "",
+        "#endif // CITY_INDEX_DATA_H",
+        "",
+    ]
+    return "\n".join(lines), raw_names, total
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("input", nargs="?", type=Path, default=DEFAULT_INPUT)
+    parser.add_argument("output", nargs="?", type=Path, default=DEFAULT_OUTPUT)
+    parser.add_argument("--limit", type=int, default=20000, help="most populous cities kept")
+    parser.add_argument("--geonames", action="store_true", help="input is cities15000.txt")
+    parser.add_argument("--countries", type=Path, help="GeoNames countryInfo.txt")
+    parser.add_argument("--synthetic", type=int, metavar="N", help="generate N fake cities")
+    args = parser.parse_args()
+
+    if args.synthetic:
+        # The only positional argument is the output then
+        output = args.input if args.input != DEFAULT_INPUT else args.output
+        source = "%d synthetic cities" % args.synthetic
+        cities = synthetic_cities(args.synthetic)
+    elif args.geonames:
+        output = args.output
+        source = args.input.name
+        countries = read_country_names(args.countries) if args.countries else {}
+        cities = read_geonames(args.input, countries)
+    else:
+        output = args.output
+        source = args.input.name
+        cities = read_csv(args.input)
+
+    entries, countries, names, blocks, records = build(cities, args.limit)
+    text, raw_names, total = render(source, entries, countries, names, blocks, records)
+    output.write_text(text)
+    print("Wrote %s: %d cities, %d countries, names %d -> %d bytes, %d bytes of flash"
+          % (output, len(entries), len(countries), raw_names, len(names), total))
+
+
+if __name__ == "__main__":
+    main()
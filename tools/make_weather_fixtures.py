@@ -0,0 +1,201 @@
+#!/usr/bin/env python3
+"""
+Generate compressed response fixtures for the weather component tests.
+
+The forecast text is byte-for-byte what build_forecast_fixture() in
+test_weather.cpp builds at runtime, so the device test can inflate the gzip
+and deflate variants and compare them with the plain body it already has.
+The geocoding fixture is a trimmed recording of a search for "London", and
+the MET Norway one a trimmed locationforecast for the same city.
+
+Usage: python3 tools/make_weather_fixtures.py [output.h]
+"""
+
+import gzip
+import re
+import struct
+import sys
+import zlib
+from pathlib import Path
+
+DEFAULT_OUTPUT = (Path(__file__).resolve().parent.parent /
+                  "aura/src/components/weather/test_weather_fixtures.h")
+
+GEOCODING_RESPONSE = (
+    '{"results":['
+    '{"id":2643743,"name":"London","latitude":51.50853,"longitude":-0.12574,'
+    '"elevation":25.0,"feature_code":"PPLC","country_code":"GB","admin1_id":6269131,'
+    '"admin2_id":2648110,"timezone":"Europe/London","population":7556900,'
+    '"country_id":2635167,"country":"United Kingdom","admin1":"England",'
+    '"admin2":"Greater London"},'
+    '{"id":6058560,"name":"London","latitude":42.98339,"longitude":-81.23304,'
+    '"elevation":252.0,"feature_code":"PPL","country_code":"CA","admin1_id":6093943,'
+    '"timezone":"America/Toronto","population":346765,"country_id":6251999,'
+    '"country":"Canada","admin1":"Ontario"},'
+    '{"id":4517009,"name":"London","latitude":39.88645,"longitude":-83.44825,'
+    '"elevation":321.0,"feature_code":"PPLA2","country_code":"US","admin1_id":5165418,'
+    '"admin2_id":4517365,"timezone":"America/New_York","population":10060,'
+    '"postcodes":["43140"],"country_id":6252001,"country":"United States",'
+    '"admin1":"Ohio","admin2":"Madison"},'
+    '{"id":4298960,"name":"London","latitude":37.12898,"longitude":-84.08326,'
+    '"elevation":378.0,"feature_code":"PPLA2","country_code":"US","admin1_id":6254925,'
+    '"admin2_id":4297376,"timezone":"America/New_York","population":8126,'
+    '"postcodes":["40741","40742","40743","40744","40745"],"country_id":6252001,'
+    '"country":"United States","admin1":"Kentucky","admin2":"Laurel"},'
+    '{"id":4707414,"name":"London","latitude":30.67685,"longitude":-99.57645,'
+    '"elevation":520.0,"feature_code":"PPL","country_code":"US","admin1_id":4736286,'
+    '"admin2_id":4707007,"timezone":"America/Chicago","population":180,'
+    '"postcodes":["76854"],"country_id":6252001,"country":"United States",'
+    '"admin1":"Texas","admin2":"Kimble"}'
+    '],"generationtime_ms":0.8749962}'
+)
+
+
+# 2025-07-20 00:00 in a UTC+1 zone
+FIXTURE_START = 1752969600 - 3600
+
+
+# api.met.no locationforecast compact, cut down to three hourly entries and
+# three six-hourly ones
+MET_NORWAY_RESPONSE = (
+    '{"type":"Feature","geometry":{"type":"Point","coordinates":[-0.1278,51.5074,11]},'
+    '"properties":{"meta":{"updated_at":"2025-07-20T11:31:17Z","units":{'
+    '"air_temperature":"celsius","precipitation_amount":"mm","relative_humidity":"%",'
+    '"wind_speed":"m/s"}},"timeseries":['
+    '{"time":"2025-07-20T12:00:00Z","data":{"instant":{"details":{'
+    '"air_pressure_at_sea_level":1016.2,"air_temperature":20.0,"cloud_area_fraction":71.1,'
+    '"relative_humidity":50.0,"wind_from_direction":240.3,"wind_speed":2.0}},'
+    '"next_12_hours":{"summary":{"symbol_code":"cloudy"},"details":{}},'
+    '"next_1_hours":{"summary":{"symbol_code":"lightrain_day"},'
+    '"details":{"precipitation_amount":0.2}},'
+    '"next_6_hours":{"summary":{"symbol_code":"rain"},'
+    '"details":{"precipitation_amount":2.1}}}},'
+    '{"time":"2025-07-20T13:00:00Z","data":{"instant":{"details":{'
+    '"air_temperature":21.0,"relative_humidity":48.0,"wind_speed":2.4}},'
+    '"next_1_hours":{"summary":{"symbol_code":"clearsky_day"},'
+    '"details":{"precipitation_amount":0.0}}}},'
+    '{"time":"2025-07-20T14:00:00Z","data":{"instant":{"details":{'
+    '"air_temperature":22.0,"relative_humidity":45.0,"wind_speed":2.9}},'
+    '"next_1_hours":{"summary":{"symbol_code":"partlycloudy_day"},'
+    '"details":{"precipitation_amount":0.0}},'
+    '"next_6_hours":{"summary":{"symbol_code":"rainshowers_day"},'
+    '"details":{"precipitation_amount":1.5}}}},'
+    '{"time":"2025-07-20T18:00:00Z","data":{"instant":{"details":{'
+    '"air_temperature":16.0,"relative_humidity":70.0,"wind_speed":1.1}},'
+    '"next_6_hours":{"summary":{"symbol_code":"rainshowers_night"},'
+    '"details":{"precipitation_amount":1.5}}}},'
+    '{"time":"2025-07-21T00:00:00Z","data":{"instant":{"details":{'
+    '"air_temperature":10.0,"relative_humidity":88.0,"wind_speed":0.6}},'
+    '"next_6_hours":{"summary":{"symbol_code":"heavysnow_night"},'
+    '"details":{"precipitation_amount":0.0}}}},'
+    '{"time":"2025-07-21T06:00:00Z","data":{"instant":{"details":{'
+    '"air_temperature":12.0,"relative_humidity":80.0,"wind_speed":1.0}}}}'
+    ']}}'
+)
+
+def f32(value):
+    """Round to IEEE single precision, as the device's float arithmetic does."""
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
+
+def forecast_response():
+    """Mirror of build_forecast_fixture() in test_weather.cpp."""
+    out = []
+    out.append('{"latitude":51.5,"longitude":-0.12000012,"generationtime_ms":0.0680685,'
+               '"utc_offset_seconds":3600,"timezone":"Europe/London",'
+               '"timezone_abbreviation":"GMT+1","elevation":23.0,')
+    out.append('"current_units":{"time":"unixtime","interval":"seconds",'
+               '"temperature_2m":"°C","apparent_temperature":"°C","is_day":"",'
+               '"weather_code":"wmo code"},')
+    out.append('"current":{"time":%d,"interval":900,"temperature_2m":21.4,'
+               '"apparent_temperature":20.9,"is_day":1,"weather_code":3},'
+               % (FIXTURE_START + 14 * 3600))
+
+    out.append('"hourly_units":{"time":"unixtime","temperature_2m":"°C",'
+               '"weather_code":"wmo code","precipitation_probability":"%"},')
+    out.append('"hourly":{"time":[')
+    out.append(",".join(str(FIXTURE_START + i * 3600) for i in range(168)))
+    out.append('],"temperature_2m":[')
+    out.append(",".join("%.1f" % f32(14.0 + f32((i % 24) * f32(0.4))) for i in range(168)))
+    out.append('],"weather_code":[')
+    out.append(",".join(str(61 if (i * 7) % 4 == 0 else 3) for i in range(168)))
+    out.append('],"precipitation_probability":[')
+    out.append(",".join(str((i * 13) % 100) for i in range(168)))
+    out.append(']},')
+
+    out.append('"daily_units":{"time":"unixtime","temperature_2m_max":"°C",'
+               '"temperature_2m_min":"°C","weather_code":"wmo code"},')
+    out.append('"daily":{"time":[')
+    out.append(",".join(str(FIXTURE_START + i * 86400) for i in range(7)))
+    out.append('],"temperature_2m_max":[23.1,24.6,22.0,19.8,21.3,25.7,26.2],'
+               '"temperature_2m_min":[14.2,15.0,13.9,12.1,12.8,15.5,16.4],'
+               '"weather_code":[3,61,80,63,2,1,0]}}')
+    return "".join(out).encode("utf-8")
+
+
+def c_array(name, data):
+    lines = ["static const uint8_t %s[] = {" % name]
+    for offset in range(0, len(data), 16):
+        chunk = ", ".join("0x%02x" % byte for byte in data[offset:offset + 16])
+        lines.append("    %s," % chunk)
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def c_string(name, text):
+    escaped = text.replace("\\", "\\\\").replace('"', '\\"')
+    lines = ["static const char %s[] =" % name]
+    # Lines of up to 96 characters, never splitting an escape from its backslash
+    line = ""
+    for unit in re.findall(r"\\.|.", escaped, re.DOTALL):
+        if len(line) + len(unit) > 96:
+            lines.append('    "%s"' % line)
+            line = ""
+        line += unit
+    lines.append('    "%s"' % line)
+    lines[-1] += ";"
+    return "\n".join(lines)
+
+
+def main():
+    output = Path(sys.argv[1]) if len(sys.argv) > 1 else DEFAULT_OUTPUT
+
+    forecast = forecast_response()
+    geocoding = GEOCODING_RESPONSE.encode("utf-8")
+    met_norway = MET_NORWAY_RESPONSE.encode("utf-8")
+    # mtime=0 keeps the output reproducible
+    forecast_gzip = gzip.compress(forecast, compresslevel=9, mtime=0)
+    forecast_deflate = zlib.compress(forecast, 9)
+    geocoding_gzip = gzip.compress(geocoding, compresslevel=9, mtime=0)
+
+    parts = [
+        "// Generated by tools/make_weather_fixtures.py - do not edit",
+        "#ifndef TEST_WEATHER_FIXTURES_H",
+        "#define TEST_WEATHER_FIXTURES_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "// Forecast body: %d bytes plain, %d gzip, %d deflate"
+        % (len(forecast), len(forecast_gzip), len(forecast_deflate)),
+        c_array("FORECAST_JSON_GZIP", forecast_gzip),
+        "",
+        c_array("FORECAST_JSON_DEFLATE", forecast_deflate),
+        "",
+        "// Geocoding body: %d bytes plain, %d gzip" % (len(geocoding), len(geocoding_gzip)),
+        c_string("GEOCODING_JSON", GEOCODING_RESPONSE),
+        "",
+        c_array("GEOCODING_JSON_GZIP", geocoding_gzip),
+        "",
+        "// MET Norway locationforecast compact body: %d bytes plain" % len(met_norway),
+        c_string("MET_NORWAY_JSON", MET_NORWAY_RESPONSE),
+        "",
+        "#endif // TEST_WEATHER_FIXTURES_H",
+        "",
+    ]
+    output.write_text("\n".join(parts))
+    print("Wrote %s (forecast %d -> %d gzip bytes, geocoding %d -> %d gzip bytes)"
+          % (output, len(forecast), len(forecast_gzip), len(geocoding), len(geocoding_gzip)))
+
+
+if __name__ == "__main__":
+    main()
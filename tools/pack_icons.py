@@ -0,0 +1,274 @@
+#!/usr/bin/env python3
+"""
+Pack the 20x20 forecast icons into one atlas of 4-bit indexed images.
+
+Each aura/src/assets/images/icons/icon_NAME.c (RGB565A8, 1200 bytes) is
+quantised to its own palette of 16 ARGB8888 colours, the form LVGL's
+LV_COLOR_FORMAT_I4 expects: the palette followed by two pixels per byte,
+first pixel in the high nibble. All of them go back to back into a single
+array in aura/src/assets/images/atlas/icon_atlas.c, with one
+lv_image_dsc_t slice per icon, icon_NAME_atlas, pointing into it.
+
+The icons are multi-coloured (up to 48 colours each, plus anti-aliased
+edges), so a shared alpha-only A4 atlas recoloured at draw time would lose
+them; sixteen colours per icon keeps them. Colours are chosen by k-means
+over the premultiplied pixels, so edges keep their alpha and the icons
+still draw correctly over any backdrop.
+
+The report gives each icon's PSNR and largest channel error when drawn
+over the forecast boxes (FORECAST_BOX_COLOR in config.h); the tool fails
+if any icon falls below --min-psnr, and `make test/ui` checks LVGL's
+rendering of the atlas against the originals.
+
+Usage: python3 tools/pack_icons.py [--min-psnr DB] [--check]
+"""
+
+import argparse
+import math
+import random
+import re
+import struct
+import sys
+from pathlib import Path
+
+# Shares the array parsing and formatting with compress_images.py
+sys.dont_write_bytecode = True
+sys.path.insert(0, str(Path(__file__).resolve().parent))
+import compress_images  # noqa: E402
+
+ROOT = Path(__file__).resolve().parent.parent
+CONFIG = ROOT / "aura/src/config.h"
+SOURCE_DIR = ROOT / "aura/src/assets/images/icons"
+OUTPUT = ROOT / "aura/src/assets/images/atlas/icon_atlas.c"
+
+COLORS = 16
+TRIES = 4
+ITERATIONS = 40
+
+HEADER = """\
+// Generated by tools/pack_icons.py from aura/src/assets/images/icons: each
+// icon as a 4-bit indexed (LV_COLOR_FORMAT_I4) slice of one array, a
+// 16-colour ARGB8888 palette followed by the pixels. Do not edit.
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+  #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_ICON_ATLAS
+  #define LV_ATTRIBUTE_ICON_ATLAS
+#endif
+
+static const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_ICON_ATLAS uint8_t
+    icon_atlas_map[] = {{{data}}};
+"""
+
+SLICE = """
+const lv_image_dsc_t {name} = {{
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_I4,
+    .header.flags = 0,
+    .header.w = {width},
+    .header.h = {height},
+    .header.stride = {stride},
+    .header.reserved_2 = 0,
+    .data_size = {size},
+    .data = icon_atlas_map + {offset},
+    .reserved = NULL,
+}};
+"""
+
+
+def config_value(text, name):
+    match = re.search(rf"#define\s+{name}\s+(\w+)", text)
+    if not match:
+        sys.exit(f"error: {name} is not defined in {CONFIG}")
+    return int(match.group(1), 0)
+
+
+def load(path):
+    """The icon's size and its pixels as (r, g, b, a) with 8-bit channels."""
+    text = path.read_text()
+    if "LV_COLOR_FORMAT_RGB565A8" not in text:
+        sys.exit(f"error: {path} is not RGB565A8")
+    width = int(re.search(r"\.header\.w\s*=\s*(\d+)", text).group(1))
+    height = int(re.search(r"\.header\.h\s*=\s*(\d+)", text).group(1))
+    stride = int(re.search(r"\.header\.stride\s*=\s*(\d+)", text).group(1))
+    array = compress_images.ARRAY_RE.search(text).group(2)
+    data = bytes(int(value, 16) for value in re.findall(r"0x([0-9a-fA-F]{2})", array))
+    if "LV_IMAGE_FLAGS_COMPRESSED" in text:
+        data = compress_images.decompress(data, 2)
+
+    alpha_plane = data[stride * height:]
+    pixels = []
+    for y in range(height):
+        for x in range(width):
+            (color,) = struct.unpack_from("<H", data, y * stride + x * 2)
+            red, green, blue = color >> 11, (color >> 5) & 0x3F, color & 0x1F
+            pixels.append(((red << 3) | (red >> 2), (green << 2) | (green >> 4),
+                           (blue << 3) | (blue >> 2), alpha_plane[y * width + x]))
+    return width, height, pixels
+
+
+def premultiply(pixel):
+    red, green, blue, alpha = pixel
+    return (red * alpha / 255, green * alpha / 255, blue * alpha / 255, float(alpha))
+
+
+def distance(a, b):
+    return sum((x - y) ** 2 for x, y in zip(a, b))
+
+
+def nearest(point, centres):
+    return min(range(len(centres)), key=lambda i: distance(point, centres[i]))
+
+
+def kmeans(points, weights, centres):
+    for _ in range(ITERATIONS):
+        sums = [[0.0] * 5 for _ in centres]
+        for point, weight in zip(points, weights):
+            total = sums[nearest(point, centres)]
+            for channel in range(4):
+                total[channel] += point[channel] * weight
+            total[4] += weight
+        moved = [tuple(value / total[4] for value in total[:4]) if total[4] else centre
+                 for total, centre in zip(sums, centres)]
+        if moved == centres:
+            break
+        centres = moved
+    error = sum(weight * min(distance(point, centre) for centre in centres)
+                for point, weight in zip(points, weights))
+    return centres, error
+
+
+def quantise(pixels, seed):
+    """Up to COLORS premultiplied centres, the best of TRIES k-means++ runs."""
+    counts = {}
+    for pixel in pixels:
+        point = premultiply(pixel)
+        counts[point] = counts.get(point, 0) + 1
+    points = sorted(counts)
+    weights = [counts[point] for point in points]
+    if len(points) <= COLORS:
+        return points
+
+    rng = random.Random(seed)
+    best = None
+    for _ in range(TRIES):
+        centres = [rng.choices(points, weights)[0]]
+        while len(centres) < COLORS:
+            spread = [weight * min(distance(point, centre) for centre in centres)
+                      for point, weight in zip(points, weights)]
+            centres.append(rng.choices(points, spread)[0])
+        centres, error = kmeans(points, weights, centres)
+        if best is None or error < best[1]:
+            best = (centres, error)
+    return best[0]
+
+
+def palette_entry(centre):
+    """A premultiplied centre as a straight ARGB8888 colour on the RGB565 grid,
+    so opaque pixels of one colour come back exactly."""
+    alpha = min(255, max(0, round(centre[3])))
+    if alpha == 0:
+        return (0, 0, 0, 0)
+    red, green, blue = (min(255, max(0, value * 255 / alpha)) for value in centre[:3])
+    red, green, blue = round(red * 31 / 255), round(green * 63 / 255), round(blue * 31 / 255)
+    return ((red << 3) | (red >> 2), (green << 2) | (green >> 4), (blue << 3) | (blue >> 2), alpha)
+
+
+def over(pixel, backdrop):
+    alpha = pixel[3] / 255
+    return [value * alpha + base * (1 - alpha) for value, base in zip(pixel[:3], backdrop)]
+
+
+def quality(original, packed, backdrop):
+    """PSNR and the largest 8-bit channel error of the icon drawn over backdrop."""
+    squared = 0.0
+    worst = 0.0
+    for before, after in zip(original, packed):
+        for a, b in zip(over(before, backdrop), over(after, backdrop)):
+            squared += (a - b) ** 2
+            worst = max(worst, abs(a - b))
+    mean = squared / (3 * len(original))
+    return (99.0 if mean == 0 else 10 * math.log10(255 ** 2 / mean)), worst
+
+
+def pack(path, backdrop):
+    width, height, pixels = load(path)
+    centres = quantise(pixels, path.stem)
+    palette = [palette_entry(centre) for centre in centres]
+    palette += [(0, 0, 0, 0)] * (COLORS - len(palette))
+
+    # Each pixel takes the entry that looks closest once premultiplied
+    entries = [premultiply(entry) for entry in palette]
+    indices = [nearest(premultiply(pixel), entries) for pixel in pixels]
+    stride = (width + 1) // 2
+    data = bytearray()
+    for red, green, blue, alpha in palette:
+        data += bytes((blue, green, red, alpha))  # lv_color32_t
+    for y in range(height):
+        row = indices[y * width:(y + 1) * width] + [0]
+        data += bytes((row[x] << 4) | row[x + 1] for x in range(0, width, 2))
+
+    psnr, worst = quality(pixels, [palette[index] for index in indices], backdrop)
+    colors = len(set(pixels))
+    return width, height, stride, bytes(data), psnr, worst, colors
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--min-psnr", type=float, default=30.0,
+                        help="fail if an icon drawn over the forecast box falls below this")
+    parser.add_argument("--check", action="store_true",
+                        help="report sizes and quality without writing the atlas")
+    args = parser.parse_args()
+
+    config = CONFIG.read_text()
+    box = config_value(config, "FORECAST_BOX_COLOR")
+    backdrop = ((box >> 16) & 0xFF, (box >> 8) & 0xFF, box & 0xFF)
+
+    sources = sorted(SOURCE_DIR.glob("icon_*.c"))
+    atlas = bytearray()
+    slices = []
+    before = 0
+    lowest = None
+    print(f"{'icon':40} {'colours':>7} {'bytes':>11} {'PSNR dB':>8} {'max err':>7}")
+    for path in sources:
+        width, height, stride, data, psnr, worst, colors = pack(path, backdrop)
+        raw = width * height * 3
+        before += raw
+        slices.append(SLICE.format(name=path.stem + "_atlas", width=width, height=height,
+                                   stride=stride, size=len(data), offset=len(atlas)))
+        atlas += data
+        if lowest is None or psnr < lowest[0]:
+            lowest = (psnr, path.stem)
+        print(f"{path.stem:40} {colors:7} {raw:5} -> {len(data):3} {psnr:8.1f} {worst:7.0f}")
+    print(f"{len(sources)} icons: {before} bytes RGB565A8, {len(atlas)} bytes I4 atlas "
+          f"({100 - 100 * len(atlas) // max(before, 1)}% saved); lowest {lowest[0]:.1f} dB "
+          f"({lowest[1]})")
+
+    if lowest[0] < args.min_psnr:
+        sys.exit(f"error: {lowest[1]} is {lowest[0]:.1f} dB, below --min-psnr {args.min_psnr}")
+    if not args.check:
+        OUTPUT.parent.mkdir(exist_ok=True)
+        OUTPUT.write_text(HEADER.format(data=compress_images.format_array(atlas))
+                          + "".join(slices))
+
+
+if __name__ == "__main__":
+    main()
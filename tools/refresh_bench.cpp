@@ -0,0 +1,711 @@
+// End-to-end weather refresh benchmark on Linux. Built and run by
+// `make bench/refresh`; options go in BENCH_ARGS.
+//
+// The weather component is compiled unchanged against the shims in
+// tools/host_shims, and every API host is routed to a mock server on
+// 127.0.0.1 that replays the recorded responses from
+// test_weather_fixtures.h (or from --replay DIR). The mock can add time to
+// first byte, cap bandwidth and inject failures. Each refresh reports its
+// wall time, heap allocations, peak heap growth and the time spent
+// inflating and parsing the same body from memory.
+//
+// The shims speak plain HTTP, so wall times carry no TLS cost; they are for
+// comparing builds of the parsing and request code, not for predicting the
+// device's absolute numbers.
+
+#include "weather.h"
+#include "http_timing.h"
+#include "test_weather_fixtures.h"
+#include <WiFi.h>
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <malloc.h>
+#include <mutex>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <random>
+#include <sstream>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include <zlib.h>
+
+// Heap accounting: every allocation made by the benchmark thread while a
+// refresh is measured. The mock server's threads are never counted.
+
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* pointer, size_t size);
+extern "C" void __libc_free(void* pointer);
+
+struct HeapCounters {
+    uint64_t allocations;
+    uint64_t allocated_bytes;
+    int64_t live_bytes;  // Relative to the start of the measurement
+    int64_t peak_bytes;
+};
+
+static thread_local bool heap_counting = false;
+static thread_local HeapCounters heap_counters;
+
+static void countAllocation(void* pointer) {
+    if (!heap_counting || !pointer) {
+        return;
+    }
+    size_t size = malloc_usable_size(pointer);
+    heap_counters.allocations++;
+    heap_counters.allocated_bytes += size;
+    heap_counters.live_bytes += size;
+    heap_counters.peak_bytes = std::max(heap_counters.peak_bytes, heap_counters.live_bytes);
+}
+
+static void countFree(void* pointer) {
+    if (heap_counting && pointer) {
+        heap_counters.live_bytes -= malloc_usable_size(pointer);
+    }
+}
+
+extern "C" void* malloc(size_t size) {
+    void* pointer = __libc_malloc(size);
+    countAllocation(pointer);
+    return pointer;
+}
+
+extern "C" void* calloc(size_t count, size_t size) {
+    void* pointer = __libc_calloc(count, size);
+    countAllocation(pointer);
+    return pointer;
+}
+
+extern "C" void* realloc(void* pointer, size_t size) {
+    countFree(pointer);
+    void* resized = __libc_realloc(pointer, size);
+    countAllocation(resized);
+    return resized;
+}
+
+extern "C" void free(void* pointer) {
+    countFree(pointer);
+    __libc_free(pointer);
+}
+
+static void startHeapCount() {
+    heap_counters = {};
+    heap_counting = true;
+}
+
+static HeapCounters stopHeapCount() {
+    heap_counting = false;
+    return heap_counters;
+}
+
+static void sleepMs(uint32_t ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+static uint64_t nowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static std::string gzipBody(const std::string& body) {
+    z_stream stream = {};
+    deflateInit2(&stream, 6, Z_DEFLATED, 31, 8, Z_DEFAULT_STRATEGY);
+    std::string out(deflateBound(&stream, body.size()), '\0');
+    stream.next_in = (Bytef*) body.data();
+    stream.avail_in = body.size();
+    stream.next_out = (Bytef*) &out[0];
+    stream.avail_out = out.size();
+    deflate(&stream, Z_FINISH);
+    out.resize(stream.total_out);
+    deflateEnd(&stream);
+    return out;
+}
+
+static std::string gunzipBody(const uint8_t* data, size_t length) {
+    z_stream stream = {};
+    inflateInit2(&stream, 31);
+    std::string out;
+    char buffer[4096];
+    stream.next_in = (Bytef*) data;
+    stream.avail_in = length;
+    int result = Z_OK;
+    while (result == Z_OK) {
+        stream.next_out = (Bytef*) buffer;
+        stream.avail_out = sizeof(buffer);
+        result = inflate(&stream, Z_NO_FLUSH);
+        out.append(buffer, sizeof(buffer) - stream.avail_out);
+    }
+    inflateEnd(&stream);
+    return out;
+}
+
+static bool readFile(const std::string& path, std::string& out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::stringstream contents;
+    contents << file.rdbuf();
+    out = contents.str();
+    return true;
+}
+
+// Recorded response bodies, one location each
+struct Recordings {
+    std::string forecast;
+    std::string current;
+    std::string geocoding;
+    std::string met_norway;
+
+    void loadFixtures() {
+        forecast = gunzipBody(FORECAST_JSON_GZIP, sizeof(FORECAST_JSON_GZIP));
+        // A current-only request gets the same document without the series
+        size_t series = forecast.find(",\"hourly_units\"");
+        current = forecast.substr(0, series) + "}";
+        geocoding = GEOCODING_JSON;
+        met_norway = MET_NORWAY_JSON;
+    }
+
+    // Any of forecast.json, current.json, geocoding.json and met_norway.json
+    // in dir replaces the fixture
+    void loadReplay(const std::string& dir) {
+        readFile(dir + "/forecast.json", forecast);
+        readFile(dir + "/current.json", current);
+        readFile(dir + "/geocoding.json", geocoding);
+        readFile(dir + "/met_norway.json", met_norway);
+    }
+
+    // Open-Meteo answers several coordinates with an array of documents
+    std::string openMeteo(bool full, size_t locations) const {
+        const std::string& one = full ? forecast : current;
+        if (locations == 1) {
+            return one;
+        }
+        std::string batch = "[";
+        for (size_t i = 0; i < locations; i++) {
+            batch += (i ? "," : "") + one;
+        }
+        return batch + "]";
+    }
+};
+
+enum MockFault { FAULT_STATUS, FAULT_RESET, FAULT_STALL };
+
+struct MockOptions {
+    uint32_t latency_ms = 0;     // Added before the status line
+    uint32_t jitter_ms = 0;      // Uniformly spread on top of the latency
+    uint32_t bandwidth_kbps = 0; // 0 for unlimited
+    float error_rate = 0;        // Fraction of responses that fail
+    MockFault fault = FAULT_STATUS;
+    bool gzip = true;
+    uint32_t seed = 1;
+};
+
+// Serves the recordings on 127.0.0.1 to every routed host, over kept-alive
+// connections, with chunked bodies compressed when the client accepts it.
+class MockServer {
+public:
+    MockServer(const Recordings& recordings, const MockOptions& options)
+        : recordings_(recordings), options_(options), random_(options.seed) {}
+
+    bool start() {
+        listener_ = socket(AF_INET, SOCK_STREAM, 0);
+        int reuse = 1;
+        setsockopt(listener_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+        if (bind(listener_, (sockaddr*) &address, sizeof(address)) < 0 ||
+            listen(listener_, 16) < 0 ||
+            getsockname(listener_, (sockaddr*) &address, &length) < 0) {
+            return false;
+        }
+        port_ = ntohs(address.sin_port);
+        std::thread([this] { acceptLoop(); }).detach();
+        return true;
+    }
+
+    uint16_t port() const { return port_; }
+    uint32_t served() const { return served_; }
+    uint32_t faults() const { return faults_; }
+
+private:
+    const Recordings& recordings_;
+    MockOptions options_;
+    std::mutex random_lock_;
+    std::mt19937 random_;
+    int listener_ = -1;
+    uint16_t port_ = 0;
+    std::atomic<uint32_t> served_{0};
+    std::atomic<uint32_t> faults_{0};
+
+    void acceptLoop() {
+        for (;;) {
+            int connection = accept(listener_, nullptr, nullptr);
+            if (connection < 0) {
+                return;
+            }
+            int noDelay = 1;
+            setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+            std::thread([this, connection] { serve(connection); }).detach();
+        }
+    }
+
+    void serve(int connection) {
+        std::string pending;
+        for (;;) {
+            size_t end;
+            while ((end = pending.find("\r\n\r\n")) == std::string::npos) {
+                char buffer[1024];
+                ssize_t received = recv(connection, buffer, sizeof(buffer), 0);
+                if (received <= 0) {
+                    close(connection);
+                    return;
+                }
+                pending.append(buffer, received);
+            }
+            std::string head = pending.substr(0, end);
+            pending.erase(0, end + 4);
+            if (!respond(connection, head)) {
+                close(connection);
+                return;
+            }
+        }
+    }
+
+    // Returns false once the connection has been closed or should be
+    bool respond(int connection, const std::string& head) {
+        size_t space = head.find(' ');
+        std::string path = head.substr(space + 1, head.find(' ', space + 1) - space - 1);
+        bool gzip = options_.gzip && head.find("gzip") != std::string::npos;
+
+        uint32_t delay = options_.latency_ms;
+        bool fail;
+        {
+            std::lock_guard<std::mutex> guard(random_lock_);
+            if (options_.jitter_ms) {
+                delay += random_() % (options_.jitter_ms + 1);
+            }
+            fail = std::uniform_real_distribution<float>(0, 1)(random_) < options_.error_rate;
+        }
+
+        int status = 200;
+        std::string body;
+        if (path.rfind("/v1/forecast", 0) == 0) {
+            if (path.find("format=flatbuffers") != std::string::npos) {
+                // Nothing recorded to replay; the client falls back to JSON
+                status = 400;
+                body = "{\"error\":true,\"reason\":\"FlatBuffers not recorded\"}";
+            } else {
+                size_t query = path.find("latitude=");
+                size_t locations = 1;
+                for (size_t i = query; i < path.size() && path[i] != '&'; i++) {
+                    locations += path[i] == ',';
+                }
+                body = recordings_.openMeteo(path.find("&daily=") != std::string::npos,
+                                             locations);
+            }
+        } else if (path.rfind("/v1/search", 0) == 0) {
+            body = recordings_.geocoding;
+        } else if (path.rfind("/weatherapi/locationforecast", 0) == 0) {
+            body = recordings_.met_norway;
+        } else {
+            status = 404;
+        }
+
+        sleepMs(delay);
+        served_++;
+        if (fail && options_.fault == FAULT_STATUS) {
+            faults_++;
+            const char* unavailable = "HTTP/1.1 503 Service Unavailable\r\n"
+                                      "Content-Length: 0\r\nConnection: keep-alive\r\n\r\n";
+            return sendAll(connection, unavailable, strlen(unavailable), false);
+        }
+        if (fail && options_.fault == FAULT_STALL) {
+            // Long enough for the client's I/O timeout to give up first
+            faults_++;
+            sleepMs(HTTPS_IO_TIMEOUT_MS + 1000);
+            return false;
+        }
+        if (status != 200) {
+            std::string response = "HTTP/1.1 " + std::to_string(status) +
+                                   " Error\r\nContent-Type: application/json\r\n"
+                                   "Content-Length: " +
+                                   std::to_string(body.size()) +
+                                   "\r\nConnection: keep-alive\r\n\r\n" + body;
+            return sendAll(connection, response.data(), response.size(), false);
+        }
+
+        if (gzip) {
+            body = gzipBody(body);
+        }
+        std::string response = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n"
+                               "Transfer-Encoding: chunked\r\n";
+        response += gzip ? "Content-Encoding: gzip\r\n" : "";
+        response += "Connection: keep-alive\r\nKeep-Alive: timeout=60\r\n\r\n";
+        // A reset cuts the body off half way through
+        size_t length = fail ? body.size() / 2 : body.size();
+        for (size_t offset = 0; offset < length; offset += 1024) {
+            size_t chunk = std::min<size_t>(1024, length - offset);
+            char size[16];
+            snprintf(size, sizeof(size), "%zx\r\n", chunk);
+            response += size;
+            response.append(body, offset, chunk);
+            response += "\r\n";
+        }
+        if (fail) {
+            faults_++;
+            sendAll(connection, response.data(), response.size(), true);
+            return false;
+        }
+        response += "0\r\n\r\n";
+        return sendAll(connection, response.data(), response.size(), true);
+    }
+
+    bool sendAll(int connection, const char* data, size_t length, bool throttled) {
+        uint64_t start = nowUs();
+        size_t sent = 0;
+        while (sent < length) {
+            size_t slice = std::min<size_t>(1024, length - sent);
+            ssize_t count = send(connection, data + sent, slice, MSG_NOSIGNAL);
+            if (count <= 0) {
+                return false;
+            }
+            sent += count;
+            if (throttled && options_.bandwidth_kbps) {
+                // Hold the average at the cap: kbit/s is bytes per 8 ms
+                uint64_t due = start + sent * 8000ULL / options_.bandwidth_kbps;
+                uint64_t now = nowUs();
+                if (due > now) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(due - now));
+                }
+            }
+        }
+        return true;
+    }
+};
+
+// A recorded body in memory, standing in for the HTTP body stream
+class MemoryStream : public Stream {
+public:
+    explicit MemoryStream(const std::string& data) : data_(data), position_(0) {
+        setTimeout(0);
+    }
+
+    int available() override { return data_.size() - position_; }
+    int read() override { return position_ < data_.size() ? (uint8_t) data_[position_++] : -1; }
+    int peek() override { return position_ < data_.size() ? (uint8_t) data_[position_] : -1; }
+    size_t readBytes(char* buffer, size_t length) override {
+        size_t count = std::min(length, data_.size() - position_);
+        memcpy(buffer, data_.data() + position_, count);
+        position_ += count;
+        return count;
+    }
+    size_t write(uint8_t) override { return 0; }
+
+private:
+    const std::string& data_;
+    size_t position_;
+};
+
+enum Operation { OP_FORECAST, OP_CURRENT, OP_SEARCH, OP_COUNT };
+
+static const char* OPERATION_NAMES[OP_COUNT] = {"forecast", "current", "search"};
+
+struct Sample {
+    bool ok;
+    uint64_t wall_us;
+    uint64_t parse_us;
+    HeapCounters heap;
+    uint32_t wire_bytes;
+};
+
+struct Options {
+    MockOptions mock;
+    uint32_t runs = 20;
+    uint32_t warmup = 1;
+    uint8_t favourites = 1;
+    bool hedged = false;
+    bool verbose = false;
+    std::string replay;
+    std::string csv;
+};
+
+static void usage() {
+    printf("Usage: refresh_bench [--runs N] [--warmup N] [--favourites 1-%d] [--hedged]\n"
+           "                     [--latency MS] [--jitter MS] [--bandwidth KBPS] [--identity]\n"
+           "                     [--error-rate FRACTION] [--fault status|reset|stall]\n"
+           "                     [--seed N] [--replay DIR] [--csv FILE] [--verbose]\n",
+           WEATHER_MAX_FAVOURITES);
+}
+
+static bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string flag = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool takesValue = true;
+        if (flag == "--hedged") {
+            options.hedged = true;
+            takesValue = false;
+        } else if (flag == "--identity") {
+            options.mock.gzip = false;
+            takesValue = false;
+        } else if (flag == "--verbose") {
+            options.verbose = true;
+            takesValue = false;
+        } else if (!value) {
+            return false;
+        } else if (flag == "--runs") {
+            options.runs = atoi(value);
+        } else if (flag == "--warmup") {
+            options.warmup = atoi(value);
+        } else if (flag == "--favourites") {
+            options.favourites = std::max(1, std::min(atoi(value), WEATHER_MAX_FAVOURITES));
+        } else if (flag == "--latency") {
+            options.mock.latency_ms = atoi(value);
+        } else if (flag == "--jitter") {
+            options.mock.jitter_ms = atoi(value);
+        } else if (flag == "--bandwidth") {
+            options.mock.bandwidth_kbps = atoi(value);
+        } else if (flag == "--error-rate") {
+            options.mock.error_rate = atof(value);
+        } else if (flag == "--fault") {
+            std::string fault = value;
+            if (fault == "status") {
+                options.mock.fault = FAULT_STATUS;
+            } else if (fault == "reset") {
+                options.mock.fault = FAULT_RESET;
+            } else if (fault == "stall") {
+                options.mock.fault = FAULT_STALL;
+            } else {
+                return false;
+            }
+        } else if (flag == "--seed") {
+            options.mock.seed = atoi(value);
+        } else if (flag == "--replay") {
+            options.replay = value;
+        } else if (flag == "--csv") {
+            options.csv = value;
+        } else {
+            return false;
+        }
+        i += takesValue;
+    }
+    return options.runs > 0;
+}
+
+// Inflates and parses a body from memory the way readForecast() does, so
+// the parse cost can be told apart from the network
+static uint64_t timeParse(Weather& weather, Operation operation, const std::string& body,
+                          bool gzip) {
+    MemoryStream source(body);
+    InflateStream input(source, gzip ? InflateStream::ENCODING_GZIP
+                                     : InflateStream::ENCODING_IDENTITY);
+    LocationResults results;
+    uint64_t start = nowUs();
+    bool ok = input.begin();
+    if (operation == OP_SEARCH) {
+        ok = ok && weather.parseLocationStream(input, results);
+    } else {
+        ok = ok && weather.parseWeatherBatchStream(
+                       input, operation == OP_FORECAST ? WEATHER_TIER_FORECAST
+                                                       : WEATHER_TIER_CURRENT);
+    }
+    uint64_t elapsed = nowUs() - start;
+    if (!ok) {
+        printf("Recorded %s body did not parse\n", OPERATION_NAMES[operation]);
+    }
+    return elapsed;
+}
+
+static Sample refresh(Weather& weather, Operation operation) {
+    Sample sample = {};
+    LocationResults results;
+    uint64_t start = nowUs();
+    startHeapCount();
+    switch (operation) {
+        case OP_FORECAST: sample.ok = weather.fetchWeatherData(WEATHER_TIER_FORECAST); break;
+        case OP_CURRENT: sample.ok = weather.fetchWeatherData(WEATHER_TIER_CURRENT); break;
+        default: sample.ok = weather.searchLocations("London", results); break;
+    }
+    sample.heap = stopHeapCount();
+    sample.wall_us = nowUs() - start;
+    sample.wire_bytes = operation == OP_SEARCH ? 0 : weather.getLastTransferBytes();
+    return sample;
+}
+
+static uint64_t percentile(std::vector<uint64_t> values, float fraction) {
+    if (values.empty()) {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    size_t rank = (size_t) ceilf(fraction * values.size());
+    return values[rank ? rank - 1 : 0];
+}
+
+static void report(Operation operation, const std::vector<Sample>& samples) {
+    std::vector<uint64_t> wall;
+    std::vector<uint64_t> parse;
+    uint64_t allocations = 0;
+    uint64_t allocated = 0;
+    int64_t peak = 0;
+    uint64_t wire = 0;
+    size_t failures = 0;
+    for (const Sample& sample : samples) {
+        parse.push_back(sample.parse_us);
+        if (!sample.ok) {
+            failures++;
+            continue;
+        }
+        wall.push_back(sample.wall_us);
+        allocations += sample.heap.allocations;
+        allocated += sample.heap.allocated_bytes;
+        peak = std::max(peak, sample.heap.peak_bytes);
+        wire += sample.wire_bytes;
+    }
+    size_t ok = std::max<size_t>(wall.size(), 1);
+    printf("%-9s %3zu/%-3zu %8.1f %8.1f %8.1f %8.2f %8.2f %7.1f %9.0f %9lld %7.0f\n",
+           OPERATION_NAMES[operation], wall.size(), samples.size(), percentile(wall, 0.5f) / 1e3,
+           percentile(wall, 0.95f) / 1e3, percentile(wall, 1.0f) / 1e3,
+           percentile(parse, 0.5f) / 1e3, percentile(parse, 0.95f) / 1e3,
+           (double) allocations / ok, (double) allocated / ok, (long long) peak,
+           (double) wire / ok);
+    if (failures) {
+        printf("          %zu failed\n", failures);
+    }
+}
+
+static void reportHttp(const char* host) {
+    HttpTimingSummary s;
+    if (!HttpTimingRing::shared().summarise(host, s)) {
+        return;
+    }
+    printf("%-30s %3u requests, %2u failed, %2u connects; avg ms: connect %u, "
+           "first byte %u, body %u\n",
+           host, s.requests, s.failures, s.handshake.count, s.handshake.avg_ms,
+           s.first_byte.avg_ms, s.body.avg_ms);
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        usage();
+        return 2;
+    }
+    hostLogSetLevel(options.verbose ? ESP_LOG_DEBUG : ESP_LOG_ERROR);
+
+    Recordings recordings;
+    recordings.loadFixtures();
+    if (!options.replay.empty()) {
+        recordings.loadReplay(options.replay);
+    }
+    MockServer server(recordings, options.mock);
+    if (!server.start()) {
+        perror("mock server");
+        return 1;
+    }
+    hostShimRoute(nullptr, "127.0.0.1", server.port());
+
+    static const char* PLACES[][3] = {
+        {"51.5074", "-0.1278", "London"},
+        {"48.8566", "2.3522", "Paris"},
+        {"52.5200", "13.4050", "Berlin"},
+        {"40.4168", "-3.7038", "Madrid"},
+    };
+    Weather weather;
+    if (!weather.init()) {
+        return 1;
+    }
+    weather.updateLocation(PLACES[0][0], PLACES[0][1], PLACES[0][2]);
+    for (uint8_t i = 1; i < options.favourites; i++) {
+        weather.addFavourite(PLACES[i][0], PLACES[i][1], PLACES[i][2]);
+    }
+    weather.setWireFormat(WIRE_FORMAT_JSON);
+    weather.setHedgedFetch(options.hedged);
+
+    // The bodies as sent, for timing the parse on its own
+    std::string bodies[OP_COUNT] = {
+        recordings.openMeteo(true, options.favourites),
+        recordings.openMeteo(false, options.favourites),
+        recordings.geocoding,
+    };
+    if (options.mock.gzip) {
+        for (std::string& body : bodies) {
+            body = gzipBody(body);
+        }
+    }
+
+    printf("Refresh benchmark: %u runs, %u favourite(s), %s, latency %u+%u ms, "
+           "bandwidth %s, errors %.0f%%%s\n",
+           options.runs, options.favourites, options.mock.gzip ? "gzip" : "identity",
+           options.mock.latency_ms, options.mock.jitter_ms,
+           options.mock.bandwidth_kbps ? (std::to_string(options.mock.bandwidth_kbps) +
+                                          " kbit/s").c_str()
+                                       : "unlimited",
+           options.mock.error_rate * 100, options.hedged ? ", hedged" : "");
+
+    for (uint32_t i = 0; i < options.warmup; i++) {
+        for (int operation = 0; operation < OP_COUNT; operation++) {
+            refresh(weather, (Operation) operation);
+        }
+    }
+
+    std::vector<Sample> samples[OP_COUNT];
+    FILE* csv = options.csv.empty() ? nullptr : fopen(options.csv.c_str(), "w");
+    if (csv) {
+        fprintf(csv, "run,operation,ok,wall_us,parse_us,allocations,allocated_bytes,"
+                     "peak_heap_bytes,wire_bytes\n");
+    }
+    for (uint32_t run = 0; run < options.runs; run++) {
+        for (int operation = 0; operation < OP_COUNT; operation++) {
+            Sample sample = refresh(weather, (Operation) operation);
+            sample.parse_us = timeParse(weather, (Operation) operation, bodies[operation],
+                                        options.mock.gzip);
+            samples[operation].push_back(sample);
+            if (csv) {
+                fprintf(csv, "%u,%s,%d,%llu,%llu,%llu,%llu,%lld,%u\n", run,
+                        OPERATION_NAMES[operation], sample.ok,
+                        (unsigned long long) sample.wall_us, (unsigned long long) sample.parse_us,
+                        (unsigned long long) sample.heap.allocations,
+                        (unsigned long long) sample.heap.allocated_bytes,
+                        (long long) sample.heap.peak_bytes, sample.wire_bytes);
+            }
+        }
+    }
+    if (csv) {
+        fclose(csv);
+    }
+
+    printf("\n%-9s %7s %8s %8s %8s %8s %8s %7s %9s %9s %7s\n", "", "ok", "wall p50", "p95",
+           "max ms", "parse50", "p95 ms", "allocs", "alloc B", "peak B", "wire B");
+    for (int operation = 0; operation < OP_COUNT; operation++) {
+        report((Operation) operation, samples[operation]);
+    }
+    printf("\nLast %u requests (mock served %u, %u with injected faults):\n",
+           HTTP_TIMING_RING_SIZE, server.served(), server.faults());
+    reportHttp(WEATHER_API_HOST);
+    reportHttp(GEOCODING_API_HOST);
+    reportHttp(MET_NORWAY_API_HOST);
+
+    // Without injected faults every refresh must succeed
+    bool failed = false;
+    for (int operation = 0; operation < OP_COUNT; operation++) {
+        for (const Sample& sample : samples[operation]) {
+            failed |= !sample.ok;
+        }
+    }
+    if (failed && options.mock.error_rate == 0) {
+        printf("Refresh benchmark FAILED: refreshes failed with no faults injected\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,766 @@
+#!/usr/bin/env python3
+"""
+Cut the UI fonts down to the glyphs the UI can show, at build time.
+
+Each size the UI uses is drawn today from two lv_font_conv outputs: the
+repo's aura/src/assets/fonts/lv_font_montserrat_latin_N.c (the accented
+letters the translations need) falling back to LVGL's built-in
+lv_font_montserrat_N.c (ASCII, degree, bullet and the LV_SYMBOL_* icons).
+This tool merges the two into aura/src/assets/fonts/subset/
+lv_font_montserrat_subset_N.c holding only the glyphs needed, with no
+fallback, and writes font_subset.h, which config.h picks up so UI_FONT(N)
+names the subset fonts.
+
+The glyphs needed are read from aura/src/components/ui/ui.cpp:
+
+- 42 px, the current temperature: digits and minus, plus the characters of
+  every `temp_placeholder` and of the string literals in
+  UI::formatTemperature() (the degree sign and the unit letters).
+- The other sizes: printable ASCII, as clock, numbers and any text built at
+  run time come from it, plus every other character in the string
+  literals of ui.cpp (string tables and format strings).
+
+LV_FONT_DEFAULT's size (lv_conf.h) keeps its built-in font, which LVGL's
+theme links in anyway; that subset keeps only the extra glyphs and still
+falls back to it.
+
+Letters in COMPOSED that neither source has are built from a base letter
+and the accent of another letter, as the latin fonts lack some capitals
+("Ä" in "Ändern") whose accent another capital carries ("Ü"). Otherwise
+the tool fails if a string needs a glyph neither source has, naming the
+string, so the latin fonts can be regenerated with it (lv_font_conv
+--symbols). Each subset is parsed back and checked glyph for glyph and
+kerning pair for kerning pair against its sources. The report gives the
+approximate flash of each font before and after.
+
+One subset serves every language, as the language is switched at run time
+and all of them ship in one firmware. --languages shows what that costs:
+the glyphs beyond ASCII each LocalizedStrings table needs and their
+approximate flash at each size, from the repo's latin fonts alone, so it
+runs without LVGL.
+
+Usage: python3 tools/subset_fonts.py [--lvgl DIR] [--check | --languages]
+"""
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent
+UI_SOURCE = ROOT / "aura/src/components/ui/ui.cpp"
+LV_CONF = ROOT / "lvgl/src/lv_conf.h"
+FONT_DIR = ROOT / "aura/src/assets/fonts"
+OUTPUT_DIR = FONT_DIR / "subset"
+DEFAULT_LVGL = Path.home() / "Arduino/libraries/lvgl"
+
+SIZES = (12, 14, 16, 20, 42)
+TEMPERATURE_SIZE = 42
+PRINTABLE_ASCII = "".join(chr(code) for code in range(0x20, 0x7F))
+
+# Letter: (base letter, letter whose accent it takes)
+COMPOSED = {
+    "Ä": ("A", "Ü"),
+}
+
+# Approximate sizes of the fixed structures on the ESP32
+GLYPH_DSC_BYTES = 8
+CMAP_BYTES = 20
+FONT_BYTES = 64
+
+TOKEN_RE = re.compile(r'"(?:\\.|[^"\\\n])*"|\'(?:\\.|[^\'\\\n])*\'|//[^\n]*|/\*.*?\*/', re.S)
+ESCAPE_RE = re.compile(r"\\(x[0-9a-fA-F]+|[0-7]{1,3}|.)")
+GLYPH_DSC_RE = re.compile(
+    r"\{\s*\.bitmap_index\s*=\s*(\d+)\s*,\s*\.adv_w\s*=\s*(\d+)\s*,\s*\.box_w\s*=\s*(\d+)\s*,"
+    r"\s*\.box_h\s*=\s*(\d+)\s*,\s*\.ofs_x\s*=\s*(-?\d+)\s*,\s*\.ofs_y\s*=\s*(-?\d+)\s*\}")
+FIELD_RE = re.compile(r"\.(\w+)\s*=\s*([^,}\s]+)")
+
+PREAMBLE = """\
+/*******************************************************************************
+ * Size: {size} px
+ * Bpp: {bpp}
+ * Generated by tools/subset_fonts.py from {sources}.
+ * Do not edit; `make generate/fonts` rebuilds it.
+ ******************************************************************************/
+
+#ifdef __has_include
+  #if __has_include("lvgl.h")
+    #ifndef LV_LVGL_H_INCLUDE_SIMPLE
+      #define LV_LVGL_H_INCLUDE_SIMPLE
+    #endif
+  #endif
+#endif
+
+#ifdef LV_LVGL_H_INCLUDE_SIMPLE
+  #include "lvgl.h"
+#else
+  #include "lvgl/lvgl.h"
+#endif
+
+#ifndef {guard}
+  #define {guard} 1
+#endif
+
+#if {guard}
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {{
+{bitmap}}};
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {{
+    /* id = 0 reserved */
+    {{.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0}},
+{glyph_dsc}}};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+{unicode_lists}/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {{
+{cmaps}}};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+{kerning}
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+  #if LVGL_VERSION_MAJOR == 8
+/*Store all the custom data of the font*/
+static lv_font_fmt_txt_glyph_cache_t cache;
+  #endif
+
+  #if LVGL_VERSION_MAJOR >= 8
+static const lv_font_fmt_txt_dsc_t font_dsc = {{
+  #else
+static lv_font_fmt_txt_dsc_t font_dsc = {{
+  #endif
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = {kern_dsc},
+    .kern_scale = {kern_scale},
+    .cmap_num = {cmap_num},
+    .bpp = {bpp},
+    .kern_classes = {kern_classes},
+    .bitmap_format = 0,
+  #if LVGL_VERSION_MAJOR == 8
+    .cache = &cache
+  #endif
+}};
+{fallback_declaration}
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+  #if LVGL_VERSION_MAJOR >= 8
+const lv_font_t {name} = {{
+  #else
+lv_font_t {name} = {{
+  #endif
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt, /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt, /*Function pointer to get glyph's bitmap*/
+    .line_height = {line_height}, /*The maximum line height required by the font*/
+    .base_line = {base_line}, /*Baseline measured from the bottom of the line*/
+  #if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .subpx = LV_FONT_SUBPX_NONE,
+  #endif
+  #if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
+    .underline_position = {underline_position},
+    .underline_thickness = {underline_thickness},
+  #endif
+    .dsc = &font_dsc, /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+  #if LV_VERSION_CHECK(8, 2, 0) || LVGL_VERSION_MAJOR >= 9
+    .fallback = {fallback},
+  #endif
+    .user_data = NULL,
+}};
+
+#endif /*#if {guard}*/
+"""
+
+HEADER = """\
+// Generated by tools/subset_fonts.py: the UI fonts cut down to the glyphs
+// ui.cpp can show. Do not edit; `make generate/fonts` rebuilds it.
+
+#ifndef FONT_SUBSET_H
+#define FONT_SUBSET_H
+
+{declarations}
+#define UI_FONT(size) lv_font_montserrat_subset_##size
+
+#endif // FONT_SUBSET_H
+"""
+
+
+class Glyph:
+    def __init__(self, adv_w, box_w, box_h, ofs_x, ofs_y, bitmap):
+        self.adv_w = adv_w
+        self.box_w = box_w
+        self.box_h = box_h
+        self.ofs_x = ofs_x
+        self.ofs_y = ofs_y
+        self.bitmap = bitmap
+
+    def key(self):
+        return (self.adv_w, self.box_w, self.box_h, self.ofs_x, self.ofs_y, self.bitmap)
+
+
+class Font:
+    """One lv_font_conv C file: its glyphs by code point, kerning and metrics."""
+
+    def __init__(self, path):
+        self.path = path
+        text = strip_comments(path.read_text(encoding="utf-8"))
+        self.name = re.search(r"lv_font_t\s+(\w+)\s*=\s*\{", text).group(1)
+        dsc = block(text, r"lv_font_fmt_txt_dsc_t\s+font_dsc\s*=\s*\{")
+        fields = dict(FIELD_RE.findall(dsc))
+        self.bpp = int(fields["bpp"])
+        self.kern_scale = int(fields.get("kern_scale", "0"))
+        if int(fields.get("bitmap_format", "0")) != 0:
+            sys.exit(f"error: {path}: compressed bitmaps are not supported (--no-compress)")
+        if int(fields.get("stride", "0")) != 0:
+            sys.exit(f"error: {path}: glyph row stride is not supported")
+        public = dict(FIELD_RE.findall(block(text, r"lv_font_t\s+\w+\s*=\s*\{")))
+        self.metrics = {key: int(public.get(key, "0")) for key in
+                        ("line_height", "base_line", "underline_position",
+                         "underline_thickness")}
+
+        bitmap = bytes(array(text, "glyph_bitmap"))
+        dscs = [tuple(int(value) for value in match)
+                for match in GLYPH_DSC_RE.findall(block(text, r"glyph_dsc\[\]\s*=\s*\{"))]
+        starts = sorted({dsc[0] for dsc in dscs} | {len(bitmap)})
+        ends = dict(zip(starts, starts[1:]))
+        self.by_id = {}
+        for glyph_id, (index, adv_w, box_w, box_h, ofs_x, ofs_y) in enumerate(dscs):
+            if glyph_id > 0:
+                self.by_id[glyph_id] = Glyph(adv_w, box_w, box_h, ofs_x, ofs_y,
+                                             bitmap[index:ends.get(index, index)])
+
+        self.ids = {}
+        for cmap in re.findall(r"\{[^{}]*\.range_start[^{}]*\}",
+                               block(text, r"cmaps\[\]\s*=\s*\{")):
+            self.read_cmap(text, dict(FIELD_RE.findall(cmap)))
+        self.glyphs = {code: self.by_id[glyph_id] for code, glyph_id in self.ids.items()
+                       if glyph_id in self.by_id}
+
+        self.kerning = {}
+        kern_dsc = fields.get("kern_dsc", "NULL")
+        if kern_dsc != "NULL" and int(fields.get("kern_classes", "0")):
+            self.read_kern_classes(text)
+        elif kern_dsc != "NULL":
+            self.read_kern_pairs(text)
+
+    def read_cmap(self, text, cmap):
+        start = int(cmap["range_start"])
+        length = int(cmap["range_length"])
+        first = int(cmap["glyph_id_start"])
+        kind = cmap["type"].replace("LV_FONT_FMT_TXT_CMAP_", "")
+        codes = (array(text, cmap["unicode_list"]) if cmap.get("unicode_list", "NULL") != "NULL"
+                 else None)
+        offsets = (array(text, cmap["glyph_id_ofs_list"])
+                   if cmap.get("glyph_id_ofs_list", "NULL") != "NULL" else None)
+        if kind == "FORMAT0_TINY":
+            pairs = [(start + i, first + i) for i in range(length)]
+        elif kind == "FORMAT0_FULL":
+            pairs = [(start + i, first + offsets[i]) for i in range(length)]
+        elif kind == "SPARSE_TINY":
+            pairs = [(start + code, first + i) for i, code in enumerate(codes)]
+        elif kind == "SPARSE_FULL":
+            pairs = [(start + code, first + offsets[i]) for i, code in enumerate(codes)]
+        else:
+            sys.exit(f"error: {self.path}: unknown cmap type {cmap['type']}")
+        for code, glyph_id in pairs:
+            self.ids.setdefault(code, glyph_id)
+
+    def read_kern_classes(self, text):
+        left = array(text, "kern_left_class_mapping")
+        right = array(text, "kern_right_class_mapping")
+        values = array(text, "kern_class_values")
+        opening = r"lv_font_fmt_txt_kern_classes_t\s+\w+\s*=\s*\{"
+        classes = dict(FIELD_RE.findall(block(text, opening)))
+        right_count = int(classes["right_class_cnt"])
+        for left_id in self.by_id:
+            for right_id in self.by_id:
+                left_class, right_class = left[left_id], right[right_id]
+                if left_class and right_class:
+                    value = values[(left_class - 1) * right_count + right_class - 1]
+                    if value:
+                        self.kerning[(left_id, right_id)] = value * self.kern_scale
+
+    def read_kern_pairs(self, text):
+        ids = array(text, "kern_pair_glyph_ids")
+        values = array(text, "kern_pair_values")
+        for i, value in enumerate(values):
+            if value:
+                self.kerning[(ids[2 * i], ids[2 * i + 1])] = value * self.kern_scale
+
+    def kern(self, left, right):
+        """Kerning between two code points, in 1/256 px (value * kern_scale)."""
+        return self.kerning.get((self.ids.get(left), self.ids.get(right)), 0)
+
+    def data_bytes(self):
+        """Approximate flash: bitmaps, descriptors, maps and kerning tables."""
+        text = strip_comments(self.path.read_text(encoding="utf-8"))
+        lists = sum(len(array(text, name)) * 2
+                    for name in re.findall(r"(?:unicode_list|glyph_id_ofs_list)_\d+\b\[\]", text))
+        kerning = sum(len(array(text, name)) for name in
+                      ("kern_left_class_mapping", "kern_right_class_mapping", "kern_class_values",
+                       "kern_pair_glyph_ids", "kern_pair_values") if name + "[]" in text)
+        cmaps = len(re.findall(r"\.range_start\s*=", text))
+        return (len(array(text, "glyph_bitmap")) + GLYPH_DSC_BYTES * (len(self.by_id) + 1)
+                + lists + kerning + CMAP_BYTES * cmaps + FONT_BYTES)
+
+
+def strip_comments(text):
+    return TOKEN_RE.sub(lambda m: " " if m.group(0)[0] == "/" else m.group(0), text)
+
+
+def block(text, opening):
+    """The body of the brace-delimited initialiser that starts with opening;
+    the last one, where #if branches open it twice."""
+    match = None
+    for match in re.finditer(opening, text):
+        pass
+    if not match:
+        sys.exit(f"error: no match for {opening}")
+    depth = 1
+    i = match.end()
+    while depth:
+        depth += {"{": 1, "}": -1}.get(text[i], 0)
+        i += 1
+    return text[match.end():i - 1]
+
+
+def array(text, name):
+    name = name.replace("[]", "")
+    body = block(text, rf"\b{name}\[\]\s*=\s*\{{")
+    return [int(value, 0) for value in re.findall(r"-?(?:0x[0-9a-fA-F]+|\d+)", body)]
+
+
+def unescape(literal):
+    def replace(match):
+        escape = match.group(1)
+        if escape in ("n", "t", "r", "0"):
+            return ""
+        if escape[0] == "x":
+            return chr(int(escape[1:], 16))
+        if escape[0].isdigit():
+            return chr(int(escape, 8))
+        return escape
+    return ESCAPE_RE.sub(replace, literal)
+
+
+def string_literals(text):
+    return [unescape(token[1:-1]) for token in TOKEN_RE.findall(text) if token[0] == '"']
+
+
+def needed_glyphs(source):
+    """The characters each size must have, and for each the string needing it."""
+    strings = string_literals(source)
+    reasons = {}
+    for string in strings:
+        for char in string:
+            reasons.setdefault(char, string)
+    general = {char: reasons.get(char, "printable ASCII") for char in PRINTABLE_ASCII}
+    general.update(reasons)
+
+    temperature = {char: "temperature digits" for char in "0123456789-"}
+    placeholders = re.findall(r'\.temp_placeholder\s*=\s*("(?:\\.|[^"\\])*")', source)
+    body = re.search(r"String UI::formatTemperature\([^)]*\)\s*\{(.*?)\n\}", source, re.S)
+    if not placeholders or not body:
+        sys.exit(f"error: {UI_SOURCE}: temp_placeholder or UI::formatTemperature() not found")
+    for string in string_literals(" ".join(placeholders)) + string_literals(body.group(1)):
+        for char in string:
+            temperature.setdefault(char, string)
+
+    return {size: dict(temperature if size == TEMPERATURE_SIZE else general)
+            for size in SIZES}
+
+
+def language_glyphs(source):
+    """The characters beyond printable ASCII of each LocalizedStrings table,
+    by table name, and those of the other strings of ui.cpp."""
+    tables = {}
+    rest = source
+    for match in re.finditer(r"LocalizedStrings\s+(\w+?)(?:_strings)?\s*=\s*\{", source):
+        body = block(source[match.start():], r"\A" + re.escape(match.group(0)))
+        tables[match.group(1)] = body
+        rest = rest.replace(body, "")
+    chars = {name: {char for string in string_literals(body) for char in string}
+             - set(PRINTABLE_ASCII) for name, body in tables.items()}
+    chars["other"] = ({char for string in string_literals(rest) for char in string}
+                      - set(PRINTABLE_ASCII))
+    return chars
+
+
+def glyph_bytes(glyph):
+    """Approximate flash of one glyph: bitmap, descriptor and map entry."""
+    return len(glyph.bitmap) + GLYPH_DSC_BYTES + 2
+
+
+def report_languages(source):
+    """Prints the glyphs beyond ASCII each language needs and their flash at
+    each size; a COMPOSED letter is counted at the size of its accent's."""
+    chars = language_glyphs(source)
+    sizes = [size for size in SIZES if size != TEMPERATURE_SIZE]
+    fonts = {size: Font(FONT_DIR / f"lv_font_montserrat_latin_{size}.c") for size in sizes}
+
+    def cost(size, text):
+        font = fonts[size]
+        return sum(glyph_bytes(font.glyphs[ord(COMPOSED.get(char, (None, char))[1])])
+                   for char in text if ord(COMPOSED.get(char, (None, char))[1]) in font.glyphs)
+
+    union = set().union(*chars.values())
+    rows = [(name, "".join(sorted(text))) for name, text in chars.items()]
+    rows.append(("all languages", "".join(sorted(union))))
+    print(f"{'strings':14} {'glyphs beyond ASCII':24}"
+          + "".join(f" {f'{size} px':>7}" for size in sizes))
+    for name, text in rows:
+        print(f"{name:14} {text:24}" + "".join(f" {cost(size, text):7}" for size in sizes))
+    shipped = sum(fonts[size].data_bytes() for size in sizes)
+    needed = sum(cost(size, union) for size in sizes)
+    print(f"{len(union)} glyphs beyond ASCII for every language: {needed} bytes at "
+          f"{', '.join(str(size) for size in sizes)} px, of {shipped} in the latin fonts")
+
+
+def default_font_size():
+    match = re.search(r"#define\s+LV_FONT_DEFAULT\s+&lv_font_montserrat_(\d+)\b",
+                      LV_CONF.read_text())
+    return int(match.group(1)) if match else None
+
+
+def c_char(char):
+    return {'"': '\\"', "\\": "\\\\"}.get(char, char)
+
+
+def kern_classes(codes, kern):
+    """Left and right class of each glyph id and the class value table: glyphs
+    whose kerning rows (or columns) match share a class, 0 meaning none."""
+    table = [[kern(left, right) for right in codes] for left in codes]
+    columns = [[row[i] for row in table] for i in range(len(codes))]
+
+    def classify(vectors):
+        classes = {}
+        mapping = [0]
+        for index, vector in enumerate(vectors):
+            if any(vector):
+                classes.setdefault(tuple(vector), index)
+                mapping.append(list(classes).index(tuple(vector)) + 1)
+            else:
+                mapping.append(0)
+        return mapping, list(classes.values())
+
+    left, rows = classify(table)
+    right, cols = classify(columns)
+    if max(len(rows), len(cols)) > 255:
+        sys.exit("error: more than 255 kerning classes")
+    values = [table[row][col] for row in rows for col in cols]
+    return left, right, values, len(rows), len(cols)
+
+
+def format_list(values, indent=4, per_line=16):
+    lines = []
+    for start in range(0, len(values), per_line):
+        chunk = values[start:start + per_line]
+        lines.append(" " * indent + ", ".join(str(value) for value in chunk) + ",")
+    return "\n".join(lines) + "\n"
+
+
+def cmap_segments(codes):
+    """Runs of consecutive code points of eight or more become FORMAT0_TINY
+    ranges; the points between them are SPARSE_TINY lists. Ranges never
+    overlap, as LVGL stops at the first range holding a code point."""
+    runs = []
+    start = 0
+    while start < len(codes):
+        end = start
+        while end + 1 < len(codes) and codes[end + 1] == codes[end] + 1:
+            end += 1
+        runs.append((start, end))
+        start = end + 1
+
+    segments = []
+    sparse = []
+    for start, end in runs:
+        if end - start + 1 >= 8:
+            if sparse:
+                segments.append(("SPARSE_TINY", sparse))
+                sparse = []
+            segments.append(("FORMAT0_TINY", list(range(start, end + 1))))
+        else:
+            sparse += range(start, end + 1)
+    if sparse:
+        segments.append(("SPARSE_TINY", sparse))
+    return segments
+
+
+def unpack(glyph, bpp):
+    """A glyph's pixels as rows; lv_font_conv packs them MSB first with no
+    row padding."""
+    bits = int.from_bytes(glyph.bitmap, "big")
+    total = len(glyph.bitmap) * 8
+    mask = (1 << bpp) - 1
+    pixels = [(bits >> (total - (i + 1) * bpp)) & mask for i in range(glyph.box_w * glyph.box_h)]
+    return [pixels[row * glyph.box_w:(row + 1) * glyph.box_w] for row in range(glyph.box_h)]
+
+
+def pack(rows, bpp):
+    bits = 0
+    count = 0
+    for row in rows:
+        for pixel in row:
+            bits = (bits << bpp) | pixel
+            count += bpp
+    padding = -count % 8
+    return (bits << padding).to_bytes((count + padding) // 8, "big")
+
+
+def compose(base, accented, bpp):
+    """base with the accent of accented: the rows of accented above base's
+    top, at the same height (the two are capitals of one cap height) and as
+    far off base's centre as they are off accented's. None if there are
+    none."""
+    rows = unpack(accented, bpp)
+    cap = base.ofs_y + base.box_h
+    # Row r of accented covers y = ofs_y + box_h - 1 - r, up from the baseline
+    above = accented.ofs_y + accented.box_h - cap
+    accent = rows[:max(above, 0)]
+    columns = [x for x in range(accented.box_w) if any(row[x] for row in accent)]
+    if not columns:
+        return None
+    left, right = columns[0], columns[-1] + 1
+    accent = [row[left:right] for row in accent]
+
+    # Positions in pixels from the pen
+    offset = (left + right) / 2 - accented.box_w / 2
+    accent_x = round(base.ofs_x + base.box_w / 2 + offset - (right - left) / 2)
+    x0 = min(base.ofs_x, accent_x)
+    x1 = max(base.ofs_x + base.box_w, accent_x + right - left)
+    canvas = [[0] * (x1 - x0) for _ in range(len(accent))]
+    canvas += [[0] * (base.ofs_x - x0) + row + [0] * (x1 - base.ofs_x - base.box_w)
+               for row in unpack(base, bpp)]
+    for y, row in enumerate(accent):
+        canvas[y][accent_x - x0:accent_x - x0 + len(row)] = row
+    return Glyph(base.adv_w, x1 - x0, len(canvas), x0, base.ofs_y, pack(canvas, bpp))
+
+
+def render(size, glyphs, kern, kern_scale, bpp, metrics, fallback, sources):
+    """The C source of the subset font; glyphs is a sorted list of
+    (code point, Glyph)."""
+    name = f"lv_font_montserrat_subset_{size}"
+    bitmap = []
+    dscs = []
+    index = 0
+    for code, glyph in glyphs:
+        bitmap.append(f'    /* U+{code:04X} "{c_char(chr(code))}" */\n')
+        if glyph.bitmap:
+            bitmap.append(format_list([f"0x{byte:x}" for byte in glyph.bitmap], per_line=18))
+        bitmap.append("\n")
+        dscs.append(f"    {{.bitmap_index = {index}, .adv_w = {glyph.adv_w}, "
+                    f".box_w = {glyph.box_w}, .box_h = {glyph.box_h}, "
+                    f".ofs_x = {glyph.ofs_x}, .ofs_y = {glyph.ofs_y}}},\n")
+        index += len(glyph.bitmap)
+
+    codes = [code for code, _ in glyphs]
+    unicode_lists = []
+    cmaps = []
+    for kind, members in cmap_segments(codes):
+        first = codes[members[0]]
+        if kind == "SPARSE_TINY":
+            list_name = f"unicode_list_{len(cmaps)}"
+            unicode_lists.append(
+                f"static const uint16_t {list_name}[] = {{\n"
+                + format_list([f"0x{codes[i] - first:x}" for i in members]) + "};\n\n")
+            length = codes[members[-1]] - first + 1
+        else:
+            list_name = "NULL"
+            length = len(members)
+        cmaps.append(f"    {{.range_start = {first}, .range_length = {length}, "
+                     f".glyph_id_start = {members[0] + 1},\n"
+                     f"     .unicode_list = {list_name}, .glyph_id_ofs_list = NULL, "
+                     f".list_length = {len(members) if kind == 'SPARSE_TINY' else 0}, "
+                     f".type = LV_FONT_FMT_TXT_CMAP_{kind}}},\n")
+
+    left, right, values, left_count, right_count = kern_classes(codes, kern)
+    if values:
+        scaled = [round(value / kern_scale) for value in values]
+        kerning = (
+            "/*Map glyph_ids to kern left classes*/\n"
+            "static const uint8_t kern_left_class_mapping[] = {\n" + format_list(left) + "};\n\n"
+            "/*Map glyph_ids to kern right classes*/\n"
+            "static const uint8_t kern_right_class_mapping[] = {\n" + format_list(right)
+            + "};\n\n"
+            "/*Kern values between classes*/\n"
+            "static const int8_t kern_class_values[] = {\n" + format_list(scaled) + "};\n\n"
+            "/*Collect the kern class' data in one place*/\n"
+            "static const lv_font_fmt_txt_kern_classes_t kern_classes = {\n"
+            "    .class_pair_values = kern_class_values,\n"
+            "    .left_class_mapping = kern_left_class_mapping,\n"
+            "    .right_class_mapping = kern_right_class_mapping,\n"
+            f"    .left_class_cnt = {left_count},\n"
+            f"    .right_class_cnt = {right_count},\n"
+            "};\n")
+    else:
+        kerning = "/*No kerning between the glyphs kept*/\n"
+
+    guard = name.upper()
+    return PREAMBLE.format(
+        size=size, bpp=bpp, sources=sources, guard=guard, bitmap="".join(bitmap),
+        glyph_dsc="".join(dscs), unicode_lists="".join(unicode_lists), cmaps="".join(cmaps),
+        kerning=kerning, kern_dsc="&kern_classes" if values else "NULL",
+        kern_scale=kern_scale if values else 0, cmap_num=len(cmaps),
+        kern_classes=1 if values else 0,
+        fallback_declaration=(f"\nextern const lv_font_t {fallback};\n\n" if fallback else "\n"),
+        name=name, fallback=f"&{fallback}" if fallback else "NULL", **metrics)
+
+
+def subset(size, needed, lvgl, default_size):
+    """Writes nothing; returns the subset's C source and a report line."""
+    latin = Font(FONT_DIR / f"lv_font_montserrat_latin_{size}.c")
+    builtin = Font(lvgl / f"src/font/lv_font_montserrat_{size}.c")
+    if latin.bpp != builtin.bpp:
+        sys.exit(f"error: {size} px: the latin font is {latin.bpp} bpp, LVGL's {builtin.bpp}")
+
+    # The latin font is the label's font; LVGL's only fills its gaps
+    keep_fallback = size == default_size
+    composed = compose_missing(needed, latin, builtin, keep_fallback)
+    missing = {char: reason for char, reason in needed.items()
+               if ord(char) not in latin.glyphs and ord(char) not in builtin.glyphs}
+    if missing:
+        for char, reason in sorted(missing.items()):
+            print(f"error: {size} px has no glyph for {char!r} (U+{ord(char):04X}), "
+                  f"needed by \"{reason}\"", file=sys.stderr)
+        sys.exit(f"error: add {''.join(sorted(missing))} to the --symbols of "
+                 f"lv_font_montserrat_latin_*.c (lv_font_conv) and rerun")
+
+    owners = {}
+    for char in needed:
+        code = ord(char)
+        if code in latin.glyphs:
+            owners[code] = latin
+        elif not keep_fallback:
+            owners[code] = builtin
+    codes = sorted(owners)
+    glyphs = [(code, owners[code].glyphs[code]) for code in codes]
+
+    # Kerning only applies within one font, as it does across a fallback
+    kern_scale = max(latin.kern_scale, builtin.kern_scale, 1)
+
+    def kern(left, right):
+        font = owners[left]
+        return font.kern(left, right) if owners[right] is font else 0
+
+    sources = (f"lv_font_montserrat_latin_{size}.c" if keep_fallback else
+               f"lv_font_montserrat_latin_{size}.c and LVGL's lv_font_montserrat_{size}.c")
+    text = render(size, glyphs, kern, kern_scale, latin.bpp, latin.metrics,
+                  builtin.name if keep_fallback else None, sources)
+    before = latin.data_bytes() + (0 if keep_fallback else builtin.data_bytes())
+    return text, glyphs, kern, before, keep_fallback, composed
+
+
+def compose_missing(needed, latin, builtin, keep_fallback):
+    """Adds the COMPOSED letters needed but in neither font to the font their
+    base letter comes from, sharing its kerning, or to the latin font when
+    LVGL's is kept as the fallback. Returns the letters added."""
+    def glyph(char):
+        code = ord(char)
+        return latin.glyphs.get(code) or builtin.glyphs.get(code)
+
+    added = ""
+    for char, (base, accented) in COMPOSED.items():
+        code = ord(char)
+        if (char not in needed or code in latin.glyphs or code in builtin.glyphs
+                or not glyph(base) or not glyph(accented)):
+            continue
+        letter = compose(glyph(base), glyph(accented), latin.bpp)
+        if not letter:
+            sys.exit(f"error: {accented!r} has nothing above {base!r} to build {char!r} from")
+        font = latin if ord(base) in latin.glyphs or keep_fallback else builtin
+        font.glyphs[code] = letter
+        if ord(base) in font.ids:
+            font.ids[code] = font.ids[ord(base)]
+        added += char
+    return added
+
+
+def verify(path, glyphs, kern):
+    """Parses the written font back and compares it with what it was cut from."""
+    font = Font(path)
+    for code, glyph in glyphs:
+        if code not in font.glyphs or font.glyphs[code].key() != glyph.key():
+            sys.exit(f"error: {path}: U+{code:04X} does not match its source")
+    if len(font.glyphs) != len(glyphs):
+        sys.exit(f"error: {path}: {len(font.glyphs)} glyphs, expected {len(glyphs)}")
+    for left, _ in glyphs:
+        for right, _ in glyphs:
+            expected = kern(left, right)
+            actual = font.kern(left, right)
+            if abs(actual - expected) > font.kern_scale // 2:
+                sys.exit(f"error: {path}: kerning U+{left:04X} U+{right:04X} is {actual}, "
+                         f"expected {expected}")
+    return font.data_bytes()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--lvgl", type=Path, default=DEFAULT_LVGL,
+                        help="LVGL library directory holding src/font/lv_font_montserrat_*.c")
+    mode = parser.add_mutually_exclusive_group()
+    mode.add_argument("--check", action="store_true",
+                      help="check glyphs and report sizes without writing the fonts")
+    mode.add_argument("--languages", action="store_true",
+                      help="report the glyphs and flash each language needs beyond ASCII")
+    args = parser.parse_args()
+    if args.languages:
+        report_languages(UI_SOURCE.read_text(encoding="utf-8"))
+        return
+    if not (args.lvgl / "src/font").is_dir():
+        sys.exit(f"error: {args.lvgl}/src/font not found; pass --lvgl or run "
+                 "'make install/libraries'")
+
+    needed = needed_glyphs(UI_SOURCE.read_text(encoding="utf-8"))
+    default_size = default_font_size()
+    OUTPUT_DIR.mkdir(exist_ok=True)
+    print(f"{'font':34} {'glyphs':>6} {'before':>8} {'after':>8} {'saved':>8}")
+    total_before = total_after = 0
+    for size in SIZES:
+        text, glyphs, kern, before, keep_fallback, composed = subset(size, needed[size],
+                                                                     args.lvgl, default_size)
+        path = OUTPUT_DIR / f"lv_font_montserrat_subset_{size}.c"
+        scratch = path.with_suffix(".tmp")
+        scratch.write_text(text, encoding="utf-8")
+        after = verify(scratch, glyphs, kern)
+        if args.check:
+            scratch.unlink()
+        else:
+            scratch.replace(path)
+        total_before += before
+        total_after += after
+        note = " (+ LVGL's default font)" if keep_fallback else ""
+        note += f" ({composed} composed)" if composed else ""
+        print(f"{path.name:34} {len(glyphs):6} {before:8} {after:8} {before - after:8}{note}")
+    print(f"{len(SIZES)} fonts: {total_before} bytes before, {total_after} after, "
+          f"{total_before - total_after} saved")
+
+    if not args.check:
+        declarations = "".join(f"LV_FONT_DECLARE(lv_font_montserrat_subset_{size});\n"
+                               for size in SIZES)
+        (OUTPUT_DIR / "font_subset.h").write_text(HEADER.format(declarations=declarations))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,158 @@
+// Unit tests for the touch filter and the lock-free touch event queue, on
+// Linux. Built and run by `make test/touch`.
+
+#include "touch_input.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+static bool check(const char* name, bool passed) {
+    printf("%-52s %s\n", name, passed ? "PASSED" : "FAILED");
+    return passed;
+}
+
+static TouchEvent event(int16_t x, int16_t y, bool pressed) {
+    TouchEvent e = {x, y, pressed};
+    return e;
+}
+
+static bool testFilter() {
+    bool passed = true;
+    int16_t x, y;
+
+    TouchFilter filter(128);
+    filter.add(1000, 2000, x, y);
+    passed &= check("Filter: first sample passes straight through", x == 1000 && y == 2000);
+
+    bool steady = true;
+    for (int i = 0; i < 50; i++) {
+        filter.add(1000, 2000, x, y);
+        steady &= x == 1000 && y == 2000;
+    }
+    passed &= check("Filter: steady input stays exact", steady);
+
+    // One wild sample among steady ones never reaches the output
+    filter.add(3900, 100, x, y);
+    bool rejected = x == 1000 && y == 2000;
+    filter.add(1000, 2000, x, y);
+    rejected &= x == 1000 && y == 2000;
+    passed &= check("Filter: single-sample spike rejected", rejected);
+
+    // A step moves the output monotonically and settles exactly
+    bool monotonic = true;
+    int16_t previous = 1000;
+    int settled_after = -1;
+    for (int i = 0; i < 40; i++) {
+        filter.add(1400, 2000, x, y);
+        monotonic &= x >= previous && x <= 1400;
+        previous = x;
+        if (x == 1400 && settled_after < 0) {
+            settled_after = i + 1;
+        }
+    }
+    passed &= check("Filter: step settles monotonically", monotonic && x == 1400);
+    passed &= check("Filter: step settles within 16 samples",
+                    settled_after > 0 && settled_after <= 16);
+
+    // A new stroke starts where the pen lands, not from the last stroke
+    filter.reset();
+    filter.add(300, 3500, x, y);
+    passed &= check("Filter: reset starts the next stroke without lag", x == 300 && y == 3500);
+
+    // Light smoothing still lands exactly on a steady input
+    TouchFilter light(16);
+    light.add(0, 0, x, y);
+    for (int i = 0; i < 200; i++) {
+        light.add(-37, 4095, x, y);
+    }
+    passed &= check("Filter: low weight converges exactly", x == -37 && y == 4095);
+
+    // Jitter of +-8 around a point is damped
+    TouchFilter jitter(64);
+    jitter.add(2000, 2000, x, y);
+    int worst = 0;
+    for (int i = 0; i < 200; i++) {
+        int16_t offset = (int16_t) ((i * 7919) % 17 - 8);
+        jitter.add(2000 + offset, 2000 - offset, x, y);
+        worst = std::max(worst, std::abs(x - 2000));
+    }
+    passed &= check("Filter: +-8 jitter damped to +-4", worst <= 4);
+    return passed;
+}
+
+static bool testQueue() {
+    bool passed = true;
+    TouchQueue<4> queue;
+    TouchEvent e;
+
+    passed &= check("Queue: empty pop fails", !queue.pop(e));
+    bool pushed = true;
+    for (int i = 0; i < 4; i++) {
+        pushed &= queue.push(event(i, 0, true));
+    }
+    passed &= check("Queue: fills to capacity", pushed);
+    passed &= check("Queue: push when full fails and counts a drop",
+                    !queue.push(event(9, 0, true)) && queue.dropped() == 1);
+    bool ordered = true;
+    for (int i = 0; i < 4; i++) {
+        ordered &= queue.pop(e) && e.x == i;
+    }
+    passed &= check("Queue: pops in order", ordered && !queue.pop(e));
+
+    // Indices keep counting past the capacity many times over
+    bool wrapped = true;
+    for (int i = 0; i < 1000; i++) {
+        wrapped &= queue.push(event(i, -i, i % 2)) && queue.push(event(i + 1, 0, true));
+        wrapped &= queue.pop(e) && e.x == i && e.y == -i && e.pressed == (i % 2 == 1);
+        wrapped &= queue.pop(e) && e.x == i + 1;
+    }
+    passed &= check("Queue: wraps around", wrapped);
+
+    // A tap shorter than one read period is still seen pressed, then released
+    TouchQueue<8> reads;
+    TouchEvent state;
+    bool more = reads.read(state);
+    bool idle = !more && !state.pressed;
+    reads.push(event(10, 20, true));
+    reads.push(event(12, 21, false));
+    more = reads.read(state);
+    bool tap = more && state.pressed && state.x == 10;
+    more = reads.read(state);
+    tap &= !more && !state.pressed && state.x == 12 && state.y == 21;
+    more = reads.read(state);
+    tap &= !more && !state.pressed && state.x == 12;
+    passed &= check("Queue: idle read is released", idle);
+    passed &= check("Queue: press and release between reads both seen", tap);
+
+    // One producer thread and one consumer, as on the device
+    static const uint32_t COUNT = 200000;
+    TouchQueue<32> shared;
+    std::thread producer([&shared]() {
+        for (uint32_t i = 0; i < COUNT; i++) {
+            TouchEvent e = event((int16_t) (i & 0x7FFF), (int16_t) (i >> 15), true);
+            while (!shared.push(e)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    bool in_order = true;
+    for (uint32_t i = 0; i < COUNT;) {
+        if (shared.pop(e)) {
+            in_order &= e.x == (int16_t) (i & 0x7FFF) && e.y == (int16_t) (i >> 15);
+            i++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    passed &= check("Queue: 200k events across threads, in order", in_order);
+    return passed;
+}
+
+int main() {
+    bool passed = testFilter();
+    passed &= testQueue();
+    printf("\n%s\n", passed ? "All touch tests passed" : "Some touch tests FAILED");
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,801 @@
+// Headless UI rendering benchmark and golden-image check on Linux. Built and
+// run by `make bench/ui`; options go in UI_BENCH_ARGS.
+//
+// The real Display and UI components are compiled against LVGL and the
+// shims in tools/host_shims, with a FramebufferBackend in place of the TFT.
+// A fixed clock and synthetic forecasts make every frame reproducible: a
+// few scenes are saved as PPM and PNG (and compared pixel for pixel with
+// --golden DIR), each scene is redrawn in the panel's big-endian byte order
+// and checked to be bit-identical to byte-swapping the native render (what
+// TFT_eSPI does on every flush without DISPLAY_PANEL_BYTE_ORDER), and then
+// weather updates, clock ticks and full redraws are timed frame by frame. The byte swap itself is timed
+// in pixels per second, and the compressed weather images are measured for
+// flash saved and decode time. Each pre-blended (opaque) image is drawn
+// against its RGB565A8 original on the main screen gradient, timed and
+// checked to match within one step per channel; the forecast icons are
+// drawn from the I4 atlas and the originals over the forecast box colour and
+// must stay within ICON_MIN_PSNR; the temperature readout is drawn from its
+// digit sprites and as a label, timed per update and checked to match; and a
+// week of updates shows how often the background cache has the one it needs
+// already decoded.
+//
+// Times are for comparing builds of the UI and rendering code on one
+// machine; the ESP32 renders an order of magnitude slower.
+
+#include "display.h"
+#include "framebuffer_backend.h"
+#include "ui.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <errno.h>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+// Globals that aura.ino defines for the firmware
+Language current_language = LANG_EN;
+bool use_fahrenheit = false;
+bool use_24_hour = true;
+char latitude[16] = LATITUDE_DEFAULT;
+char longitude[16] = LONGITUDE_DEFAULT;
+String location = LOCATION_DEFAULT;
+
+// The UI reads the wall clock for the clock label and the hourly window;
+// replacing libc's time() pins it, so frames do not depend on when they run
+static time_t bench_clock = 1753533240;  // 2025-07-26 12:34:00 UTC
+
+extern "C" time_t time(time_t* out) __THROW {
+    if (out) {
+        *out = bench_clock;
+    }
+    return bench_clock;
+}
+
+static uint64_t nowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// A week of plausible weather from local midnight of the bench clock. Day
+// and night codes and temperatures differ, so switching between the two
+// redraws the background, the icons and every label.
+static void sampleWeather(WeatherData& data, bool day) {
+    static const uint8_t DAY_CODES[7] = {0, 2, 3, 61, 80, 95, 1};
+    static const uint8_t NIGHT_CODES[7] = {63, 45, 71, 3, 0, 51, 2};
+    const uint8_t* codes = day ? DAY_CODES : NIGHT_CODES;
+    uint32_t midnight = (uint32_t) (bench_clock - bench_clock % 86400);
+
+    memset(&data, 0, sizeof(data));
+    data.current_temp = day ? 214 : 118;
+    data.feels_like = day ? 226 : 93;
+    data.weather_code = codes[0];
+    data.is_day = day;
+    strlcpy(data.location_name, "London", sizeof(data.location_name));
+    data.utc_offset = 0;
+    for (int i = 0; i < 7; i++) {
+        data.daily_times[i] = midnight + i * 86400;
+        data.daily_high[i] = (day ? 230 : 170) + i * 7 % 40;
+        data.daily_low[i] = (day ? 130 : 60) + i * 11 % 30;
+        data.daily_codes[i] = codes[i];
+    }
+    data.hourly_start = midnight;
+    data.hourly_count = WEATHER_HOURLY_CAPACITY;
+    for (int i = 0; i < WEATHER_HOURLY_CAPACITY; i++) {
+        // Warmest mid-afternoon, coolest before dawn
+        int hour = i % 24;
+        int swing = hour < 15 ? hour * 8 : (39 - hour) * 8 - 72;
+        data.hourly_temps[i] = (day ? 120 : 60) + swing;
+        data.hourly_codes[i] = codes[(i / 5) % 7];
+        data.hourly_precipitation[i] = (uint8_t) (i * 37 % 101);
+    }
+    data.fetched_at = (uint32_t) bench_clock;
+}
+
+static uint16_t swapBytes(uint16_t c) {
+    return (uint16_t) (c << 8 | c >> 8);
+}
+
+// Pixels per second through LVGL's word-wise swap that Display now runs,
+// against the pixel at a time swap TFT_eSPI ran before pushing
+static void benchSwap() {
+    static uint16_t band[SCREEN_WIDTH * DISPLAY_BUFFER_LINES];
+    const uint32_t size = SCREEN_WIDTH * DISPLAY_BUFFER_LINES;
+    const int rounds = 2000;
+    for (uint32_t i = 0; i < size; i++) {
+        band[i] = (uint16_t) (i * 2654435761u >> 16);
+    }
+
+    uint64_t started = nowUs();
+    for (int round = 0; round < rounds; round++) {
+        lv_draw_sw_rgb565_swap(band, size);
+        __asm__ volatile("" : : "r"(band) : "memory");
+    }
+    double wordwise = (double) size * rounds / std::max<uint64_t>(1, nowUs() - started);
+
+    started = nowUs();
+    for (int round = 0; round < rounds; round++) {
+        for (uint32_t i = 0; i < size; i++) {
+            band[i] = swapBytes(band[i]);
+        }
+        __asm__ volatile("" : : "r"(band) : "memory");
+    }
+    double scalar = (double) size * rounds / std::max<uint64_t>(1, nowUs() - started);
+
+    printf("\nRGB565 byte swap, %d-line bands: lv_draw_sw_rgb565_swap %.0f Mpixel/s, "
+           "per pixel %.0f Mpixel/s\n", DISPLAY_BUFFER_LINES, wordwise, scalar);
+}
+
+static bool makeDirectory(const std::string& path) {
+    return mkdir(path.c_str(), 0755) == 0 || errno == EEXIST;
+}
+
+static bool readFile(const std::string& path, std::string& contents) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+    char buffer[65536];
+    size_t n;
+    contents.clear();
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        contents.append(buffer, n);
+    }
+    fclose(file);
+    return true;
+}
+
+// Pixels that differ between two PPMs of the same size, or -1 if either is
+// missing or they are not comparable. Differences are written to diffPath
+// in red over a dimmed copy of the expected image.
+static long comparePpm(const std::string& expectedPath, const std::string& actualPath,
+                       const std::string& diffPath) {
+    std::string expected;
+    std::string actual;
+    if (!readFile(expectedPath, expected) || !readFile(actualPath, actual) ||
+        expected.size() != actual.size()) {
+        return -1;
+    }
+    // Both were written by savePpm, so the headers match when the sizes do
+    size_t header = expected.size() - (size_t) SCREEN_WIDTH * SCREEN_HEIGHT * 3;
+    if (expected.compare(0, header, actual, 0, header) != 0) {
+        return -1;
+    }
+    long differing = 0;
+    std::string diff = expected;
+    for (size_t i = header; i < expected.size(); i += 3) {
+        bool same = expected.compare(i, 3, actual, i, 3) == 0;
+        differing += !same;
+        diff[i] = same ? (char) ((uint8_t) expected[i] / 4) : (char) 0xFF;
+        diff[i + 1] = same ? (char) ((uint8_t) expected[i + 1] / 4) : 0;
+        diff[i + 2] = same ? (char) ((uint8_t) expected[i + 2] / 4) : 0;
+    }
+    if (differing > 0) {
+        FILE* file = fopen(diffPath.c_str(), "wb");
+        if (file) {
+            fwrite(diff.data(), 1, diff.size(), file);
+            fclose(file);
+        }
+    }
+    return differing;
+}
+
+struct Options {
+    uint32_t frames = 100;
+    std::string out = "ui_frames";
+    std::string golden;
+    bool update_golden = false;
+    bool verbose = false;
+};
+
+static void usage() {
+    printf("Usage: ui_bench [--frames N] [--out DIR] [--golden DIR [--update-golden]] "
+           "[--verbose]\n");
+}
+
+static bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string flag = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool takesValue = true;
+        if (flag == "--update-golden") {
+            options.update_golden = true;
+            takesValue = false;
+        } else if (flag == "--verbose") {
+            options.verbose = true;
+            takesValue = false;
+        } else if (!value) {
+            return false;
+        } else if (flag == "--frames") {
+            options.frames = std::max(1, atoi(value));
+        } else if (flag == "--out") {
+            options.out = value;
+        } else if (flag == "--golden") {
+            options.golden = value;
+        } else {
+            return false;
+        }
+        i += takesValue;
+    }
+    return !options.update_golden || !options.golden.empty();
+}
+
+// Renders whatever is dirty right away, as the LVGL refresh timer would
+static void renderFrame(Display& display) {
+    lv_tick_inc(1000 / 30);
+    lv_refr_now(display.getDisplay());
+}
+
+struct Bench {
+    FramebufferBackend& backend;
+    Display& display;
+    const Options& options;
+    int failures = 0;
+
+    // Saves the current frame, checks it in panel byte order and against
+    // the golden copy
+    void scene(const char* name) {
+        renderFrame(display);
+        std::string base = options.out + "/" + name;
+        if (!backend.savePpm((base + ".ppm").c_str()) || !backend.savePng((base + ".png").c_str())) {
+            printf("  %-16s cannot write %s.ppm/.png\n", name, base.c_str());
+            failures++;
+            return;
+        }
+        checkPanelByteOrder(name);
+        if (options.golden.empty()) {
+            printf("  %-16s %s.png\n", name, base.c_str());
+            return;
+        }
+        std::string golden = options.golden + "/" + name + ".ppm";
+        if (options.update_golden) {
+            bool saved = backend.savePpm(golden.c_str());
+            printf("  %-16s %s %s\n", name, saved ? "golden updated:" : "cannot write",
+                   golden.c_str());
+            failures += !saved;
+            return;
+        }
+        long differing = comparePpm(golden, base + ".ppm", base + ".diff.ppm");
+        if (differing == 0) {
+            printf("  %-16s matches golden\n", name);
+        } else if (differing < 0) {
+            printf("  %-16s FAIL: no comparable golden %s\n", name, golden.c_str());
+            failures++;
+        } else {
+            printf("  %-16s FAIL: %ld pixels differ, see %s.diff.ppm\n", name, differing,
+                   base.c_str());
+            failures++;
+        }
+    }
+
+    // Redraws the whole screen big-endian and compares every pixel with the
+    // native frame swapped one pixel at a time
+    void checkPanelByteOrder(const char* name) {
+        const size_t size = (size_t) SCREEN_WIDTH * SCREEN_HEIGHT;
+        std::vector<uint16_t> native(backend.pixels(), backend.pixels() + size);
+        backend.setPanelByteOrder(true);
+        lv_obj_invalidate(lv_screen_active());
+        renderFrame(display);
+        size_t differing = 0;
+        for (size_t i = 0; i < size; i++) {
+            differing += backend.pixels()[i] != swapBytes(native[i]);
+        }
+        backend.setPanelByteOrder(false);
+        lv_obj_invalidate(lv_screen_active());
+        renderFrame(display);
+        if (differing > 0) {
+            printf("  %-16s FAIL: %zu pixels differ in panel byte order\n", name, differing);
+            failures++;
+        }
+    }
+};
+
+struct Sample {
+    uint32_t update_us;  // The UI call that changed the widgets
+    uint32_t frame_us;   // LVGL rendering and flushing the result
+    uint32_t pixels;
+};
+
+static void report(const char* name, std::vector<Sample>& samples) {
+    if (samples.empty()) {
+        printf("%-14s %7s\n", name, "0");
+        return;
+    }
+    uint64_t update = 0;
+    uint64_t frame = 0;
+    uint64_t pixels = 0;
+    std::vector<uint32_t> frames;
+    for (const Sample& sample : samples) {
+        update += sample.update_us;
+        frame += sample.frame_us;
+        pixels += sample.pixels;
+        frames.push_back(sample.frame_us);
+    }
+    std::sort(frames.begin(), frames.end());
+    size_t count = samples.size();
+    size_t rank = (count * 95 + 99) / 100;
+    printf("%-14s %7zu %11llu %6.1f%% %9.3f %9.3f %9.3f %9.3f\n", name, count,
+           (unsigned long long) (pixels / count),
+           100.0 * pixels / count / (SCREEN_WIDTH * SCREEN_HEIGHT), update / 1000.0 / count,
+           frame / 1000.0 / count, frames[rank - 1] / 1000.0, frames.back() / 1000.0);
+}
+
+// An image as converted from the artwork (RGB565A8) and the smaller copy
+// the firmware draws instead
+struct WeatherImage {
+    const char* name;
+    const lv_image_dsc_t* original;
+    const lv_image_dsc_t* copy;
+};
+
+// Each weather image and its copy pre-blended onto the main screen gradient
+
+#define WEATHER_IMAGE(name) {#name, &name, &name##_opaque}
+
+static const WeatherImage WEATHER_IMAGES[] = {
+    WEATHER_IMAGE(image_blizzard), WEATHER_IMAGE(image_blowing_snow),
+    WEATHER_IMAGE(image_clear_night), WEATHER_IMAGE(image_cloudy),
+    WEATHER_IMAGE(image_drizzle), WEATHER_IMAGE(image_flurries),
+    WEATHER_IMAGE(image_haze_fog_dust_smoke), WEATHER_IMAGE(image_heavy_rain),
+    WEATHER_IMAGE(image_heavy_snow), WEATHER_IMAGE(image_isolated_scattered_tstorms_day),
+    WEATHER_IMAGE(image_isolated_scattered_tstorms_night),
+    WEATHER_IMAGE(image_mostly_clear_night), WEATHER_IMAGE(image_mostly_cloudy_day),
+    WEATHER_IMAGE(image_mostly_cloudy_night), WEATHER_IMAGE(image_mostly_sunny),
+    WEATHER_IMAGE(image_partly_cloudy), WEATHER_IMAGE(image_partly_cloudy_night),
+    WEATHER_IMAGE(image_scattered_showers_day), WEATHER_IMAGE(image_scattered_showers_night),
+    WEATHER_IMAGE(image_showers_rain), WEATHER_IMAGE(image_sleet_hail),
+    WEATHER_IMAGE(image_snow_showers_snow), WEATHER_IMAGE(image_strong_tstorms),
+    WEATHER_IMAGE(image_sunny), WEATHER_IMAGE(image_tornado),
+    WEATHER_IMAGE(image_wintry_mix_rain_snow),
+};
+
+static const int WEATHER_IMAGE_COUNT = sizeof(WEATHER_IMAGES) / sizeof(WEATHER_IMAGES[0]);
+
+// Size after decoding: from the header of a compressed image, else as stored
+static uint32_t rawSize(const lv_image_dsc_t* image) {
+    uint32_t header[3];
+    if (!(image->header.flags & LV_IMAGE_FLAGS_COMPRESSED)) {
+        return image->data_size;
+    }
+    memcpy(header, image->data, sizeof(header));
+    return header[2];
+}
+
+// The rendered pixels under obj, row by row
+static std::vector<uint16_t> capture(FramebufferBackend& backend, lv_obj_t* obj) {
+    std::vector<uint16_t> pixels;
+    lv_area_t area;
+    lv_obj_get_coords(obj, &area);
+    for (int32_t y = area.y1; y <= area.y2; y++) {
+        for (int32_t x = area.x1; x <= area.x2; x++) {
+            pixels.push_back(backend.pixel(x, y));
+        }
+    }
+    return pixels;
+}
+
+// Largest difference in any one channel between two RGB565 renders, in
+// steps of that channel
+static int channelDifference(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b) {
+    int worst = a.size() == b.size() ? 0 : 0xFF;
+    for (size_t i = 0; i < a.size() && i < b.size(); i++) {
+        worst = std::max(worst, std::abs((a[i] >> 11) - (b[i] >> 11)));
+        worst = std::max(worst, std::abs(((a[i] >> 5) & 0x3F) - ((b[i] >> 5) & 0x3F)));
+        worst = std::max(worst, std::abs((a[i] & 0x1F) - (b[i] & 0x1F)));
+    }
+    return worst;
+}
+
+// Peak signal-to-noise ratio between two RGB565 renders, each channel
+// widened to 8 bits; 99 dB when they are identical
+static double psnr(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b) {
+    if (a.empty() || a.size() != b.size()) {
+        return 0.0;
+    }
+    double squared = 0.0;
+    for (size_t i = 0; i < a.size(); i++) {
+        int channels[3][2] = {{a[i] >> 11, b[i] >> 11},
+                              {(a[i] >> 5) & 0x3F, (b[i] >> 5) & 0x3F},
+                              {a[i] & 0x1F, b[i] & 0x1F}};
+        for (int c = 0; c < 3; c++) {
+            double scale = c == 1 ? 255.0 / 63 : 255.0 / 31;
+            double difference = (channels[c][0] - channels[c][1]) * scale;
+            squared += difference * difference;
+        }
+    }
+    double mean = squared / (3.0 * a.size());
+    return mean == 0.0 ? 99.0 : 10.0 * log10(255.0 * 255.0 / mean);
+}
+
+// Flash and decode time of both sets of weather images
+static void benchImageSizes() {
+    uint64_t stored[2] = {0, 0};
+    uint64_t raw[2] = {0, 0};
+    BackgroundCache cache(BACKGROUND_CACHE_BYTES);
+    for (const WeatherImage& image : WEATHER_IMAGES) {
+        stored[0] += image.original->data_size;
+        raw[0] += rawSize(image.original);
+        stored[1] += image.copy->data_size;
+        raw[1] += rawSize(image.copy);
+        cache.clear();
+        cache.show(image.copy);
+    }
+    const BackgroundCacheStats& decodes = cache.stats();
+    uint32_t decoded = decodes.misses - decodes.failures;
+    const lv_image_header_t& header = WEATHER_IMAGES[0].copy->header;
+    uint64_t pixels = (uint64_t) header.w * header.h * decoded;
+    printf("\nWeather images: %d, RGB565A8 %llu bytes raw / %llu stored, "
+           "opaque RGB565 %llu raw / %llu stored (%.0f%% less flash)\n",
+           WEATHER_IMAGE_COUNT, (unsigned long long) raw[0], (unsigned long long) stored[0],
+           (unsigned long long) raw[1], (unsigned long long) stored[1],
+           100.0 - 100.0 * stored[1] / std::max<uint64_t>(1, stored[0]));
+    printf("  opaque decode: avg %.1f us, max %u us per image, %.1f Mpixel/s; %u failed\n",
+           decoded ? (double) decodes.decode_us / decoded : 0.0, decodes.max_decode_us,
+           (double) pixels / std::max<uint64_t>(1, decodes.decode_us), decodes.failures);
+}
+
+// Draws every weather image both ways where the today image sits, on a
+// screen with the main screen's gradient, and times the redraws. The
+// pre-blended copy must match what LVGL blends from the original to within
+// one step per channel; returns how many do not.
+static int benchOpaqueImages(FramebufferBackend& backend, Display& display, uint32_t rounds) {
+    lv_obj_t* previous = lv_screen_active();
+    lv_obj_t* screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(screen, lv_color_hex(MAIN_SCREEN_GRADIENT_TOP), LV_PART_MAIN);
+    lv_obj_set_style_bg_grad_color(screen, lv_color_hex(MAIN_SCREEN_GRADIENT_BOTTOM),
+                                   LV_PART_MAIN);
+    lv_obj_set_style_bg_grad_dir(screen, LV_GRAD_DIR_VER, LV_PART_MAIN);
+    lv_obj_t* image = lv_image_create(screen);
+    lv_obj_align(image, LV_ALIGN_TOP_MID, -64, TODAY_IMAGE_Y);
+    lv_screen_load(screen);
+
+    BackgroundCache decoded(64 * 1024);
+    uint64_t frame_us[2] = {0, 0};
+    uint32_t frames[2] = {0, 0};
+    int worst = 0;
+    int failures = 0;
+    for (const WeatherImage& pair : WEATHER_IMAGES) {
+        std::vector<uint16_t> drawn[2];
+        for (int opaque = 0; opaque < 2; opaque++) {
+            lv_image_set_src(image, decoded.show(opaque ? pair.copy : pair.original));
+            renderFrame(display);
+            drawn[opaque] = capture(backend, image);
+            for (uint32_t round = 0; round < rounds; round++) {
+                lv_obj_invalidate(image);
+                renderFrame(display);
+                frame_us[opaque] += backend.stats().last_frame_us;
+                frames[opaque]++;
+            }
+        }
+        int difference = channelDifference(drawn[0], drawn[1]);
+        worst = std::max(worst, difference);
+        if (difference > 1) {
+            printf("  %s_opaque differs from the blended original by %d steps\n", pair.name,
+                   difference);
+            failures++;
+        }
+    }
+    lv_screen_load(previous);
+    lv_obj_delete(screen);
+
+    double blended_ms = frames[0] ? frame_us[0] / 1000.0 / frames[0] : 0.0;
+    double opaque_ms = frames[1] ? frame_us[1] / 1000.0 / frames[1] : 0.0;
+    printf("  today image redraw: RGB565A8 %.3f ms, opaque %.3f ms (%.0f%% less); "
+           "largest difference %d step(s)\n",
+           blended_ms, opaque_ms, blended_ms > 0 ? 100.0 - 100.0 * opaque_ms / blended_ms : 0.0,
+           worst);
+    return failures;
+}
+
+// Each forecast icon as converted (RGB565A8) and as its slice of the I4 atlas
+#define ICON(name) {#name, &name, &name##_atlas}
+
+static const WeatherImage ICONS[] = {
+    ICON(icon_blizzard), ICON(icon_blowing_snow), ICON(icon_clear_night), ICON(icon_cloudy),
+    ICON(icon_drizzle), ICON(icon_flurries), ICON(icon_haze_fog_dust_smoke),
+    ICON(icon_heavy_rain), ICON(icon_heavy_snow), ICON(icon_isolated_scattered_tstorms_day),
+    ICON(icon_isolated_scattered_tstorms_night), ICON(icon_mostly_clear_night),
+    ICON(icon_mostly_cloudy_day), ICON(icon_mostly_cloudy_night), ICON(icon_mostly_sunny),
+    ICON(icon_partly_cloudy), ICON(icon_partly_cloudy_night), ICON(icon_scattered_showers_day),
+    ICON(icon_scattered_showers_night), ICON(icon_showers_rain), ICON(icon_sleet_hail),
+    ICON(icon_snow_showers_snow), ICON(icon_strong_tstorms), ICON(icon_sunny),
+    ICON(icon_tornado), ICON(icon_wintry_mix_rain_snow),
+};
+
+static const int ICON_COUNT = sizeof(ICONS) / sizeof(ICONS[0]);
+
+// The lowest PSNR an atlas icon may have against its original, as drawn
+// over the forecast box (tools/pack_icons.py --min-psnr)
+static const double ICON_MIN_PSNR = 30.0;
+
+// Draws all the icons at once over the forecast box colour, first the
+// originals and then the atlas slices, and times redrawing them. Returns
+// how many slices fall below ICON_MIN_PSNR against their original.
+static int benchIcons(FramebufferBackend& backend, Display& display, uint32_t rounds) {
+    lv_obj_t* previous = lv_screen_active();
+    lv_obj_t* screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(screen, lv_color_hex(FORECAST_BOX_COLOR), LV_PART_MAIN);
+    lv_obj_t* images[ICON_COUNT];
+    for (int i = 0; i < ICON_COUNT; i++) {
+        images[i] = lv_image_create(screen);
+        lv_obj_align(images[i], LV_ALIGN_TOP_LEFT, 12 + i % 9 * 24, 12 + i / 9 * 24);
+    }
+    lv_screen_load(screen);
+
+    uint64_t flash[2] = {0, 0};
+    uint64_t frame_us[2] = {0, 0};
+    std::vector<uint16_t> drawn[2][ICON_COUNT];
+    for (int atlas = 0; atlas < 2; atlas++) {
+        for (int i = 0; i < ICON_COUNT; i++) {
+            const lv_image_dsc_t* icon = atlas ? ICONS[i].copy : ICONS[i].original;
+            flash[atlas] += icon->data_size;
+            lv_image_set_src(images[i], icon);
+        }
+        renderFrame(display);
+        for (int i = 0; i < ICON_COUNT; i++) {
+            drawn[atlas][i] = capture(backend, images[i]);
+        }
+        for (uint32_t round = 0; round < rounds; round++) {
+            for (int i = 0; i < ICON_COUNT; i++) {
+                lv_obj_invalidate(images[i]);
+            }
+            renderFrame(display);
+            frame_us[atlas] += backend.stats().last_frame_us;
+        }
+    }
+    lv_screen_load(previous);
+    lv_obj_delete(screen);
+
+    int failures = 0;
+    double lowest = 99.0;
+    const char* lowest_name = "";
+    for (int i = 0; i < ICON_COUNT; i++) {
+        double quality = psnr(drawn[0][i], drawn[1][i]);
+        if (quality < lowest) {
+            lowest = quality;
+            lowest_name = ICONS[i].name;
+        }
+        if (quality < ICON_MIN_PSNR) {
+            printf("  %s_atlas is %.1f dB from the original, below %.0f dB\n", ICONS[i].name,
+                   quality, ICON_MIN_PSNR);
+            failures++;
+        }
+    }
+    double original_ms = frame_us[0] / 1000.0 / rounds;
+    double atlas_ms = frame_us[1] / 1000.0 / rounds;
+    printf("\nForecast icons: %d, RGB565A8 %llu bytes, I4 atlas %llu bytes (%.0f%% less flash)\n",
+           ICON_COUNT, (unsigned long long) flash[0], (unsigned long long) flash[1],
+           100.0 - 100.0 * flash[1] / std::max<uint64_t>(1, flash[0]));
+    printf("  redraw of all %d: RGB565A8 %.3f ms, atlas %.3f ms; lowest %.1f dB (%s)\n",
+           ICON_COUNT, original_ms, atlas_ms, lowest, lowest_name);
+    return failures;
+}
+
+// Shows every temperature from -40 to 50 in both units, once in a 42 px
+// label and once composed from digit sprites, where the main screen shows
+// it, timing the frame each change takes and then plain redraws. The
+// sprites must draw what the label does to within one step per channel;
+// returns how many temperatures do not.
+static int benchTemperatureSprites(UI& ui, FramebufferBackend& backend, Display& display,
+                                   uint32_t rounds) {
+    lv_obj_t* previous = lv_screen_active();
+    lv_obj_t* screen = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(screen, lv_color_hex(MAIN_SCREEN_GRADIENT_TOP), LV_PART_MAIN);
+    lv_obj_set_style_bg_grad_color(screen, lv_color_hex(MAIN_SCREEN_GRADIENT_BOTTOM),
+                                   LV_PART_MAIN);
+    lv_obj_set_style_bg_grad_dir(screen, LV_GRAD_DIR_VER, LV_PART_MAIN);
+
+    DigitSprites sprites;
+    if (!sprites.build(ui.getFont42(), TEMPERATURE_SPRITE_CHARS)) {
+        printf("\nTemperature sprites: FAIL: atlas could not be built\n");
+        lv_obj_delete(screen);
+        return 1;
+    }
+    lv_obj_t* readouts[2] = {lv_label_create(screen), sprites.create(screen)};
+    for (lv_obj_t* readout : readouts) {
+        lv_obj_set_style_text_font(readout, ui.getFont42(), LV_PART_MAIN);
+        lv_obj_set_style_text_color(readout, lv_color_white(), LV_PART_MAIN);
+        lv_obj_align(readout, LV_ALIGN_TOP_MID, 45, 25);
+        lv_obj_add_flag(readout, LV_OBJ_FLAG_HIDDEN);
+    }
+    lv_screen_load(screen);
+
+    uint64_t update_us[2] = {0, 0};
+    uint64_t redraw_us[2] = {0, 0};
+    uint32_t updates = 0;
+    int worst = 0;
+    int failures = 0;
+    for (int fahrenheit = 0; fahrenheit < 2; fahrenheit++) {
+        for (int degrees = -40; degrees <= 50; degrees++) {
+            char text[16];
+            snprintf(text, sizeof(text), "%d°%c", degrees, fahrenheit ? 'F' : 'C');
+            std::vector<uint16_t> drawn[2];
+            for (int sprite = 0; sprite < 2; sprite++) {
+                lv_obj_t* readout = readouts[sprite];
+                lv_obj_clear_flag(readout, LV_OBJ_FLAG_HIDDEN);
+                if (sprite) {
+                    sprites.setText(readout, text);
+                } else {
+                    lv_label_set_text(readout, text);
+                }
+                renderFrame(display);
+                update_us[sprite] += backend.stats().last_frame_us;
+                drawn[sprite] = capture(backend, screen);
+                for (uint32_t round = 0; round < rounds; round++) {
+                    lv_obj_invalidate(readout);
+                    renderFrame(display);
+                    redraw_us[sprite] += backend.stats().last_frame_us;
+                }
+                lv_obj_add_flag(readout, LV_OBJ_FLAG_HIDDEN);
+                renderFrame(display);
+            }
+            updates++;
+            int difference = channelDifference(drawn[0], drawn[1]);
+            worst = std::max(worst, difference);
+            if (difference > 1) {
+                printf("  %s from sprites differs from the label by %d steps\n", text,
+                       difference);
+                failures++;
+            }
+        }
+    }
+    lv_screen_load(previous);
+    lv_obj_delete(screen);
+
+    double label_ms = update_us[0] / 1000.0 / updates;
+    double sprite_ms = update_us[1] / 1000.0 / updates;
+    uint64_t redraws = (uint64_t) updates * std::max<uint32_t>(1, rounds);
+    printf("\nTemperature sprites: %s atlas of %zu bytes heap (+%zu bytes of tables), built "
+           "in %u us\n",
+           TEMPERATURE_SPRITE_CHARS, sprites.atlasBytes(), sizeof(DigitSprites),
+           sprites.buildUs());
+    printf("  %u updates: label %.3f ms, sprites %.3f ms (%.0f%% less); redraw: label %.3f ms, "
+           "sprites %.3f ms; largest difference %d step(s)\n",
+           updates, label_ms, sprite_ms, label_ms > 0 ? 100.0 - 100.0 * sprite_ms / label_ms : 0.0,
+           redraw_us[0] / 1000.0 / redraws, redraw_us[1] / 1000.0 / redraws, worst);
+    return failures;
+}
+
+// Hit rate of the UI's background cache over a week of weather updates
+// every 15 minutes through its own show and next-hour prefetch calls,
+// current conditions following the hourly forecast with night from 20:00 to
+// 06:00
+static void benchBackgroundCache(UI& ui, Display& display) {
+    static WeatherData week;
+    sampleWeather(week, true);
+    time_t saved_clock = bench_clock;
+    BackgroundCache& backgrounds = ui.getBackgrounds();
+    backgrounds.resetStats();
+    for (uint32_t step = 0; step < 7 * 24 * 4; step++) {
+        bench_clock = week.hourly_start + step * 900;
+        int hour = step / 4;
+        week.weather_code = week.hourly_codes[hour];
+        week.is_day = hour % 24 >= 6 && hour % 24 < 20;
+        week.fetched_at = (uint32_t) bench_clock;
+        ui.updateWeatherData(week);
+        ui.updateClock();
+    }
+    bench_clock = saved_clock;
+    renderFrame(display);
+    const BackgroundCacheStats& stats = backgrounds.stats();
+    uint32_t shown = stats.hits + stats.misses;
+    printf("  a week of updates every 15 min: %u shown, %.1f%% from cache, %u prefetched, "
+           "%u decoded on demand, %u evicted; %u of %u bytes in use\n",
+           shown, shown ? 100.0 * stats.hits / shown : 0.0, stats.prefetches, stats.misses,
+           stats.evictions, (unsigned) backgrounds.used(), (unsigned) backgrounds.budget());
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        usage();
+        return 2;
+    }
+    hostLogSetLevel(options.verbose ? ESP_LOG_DEBUG : ESP_LOG_ERROR);
+    setenv("TZ", "UTC", 1);
+    tzset();
+    if (!makeDirectory(options.out) || (!options.golden.empty() && options.update_golden &&
+                                        !makeDirectory(options.golden))) {
+        perror("output directory");
+        return 1;
+    }
+
+    FramebufferBackend backend;
+    Display display(backend);
+    UI ui;
+    if (!display.init() || !ui.init(&display)) {
+        return 1;
+    }
+
+    // Two snapshots, as WeatherTask hands over: each must outlive its update
+    static WeatherData day;
+    static WeatherData night;
+    sampleWeather(day, true);
+    sampleWeather(night, false);
+
+    printf("UI scenes (%dx%d RGB565, %s backend):\n", SCREEN_WIDTH, SCREEN_HEIGHT,
+           backend.name());
+    Bench bench = {backend, display, options};
+    ui.createMainScreen();
+    bench.scene("boot");
+    ui.updateWeatherData(day);
+    ui.updateClock();
+    bench.scene("forecast_day");
+    ui.updateWeatherData(night);
+    bench.scene("forecast_night");
+    static WeatherData stale;
+    stale = day;
+    stale.stale = true;
+    ui.updateWeatherData(stale);
+    bench.scene("stale");
+    use_fahrenheit = true;
+    use_24_hour = false;
+    ui.updateWeatherData(day);
+    ui.updateClock();
+    bench.scene("fahrenheit_12h");
+    use_fahrenheit = false;
+    use_24_hour = true;
+    ui.updateWeatherData(day);
+    ui.updateClock();
+
+    // Timed in the byte order the firmware flushes in
+    backend.setPanelByteOrder(DISPLAY_PANEL_BYTE_ORDER);
+    lv_obj_invalidate(lv_screen_active());
+    renderFrame(display);
+
+    // Timed frames: what each kind of change costs to draw
+    enum { WEATHER, CLOCK, REDRAW, KIND_COUNT };
+    static const char* KIND_NAMES[KIND_COUNT] = {"weather", "clock tick", "full redraw"};
+    std::vector<Sample> samples[KIND_COUNT];
+    backend.resetStats();
+    for (uint32_t i = 0; i < options.frames; i++) {
+        for (int kind = 0; kind < KIND_COUNT; kind++) {
+            uint32_t frames = backend.stats().frames;
+            uint64_t started = nowUs();
+            if (kind == WEATHER) {
+                ui.updateWeatherData(i % 2 ? day : night);
+            } else if (kind == CLOCK) {
+                bench_clock += 60;
+                ui.updateClock();
+            } else {
+                lv_obj_invalidate(lv_screen_active());
+            }
+            Sample sample;
+            sample.update_us = (uint32_t) (nowUs() - started);
+            renderFrame(display);
+            if (backend.stats().frames == frames) {
+                continue;  // Nothing changed on screen
+            }
+            sample.frame_us = backend.stats().last_frame_us;
+            sample.pixels = backend.stats().last_frame_pixels;
+            samples[kind].push_back(sample);
+        }
+    }
+
+    const FramebufferStats& stats = backend.stats();
+    printf("\n%u rounds: %u frames, %u flushes, %.3f ms/frame, %llu pixels/frame\n\n",
+           options.frames, stats.frames, stats.flushes,
+           stats.frames ? stats.total_us / 1000.0 / stats.frames : 0.0,
+           (unsigned long long) (stats.frames ? stats.pixels / stats.frames : 0));
+    printf("%-14s %7s %11s %7s %9s %9s %9s %9s\n", "change", "frames", "px/frame", "screen",
+           "update ms", "frame ms", "p95 ms", "max ms");
+    for (int kind = 0; kind < KIND_COUNT; kind++) {
+        report(KIND_NAMES[kind], samples[kind]);
+    }
+
+    benchSwap();
+    benchImageSizes();
+    bench.failures += benchOpaqueImages(backend, display, options.frames);
+    bench.failures += benchIcons(backend, display, options.frames);
+    bench.failures += benchTemperatureSprites(ui, backend, display, options.frames);
+    benchBackgroundCache(ui, display);
+
+    if (bench.failures > 0) {
+        printf("\n%d check(s) failed\n", bench.failures);
+        return 1;
+    }
+    return 0;
+}